@@ -14,6 +14,7 @@
 
 #include "routing_adaptor.hpp"
 
+#include <chrono>
 #include <memory>
 
 namespace autoware::adapi_adaptors
@@ -47,9 +48,12 @@ RoutingAdaptor::RoutingAdaptor(const rclcpp::NodeOptions & options)
     RouteState::name, state_qos,
     [this](const RouteState::Message::ConstSharedPtr msg) { state_ = msg->state; });
 
-  const auto rate = rclcpp::Rate(5.0);
+  // Wait a moment to combine consecutive goals and checkpoints into a single request. The timer is
+  // restarted by every goal and checkpoint, and is cancelled while no route is waiting.
+  const auto merge_period = std::chrono::milliseconds(100);
   timer_ = rclcpp::create_timer(
-    this, get_clock(), rate.period(), std::bind(&RoutingAdaptor::on_timer, this));
+    this, get_clock(), merge_period, std::bind(&RoutingAdaptor::on_timer, this));
+  timer_->cancel();
 
   state_ = RouteState::Message::UNKNOWN;
   route_ = std::make_shared<SetRoutePoints::Service::Request>();
@@ -57,37 +61,56 @@ RoutingAdaptor::RoutingAdaptor(const rclcpp::NodeOptions & options)
 
 void RoutingAdaptor::on_timer()
 {
-  // Wait a moment to combine consecutive goals and checkpoints into a single request.
-  // This value is rate dependent and set the wait time for merging.
-  constexpr int delay_count = 3;  // 0.4 seconds (rate * (value - 1))
-  if (0 < request_timing_control_ && request_timing_control_ < delay_count) {
-    ++request_timing_control_;
-  }
-  if (request_timing_control_ != delay_count) {
+  timer_->cancel();
+  is_route_pending_ = true;
+  send_route();
+}
+
+void RoutingAdaptor::request_route()
+{
+  timer_->reset();
+}
+
+void RoutingAdaptor::send_route()
+{
+  // The latest route is sent when the service being called responds.
+  if (calling_service_ || !is_route_pending_) {
     return;
   }
 
-  if (!calling_service_) {
-    if (state_ != RouteState::Message::UNSET) {
-      const auto request = std::make_shared<ClearRoute::Service::Request>();
-      calling_service_ = true;
-      cli_clear_->async_send_request(
-        request,
-        [this](rclcpp::Client<ClearRoute::Service>::SharedFuture) { calling_service_ = false; });
-    } else {
-      request_timing_control_ = 0;
-      calling_service_ = true;
-      cli_route_->async_send_request(
-        route_, [this](rclcpp::Client<SetRoutePoints::Service>::SharedFuture) {
-          calling_service_ = false;
-        });
-    }
+  calling_service_ = true;
+  if (state_ != RouteState::Message::UNSET) {
+    const auto request = std::make_shared<ClearRoute::Service::Request>();
+    cli_clear_->async_send_request(
+      request, [this](rclcpp::Client<ClearRoute::Service>::SharedFuture future) {
+        calling_service_ = false;
+        const auto & status = future.get()->status;
+        if (!status.success) {
+          RCLCPP_ERROR_STREAM(get_logger(), "Failed to clear the route: " << status.message);
+          is_route_pending_ = false;
+          return;
+        }
+        // The route state is UNSET once the route is cleared, even if it is not received yet.
+        state_ = RouteState::Message::UNSET;
+        send_route();
+      });
+  } else {
+    is_route_pending_ = false;
+    const auto request = std::make_shared<SetRoutePoints::Service::Request>(*route_);
+    cli_route_->async_send_request(
+      request, [this](rclcpp::Client<SetRoutePoints::Service>::SharedFuture future) {
+        calling_service_ = false;
+        if (future.get()->status.success) {
+          state_ = RouteState::Message::SET;
+        }
+        send_route();
+      });
   }
 }
 
 void RoutingAdaptor::on_fixed_goal(const PoseStamped::ConstSharedPtr pose)
 {
-  request_timing_control_ = 1;
+  request_route();
   route_->header = pose->header;
   route_->goal = pose->pose;
   route_->waypoints.clear();
@@ -96,7 +119,7 @@ void RoutingAdaptor::on_fixed_goal(const PoseStamped::ConstSharedPtr pose)
 
 void RoutingAdaptor::on_rough_goal(const PoseStamped::ConstSharedPtr pose)
 {
-  request_timing_control_ = 1;
+  request_route();
   route_->header = pose->header;
   route_->goal = pose->pose;
   route_->waypoints.clear();
@@ -109,7 +132,7 @@ void RoutingAdaptor::on_waypoint(const PoseStamped::ConstSharedPtr pose)
     RCLCPP_ERROR_STREAM(get_logger(), "The waypoint frame does not match the goal.");
     return;
   }
-  request_timing_control_ = 1;
+  request_route();
   route_->waypoints.push_back(pose->pose);
 }
 
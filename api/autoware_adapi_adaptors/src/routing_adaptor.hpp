@@ -47,11 +47,13 @@ private:
   rclcpp::TimerBase::SharedPtr timer_;
 
   bool calling_service_ = false;
-  int request_timing_control_ = 0;
+  bool is_route_pending_ = false;
   SetRoutePoints::Service::Request::SharedPtr route_;
   RouteState::Message::_state_type state_;
 
   void on_timer();
+  void request_route();
+  void send_route();
   void on_fixed_goal(const PoseStamped::ConstSharedPtr pose);
   void on_rough_goal(const PoseStamped::ConstSharedPtr pose);
   void on_waypoint(const PoseStamped::ConstSharedPtr pose);
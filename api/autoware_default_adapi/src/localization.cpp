@@ -18,6 +18,8 @@
 
 #include <autoware/component_interface_specs/utils.hpp>
 
+#include <memory>
+
 namespace autoware::default_adapi
 {
 
@@ -26,6 +28,7 @@ LocalizationNode::LocalizationNode(const rclcpp::NodeOptions & options)
 {
   diagnostics_.setHardwareID("none");
   diagnostics_.add("state", this, &LocalizationNode::diagnose_state);
+  diagnostics_.add("service_latency", &service_latency_, &ServiceLatency::diagnose);
 
   group_cli_ = create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
 
@@ -72,14 +75,28 @@ void LocalizationNode::on_state(const ImplState::Message::ConstSharedPtr msg)
 }
 
 void LocalizationNode::on_initialize(
-  const autoware::adapi_specs::localization::Initialize::Service::Request::SharedPtr req,
-  const autoware::adapi_specs::localization::Initialize::Service::Response::SharedPtr res)
+  const std::shared_ptr<rmw_request_id_t> header,
+  const autoware::adapi_specs::localization::Initialize::Service::Request::SharedPtr req)
 {
+  using Response = autoware::adapi_specs::localization::Initialize::Service::Response;
+  const auto start = ServiceLatency::Clock::now();
+  const auto send_response = [this, header, start](const Response & response) {
+    srv_initialize_->send_response(*header, response);
+    service_latency_.add(srv_initialize_->get_service_name(), start);
+  };
+
   if (!cli_initialize_->service_is_ready()) {
     RCLCPP_ERROR(get_logger(), "Initialize service is not ready");
+    send_response(Response{});
     return;
   }
-  res->status = localization_conversion::convert_call(cli_initialize_, req);
+  localization_conversion::convert_async_call(
+    cli_initialize_, req,
+    [send_response](const autoware_adapi_v1_msgs::msg::ResponseStatus & status) {
+      Response response;
+      response.status = status;
+      send_response(response);
+    });
 }
 
 }  // namespace autoware::default_adapi
@@ -15,11 +15,15 @@
 #ifndef LOCALIZATION_HPP_
 #define LOCALIZATION_HPP_
 
+#include "utils/service_latency.hpp"
+
 #include <autoware/adapi_specs/localization.hpp>
 #include <autoware/component_interface_specs/localization.hpp>
 #include <diagnostic_updater/diagnostic_updater.hpp>
 #include <rclcpp/rclcpp.hpp>
 
+#include <memory>
+
 namespace autoware::default_adapi
 {
 
@@ -44,12 +48,14 @@ private:
 
   void diagnose_state(diagnostic_updater::DiagnosticStatusWrapper & stat);
   void on_state(const ImplState::Message::ConstSharedPtr msg);
+  // The response is sent from the callback of the client, so that the call does not block.
   void on_initialize(
-    const autoware::adapi_specs::localization::Initialize::Service::Request::SharedPtr req,
-    const autoware::adapi_specs::localization::Initialize::Service::Response::SharedPtr res);
+    const std::shared_ptr<rmw_request_id_t> header,
+    const autoware::adapi_specs::localization::Initialize::Service::Request::SharedPtr req);
 
   ImplState::Message state_;
   diagnostic_updater::Updater diagnostics_;
+  ServiceLatency service_latency_;
 };
 
 }  // namespace autoware::default_adapi
@@ -55,6 +55,7 @@ RoutingNode::RoutingNode(const rclcpp::NodeOptions & options)
 
   diagnostics_.setHardwareID("none");
   diagnostics_.add("state", this, &RoutingNode::diagnose_state);
+  diagnostics_.add("service_latency", &service_latency_, &ServiceLatency::diagnose);
 
   group_cli_ = create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
 
@@ -198,86 +199,143 @@ void RoutingNode::on_route(const Route::Message::ConstSharedPtr msg)
   pub_route_->publish(conversion::convert_route(*msg));
 }
 
+template <class ServiceT>
+void RoutingNode::send_response(
+  const typename rclcpp::Service<ServiceT>::SharedPtr & service,
+  const std::shared_ptr<rmw_request_id_t> & header, const ResponseStatus & status,
+  const ServiceLatency::Clock::time_point & start)
+{
+  typename ServiceT::Response response;
+  response.status = status;
+  service->send_response(*header, response);
+  service_latency_.add(service->get_service_name(), start);
+}
+
 void RoutingNode::on_clear_route(
-  const autoware::adapi_specs::routing::ClearRoute::Service::Request::SharedPtr req,
-  const autoware::adapi_specs::routing::ClearRoute::Service::Response::SharedPtr res)
+  const std::shared_ptr<rmw_request_id_t> header,
+  const autoware::adapi_specs::routing::ClearRoute::Service::Request::SharedPtr req)
 {
+  using Service = autoware::adapi_specs::routing::ClearRoute::Service;
+  const auto start = ServiceLatency::Clock::now();
+
   // For safety, do not clear the route while it is in use.
   // https://autowarefoundation.github.io/autoware-documentation/main/design/autoware-interfaces/ad-api/list/api/routing/clear_route/
   if (is_auto_mode_ && is_autoware_control_) {
     if (!vehicle_stop_checker_.isVehicleStopped(stop_check_duration_)) {
-      res->status.success = false;
-      res->status.code = ResponseStatus::UNKNOWN;
-      res->status.message = "The route cannot be cleared while it is in use.";
+      ResponseStatus status;
+      status.success = false;
+      status.code = ResponseStatus::UNKNOWN;
+      status.message = "The route cannot be cleared while it is in use.";
+      send_response<Service>(srv_clear_route_, header, status, start);
       return;
     }
   }
 
   if (!cli_clear_route_->service_is_ready()) {
     RCLCPP_ERROR(get_logger(), "Clear route service is not ready");
+    send_response<Service>(srv_clear_route_, header, ResponseStatus{}, start);
     return;
   }
-  res->status = conversion::convert_call(cli_clear_route_, req);
+  conversion::convert_async_call(
+    cli_clear_route_, req, [this, header, start](const ResponseStatus & status) {
+      send_response<Service>(srv_clear_route_, header, status, start);
+    });
 }
 
 void RoutingNode::on_set_route_points(
-  const autoware::adapi_specs::routing::SetRoutePoints::Service::Request::SharedPtr req,
-  const autoware::adapi_specs::routing::SetRoutePoints::Service::Response::SharedPtr res)
+  const std::shared_ptr<rmw_request_id_t> header,
+  const autoware::adapi_specs::routing::SetRoutePoints::Service::Request::SharedPtr req)
 {
+  using Service = autoware::adapi_specs::routing::SetRoutePoints::Service;
+  const auto start = ServiceLatency::Clock::now();
+
   if (state_.state != State::Message::UNSET) {
-    res->status = route_already_set<autoware::adapi_specs::routing::SetRoutePoints>();
+    send_response<Service>(
+      srv_set_route_points_, header,
+      route_already_set<autoware::adapi_specs::routing::SetRoutePoints>(), start);
     return;
   }
   if (!cli_set_waypoint_route_->service_is_ready()) {
     RCLCPP_ERROR(get_logger(), "Set waypoint route service is not ready");
+    send_response<Service>(srv_set_route_points_, header, ResponseStatus{}, start);
     return;
   }
-  res->status = conversion::convert_call(cli_set_waypoint_route_, req);
+  conversion::convert_async_call(
+    cli_set_waypoint_route_, req, [this, header, start](const ResponseStatus & status) {
+      send_response<Service>(srv_set_route_points_, header, status, start);
+    });
 }
 
 void RoutingNode::on_set_route(
-  const autoware::adapi_specs::routing::SetRoute::Service::Request::SharedPtr req,
-  const autoware::adapi_specs::routing::SetRoute::Service::Response::SharedPtr res)
+  const std::shared_ptr<rmw_request_id_t> header,
+  const autoware::adapi_specs::routing::SetRoute::Service::Request::SharedPtr req)
 {
+  using Service = autoware::adapi_specs::routing::SetRoute::Service;
+  const auto start = ServiceLatency::Clock::now();
+
   if (state_.state != State::Message::UNSET) {
-    res->status = route_already_set<autoware::adapi_specs::routing::SetRoute>();
+    send_response<Service>(
+      srv_set_route_, header, route_already_set<autoware::adapi_specs::routing::SetRoute>(),
+      start);
     return;
   }
   if (!cli_set_lanelet_route_->service_is_ready()) {
     RCLCPP_ERROR(get_logger(), "Set lanelet route service is not ready");
+    send_response<Service>(srv_set_route_, header, ResponseStatus{}, start);
     return;
   }
-  res->status = conversion::convert_call(cli_set_lanelet_route_, req);
+  conversion::convert_async_call(
+    cli_set_lanelet_route_, req, [this, header, start](const ResponseStatus & status) {
+      send_response<Service>(srv_set_route_, header, status, start);
+    });
 }
 
 void RoutingNode::on_change_route_points(
-  const autoware::adapi_specs::routing::SetRoutePoints::Service::Request::SharedPtr req,
-  const autoware::adapi_specs::routing::SetRoutePoints::Service::Response::SharedPtr res)
+  const std::shared_ptr<rmw_request_id_t> header,
+  const autoware::adapi_specs::routing::SetRoutePoints::Service::Request::SharedPtr req)
 {
+  using Service = autoware::adapi_specs::routing::ChangeRoutePoints::Service;
+  const auto start = ServiceLatency::Clock::now();
+
   if (state_.state != State::Message::SET) {
-    res->status = route_is_not_set<autoware::adapi_specs::routing::SetRoutePoints>();
+    send_response<Service>(
+      srv_change_route_points_, header,
+      route_is_not_set<autoware::adapi_specs::routing::SetRoutePoints>(), start);
     return;
   }
   if (!cli_set_waypoint_route_->service_is_ready()) {
     RCLCPP_ERROR(get_logger(), "Set waypoint route service is not ready");
+    send_response<Service>(srv_change_route_points_, header, ResponseStatus{}, start);
     return;
   }
-  res->status = conversion::convert_call(cli_set_waypoint_route_, req);
+  conversion::convert_async_call(
+    cli_set_waypoint_route_, req, [this, header, start](const ResponseStatus & status) {
+      send_response<Service>(srv_change_route_points_, header, status, start);
+    });
 }
 
 void RoutingNode::on_change_route(
-  const autoware::adapi_specs::routing::SetRoute::Service::Request::SharedPtr req,
-  const autoware::adapi_specs::routing::SetRoute::Service::Response::SharedPtr res)
+  const std::shared_ptr<rmw_request_id_t> header,
+  const autoware::adapi_specs::routing::SetRoute::Service::Request::SharedPtr req)
 {
+  using Service = autoware::adapi_specs::routing::ChangeRoute::Service;
+  const auto start = ServiceLatency::Clock::now();
+
   if (state_.state != State::Message::SET) {
-    res->status = route_is_not_set<autoware::adapi_specs::routing::SetRoute>();
+    send_response<Service>(
+      srv_change_route_, header, route_is_not_set<autoware::adapi_specs::routing::SetRoute>(),
+      start);
     return;
   }
   if (!cli_set_lanelet_route_->service_is_ready()) {
     RCLCPP_ERROR(get_logger(), "Set lanelet route service is not ready");
+    send_response<Service>(srv_change_route_, header, ResponseStatus{}, start);
     return;
   }
-  res->status = conversion::convert_call(cli_set_lanelet_route_, req);
+  conversion::convert_async_call(
+    cli_set_lanelet_route_, req, [this, header, start](const ResponseStatus & status) {
+      send_response<Service>(srv_change_route_, header, status, start);
+    });
 }
 
 }  // namespace autoware::default_adapi
@@ -15,6 +15,8 @@
 #ifndef ROUTING_HPP_
 #define ROUTING_HPP_
 
+#include "utils/service_latency.hpp"
+
 #include <autoware/adapi_specs/routing.hpp>
 #include <autoware/component_interface_specs/planning.hpp>
 #include <autoware/component_interface_specs/system.hpp>
@@ -22,6 +24,8 @@
 #include <diagnostic_updater/diagnostic_updater.hpp>
 #include <rclcpp/rclcpp.hpp>
 
+#include <memory>
+
 namespace autoware::default_adapi
 {
 
@@ -71,26 +75,35 @@ private:
   void on_operation_mode(const OperationModeState::Message::ConstSharedPtr msg);
   void on_state(const State::Message::ConstSharedPtr msg);
   void on_route(const Route::Message::ConstSharedPtr msg);
+  // The service calls are relayed without waiting, and the responses are sent from the callbacks
+  // of the clients, so that a slow call does not block the other services and the states.
+  template <class ServiceT>
+  void send_response(
+    const typename rclcpp::Service<ServiceT>::SharedPtr & service,
+    const std::shared_ptr<rmw_request_id_t> & header,
+    const autoware_adapi_v1_msgs::msg::ResponseStatus & status,
+    const ServiceLatency::Clock::time_point & start);
   void on_clear_route(
-    const autoware::adapi_specs::routing::ClearRoute::Service::Request::SharedPtr req,
-    const autoware::adapi_specs::routing::ClearRoute::Service::Response::SharedPtr res);
+    const std::shared_ptr<rmw_request_id_t> header,
+    const autoware::adapi_specs::routing::ClearRoute::Service::Request::SharedPtr req);
   void on_set_route_points(
-    const autoware::adapi_specs::routing::SetRoutePoints::Service::Request::SharedPtr req,
-    const autoware::adapi_specs::routing::SetRoutePoints::Service::Response::SharedPtr res);
+    const std::shared_ptr<rmw_request_id_t> header,
+    const autoware::adapi_specs::routing::SetRoutePoints::Service::Request::SharedPtr req);
   void on_set_route(
-    const autoware::adapi_specs::routing::SetRoute::Service::Request::SharedPtr req,
-    const autoware::adapi_specs::routing::SetRoute::Service::Response::SharedPtr res);
+    const std::shared_ptr<rmw_request_id_t> header,
+    const autoware::adapi_specs::routing::SetRoute::Service::Request::SharedPtr req);
   void on_change_route_points(
-    const autoware::adapi_specs::routing::SetRoutePoints::Service::Request::SharedPtr req,
-    const autoware::adapi_specs::routing::SetRoutePoints::Service::Response::SharedPtr res);
+    const std::shared_ptr<rmw_request_id_t> header,
+    const autoware::adapi_specs::routing::SetRoutePoints::Service::Request::SharedPtr req);
   void on_change_route(
-    const autoware::adapi_specs::routing::SetRoute::Service::Request::SharedPtr req,
-    const autoware::adapi_specs::routing::SetRoute::Service::Response::SharedPtr res);
+    const std::shared_ptr<rmw_request_id_t> header,
+    const autoware::adapi_specs::routing::SetRoute::Service::Request::SharedPtr req);
 
   bool is_autoware_control_;
   bool is_auto_mode_;
   State::Message state_;
   diagnostic_updater::Updater diagnostics_;
+  ServiceLatency service_latency_;
 
   // Stop check for route clear.
   autoware::motion_utils::VehicleStopChecker vehicle_stop_checker_;
@@ -20,6 +20,8 @@
 #include <autoware_adapi_v1_msgs/srv/initialize_localization.hpp>
 #include <autoware_localization_msgs/srv/initialize_localization.hpp>
 
+#include <utility>
+
 namespace autoware::default_adapi::localization_conversion
 {
 
@@ -40,6 +42,17 @@ ExternalResponse convert_call(ClientT & client, RequestT & req)
   return convert_response(future.get()->status);
 }
 
+// Calls the service without waiting, and calls the callback with the converted response status.
+template <class ClientT, class RequestT, class CallbackT>
+void convert_async_call(ClientT & client, RequestT & req, CallbackT && callback)
+{
+  using SharedFuture = typename ClientT::element_type::SharedFuture;
+  client->async_send_request(
+    convert_request(req), [callback = std::forward<CallbackT>(callback)](SharedFuture future) {
+      callback(convert_response(future.get()->status));
+    });
+}
+
 }  // namespace autoware::default_adapi::localization_conversion
 
 #endif  // UTILS__LOCALIZATION_CONVERSION_HPP_
@@ -28,6 +28,8 @@
 #include <autoware_planning_msgs/srv/set_lanelet_route.hpp>
 #include <autoware_planning_msgs/srv/set_waypoint_route.hpp>
 
+#include <utility>
+
 namespace autoware::default_adapi::conversion
 {
 
@@ -63,6 +65,17 @@ ExternalResponse convert_call(ClientT & client, RequestT & req)
   return convert_response(future.get()->status);
 }
 
+// Calls the service without waiting, and calls the callback with the converted response status.
+template <class ClientT, class RequestT, class CallbackT>
+void convert_async_call(ClientT & client, RequestT & req, CallbackT && callback)
+{
+  using SharedFuture = typename ClientT::element_type::SharedFuture;
+  client->async_send_request(
+    convert_request(req), [callback = std::forward<CallbackT>(callback)](SharedFuture future) {
+      callback(convert_response(future.get()->status));
+    });
+}
+
 }  // namespace autoware::default_adapi::conversion
 
 #endif  // UTILS__ROUTE_CONVERSION_HPP_
@@ -0,0 +1,45 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "service_latency.hpp"
+
+#include <algorithm>
+#include <string>
+
+namespace autoware::default_adapi
+{
+
+void ServiceLatency::add(const std::string & name, const Clock::time_point & start)
+{
+  const auto latency_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto & latency = latencies_[name];
+  latency.last_ms = latency_ms;
+  latency.max_ms = std::max(latency.max_ms, latency_ms);
+  ++latency.count;
+}
+
+void ServiceLatency::diagnose(diagnostic_updater::DiagnosticStatusWrapper & stat)
+{
+  using diagnostic_msgs::msg::DiagnosticStatus;
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const auto & [name, latency] : latencies_) {
+    stat.add(name + " last [ms]", latency.last_ms);
+    stat.add(name + " max [ms]", latency.max_ms);
+    stat.add(name + " count", latency.count);
+  }
+  stat.summary(DiagnosticStatus::OK, "");
+}
+
+}  // namespace autoware::default_adapi
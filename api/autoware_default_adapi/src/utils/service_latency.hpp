@@ -0,0 +1,52 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UTILS__SERVICE_LATENCY_HPP_
+#define UTILS__SERVICE_LATENCY_HPP_
+
+#include <diagnostic_updater/diagnostic_updater.hpp>
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace autoware::default_adapi
+{
+
+// Latency of the relayed service calls, from the request to the response. The responses are sent
+// from the callbacks of the clients, so the latency is recorded from any thread.
+class ServiceLatency
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  void add(const std::string & name, const Clock::time_point & start);
+  void diagnose(diagnostic_updater::DiagnosticStatusWrapper & stat);
+
+private:
+  struct Latency
+  {
+    double last_ms{0.0};
+    double max_ms{0.0};
+    size_t count{0};
+  };
+
+  std::mutex mutex_;
+  std::map<std::string, Latency> latencies_;
+};
+
+}  // namespace autoware::default_adapi
+
+#endif  // UTILS__SERVICE_LATENCY_HPP_
@@ -71,6 +71,7 @@ struct Trajectory
   static constexpr size_t depth = 1;
   static constexpr auto reliability = RMW_QOS_POLICY_RELIABILITY_RELIABLE;
   static constexpr auto durability = RMW_QOS_POLICY_DURABILITY_VOLATILE;
+  static constexpr bool intra_process = true;
 };
 
 }  // namespace autoware::component_interface_specs::planning
@@ -15,12 +15,16 @@
 #ifndef AUTOWARE__COMPONENT_INTERFACE_SPECS__UTILS_HPP_
 #define AUTOWARE__COMPONENT_INTERFACE_SPECS__UTILS_HPP_
 
+#include <rclcpp/publisher_options.hpp>
 #include <rclcpp/qos.hpp>
+#include <rclcpp/subscription_options.hpp>
 
 #include <autoware_map_msgs/msg/lanelet_map_bin.hpp>
 #include <autoware_map_msgs/msg/map_projector_info.hpp>
 #include <sensor_msgs/msg/point_cloud2.hpp>
 
+#include <type_traits>
+
 namespace autoware::component_interface_specs
 {
 
@@ -30,6 +34,71 @@ rclcpp::QoS get_qos()
   return rclcpp::QoS{T::depth}.reliability(T::reliability).durability(T::durability);
 }
 
+namespace detail
+{
+template <typename T, typename = void>
+struct intra_process_hint : std::false_type
+{
+};
+template <typename T>
+struct intra_process_hint<T, std::void_t<decltype(T::intra_process)>>
+: std::bool_constant<T::intra_process>
+{
+};
+
+template <typename T, typename = void>
+struct loanable_hint : std::false_type
+{
+};
+template <typename T>
+struct loanable_hint<T, std::void_t<decltype(T::loanable)>> : std::bool_constant<T::loanable>
+{
+};
+}  // namespace detail
+
+// The optional hints of a topic interface, which are false if the interface does not declare them.
+// - intra_process: the topic is large or high-rate and its nodes usually share a container, so the
+//   intra-process communication is enabled. The topic must be volatile.
+// - loanable: the message is fixed-size, so the publishers can borrow loaned messages from the
+//   middleware when it supports them.
+template <typename T>
+constexpr bool prefers_intra_process()
+{
+  return detail::intra_process_hint<T>::value;
+}
+
+template <typename T>
+constexpr bool is_loanable()
+{
+  return detail::loanable_hint<T>::value;
+}
+
+template <typename T>
+rclcpp::PublisherOptions get_publisher_options()
+{
+  static_assert(
+    !prefers_intra_process<T>() || T::durability == RMW_QOS_POLICY_DURABILITY_VOLATILE,
+    "The intra-process communication supports only volatile topics.");
+  rclcpp::PublisherOptions options;
+  if constexpr (prefers_intra_process<T>()) {
+    options.use_intra_process_comm = rclcpp::IntraProcessSetting::Enable;
+  }
+  return options;
+}
+
+template <typename T>
+rclcpp::SubscriptionOptions get_subscription_options()
+{
+  static_assert(
+    !prefers_intra_process<T>() || T::durability == RMW_QOS_POLICY_DURABILITY_VOLATILE,
+    "The intra-process communication supports only volatile topics.");
+  rclcpp::SubscriptionOptions options;
+  if constexpr (prefers_intra_process<T>()) {
+    options.use_intra_process_comm = rclcpp::IntraProcessSetting::Enable;
+  }
+  return options;
+}
+
 }  // namespace autoware::component_interface_specs
 
 #endif  // AUTOWARE__COMPONENT_INTERFACE_SPECS__UTILS_HPP_
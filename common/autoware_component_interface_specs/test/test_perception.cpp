@@ -28,5 +28,11 @@ TEST(perception, interface)
     EXPECT_EQ(qos.depth(), depth);
     EXPECT_EQ(qos.reliability(), rclcpp::ReliabilityPolicy::Reliable);
     EXPECT_EQ(qos.durability(), rclcpp::DurabilityPolicy::Volatile);
+
+    EXPECT_TRUE(autoware::component_interface_specs::prefers_intra_process<ObjectRecognition>());
+    EXPECT_EQ(
+      autoware::component_interface_specs::get_subscription_options<ObjectRecognition>()
+        .use_intra_process_comm,
+      rclcpp::IntraProcessSetting::Enable);
   }
 }
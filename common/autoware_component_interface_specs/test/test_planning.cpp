@@ -41,5 +41,25 @@ TEST(planning, interface)
     EXPECT_EQ(qos.depth(), depth);
     EXPECT_EQ(qos.reliability(), rclcpp::ReliabilityPolicy::Reliable);
     EXPECT_EQ(qos.durability(), rclcpp::DurabilityPolicy::Volatile);
+
+    EXPECT_TRUE(autoware::component_interface_specs::prefers_intra_process<Trajectory>());
+    EXPECT_FALSE(autoware::component_interface_specs::is_loanable<Trajectory>());
+    EXPECT_EQ(
+      autoware::component_interface_specs::get_publisher_options<Trajectory>()
+        .use_intra_process_comm,
+      rclcpp::IntraProcessSetting::Enable);
+    EXPECT_EQ(
+      autoware::component_interface_specs::get_subscription_options<Trajectory>()
+        .use_intra_process_comm,
+      rclcpp::IntraProcessSetting::Enable);
+  }
+
+  {
+    using autoware::component_interface_specs::planning::LaneletRoute;
+    EXPECT_FALSE(autoware::component_interface_specs::prefers_intra_process<LaneletRoute>());
+    EXPECT_EQ(
+      autoware::component_interface_specs::get_publisher_options<LaneletRoute>()
+        .use_intra_process_comm,
+      rclcpp::IntraProcessSetting::NodeDefault);
   }
 }
@@ -19,12 +19,37 @@
 #include <geographic_msgs/msg/geo_point.hpp>
 #include <geometry_msgs/msg/point.hpp>
 
+#include <lanelet2_io/Projection.h>
+
+#include <memory>
+#include <vector>
+
 namespace autoware::geography_utils
 {
 using MapProjectorInfo = autoware_map_msgs::msg::MapProjectorInfo;
 using GeoPoint = geographic_msgs::msg::GeoPoint;
 using LocalPoint = geometry_msgs::msg::Point;
 
+/**
+ * Projection of a map projector info, which creates its lanelet2 projector once for all the
+ * points instead of once per point like project_forward() and project_reverse().
+ */
+class Projector
+{
+public:
+  explicit Projector(const MapProjectorInfo & projector_info);
+
+  [[nodiscard]] LocalPoint forward(const GeoPoint & geo_point) const;
+  [[nodiscard]] GeoPoint reverse(const LocalPoint & local_point) const;
+
+  [[nodiscard]] std::vector<LocalPoint> forward(const std::vector<GeoPoint> & geo_points) const;
+  [[nodiscard]] std::vector<GeoPoint> reverse(const std::vector<LocalPoint> & local_points) const;
+
+private:
+  MapProjectorInfo projector_info_;
+  std::unique_ptr<lanelet::Projector> projector_;
+};
+
 [[nodiscard]] LocalPoint project_forward(
   const GeoPoint & geo_point, const MapProjectorInfo & projector_info);
 [[nodiscard]] GeoPoint project_reverse(
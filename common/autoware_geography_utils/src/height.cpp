@@ -16,7 +16,9 @@
 
 #include <GeographicLib/Geoid.hpp>
 
+#include <algorithm>
 #include <map>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -24,19 +26,65 @@
 
 namespace autoware::geography_utils
 {
+namespace
+{
+/**
+ * EGM2008 geoid loaded once, which keeps the grid around the last converted point in memory.
+ * The conversions of the nearby points then interpolate the cached grid instead of reading the
+ * geoid file.
+ */
+class CachedEgm2008
+{
+public:
+  double convert_height(
+    const double height, const double latitude, const double longitude,
+    const GeographicLib::Geoid::convertflag direction)
+  {
+    // the geoid is not thread-safe while its cache is updated
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (
+      !geoid_.Cache() || latitude < south_ || north_ < latitude || longitude < west_ ||
+      east_ < longitude) {
+      south_ = std::max(latitude - cache_half_size, -90.0);
+      north_ = std::min(latitude + cache_half_size, 90.0);
+      west_ = longitude - cache_half_size;
+      east_ = longitude + cache_half_size;
+      geoid_.CacheArea(south_, west_, north_, east_);
+    }
+    return geoid_.ConvertHeight(latitude, longitude, height, direction);
+  }
+
+private:
+  // half size of the cached area around a point out of the previous one [deg]
+  static constexpr double cache_half_size = 0.5;
+
+  std::mutex mutex_;
+  GeographicLib::Geoid geoid_{"egm2008-1"};
+  double south_{0.0};
+  double north_{0.0};
+  double west_{0.0};
+  double east_{0.0};
+};
+
+CachedEgm2008 & get_egm2008()
+{
+  static CachedEgm2008 egm2008;
+  return egm2008;
+}
+}  // namespace
 
 double convert_wgs84_to_egm2008(const double height, const double latitude, const double longitude)
 {
-  GeographicLib::Geoid egm2008("egm2008-1");
   // cSpell: ignore ELLIPSOIDTOGEOID
-  return egm2008.ConvertHeight(latitude, longitude, height, GeographicLib::Geoid::ELLIPSOIDTOGEOID);
+  return get_egm2008().convert_height(
+    height, latitude, longitude, GeographicLib::Geoid::ELLIPSOIDTOGEOID);
 }
 
 double convert_egm2008_to_wgs84(const double height, const double latitude, const double longitude)
 {
-  GeographicLib::Geoid egm2008("egm2008-1");
   // cSpell: ignore GEOIDTOELLIPSOID
-  return egm2008.ConvertHeight(latitude, longitude, height, GeographicLib::Geoid::GEOIDTOELLIPSOID);
+  return get_egm2008().convert_height(
+    height, latitude, longitude, GeographicLib::Geoid::GEOIDTOELLIPSOID);
 }
 
 double convert_height(
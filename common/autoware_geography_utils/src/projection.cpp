@@ -18,6 +18,7 @@
 #include <autoware_lanelet2_extension/projection/mgrs_projector.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace autoware::geography_utils
 {
@@ -27,15 +28,20 @@ namespace autoware::geography_utils
   return Eigen::Vector3d{src.x, src.y, src.z};
 }
 
-LocalPoint project_forward(const GeoPoint & geo_point, const MapProjectorInfo & projector_info)
+Projector::Projector(const MapProjectorInfo & projector_info)
+: projector_info_(projector_info), projector_(get_lanelet2_projector(projector_info))
+{
+}
+
+LocalPoint Projector::forward(const GeoPoint & geo_point) const
 {
-  std::unique_ptr<lanelet::Projector> projector = get_lanelet2_projector(projector_info);
   const lanelet::GPSPoint position{geo_point.latitude, geo_point.longitude, geo_point.altitude};
 
   lanelet::BasicPoint3d projected_local_point;
-  if (projector_info.projector_type == MapProjectorInfo::MGRS) {
+  if (projector_info_.projector_type == MapProjectorInfo::MGRS) {
     constexpr int mgrs_precision = 9;  // set precision as 100 micro meter
-    const auto mgrs_projector = dynamic_cast<lanelet::projection::MGRSProjector *>(projector.get());
+    const auto * mgrs_projector =
+      dynamic_cast<const lanelet::projection::MGRSProjector *>(projector_.get());
 
     // project x and y using projector
     // note that the altitude is ignored in MGRS projection conventionally
@@ -44,12 +50,12 @@ LocalPoint project_forward(const GeoPoint & geo_point, const MapProjectorInfo &
     // project x and y using projector
     // note that the original projector such as UTM projector does not compensate for the altitude
     // offset
-    projected_local_point = projector->forward(position);
+    projected_local_point = projector_->forward(position);
 
     // correct z based on the map origin
     // note that the converted altitude in local point is in the same vertical datum as the geo
     // point
-    projected_local_point.z() = geo_point.altitude - projector_info.map_origin.altitude;
+    projected_local_point.z() = geo_point.altitude - projector_info_.map_origin.altitude;
   }
 
   LocalPoint local_point;
@@ -60,28 +66,26 @@ LocalPoint project_forward(const GeoPoint & geo_point, const MapProjectorInfo &
   return local_point;
 }
 
-GeoPoint project_reverse(const LocalPoint & local_point, const MapProjectorInfo & projector_info)
+GeoPoint Projector::reverse(const LocalPoint & local_point) const
 {
-  std::unique_ptr<lanelet::Projector> projector = get_lanelet2_projector(projector_info);
-
   lanelet::GPSPoint projected_gps_point;
-  if (projector_info.projector_type == MapProjectorInfo::MGRS) {
+  if (projector_info_.projector_type == MapProjectorInfo::MGRS) {
     const auto * mgrs_projector =
-      dynamic_cast<lanelet::projection::MGRSProjector *>(projector.get());
+      dynamic_cast<const lanelet::projection::MGRSProjector *>(projector_.get());
     // project latitude and longitude using projector
     // note that the z is ignored in MGRS projection conventionally
     projected_gps_point =
-      mgrs_projector->reverse(to_basic_point_3d_pt(local_point), projector_info.mgrs_grid);
+      mgrs_projector->reverse(to_basic_point_3d_pt(local_point), projector_info_.mgrs_grid);
   } else {
     // project latitude and longitude using projector
     // note that the original projector such as UTM projector does not compensate for the altitude
     // offset
-    projected_gps_point = projector->reverse(to_basic_point_3d_pt(local_point));
+    projected_gps_point = projector_->reverse(to_basic_point_3d_pt(local_point));
 
     // correct altitude based on the map origin
     // note that the converted altitude in local point is in the same vertical datum as the geo
     // point
-    projected_gps_point.ele = local_point.z + projector_info.map_origin.altitude;
+    projected_gps_point.ele = local_point.z + projector_info_.map_origin.altitude;
   }
 
   GeoPoint geo_point;
@@ -91,4 +95,34 @@ GeoPoint project_reverse(const LocalPoint & local_point, const MapProjectorInfo
   return geo_point;
 }
 
+std::vector<LocalPoint> Projector::forward(const std::vector<GeoPoint> & geo_points) const
+{
+  std::vector<LocalPoint> local_points;
+  local_points.reserve(geo_points.size());
+  for (const auto & geo_point : geo_points) {
+    local_points.push_back(forward(geo_point));
+  }
+  return local_points;
+}
+
+std::vector<GeoPoint> Projector::reverse(const std::vector<LocalPoint> & local_points) const
+{
+  std::vector<GeoPoint> geo_points;
+  geo_points.reserve(local_points.size());
+  for (const auto & local_point : local_points) {
+    geo_points.push_back(reverse(local_point));
+  }
+  return geo_points;
+}
+
+LocalPoint project_forward(const GeoPoint & geo_point, const MapProjectorInfo & projector_info)
+{
+  return Projector(projector_info).forward(geo_point);
+}
+
+GeoPoint project_reverse(const LocalPoint & local_point, const MapProjectorInfo & projector_info)
+{
+  return Projector(projector_info).reverse(local_point);
+}
+
 }  // namespace autoware::geography_utils
@@ -84,3 +84,28 @@ TEST(GeographyUtils, InvalidTargetDatum)
     autoware::geography_utils::convert_height(height, latitude, longitude, "WGS84", "INVALID2"),
     std::invalid_argument);
 }
+
+// Test case to verify that the conversions of the points in and out of the cached area agree
+TEST(GeographyUtils, ConversionAcrossCachedArea)
+{
+  const double height = 10.0;
+  const double latitude = 35.0;
+  const double longitude = 139.0;
+
+  const double converted_height =
+    autoware::geography_utils::convert_height(height, latitude, longitude, "WGS84", "EGM2008");
+
+  // a far point moves the cached area, and the first point is converted to the same height again
+  const double far_converted_height =
+    autoware::geography_utils::convert_height(height, 0.0, 0.0, "WGS84", "EGM2008");
+  EXPECT_NEAR(far_converted_height, -7.0, 3.0);
+  EXPECT_DOUBLE_EQ(
+    converted_height,
+    autoware::geography_utils::convert_height(height, latitude, longitude, "WGS84", "EGM2008"));
+
+  // and the reverse conversion
+  EXPECT_NEAR(
+    height, autoware::geography_utils::convert_height(
+              converted_height, latitude, longitude, "EGM2008", "WGS84"),
+    1e-9);
+}
@@ -18,6 +18,7 @@
 
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 TEST(GeographyUtilsProjection, ProjectForwardToMGRS)
 {
@@ -217,3 +218,50 @@ TEST(GeographyUtilsProjection, ProjectForwardAndReverseLocalCartesianOrigin)
   EXPECT_NEAR(converted_geo_point.longitude, geo_point.longitude, 0.0001);
   EXPECT_NEAR(converted_geo_point.altitude, geo_point.altitude, 0.0001);
 }
+
+TEST(GeographyUtilsProjection, ProjectorSameAsProjectFunctions)
+{
+  // source points
+  std::vector<geographic_msgs::msg::GeoPoint> geo_points(3);
+  for (size_t i = 0; i < geo_points.size(); ++i) {
+    geo_points[i].latitude = 35.62426 + 0.001 * static_cast<double>(i);
+    geo_points[i].longitude = 139.74252 - 0.001 * static_cast<double>(i);
+    geo_points[i].altitude = 10.0 * static_cast<double>(i);
+  }
+
+  // projector infos
+  autoware_map_msgs::msg::MapProjectorInfo mgrs_projector_info;
+  mgrs_projector_info.projector_type = autoware_map_msgs::msg::MapProjectorInfo::MGRS;
+  mgrs_projector_info.mgrs_grid = "54SUE";
+  mgrs_projector_info.vertical_datum = autoware_map_msgs::msg::MapProjectorInfo::WGS84;
+  autoware_map_msgs::msg::MapProjectorInfo local_cartesian_projector_info;
+  local_cartesian_projector_info.projector_type =
+    autoware_map_msgs::msg::MapProjectorInfo::LOCAL_CARTESIAN;
+  local_cartesian_projector_info.vertical_datum = autoware_map_msgs::msg::MapProjectorInfo::WGS84;
+  local_cartesian_projector_info.map_origin.latitude = 35.62426;
+  local_cartesian_projector_info.map_origin.longitude = 139.74252;
+  local_cartesian_projector_info.map_origin.altitude = -10.0;
+
+  for (const auto & projector_info : {mgrs_projector_info, local_cartesian_projector_info}) {
+    // conversion
+    const autoware::geography_utils::Projector projector(projector_info);
+    const auto converted_local_points = projector.forward(geo_points);
+    const auto converted_geo_points = projector.reverse(converted_local_points);
+
+    ASSERT_EQ(converted_local_points.size(), geo_points.size());
+    ASSERT_EQ(converted_geo_points.size(), geo_points.size());
+    for (size_t i = 0; i < geo_points.size(); ++i) {
+      const auto local_point =
+        autoware::geography_utils::project_forward(geo_points[i], projector_info);
+      EXPECT_DOUBLE_EQ(converted_local_points[i].x, local_point.x);
+      EXPECT_DOUBLE_EQ(converted_local_points[i].y, local_point.y);
+      EXPECT_DOUBLE_EQ(converted_local_points[i].z, local_point.z);
+
+      const auto geo_point =
+        autoware::geography_utils::project_reverse(converted_local_points[i], projector_info);
+      EXPECT_DOUBLE_EQ(converted_geo_points[i].latitude, geo_point.latitude);
+      EXPECT_DOUBLE_EQ(converted_geo_points[i].longitude, geo_point.longitude);
+      EXPECT_DOUBLE_EQ(converted_geo_points[i].altitude, geo_point.altitude);
+    }
+  }
+}
@@ -16,6 +16,7 @@
 #define AUTOWARE__INTERPOLATION__LINEAR_INTERPOLATION_HPP_
 
 #include "autoware/interpolation/interpolation_utils.hpp"
+#include "autoware/interpolation/query_segments.hpp"
 
 #include <vector>
 
@@ -30,6 +31,14 @@ std::vector<double> lerp(
 double lerp(
   const std::vector<double> & base_keys, const std::vector<double> & base_values,
   const double query_key);
+
+// linear interpolation on the segments located once for all the channels
+std::vector<double> lerp(const QuerySegments & segments, const std::vector<double> & base_values);
+
+// linear interpolation of the query_index-th query key without validating the base values
+double lerp(
+  const QuerySegments & segments, const std::vector<double> & base_values,
+  const size_t query_index);
 }  // namespace autoware::interpolation
 
 #endif  // AUTOWARE__INTERPOLATION__LINEAR_INTERPOLATION_HPP_
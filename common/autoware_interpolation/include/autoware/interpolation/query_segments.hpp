@@ -0,0 +1,63 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__INTERPOLATION__QUERY_SEGMENTS_HPP_
+#define AUTOWARE__INTERPOLATION__QUERY_SEGMENTS_HPP_
+
+#include <cstddef>
+#include <vector>
+
+namespace autoware::interpolation
+{
+// segment of the base keys containing each query key, located once to interpolate any number of
+// channels sharing the same base and query keys
+//
+// Usage:
+// ```
+// const QuerySegments segments(base_keys, query_keys);
+// const auto interpolated_x = lerp(segments, x);
+// const auto interpolated_v = lerp(segments, v);
+// const auto interpolated_quat = slerp(segments, quat);
+// ```
+class QuerySegments
+{
+public:
+  //!< @brief locate the segments by sweeping the base keys once along the sorted query keys
+  //!< @throw std::invalid_argument for invalid keys as lerp does
+  QuerySegments(const std::vector<double> & base_keys, const std::vector<double> & query_keys);
+
+  size_t getSize() const { return indices_.size(); }
+  size_t getBaseKeysSize() const { return base_keys_size_; }
+
+  //!< @brief index of the front base key of the segment of the i-th query key
+  size_t getIndex(const size_t i) const { return indices_.at(i); }
+
+  //!< @brief distance from the front base key of the segment to the i-th query key
+  double getOffset(const size_t i) const { return offsets_.at(i); }
+
+  //!< @brief ratio of the i-th query key in its segment, between 0 and 1
+  double getRatio(const size_t i) const { return ratios_.at(i); }
+
+  //!< @throw std::invalid_argument if the size of the base values is not the size of the base keys
+  void validateBaseValuesSize(const size_t base_values_size) const;
+
+private:
+  size_t base_keys_size_;
+  std::vector<size_t> indices_;
+  std::vector<double> offsets_;
+  std::vector<double> ratios_;
+};
+}  // namespace autoware::interpolation
+
+#endif  // AUTOWARE__INTERPOLATION__QUERY_SEGMENTS_HPP_
@@ -16,6 +16,7 @@
 #define AUTOWARE__INTERPOLATION__SPHERICAL_LINEAR_INTERPOLATION_HPP_
 
 #include "autoware/interpolation/interpolation_utils.hpp"
+#include "autoware/interpolation/query_segments.hpp"
 
 #include <tf2/utils.hpp>
 
@@ -35,6 +36,10 @@ std::vector<geometry_msgs::msg::Quaternion> slerp(
   const std::vector<geometry_msgs::msg::Quaternion> & base_values,
   const std::vector<double> & query_keys);
 
+// spherical linear interpolation on the segments located once for all the channels
+std::vector<geometry_msgs::msg::Quaternion> slerp(
+  const QuerySegments & segments, const std::vector<geometry_msgs::msg::Quaternion> & base_values);
+
 geometry_msgs::msg::Quaternion lerpOrientation(
   const geometry_msgs::msg::Quaternion & o_from, const geometry_msgs::msg::Quaternion & o_to,
   const double ratio);
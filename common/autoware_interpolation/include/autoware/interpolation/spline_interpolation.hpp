@@ -16,6 +16,7 @@
 #define AUTOWARE__INTERPOLATION__SPLINE_INTERPOLATION_HPP_
 
 #include "autoware/interpolation/interpolation_utils.hpp"
+#include "autoware/interpolation/query_segments.hpp"
 
 #include <Eigen/Core>
 #include <autoware_utils_geometry/geometry.hpp>
@@ -36,17 +37,32 @@ std::vector<double> splineByAkima(
   const std::vector<double> & base_keys, const std::vector<double> & base_values,
   const std::vector<double> & query_keys);
 
+//!< @brief solve a tridiagonal linear system with the Thomas algorithm without allocating memory
+//!<        once the capacity of the scratch buffer is enough.
+//!< @param lower sub-diagonal of size n - 1
+//!< @param diag diagonal of size n
+//!< @param upper super-diagonal of size n - 1
+//!< @param rhs right-hand side of size n, overwritten with the solution
+//!< @param scratch caller-owned buffer resized to n
+//!< @throw std::invalid_argument if the sizes do not match
+void solveTridiagonalMatrixAlgorithm(
+  const std::vector<double> & lower, const std::vector<double> & diag,
+  const std::vector<double> & upper, std::vector<double> & rhs, std::vector<double> & scratch);
+
 // non-static 1-dimensional spline interpolation
+// NOTE: The coefficients and the work buffers are kept in the object, so re-fitting the same
+//       object with calcSplineCoefficients does not allocate memory once the capacity is enough.
 //
 // Usage:
 // ```
 // SplineInterpolation spline;
+// spline.reserve(max_size);
 // // memorize pre-interpolation result internally
 // spline.calcSplineCoefficients(base_keys, base_values);
-// const auto interpolation_result1 = spline.getSplineInterpolatedValues(
-//   base_keys, query_keys1);
-// const auto interpolation_result2 = spline.getSplineInterpolatedValues(
-//   base_keys, query_keys2);
+// const auto interpolation_result1 = spline.getSplineInterpolatedValues(query_keys1);
+// const auto interpolation_result2 = spline.getSplineInterpolatedValues(query_keys2);
+// // re-fit in place in the next cycle
+// spline.calcSplineCoefficients(next_base_keys, next_base_values);
 // ```
 class SplineInterpolation
 {
@@ -58,17 +74,30 @@ public:
     calcSplineCoefficients(base_keys, base_values);
   }
 
+  //!< @brief calculate the spline coefficients, reusing the storage of the previous fitting
+  //!< @throw std::invalid_argument for invalid keys or values
+  void calcSplineCoefficients(
+    const std::vector<double> & base_keys, const std::vector<double> & base_values);
+
+  //!< @brief preallocate the storage to fit up to size base keys without allocating memory
+  void reserve(const size_t size);
+
   //!< @brief get values of spline interpolation on designated sampling points.
   //!< @details Assuming that query_keys are t vector for sampling, and interpolation is for x,
   //            meaning that spline interpolation was applied to x(t),
   //            return value will be x(t) vector
   std::vector<double> getSplineInterpolatedValues(const std::vector<double> & query_keys) const;
 
+  //!< @brief get values of spline interpolation on the segments located once for all the channels.
+  //!< @details The query keys slightly out of the base keys are cropped by QuerySegments.
+  std::vector<double> getSplineInterpolatedValues(const QuerySegments & segments) const;
+
   //!< @brief get 1st differential values of spline interpolation on designated sampling points.
   //!< @details Assuming that query_keys are t vector for sampling, and interpolation is for x,
   //            meaning that spline interpolation was applied to x(t),
   //            return value will be dx/dt(t) vector
   std::vector<double> getSplineInterpolatedDiffValues(const std::vector<double> & query_keys) const;
+  std::vector<double> getSplineInterpolatedDiffValues(const QuerySegments & segments) const;
 
   //!< @brief get 2nd differential values of spline interpolation on designated sampling points.
   //!< @details Assuming that query_keys are t vector for sampling, and interpolation is for x,
@@ -80,15 +109,20 @@ public:
   size_t getSize() const { return base_keys_.size(); }
 
 private:
-  Eigen::VectorXd a_;
-  Eigen::VectorXd b_;
-  Eigen::VectorXd c_;
-  Eigen::VectorXd d_;
+  std::vector<double> a_;
+  std::vector<double> b_;
+  std::vector<double> c_;
+  std::vector<double> d_;
 
   std::vector<double> base_keys_;
 
-  void calcSplineCoefficients(
-    const std::vector<double> & base_keys, const std::vector<double> & base_values);
+  // work buffers of calcSplineCoefficients
+  std::vector<double> h_;
+  std::vector<double> tridiagonal_diag_;
+  std::vector<double> tridiagonal_off_diag_;
+  std::vector<double> tridiagonal_rhs_;
+  std::vector<double> tridiagonal_scratch_;
+  std::vector<double> v_;
 
   Eigen::Index get_index(const double & key) const;
 };
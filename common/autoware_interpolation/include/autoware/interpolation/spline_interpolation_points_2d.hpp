@@ -17,6 +17,7 @@
 
 #include "autoware/interpolation/spline_interpolation.hpp"
 
+#include <cmath>
 #include <vector>
 
 namespace autoware::interpolation
@@ -31,8 +32,8 @@ std::vector<double> splineYawFromPoints(const std::vector<T> & points);
 // Usage:
 // ```
 // SplineInterpolationPoints2d spline;
-// // memorize pre-interpolation result internally
-// spline.calcSplineCoefficients(base_keys, base_values);
+// // memorize pre-interpolation result internally, reusing the storage of the previous fitting
+// spline.calcSplineCoefficients(points);
 // const auto interpolation_result1 = spline.getSplineInterpolatedPoint(
 //   base_keys, query_keys1);
 // const auto interpolation_result2 = spline.getSplineInterpolatedPoint(
@@ -47,11 +48,35 @@ public:
   template <typename T>
   explicit SplineInterpolationPoints2d(const std::vector<T> & points)
   {
-    std::vector<geometry_msgs::msg::Point> points_inner;
-    for (const auto & p : points) {
-      points_inner.push_back(autoware_utils_geometry::get_point(p));
+    calcSplineCoefficients(points);
+  }
+
+  //!< @brief calculate the spline coefficients of x, y and z along the 2d arc length
+  //!< @details The storage of the previous fitting is reused, so that re-fitting the same object
+  //            does not allocate memory once the capacity is enough.
+  //!< @throw std::logic_error if the number of unique points is less than 2
+  template <typename T>
+  void calcSplineCoefficients(const std::vector<T> & points)
+  {
+    // skip the points overlapping with the previous one
+    base_x_vec_.clear();
+    base_y_vec_.clear();
+    base_z_vec_.clear();
+    for (size_t i = 0; i < points.size(); i++) {
+      const auto & current_pos = autoware_utils_geometry::get_point(points.at(i));
+      if (i > 0) {
+        const auto & prev_pos = autoware_utils_geometry::get_point(points.at(i - 1));
+        if (
+          std::fabs(current_pos.x - prev_pos.x) < 1e-6 &&
+          std::fabs(current_pos.y - prev_pos.y) < 1e-6) {
+          continue;
+        }
+      }
+      base_x_vec_.push_back(current_pos.x);
+      base_y_vec_.push_back(current_pos.y);
+      base_z_vec_.push_back(current_pos.z);
     }
-    calcSplineCoefficientsInner(points_inner);
+    calcSplineCoefficientsInner();
   }
 
   // TODO(murooka) implement these functions
@@ -77,12 +102,15 @@ public:
   double getAccumulatedLength(const size_t idx) const;
 
 private:
-  void calcSplineCoefficientsInner(const std::vector<geometry_msgs::msg::Point> & points);
+  void calcSplineCoefficientsInner();
   SplineInterpolation spline_x_;
   SplineInterpolation spline_y_;
   SplineInterpolation spline_z_;
 
   std::vector<double> base_s_vec_;
+  std::vector<double> base_x_vec_;
+  std::vector<double> base_y_vec_;
+  std::vector<double> base_z_vec_;
 };
 }  // namespace autoware::interpolation
 
@@ -30,19 +30,25 @@ inline std::vector<size_t> calc_closest_segment_indices(
 
   std::vector<size_t> closest_segment_indices(validated_query_keys.size());
   size_t closest_segment_idx = 0;
+  // last segment whose front key is before the query key, which only moves forward since the
+  // query keys are sorted
+  size_t candidate_segment_idx = 0;
   for (size_t i = 0; i < validated_query_keys.size(); ++i) {
+    const double query_key = validated_query_keys.at(i);
     // Check if query_key is closes to the terminal point of the base keys
-    if (base_keys.back() - overlap_threshold < validated_query_keys.at(i)) {
+    if (base_keys.back() - overlap_threshold < query_key) {
       closest_segment_idx = base_keys.size() - 1;
     } else {
-      for (size_t j = base_keys.size() - 1; j > closest_segment_idx; --j) {
-        if (
-          base_keys.at(j - 1) - overlap_threshold < validated_query_keys.at(i) &&
-          validated_query_keys.at(i) < base_keys.at(j)) {
-          // find closest segment in base keys
-          closest_segment_idx = j - 1;
-          break;
-        }
+      while (candidate_segment_idx + 2 < base_keys.size() &&
+             base_keys.at(candidate_segment_idx + 1) - overlap_threshold < query_key) {
+        ++candidate_segment_idx;
+      }
+      // find closest segment in base keys
+      if (
+        closest_segment_idx <= candidate_segment_idx &&
+        base_keys.at(candidate_segment_idx) - overlap_threshold < query_key &&
+        query_key < base_keys.at(candidate_segment_idx + 1)) {
+        closest_segment_idx = candidate_segment_idx;
       }
     }
 
@@ -56,4 +56,25 @@ double lerp(
 {
   return lerp(base_keys, base_values, std::vector<double>{query_key}).front();
 }
+
+std::vector<double> lerp(const QuerySegments & segments, const std::vector<double> & base_values)
+{
+  // throw exception for invalid arguments
+  segments.validateBaseValuesSize(base_values.size());
+
+  std::vector<double> query_values(segments.getSize());
+  for (size_t i = 0; i < query_values.size(); ++i) {
+    query_values[i] = lerp(segments, base_values, i);
+  }
+  return query_values;
+}
+
+double lerp(
+  const QuerySegments & segments, const std::vector<double> & base_values,
+  const size_t query_index)
+{
+  const size_t key_index = segments.getIndex(query_index);
+  return lerp(
+    base_values.at(key_index), base_values.at(key_index + 1), segments.getRatio(query_index));
+}
 }  // namespace autoware::interpolation
@@ -0,0 +1,59 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/interpolation/query_segments.hpp"
+
+#include "autoware/interpolation/interpolation_utils.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace autoware::interpolation
+{
+QuerySegments::QuerySegments(
+  const std::vector<double> & base_keys, const std::vector<double> & query_keys)
+: base_keys_size_(base_keys.size())
+{
+  // throw exception for invalid arguments
+  const auto validated_query_keys = validateKeys(base_keys, query_keys);
+
+  indices_.reserve(validated_query_keys.size());
+  offsets_.reserve(validated_query_keys.size());
+  ratios_.reserve(validated_query_keys.size());
+
+  // NOTE: the query keys are sorted, so that the segment only moves forward
+  size_t key_index = 0;
+  for (const auto query_key : validated_query_keys) {
+    while (base_keys.at(key_index + 1) < query_key) {
+      ++key_index;
+    }
+
+    const double offset = query_key - base_keys.at(key_index);
+    indices_.push_back(key_index);
+    offsets_.push_back(offset);
+    ratios_.push_back(offset / (base_keys.at(key_index + 1) - base_keys.at(key_index)));
+  }
+}
+
+void QuerySegments::validateBaseValuesSize(const size_t base_values_size) const
+{
+  if (base_values_size != base_keys_size_) {
+    throw std::invalid_argument(
+      "The size of base_keys and base_values are not the same. base_keys.size() = " +
+      std::to_string(base_keys_size_) + ", base_values.size() = " +
+      std::to_string(base_values_size));
+  }
+}
+}  // namespace autoware::interpolation
@@ -59,6 +59,21 @@ std::vector<geometry_msgs::msg::Quaternion> slerp(
   return query_values;
 }
 
+std::vector<geometry_msgs::msg::Quaternion> slerp(
+  const QuerySegments & segments, const std::vector<geometry_msgs::msg::Quaternion> & base_values)
+{
+  // throw exception for invalid arguments
+  segments.validateBaseValuesSize(base_values.size());
+
+  std::vector<geometry_msgs::msg::Quaternion> query_values(segments.getSize());
+  for (size_t i = 0; i < query_values.size(); ++i) {
+    const size_t key_index = segments.getIndex(i);
+    query_values[i] =
+      slerp(base_values.at(key_index), base_values.at(key_index + 1), segments.getRatio(i));
+  }
+  return query_values;
+}
+
 geometry_msgs::msg::Quaternion lerpOrientation(
   const geometry_msgs::msg::Quaternion & o_from, const geometry_msgs::msg::Quaternion & o_to,
   const double ratio)
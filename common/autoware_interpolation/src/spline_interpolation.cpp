@@ -14,43 +14,44 @@
 
 #include "autoware/interpolation/spline_interpolation.hpp"
 
-#include <cstdint>
+#include <algorithm>
+#include <stdexcept>
 #include <vector>
 
 namespace autoware::interpolation
 {
-Eigen::VectorXd solve_tridiagonal_matrix_algorithm(
-  const Eigen::Ref<const Eigen::VectorXd> & a, const Eigen::Ref<const Eigen::VectorXd> & b,
-  const Eigen::Ref<const Eigen::VectorXd> & c, const Eigen::Ref<const Eigen::VectorXd> & d)
+void solveTridiagonalMatrixAlgorithm(
+  const std::vector<double> & lower, const std::vector<double> & diag,
+  const std::vector<double> & upper, std::vector<double> & rhs, std::vector<double> & scratch)
 {
-  const auto n = d.size();
+  const size_t n = rhs.size();
+  if (n == 0 || diag.size() != n || lower.size() + 1 != n || upper.size() + 1 != n) {
+    throw std::invalid_argument("The sizes of the tridiagonal matrix and rhs do not match.");
+  }
 
   if (n == 1) {
-    return d.array() / b.array();
+    rhs[0] /= diag[0];
+    return;
   }
 
-  Eigen::VectorXd c_prime = Eigen::VectorXd::Zero(n);
-  Eigen::VectorXd d_prime = Eigen::VectorXd::Zero(n);
-  Eigen::VectorXd x = Eigen::VectorXd::Zero(n);
+  // the modified super-diagonal is stored in the scratch, and the modified rhs in rhs
+  std::vector<double> & c_prime = scratch;
+  c_prime.resize(n);
 
   // Forward sweep
-  c_prime(0) = c(0) / b(0);
-  d_prime(0) = d(0) / b(0);
+  c_prime[0] = upper[0] / diag[0];
+  rhs[0] = rhs[0] / diag[0];
 
-  for (auto i = 1; i < n; i++) {
-    const double m = 1.0 / (b(i) - a(i - 1) * c_prime(i - 1));
-    c_prime(i) = i < n - 1 ? c(i) * m : 0;
-    d_prime(i) = (d(i) - a(i - 1) * d_prime(i - 1)) * m;
+  for (size_t i = 1; i < n; i++) {
+    const double m = 1.0 / (diag[i] - lower[i - 1] * c_prime[i - 1]);
+    c_prime[i] = i < n - 1 ? upper[i] * m : 0;
+    rhs[i] = (rhs[i] - lower[i - 1] * rhs[i - 1]) * m;
   }
 
   // Back substitution
-  x(n - 1) = d_prime(n - 1);
-
-  for (int64_t i = n - 2; i >= 0; i--) {
-    x(i) = d_prime(i) - c_prime(i) * x(i + 1);
+  for (size_t i = n - 1; i > 0; i--) {
+    rhs[i - 1] = rhs[i - 1] - c_prime[i - 1] * rhs[i];
   }
-
-  return x;
 }
 
 std::vector<double> spline(
@@ -145,52 +146,70 @@ Eigen::Index SplineInterpolation::get_index(const double & key) const
     static_cast<int>(base_keys_.size()) - 2);
 }
 
+void SplineInterpolation::reserve(const size_t size)
+{
+  for (auto * buffer :
+       {&a_, &b_, &c_, &d_, &base_keys_, &h_, &tridiagonal_diag_, &tridiagonal_off_diag_,
+        &tridiagonal_rhs_, &tridiagonal_scratch_, &v_}) {
+    buffer->reserve(size);
+  }
+}
+
 void SplineInterpolation::calcSplineCoefficients(
   const std::vector<double> & base_keys, const std::vector<double> & base_values)
 {
   // throw exceptions for invalid arguments
   autoware::interpolation::validateKeysAndValues(base_keys, base_values);
-  const Eigen::VectorXd x = Eigen::Map<const Eigen::VectorXd>(
-    base_keys.data(), static_cast<Eigen::Index>(base_keys.size()));
-  const Eigen::VectorXd y = Eigen::Map<const Eigen::VectorXd>(
-    base_values.data(), static_cast<Eigen::Index>(base_values.size()));
+  const auto & x = base_keys;
+  const auto & y = base_values;
 
-  const auto n = x.size();
+  const size_t n = x.size();
+
+  // NOTE: resize and assign reuse the capacity of the previous fitting.
+  a_.assign(n - 1, 0.0);
+  b_.assign(n - 1, 0.0);
+  c_.resize(n - 1);
+  d_.resize(n - 1);
+  base_keys_ = base_keys;
 
   if (n == 2) {
-    a_ = Eigen::VectorXd::Zero(1);
-    b_ = Eigen::VectorXd::Zero(1);
-    c_ = Eigen::VectorXd::Zero(1);
-    d_ = Eigen::VectorXd::Zero(1);
     c_[0] = (y[1] - y[0]) / (x[1] - x[0]);
     d_[0] = y[0];
-    base_keys_ = base_keys;
     return;
   }
 
   // Create Tridiagonal matrix
-  Eigen::VectorXd v(n);
-  const Eigen::VectorXd h = x.segment(1, n - 1) - x.segment(0, n - 1);
-  const Eigen::VectorXd a = h.segment(1, n - 3);
-  const Eigen::VectorXd b = 2 * (h.segment(0, n - 2) + h.segment(1, n - 2));
-  const Eigen::VectorXd c = h.segment(1, n - 3);
-  const Eigen::VectorXd y_diff = y.segment(1, n - 1) - y.segment(0, n - 1);
-  const Eigen::VectorXd d = 6 * (y_diff.segment(1, n - 2).array() / h.tail(n - 2).array() -
-                                 y_diff.segment(0, n - 2).array() / h.head(n - 2).array());
+  h_.resize(n - 1);
+  for (size_t i = 0; i < n - 1; ++i) {
+    h_[i] = x[i + 1] - x[i];
+  }
+  tridiagonal_diag_.resize(n - 2);
+  tridiagonal_off_diag_.resize(n - 3);
+  tridiagonal_rhs_.resize(n - 2);
+  for (size_t i = 0; i < n - 2; ++i) {
+    tridiagonal_diag_[i] = 2 * (h_[i] + h_[i + 1]);
+    tridiagonal_rhs_[i] = 6 * ((y[i + 2] - y[i + 1]) / h_[i + 1] - (y[i + 1] - y[i]) / h_[i]);
+  }
+  for (size_t i = 0; i < n - 3; ++i) {
+    tridiagonal_off_diag_[i] = h_[i + 1];
+  }
 
   // Solve tridiagonal matrix
-  v.segment(1, n - 2) = solve_tridiagonal_matrix_algorithm(a, b, c, d);
-  v[0] = 0;
-  v[n - 1] = 0;
+  solveTridiagonalMatrixAlgorithm(
+    tridiagonal_off_diag_, tridiagonal_diag_, tridiagonal_off_diag_, tridiagonal_rhs_,
+    tridiagonal_scratch_);
+  v_.resize(n);
+  std::copy(tridiagonal_rhs_.begin(), tridiagonal_rhs_.end(), v_.begin() + 1);
+  v_[0] = 0;
+  v_[n - 1] = 0;
 
   // Calculate spline coefficients
-  a_ = (v.tail(n - 1) - v.head(n - 1)).array() / 6.0 / (x.tail(n - 1) - x.head(n - 1)).array();
-  b_ = v.segment(0, n - 1) / 2.0;
-  c_ = (y.tail(n - 1) - y.head(n - 1)).array() / (x.tail(n - 1) - x.head(n - 1)).array() -
-       (x.tail(n - 1) - x.head(n - 1)).array() *
-         (2 * v.segment(0, n - 1).array() + v.segment(1, n - 1).array()) / 6.0;
-  d_ = y.head(n - 1);
-  base_keys_ = base_keys;
+  for (size_t i = 0; i < n - 1; ++i) {
+    a_[i] = (v_[i + 1] - v_[i]) / 6.0 / h_[i];
+    b_[i] = v_[i] / 2.0;
+    c_[i] = (y[i + 1] - y[i]) / h_[i] - h_[i] * (2 * v_[i] + v_[i + 1]) / 6.0;
+    d_[i] = y[i];
+  }
 }
 
 std::vector<double> SplineInterpolation::getSplineInterpolatedValues(
@@ -211,6 +230,22 @@ std::vector<double> SplineInterpolation::getSplineInterpolatedValues(
   return interpolated_values;
 }
 
+std::vector<double> SplineInterpolation::getSplineInterpolatedValues(
+  const QuerySegments & segments) const
+{
+  // throw exceptions for invalid arguments
+  segments.validateBaseValuesSize(base_keys_.size());
+  std::vector<double> interpolated_values(segments.getSize());
+
+  for (size_t i = 0; i < interpolated_values.size(); ++i) {
+    const auto idx = segments.getIndex(i);
+    const auto dx = segments.getOffset(i);
+    interpolated_values[i] = a_[idx] * dx * dx * dx + b_[idx] * dx * dx + c_[idx] * dx + d_[idx];
+  }
+
+  return interpolated_values;
+}
+
 std::vector<double> SplineInterpolation::getSplineInterpolatedDiffValues(
   const std::vector<double> & query_keys) const
 {
@@ -228,6 +263,22 @@ std::vector<double> SplineInterpolation::getSplineInterpolatedDiffValues(
   return interpolated_diff_values;
 }
 
+std::vector<double> SplineInterpolation::getSplineInterpolatedDiffValues(
+  const QuerySegments & segments) const
+{
+  // throw exceptions for invalid arguments
+  segments.validateBaseValuesSize(base_keys_.size());
+  std::vector<double> interpolated_diff_values(segments.getSize());
+
+  for (size_t i = 0; i < interpolated_diff_values.size(); ++i) {
+    const auto idx = segments.getIndex(i);
+    const auto dx = segments.getOffset(i);
+    interpolated_diff_values[i] = 3 * a_[idx] * dx * dx + 2 * b_[idx] * dx + c_[idx];
+  }
+
+  return interpolated_diff_values;
+}
+
 std::vector<double> SplineInterpolation::getSplineInterpolatedQuadDiffValues(
   const std::vector<double> & query_keys) const
 {
@@ -14,59 +14,12 @@
 
 #include "autoware/interpolation/spline_interpolation_points_2d.hpp"
 
+#include <cmath>
+#include <stdexcept>
 #include <vector>
 
 namespace autoware::interpolation
 {
-std::vector<double> calcEuclidDist(const std::vector<double> & x, const std::vector<double> & y)
-{
-  if (x.size() != y.size()) {
-    return std::vector<double>{};
-  }
-
-  std::vector<double> dist_v;
-  dist_v.push_back(0.0);
-  for (size_t i = 0; i < x.size() - 1; ++i) {
-    const double dx = x.at(i + 1) - x.at(i);
-    const double dy = y.at(i + 1) - y.at(i);
-    dist_v.push_back(dist_v.at(i) + std::hypot(dx, dy));
-  }
-
-  return dist_v;
-}
-
-std::array<std::vector<double>, 4> getBaseValues(
-  const std::vector<geometry_msgs::msg::Point> & points)
-{
-  // calculate x, y
-  std::vector<double> base_x;
-  std::vector<double> base_y;
-  std::vector<double> base_z;
-  for (size_t i = 0; i < points.size(); i++) {
-    const auto & current_pos = points.at(i);
-    if (i > 0) {
-      const auto & prev_pos = points.at(i - 1);
-      if (
-        std::fabs(current_pos.x - prev_pos.x) < 1e-6 &&
-        std::fabs(current_pos.y - prev_pos.y) < 1e-6) {
-        continue;
-      }
-    }
-    base_x.push_back(current_pos.x);
-    base_y.push_back(current_pos.y);
-    base_z.push_back(current_pos.z);
-  }
-
-  // calculate base_keys, base_values
-  if (base_x.size() < 2 || base_y.size() < 2 || base_z.size() < 2) {
-    throw std::logic_error("The number of unique points is not enough.");
-  }
-
-  const std::vector<double> base_s = calcEuclidDist(base_x, base_y);
-
-  return {base_s, base_x, base_y, base_z};
-}
-
 template <typename T>
 std::vector<double> splineYawFromPoints(const std::vector<T> & points)
 {
@@ -202,19 +155,24 @@ double SplineInterpolationPoints2d::getAccumulatedLength(const size_t idx) const
   return base_s_vec_.at(idx);
 }
 
-void SplineInterpolationPoints2d::calcSplineCoefficientsInner(
-  const std::vector<geometry_msgs::msg::Point> & points)
+void SplineInterpolationPoints2d::calcSplineCoefficientsInner()
 {
-  const auto base = getBaseValues(points);
+  if (base_x_vec_.size() < 2) {
+    throw std::logic_error("The number of unique points is not enough.");
+  }
 
-  base_s_vec_ = base.at(0);
-  const auto & base_x_vec = base.at(1);
-  const auto & base_y_vec = base.at(2);
-  const auto & base_z_vec = base.at(3);
+  // calculate the accumulated 2d distance as base keys
+  base_s_vec_.resize(base_x_vec_.size());
+  base_s_vec_.front() = 0.0;
+  for (size_t i = 0; i < base_x_vec_.size() - 1; ++i) {
+    const double dx = base_x_vec_.at(i + 1) - base_x_vec_.at(i);
+    const double dy = base_y_vec_.at(i + 1) - base_y_vec_.at(i);
+    base_s_vec_.at(i + 1) = base_s_vec_.at(i) + std::hypot(dx, dy);
+  }
 
   // calculate spline coefficients
-  spline_x_ = SplineInterpolation(base_s_vec_, base_x_vec);
-  spline_y_ = SplineInterpolation(base_s_vec_, base_y_vec);
-  spline_z_ = SplineInterpolation(base_s_vec_, base_z_vec);
+  spline_x_.calcSplineCoefficients(base_s_vec_, base_x_vec_);
+  spline_y_.calcSplineCoefficients(base_s_vec_, base_y_vec_);
+  spline_z_.calcSplineCoefficients(base_s_vec_, base_z_vec_);
 }
 }  // namespace autoware::interpolation
@@ -0,0 +1,92 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/interpolation/linear_interpolation.hpp"
+#include "autoware/interpolation/query_segments.hpp"
+#include "autoware/interpolation/spherical_linear_interpolation.hpp"
+#include "autoware/interpolation/spline_interpolation.hpp"
+
+#include <autoware_utils_geometry/geometry.hpp>
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <vector>
+
+using autoware::interpolation::QuerySegments;
+
+TEST(query_segments, segments)
+{
+  const std::vector<double> base_keys{-1.5, 1.0, 5.0, 10.0, 15.0, 20.0};
+  // the first and last keys are slightly out of the base keys and cropped
+  const std::vector<double> query_keys{-1.5001, 1.0, 1.0, 3.0, 12.5, 20.0001};
+
+  const QuerySegments segments(base_keys, query_keys);
+  ASSERT_EQ(segments.getSize(), query_keys.size());
+  EXPECT_EQ(segments.getBaseKeysSize(), base_keys.size());
+
+  const std::vector<size_t> ans_indices{0, 0, 0, 1, 3, 4};
+  const std::vector<double> ans_ratios{0.0, 1.0, 1.0, 0.5, 0.5, 1.0};
+  for (size_t i = 0; i < query_keys.size(); ++i) {
+    EXPECT_EQ(segments.getIndex(i), ans_indices.at(i));
+    EXPECT_DOUBLE_EQ(segments.getRatio(i), ans_ratios.at(i));
+  }
+  EXPECT_DOUBLE_EQ(segments.getOffset(3), 2.0);
+
+  // invalid keys
+  EXPECT_THROW(QuerySegments(base_keys, {}), std::invalid_argument);
+  EXPECT_THROW(QuerySegments({0.0}, {0.0}), std::invalid_argument);
+  EXPECT_THROW(QuerySegments(base_keys, {3.0, 1.0}), std::invalid_argument);
+  EXPECT_THROW(QuerySegments(base_keys, {30.0}), std::invalid_argument);
+}
+
+TEST(query_segments, same_results_as_each_channel)
+{
+  const std::vector<double> base_keys{-1.5, 1.0, 5.0, 10.0, 15.0, 20.0};
+  const std::vector<double> base_values_1{-1.2, 0.5, 1.0, 1.2, 2.0, 1.0};
+  const std::vector<double> base_values_2{3.0, 2.0, 0.0, -1.0, 4.0, 8.0};
+  const std::vector<double> query_keys{-1.5, 0.0, 1.0, 2.3, 7.7, 10.0, 19.5, 20.0};
+
+  const QuerySegments segments(base_keys, query_keys);
+  for (const auto & base_values : {base_values_1, base_values_2}) {
+    EXPECT_EQ(
+      autoware::interpolation::lerp(segments, base_values),
+      autoware::interpolation::lerp(base_keys, base_values, query_keys));
+
+    const autoware::interpolation::SplineInterpolation spline(base_keys, base_values);
+    EXPECT_EQ(
+      spline.getSplineInterpolatedValues(segments), spline.getSplineInterpolatedValues(query_keys));
+    EXPECT_EQ(
+      spline.getSplineInterpolatedDiffValues(segments),
+      spline.getSplineInterpolatedDiffValues(query_keys));
+  }
+
+  std::vector<geometry_msgs::msg::Quaternion> base_quats;
+  for (size_t i = 0; i < base_keys.size(); ++i) {
+    base_quats.push_back(
+      autoware_utils_geometry::create_quaternion_from_yaw(0.3 * static_cast<double>(i)));
+  }
+  const auto query_quats = autoware::interpolation::slerp(segments, base_quats);
+  const auto ans_quats = autoware::interpolation::slerp(base_keys, base_quats, query_keys);
+  ASSERT_EQ(query_quats.size(), ans_quats.size());
+  for (size_t i = 0; i < query_quats.size(); ++i) {
+    EXPECT_EQ(query_quats.at(i), ans_quats.at(i));
+  }
+
+  // the size of the values is not the size of the base keys
+  EXPECT_THROW(
+    autoware::interpolation::lerp(segments, std::vector<double>{0.0, 1.0}), std::invalid_argument);
+  const autoware::interpolation::SplineInterpolation short_spline({0.0, 1.0, 2.0}, {0.0, 1.0, 0.0});
+  EXPECT_THROW(short_spline.getSplineInterpolatedValues(segments), std::invalid_argument);
+}
@@ -19,6 +19,7 @@
 #include <gtest/gtest.h>
 
 #include <limits>
+#include <stdexcept>
 #include <vector>
 
 constexpr double epsilon = 1e-6;
@@ -278,3 +279,58 @@ TEST(spline_interpolation, SplineInterpolation)
     }
   }
 }
+
+TEST(spline_interpolation, SplineInterpolationRefit)
+{
+  const std::vector<double> base_keys{-1.5, 1.0, 5.0, 10.0, 15.0, 20.0};
+  const std::vector<double> base_values{-1.2, 0.5, 1.0, 1.2, 2.0, 1.0};
+  const std::vector<double> query_keys{0.0, 8.0, 12.0, 18.0};
+
+  // re-fitting with more, fewer and the same number of points
+  SplineInterpolation s;
+  s.reserve(base_keys.size());
+  s.calcSplineCoefficients({0.0, 1.0}, {0.0, 1.0});
+  s.calcSplineCoefficients(
+    {-2.0, 0.0, 3.0, 4.0, 8.0, 10.0, 20.0}, {1.0, 0.0, 0.5, 3.0, 2.0, 0.0, 1.0});
+  s.calcSplineCoefficients(base_keys, base_values);
+
+  const SplineInterpolation ans(base_keys, base_values);
+  EXPECT_EQ(s.getSize(), base_keys.size());
+  EXPECT_EQ(s.getSplineInterpolatedValues(query_keys), ans.getSplineInterpolatedValues(query_keys));
+  EXPECT_EQ(
+    s.getSplineInterpolatedDiffValues(query_keys), ans.getSplineInterpolatedDiffValues(query_keys));
+  EXPECT_EQ(
+    s.getSplineInterpolatedQuadDiffValues(query_keys),
+    ans.getSplineInterpolatedQuadDiffValues(query_keys));
+
+  // invalid arguments
+  EXPECT_THROW(s.calcSplineCoefficients({0.0}, {0.0}), std::invalid_argument);
+  EXPECT_THROW(s.calcSplineCoefficients({0.0, 1.0}, {0.0, 1.0, 2.0}), std::invalid_argument);
+}
+
+TEST(spline_interpolation, solveTridiagonalMatrixAlgorithm)
+{
+  using autoware::interpolation::solveTridiagonalMatrixAlgorithm;
+
+  // [[2, 1, 0], [1, 3, 1], [0, 1, 4]] * x = [4, 9, 10] is solved by x = [1, 2, 2]
+  const std::vector<double> lower{1.0, 1.0};
+  const std::vector<double> diag{2.0, 3.0, 4.0};
+  const std::vector<double> upper{1.0, 1.0};
+  std::vector<double> rhs{4.0, 9.0, 10.0};
+  std::vector<double> scratch;
+  solveTridiagonalMatrixAlgorithm(lower, diag, upper, rhs, scratch);
+  const std::vector<double> ans{1.0, 2.0, 2.0};
+  for (size_t i = 0; i < ans.size(); ++i) {
+    EXPECT_NEAR(rhs.at(i), ans.at(i), epsilon);
+  }
+
+  // single equation
+  std::vector<double> single_rhs{3.0};
+  solveTridiagonalMatrixAlgorithm({}, {2.0}, {}, single_rhs, scratch);
+  EXPECT_NEAR(single_rhs.front(), 1.5, epsilon);
+
+  // sizes do not match
+  std::vector<double> short_rhs{1.0, 1.0};
+  EXPECT_THROW(
+    solveTridiagonalMatrixAlgorithm(lower, diag, upper, short_rhs, scratch), std::invalid_argument);
+}
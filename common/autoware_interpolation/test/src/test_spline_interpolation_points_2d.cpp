@@ -222,3 +222,32 @@ TEST(spline_interpolation, SplineInterpolationPoints2dPolymorphism)
   SplineInterpolationPoints2d s_traj_point(trajectory_points);
   s_traj_point.getSplineInterpolatedPoint(0, 0.);
 }
+
+TEST(spline_interpolation, SplineInterpolationPoints2dRefit)
+{
+  using autoware_utils_geometry::create_point;
+
+  std::vector<geometry_msgs::msg::Point> points;
+  points.push_back(create_point(-2.0, -10.0, 0.0));
+  points.push_back(create_point(2.0, 1.5, 0.0));
+  points.push_back(create_point(3.0, 3.0, 0.0));
+  points.push_back(create_point(5.0, 10.0, 0.0));
+  points.push_back(create_point(10.0, 12.5, 0.0));
+
+  std::vector<geometry_msgs::msg::Point> other_points;
+  other_points.push_back(create_point(0.0, 0.0, 0.0));
+  other_points.push_back(create_point(1.0, 1.0, 0.0));
+  other_points.push_back(create_point(1.0, 1.0, 0.0));
+
+  SplineInterpolationPoints2d s(other_points);
+  EXPECT_EQ(s.getSize(), 2U);
+  s.calcSplineCoefficients(points);
+
+  const SplineInterpolationPoints2d ans(points);
+  ASSERT_EQ(s.getSize(), ans.getSize());
+  EXPECT_EQ(s.getSplineInterpolatedYaws(), ans.getSplineInterpolatedYaws());
+  EXPECT_EQ(s.getSplineInterpolatedCurvatures(), ans.getSplineInterpolatedCurvatures());
+  for (size_t i = 0; i < s.getSize(); ++i) {
+    EXPECT_DOUBLE_EQ(s.getAccumulatedLength(i), ans.getAccumulatedLength(i));
+  }
+}
@@ -0,0 +1,346 @@
+// Copyright 2025 The Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__KALMAN_FILTER__FIXED_TIME_DELAY_KALMAN_FILTER_HPP_
+#define AUTOWARE__KALMAN_FILTER__FIXED_TIME_DELAY_KALMAN_FILTER_HPP_
+
+#include <Eigen/Core>
+#include <Eigen/LU>
+
+#include <array>
+#include <iostream>
+
+namespace autoware::kalman_filter
+{
+/**
+ * @file fixed_time_delay_kalman_filter.hpp
+ * @brief kalman filter with delayed measurement, for a state of fixed dimension
+ *
+ * Same filter as TimeDelayKalmanFilter, but
+ * - the state, the process model and the measurement model are fixed size matrices,
+ * - the extended state and covariance are allocated once by init(), and predictWithDelay() and
+ *   updateWithDelay() do no heap allocation,
+ * - the delayed states are a ring of blocks: the prediction overwrites the oldest block with the
+ *   latest state, and only computes the row of blocks of the latest state instead of copying the
+ *   whole covariance,
+ * - only the lower triangle of the symmetric extended covariance is stored and updated, which
+ *   halves the cost of the measurement update, the largest one for many delay steps,
+ * - the measurements of one cycle, possibly at different delay steps, can be stacked into a single
+ *   update of up to MaxBatchDimY rows with addBatchMeasurement() and applyBatchUpdate().
+ */
+template <int DimX, int MaxBatchDimY = 2 * DimX>
+class FixedTimeDelayKalmanFilter
+{
+  static_assert(MaxBatchDimY >= DimX, "the batch must hold a measurement of the state size");
+
+public:
+  using StateVector = Eigen::Matrix<double, DimX, 1>;
+  using StateMatrix = Eigen::Matrix<double, DimX, DimX>;
+
+  /**
+   * @brief initialization of kalman filter
+   * @param x initial state
+   * @param P0 initial covariance of estimated state
+   * @param max_delay_step Maximum number of delay steps, which determines the dimension of the
+   * extended kalman filter
+   */
+  void init(const StateVector & x, const StateMatrix & P0, const int max_delay_step)
+  {
+    max_delay_step_ = max_delay_step;
+    latest_block_ = 0;
+    const int dim_x_ex = DimX * max_delay_step_;
+
+    x_.setZero(dim_x_ex);
+    P_.setZero(dim_x_ex, dim_x_ex);
+    PCT_.setZero(dim_x_ex, MaxBatchDimY);
+    K_.setZero(dim_x_ex, MaxBatchDimY);
+    batch_dim_ = 0;
+    batch_measurement_num_ = 0;
+
+    for (int i = 0; i < max_delay_step_; ++i) {
+      x_.template segment<DimX>(i * DimX) = x;
+      P_.template block<DimX, DimX>(i * DimX, i * DimX) = P0;
+    }
+  }
+
+  /**
+   * @brief get latest time estimated state
+   */
+  StateVector getLatestX() const { return x_.template segment<DimX>(get_offset(0)); }
+
+  /**
+   * @brief get latest time estimation covariance
+   */
+  StateMatrix getLatestP() const
+  {
+    const int offset = get_offset(0);
+    return get_P_block(offset, offset);
+  }
+
+  /**
+   * @brief get element of the extended state, in the order of TimeDelayKalmanFilter
+   * @param i index of the element, delay_step * DimX + index in the state
+   */
+  double getXelement(const unsigned int i) const
+  {
+    return x_(get_offset(static_cast<int>(i) / DimX) + static_cast<int>(i) % DimX);
+  }
+
+  /**
+   * @brief calculate kalman filter covariance by precision model with time delay. This is mainly
+   * for EKF of nonlinear process model.
+   * @param x_next predicted state by prediction model
+   * @param A coefficient matrix of x for process model
+   * @param Q covariance matrix for process model
+   * @return bool to check matrix operations are being performed properly
+   */
+  bool predictWithDelay(const StateVector & x_next, const StateMatrix & A, const StateMatrix & Q)
+  {
+    /*
+     * Same time delay model as TimeDelayKalmanFilter::predictWithDelay(),
+     *
+     *     [A*P11*A'*+Q  A*P11  A*P12]
+     * P = [     P11*A'    P11    P12]
+     *     [     P21*A'    P21    P22]
+     *
+     * where the blocks Pij keep their place in P_, and the blocks of the oldest state are replaced
+     * by the first row and column (the column is the transpose of the row).
+     */
+    const int prev_offset = get_offset(0);
+    latest_block_ = (latest_block_ + max_delay_step_ - 1) % max_delay_step_;
+    const int offset = get_offset(0);
+
+    x_.template segment<DimX>(offset) = x_next;
+
+    for (int i = 1; i < max_delay_step_; ++i) {
+      const int col = get_offset(i);
+      set_P_block(offset, col, A * get_P_block(prev_offset, col));
+    }
+    set_P_block(
+      offset, offset, A * get_P_block(prev_offset, prev_offset) * A.transpose() + Q);
+
+    return true;
+  }
+
+  /**
+   * @brief calculate kalman filter covariance by measurement model with time delay. This is mainly
+   * for EKF of nonlinear process model.
+   * @param y measured values
+   * @param C coefficient matrix of x for measurement model
+   * @param R covariance matrix for measurement model
+   * @param delay_step measurement delay
+   * @return bool to check matrix operations are being performed properly
+   */
+  template <int DimY>
+  bool updateWithDelay(
+    const Eigen::Matrix<double, DimY, 1> & y, const Eigen::Matrix<double, DimY, DimX> & C,
+    const Eigen::Matrix<double, DimY, DimY> & R, const int delay_step)
+  {
+    static_assert(DimY <= DimX, "the measurement must not be larger than the state");
+
+    if (delay_step >= max_delay_step_) {
+      std::cerr << "delay step is larger than max_delay_step. ignore update." << std::endl;
+      return false;
+    }
+
+    // Only the columns of the delayed state are non zero in the extended measurement matrix, and
+    // P * C' is read from the row of blocks left of the diagonal and the column of blocks below it
+    const int offset = get_offset(delay_step);
+    const int below = static_cast<int>(P_.rows()) - offset - DimX;
+    auto PCT = PCT_.template leftCols<DimY>();
+    auto K = K_.template leftCols<DimY>();
+    PCT.topRows(offset).noalias() =
+      P_.template middleRows<DimX>(offset).leftCols(offset).transpose() * C.transpose();
+    PCT.template middleRows<DimX>(offset).noalias() =
+      get_P_block(offset, offset) * C.transpose();
+    PCT.bottomRows(below).noalias() =
+      P_.template middleCols<DimX>(offset).bottomRows(below) * C.transpose();
+    const Eigen::Matrix<double, DimY, DimY> S =
+      R + C * PCT.template middleRows<DimX>(offset);
+    K.noalias() = PCT * S.inverse();
+
+    if (K.array().isNaN().any() || K.array().isInf().any()) {
+      return false;
+    }
+
+    const Eigen::Matrix<double, DimY, 1> y_pred = C * x_.template segment<DimX>(offset);
+    x_.noalias() += K * (y - y_pred);
+    P_.template triangularView<Eigen::Lower>() -= K * PCT.transpose();
+    return true;
+  }
+
+  /**
+   * @brief stack a measurement into the batch update of the cycle
+   * @details the stacked update is the same as the updates of the measurements one after the
+   * other, with a single inversion of the innovation covariance. The batch is applied first when
+   * the measurement does not fit in it. The state must not be predicted before the batch is
+   * applied.
+   * @param y measured values
+   * @param C coefficient matrix of x for measurement model
+   * @param R covariance matrix for measurement model, uncorrelated with the other measurements
+   * @param delay_step measurement delay
+   * @return false if the delay step is too large or if the batch applied first failed
+   */
+  template <int DimY>
+  bool addBatchMeasurement(
+    const Eigen::Matrix<double, DimY, 1> & y, const Eigen::Matrix<double, DimY, DimX> & C,
+    const Eigen::Matrix<double, DimY, DimY> & R, const int delay_step)
+  {
+    static_assert(DimY <= MaxBatchDimY, "the measurement must not be larger than the batch");
+
+    if (delay_step >= max_delay_step_) {
+      std::cerr << "delay step is larger than max_delay_step. ignore update." << std::endl;
+      return false;
+    }
+    if (batch_dim_ + DimY > MaxBatchDimY && !applyBatchUpdate()) {
+      return false;
+    }
+
+    auto & measurement = batch_measurements_[batch_measurement_num_++];
+    measurement.row = batch_dim_;
+    measurement.dim = DimY;
+    measurement.offset = get_offset(delay_step);
+    batch_y_.template segment<DimY>(batch_dim_) = y;
+    batch_C_.template middleRows<DimY>(batch_dim_) = C;
+    batch_R_.template middleRows<DimY>(batch_dim_).setZero();
+    batch_R_.template block<DimY, DimY>(batch_dim_, batch_dim_) = R;
+    batch_dim_ += DimY;
+    return true;
+  }
+
+  /**
+   * @brief apply the measurements stacked since the last batch update
+   * @return false if the kalman gain is not finite, in which case the batch is dropped
+   */
+  bool applyBatchUpdate()
+  {
+    const int m = batch_dim_;
+    const int measurement_num = batch_measurement_num_;
+    batch_dim_ = 0;
+    batch_measurement_num_ = 0;
+    if (m == 0) {
+      return true;
+    }
+
+    // P * C' of each measurement, read as in updateWithDelay()
+    auto PCT = PCT_.leftCols(m);
+    for (int i = 0; i < measurement_num; ++i) {
+      const auto & measurement = batch_measurements_[i];
+      const int offset = measurement.offset;
+      const int below = static_cast<int>(P_.rows()) - offset - DimX;
+      const auto CT = batch_C_.middleRows(measurement.row, measurement.dim).transpose();
+      auto PCT_i = PCT.middleCols(measurement.row, measurement.dim);
+      PCT_i.topRows(offset).noalias() =
+        P_.template middleRows<DimX>(offset).leftCols(offset).transpose() * CT;
+      PCT_i.template middleRows<DimX>(offset).noalias() = get_P_block(offset, offset) * CT;
+      PCT_i.bottomRows(below).noalias() =
+        P_.template middleCols<DimX>(offset).bottomRows(below) * CT;
+    }
+
+    // the rows of each measurement in the innovation and its covariance S = R + C * P * C'
+    BatchMatrix S(m, m);
+    BatchVector innovation(m);
+    for (int i = 0; i < measurement_num; ++i) {
+      const auto & measurement = batch_measurements_[i];
+      const auto C = batch_C_.middleRows(measurement.row, measurement.dim);
+      S.middleRows(measurement.row, measurement.dim).noalias() =
+        batch_R_.middleRows(measurement.row, measurement.dim).leftCols(m) +
+        C * PCT.template middleRows<DimX>(measurement.offset);
+      innovation.segment(measurement.row, measurement.dim).noalias() =
+        batch_y_.segment(measurement.row, measurement.dim) -
+        C * x_.template segment<DimX>(measurement.offset);
+    }
+    auto K = K_.leftCols(m);
+    K.noalias() = PCT * S.inverse();
+
+    if (K.array().isNaN().any() || K.array().isInf().any()) {
+      return false;
+    }
+
+    x_.noalias() += K * innovation;
+    P_.template triangularView<Eigen::Lower>() -= K * PCT.transpose();
+    return true;
+  }
+
+  /**
+   * @brief number of rows stacked in the batch update
+   */
+  int getBatchDim() const { return batch_dim_; }
+
+private:
+  using BatchVector = Eigen::Matrix<double, Eigen::Dynamic, 1, 0, MaxBatchDimY, 1>;
+  using BatchMatrix =
+    Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, 0, MaxBatchDimY, MaxBatchDimY>;
+
+  /**
+   * @brief rows of a measurement in the batch, and the first row of its state in x_
+   */
+  struct BatchMeasurement
+  {
+    int row{0};
+    int dim{0};
+    int offset{0};
+  };
+
+  Eigen::VectorXd x_;    //!< @brief extended state, a ring of max_delay_step_ states
+  Eigen::MatrixXd P_;    //!< @brief covariance of the extended state, in its lower triangle
+  Eigen::MatrixXd PCT_;  //!< @brief workspace of P * C' in the update
+  Eigen::MatrixXd K_;    //!< @brief workspace of the kalman gain in the update
+
+  int max_delay_step_{0};  //!< @brief maximum number of delay steps
+  int latest_block_{0};    //!< @brief block of the latest state in the extended state
+
+  Eigen::Matrix<double, MaxBatchDimY, 1> batch_y_;
+  Eigen::Matrix<double, MaxBatchDimY, DimX> batch_C_;
+  Eigen::Matrix<double, MaxBatchDimY, MaxBatchDimY> batch_R_;
+  std::array<BatchMeasurement, MaxBatchDimY> batch_measurements_{};
+  int batch_dim_{0};              //!< @brief number of rows stacked in the batch
+  int batch_measurement_num_{0};  //!< @brief number of measurements stacked in the batch
+
+  /**
+   * @brief first row of the state of delay_step in the extended state
+   */
+  int get_offset(const int delay_step) const
+  {
+    return ((latest_block_ + delay_step) % max_delay_step_) * DimX;
+  }
+
+  /**
+   * @brief block of the covariance at the rows and the columns of two states
+   */
+  StateMatrix get_P_block(const int row, const int col) const
+  {
+    if (row > col) {
+      return P_.template block<DimX, DimX>(row, col);
+    }
+    if (row < col) {
+      return P_.template block<DimX, DimX>(col, row).transpose();
+    }
+    return P_.template block<DimX, DimX>(row, row).template selfadjointView<Eigen::Lower>();
+  }
+
+  /**
+   * @brief set the block of the covariance at the rows and the columns of two states
+   */
+  void set_P_block(const int row, const int col, const StateMatrix & block)
+  {
+    if (row >= col) {
+      P_.template block<DimX, DimX>(row, col) = block;
+    } else {
+      P_.template block<DimX, DimX>(col, row) = block.transpose();
+    }
+  }
+};
+}  // namespace autoware::kalman_filter
+#endif  // AUTOWARE__KALMAN_FILTER__FIXED_TIME_DELAY_KALMAN_FILTER_HPP_
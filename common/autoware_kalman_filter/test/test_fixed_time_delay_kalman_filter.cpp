@@ -0,0 +1,188 @@
+// Copyright 2025 The Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/kalman_filter/fixed_time_delay_kalman_filter.hpp"
+#include "autoware/kalman_filter/time_delay_kalman_filter.hpp"
+
+#include <gtest/gtest.h>
+
+using autoware::kalman_filter::FixedTimeDelayKalmanFilter;
+using autoware::kalman_filter::TimeDelayKalmanFilter;
+
+namespace
+{
+constexpr int dim_x = 3;
+using FixedFilter = FixedTimeDelayKalmanFilter<dim_x>;
+
+void expect_same_latest(const FixedFilter & fixed_kf, const TimeDelayKalmanFilter & td_kf)
+{
+  const Eigen::MatrixXd x = td_kf.getLatestX();
+  const Eigen::MatrixXd P = td_kf.getLatestP();
+  EXPECT_TRUE(fixed_kf.getLatestX().isApprox(x, 1e-9));
+  EXPECT_TRUE(fixed_kf.getLatestP().isApprox(P, 1e-9));
+}
+
+void expect_same_elements(
+  const FixedFilter & fixed_kf, const TimeDelayKalmanFilter & td_kf, const int max_delay_step)
+{
+  for (int i = 0; i < dim_x * max_delay_step; ++i) {
+    EXPECT_NEAR(fixed_kf.getXelement(i), td_kf.getXelement(i), 1e-9);
+  }
+}
+}  // namespace
+
+TEST(fixed_time_delay_kalman_filter, same_as_time_delay_kalman_filter)
+{
+  FixedFilter::StateVector x;
+  x << 1.0, 2.0, 3.0;
+  FixedFilter::StateMatrix P;
+  P << 0.1, 0.01, 0.0, 0.01, 0.2, 0.0, 0.0, 0.0, 0.3;
+  const int max_delay_step = 5;
+
+  FixedFilter fixed_kf;
+  TimeDelayKalmanFilter td_kf;
+  fixed_kf.init(x, P, max_delay_step);
+  td_kf.init(x, P, max_delay_step);
+  expect_same_latest(fixed_kf, td_kf);
+
+  FixedFilter::StateMatrix A;
+  A << 1.0, 0.1, 0.0, 0.0, 1.0, 0.1, 0.0, 0.0, 1.0;
+  FixedFilter::StateMatrix Q = FixedFilter::StateMatrix::Identity() * 0.01;
+  Eigen::Matrix<double, 2, dim_x> C;
+  C << 1.0, 0.0, 0.0, 0.0, 0.0, 1.0;
+  Eigen::Matrix2d R;
+  R << 0.001, 0.0, 0.0, 0.002;
+
+  // more steps than max_delay_step, so that the ring of the states wraps around
+  for (int step = 0; step < 3 * max_delay_step; ++step) {
+    const FixedFilter::StateVector x_next = A * fixed_kf.getLatestX();
+    EXPECT_TRUE(fixed_kf.predictWithDelay(x_next, A, Q));
+    EXPECT_TRUE(td_kf.predictWithDelay(x_next, A, Q));
+    expect_same_latest(fixed_kf, td_kf);
+    expect_same_elements(fixed_kf, td_kf, max_delay_step);
+
+    const int delay_step = step % max_delay_step;
+    const Eigen::Vector2d y(1.0 + 0.1 * step, 3.0 - 0.05 * step);
+    EXPECT_TRUE(fixed_kf.updateWithDelay(y, C, R, delay_step));
+    EXPECT_TRUE(td_kf.updateWithDelay(y, C, R, delay_step));
+    expect_same_latest(fixed_kf, td_kf);
+    expect_same_elements(fixed_kf, td_kf, max_delay_step);
+  }
+}
+
+TEST(fixed_time_delay_kalman_filter, single_delay_step)
+{
+  FixedFilter::StateVector x;
+  x << 1.0, 2.0, 3.0;
+  const FixedFilter::StateMatrix P = FixedFilter::StateMatrix::Identity() * 0.1;
+  const FixedFilter::StateMatrix A = FixedFilter::StateMatrix::Identity() * 2.0;
+  const FixedFilter::StateMatrix Q = FixedFilter::StateMatrix::Identity() * 0.01;
+
+  FixedFilter fixed_kf;
+  TimeDelayKalmanFilter td_kf;
+  fixed_kf.init(x, P, 1);
+  td_kf.init(x, P, 1);
+  EXPECT_TRUE(fixed_kf.predictWithDelay(A * x, A, Q));
+  EXPECT_TRUE(td_kf.predictWithDelay(A * x, A, Q));
+  expect_same_latest(fixed_kf, td_kf);
+}
+
+TEST(fixed_time_delay_kalman_filter, reject_too_large_delay_step)
+{
+  FixedFilter fixed_kf;
+  fixed_kf.init(FixedFilter::StateVector::Zero(), FixedFilter::StateMatrix::Identity(), 5);
+
+  const Eigen::Matrix<double, dim_x, dim_x> C = Eigen::Matrix3d::Identity();
+  const Eigen::Matrix3d R = Eigen::Matrix3d::Identity();
+  const Eigen::Vector3d y(1.0, 2.0, 3.0);
+  EXPECT_FALSE(fixed_kf.updateWithDelay(y, C, R, 5));
+  EXPECT_TRUE(fixed_kf.getLatestX().isZero());
+}
+
+TEST(fixed_time_delay_kalman_filter, batch_update_same_as_sequential_updates)
+{
+  FixedFilter::StateVector x;
+  x << 1.0, 2.0, 3.0;
+  FixedFilter::StateMatrix P;
+  P << 0.1, 0.01, 0.0, 0.01, 0.2, 0.0, 0.0, 0.0, 0.3;
+  const int max_delay_step = 5;
+
+  // a batch of 2 * dim_x rows, so that the third measurement below applies the first two
+  FixedFilter sequential_kf;
+  FixedFilter batch_kf;
+  sequential_kf.init(x, P, max_delay_step);
+  batch_kf.init(x, P, max_delay_step);
+
+  FixedFilter::StateMatrix A;
+  A << 1.0, 0.1, 0.0, 0.0, 1.0, 0.1, 0.0, 0.0, 1.0;
+  const FixedFilter::StateMatrix Q = FixedFilter::StateMatrix::Identity() * 0.01;
+  Eigen::Matrix<double, 2, dim_x> C_pose;
+  C_pose << 1.0, 0.0, 0.0, 0.0, 1.0, 0.0;
+  const Eigen::Matrix2d R_pose = Eigen::Vector2d(0.001, 0.002).asDiagonal();
+  Eigen::Matrix<double, 1, dim_x> C_twist;
+  C_twist << 0.0, 0.0, 1.0;
+  const Eigen::Matrix<double, 1, 1> R_twist = Eigen::Matrix<double, 1, 1>::Constant(0.003);
+
+  for (int step = 0; step < 2 * max_delay_step; ++step) {
+    const FixedFilter::StateVector x_next = A * sequential_kf.getLatestX();
+    EXPECT_TRUE(sequential_kf.predictWithDelay(x_next, A, Q));
+    EXPECT_TRUE(batch_kf.predictWithDelay(x_next, A, Q));
+
+    // measurements at different delay steps, with a pose and two twists in the cycle
+    const Eigen::Vector2d y_pose(1.0 + 0.1 * step, 2.0 - 0.05 * step);
+    const Eigen::Matrix<double, 1, 1> y_twist_1(0.5);
+    const Eigen::Matrix<double, 1, 1> y_twist_2(0.6);
+    const int pose_delay_step = step % max_delay_step;
+    EXPECT_TRUE(sequential_kf.updateWithDelay(y_pose, C_pose, R_pose, pose_delay_step));
+    EXPECT_TRUE(sequential_kf.updateWithDelay(y_twist_1, C_twist, R_twist, 1));
+    EXPECT_TRUE(sequential_kf.updateWithDelay(y_twist_2, C_twist, R_twist, 0));
+    EXPECT_TRUE(batch_kf.addBatchMeasurement(y_pose, C_pose, R_pose, pose_delay_step));
+    EXPECT_TRUE(batch_kf.addBatchMeasurement(y_twist_1, C_twist, R_twist, 1));
+    EXPECT_TRUE(batch_kf.addBatchMeasurement(y_twist_2, C_twist, R_twist, 0));
+    EXPECT_EQ(batch_kf.getBatchDim(), 4);
+    EXPECT_TRUE(batch_kf.applyBatchUpdate());
+    EXPECT_EQ(batch_kf.getBatchDim(), 0);
+
+    EXPECT_TRUE(batch_kf.getLatestX().isApprox(sequential_kf.getLatestX(), 1e-9));
+    EXPECT_TRUE(batch_kf.getLatestP().isApprox(sequential_kf.getLatestP(), 1e-9));
+    for (int i = 0; i < dim_x * max_delay_step; ++i) {
+      EXPECT_NEAR(batch_kf.getXelement(i), sequential_kf.getXelement(i), 1e-9);
+    }
+  }
+}
+
+TEST(fixed_time_delay_kalman_filter, batch_update_overflow)
+{
+  FixedFilter sequential_kf;
+  FixedFilter batch_kf;
+  const FixedFilter::StateMatrix P = FixedFilter::StateMatrix::Identity() * 0.1;
+  sequential_kf.init(FixedFilter::StateVector::Zero(), P, 5);
+  batch_kf.init(FixedFilter::StateVector::Zero(), P, 5);
+
+  // three full state measurements do not fit in a batch of 2 * dim_x rows
+  const Eigen::Matrix3d C = Eigen::Matrix3d::Identity();
+  const Eigen::Matrix3d R = Eigen::Matrix3d::Identity() * 0.01;
+  for (int i = 0; i < 3; ++i) {
+    const Eigen::Vector3d y = Eigen::Vector3d::Constant(1.0 + i);
+    EXPECT_TRUE(sequential_kf.updateWithDelay(y, C, R, i));
+    EXPECT_TRUE(batch_kf.addBatchMeasurement(y, C, R, i));
+  }
+  EXPECT_EQ(batch_kf.getBatchDim(), dim_x);
+  EXPECT_TRUE(batch_kf.applyBatchUpdate());
+  EXPECT_TRUE(batch_kf.getLatestX().isApprox(sequential_kf.getLatestX(), 1e-9));
+  EXPECT_TRUE(batch_kf.getLatestP().isApprox(sequential_kf.getLatestP(), 1e-9));
+
+  EXPECT_FALSE(batch_kf.addBatchMeasurement(Eigen::Vector3d::Zero().eval(), C, R, 5));
+  EXPECT_TRUE(batch_kf.applyBatchUpdate());
+}
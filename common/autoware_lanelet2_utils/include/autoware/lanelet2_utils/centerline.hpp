@@ -0,0 +1,56 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__LANELET2_UTILS__CENTERLINE_HPP_
+#define AUTOWARE__LANELET2_UTILS__CENTERLINE_HPP_
+
+#include <lanelet2_core/LaneletMap.h>
+
+#include <cstddef>
+
+namespace autoware::experimental::lanelet2_utils
+{
+
+/**
+ * @brief overwrite the centerlines of the lanelets of the map like
+ * lanelet::utils::overwriteLaneletsCenterline.
+ * @param [in] lanelet_map map whose lanelets are modified.
+ * @param [in] resolution maximum interval of the points of the centerlines.
+ * @param [in] force_overwrite if false, the lanelets with a custom centerline are kept.
+ * @param [in] thread_num number of threads computing the centerlines, 0 uses the hardware threads.
+ * @note the centerlines are computed in parallel, and set on the lanelets in the order of the
+ * lanelet layer, so that the IDs of the new points and linestrings are the same as the ones of
+ * the sequential function.
+ */
+void overwrite_lanelets_centerline(
+  const lanelet::LaneletMapPtr & lanelet_map, const double resolution, const bool force_overwrite,
+  const size_t thread_num = 0);
+
+/**
+ * @brief overwrite the centerlines of the lanelets of the map like
+ * lanelet::utils::overwriteLaneletsCenterlineWithWaypoints, where the custom centerline is kept
+ * as the `waypoints` attribute unless force_overwrite.
+ * @param [in] lanelet_map map whose lanelets are modified.
+ * @param [in] resolution maximum interval of the points of the centerlines.
+ * @param [in] force_overwrite if true, the custom centerlines are not kept as `waypoints`.
+ * @param [in] thread_num number of threads computing the centerlines, 0 uses the hardware threads.
+ * @note see overwrite_lanelets_centerline for the IDs.
+ */
+void overwrite_lanelets_centerline_with_waypoints(
+  const lanelet::LaneletMapPtr & lanelet_map, const double resolution, const bool force_overwrite,
+  const size_t thread_num = 0);
+
+}  // namespace autoware::experimental::lanelet2_utils
+
+#endif  // AUTOWARE__LANELET2_UTILS__CENTERLINE_HPP_
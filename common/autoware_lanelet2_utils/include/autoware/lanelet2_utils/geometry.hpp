@@ -20,7 +20,11 @@
 #include <lanelet2_core/Forward.h>
 #include <lanelet2_core/geometry/LineString.h>
 
+#include <cstddef>
+#include <mutex>
 #include <optional>
+#include <unordered_map>
+#include <vector>
 
 namespace autoware::experimental::lanelet2_utils
 {
@@ -100,6 +104,68 @@ std::optional<lanelet::LineString3d> get_linestring_from_arc_length(
 std::optional<geometry_msgs::msg::Pose> get_pose_from_2d_arc_length(
   const lanelet::ConstLanelets & lanelet_sequence, const double s);
 
+/**
+ * @brief points of the centerline of a lanelet as coordinate arrays, with the cumulative 2D and
+ * 3D arc lengths at each point.
+ */
+struct CenterlineArcLength
+{
+  std::vector<double> x;
+  std::vector<double> y;
+  std::vector<double> z;
+  std::vector<double> arc_lengths_2d;  //!< 2D arc length from the first point
+  std::vector<double> arc_lengths_3d;  //!< 3D arc length from the first point
+};
+
+/**
+ * @brief compute the coordinate arrays and the cumulative arc lengths of the centerline.
+ * @param[in] lanelet input lanelet.
+ * @return CenterlineArcLength of lanelet.centerline().
+ */
+CenterlineArcLength compute_centerline_arc_length(const lanelet::ConstLanelet & lanelet);
+
+/**
+ * @brief find the first segment whose end is beyond an arc length by a binary search.
+ * @param[in] arc_lengths cumulative arc lengths at the points of a polyline.
+ * @param[in] s arc length from the first point.
+ * @return index of the first point of the segment, or std::nullopt if there is no segment or s is
+ * not less than the total length.
+ */
+std::optional<size_t> find_segment_by_arc_length(
+  const std::vector<double> & arc_lengths, const double s);
+
+/**
+ * @brief CenterlineArcLength of lanelets, computed on the first query of each lanelet.
+ * @note the cache must be discarded when the map is changed, since it is keyed by the lanelet ID.
+ */
+class CenterlineArcLengthCache
+{
+public:
+  /**
+   * @brief get the CenterlineArcLength of the lanelet, which is computed if it is not cached yet.
+   * @note thread-safe, and the returned reference is valid as long as the cache.
+   */
+  const CenterlineArcLength & get(const lanelet::ConstLanelet & lanelet);
+
+private:
+  std::mutex mutex_;
+  std::unordered_map<lanelet::Id, CenterlineArcLength> arc_lengths_;
+  std::unordered_map<lanelet::Id, CenterlineArcLength> inverted_arc_lengths_;
+};
+
+/**
+ * @brief same as above get_pose_from_2d_arc_length, where the arc lengths of the centerlines are
+ * taken from the cache, so that the segment at s is found by a binary search.
+ * @param[in] lanelet_sequence sequence of ConstLanelets whose centerlines define the path.
+ * @param[in] s arc-length distance (from the start of the sequence).
+ * @param[in] cache cache of the arc lengths of the centerlines, which is updated.
+ * @return optional Pose message, returns std::nullopt if the sequence is empty or if s is outside
+ * the total path length.
+ */
+std::optional<geometry_msgs::msg::Pose> get_pose_from_2d_arc_length(
+  const lanelet::ConstLanelets & lanelet_sequence, const double s,
+  CenterlineArcLengthCache & cache);
+
 }  // namespace autoware::experimental::lanelet2_utils
 
 #endif  // AUTOWARE__LANELET2_UTILS__GEOMETRY_HPP_
@@ -17,6 +17,9 @@
 
 #include <lanelet2_core/Forward.h>
 
+#include <cstdint>
+#include <vector>
+
 namespace autoware::experimental::lanelet2_utils
 {
 static constexpr const char * k_road_lane_type = "road";
@@ -58,5 +61,66 @@ bool is_shoulder_lane(const lanelet::ConstLanelet & lanelet);
  * @return if the lanelet is bicycle_lane or not
  */
 bool is_bicycle_lane(const lanelet::ConstLanelet & lanelet);
+
+/**
+ * @brief bits of the subtype and the "turn_direction" attribute of a lanelet
+ */
+enum LaneletKind : uint8_t {
+  RoadLane = 1U << 0U,
+  ShoulderLane = 1U << 1U,
+  BicycleLane = 1U << 2U,
+  IntersectionLane = 1U << 3U,  //!< has "turn_direction" attribute
+  StraightDirection = 1U << 4U,
+  LeftDirection = 1U << 5U,
+  RightDirection = 1U << 6U,
+};
+
+/**
+ * @brief classify the subtype and the "turn_direction" attribute of the given lanelet
+ * @param [in] lanelet input lanelet
+ * @return the LaneletKind bits of the lanelet
+ */
+uint8_t classify_lanelet_kind(const lanelet::ConstLanelet & lanelet);
+
+/**
+ * @brief LaneletKind bits of all the lanelets of a map, classified once so that the checks of the
+ * kind of a lanelet compare no attribute string
+ * @note the lanelets are looked up by their ID, and the ones which are not in the map are
+ * classified on each call
+ */
+class LaneletKindTable
+{
+public:
+  LaneletKindTable() = default;
+  explicit LaneletKindTable(const lanelet::LaneletMapConstPtr & lanelet_map);
+
+  /**
+   * @brief get the LaneletKind bits of the given lanelet
+   * @param [in] lanelet input lanelet
+   * @return the LaneletKind bits of the lanelet
+   */
+  [[nodiscard]] uint8_t kind(const lanelet::ConstLanelet & lanelet) const;
+
+  [[nodiscard]] bool is_road_lane(const lanelet::ConstLanelet & lanelet) const
+  {
+    return (kind(lanelet) & RoadLane) != 0U;
+  }
+  [[nodiscard]] bool is_shoulder_lane(const lanelet::ConstLanelet & lanelet) const
+  {
+    return (kind(lanelet) & ShoulderLane) != 0U;
+  }
+  [[nodiscard]] bool is_bicycle_lane(const lanelet::ConstLanelet & lanelet) const
+  {
+    return (kind(lanelet) & BicycleLane) != 0U;
+  }
+  [[nodiscard]] bool is_intersection_lanelet(const lanelet::ConstLanelet & lanelet) const
+  {
+    return (kind(lanelet) & IntersectionLane) != 0U;
+  }
+
+private:
+  std::vector<lanelet::Id> ids_;  //!< sorted IDs of the lanelets of the map
+  std::vector<uint8_t> kinds_;    //!< LaneletKind bits of the lanelets of ids_
+};
 }  // namespace autoware::experimental::lanelet2_utils
 #endif  // AUTOWARE__LANELET2_UTILS__KIND_HPP_
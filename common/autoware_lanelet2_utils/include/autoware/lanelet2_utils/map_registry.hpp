@@ -0,0 +1,70 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__LANELET2_UTILS__MAP_REGISTRY_HPP_
+#define AUTOWARE__LANELET2_UTILS__MAP_REGISTRY_HPP_
+
+#include <autoware/lanelet2_utils/kind.hpp>
+
+#include <autoware_map_msgs/msg/lanelet_map_bin.hpp>
+
+#include <lanelet2_core/Forward.h>
+#include <lanelet2_routing/Forward.h>
+#include <lanelet2_traffic_rules/TrafficRules.h>
+
+#include <memory>
+
+namespace autoware::experimental::lanelet2_utils
+{
+
+/**
+ * @brief lanelet map deserialized from a LaneletMapBin message, with the vehicle traffic rules and
+ * routing graph of lanelet::utils::conversion::fromBinMsg
+ */
+struct SharedLaneletMap
+{
+  lanelet::LaneletMapPtr lanelet_map;
+  lanelet::traffic_rules::TrafficRulesPtr traffic_rules;
+  lanelet::routing::RoutingGraphPtr routing_graph;
+};
+
+/**
+ * @brief deserialize the map message once for all the components of the process
+ * @details the components which receive the same message, compared by its header, name, version
+ * and data, share the same map while one of them holds it. The centerlines, cached by the lanelets
+ * on their first use, are computed before the map is shared. If the data of the message is the
+ * handle of a SharedMemoryRegion, the map is deserialized from the region.
+ * @throw std::runtime_error if the region of the handle is not found on the host
+ * @note the shared map must not be modified, copy it instead
+ */
+SharedLaneletMap get_shared_lanelet_map(const autoware_map_msgs::msg::LaneletMapBin & msg);
+
+/**
+ * @brief routing graphs of the vehicles and the pedestrians of the shared map of the message
+ * @details the vehicle graph is SharedLaneletMap::routing_graph, and both graphs are built once
+ * for all the components of the process, like the map
+ */
+std::shared_ptr<const lanelet::routing::RoutingGraphContainer> get_shared_overall_graphs(
+  const autoware_map_msgs::msg::LaneletMapBin & msg);
+
+/**
+ * @brief LaneletKindTable of the shared map of the message
+ * @details the lanelets are classified once for all the components of the process, like the map
+ */
+std::shared_ptr<const LaneletKindTable> get_shared_lanelet_kind_table(
+  const autoware_map_msgs::msg::LaneletMapBin & msg);
+
+}  // namespace autoware::experimental::lanelet2_utils
+
+#endif  // AUTOWARE__LANELET2_UTILS__MAP_REGISTRY_HPP_
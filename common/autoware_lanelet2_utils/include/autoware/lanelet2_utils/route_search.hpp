@@ -0,0 +1,66 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__LANELET2_UTILS__ROUTE_SEARCH_HPP_
+#define AUTOWARE__LANELET2_UTILS__ROUTE_SEARCH_HPP_
+
+#include <lanelet2_core/primitives/Lanelet.h>
+#include <lanelet2_routing/Forward.h>
+#include <lanelet2_routing/LaneletPath.h>
+#include <lanelet2_routing/RoutingCost.h>
+#include <lanelet2_traffic_rules/TrafficRules.h>
+
+#include <optional>
+
+namespace autoware::experimental::lanelet2_utils
+{
+/**
+ * @brief lane change cost of the distance routing cost which lanelet2 uses by default, i.e. the
+ * routing cost of ID 0 of the routing graph built by lanelet::utils::conversion::fromBinMsg
+ */
+static constexpr double k_default_lane_change_cost = 10.0;
+
+/**
+ * @brief find the shortest path from `start` to `goal` by A* search, with the same edges as the
+ * shortest path of lanelet2 with lane changes
+ * @details the edges are the following lanelets and the lane changeable left/right lanelets on
+ * the routing graph, and their costs are given by `routing_cost`. The heuristic is the 2D distance
+ * between the middle points of the centerlines. With lanelet::routing::RoutingCostDistance it does
+ * not overestimate the cost to the goal as long as the middle points of lane changeable lanelets
+ * are not farther apart than the lane change cost, as for the neighbors split at the same
+ * positions, so the path is as short as the one of the Dijkstra search while far fewer lanelets
+ * are expanded on a large map.
+ * @param [in] start start lanelet
+ * @param [in] goal goal lanelet
+ * @param [in] routing_graph routing_graph containing `start` and `goal`
+ * @param [in] traffic_rules traffic rules of `routing_graph`
+ * @param [in] routing_cost routing cost of the edges
+ * @return the lanelets from `start` to `goal`, or nullopt if `goal` is not reachable
+ */
+std::optional<lanelet::routing::LaneletPath> find_shortest_path_astar(
+  const lanelet::ConstLanelet & start, const lanelet::ConstLanelet & goal,
+  const lanelet::routing::RoutingGraphConstPtr routing_graph,
+  const lanelet::traffic_rules::TrafficRules & traffic_rules,
+  const lanelet::routing::RoutingCost & routing_cost);
+
+/**
+ * @brief same as above find_shortest_path_astar with the default distance routing cost
+ */
+std::optional<lanelet::routing::LaneletPath> find_shortest_path_astar(
+  const lanelet::ConstLanelet & start, const lanelet::ConstLanelet & goal,
+  const lanelet::routing::RoutingGraphConstPtr routing_graph,
+  const lanelet::traffic_rules::TrafficRules & traffic_rules);
+}  // namespace autoware::experimental::lanelet2_utils
+
+#endif  // AUTOWARE__LANELET2_UTILS__ROUTE_SEARCH_HPP_
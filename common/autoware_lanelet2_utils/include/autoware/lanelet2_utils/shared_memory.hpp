@@ -0,0 +1,78 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__LANELET2_UTILS__SHARED_MEMORY_HPP_
+#define AUTOWARE__LANELET2_UTILS__SHARED_MEMORY_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace autoware::experimental::lanelet2_utils
+{
+/**
+ * @brief read-only POSIX shared memory region holding the data of a large message, such as the
+ * lanelet map or the pointcloud map, which is sent as a small handle to the processes of the host
+ * @details the handle is the magic bytes, the data size and the region name, and replaces the data
+ * of the message, so that the transient local publication does not copy the data to each late
+ * subscriber. The region created by the publisher is removed when it is destroyed, while the
+ * regions opened by the subscribers remain readable until they are destroyed too.
+ */
+class SharedMemoryRegion
+{
+public:
+  /**
+   * @brief create the region of `name`, which starts with '/' and has no other '/', with a copy of
+   * the data
+   * @throw std::runtime_error if the region cannot be created
+   */
+  static std::unique_ptr<SharedMemoryRegion> create(
+    const std::string & name, const uint8_t * data, const size_t size);
+
+  /**
+   * @brief open the region of the handle read-only
+   * @return nullptr if `handle` is not a handle or the region is not found on the host
+   */
+  static std::unique_ptr<SharedMemoryRegion> open(const std::vector<uint8_t> & handle);
+
+  /**
+   * @brief check if the message data is a handle instead of the data itself
+   */
+  static bool is_handle(const std::vector<uint8_t> & data);
+
+  SharedMemoryRegion(const SharedMemoryRegion &) = delete;
+  SharedMemoryRegion & operator=(const SharedMemoryRegion &) = delete;
+  ~SharedMemoryRegion();
+
+  [[nodiscard]] std::vector<uint8_t> handle() const;
+  [[nodiscard]] const uint8_t * data() const { return static_cast<const uint8_t *>(address_); }
+  [[nodiscard]] size_t size() const { return size_; }
+
+private:
+  SharedMemoryRegion(std::string name, void * address, const size_t size, const bool is_owner)
+  : name_(std::move(name)), address_(address), size_(size), is_owner_(is_owner)
+  {
+  }
+
+  std::string name_;
+  void * address_;
+  size_t size_;
+  bool is_owner_;
+};
+}  // namespace autoware::experimental::lanelet2_utils
+
+#endif  // AUTOWARE__LANELET2_UTILS__SHARED_MEMORY_HPP_
@@ -0,0 +1,171 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <autoware/lanelet2_utils/centerline.hpp>
+
+#include <lanelet2_core/geometry/LineString.h>
+#include <lanelet2_core/primitives/Lanelet.h>
+#include <lanelet2_core/utility/Utilities.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <iterator>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace autoware::experimental::lanelet2_utils
+{
+
+namespace
+{
+using BasicPoints = std::vector<lanelet::BasicPoint3d>;
+
+/**
+ * @brief same resampling as lanelet::utils::resamplePoints, num_segments + 1 points of the
+ * linestring at the same interval
+ */
+BasicPoints resample_points(const lanelet::ConstLineString3d & linestring, const int num_segments)
+{
+  std::vector<double> accumulated_lengths{0.0};
+  accumulated_lengths.reserve(linestring.size());
+  for (size_t i = 1; i < linestring.size(); ++i) {
+    accumulated_lengths.push_back(
+      accumulated_lengths.back() + lanelet::geometry::distance(linestring[i], linestring[i - 1]));
+  }
+  if (accumulated_lengths.size() < 2) {
+    return {};
+  }
+
+  const auto line_length = lanelet::geometry::length(linestring);
+  const auto n = accumulated_lengths.size();
+  BasicPoints resampled_points;
+  resampled_points.reserve(static_cast<size_t>(num_segments) + 1);
+  for (int i = 0; i <= num_segments; ++i) {
+    const auto target_length = (static_cast<double>(i) / num_segments) * line_length;
+
+    // the first segment ending at or after target_length, or the last segment
+    size_t back = n - 2;
+    if (target_length <= accumulated_lengths.at(n - 2)) {
+      const auto front = std::lower_bound(
+        std::next(accumulated_lengths.begin()), accumulated_lengths.end(), target_length);
+      back = static_cast<size_t>(std::distance(accumulated_lengths.begin(), front)) - 1;
+    }
+    const lanelet::BasicPoint3d back_point = linestring[back];
+    const lanelet::BasicPoint3d front_point = linestring[back + 1];
+    const auto back_length = accumulated_lengths.at(back);
+    const auto segment_length = accumulated_lengths.at(back + 1) - back_length;
+    resampled_points.push_back(
+      back_point + (front_point - back_point) * (target_length - back_length) / segment_length);
+  }
+  return resampled_points;
+}
+
+/**
+ * @brief points of lanelet::utils::generateFineCenterline, without the IDs
+ */
+BasicPoints generate_fine_centerline_points(
+  const lanelet::ConstLanelet & lanelet, const double resolution)
+{
+  const double longer_length = std::max(
+    lanelet::geometry::length(lanelet.leftBound()),
+    lanelet::geometry::length(lanelet.rightBound()));
+  const int num_segments = std::max(static_cast<int>(std::ceil(longer_length / resolution)), 1);
+
+  const auto left_points = resample_points(lanelet.leftBound(), num_segments);
+  const auto right_points = resample_points(lanelet.rightBound(), num_segments);
+  if (left_points.size() != right_points.size()) {
+    return {};
+  }
+
+  BasicPoints centerline_points;
+  centerline_points.reserve(left_points.size());
+  for (size_t i = 0; i < left_points.size(); ++i) {
+    centerline_points.push_back((right_points[i] + left_points[i]) / 2);
+  }
+  return centerline_points;
+}
+
+/**
+ * @brief set the centerlines of the points computed on thread_num threads, in the order of the
+ * lanelets
+ */
+void overwrite_centerlines(
+  std::vector<lanelet::Lanelet> & lanelets, const double resolution, const size_t thread_num)
+{
+  std::vector<BasicPoints> centerline_points(lanelets.size());
+  std::atomic<size_t> next_index{0};
+  const auto compute_next_centerlines = [&]() {
+    for (size_t i = next_index++; i < lanelets.size(); i = next_index++) {
+      centerline_points[i] = generate_fine_centerline_points(lanelets[i], resolution);
+    }
+  };
+
+  // the calling thread is one of the computing threads
+  const size_t hardware_thread_num = std::max(std::thread::hardware_concurrency(), 1U);
+  const size_t used_thread_num =
+    std::min(thread_num == 0 ? hardware_thread_num : thread_num, lanelets.size());
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < used_thread_num; ++i) {
+    threads.emplace_back(compute_next_centerlines);
+  }
+  compute_next_centerlines();
+  for (auto & thread : threads) {
+    thread.join();
+  }
+
+  // the IDs are allocated in the same order as lanelet::utils::generateFineCenterline
+  for (size_t i = 0; i < lanelets.size(); ++i) {
+    lanelet::LineString3d centerline(lanelet::utils::getId());
+    for (const auto & point : centerline_points[i]) {
+      centerline.push_back(
+        lanelet::Point3d(lanelet::utils::getId(), point.x(), point.y(), point.z()));
+    }
+    lanelets[i].setCenterline(centerline);
+  }
+}
+}  // namespace
+
+void overwrite_lanelets_centerline(
+  const lanelet::LaneletMapPtr & lanelet_map, const double resolution, const bool force_overwrite,
+  const size_t thread_num)
+{
+  std::vector<lanelet::Lanelet> lanelets;
+  lanelets.reserve(lanelet_map->laneletLayer.size());
+  for (const auto & lanelet : lanelet_map->laneletLayer) {
+    if (force_overwrite || !lanelet.hasCustomCenterline()) {
+      lanelets.push_back(lanelet);
+    }
+  }
+  overwrite_centerlines(lanelets, resolution, thread_num);
+}
+
+void overwrite_lanelets_centerline_with_waypoints(
+  const lanelet::LaneletMapPtr & lanelet_map, const double resolution, const bool force_overwrite,
+  const size_t thread_num)
+{
+  std::vector<lanelet::Lanelet> lanelets{
+    lanelet_map->laneletLayer.begin(), lanelet_map->laneletLayer.end()};
+  if (!force_overwrite) {
+    for (auto & lanelet : lanelets) {
+      if (lanelet.hasCustomCenterline()) {
+        lanelet.setAttribute("waypoints", lanelet.centerline().id());
+      }
+    }
+  }
+  overwrite_centerlines(lanelets, resolution, thread_num);
+}
+
+}  // namespace autoware::experimental::lanelet2_utils
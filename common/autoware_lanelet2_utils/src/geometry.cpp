@@ -24,7 +24,10 @@
 #include <lanelet2_core/primitives/Point.h>
 
 #include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <iterator>
+#include <mutex>
 #include <vector>
 
 namespace autoware::experimental::lanelet2_utils
@@ -179,40 +182,101 @@ std::optional<lanelet::LineString3d> get_linestring_from_arc_length(
 
 std::optional<geometry_msgs::msg::Pose> get_pose_from_2d_arc_length(
   const lanelet::ConstLanelets & lanelet_sequence, const double s)
+{
+  CenterlineArcLengthCache cache;
+  return get_pose_from_2d_arc_length(lanelet_sequence, s, cache);
+}
+
+CenterlineArcLength compute_centerline_arc_length(const lanelet::ConstLanelet & lanelet)
+{
+  const auto centerline = lanelet.centerline();
+  CenterlineArcLength arc_length;
+  arc_length.x.reserve(centerline.size());
+  arc_length.y.reserve(centerline.size());
+  arc_length.z.reserve(centerline.size());
+  arc_length.arc_lengths_2d.reserve(centerline.size());
+  arc_length.arc_lengths_3d.reserve(centerline.size());
+  for (size_t i = 0; i < centerline.size(); ++i) {
+    const auto & p = centerline[i];
+    arc_length.x.push_back(p.x());
+    arc_length.y.push_back(p.y());
+    arc_length.z.push_back(p.z());
+    if (i == 0) {
+      arc_length.arc_lengths_2d.push_back(0.0);
+      arc_length.arc_lengths_3d.push_back(0.0);
+      continue;
+    }
+    const auto & prev = centerline[i - 1];
+    arc_length.arc_lengths_2d.push_back(
+      arc_length.arc_lengths_2d.back() + std::hypot(p.x() - prev.x(), p.y() - prev.y()));
+    arc_length.arc_lengths_3d.push_back(
+      arc_length.arc_lengths_3d.back() + lanelet::geometry::distance3d(prev, p));
+  }
+  return arc_length;
+}
+
+std::optional<size_t> find_segment_by_arc_length(
+  const std::vector<double> & arc_lengths, const double s)
+{
+  if (arc_lengths.size() < 2 || s >= arc_lengths.back()) {
+    return std::nullopt;
+  }
+  // the first point after s is the end of the segment
+  const auto segment_end = std::upper_bound(arc_lengths.begin() + 1, arc_lengths.end(), s);
+  return static_cast<size_t>(std::distance(arc_lengths.begin(), segment_end)) - 1;
+}
+
+const CenterlineArcLength & CenterlineArcLengthCache::get(const lanelet::ConstLanelet & lanelet)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto & arc_lengths = lanelet.inverted() ? inverted_arc_lengths_ : arc_lengths_;
+  const auto it = arc_lengths.find(lanelet.id());
+  if (it != arc_lengths.end()) {
+    return it->second;
+  }
+  return arc_lengths.emplace(lanelet.id(), compute_centerline_arc_length(lanelet)).first->second;
+}
+
+std::optional<geometry_msgs::msg::Pose> get_pose_from_2d_arc_length(
+  const lanelet::ConstLanelets & lanelet_sequence, const double s,
+  CenterlineArcLengthCache & cache)
 {
   double accumulated_distance2d = 0.0;
 
   for (const auto & llt : lanelet_sequence) {
-    const auto & centerline = llt.centerline();
-    for (auto it = centerline.begin(); std::next(it) != centerline.end(); ++it) {
-      const auto & pt = *it;
-      const auto & next_pt = *std::next(it);
-      const double distance2d = lanelet::geometry::distance3d(pt, next_pt);
-
-      if (accumulated_distance2d + distance2d > s) {
-        double rem = s - accumulated_distance2d;
-        auto const_pt = interpolate_point(pt, next_pt, rem);
-        if (!const_pt.has_value()) {
-          return std::nullopt;
-        }
-        auto P = const_pt.value().basicPoint();
-
-        double half_yaw = std::atan2(next_pt.y() - pt.y(), next_pt.x() - pt.x()) * 0.5;
-
-        geometry_msgs::msg::Pose pose;
-        pose.position.x = P.x();
-        pose.position.y = P.y();
-        pose.position.z = P.z();
-        pose.orientation.x = 0.0;
-        pose.orientation.y = 0.0;
-        pose.orientation.z = std::sin(half_yaw);
-        pose.orientation.w = std::cos(half_yaw);
-
-        return pose;
-      }
-
-      accumulated_distance2d += distance2d;
+    const auto & arc_length = cache.get(llt);
+    const auto & arc_lengths = arc_length.arc_lengths_3d;
+    const auto segment = find_segment_by_arc_length(arc_lengths, s - accumulated_distance2d);
+    if (!segment) {
+      accumulated_distance2d += arc_lengths.empty() ? 0.0 : arc_lengths.back();
+      continue;
     }
+
+    const size_t i = *segment;
+    const lanelet::BasicPoint3d pt{arc_length.x[i], arc_length.y[i], arc_length.z[i]};
+    const lanelet::BasicPoint3d next_pt{
+      arc_length.x[i + 1], arc_length.y[i + 1], arc_length.z[i + 1]};
+    const double distance2d = arc_lengths[i + 1] - arc_lengths[i];
+    const double rem = s - accumulated_distance2d - arc_lengths[i];
+
+    // same as interpolate_point
+    if (distance2d == 0.0 || rem < 0.0 || rem > distance2d) {
+      return std::nullopt;
+    }
+    const lanelet::BasicPoint3d P = pt + (next_pt - pt).normalized() * rem;
+
+    double half_yaw = std::atan2(next_pt.y() - pt.y(), next_pt.x() - pt.x()) * 0.5;
+
+    geometry_msgs::msg::Pose pose;
+    pose.position.x = P.x();
+    pose.position.y = P.y();
+    pose.position.z = P.z();
+    pose.orientation.x = 0.0;
+    pose.orientation.y = 0.0;
+    pose.orientation.z = std::sin(half_yaw);
+    pose.orientation.w = std::cos(half_yaw);
+
+    return pose;
   }
   return std::nullopt;
 }
@@ -12,11 +12,17 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <autoware/lanelet2_utils/intersection.hpp>
 #include <autoware/lanelet2_utils/kind.hpp>
 
+#include <lanelet2_core/LaneletMap.h>
 #include <lanelet2_core/primitives/Lanelet.h>
 
+#include <algorithm>
 #include <cstring>
+#include <iterator>
+#include <vector>
+
 namespace autoware::experimental::lanelet2_utils
 {
 bool is_road_lane(const lanelet::ConstLanelet & lanelet)
@@ -36,4 +42,53 @@ bool is_bicycle_lane(const lanelet::ConstLanelet & lanelet)
   return std::strcmp(
            lanelet.attributeOr(lanelet::AttributeName::Subtype, "none"), k_bicycle_lane_type) == 0;
 }
+
+uint8_t classify_lanelet_kind(const lanelet::ConstLanelet & lanelet)
+{
+  uint8_t kind = 0U;
+  if (is_road_lane(lanelet)) {
+    kind |= RoadLane;
+  } else if (is_shoulder_lane(lanelet)) {
+    kind |= ShoulderLane;
+  } else if (is_bicycle_lane(lanelet)) {
+    kind |= BicycleLane;
+  }
+
+  if (is_intersection_lanelet(lanelet)) {
+    kind |= IntersectionLane;
+    if (is_straight_direction(lanelet)) {
+      kind |= StraightDirection;
+    } else if (is_left_direction(lanelet)) {
+      kind |= LeftDirection;
+    } else if (is_right_direction(lanelet)) {
+      kind |= RightDirection;
+    }
+  }
+  return kind;
+}
+
+LaneletKindTable::LaneletKindTable(const lanelet::LaneletMapConstPtr & lanelet_map)
+{
+  const auto & lanelet_layer = lanelet_map->laneletLayer;
+  std::vector<lanelet::ConstLanelet> lanelets(lanelet_layer.begin(), lanelet_layer.end());
+  std::sort(lanelets.begin(), lanelets.end(), [](const auto & a, const auto & b) {
+    return a.id() < b.id();
+  });
+
+  ids_.reserve(lanelets.size());
+  kinds_.reserve(lanelets.size());
+  for (const auto & lanelet : lanelets) {
+    ids_.push_back(lanelet.id());
+    kinds_.push_back(classify_lanelet_kind(lanelet));
+  }
+}
+
+uint8_t LaneletKindTable::kind(const lanelet::ConstLanelet & lanelet) const
+{
+  const auto it = std::lower_bound(ids_.begin(), ids_.end(), lanelet.id());
+  if (it == ids_.end() || *it != lanelet.id()) {
+    return classify_lanelet_kind(lanelet);
+  }
+  return kinds_[static_cast<size_t>(std::distance(ids_.begin(), it))];
+}
 }  // namespace autoware::experimental::lanelet2_utils
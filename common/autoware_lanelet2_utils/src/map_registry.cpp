@@ -0,0 +1,159 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <autoware/lanelet2_utils/map_registry.hpp>
+#include <autoware/lanelet2_utils/shared_memory.hpp>
+#include <autoware_lanelet2_extension/utility/message_conversion.hpp>
+
+#include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_routing/RoutingGraph.h>
+#include <lanelet2_routing/RoutingGraphContainer.h>
+#include <lanelet2_traffic_rules/TrafficRulesFactory.h>
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace autoware::experimental::lanelet2_utils
+{
+namespace
+{
+using MapKey = std::tuple<int32_t, uint32_t, std::string, std::string, std::string, size_t, size_t>;
+
+MapKey get_map_key(const autoware_map_msgs::msg::LaneletMapBin & msg)
+{
+  const std::string_view data(reinterpret_cast<const char *>(msg.data.data()), msg.data.size());
+  return {
+    msg.header.stamp.sec,  msg.header.stamp.nanosec, msg.header.frame_id,
+    msg.version_map,       msg.name_map,             msg.data.size(),
+    std::hash<std::string_view>{}(data)};
+}
+
+struct MapEntry
+{
+  std::weak_ptr<lanelet::LaneletMap> lanelet_map;
+  std::weak_ptr<lanelet::traffic_rules::TrafficRules> traffic_rules;
+  std::weak_ptr<lanelet::routing::RoutingGraph> routing_graph;
+  std::weak_ptr<const lanelet::routing::RoutingGraphContainer> overall_graphs;
+  std::weak_ptr<const LaneletKindTable> lanelet_kind_table;
+};
+
+std::mutex registry_mutex;
+std::map<MapKey, MapEntry> registry;
+
+/**
+ * @brief get the shared map of the message, deserialized if no component holds it
+ * @note registry_mutex must be locked, while a map is deserialized too, so that a map is not
+ * deserialized twice when the components receive it at the same time
+ */
+std::pair<SharedLaneletMap, MapEntry *> get_shared_lanelet_map_locked(
+  const autoware_map_msgs::msg::LaneletMapBin & msg)
+{
+  for (auto it = registry.begin(); it != registry.end();) {
+    it = it->second.lanelet_map.expired() ? registry.erase(it) : std::next(it);
+  }
+
+  MapEntry & entry = registry[get_map_key(msg)];
+  SharedLaneletMap shared_map{
+    entry.lanelet_map.lock(), entry.traffic_rules.lock(), entry.routing_graph.lock()};
+
+  if (!shared_map.lanelet_map) {
+    shared_map.lanelet_map = std::make_shared<lanelet::LaneletMap>();
+    if (SharedMemoryRegion::is_handle(msg.data)) {
+      // the map is in the shared memory of the publisher, the handle is in the key of the map
+      const auto region = SharedMemoryRegion::open(msg.data);
+      if (!region) {
+        throw std::runtime_error(
+          "the shared memory of the lanelet map is not found, the map must be published without "
+          "the shared memory to the other hosts");
+      }
+      autoware_map_msgs::msg::LaneletMapBin region_msg = msg;
+      region_msg.data.assign(region->data(), region->data() + region->size());
+      lanelet::utils::conversion::fromBinMsg(
+        region_msg, shared_map.lanelet_map, &shared_map.traffic_rules, &shared_map.routing_graph);
+    } else {
+      lanelet::utils::conversion::fromBinMsg(
+        msg, shared_map.lanelet_map, &shared_map.traffic_rules, &shared_map.routing_graph);
+    }
+
+    // The centerline is computed and cached on its first use, which is not thread safe
+    for (const auto & lanelet : shared_map.lanelet_map->laneletLayer) {
+      static_cast<void>(lanelet.centerline());
+    }
+    entry = MapEntry{};
+  } else if (!shared_map.traffic_rules || !shared_map.routing_graph) {
+    // Only the map was kept by the components, the same routing graph as fromBinMsg is built
+    shared_map.traffic_rules = lanelet::traffic_rules::TrafficRulesFactory::create(
+      lanelet::Locations::Germany, lanelet::Participants::Vehicle);
+    shared_map.routing_graph =
+      lanelet::routing::RoutingGraph::build(*shared_map.lanelet_map, *shared_map.traffic_rules);
+  }
+
+  entry.lanelet_map = shared_map.lanelet_map;
+  entry.traffic_rules = shared_map.traffic_rules;
+  entry.routing_graph = shared_map.routing_graph;
+  return {shared_map, &entry};
+}
+}  // namespace
+
+SharedLaneletMap get_shared_lanelet_map(const autoware_map_msgs::msg::LaneletMapBin & msg)
+{
+  std::lock_guard<std::mutex> lock(registry_mutex);
+  return get_shared_lanelet_map_locked(msg).first;
+}
+
+std::shared_ptr<const lanelet::routing::RoutingGraphContainer> get_shared_overall_graphs(
+  const autoware_map_msgs::msg::LaneletMapBin & msg)
+{
+  std::lock_guard<std::mutex> lock(registry_mutex);
+  const auto [shared_map, entry] = get_shared_lanelet_map_locked(msg);
+  if (auto overall_graphs = entry->overall_graphs.lock()) {
+    return overall_graphs;
+  }
+
+  const auto pedestrian_rules = lanelet::traffic_rules::TrafficRulesFactory::create(
+    lanelet::Locations::Germany, lanelet::Participants::Pedestrian);
+  const lanelet::routing::RoutingGraphConstPtr pedestrian_graph =
+    lanelet::routing::RoutingGraph::build(*shared_map.lanelet_map, *pedestrian_rules);
+  const std::vector<lanelet::routing::RoutingGraphConstPtr> graphs{
+    shared_map.routing_graph, pedestrian_graph};
+  const auto overall_graphs =
+    std::make_shared<const lanelet::routing::RoutingGraphContainer>(graphs);
+  entry->overall_graphs = overall_graphs;
+  return overall_graphs;
+}
+
+std::shared_ptr<const LaneletKindTable> get_shared_lanelet_kind_table(
+  const autoware_map_msgs::msg::LaneletMapBin & msg)
+{
+  std::lock_guard<std::mutex> lock(registry_mutex);
+  const auto [shared_map, entry] = get_shared_lanelet_map_locked(msg);
+  if (auto lanelet_kind_table = entry->lanelet_kind_table.lock()) {
+    return lanelet_kind_table;
+  }
+
+  const auto lanelet_kind_table = std::make_shared<const LaneletKindTable>(shared_map.lanelet_map);
+  entry->lanelet_kind_table = lanelet_kind_table;
+  return lanelet_kind_table;
+}
+
+}  // namespace autoware::experimental::lanelet2_utils
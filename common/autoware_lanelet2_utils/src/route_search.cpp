@@ -0,0 +1,129 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <autoware/lanelet2_utils/route_search.hpp>
+
+#include <lanelet2_core/geometry/LineString.h>
+#include <lanelet2_routing/RoutingGraph.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+namespace autoware::experimental::lanelet2_utils
+{
+namespace
+{
+lanelet::BasicPoint2d middle_point(const lanelet::ConstLanelet & lanelet)
+{
+  const auto centerline = lanelet.centerline2d();
+  return lanelet::geometry::interpolatedPointAtDistance(
+    centerline, lanelet::geometry::length(centerline) / 2.0);
+}
+
+struct SearchNode
+{
+  lanelet::ConstLanelet lanelet;
+  lanelet::BasicPoint2d middle_point;
+  double cost{std::numeric_limits<double>::infinity()};
+  lanelet::Id parent_id{lanelet::InvalId};
+  bool is_closed{false};
+};
+}  // namespace
+
+std::optional<lanelet::routing::LaneletPath> find_shortest_path_astar(
+  const lanelet::ConstLanelet & start, const lanelet::ConstLanelet & goal,
+  const lanelet::routing::RoutingGraphConstPtr routing_graph,
+  const lanelet::traffic_rules::TrafficRules & traffic_rules,
+  const lanelet::routing::RoutingCost & routing_cost)
+{
+  const auto goal_point = middle_point(goal);
+
+  // the elements are the estimated cost to the goal, the cost from the start and the lanelet ID
+  using QueueElement = std::tuple<double, double, lanelet::Id>;
+  std::priority_queue<QueueElement, std::vector<QueueElement>, std::greater<>> open_queue;
+  std::unordered_map<lanelet::Id, SearchNode> nodes;
+
+  auto & start_node = nodes[start.id()];
+  start_node = SearchNode{start, middle_point(start), 0.0, lanelet::InvalId, false};
+  open_queue.emplace((start_node.middle_point - goal_point).norm(), 0.0, start.id());
+
+  while (!open_queue.empty()) {
+    const auto [estimated_cost, cost, id] = open_queue.top();
+    open_queue.pop();
+
+    // the references to the elements of unordered_map stay valid when it rehashes
+    auto & node = nodes.at(id);
+    if (node.is_closed || cost > node.cost) {
+      continue;
+    }
+    node.is_closed = true;
+
+    if (id == goal.id()) {
+      lanelet::ConstLanelets lanelets;
+      for (lanelet::Id path_id = id; path_id != lanelet::InvalId;
+           path_id = nodes.at(path_id).parent_id) {
+        lanelets.push_back(nodes.at(path_id).lanelet);
+      }
+      std::reverse(lanelets.begin(), lanelets.end());
+      return lanelet::routing::LaneletPath(lanelets);
+    }
+
+    const auto expand = [&](const lanelet::ConstLanelet & next, const double edge_cost) {
+      if (!std::isfinite(edge_cost)) {
+        return;
+      }
+      auto [it, is_new] = nodes.try_emplace(next.id());
+      auto & next_node = it->second;
+      if (is_new) {
+        next_node.lanelet = next;
+        next_node.middle_point = middle_point(next);
+      }
+      const double next_cost = cost + edge_cost;
+      if (next_node.is_closed || next_cost >= next_node.cost) {
+        return;
+      }
+      next_node.cost = next_cost;
+      next_node.parent_id = id;
+      open_queue.emplace(
+        next_cost + (next_node.middle_point - goal_point).norm(), next_cost, next.id());
+    };
+
+    for (const auto & following : routing_graph->following(node.lanelet, false)) {
+      expand(following, routing_cost.getCostSucceeding(traffic_rules, node.lanelet, following));
+    }
+    for (const auto & side :
+         {routing_graph->left(node.lanelet), routing_graph->right(node.lanelet)}) {
+      if (side) {
+        expand(*side, routing_cost.getCostLaneChange(traffic_rules, {node.lanelet}, {*side}));
+      }
+    }
+  }
+  return std::nullopt;
+}
+
+std::optional<lanelet::routing::LaneletPath> find_shortest_path_astar(
+  const lanelet::ConstLanelet & start, const lanelet::ConstLanelet & goal,
+  const lanelet::routing::RoutingGraphConstPtr routing_graph,
+  const lanelet::traffic_rules::TrafficRules & traffic_rules)
+{
+  const lanelet::routing::RoutingCostDistance routing_cost(k_default_lane_change_cost);
+  return find_shortest_path_astar(start, goal, routing_graph, traffic_rules, routing_cost);
+}
+}  // namespace autoware::experimental::lanelet2_utils
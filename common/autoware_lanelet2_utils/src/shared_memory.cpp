@@ -0,0 +1,120 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <autoware/lanelet2_utils/shared_memory.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace autoware::experimental::lanelet2_utils
+{
+namespace
+{
+constexpr std::array<uint8_t, 8> k_handle_magic{'A', 'W', 'S', 'H', 'M', 'M', 'A', 'P'};
+constexpr size_t k_handle_header_size = k_handle_magic.size() + sizeof(uint64_t);
+}  // namespace
+
+std::unique_ptr<SharedMemoryRegion> SharedMemoryRegion::create(
+  const std::string & name, const uint8_t * data, const size_t size)
+{
+  // a region left by a crashed publisher of the same name is replaced
+  shm_unlink(name.c_str());
+  const int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+  if (fd < 0) {
+    throw std::runtime_error("failed to create the shared memory " + name + ": " + strerror(errno));
+  }
+  // a region of size 0 cannot be mapped
+  const size_t mapped_size = std::max<size_t>(size, 1);
+  if (ftruncate(fd, static_cast<off_t>(mapped_size)) != 0) {
+    const std::string error = strerror(errno);
+    close(fd);
+    shm_unlink(name.c_str());
+    throw std::runtime_error("failed to allocate the shared memory " + name + ": " + error);
+  }
+  void * address = mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (address == MAP_FAILED) {
+    const std::string error = strerror(errno);
+    shm_unlink(name.c_str());
+    throw std::runtime_error("failed to map the shared memory " + name + ": " + error);
+  }
+  std::memcpy(address, data, size);
+  mprotect(address, mapped_size, PROT_READ);
+  return std::unique_ptr<SharedMemoryRegion>(new SharedMemoryRegion(name, address, size, true));
+}
+
+std::unique_ptr<SharedMemoryRegion> SharedMemoryRegion::open(const std::vector<uint8_t> & handle)
+{
+  if (!is_handle(handle)) {
+    return nullptr;
+  }
+  uint64_t size = 0;
+  std::memcpy(&size, handle.data() + k_handle_magic.size(), sizeof(size));
+  const std::string name(handle.begin() + k_handle_header_size, handle.end());
+
+  const int fd = shm_open(name.c_str(), O_RDONLY, 0);
+  if (fd < 0) {
+    return nullptr;
+  }
+  // the region is not the one of the handle if its size differs, e.g. replaced by another map
+  struct stat status{};
+  const size_t mapped_size = std::max<size_t>(size, 1);
+  if (fstat(fd, &status) != 0 || static_cast<size_t>(status.st_size) != mapped_size) {
+    close(fd);
+    return nullptr;
+  }
+  void * address = mmap(nullptr, mapped_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (address == MAP_FAILED) {
+    return nullptr;
+  }
+  return std::unique_ptr<SharedMemoryRegion>(
+    new SharedMemoryRegion(name, address, static_cast<size_t>(size), false));
+}
+
+bool SharedMemoryRegion::is_handle(const std::vector<uint8_t> & data)
+{
+  return data.size() > k_handle_header_size &&
+         std::equal(k_handle_magic.begin(), k_handle_magic.end(), data.begin());
+}
+
+SharedMemoryRegion::~SharedMemoryRegion()
+{
+  munmap(address_, std::max<size_t>(size_, 1));
+  if (is_owner_) {
+    shm_unlink(name_.c_str());
+  }
+}
+
+std::vector<uint8_t> SharedMemoryRegion::handle() const
+{
+  std::vector<uint8_t> handle(k_handle_magic.begin(), k_handle_magic.end());
+  const uint64_t size = size_;
+  const auto * size_bytes = reinterpret_cast<const uint8_t *>(&size);
+  handle.insert(handle.end(), size_bytes, size_bytes + sizeof(size));
+  handle.insert(handle.end(), name_.begin(), name_.end());
+  return handle;
+}
+}  // namespace autoware::experimental::lanelet2_utils
@@ -0,0 +1,118 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <autoware/lanelet2_utils/centerline.hpp>
+#include <autoware_lanelet2_extension/projection/mgrs_projector.hpp>
+#include <autoware_lanelet2_extension/utility/utilities.hpp>
+
+#include <gtest/gtest.h>
+#include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_io/Io.h>
+
+#include <filesystem>
+#include <string>
+
+namespace fs = std::filesystem;
+
+namespace autoware::experimental
+{
+class TestOverwriteLaneletsCenterline : public ::testing::TestWithParam<std::string>
+{
+protected:
+  static lanelet::LaneletMapPtr load_map(const std::string & map_name)
+  {
+    const auto map_path =
+      fs::path(ament_index_cpp::get_package_share_directory("autoware_lanelet2_utils")) /
+      "sample_map" / map_name;
+    lanelet::ErrorMessages errors{};
+    lanelet::projection::MGRSProjector projector;
+    return lanelet::load(map_path.string(), projector, &errors);
+  }
+
+  /// first ID of the centerlines created by the overwrite, which are not in the linestring layer
+  static lanelet::Id first_created_id(const lanelet::LaneletMapPtr & map)
+  {
+    lanelet::Id first_id = lanelet::InvalId;
+    for (const auto & lanelet : map->laneletLayer) {
+      const auto id = lanelet.centerline().id();
+      if (!map->lineStringLayer.exists(id) && (first_id == lanelet::InvalId || id < first_id)) {
+        first_id = id;
+      }
+    }
+    return first_id;
+  }
+
+  /// same points and waypoints, and same IDs relative to the first created one
+  static void expect_same_centerlines(
+    const lanelet::LaneletMapPtr & expected_map, const lanelet::LaneletMapPtr & actual_map)
+  {
+    ASSERT_EQ(expected_map->laneletLayer.size(), actual_map->laneletLayer.size());
+    const lanelet::Id expected_first_id = first_created_id(expected_map);
+    const lanelet::Id actual_first_id = first_created_id(actual_map);
+    for (const auto & expected : expected_map->laneletLayer) {
+      const auto actual = actual_map->laneletLayer.get(expected.id());
+      EXPECT_EQ(expected.hasAttribute("waypoints"), actual.hasAttribute("waypoints"));
+      if (expected.hasAttribute("waypoints")) {
+        EXPECT_EQ(expected.attribute("waypoints").asId(), actual.attribute("waypoints").asId());
+      }
+
+      const auto expected_centerline = expected.centerline();
+      const auto actual_centerline = actual.centerline();
+      if (expected_map->lineStringLayer.exists(expected_centerline.id())) {
+        EXPECT_EQ(expected_centerline.id(), actual_centerline.id());
+        continue;
+      }
+      EXPECT_EQ(
+        expected_centerline.id() - expected_first_id, actual_centerline.id() - actual_first_id);
+      ASSERT_EQ(expected_centerline.size(), actual_centerline.size());
+      for (size_t i = 0; i < expected_centerline.size(); ++i) {
+        EXPECT_EQ(
+          expected_centerline[i].id() - expected_first_id,
+          actual_centerline[i].id() - actual_first_id);
+        EXPECT_DOUBLE_EQ(expected_centerline[i].x(), actual_centerline[i].x());
+        EXPECT_DOUBLE_EQ(expected_centerline[i].y(), actual_centerline[i].y());
+        EXPECT_DOUBLE_EQ(expected_centerline[i].z(), actual_centerline[i].z());
+      }
+    }
+  }
+};
+
+TEST_P(TestOverwriteLaneletsCenterline, SameAsSequentialOverwrite)
+{
+  for (const bool force_overwrite : {false, true}) {
+    const auto expected_map = load_map(GetParam());
+    const auto actual_map = load_map(GetParam());
+    lanelet::utils::overwriteLaneletsCenterline(expected_map, 5.0, force_overwrite);
+    lanelet2_utils::overwrite_lanelets_centerline(actual_map, 5.0, force_overwrite, 4);
+    expect_same_centerlines(expected_map, actual_map);
+  }
+}
+
+TEST_P(TestOverwriteLaneletsCenterline, SameAsSequentialOverwriteWithWaypoints)
+{
+  for (const bool force_overwrite : {false, true}) {
+    const auto expected_map = load_map(GetParam());
+    const auto actual_map = load_map(GetParam());
+    lanelet::utils::overwriteLaneletsCenterlineWithWaypoints(expected_map, 5.0, force_overwrite);
+    lanelet2_utils::overwrite_lanelets_centerline_with_waypoints(
+      actual_map, 5.0, force_overwrite, 4);
+    expect_same_centerlines(expected_map, actual_map);
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  SampleMaps, TestOverwriteLaneletsCenterline,
+  ::testing::Values("intersection/crossing.osm", "straight_waypoint/lanelet2_map.osm"));
+}  // namespace autoware::experimental
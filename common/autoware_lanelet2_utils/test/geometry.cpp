@@ -288,6 +288,52 @@ TEST_F(ExtrapolatedLaneletTest, GetPoseFrom2dArcLength_OnRealMapLanelets)
   EXPECT_NEAR(p.orientation.w, eq.w, 1e-4);
 }
 
+// Test 16: find_segment_by_arc_length
+TEST(CenterlineArcLengthTest, FindSegmentByArcLength)
+{
+  const std::vector<double> arc_lengths{0.0, 1.0, 1.0, 3.0};
+  EXPECT_EQ(lanelet2_utils::find_segment_by_arc_length(arc_lengths, -1.0), 0u);
+  EXPECT_EQ(lanelet2_utils::find_segment_by_arc_length(arc_lengths, 0.5), 0u);
+  // the zero-length segment is skipped
+  EXPECT_EQ(lanelet2_utils::find_segment_by_arc_length(arc_lengths, 1.0), 2u);
+  EXPECT_EQ(lanelet2_utils::find_segment_by_arc_length(arc_lengths, 2.9), 2u);
+  EXPECT_FALSE(lanelet2_utils::find_segment_by_arc_length(arc_lengths, 3.0).has_value());
+  EXPECT_FALSE(lanelet2_utils::find_segment_by_arc_length({0.0}, 0.0).has_value());
+}
+
+// Test 17: get_pose_from_2d_arc_length with the cached arc lengths
+TEST_F(ExtrapolatedLaneletTest, GetPoseFrom2dArcLength_Cached)
+{
+  lanelet::ConstLanelets lanelets;
+  for (auto id : {2287, 2288, 2289}) {
+    lanelets.push_back(lanelet_map_ptr_->laneletLayer.get(id));
+  }
+
+  const auto arc_length = lanelet2_utils::compute_centerline_arc_length(lanelets.front());
+  const auto centerline = lanelets.front().centerline();
+  ASSERT_EQ(arc_length.x.size(), centerline.size());
+  EXPECT_NEAR(arc_length.arc_lengths_3d.back(), lanelet::geometry::length(centerline), 1e-6);
+  EXPECT_NEAR(
+    arc_length.arc_lengths_2d.back(),
+    lanelet::geometry::length(lanelet::ConstLineString2d(centerline)), 1e-6);
+
+  lanelet2_utils::CenterlineArcLengthCache cache;
+  EXPECT_EQ(&cache.get(lanelets.front()), &cache.get(lanelets.front()));
+  for (const double s : {0.0, 3.0, 10.0, 25.0, 40.0}) {
+    const auto expected = lanelet2_utils::get_pose_from_2d_arc_length(lanelets, s);
+    const auto actual = lanelet2_utils::get_pose_from_2d_arc_length(lanelets, s, cache);
+    ASSERT_EQ(expected.has_value(), actual.has_value());
+    if (!expected) {
+      continue;
+    }
+    EXPECT_NEAR(expected->position.x, actual->position.x, 1e-6);
+    EXPECT_NEAR(expected->position.y, actual->position.y, 1e-6);
+    EXPECT_NEAR(expected->orientation.z, actual->orientation.z, 1e-6);
+    EXPECT_NEAR(expected->orientation.w, actual->orientation.w, 1e-6);
+  }
+  EXPECT_FALSE(lanelet2_utils::get_pose_from_2d_arc_length(lanelets, 1e6, cache).has_value());
+}
+
 }  // namespace autoware::experimental
 
 int main(int argc, char ** argv)
@@ -18,6 +18,8 @@
 
 #include <gtest/gtest.h>
 #include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_core/primitives/Lanelet.h>
+#include <lanelet2_core/utility/Utilities.h>
 
 #include <filesystem>
 #include <string>
@@ -90,6 +92,36 @@ TEST_F(TestWithIntersectionCrossingMap, is_shoulder_lane)
   EXPECT_EQ(lanelet2_utils::is_shoulder_lane(ll), false);
   EXPECT_EQ(lanelet2_utils::is_bicycle_lane(ll), true);
 }
+
+TEST_F(TestWithIntersectionCrossingMap, LaneletKindTableIsSameAsAttributes)
+{
+  const lanelet2_utils::LaneletKindTable table(lanelet_map_ptr_);
+  for (const auto & ll : lanelet_map_ptr_->laneletLayer) {
+    EXPECT_EQ(table.kind(ll), lanelet2_utils::classify_lanelet_kind(ll)) << ll.id();
+    EXPECT_EQ(table.is_road_lane(ll), lanelet2_utils::is_road_lane(ll)) << ll.id();
+    EXPECT_EQ(table.is_shoulder_lane(ll), lanelet2_utils::is_shoulder_lane(ll)) << ll.id();
+    EXPECT_EQ(table.is_bicycle_lane(ll), lanelet2_utils::is_bicycle_lane(ll)) << ll.id();
+    EXPECT_EQ(
+      table.is_intersection_lanelet(ll), lanelet2_utils::is_intersection_lanelet(ll))
+      << ll.id();
+  }
+
+  const auto bicycle_kind = table.kind(lanelet_map_ptr_->laneletLayer.get(2303));
+  EXPECT_EQ(bicycle_kind & lanelet2_utils::BicycleLane, lanelet2_utils::BicycleLane);
+}
+
+TEST_F(TestWithRoadShoulderHighwayMap, LaneletKindTableClassifiesUnknownLanelet)
+{
+  const lanelet2_utils::LaneletKindTable table(lanelet_map_ptr_);
+  const auto shoulder_lane = lanelet_map_ptr_->laneletLayer.get(47);
+
+  // a lanelet which is not in the map of the table is classified on the call
+  lanelet::Lanelet other_lane(lanelet::utils::getId());
+  other_lane.attributes()[lanelet::AttributeName::Subtype] = "road_shoulder";
+  EXPECT_TRUE(table.is_shoulder_lane(shoulder_lane));
+  EXPECT_TRUE(table.is_shoulder_lane(other_lane));
+  EXPECT_FALSE(lanelet2_utils::LaneletKindTable{}.is_road_lane(other_lane));
+}
 }  // namespace autoware::experimental
 
 int main(int argc, char ** argv)
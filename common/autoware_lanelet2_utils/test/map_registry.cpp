@@ -0,0 +1,119 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <autoware/lanelet2_utils/map_registry.hpp>
+#include <autoware_lanelet2_extension/projection/mgrs_projector.hpp>
+#include <autoware_lanelet2_extension/utility/message_conversion.hpp>
+
+#include <gtest/gtest.h>
+#include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_io/Io.h>
+#include <lanelet2_routing/RoutingGraphContainer.h>
+
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+namespace autoware::experimental
+{
+class TestSharedLaneletMap : public ::testing::Test
+{
+protected:
+  autoware_map_msgs::msg::LaneletMapBin map_bin_msg_;
+
+  void SetUp() override
+  {
+    const auto sample_map_dir =
+      fs::path(ament_index_cpp::get_package_share_directory("autoware_lanelet2_utils")) /
+      "sample_map";
+    const auto intersection_crossing_map_path = sample_map_dir / "intersection" / "crossing.osm";
+
+    lanelet::ErrorMessages errors{};
+    lanelet::projection::MGRSProjector projector;
+    const auto lanelet_map_ptr =
+      lanelet::load(intersection_crossing_map_path.string(), projector, &errors);
+    lanelet::utils::conversion::toBinMsg(lanelet_map_ptr, &map_bin_msg_);
+    map_bin_msg_.header.frame_id = "map";
+  }
+};
+
+TEST_F(TestSharedLaneletMap, SameMessageSharesMap)
+{
+  const auto first = lanelet2_utils::get_shared_lanelet_map(map_bin_msg_);
+  const auto second = lanelet2_utils::get_shared_lanelet_map(map_bin_msg_);
+
+  ASSERT_NE(first.lanelet_map, nullptr);
+  EXPECT_FALSE(first.lanelet_map->laneletLayer.empty());
+  EXPECT_EQ(first.lanelet_map, second.lanelet_map);
+  EXPECT_EQ(first.traffic_rules, second.traffic_rules);
+  EXPECT_EQ(first.routing_graph, second.routing_graph);
+}
+
+TEST_F(TestSharedLaneletMap, OtherMessageDoesNotShareMap)
+{
+  const auto first = lanelet2_utils::get_shared_lanelet_map(map_bin_msg_);
+  map_bin_msg_.header.stamp.sec += 1;
+  const auto second = lanelet2_utils::get_shared_lanelet_map(map_bin_msg_);
+
+  EXPECT_NE(first.lanelet_map, second.lanelet_map);
+  EXPECT_EQ(first.lanelet_map->laneletLayer.size(), second.lanelet_map->laneletLayer.size());
+}
+
+TEST_F(TestSharedLaneletMap, RoutingGraphIsRebuiltForKeptMap)
+{
+  auto first = lanelet2_utils::get_shared_lanelet_map(map_bin_msg_);
+  first.traffic_rules.reset();
+  first.routing_graph.reset();
+  const auto second = lanelet2_utils::get_shared_lanelet_map(map_bin_msg_);
+
+  EXPECT_EQ(first.lanelet_map, second.lanelet_map);
+  EXPECT_NE(second.traffic_rules, nullptr);
+  EXPECT_NE(second.routing_graph, nullptr);
+}
+
+TEST_F(TestSharedLaneletMap, ReleasedMapIsDeserializedAgain)
+{
+  std::weak_ptr<lanelet::LaneletMap> released;
+  {
+    const auto first = lanelet2_utils::get_shared_lanelet_map(map_bin_msg_);
+    released = first.lanelet_map;
+  }
+  EXPECT_TRUE(released.expired());
+
+  const auto second = lanelet2_utils::get_shared_lanelet_map(map_bin_msg_);
+  EXPECT_NE(second.lanelet_map, nullptr);
+}
+
+TEST_F(TestSharedLaneletMap, OverallGraphsAreShared)
+{
+  const auto shared_map = lanelet2_utils::get_shared_lanelet_map(map_bin_msg_);
+  const auto first = lanelet2_utils::get_shared_overall_graphs(map_bin_msg_);
+  const auto second = lanelet2_utils::get_shared_overall_graphs(map_bin_msg_);
+
+  ASSERT_NE(first, nullptr);
+  EXPECT_EQ(first, second);
+  EXPECT_EQ(first->routingGraphs().size(), 2U);
+  EXPECT_EQ(first->routingGraphs().front(), shared_map.routing_graph);
+}
+
+TEST_F(TestSharedLaneletMap, LaneletKindTableIsShared)
+{
+  const auto first = lanelet2_utils::get_shared_lanelet_kind_table(map_bin_msg_);
+  const auto second = lanelet2_utils::get_shared_lanelet_kind_table(map_bin_msg_);
+
+  ASSERT_NE(first, nullptr);
+  EXPECT_EQ(first, second);
+}
+}  // namespace autoware::experimental
@@ -0,0 +1,113 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <autoware/lanelet2_utils/conversion.hpp>
+#include <autoware/lanelet2_utils/kind.hpp>
+#include <autoware/lanelet2_utils/route_search.hpp>
+
+#include <gtest/gtest.h>
+#include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_routing/RoutingGraph.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <string>
+
+namespace fs = std::filesystem;
+
+namespace autoware::experimental
+{
+class TestRouteSearchWithIntersectionCrossingMap : public ::testing::Test
+{
+protected:
+  lanelet::LaneletMapConstPtr lanelet_map_ptr_{nullptr};
+  lanelet::routing::RoutingGraphConstPtr routing_graph_ptr_{nullptr};
+  lanelet::traffic_rules::TrafficRulesPtr traffic_rules_ptr_{nullptr};
+
+  void SetUp() override
+  {
+    const auto sample_map_dir =
+      fs::path(ament_index_cpp::get_package_share_directory("autoware_lanelet2_utils")) /
+      "sample_map";
+    const auto intersection_crossing_map_path = sample_map_dir / "intersection" / "crossing.osm";
+
+    lanelet_map_ptr_ =
+      lanelet2_utils::load_mgrs_coordinate_map(intersection_crossing_map_path.string());
+    std::tie(routing_graph_ptr_, traffic_rules_ptr_) =
+      lanelet2_utils::instantiate_routing_graph_and_traffic_rules(lanelet_map_ptr_);
+  }
+
+  /// cost of the path with the default distance routing cost
+  double path_cost(const lanelet::routing::LaneletPath & path) const
+  {
+    const lanelet::routing::RoutingCostDistance routing_cost(
+      lanelet2_utils::k_default_lane_change_cost);
+    double cost = 0.0;
+    for (size_t i = 0; i + 1 < path.size(); ++i) {
+      const auto following = routing_graph_ptr_->following(path[i], false);
+      const bool is_following =
+        std::any_of(following.begin(), following.end(), [&](const auto & following_lanelet) {
+          return following_lanelet.id() == path[i + 1].id();
+        });
+      cost += is_following
+                ? routing_cost.getCostSucceeding(*traffic_rules_ptr_, path[i], path[i + 1])
+                : routing_cost.getCostLaneChange(*traffic_rules_ptr_, {path[i]}, {path[i + 1]});
+    }
+    return cost;
+  }
+};
+
+TEST_F(TestRouteSearchWithIntersectionCrossingMap, SameCostAsDijkstra)
+{
+  lanelet::ConstLanelets road_lanes;
+  for (const auto & lanelet : lanelet_map_ptr_->laneletLayer) {
+    if (lanelet2_utils::is_road_lane(lanelet)) {
+      road_lanes.push_back(lanelet);
+    }
+  }
+
+  for (const auto & start : road_lanes) {
+    for (const auto & goal : road_lanes) {
+      const auto expected = routing_graph_ptr_->shortestPath(start, goal, 0, true);
+      const auto actual = lanelet2_utils::find_shortest_path_astar(
+        start, goal, routing_graph_ptr_, *traffic_rules_ptr_);
+      ASSERT_EQ(expected.has_value(), actual.has_value()) << start.id() << " -> " << goal.id();
+      if (!expected) {
+        continue;
+      }
+      EXPECT_EQ(actual->front().id(), start.id());
+      EXPECT_EQ(actual->back().id(), goal.id());
+      EXPECT_NEAR(path_cost(*expected), path_cost(*actual), 1e-6)
+        << start.id() << " -> " << goal.id();
+    }
+  }
+}
+
+TEST_F(TestRouteSearchWithIntersectionCrossingMap, PathToItself)
+{
+  const auto lanelet = lanelet_map_ptr_->laneletLayer.get(2246);
+  const auto path = lanelet2_utils::find_shortest_path_astar(
+    lanelet, lanelet, routing_graph_ptr_, *traffic_rules_ptr_);
+  ASSERT_TRUE(path.has_value());
+  ASSERT_EQ(path->size(), 1U);
+  EXPECT_EQ(path->front().id(), 2246);
+}
+}  // namespace autoware::experimental
+
+int main(int argc, char ** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
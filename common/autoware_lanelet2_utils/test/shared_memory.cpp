@@ -0,0 +1,73 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <autoware/lanelet2_utils/map_registry.hpp>
+#include <autoware/lanelet2_utils/shared_memory.hpp>
+#include <autoware_lanelet2_extension/utility/message_conversion.hpp>
+
+#include <gtest/gtest.h>
+#include <lanelet2_core/LaneletMap.h>
+#include <unistd.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace autoware::experimental
+{
+using lanelet2_utils::SharedMemoryRegion;
+
+TEST(SharedMemoryRegion, OpenByHandle)
+{
+  const std::string name = "/autoware_lanelet2_utils_test_" + std::to_string(getpid());
+  const std::vector<uint8_t> data{1, 2, 3, 4, 5};
+  auto created = SharedMemoryRegion::create(name, data.data(), data.size());
+  const auto handle = created->handle();
+  EXPECT_TRUE(SharedMemoryRegion::is_handle(handle));
+  EXPECT_FALSE(SharedMemoryRegion::is_handle(data));
+  EXPECT_EQ(SharedMemoryRegion::open(data), nullptr);
+
+  const auto opened = SharedMemoryRegion::open(handle);
+  ASSERT_NE(opened, nullptr);
+  EXPECT_EQ(std::vector<uint8_t>(opened->data(), opened->data() + opened->size()), data);
+
+  // the opened region is readable after the creator removes it, but cannot be opened anymore
+  created.reset();
+  EXPECT_EQ(std::vector<uint8_t>(opened->data(), opened->data() + opened->size()), data);
+  EXPECT_EQ(SharedMemoryRegion::open(handle), nullptr);
+}
+
+TEST(SharedMemoryRegion, SharedLaneletMapFromHandle)
+{
+  auto lanelet_map = std::make_shared<lanelet::LaneletMap>();
+  lanelet::LineString3d left(
+    1, {lanelet::Point3d(2, 0.0, 1.0, 0.0), lanelet::Point3d(3, 10.0, 1.0, 0.0)});
+  lanelet::LineString3d right(
+    4, {lanelet::Point3d(5, 0.0, -1.0, 0.0), lanelet::Point3d(6, 10.0, -1.0, 0.0)});
+  lanelet_map->add(lanelet::Lanelet(7, left, right));
+  autoware_map_msgs::msg::LaneletMapBin map_bin_msg;
+  lanelet::utils::conversion::toBinMsg(lanelet_map, &map_bin_msg);
+
+  const std::string name = "/autoware_lanelet2_utils_test_map_" + std::to_string(getpid());
+  const auto region =
+    SharedMemoryRegion::create(name, map_bin_msg.data.data(), map_bin_msg.data.size());
+  autoware_map_msgs::msg::LaneletMapBin handle_msg = map_bin_msg;
+  handle_msg.data = region->handle();
+
+  const auto shared_map = lanelet2_utils::get_shared_lanelet_map(handle_msg);
+  ASSERT_NE(shared_map.lanelet_map, nullptr);
+  EXPECT_TRUE(shared_map.lanelet_map->laneletLayer.exists(7));
+  EXPECT_NE(shared_map.routing_graph, nullptr);
+}
+}  // namespace autoware::experimental
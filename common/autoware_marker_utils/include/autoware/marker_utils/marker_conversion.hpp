@@ -148,6 +148,15 @@ visualization_msgs::msg::MarkerArray create_lanelets_marker_array(
   const std_msgs::msg::ColorRGBA & color, const geometry_msgs::msg::Vector3 scale,
   const double z = 0.0, const bool planning = false);
 
+/**
+ * @brief append the markers of create_lanelets_marker_array to a marker array
+ * @param [out] marker_array marker array to append the markers to
+ */
+void append_lanelets_marker_array(
+  visualization_msgs::msg::MarkerArray & marker_array, const lanelet::ConstLanelets & lanelets,
+  const std::string & ns, const std_msgs::msg::ColorRGBA & color,
+  const geometry_msgs::msg::Vector3 scale, const double z = 0.0, const bool planning = false);
+
 /**
  * @brief create marker array from predicted object
  * @details This function creates a marker array from a PredictedObjects object
@@ -164,6 +173,15 @@ visualization_msgs::msg::MarkerArray create_predicted_objects_marker_array(
   const autoware_perception_msgs::msg::PredictedObjects & objects, const rclcpp::Time & stamp,
   const std::string & ns, const int32_t id, const std_msgs::msg::ColorRGBA & color);
 
+/**
+ * @brief append the markers of create_predicted_objects_marker_array to a marker array
+ * @param [out] marker_array marker array to append the markers to
+ */
+void append_predicted_objects_marker_array(
+  visualization_msgs::msg::MarkerArray & marker_array,
+  const autoware_perception_msgs::msg::PredictedObjects & objects, const rclcpp::Time & stamp,
+  const std::string & ns, const int32_t id, const std_msgs::msg::ColorRGBA & color);
+
 /**
  * @brief create predicted path marker array from PredictedPath
  * @param [in] predicted_path PredictedPath object
@@ -194,6 +212,16 @@ visualization_msgs::msg::MarkerArray create_path_with_lane_id_marker_array(
   const int32_t id, const rclcpp::Time & now, const geometry_msgs::msg::Vector3 scale,
   const std_msgs::msg::ColorRGBA & color, const bool with_text);
 
+/**
+ * @brief append the markers of create_path_with_lane_id_marker_array to a marker array
+ * @param [out] marker_array marker array to append the markers to
+ */
+void append_path_with_lane_id_marker_array(
+  visualization_msgs::msg::MarkerArray & marker_array,
+  const autoware_internal_planning_msgs::msg::PathWithLaneId & path, const std::string & ns,
+  const int32_t id, const rclcpp::Time & now, const geometry_msgs::msg::Vector3 scale,
+  const std_msgs::msg::ColorRGBA & color, const bool with_text);
+
 /**
  * @brief create a vehicle trajectory point marker array object
  * @param [in] mpt_traj trajectory points to create markers from
@@ -207,6 +235,16 @@ visualization_msgs::msg::MarkerArray create_vehicle_trajectory_point_marker_arra
   const autoware::vehicle_info_utils::VehicleInfo & vehicle_info, const std::string & ns,
   const int32_t id);
 
+/**
+ * @brief append the markers of create_vehicle_trajectory_point_marker_array to a marker array
+ * @param [out] marker_array marker array to append the markers to
+ */
+void append_vehicle_trajectory_point_marker_array(
+  visualization_msgs::msg::MarkerArray & marker_array,
+  const std::vector<autoware_planning_msgs::msg::TrajectoryPoint> & mpt_traj,
+  const autoware::vehicle_info_utils::VehicleInfo & vehicle_info, const std::string & ns,
+  const int32_t id);
+
 /**
  * @brief create marker array from lanelet polygon (CompoundPolygon3d)
  * @param [in] polygon lanelet polygon
@@ -33,6 +33,7 @@
 #include <lanelet2_core/primitives/Lanelet.h>
 
 #include <algorithm>
+#include <iterator>
 #include <limits>
 #include <string>
 #include <vector>
@@ -201,12 +202,11 @@ visualization_msgs::msg::Marker create_autoware_geometry_marker(
   return marker;
 }
 
-visualization_msgs::msg::MarkerArray create_predicted_objects_marker_array(
+void append_predicted_objects_marker_array(
+  visualization_msgs::msg::MarkerArray & marker_array,
   const autoware_perception_msgs::msg::PredictedObjects & objects, const rclcpp::Time & stamp,
   const std::string & ns, const int32_t id, const std_msgs::msg::ColorRGBA & color)
 {
-  visualization_msgs::msg::MarkerArray marker_array;
-
   auto marker = create_default_marker(
     "map", stamp, ns, 0, visualization_msgs::msg::Marker::CUBE, create_marker_scale(3.0, 1.0, 1.0),
     color);
@@ -218,6 +218,15 @@ visualization_msgs::msg::MarkerArray create_predicted_objects_marker_array(
     marker.pose = object.kinematics.initial_pose_with_covariance.pose;
     marker_array.markers.push_back(marker);
   }
+}
+
+visualization_msgs::msg::MarkerArray create_predicted_objects_marker_array(
+  const autoware_perception_msgs::msg::PredictedObjects & objects, const rclcpp::Time & stamp,
+  const std::string & ns, const int32_t id, const std_msgs::msg::ColorRGBA & color)
+{
+  visualization_msgs::msg::MarkerArray marker_array;
+  marker_array.markers.reserve(objects.objects.size());
+  append_predicted_objects_marker_array(marker_array, objects, stamp, ns, id, color);
   return marker_array;
 }
 
@@ -227,6 +236,7 @@ static void create_vehicle_footprint_marker(
   const double & base_to_right, const double & base_to_left, const double & base_to_front,
   const double & base_to_rear)
 {
+  marker.points.reserve(marker.points.size() + 5);
   marker.points.push_back(
     autoware_utils_geometry::calc_offset_pose(pose, base_to_front, base_to_left, 0.0).position);
   marker.points.push_back(
@@ -256,7 +266,8 @@ static std::vector<double> calc_path_arc_length_array(
   return out;
 }
 
-visualization_msgs::msg::MarkerArray create_vehicle_trajectory_point_marker_array(
+void append_vehicle_trajectory_point_marker_array(
+  visualization_msgs::msg::MarkerArray & marker_array,
   const std::vector<autoware_planning_msgs::msg::TrajectoryPoint> & mpt_traj,
   const autoware::vehicle_info_utils::VehicleInfo & vehicle_info, const std::string & ns,
   const int32_t id)
@@ -271,16 +282,25 @@ visualization_msgs::msg::MarkerArray create_vehicle_trajectory_point_marker_arra
   const double base_to_front = vehicle_info.vehicle_length_m - vehicle_info.rear_overhang_m;
   const double base_to_rear = vehicle_info.rear_overhang_m;
 
-  visualization_msgs::msg::MarkerArray marker_array;
+  // the footprint points are written directly into the appended markers
   for (size_t i = 0; i < mpt_traj.size(); ++i) {
-    marker.id = i;
-    marker.points.clear();
+    auto & footprint_marker = marker_array.markers.emplace_back(marker);
+    footprint_marker.id = i;
 
     const auto & traj_point = mpt_traj.at(i);
     create_vehicle_footprint_marker(
-      marker, traj_point.pose, base_to_right, base_to_left, base_to_front, base_to_rear);
-    marker_array.markers.push_back(marker);
+      footprint_marker, traj_point.pose, base_to_right, base_to_left, base_to_front, base_to_rear);
   }
+}
+
+visualization_msgs::msg::MarkerArray create_vehicle_trajectory_point_marker_array(
+  const std::vector<autoware_planning_msgs::msg::TrajectoryPoint> & mpt_traj,
+  const autoware::vehicle_info_utils::VehicleInfo & vehicle_info, const std::string & ns,
+  const int32_t id)
+{
+  visualization_msgs::msg::MarkerArray marker_array;
+  marker_array.markers.reserve(mpt_traj.size());
+  append_vehicle_trajectory_point_marker_array(marker_array, mpt_traj, vehicle_info, ns, id);
   return marker_array;
 }
 
@@ -318,7 +338,8 @@ visualization_msgs::msg::MarkerArray create_predicted_path_marker_array(
   return marker_array;
 }
 
-visualization_msgs::msg::MarkerArray create_path_with_lane_id_marker_array(
+void append_path_with_lane_id_marker_array(
+  visualization_msgs::msg::MarkerArray & marker_array,
   const autoware_internal_planning_msgs::msg::PathWithLaneId & path, const std::string & ns,
   const int32_t id, const rclcpp::Time & now, const geometry_msgs::msg::Vector3 scale,
   const std_msgs::msg::ColorRGBA & color, const bool with_text)
@@ -326,7 +347,8 @@ visualization_msgs::msg::MarkerArray create_path_with_lane_id_marker_array(
   auto uid = id << (sizeof(int32_t) * 8 / 2);
   int32_t idx = 0;
   int32_t i = 0;
-  visualization_msgs::msg::MarkerArray msg;
+  auto & msg = marker_array;
+  const auto arclength = with_text ? calc_path_arc_length_array(path) : std::vector<double>{};
 
   visualization_msgs::msg::Marker marker = create_default_marker(
     "map", now, ns, static_cast<int32_t>(uid), visualization_msgs::msg::Marker::ARROW, scale,
@@ -342,7 +364,6 @@ visualization_msgs::msg::MarkerArray create_path_with_lane_id_marker_array(
     }
     msg.markers.push_back(marker);
     if (i % 10 == 0 && with_text) {
-      const auto arclength = calc_path_arc_length_array(path);
       visualization_msgs::msg::Marker marker_text = create_default_marker(
         "map", now, ns, 0L, visualization_msgs::msg::Marker::TEXT_VIEW_FACING,
         create_marker_scale(0.2, 0.1, 0.3), create_marker_color(1, 1, 1, 0.999));
@@ -354,42 +375,63 @@ visualization_msgs::msg::MarkerArray create_path_with_lane_id_marker_array(
     }
     ++idx;
   }
-  return msg;
 }
 
-visualization_msgs::msg::MarkerArray create_lanelets_marker_array(
-  const lanelet::ConstLanelets & lanelets, const std::string & ns,
-  const std_msgs::msg::ColorRGBA & color, const geometry_msgs::msg::Vector3 scale, const double z,
-  const bool planning)
+visualization_msgs::msg::MarkerArray create_path_with_lane_id_marker_array(
+  const autoware_internal_planning_msgs::msg::PathWithLaneId & path, const std::string & ns,
+  const int32_t id, const rclcpp::Time & now, const geometry_msgs::msg::Vector3 scale,
+  const std_msgs::msg::ColorRGBA & color, const bool with_text)
+{
+  visualization_msgs::msg::MarkerArray marker_array;
+  marker_array.markers.reserve(with_text ? path.points.size() * 11 / 10 + 1 : path.points.size());
+  append_path_with_lane_id_marker_array(marker_array, path, ns, id, now, scale, color, with_text);
+  return marker_array;
+}
+
+void append_lanelets_marker_array(
+  visualization_msgs::msg::MarkerArray & marker_array, const lanelet::ConstLanelets & lanelets,
+  const std::string & ns, const std_msgs::msg::ColorRGBA & color,
+  const geometry_msgs::msg::Vector3 scale, const double z, const bool planning)
 {
   if (lanelets.empty()) {
-    return visualization_msgs::msg::MarkerArray{};
+    return;
   }
 
-  visualization_msgs::msg::MarkerArray marker_array;
-
   if (planning) {
-    if (ns.empty()) {
-      return lanelet::visualization::laneletsBoundaryAsMarkerArray(lanelets, color, false);
-    } else {
-      return lanelet::visualization::laneletsAsTriangleMarkerArray(ns, lanelets, color);
-    }
+    auto planning_marker_array =
+      ns.empty() ? lanelet::visualization::laneletsBoundaryAsMarkerArray(lanelets, color, false)
+                 : lanelet::visualization::laneletsAsTriangleMarkerArray(ns, lanelets, color);
+    marker_array.markers.insert(
+      marker_array.markers.end(), std::make_move_iterator(planning_marker_array.markers.begin()),
+      std::make_move_iterator(planning_marker_array.markers.end()));
+    return;
   }
 
   auto marker = create_default_marker(
     "map", rclcpp::Time(0), ns, 0, visualization_msgs::msg::Marker::LINE_LIST, scale, color);
 
+  // the polygon points are written directly into the appended markers
   for (const auto & ll : lanelets) {
-    marker.points.clear();
-    for (const auto & p : ll.polygon2d().basicPolygon()) {
-      marker.points.push_back(create_marker_position(p.x(), p.y(), z + 0.5));
+    auto & lanelet_marker = marker_array.markers.emplace_back(marker);
+    const auto polygon = ll.polygon2d().basicPolygon();
+    lanelet_marker.points.reserve(polygon.size() + 1);
+    for (const auto & p : polygon) {
+      lanelet_marker.points.push_back(create_marker_position(p.x(), p.y(), z + 0.5));
     }
-    if (!marker.points.empty()) {
-      marker.points.push_back(marker.points.front());
+    if (!lanelet_marker.points.empty()) {
+      lanelet_marker.points.push_back(lanelet_marker.points.front());
     }
-    marker_array.markers.push_back(marker);
     ++marker.id;
   }
+}
+
+visualization_msgs::msg::MarkerArray create_lanelets_marker_array(
+  const lanelet::ConstLanelets & lanelets, const std::string & ns,
+  const std_msgs::msg::ColorRGBA & color, const geometry_msgs::msg::Vector3 scale, const double z,
+  const bool planning)
+{
+  visualization_msgs::msg::MarkerArray marker_array;
+  append_lanelets_marker_array(marker_array, lanelets, ns, color, scale, z, planning);
   return marker_array;
 }
 
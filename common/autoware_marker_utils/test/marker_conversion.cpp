@@ -509,6 +509,62 @@ TEST_F(MarkerConversionTest, CreateLaneletPolygonMarkerArray)
   EXPECT_EQ(marker.id, 0);
   EXPECT_EQ(marker.type, visualization_msgs::msg::Marker::LINE_STRIP);
 }
+
+// Test 18: the append functions keep the existing markers and append the created ones
+TEST_F(MarkerConversionTest, AppendMarkerArrays)
+{
+  std::vector<autoware_planning_msgs::msg::TrajectoryPoint> traj(3);
+  for (size_t i = 0; i < traj.size(); ++i) {
+    traj[i].pose.position.x = static_cast<double>(i);
+  }
+  autoware::vehicle_info_utils::VehicleInfo info;
+  info.wheel_tread_m = 1.0;
+  info.left_overhang_m = 0.2;
+  info.right_overhang_m = 0.2;
+  info.vehicle_length_m = 3.0;
+  info.rear_overhang_m = 0.5;
+
+  autoware_internal_planning_msgs::msg::PathWithLaneId path;
+  for (int i = 0; i < 12; ++i) {
+    autoware_internal_planning_msgs::msg::PathPointWithLaneId pp;
+    pp.point.pose.position.x = static_cast<double>(i);
+    pp.lane_ids = {1};
+    path.points.push_back(pp);
+  }
+
+  visualization_msgs::msg::MarkerArray arr;
+  arr.markers.push_back(create_default_marker(
+    "map", now, "existing", 0, visualization_msgs::msg::Marker::CUBE,
+    create_marker_scale(1.0, 1.0, 1.0), color_));
+  autoware::experimental::marker_utils::append_vehicle_trajectory_point_marker_array(
+    arr, traj, info, "footprint", 0);
+  autoware::experimental::marker_utils::append_path_with_lane_id_marker_array(
+    arr, path, "path", 1, now, geometry_msgs::msg::Vector3(), color_, true);
+
+  const auto footprints =
+    autoware::experimental::marker_utils::create_vehicle_trajectory_point_marker_array(
+      traj, info, "footprint", 0);
+  const auto path_markers =
+    autoware::experimental::marker_utils::create_path_with_lane_id_marker_array(
+      path, "path", 1, now, geometry_msgs::msg::Vector3(), color_, true);
+  ASSERT_EQ(arr.markers.size(), 1u + footprints.markers.size() + path_markers.markers.size());
+  EXPECT_EQ(arr.markers.front().ns, "existing");
+  for (size_t i = 0; i < footprints.markers.size(); ++i) {
+    const auto & m = arr.markers.at(1 + i);
+    EXPECT_EQ(m.id, footprints.markers.at(i).id);
+    ASSERT_EQ(m.points.size(), footprints.markers.at(i).points.size());
+    for (size_t j = 0; j < m.points.size(); ++j) {
+      const auto & p = footprints.markers.at(i).points.at(j);
+      expect_point_eq(m.points.at(j), p.x, p.y, p.z);
+    }
+  }
+  for (size_t i = 0; i < path_markers.markers.size(); ++i) {
+    const auto & m = arr.markers.at(1 + footprints.markers.size() + i);
+    EXPECT_EQ(m.id, path_markers.markers.at(i).id);
+    EXPECT_EQ(m.type, path_markers.markers.at(i).type);
+    EXPECT_EQ(m.text, path_markers.markers.at(i).text);
+  }
+}
 }  // namespace
 
 int main(int argc, char ** argv)
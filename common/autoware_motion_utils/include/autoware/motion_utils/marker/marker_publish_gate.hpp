@@ -0,0 +1,51 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__MOTION_UTILS__MARKER__MARKER_PUBLISH_GATE_HPP_
+#define AUTOWARE__MOTION_UTILS__MARKER__MARKER_PUBLISH_GATE_HPP_
+
+#include <rclcpp/publisher_base.hpp>
+#include <rclcpp/time.hpp>
+
+#include <optional>
+
+namespace autoware::motion_utils
+{
+
+/// @brief class to decide whether the markers of a debug publisher are created in a cycle
+/// @details the markers are created in every cycle while the publisher has subscribers. Without
+/// subscribers, they are not created, or only once per throttle period if it is positive.
+class MarkerPublishGate
+{
+public:
+  /// @brief constructor
+  /// @param throttle_period [s] minimum period of the markers without subscribers, 0 to skip them
+  explicit MarkerPublishGate(const double throttle_period = 0.0)
+  : throttle_period_(throttle_period)
+  {
+  }
+
+  /// @brief whether the markers should be created and published in the current cycle
+  /// @param publisher publisher of the markers
+  /// @param now current time
+  [[nodiscard]] bool is_open(
+    const rclcpp::PublisherBase::SharedPtr & publisher, const rclcpp::Time & now);
+
+private:
+  double throttle_period_;
+  std::optional<rclcpp::Time> last_open_time_{};
+};
+}  // namespace autoware::motion_utils
+
+#endif  // AUTOWARE__MOTION_UTILS__MARKER__MARKER_PUBLISH_GATE_HPP_
@@ -21,8 +21,10 @@
 #include <visualization_msgs/msg/marker_array.hpp>
 
 #include <functional>
+#include <map>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace autoware::motion_utils
@@ -44,7 +46,8 @@ struct VirtualWall
 using VirtualWalls = std::vector<VirtualWall>;
 
 /// @brief class to manage the creation of virtual wall markers
-/// @details creates both ADD and DELETE markers
+/// @details creates both ADD and DELETE markers. The markers of each namespace and type of wall
+/// are created once as templates, and then only their pose, text and stamp are updated.
 class VirtualWallMarkerCreator
 {
   struct MarkerCount
@@ -60,6 +63,13 @@ class VirtualWallMarkerCreator
 
   VirtualWalls virtual_walls_;
   std::unordered_map<std::string, MarkerCount> marker_count_per_namespace_;
+  /// @brief markers of a wall at the origin, per namespace prefix and type of wall
+  std::map<std::pair<std::string, VirtualWallType>, visualization_msgs::msg::MarkerArray>
+    marker_templates_;
+
+  /// @brief get the template markers of a wall, created on the first call
+  const visualization_msgs::msg::MarkerArray & get_marker_template(
+    const VirtualWall & virtual_wall);
 
   /// @brief internal cleanup: clear the stored markers and remove unused namespace from the map
   void cleanup();
@@ -15,6 +15,8 @@
 #ifndef AUTOWARE__MOTION_UTILS__TRAJECTORY__PATH_SHIFT_HPP_
 #define AUTOWARE__MOTION_UTILS__TRAJECTORY__PATH_SHIFT_HPP_
 
+#include <vector>
+
 namespace autoware::motion_utils
 {
 /**
@@ -27,6 +29,16 @@ namespace autoware::motion_utils
 double calc_feasible_velocity_from_jerk(
   const double lateral, const double jerk, const double longitudinal_distance);
 
+/**
+ * @brief Calculates the velocity required for shifting for each longitudinal distance
+ * @param lateral lateral distance
+ * @param jerk lateral jerk
+ * @param longitudinal_distances longitudinal distances
+ * @return velocity for each longitudinal distance
+ */
+std::vector<double> calc_feasible_velocity_from_jerk(
+  const double lateral, const double jerk, const std::vector<double> & longitudinal_distances);
+
 /**
  * @brief Calculates the lateral distance required for shifting
  * @param longitudinal longitudinal distance
@@ -37,6 +49,16 @@ double calc_feasible_velocity_from_jerk(
 double calc_lateral_dist_from_jerk(
   const double longitudinal, const double jerk, const double velocity);
 
+/**
+ * @brief Calculates the lateral distance required for shifting for each velocity
+ * @param longitudinal longitudinal distance
+ * @param jerk lateral jerk
+ * @param velocities velocities
+ * @return lateral distance for each velocity
+ */
+std::vector<double> calc_lateral_dist_from_jerk(
+  const double longitudinal, const double jerk, const std::vector<double> & velocities);
+
 /**
  * @brief Calculates the lateral distance required for shifting
  * @param lateral lateral distance
@@ -47,6 +69,16 @@ double calc_lateral_dist_from_jerk(
 double calc_longitudinal_dist_from_jerk(
   const double lateral, const double jerk, const double velocity);
 
+/**
+ * @brief Calculates the longitudinal distance required for shifting for each velocity
+ * @param lateral lateral distance
+ * @param jerk lateral jerk
+ * @param velocities velocities
+ * @return longitudinal distance for each velocity
+ */
+std::vector<double> calc_longitudinal_dist_from_jerk(
+  const double lateral, const double jerk, const std::vector<double> & velocities);
+
 /**
  * @brief Calculates the total time required for shifting
  * @param lateral lateral distance
@@ -56,6 +88,16 @@ double calc_longitudinal_dist_from_jerk(
  */
 double calc_shift_time_from_jerk(const double lateral, const double jerk, const double acc);
 
+/**
+ * @brief Calculates the total time required for shifting for each lateral distance
+ * @param laterals lateral distances
+ * @param jerk lateral jerk
+ * @param acc lateral acceleration
+ * @return time for each lateral distance
+ */
+std::vector<double> calc_shift_time_from_jerk(
+  const std::vector<double> & laterals, const double jerk, const double acc);
+
 /**
  * @brief Calculates the required jerk from lateral/longitudinal distance
  * @param lateral lateral distance
@@ -66,6 +108,16 @@ double calc_shift_time_from_jerk(const double lateral, const double jerk, const
 double calc_jerk_from_lat_lon_distance(
   const double lateral, const double longitudinal, const double velocity);
 
+/**
+ * @brief Calculates the required jerk from lateral distance for each longitudinal distance
+ * @param lateral lateral distance
+ * @param longitudinals longitudinal distances
+ * @param velocity velocity
+ * @return jerk for each longitudinal distance
+ */
+std::vector<double> calc_jerk_from_lat_lon_distance(
+  const double lateral, const std::vector<double> & longitudinals, const double velocity);
+
 }  // namespace autoware::motion_utils
 
 #endif  // AUTOWARE__MOTION_UTILS__TRAJECTORY__PATH_SHIFT_HPP_
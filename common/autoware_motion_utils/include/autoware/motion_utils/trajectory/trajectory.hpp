@@ -569,6 +569,150 @@ findNearestSegmentIndex<std::vector<autoware_planning_msgs::msg::TrajectoryPoint
   const geometry_msgs::msg::Pose & pose, const double max_dist = std::numeric_limits<double>::max(),
   const double max_yaw = std::numeric_limits<double>::max());
 
+/**
+ * @brief find nearest point index to pose, searching from the hint index.
+ * The search descends the 2D squared distance from the hint index to the local minimum, which is
+ * returned if it satisfies the distance and yaw thresholds. Otherwise, the whole points container
+ * is searched as findNearestIndex does.
+ * Since ego moves along the trajectory, the nearest index of the previous cycle is a good hint, and
+ * the local minimum keeps ego on the same part of a trajectory overlapping with itself.
+ * @param points points of trajectory, path, ...
+ * @param pose given pose
+ * @param hint_idx index to start the search from, e.g. the nearest index of the previous cycle. It
+ * is clamped to the points size.
+ * @param max_dist max distance used to get squared distance for finding the nearest point to given
+ * pose
+ * @param max_yaw max yaw used for finding nearest point to given pose
+ * @return index of nearest point (index or none if not found)
+ */
+template <class T>
+std::optional<size_t> findNearestIndexWithHint(
+  const T & points, const geometry_msgs::msg::Pose & pose, const size_t hint_idx,
+  const double max_dist = std::numeric_limits<double>::max(),
+  const double max_yaw = std::numeric_limits<double>::max())
+{
+  try {
+    validateNonEmpty(points);
+  } catch (const std::exception & e) {
+    RCLCPP_DEBUG(get_logger(), "%s", e.what());
+    return {};
+  }
+
+  const auto squared_dist = [&](const size_t idx) {
+    return autoware_utils_geometry::calc_squared_distance2d(points.at(idx), pose);
+  };
+
+  // descend to the local minimum, skipping the overlapping points of the same distance
+  size_t nearest_idx = std::min(hint_idx, points.size() - 1);
+  double min_squared_dist = squared_dist(nearest_idx);
+  const auto descend = [&](const size_t idx) {
+    const double dist = squared_dist(idx);
+    if (dist > min_squared_dist) {
+      return false;
+    }
+    if (dist < min_squared_dist) {
+      min_squared_dist = dist;
+      nearest_idx = idx;
+    }
+    return true;
+  };
+  for (size_t i = nearest_idx + 1; i < points.size(); ++i) {
+    if (!descend(i)) {
+      break;
+    }
+  }
+  for (size_t i = nearest_idx; i-- > 0;) {
+    if (!descend(i)) {
+      break;
+    }
+  }
+
+  const auto yaw = autoware_utils_geometry::calc_yaw_deviation(
+    autoware_utils_geometry::get_pose(points.at(nearest_idx)), pose);
+  if (min_squared_dist <= max_dist * max_dist && std::fabs(yaw) <= max_yaw) {
+    return nearest_idx;
+  }
+  return findNearestIndex(points, pose, max_dist, max_yaw);
+}
+
+extern template std::optional<size_t>
+findNearestIndexWithHint<std::vector<autoware_planning_msgs::msg::PathPoint>>(
+  const std::vector<autoware_planning_msgs::msg::PathPoint> & points,
+  const geometry_msgs::msg::Pose & pose, const size_t hint_idx,
+  const double max_dist = std::numeric_limits<double>::max(),
+  const double max_yaw = std::numeric_limits<double>::max());
+extern template std::optional<size_t>
+findNearestIndexWithHint<std::vector<autoware_internal_planning_msgs::msg::PathPointWithLaneId>>(
+  const std::vector<autoware_internal_planning_msgs::msg::PathPointWithLaneId> & points,
+  const geometry_msgs::msg::Pose & pose, const size_t hint_idx,
+  const double max_dist = std::numeric_limits<double>::max(),
+  const double max_yaw = std::numeric_limits<double>::max());
+extern template std::optional<size_t>
+findNearestIndexWithHint<std::vector<autoware_planning_msgs::msg::TrajectoryPoint>>(
+  const std::vector<autoware_planning_msgs::msg::TrajectoryPoint> & points,
+  const geometry_msgs::msg::Pose & pose, const size_t hint_idx,
+  const double max_dist = std::numeric_limits<double>::max(),
+  const double max_yaw = std::numeric_limits<double>::max());
+
+/**
+ * @brief find nearest segment index to pose, searching from the hint index.
+ * Segment is straight path between two continuous points of trajectory.
+ * When pose is on a trajectory point whose index is nearest_idx, return nearest_idx - 1
+ * @param points points of trajectory, path, ..
+ * @param pose pose to which to find nearest segment index
+ * @param hint_idx index to start the search from, e.g. the nearest segment index of the previous
+ * cycle. See findNearestIndexWithHint.
+ * @param max_dist max distance used for finding the nearest index to given pose
+ * @param max_yaw max yaw used for finding nearest index to given pose
+ * @return nearest index
+ */
+template <class T>
+std::optional<size_t> findNearestSegmentIndexWithHint(
+  const T & points, const geometry_msgs::msg::Pose & pose, const size_t hint_idx,
+  const double max_dist = std::numeric_limits<double>::max(),
+  const double max_yaw = std::numeric_limits<double>::max())
+{
+  const auto nearest_idx = findNearestIndexWithHint(points, pose, hint_idx, max_dist, max_yaw);
+
+  if (!nearest_idx) {
+    return std::nullopt;
+  }
+
+  if (*nearest_idx == 0) {
+    return 0;
+  }
+  if (*nearest_idx == points.size() - 1) {
+    return points.size() - 2;
+  }
+
+  const double signed_length = calcLongitudinalOffsetToSegment(points, *nearest_idx, pose.position);
+
+  if (signed_length <= 0) {
+    return *nearest_idx - 1;
+  }
+
+  return *nearest_idx;
+}
+
+extern template std::optional<size_t>
+findNearestSegmentIndexWithHint<std::vector<autoware_planning_msgs::msg::PathPoint>>(
+  const std::vector<autoware_planning_msgs::msg::PathPoint> & points,
+  const geometry_msgs::msg::Pose & pose, const size_t hint_idx,
+  const double max_dist = std::numeric_limits<double>::max(),
+  const double max_yaw = std::numeric_limits<double>::max());
+extern template std::optional<size_t>
+findNearestSegmentIndexWithHint<std::vector<autoware_internal_planning_msgs::msg::PathPointWithLaneId>>(
+  const std::vector<autoware_internal_planning_msgs::msg::PathPointWithLaneId> & points,
+  const geometry_msgs::msg::Pose & pose, const size_t hint_idx,
+  const double max_dist = std::numeric_limits<double>::max(),
+  const double max_yaw = std::numeric_limits<double>::max());
+extern template std::optional<size_t>
+findNearestSegmentIndexWithHint<std::vector<autoware_planning_msgs::msg::TrajectoryPoint>>(
+  const std::vector<autoware_planning_msgs::msg::TrajectoryPoint> & points,
+  const geometry_msgs::msg::Pose & pose, const size_t hint_idx,
+  const double max_dist = std::numeric_limits<double>::max(),
+  const double max_yaw = std::numeric_limits<double>::max());
+
 /**
  * @brief calculate lateral offset from p_target (length from p_target to trajectory) using given
  * segment index. Segment is straight path between two continuous points of trajectory.
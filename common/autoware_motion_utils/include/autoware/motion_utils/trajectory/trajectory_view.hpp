@@ -0,0 +1,425 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__MOTION_UTILS__TRAJECTORY__TRAJECTORY_VIEW_HPP_
+#define AUTOWARE__MOTION_UTILS__TRAJECTORY__TRAJECTORY_VIEW_HPP_
+
+#include "autoware/motion_utils/trajectory/trajectory.hpp"
+
+#include <autoware_utils_geometry/geometry.hpp>
+#include <autoware_utils_math/normalization.hpp>
+#include <autoware_utils_system/backtrace.hpp>
+#include <rclcpp/logging.hpp>
+
+#include <autoware_internal_planning_msgs/msg/path_point_with_lane_id.hpp>
+#include <autoware_planning_msgs/msg/path_point.hpp>
+#include <autoware_planning_msgs/msg/trajectory_point.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace autoware::motion_utils
+{
+/**
+ * @brief points container with the cumulative arc length, the segment directions and the yaws
+ * computed once, to answer the repeated queries on the same points without rescanning them.
+ * The overloads of calcSignedArcLength, findNearestIndex, findNearestSegmentIndex,
+ * calcLongitudinalOffsetToSegment and calcLateralOffset taking a TrajectoryView return the same
+ * values as the ones taking the points.
+ * @note the view refers to the points, which must outlive it and must not be modified.
+ */
+template <class T>
+class TrajectoryView
+{
+public:
+  explicit TrajectoryView(const T & points) : points_(points)
+  {
+    const size_t size = points.size();
+    xs_.resize(size);
+    ys_.resize(size);
+    yaws_.resize(size);
+    arc_lengths_.resize(size);
+    for (size_t i = 0; i < size; ++i) {
+      const auto & pose = autoware_utils_geometry::get_pose(points.at(i));
+      xs_.at(i) = pose.position.x;
+      ys_.at(i) = pose.position.y;
+      yaws_.at(i) = autoware_utils_geometry::get_rpy(pose).z;
+      if (i != 0) {
+        arc_lengths_.at(i) =
+          arc_lengths_.at(i - 1) + std::hypot(xs_.at(i) - xs_.at(i - 1), ys_.at(i) - ys_.at(i - 1));
+      }
+    }
+
+    // NOTE: a segment goes to the next point not overlapping with its front point as done by
+    // removeOverlapPoints in calcLongitudinalOffsetToSegment.
+    constexpr double eps = 1.0E-08;
+    std::vector<std::optional<size_t>> next_indices(size);
+    segment_directions_.assign(size, std::nullopt);
+    for (size_t i = size; i-- > 0;) {
+      for (size_t j = i + 1; j < size; ++j) {
+        const double dx = xs_.at(j) - xs_.at(i);
+        const double dy = ys_.at(j) - ys_.at(i);
+        if (std::abs(dx) >= eps || std::abs(dy) >= eps) {
+          next_indices.at(i) = j;
+          break;
+        }
+        // the point j overlaps with the point i, so that its next point is also the next of i
+        if (next_indices.at(j)) {
+          next_indices.at(i) = next_indices.at(j);
+          break;
+        }
+      }
+      if (next_indices.at(i)) {
+        const double dx = xs_.at(*next_indices.at(i)) - xs_.at(i);
+        const double dy = ys_.at(*next_indices.at(i)) - ys_.at(i);
+        const double norm = std::hypot(dx, dy);
+        segment_directions_.at(i) = Direction{dx / norm, dy / norm};
+        last_segment_idx_ = std::max(last_segment_idx_.value_or(0), i);
+      }
+    }
+  }
+
+  const T & points() const { return points_; }
+  size_t size() const { return points_.size(); }
+  bool empty() const { return points_.empty(); }
+
+  /// @brief arc length from the front point to the point of the index
+  double arcLength(const size_t idx) const { return arc_lengths_.at(idx); }
+  double yaw(const size_t idx) const { return yaws_.at(idx); }
+  double x(const size_t idx) const { return xs_.at(idx); }
+  double y(const size_t idx) const { return ys_.at(idx); }
+
+  struct Direction
+  {
+    double x;
+    double y;
+  };
+
+  /// @brief unit vector of the segment from the point of the index, or nullopt if all the
+  /// following points overlap with it
+  const std::optional<Direction> & segmentDirection(const size_t seg_idx) const
+  {
+    return segment_directions_.at(seg_idx);
+  }
+
+  /// @brief index of the last segment with a direction, or nullopt if all the points overlap
+  std::optional<size_t> lastSegmentIndex() const { return last_segment_idx_; }
+
+  double squaredDistance2d(const size_t idx, const geometry_msgs::msg::Point & point) const
+  {
+    const double dx = xs_.at(idx) - point.x;
+    const double dy = ys_.at(idx) - point.y;
+    return dx * dx + dy * dy;
+  }
+
+private:
+  const T & points_;
+  std::vector<double> xs_;
+  std::vector<double> ys_;
+  std::vector<double> yaws_;
+  std::vector<double> arc_lengths_;
+  std::vector<std::optional<Direction>> segment_directions_;
+  std::optional<size_t> last_segment_idx_;
+};
+
+/**
+ * @brief find nearest point index to the given point, see findNearestIndex of the points.
+ */
+template <class T>
+[[nodiscard]] size_t findNearestIndex(
+  const TrajectoryView<T> & view, const geometry_msgs::msg::Point & point)
+{
+  validateNonEmpty(view.points());
+
+  double min_dist = std::numeric_limits<double>::max();
+  size_t min_idx = 0;
+  for (size_t i = 0; i < view.size(); ++i) {
+    const auto dist = view.squaredDistance2d(i, point);
+    if (dist < min_dist) {
+      min_dist = dist;
+      min_idx = i;
+    }
+  }
+  return min_idx;
+}
+
+/**
+ * @brief find nearest point index to the given pose with the distance and yaw thresholds, see
+ * findNearestIndex of the points.
+ */
+template <class T>
+std::optional<size_t> findNearestIndex(
+  const TrajectoryView<T> & view, const geometry_msgs::msg::Pose & pose,
+  const double max_dist = std::numeric_limits<double>::max(),
+  const double max_yaw = std::numeric_limits<double>::max())
+{
+  if (view.empty()) {
+    return std::nullopt;
+  }
+
+  const double max_squared_dist = max_dist * max_dist;
+  const double pose_yaw = autoware_utils_geometry::get_rpy(pose).z;
+
+  double min_squared_dist = std::numeric_limits<double>::max();
+  std::optional<size_t> min_idx;
+  for (size_t i = 0; i < view.size(); ++i) {
+    const auto squared_dist = view.squaredDistance2d(i, pose.position);
+    if (squared_dist > max_squared_dist || squared_dist >= min_squared_dist) {
+      continue;
+    }
+    const double yaw = autoware_utils_math::normalize_radian(pose_yaw - view.yaw(i));
+    if (std::fabs(yaw) > max_yaw) {
+      continue;
+    }
+    min_squared_dist = squared_dist;
+    min_idx = i;
+  }
+  return min_idx;
+}
+
+/**
+ * @brief calculate longitudinal offset from the seg_idx point to the nearest point to p_target on
+ * the segment in O(1), see calcLongitudinalOffsetToSegment of the points.
+ */
+template <class T>
+double calcLongitudinalOffsetToSegment(
+  const TrajectoryView<T> & view, const size_t seg_idx, const geometry_msgs::msg::Point & p_target,
+  const bool throw_exception = false)
+{
+  if (view.empty() || seg_idx >= view.size() - 1) {
+    const std::string error_message(
+      "[autoware_motion_utils] " + std::string(__func__) +
+      ": Failed to calculate longitudinal offset because the given segment index is out of the "
+      "points size.");
+    autoware_utils_system::print_backtrace();
+    if (throw_exception) {
+      throw std::out_of_range(error_message);
+    }
+    RCLCPP_DEBUG(
+      get_logger(),
+      "%s Return NaN since no_throw option is enabled. The maintainer must check the code.",
+      error_message.c_str());
+    return std::nan("");
+  }
+
+  if (!view.segmentDirection(seg_idx)) {
+    const std::string error_message(
+      "[autoware_motion_utils] " + std::string(__func__) +
+      ": Longitudinal offset calculation is not supported for the same points.");
+    autoware_utils_system::print_backtrace();
+    if (throw_exception) {
+      throw std::runtime_error(error_message);
+    }
+    RCLCPP_DEBUG(
+      get_logger(),
+      "%s Return NaN since no_throw option is enabled. The maintainer must check the code.",
+      error_message.c_str());
+    return std::nan("");
+  }
+
+  const auto & direction = *view.segmentDirection(seg_idx);
+  return direction.x * (p_target.x - view.x(seg_idx)) +
+         direction.y * (p_target.y - view.y(seg_idx));
+}
+
+/**
+ * @brief find nearest segment index to the given point, see findNearestSegmentIndex of the points.
+ */
+template <class T>
+size_t findNearestSegmentIndex(
+  const TrajectoryView<T> & view, const geometry_msgs::msg::Point & point)
+{
+  const size_t nearest_idx = findNearestIndex(view, point);
+
+  if (nearest_idx == 0) {
+    return 0;
+  }
+  if (nearest_idx == view.size() - 1) {
+    return view.size() - 2;
+  }
+
+  const double signed_length = calcLongitudinalOffsetToSegment(view, nearest_idx, point);
+  if (signed_length <= 0) {
+    return nearest_idx - 1;
+  }
+  return nearest_idx;
+}
+
+/**
+ * @brief find nearest segment index to the given pose with the distance and yaw thresholds, see
+ * findNearestSegmentIndex of the points.
+ */
+template <class T>
+std::optional<size_t> findNearestSegmentIndex(
+  const TrajectoryView<T> & view, const geometry_msgs::msg::Pose & pose,
+  const double max_dist = std::numeric_limits<double>::max(),
+  const double max_yaw = std::numeric_limits<double>::max())
+{
+  const auto nearest_idx = findNearestIndex(view, pose, max_dist, max_yaw);
+  if (!nearest_idx) {
+    return std::nullopt;
+  }
+
+  if (*nearest_idx == 0) {
+    return 0;
+  }
+  if (*nearest_idx == view.size() - 1) {
+    return view.size() - 2;
+  }
+
+  const double signed_length = calcLongitudinalOffsetToSegment(view, *nearest_idx, pose.position);
+  if (signed_length <= 0) {
+    return *nearest_idx - 1;
+  }
+  return *nearest_idx;
+}
+
+/**
+ * @brief calculate signed lateral offset from the segment of seg_idx to p_target in O(1).
+ * The segment index is clamped to the last segment.
+ * @note the segment goes from the seg_idx point to the next point not overlapping with it, which
+ * differs from calcLateralOffset of the points only when the points before seg_idx overlap.
+ */
+template <class T>
+double calcLateralOffset(
+  const TrajectoryView<T> & view, const geometry_msgs::msg::Point & p_target,
+  const size_t seg_idx, const bool throw_exception = false)
+{
+  const auto last_segment_idx = view.lastSegmentIndex();
+  if (!last_segment_idx) {
+    const std::string error_message(
+      "[autoware_motion_utils] " + std::string(__func__) +
+      ": Lateral offset calculation is not supported for the same points.");
+    autoware_utils_system::print_backtrace();
+    if (throw_exception) {
+      throw std::runtime_error(error_message);
+    }
+    RCLCPP_DEBUG(
+      get_logger(),
+      "%s Return NaN since no_throw option is enabled. The maintainer must check the code.",
+      error_message.c_str());
+    return std::nan("");
+  }
+
+  size_t front_idx = std::min(seg_idx, *last_segment_idx);
+  if (!view.segmentDirection(front_idx)) {
+    front_idx = *last_segment_idx;
+  }
+  const auto & direction = *view.segmentDirection(front_idx);
+  return direction.x * (p_target.y - view.y(front_idx)) -
+         direction.y * (p_target.x - view.x(front_idx));
+}
+
+/**
+ * @brief calculate signed lateral offset from the nearest segment to p_target.
+ */
+template <class T>
+double calcLateralOffset(
+  const TrajectoryView<T> & view, const geometry_msgs::msg::Point & p_target,
+  const bool throw_exception = false)
+{
+  if (view.size() < 2) {
+    return calcLateralOffset(view, p_target, 0, throw_exception);
+  }
+  return calcLateralOffset(
+    view, p_target, findNearestSegmentIndex(view, p_target), throw_exception);
+}
+
+/**
+ * @brief calculate signed arc length between two point indices in O(1).
+ */
+template <class T>
+double calcSignedArcLength(
+  const TrajectoryView<T> & view, const size_t src_idx, const size_t dst_idx)
+{
+  if (view.empty()) {
+    return 0.0;
+  }
+  return view.arcLength(dst_idx) - view.arcLength(src_idx);
+}
+
+/**
+ * @brief calculate signed arc length from src_point to the dst_idx point.
+ */
+template <class T>
+double calcSignedArcLength(
+  const TrajectoryView<T> & view, const geometry_msgs::msg::Point & src_point, const size_t dst_idx)
+{
+  if (view.empty()) {
+    return 0.0;
+  }
+
+  const size_t src_seg_idx = findNearestSegmentIndex(view, src_point);
+  return calcSignedArcLength(view, src_seg_idx, dst_idx) -
+         calcLongitudinalOffsetToSegment(view, src_seg_idx, src_point);
+}
+
+/**
+ * @brief calculate signed arc length from the src_idx point to dst_point.
+ */
+template <class T>
+double calcSignedArcLength(
+  const TrajectoryView<T> & view, const size_t src_idx, const geometry_msgs::msg::Point & dst_point)
+{
+  if (view.empty()) {
+    return 0.0;
+  }
+  return -calcSignedArcLength(view, dst_point, src_idx);
+}
+
+/**
+ * @brief calculate signed arc length from src_point to dst_point.
+ */
+template <class T>
+double calcSignedArcLength(
+  const TrajectoryView<T> & view, const geometry_msgs::msg::Point & src_point,
+  const geometry_msgs::msg::Point & dst_point)
+{
+  if (view.empty()) {
+    return 0.0;
+  }
+
+  const size_t src_seg_idx = findNearestSegmentIndex(view, src_point);
+  const size_t dst_seg_idx = findNearestSegmentIndex(view, dst_point);
+  return calcSignedArcLength(view, src_seg_idx, dst_seg_idx) -
+         calcLongitudinalOffsetToSegment(view, src_seg_idx, src_point) +
+         calcLongitudinalOffsetToSegment(view, dst_seg_idx, dst_point);
+}
+
+/**
+ * @brief calculate signed arc length from src_point on the segment of src_seg_idx to dst_point on
+ * the segment of dst_seg_idx in O(1).
+ */
+template <class T>
+double calcSignedArcLength(
+  const TrajectoryView<T> & view, const geometry_msgs::msg::Point & src_point,
+  const size_t src_seg_idx, const geometry_msgs::msg::Point & dst_point, const size_t dst_seg_idx)
+{
+  return calcSignedArcLength(view, src_seg_idx, dst_seg_idx) -
+         calcLongitudinalOffsetToSegment(view, src_seg_idx, src_point) +
+         calcLongitudinalOffsetToSegment(view, dst_seg_idx, dst_point);
+}
+
+extern template class TrajectoryView<std::vector<autoware_planning_msgs::msg::PathPoint>>;
+extern template class TrajectoryView<
+  std::vector<autoware_internal_planning_msgs::msg::PathPointWithLaneId>>;
+extern template class TrajectoryView<std::vector<autoware_planning_msgs::msg::TrajectoryPoint>>;
+}  // namespace autoware::motion_utils
+
+#endif  // AUTOWARE__MOTION_UTILS__TRAJECTORY__TRAJECTORY_VIEW_HPP_
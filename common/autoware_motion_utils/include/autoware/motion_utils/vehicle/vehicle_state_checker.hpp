@@ -21,7 +21,9 @@
 #include <geometry_msgs/msg/twist_stamped.hpp>
 #include <nav_msgs/msg/odometry.hpp>
 
-#include <deque>
+#include <cstddef>
+#include <optional>
+#include <vector>
 
 namespace autoware::motion_utils
 {
@@ -30,6 +32,44 @@ using autoware_planning_msgs::msg::Trajectory;
 using geometry_msgs::msg::TwistStamped;
 using nav_msgs::msg::Odometry;
 
+/**
+ * @brief ring buffer of the stamps of the stop states within a duration, which keeps the stamp
+ *        from which the vehicle is stopped, so that the stop duration is given in O(1)
+ * @details When more stop states than the capacity are within the duration, the oldest ones are
+ *          removed, which only shortens the history.
+ */
+class VehicleStopHistory
+{
+public:
+  static constexpr size_t default_capacity = 1024;
+
+  explicit VehicleStopHistory(
+    const double buffer_duration, const size_t capacity = default_capacity);
+
+  /**
+   * @brief add the stop state at the stamp, newer than the previous ones, and remove the stop
+   *        states older than the buffer duration at now
+   */
+  void addStopState(const rclcpp::Time & stamp, const bool is_stopped, const rclcpp::Time & now);
+  void clear();
+
+  [[nodiscard]] bool empty() const { return size_ == 0; }
+  [[nodiscard]] std::optional<rclcpp::Time> getOldestStamp() const;
+
+  /**
+   * @brief get the stamp of the oldest stop state after which the vehicle is always stopped
+   * @return std::nullopt if the vehicle is moving at the newest stop state
+   */
+  [[nodiscard]] std::optional<rclcpp::Time> getStopStartStamp() const;
+
+private:
+  double buffer_duration_;
+  std::vector<rclcpp::Time> stamps_;
+  size_t oldest_idx_{0};
+  size_t size_{0};
+  std::optional<rclcpp::Time> stop_start_stamp_;  // first stopped stamp after the last move
+};
+
 class VehicleStopCheckerBase
 {
 public:
@@ -43,8 +83,7 @@ protected:
   rclcpp::Logger logger_;
 
 private:
-  double buffer_duration_;
-  std::deque<TwistStamped> twist_buffer_;
+  VehicleStopHistory stop_history_;
 };
 
 class VehicleStopChecker : public VehicleStopCheckerBase
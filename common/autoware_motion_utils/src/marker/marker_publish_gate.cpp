@@ -0,0 +1,39 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/motion_utils/marker/marker_publish_gate.hpp"
+
+namespace autoware::motion_utils
+{
+
+bool MarkerPublishGate::is_open(
+  const rclcpp::PublisherBase::SharedPtr & publisher, const rclcpp::Time & now)
+{
+  if (!publisher) {
+    return false;
+  }
+  const auto is_subscribed = publisher->get_subscription_count() > 0 ||
+                             publisher->get_intra_process_subscription_count() > 0;
+  if (!is_subscribed) {
+    if (throttle_period_ <= 0.0) {
+      return false;
+    }
+    if (last_open_time_ && (now - *last_open_time_).seconds() < throttle_period_) {
+      return false;
+    }
+  }
+  last_open_time_ = now;
+  return true;
+}
+}  // namespace autoware::motion_utils
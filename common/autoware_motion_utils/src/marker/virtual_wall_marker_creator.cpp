@@ -16,6 +16,10 @@
 
 #include "autoware/motion_utils/marker/marker_helper.hpp"
 
+#include <autoware_utils_geometry/geometry.hpp>
+
+#include <utility>
+
 namespace autoware::motion_utils
 {
 
@@ -41,6 +45,35 @@ void VirtualWallMarkerCreator::add_virtual_walls(const VirtualWalls & walls)
   virtual_walls_.insert(virtual_walls_.end(), walls.begin(), walls.end());
 }
 
+const visualization_msgs::msg::MarkerArray & VirtualWallMarkerCreator::get_marker_template(
+  const VirtualWall & virtual_wall)
+{
+  const auto key = std::make_pair(virtual_wall.ns, virtual_wall.style);
+  if (const auto it = marker_templates_.find(key); it != marker_templates_.end()) {
+    return it->second;
+  }
+  create_wall_function create_fn;
+  switch (virtual_wall.style) {
+    case stop:
+      create_fn = autoware::motion_utils::createStopVirtualWallMarker;
+      break;
+    case slowdown:
+      create_fn = autoware::motion_utils::createSlowDownVirtualWallMarker;
+      break;
+    case deadline:
+      create_fn = autoware::motion_utils::createDeadLineVirtualWallMarker;
+      break;
+    case pass:
+      create_fn = autoware::motion_utils::createIntendedPassVirtualMarker;
+      break;
+  }
+  // the markers of a wall are offset from its pose along the z axis of the map only, so a wall at
+  // the origin gives their offsets
+  auto marker_template =
+    create_fn(geometry_msgs::msg::Pose{}, "", rclcpp::Time(), 0, 0.0, virtual_wall.ns, true);
+  return marker_templates_.emplace(key, std::move(marker_template)).first->second;
+}
+
 visualization_msgs::msg::MarkerArray VirtualWallMarkerCreator::create_markers(
   const rclcpp::Time & now)
 {
@@ -51,31 +84,24 @@ visualization_msgs::msg::MarkerArray VirtualWallMarkerCreator::create_markers(
     count.current = 0UL;
   }
   // convert to markers
-  create_wall_function create_fn;
   for (const auto & virtual_wall : virtual_walls_) {
-    switch (virtual_wall.style) {
-      case stop:
-        create_fn = autoware::motion_utils::createStopVirtualWallMarker;
-        break;
-      case slowdown:
-        create_fn = autoware::motion_utils::createSlowDownVirtualWallMarker;
-        break;
-      case deadline:
-        create_fn = autoware::motion_utils::createDeadLineVirtualWallMarker;
-        break;
-      case pass:
-        create_fn = autoware::motion_utils::createIntendedPassVirtualMarker;
-        break;
-    }
-    const auto wall_text = virtual_wall.detail.empty()
-                             ? virtual_wall.text
-                             : virtual_wall.text + "(" + virtual_wall.detail + ")";
-    auto markers = create_fn(
-      virtual_wall.pose, wall_text, now, 0, virtual_wall.longitudinal_offset, virtual_wall.ns,
-      virtual_wall.is_driving_forward);
-    for (auto & marker : markers.markers) {
+    const auto & marker_template = get_marker_template(virtual_wall);
+    const auto wall_pose = autoware_utils_geometry::calc_offset_pose(
+      virtual_wall.pose,
+      virtual_wall.longitudinal_offset * (virtual_wall.is_driving_forward ? 1.0 : -1.0), 0.0, 0.0);
+    for (const auto & template_marker : marker_template.markers) {
+      auto & marker = marker_array.markers.emplace_back(template_marker);
+      marker.header.stamp = now;
       marker.id = static_cast<int>(marker_count_per_namespace_[marker.ns].current++);
-      marker_array.markers.push_back(marker);
+      marker.pose = wall_pose;
+      marker.pose.position.x += template_marker.pose.position.x;
+      marker.pose.position.y += template_marker.pose.position.y;
+      marker.pose.position.z += template_marker.pose.position.z;
+      if (marker.type == visualization_msgs::msg::Marker::TEXT_VIEW_FACING) {
+        marker.text = virtual_wall.detail.empty()
+                        ? virtual_wall.text
+                        : virtual_wall.text + "(" + virtual_wall.detail + ")";
+      }
     }
   }
   // create delete markers
@@ -15,6 +15,7 @@
 #include "autoware/motion_utils/resample/resample.hpp"
 
 #include "autoware/interpolation/linear_interpolation.hpp"
+#include "autoware/interpolation/query_segments.hpp"
 #include "autoware/interpolation/spline_interpolation.hpp"
 #include "autoware/interpolation/zero_order_hold.hpp"
 #include "autoware/motion_utils/resample/resample_utils.hpp"
@@ -25,6 +26,8 @@
 #include <algorithm>
 #include <cstdlib>
 #include <iostream>
+#include <optional>
+#include <utility>
 #include <vector>
 
 namespace autoware::motion_utils
@@ -64,8 +67,12 @@ std::vector<geometry_msgs::msg::Point> resamplePointVector(
   }
 
   // Interpolate
+  std::optional<autoware::interpolation::QuerySegments> lerp_segments;
   const auto lerp = [&](const auto & input) {
-    return autoware::interpolation::lerp(input_arclength, input, resampled_arclength);
+    if (!lerp_segments) {
+      lerp_segments.emplace(input_arclength, resampled_arclength);
+    }
+    return autoware::interpolation::lerp(*lerp_segments, input);
   };
   const auto spline = [&](const auto & input) {
     return autoware::interpolation::spline(input_arclength, input, resampled_arclength);
@@ -78,16 +85,14 @@ std::vector<geometry_msgs::msg::Point> resamplePointVector(
   const auto interpolated_y = use_akima_spline_for_xy ? lerp(y) : spline_by_akima(y);
   const auto interpolated_z = use_lerp_for_z ? lerp(z) : spline(z);
 
-  std::vector<geometry_msgs::msg::Point> resampled_points;
-  resampled_points.resize(interpolated_x.size());
+  std::vector<geometry_msgs::msg::Point> resampled_points(interpolated_x.size());
 
   // Insert Position
   for (size_t i = 0; i < resampled_points.size(); ++i) {
-    geometry_msgs::msg::Point point;
+    auto & point = resampled_points.at(i);
     point.x = interpolated_x.at(i);
     point.y = interpolated_y.at(i);
     point.z = interpolated_z.at(i);
-    resampled_points.at(i) = point;
   }
 
   return resampled_points;
@@ -283,24 +288,21 @@ autoware_internal_planning_msgs::msg::PathWithLaneId resamplePath(
   }
 
   // Interpolate
-  const auto lerp = [&](const auto & input) {
-    return autoware::interpolation::lerp(input_arclength, input, resampling_arclength);
+  // NOTE: the segment of each query key is located once and shared by the channels
+  const autoware::interpolation::QuerySegments lerp_segments(input_arclength, resampling_arclength);
+  const auto lerp = [&](const auto & input, const size_t i) {
+    return autoware::interpolation::lerp(lerp_segments, input, i);
   };
 
   auto closest_segment_indices =
     autoware::interpolation::calc_closest_segment_indices(input_arclength, resampling_arclength);
 
-  const auto zoh = [&](const auto & input) {
-    return autoware::interpolation::zero_order_hold(
-      input_arclength, input, closest_segment_indices);
+  const auto interpolate_v = [&](const std::vector<double> & input, const size_t i) {
+    return use_zero_order_hold_for_v ? input.at(closest_segment_indices.at(i)) : lerp(input, i);
   };
 
   const auto interpolated_pose =
     resamplePoseVector(input_pose, resampling_arclength, use_akima_spline_for_xy, use_lerp_for_z);
-  const auto interpolated_v_lon = use_zero_order_hold_for_v ? zoh(v_lon) : lerp(v_lon);
-  const auto interpolated_v_lat = use_zero_order_hold_for_v ? zoh(v_lat) : lerp(v_lat);
-  const auto interpolated_heading_rate = lerp(heading_rate);
-  const auto interpolated_is_final = zoh(is_final);
 
   // interpolate lane_ids
   std::vector<std::vector<int64_t>> interpolated_lane_ids;
@@ -347,14 +349,13 @@ autoware_internal_planning_msgs::msg::PathWithLaneId resamplePath(
   resampled_path.right_bound = input_path.right_bound;
   resampled_path.points.resize(interpolated_pose.size());
   for (size_t i = 0; i < resampled_path.points.size(); ++i) {
-    autoware_planning_msgs::msg::PathPoint path_point;
+    auto & path_point = resampled_path.points.at(i).point;
     path_point.pose = interpolated_pose.at(i);
-    path_point.longitudinal_velocity_mps = interpolated_v_lon.at(i);
-    path_point.lateral_velocity_mps = interpolated_v_lat.at(i);
-    path_point.heading_rate_rps = interpolated_heading_rate.at(i);
-    path_point.is_final = interpolated_is_final.at(i);
-    resampled_path.points.at(i).point = path_point;
-    resampled_path.points.at(i).lane_ids = interpolated_lane_ids.at(i);
+    path_point.longitudinal_velocity_mps = interpolate_v(v_lon, i);
+    path_point.lateral_velocity_mps = interpolate_v(v_lat, i);
+    path_point.heading_rate_rps = lerp(heading_rate, i);
+    path_point.is_final = is_final.at(closest_segment_indices.at(i));
+    resampled_path.points.at(i).lane_ids = std::move(interpolated_lane_ids.at(i));
   }
 
   return resampled_path;
@@ -466,8 +467,10 @@ autoware_planning_msgs::msg::Path resamplePath(
   }
 
   // Interpolate
-  const auto lerp = [&](const auto & input) {
-    return autoware::interpolation::lerp(input_arclength, input, resampled_arclength);
+  // NOTE: the segment of each query key is located once and shared by the channels
+  const autoware::interpolation::QuerySegments lerp_segments(input_arclength, resampled_arclength);
+  const auto lerp = [&](const auto & input, const size_t i) {
+    return autoware::interpolation::lerp(lerp_segments, input, i);
   };
 
   std::vector<size_t> closest_segment_indices;
@@ -475,16 +478,12 @@ autoware_planning_msgs::msg::Path resamplePath(
     closest_segment_indices =
       autoware::interpolation::calc_closest_segment_indices(input_arclength, resampled_arclength);
   }
-  const auto zoh = [&](const auto & input) {
-    return autoware::interpolation::zero_order_hold(
-      input_arclength, input, closest_segment_indices);
+  const auto interpolate_v = [&](const std::vector<double> & input, const size_t i) {
+    return use_zero_order_hold_for_v ? input.at(closest_segment_indices.at(i)) : lerp(input, i);
   };
 
   const auto interpolated_pose =
     resamplePoseVector(input_pose, resampled_arclength, use_akima_spline_for_xy, use_lerp_for_z);
-  const auto interpolated_v_lon = use_zero_order_hold_for_v ? zoh(v_lon) : lerp(v_lon);
-  const auto interpolated_v_lat = use_zero_order_hold_for_v ? zoh(v_lat) : lerp(v_lat);
-  const auto interpolated_heading_rate = lerp(heading_rate);
 
   if (interpolated_pose.size() != resampled_arclength.size()) {
     std::cerr
@@ -499,12 +498,11 @@ autoware_planning_msgs::msg::Path resamplePath(
   resampled_path.right_bound = input_path.right_bound;
   resampled_path.points.resize(interpolated_pose.size());
   for (size_t i = 0; i < resampled_path.points.size(); ++i) {
-    autoware_planning_msgs::msg::PathPoint path_point;
+    auto & path_point = resampled_path.points.at(i);
     path_point.pose = interpolated_pose.at(i);
-    path_point.longitudinal_velocity_mps = interpolated_v_lon.at(i);
-    path_point.lateral_velocity_mps = interpolated_v_lat.at(i);
-    path_point.heading_rate_rps = interpolated_heading_rate.at(i);
-    resampled_path.points.at(i) = path_point;
+    path_point.longitudinal_velocity_mps = interpolate_v(v_lon, i);
+    path_point.lateral_velocity_mps = interpolate_v(v_lat, i);
+    path_point.heading_rate_rps = lerp(heading_rate, i);
   }
 
   return resampled_path;
@@ -641,8 +639,10 @@ autoware_planning_msgs::msg::Trajectory resampleTrajectory(
   }
 
   // Interpolate
-  const auto lerp = [&](const auto & input) {
-    return autoware::interpolation::lerp(input_arclength, input, resampled_arclength);
+  // NOTE: the segment of each query key is located once and shared by the channels
+  const autoware::interpolation::QuerySegments lerp_segments(input_arclength, resampled_arclength);
+  const auto lerp = [&](const auto & input, const size_t i) {
+    return autoware::interpolation::lerp(lerp_segments, input, i);
   };
 
   std::vector<size_t> closest_segment_indices;
@@ -650,21 +650,13 @@ autoware_planning_msgs::msg::Trajectory resampleTrajectory(
     closest_segment_indices =
       autoware::interpolation::calc_closest_segment_indices(input_arclength, resampled_arclength);
   }
-  const auto zoh = [&](const auto & input) {
-    return autoware::interpolation::zero_order_hold(
-      input_arclength, input, closest_segment_indices);
+  const auto interpolate_twist = [&](const std::vector<double> & input, const size_t i) {
+    return use_zero_order_hold_for_twist ? input.at(closest_segment_indices.at(i))
+                                         : lerp(input, i);
   };
 
   const auto interpolated_pose =
     resamplePoseVector(input_pose, resampled_arclength, use_akima_spline_for_xy, use_lerp_for_z);
-  const auto interpolated_v_lon = use_zero_order_hold_for_twist ? zoh(v_lon) : lerp(v_lon);
-  const auto interpolated_v_lat = use_zero_order_hold_for_twist ? zoh(v_lat) : lerp(v_lat);
-  const auto interpolated_heading_rate = lerp(heading_rate);
-  const auto interpolated_acceleration =
-    use_zero_order_hold_for_twist ? zoh(acceleration) : lerp(acceleration);
-  const auto interpolated_front_wheel_angle = lerp(front_wheel_angle);
-  const auto interpolated_rear_wheel_angle = lerp(rear_wheel_angle);
-  const auto interpolated_time_from_start = lerp(time_from_start);
 
   if (interpolated_pose.size() != resampled_arclength.size()) {
     std::cerr
@@ -677,16 +669,15 @@ autoware_planning_msgs::msg::Trajectory resampleTrajectory(
   resampled_trajectory.header = input_trajectory.header;
   resampled_trajectory.points.resize(interpolated_pose.size());
   for (size_t i = 0; i < resampled_trajectory.points.size(); ++i) {
-    autoware_planning_msgs::msg::TrajectoryPoint traj_point;
+    auto & traj_point = resampled_trajectory.points.at(i);
     traj_point.pose = interpolated_pose.at(i);
-    traj_point.longitudinal_velocity_mps = interpolated_v_lon.at(i);
-    traj_point.lateral_velocity_mps = interpolated_v_lat.at(i);
-    traj_point.heading_rate_rps = interpolated_heading_rate.at(i);
-    traj_point.acceleration_mps2 = interpolated_acceleration.at(i);
-    traj_point.front_wheel_angle_rad = interpolated_front_wheel_angle.at(i);
-    traj_point.rear_wheel_angle_rad = interpolated_rear_wheel_angle.at(i);
-    traj_point.time_from_start = rclcpp::Duration::from_seconds(interpolated_time_from_start.at(i));
-    resampled_trajectory.points.at(i) = traj_point;
+    traj_point.longitudinal_velocity_mps = interpolate_twist(v_lon, i);
+    traj_point.lateral_velocity_mps = interpolate_twist(v_lat, i);
+    traj_point.heading_rate_rps = lerp(heading_rate, i);
+    traj_point.acceleration_mps2 = interpolate_twist(acceleration, i);
+    traj_point.front_wheel_angle_rad = lerp(front_wheel_angle, i);
+    traj_point.rear_wheel_angle_rad = lerp(rear_wheel_angle, i);
+    traj_point.time_from_start = rclcpp::Duration::from_seconds(lerp(time_from_start, i));
   }
 
   return resampled_trajectory;
@@ -36,7 +36,7 @@ autoware_planning_msgs::msg::Trajectory convertToTrajectory(
 {
   autoware_planning_msgs::msg::Trajectory output{};
   output.header = header;
-  for (const auto & pt : trajectory) output.points.push_back(pt);
+  output.points.assign(trajectory.begin(), trajectory.end());
   return output;
 }
 
@@ -17,7 +17,9 @@
 #include "autoware/motion_utils/trajectory/trajectory.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <string>
+#include <vector>
 
 namespace autoware::motion_utils
 {
@@ -36,6 +38,26 @@ double calc_feasible_velocity_from_jerk(
   return d / (4.0 * std::pow(0.5 * l / j, 1.0 / 3.0));
 }
 
+std::vector<double> calc_feasible_velocity_from_jerk(
+  const double lateral, const double jerk, const std::vector<double> & longitudinal_distances)
+{
+  const double j = std::abs(jerk);
+  const double l = std::abs(lateral);
+  if (j < 1.0e-8 || l < 1.0e-8) {
+    const std::string error_message(
+      std::string(__func__) + ": Failed to calculate velocity due to invalid arg");
+    RCLCPP_WARN(get_logger(), "%s", error_message.c_str());
+    return std::vector<double>(longitudinal_distances.size(), 1.0e10);
+  }
+  // the arguments are checked once, so that the loop has no branch
+  const double denominator = 4.0 * std::pow(0.5 * l / j, 1.0 / 3.0);
+  std::vector<double> velocities(longitudinal_distances.size());
+  for (size_t i = 0; i < longitudinal_distances.size(); ++i) {
+    velocities[i] = std::abs(longitudinal_distances[i]) / denominator;
+  }
+  return velocities;
+}
+
 double calc_lateral_dist_from_jerk(
   const double longitudinal, const double jerk, const double velocity)
 {
@@ -52,6 +74,35 @@ double calc_lateral_dist_from_jerk(
   return 2.0 * std::pow(d / (4.0 * v), 3.0) * j;
 }
 
+std::vector<double> calc_lateral_dist_from_jerk(
+  const double longitudinal, const double jerk, const std::vector<double> & velocities)
+{
+  const double j = std::abs(jerk);
+  const double d = std::abs(longitudinal);
+  std::vector<double> lateral_distances(velocities.size());
+  if (j < 1.0e-8) {
+    const std::string error_message(
+      std::string(__func__) + ": Failed to calculate lateral distance due to invalid arg");
+    RCLCPP_WARN(get_logger(), "%s", error_message.c_str());
+    std::fill(lateral_distances.begin(), lateral_distances.end(), 1.0e10);
+    return lateral_distances;
+  }
+  bool has_invalid_velocity = false;
+  for (size_t i = 0; i < velocities.size(); ++i) {
+    const double v = std::abs(velocities[i]);
+    const double r = d / (4.0 * v);
+    const bool is_invalid = v < 1.0e-8;
+    lateral_distances[i] = is_invalid ? 1.0e10 : 2.0 * r * r * r * j;
+    has_invalid_velocity |= is_invalid;
+  }
+  if (has_invalid_velocity) {
+    const std::string error_message(
+      std::string(__func__) + ": Failed to calculate lateral distance due to invalid arg");
+    RCLCPP_WARN(get_logger(), "%s", error_message.c_str());
+  }
+  return lateral_distances;
+}
+
 double calc_longitudinal_dist_from_jerk(
   const double lateral, const double jerk, const double velocity)
 {
@@ -67,6 +118,26 @@ double calc_longitudinal_dist_from_jerk(
   return 4.0 * std::pow(0.5 * l / j, 1.0 / 3.0) * v;
 }
 
+std::vector<double> calc_longitudinal_dist_from_jerk(
+  const double lateral, const double jerk, const std::vector<double> & velocities)
+{
+  const double j = std::abs(jerk);
+  const double l = std::abs(lateral);
+  if (j < 1.0e-8) {
+    const std::string error_message(
+      std::string(__func__) + ": Failed to calculate longitudinal distance due to invalid arg");
+    RCLCPP_WARN(get_logger(), "%s", error_message.c_str());
+    return std::vector<double>(velocities.size(), 1.0e10);
+  }
+  // the arguments are checked once, so that the loop has no branch
+  const double factor = 4.0 * std::pow(0.5 * l / j, 1.0 / 3.0);
+  std::vector<double> longitudinal_distances(velocities.size());
+  for (size_t i = 0; i < velocities.size(); ++i) {
+    longitudinal_distances[i] = factor * std::abs(velocities[i]);
+  }
+  return longitudinal_distances;
+}
+
 double calc_shift_time_from_jerk(const double lateral, const double jerk, const double acc)
 {
   const double j = std::abs(jerk);
@@ -95,6 +166,33 @@ double calc_shift_time_from_jerk(const double lateral, const double jerk, const
   return t_total;
 }
 
+std::vector<double> calc_shift_time_from_jerk(
+  const std::vector<double> & laterals, const double jerk, const double acc)
+{
+  const double j = std::abs(jerk);
+  const double a = std::abs(acc);
+  if (j < 1.0e-8 || a < 1.0e-8) {
+    const std::string error_message(
+      std::string(__func__) + ": Failed to calculate shift time due to invalid arg");
+    RCLCPP_WARN(get_logger(), "%s", error_message.c_str());
+    return std::vector<double>(laterals.size(), 1.0e10);
+  }
+
+  // time with constant jerk when the acceleration limit is hit
+  const double tj = a / j;
+  std::vector<double> times(laterals.size());
+  for (size_t i = 0; i < laterals.size(); ++i) {
+    const double l = std::abs(laterals[i]);
+    // time with constant acceleration (zero jerk)
+    const double ta = (std::sqrt(a * a + 4.0 * j * j * l / a) - 3.0 * a) / (2.0 * j);
+    // both of the cases are computed and selected, so that the loop has no branch
+    const double t_acc_limited = 4.0 * tj + 2.0 * ta;
+    const double t_jerk_only = 4.0 * std::pow(l / (2.0 * j), 1.0 / 3.0);
+    times[i] = ta < 0.0 ? t_jerk_only : t_acc_limited;
+  }
+  return times;
+}
+
 double calc_jerk_from_lat_lon_distance(
   const double lateral, const double longitudinal, const double velocity)
 {
@@ -105,4 +203,18 @@ double calc_jerk_from_lat_lon_distance(
   return 0.5 * lat * std::pow(4.0 * v / lon, 3);
 }
 
+std::vector<double> calc_jerk_from_lat_lon_distance(
+  const double lateral, const std::vector<double> & longitudinals, const double velocity)
+{
+  constexpr double ep = 1.0e-3;
+  const double lat = std::abs(lateral);
+  const double v = std::abs(velocity);
+  std::vector<double> jerks(longitudinals.size());
+  for (size_t i = 0; i < longitudinals.size(); ++i) {
+    const double r = 4.0 * v / std::max(std::abs(longitudinals[i]), ep);
+    jerks[i] = 0.5 * lat * r * r * r;
+  }
+  return jerks;
+}
+
 }  // namespace autoware::motion_utils
@@ -146,6 +146,40 @@ findNearestSegmentIndex<std::vector<autoware_planning_msgs::msg::TrajectoryPoint
   const std::vector<autoware_planning_msgs::msg::TrajectoryPoint> & points,
   const geometry_msgs::msg::Pose & pose, const double max_dist, const double max_yaw);
 
+//
+template std::optional<size_t>
+findNearestIndexWithHint<std::vector<autoware_planning_msgs::msg::PathPoint>>(
+  const std::vector<autoware_planning_msgs::msg::PathPoint> & points,
+  const geometry_msgs::msg::Pose & pose, const size_t hint_idx, const double max_dist,
+  const double max_yaw);
+template std::optional<size_t>
+findNearestIndexWithHint<std::vector<autoware_internal_planning_msgs::msg::PathPointWithLaneId>>(
+  const std::vector<autoware_internal_planning_msgs::msg::PathPointWithLaneId> & points,
+  const geometry_msgs::msg::Pose & pose, const size_t hint_idx, const double max_dist,
+  const double max_yaw);
+template std::optional<size_t>
+findNearestIndexWithHint<std::vector<autoware_planning_msgs::msg::TrajectoryPoint>>(
+  const std::vector<autoware_planning_msgs::msg::TrajectoryPoint> & points,
+  const geometry_msgs::msg::Pose & pose, const size_t hint_idx, const double max_dist,
+  const double max_yaw);
+
+//
+template std::optional<size_t>
+findNearestSegmentIndexWithHint<std::vector<autoware_planning_msgs::msg::PathPoint>>(
+  const std::vector<autoware_planning_msgs::msg::PathPoint> & points,
+  const geometry_msgs::msg::Pose & pose, const size_t hint_idx, const double max_dist,
+  const double max_yaw);
+template std::optional<size_t>
+findNearestSegmentIndexWithHint<std::vector<autoware_internal_planning_msgs::msg::PathPointWithLaneId>>(
+  const std::vector<autoware_internal_planning_msgs::msg::PathPointWithLaneId> & points,
+  const geometry_msgs::msg::Pose & pose, const size_t hint_idx, const double max_dist,
+  const double max_yaw);
+template std::optional<size_t>
+findNearestSegmentIndexWithHint<std::vector<autoware_planning_msgs::msg::TrajectoryPoint>>(
+  const std::vector<autoware_planning_msgs::msg::TrajectoryPoint> & points,
+  const geometry_msgs::msg::Pose & pose, const size_t hint_idx, const double max_dist,
+  const double max_yaw);
+
 //
 template double calcLateralOffset<std::vector<autoware_planning_msgs::msg::PathPoint>>(
   const std::vector<autoware_planning_msgs::msg::PathPoint> & points,
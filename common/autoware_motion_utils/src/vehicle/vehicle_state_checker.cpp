@@ -16,66 +16,90 @@
 
 #include "autoware/motion_utils/trajectory/trajectory.hpp"
 
+#include <algorithm>
 #include <string>
 
 namespace autoware::motion_utils
 {
-VehicleStopCheckerBase::VehicleStopCheckerBase(rclcpp::Node * node, double buffer_duration)
-: clock_(node->get_clock()), logger_(node->get_logger())
+VehicleStopHistory::VehicleStopHistory(const double buffer_duration, const size_t capacity)
+: buffer_duration_(buffer_duration), stamps_(std::max(capacity, size_t{1}))
 {
-  buffer_duration_ = buffer_duration;
 }
 
-void VehicleStopCheckerBase::addTwist(const TwistStamped & twist)
+void VehicleStopHistory::addStopState(
+  const rclcpp::Time & stamp, const bool is_stopped, const rclcpp::Time & now)
 {
-  twist_buffer_.push_front(twist);
+  if (size_ == stamps_.size()) {
+    oldest_idx_ = (oldest_idx_ + 1) % stamps_.size();
+    --size_;
+  }
+  stamps_.at((oldest_idx_ + size_) % stamps_.size()) = stamp;
+  ++size_;
 
-  const auto now = clock_->now();
-  while (!twist_buffer_.empty()) {
-    // Check oldest data time
-    const auto time_diff = now - twist_buffer_.back().header.stamp;
+  if (!is_stopped) {
+    stop_start_stamp_ = std::nullopt;
+  } else if (!stop_start_stamp_) {
+    stop_start_stamp_ = stamp;
+  }
 
+  while (size_ != 0) {
     // Finish when oldest data is newer than threshold
-    if (time_diff.seconds() <= buffer_duration_) {
+    const auto & oldest_stamp = stamps_.at(oldest_idx_);
+    if (now < oldest_stamp || (now - oldest_stamp).seconds() <= buffer_duration_) {
       break;
     }
 
     // Remove old data
-    twist_buffer_.pop_back();
+    oldest_idx_ = (oldest_idx_ + 1) % stamps_.size();
+    --size_;
   }
 }
 
-bool VehicleStopCheckerBase::isVehicleStopped(const double stop_duration) const
+void VehicleStopHistory::clear()
 {
-  if (twist_buffer_.empty()) {
-    return false;
-  }
+  size_ = 0;
+  stop_start_stamp_ = std::nullopt;
+}
 
-  constexpr double squared_stop_velocity = 1e-3 * 1e-3;
-  const auto now = clock_->now();
+std::optional<rclcpp::Time> VehicleStopHistory::getOldestStamp() const
+{
+  if (empty()) {
+    return std::nullopt;
+  }
+  return stamps_.at(oldest_idx_);
+}
 
-  const auto time_buffer_back = now - twist_buffer_.back().header.stamp;
-  if (time_buffer_back.seconds() < stop_duration) {
-    return false;
+std::optional<rclcpp::Time> VehicleStopHistory::getStopStartStamp() const
+{
+  if (empty() || !stop_start_stamp_) {
+    return std::nullopt;
   }
+  // NOTE: the last move may have been removed from the history
+  return std::max(*stop_start_stamp_, stamps_.at(oldest_idx_));
+}
 
-  // Get velocities within stop_duration
-  for (const auto & velocity : twist_buffer_) {
-    double x = velocity.twist.linear.x;
-    double y = velocity.twist.linear.y;
-    double z = velocity.twist.linear.z;
-    double v = (x * x) + (y * y) + (z * z);
-    if (squared_stop_velocity <= v) {
-      return false;
-    }
+VehicleStopCheckerBase::VehicleStopCheckerBase(rclcpp::Node * node, double buffer_duration)
+: clock_(node->get_clock()), logger_(node->get_logger()), stop_history_(buffer_duration)
+{
+}
 
-    const auto time_diff = now - velocity.header.stamp;
-    if (time_diff.seconds() >= stop_duration) {
-      break;
-    }
-  }
+void VehicleStopCheckerBase::addTwist(const TwistStamped & twist)
+{
+  constexpr double squared_stop_velocity = 1e-3 * 1e-3;
+  const auto & v = twist.twist.linear;
+  const bool is_stopped = (v.x * v.x) + (v.y * v.y) + (v.z * v.z) < squared_stop_velocity;
+  stop_history_.addStopState(rclcpp::Time(twist.header.stamp), is_stopped, clock_->now());
+}
 
-  return true;
+bool VehicleStopCheckerBase::isVehicleStopped(const double stop_duration) const
+{
+  // NOTE: the vehicle is stopped when all the twists within the stop duration and the newest
+  // twist before it are stopped, i.e. the vehicle is stopped since a stamp older than it.
+  const auto stop_start_stamp = stop_history_.getStopStartStamp();
+  if (!stop_start_stamp) {
+    return false;
+  }
+  return (clock_->now() - *stop_start_stamp).seconds() >= stop_duration;
 }
 
 VehicleStopChecker::VehicleStopChecker(rclcpp::Node * node)
@@ -0,0 +1,218 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Time per call of the motion_utils functions used by the planning modules every cycle, on a
+// curved trajectory with 1 m interval. The benchmark argument is the number of points.
+// Run with --benchmark_format=json (or --benchmark_out=<file>) to compare the results.
+
+#include "autoware/motion_utils/resample/resample.hpp"
+#include "autoware/motion_utils/trajectory/interpolation.hpp"
+#include "autoware/motion_utils/trajectory/trajectory.hpp"
+#include "autoware/motion_utils/trajectory/trajectory_view.hpp"
+
+#include <autoware_utils_geometry/geometry.hpp>
+
+#include <autoware_planning_msgs/msg/path.hpp>
+#include <autoware_planning_msgs/msg/trajectory.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <optional>
+#include <random>
+#include <vector>
+
+namespace
+{
+using autoware_planning_msgs::msg::Path;
+using autoware_planning_msgs::msg::Trajectory;
+using autoware_utils_geometry::create_point;
+using autoware_utils_geometry::create_quaternion_from_yaw;
+
+constexpr double point_interval = 1.0;
+constexpr size_t query_num = 256;
+
+template <class T>
+T generateTestTrajectory(const size_t num_points)
+{
+  using Point = typename T::_points_type::value_type;
+
+  // a slowly turning curve, whose points are not on a circle, so that the curvature changes
+  T traj;
+  double x = 0.0;
+  double y = 0.0;
+  for (size_t i = 0; i < num_points; ++i) {
+    const double theta = 0.3 * std::sin(static_cast<double>(i) * 0.01);
+    Point p;
+    p.pose.position = create_point(x, y, 0.0);
+    p.pose.orientation = create_quaternion_from_yaw(theta);
+    p.longitudinal_velocity_mps = 10.0;
+    traj.points.push_back(p);
+    x += point_interval * std::cos(theta);
+    y += point_interval * std::sin(theta);
+  }
+  return traj;
+}
+
+// points near the trajectory, ordered along it as ego moves
+std::vector<geometry_msgs::msg::Pose> generateQueryPoses(const Trajectory & traj)
+{
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<double> lateral_offset(-1.0, 1.0);
+  std::vector<geometry_msgs::msg::Pose> poses;
+  for (size_t i = 0; i < query_num; ++i) {
+    const auto & base = traj.points.at(i * (traj.points.size() - 1) / query_num).pose;
+    auto pose = base;
+    pose.position.y += lateral_offset(engine);
+    poses.push_back(pose);
+  }
+  return poses;
+}
+
+void BM_findNearestIndex(benchmark::State & state)
+{
+  const auto traj = generateTestTrajectory<Trajectory>(state.range(0));
+  const auto poses = generateQueryPoses(traj);
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+      autoware::motion_utils::findNearestIndex(traj.points, poses.at(i++ % query_num), 3.0, 1.0));
+  }
+}
+
+void BM_findNearestIndexWithHint(benchmark::State & state)
+{
+  const auto traj = generateTestTrajectory<Trajectory>(state.range(0));
+  const auto poses = generateQueryPoses(traj);
+  size_t i = 0;
+  size_t hint_idx = 0;
+  for (auto _ : state) {
+    const auto nearest_idx = autoware::motion_utils::findNearestIndexWithHint(
+      traj.points, poses.at(i++ % query_num), hint_idx, 3.0, 1.0);
+    hint_idx = nearest_idx.value_or(0);
+    benchmark::DoNotOptimize(nearest_idx);
+  }
+}
+
+void BM_calcLateralOffset(benchmark::State & state)
+{
+  const auto traj = generateTestTrajectory<Trajectory>(state.range(0));
+  const auto poses = generateQueryPoses(traj);
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+      autoware::motion_utils::calcLateralOffset(traj.points, poses.at(i++ % query_num).position));
+  }
+}
+
+void BM_calcSignedArcLength(benchmark::State & state)
+{
+  const auto traj = generateTestTrajectory<Trajectory>(state.range(0));
+  const auto poses = generateQueryPoses(traj);
+  const size_t dst_idx = traj.points.size() - 1;
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(autoware::motion_utils::calcSignedArcLength(
+      traj.points, poses.at(i++ % query_num).position, dst_idx));
+  }
+}
+
+// the view is created once per trajectory as done by the planning modules in a cycle
+void BM_calcSignedArcLength_TrajectoryView(benchmark::State & state)
+{
+  const auto traj = generateTestTrajectory<Trajectory>(state.range(0));
+  const auto poses = generateQueryPoses(traj);
+  const autoware::motion_utils::TrajectoryView view(traj.points);
+  const size_t dst_idx = traj.points.size() - 1;
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(autoware::motion_utils::calcSignedArcLength(
+      view, poses.at(i++ % query_num).position, dst_idx));
+  }
+}
+
+void BM_TrajectoryView(benchmark::State & state)
+{
+  const auto traj = generateTestTrajectory<Trajectory>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(autoware::motion_utils::TrajectoryView(traj.points));
+  }
+}
+
+// NOTE: the time includes the copy of the points, which the insertion modifies
+void BM_insertTargetPoint(benchmark::State & state)
+{
+  const auto traj = generateTestTrajectory<Trajectory>(state.range(0));
+  const double length = point_interval * static_cast<double>(traj.points.size() - 1);
+  size_t i = 0;
+  for (auto _ : state) {
+    auto points = traj.points;
+    const double insert_point_length =
+      length * static_cast<double>(i++ % query_num) / query_num + 0.5 * point_interval;
+    benchmark::DoNotOptimize(
+      autoware::motion_utils::insertTargetPoint(0, insert_point_length, points));
+  }
+}
+
+void BM_resampleTrajectory(benchmark::State & state)
+{
+  const auto traj = generateTestTrajectory<Trajectory>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+      autoware::motion_utils::resampleTrajectory(traj, 0.5 * point_interval));
+  }
+}
+
+void BM_resamplePath(benchmark::State & state)
+{
+  const auto path = generateTestTrajectory<Path>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(autoware::motion_utils::resamplePath(path, 0.5 * point_interval));
+  }
+}
+
+void BM_calcCurvature(benchmark::State & state)
+{
+  const auto traj = generateTestTrajectory<Trajectory>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(autoware::motion_utils::calcCurvature(traj.points));
+  }
+}
+
+void BM_calcInterpolatedPose(benchmark::State & state)
+{
+  const auto traj = generateTestTrajectory<Trajectory>(state.range(0));
+  const double length = point_interval * static_cast<double>(traj.points.size() - 1);
+  size_t i = 0;
+  for (auto _ : state) {
+    const double target_length = length * static_cast<double>(i++ % query_num) / query_num;
+    benchmark::DoNotOptimize(
+      autoware::motion_utils::calcInterpolatedPose(traj.points, target_length));
+  }
+}
+}  // namespace
+
+BENCHMARK(BM_findNearestIndex)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK(BM_findNearestIndexWithHint)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK(BM_calcLateralOffset)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK(BM_calcSignedArcLength)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK(BM_calcSignedArcLength_TrajectoryView)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK(BM_TrajectoryView)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK(BM_insertTargetPoint)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK(BM_resampleTrajectory)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK(BM_resamplePath)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK(BM_calcCurvature)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK(BM_calcInterpolatedPose)->Arg(100)->Arg(1000)->Arg(10000);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,64 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/motion_utils/marker/marker_publish_gate.hpp"
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <visualization_msgs/msg/marker_array.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <thread>
+
+namespace
+{
+using autoware::motion_utils::MarkerPublishGate;
+using visualization_msgs::msg::MarkerArray;
+
+TEST(MarkerPublishGate, withoutSubscribers)
+{
+  const auto node = std::make_shared<rclcpp::Node>("test_marker_publish_gate_no_subscribers");
+  const auto publisher = node->create_publisher<MarkerArray>("~/debug/markers", 1);
+
+  MarkerPublishGate gate;
+  EXPECT_FALSE(gate.is_open(publisher, rclcpp::Time(0, 0)));
+  EXPECT_FALSE(gate.is_open(publisher, rclcpp::Time(10, 0)));
+  EXPECT_FALSE(gate.is_open(nullptr, rclcpp::Time(10, 0)));
+
+  MarkerPublishGate throttled_gate(1.0);
+  EXPECT_TRUE(throttled_gate.is_open(publisher, rclcpp::Time(0, 0)));
+  EXPECT_FALSE(throttled_gate.is_open(publisher, rclcpp::Time(0, 500000000)));
+  EXPECT_TRUE(throttled_gate.is_open(publisher, rclcpp::Time(1, 0)));
+  EXPECT_FALSE(throttled_gate.is_open(publisher, rclcpp::Time(1, 999999999)));
+}
+
+TEST(MarkerPublishGate, withSubscribers)
+{
+  const auto node = std::make_shared<rclcpp::Node>("test_marker_publish_gate_subscribers");
+  const auto publisher = node->create_publisher<MarkerArray>("~/debug/markers", 1);
+  const auto subscription = node->create_subscription<MarkerArray>(
+    "~/debug/markers", 1, [](const MarkerArray::ConstSharedPtr) {});
+  for (int i = 0; i < 100 && publisher->get_subscription_count() == 0; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  ASSERT_GT(publisher->get_subscription_count(), 0U);
+
+  MarkerPublishGate gate;
+  EXPECT_TRUE(gate.is_open(publisher, rclcpp::Time(0, 0)));
+  EXPECT_TRUE(gate.is_open(publisher, rclcpp::Time(0, 1)));
+}
+}  // namespace
@@ -12,9 +12,11 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include "autoware/motion_utils/marker/marker_helper.hpp"
 #include "autoware/motion_utils/marker/virtual_wall_marker_creator.hpp"
 #include "gtest/gtest.h"
 
+#include <cmath>
 #include <string>
 #include <vector>
 
@@ -122,4 +124,41 @@ TEST(VirtualWallMarkerCreator, manyWalls)
   markers = creator.create_markers();
   ASSERT_TRUE(markers.markers.empty());
 }
+
+TEST(VirtualWallMarkerCreator, sameMarkersAsHelpers)
+{
+  autoware::motion_utils::VirtualWall wall;
+  autoware::motion_utils::VirtualWallMarkerCreator creator;
+  wall.style = autoware::motion_utils::VirtualWallType::slowdown;
+  wall.ns = "ns_";
+  wall.text = "module";
+  wall.longitudinal_offset = 2.0;
+  const rclcpp::Time now(10, 0);
+  // the markers of the same namespace and type of wall are created from the same template
+  for (const auto x : {1.0, 5.0}) {
+    wall.pose.position.x = x;
+    wall.pose.orientation.z = std::sin(0.25);
+    wall.pose.orientation.w = std::cos(0.25);
+    wall.detail = std::to_string(x);
+    creator.add_virtual_wall(wall);
+    const auto markers = creator.create_markers(now);
+    const auto expected_markers = autoware::motion_utils::createSlowDownVirtualWallMarker(
+      wall.pose, wall.text + "(" + wall.detail + ")", now, 0, wall.longitudinal_offset, wall.ns);
+    ASSERT_EQ(markers.markers.size(), expected_markers.markers.size());
+    for (size_t i = 0; i < markers.markers.size(); ++i) {
+      const auto & marker = markers.markers.at(i);
+      const auto & expected_marker = expected_markers.markers.at(i);
+      EXPECT_EQ(marker.ns, expected_marker.ns);
+      EXPECT_EQ(marker.type, expected_marker.type);
+      EXPECT_EQ(marker.text, expected_marker.text);
+      EXPECT_EQ(rclcpp::Time(marker.header.stamp), now);
+      EXPECT_DOUBLE_EQ(marker.pose.position.x, expected_marker.pose.position.x);
+      EXPECT_DOUBLE_EQ(marker.pose.position.y, expected_marker.pose.position.y);
+      EXPECT_DOUBLE_EQ(marker.pose.position.z, expected_marker.pose.position.z);
+      EXPECT_DOUBLE_EQ(marker.pose.orientation.z, expected_marker.pose.orientation.z);
+      EXPECT_DOUBLE_EQ(marker.color.r, expected_marker.color.r);
+      EXPECT_DOUBLE_EQ(marker.scale.y, expected_marker.scale.y);
+    }
+  }
+}
 }  // namespace
@@ -16,6 +16,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 TEST(path_shift_test, calc_feasible_velocity_from_jerk)
 {
   using autoware::motion_utils::calc_feasible_velocity_from_jerk;
@@ -161,3 +163,36 @@ TEST(path_shift_test, calc_jerk_from_lat_lon_distance)
   EXPECT_DOUBLE_EQ(
     calc_jerk_from_lat_lon_distance(lateral_distance, longitudinal_distance, velocity), 0.16);
 }
+
+TEST(path_shift_test, batch_functions_match_scalar_functions)
+{
+  using autoware::motion_utils::calc_feasible_velocity_from_jerk;
+  using autoware::motion_utils::calc_jerk_from_lat_lon_distance;
+  using autoware::motion_utils::calc_lateral_dist_from_jerk;
+  using autoware::motion_utils::calc_longitudinal_dist_from_jerk;
+  using autoware::motion_utils::calc_shift_time_from_jerk;
+
+  const std::vector<double> values{0.0, 0.5, 1.0, -2.0, 5.0, 30.0, 100.0};
+  for (const double jerk : {0.0, 0.5, -2.0}) {
+    for (const double other : {0.0, 2.0, -4.0}) {
+      const auto velocities = calc_feasible_velocity_from_jerk(other, jerk, values);
+      const auto lateral_distances = calc_lateral_dist_from_jerk(other, jerk, values);
+      const auto longitudinal_distances = calc_longitudinal_dist_from_jerk(other, jerk, values);
+      const auto times = calc_shift_time_from_jerk(values, jerk, other);
+      const auto jerks = calc_jerk_from_lat_lon_distance(other, values, jerk);
+      ASSERT_EQ(velocities.size(), values.size());
+      ASSERT_EQ(lateral_distances.size(), values.size());
+      ASSERT_EQ(longitudinal_distances.size(), values.size());
+      ASSERT_EQ(times.size(), values.size());
+      ASSERT_EQ(jerks.size(), values.size());
+      for (size_t i = 0; i < values.size(); ++i) {
+        EXPECT_DOUBLE_EQ(velocities[i], calc_feasible_velocity_from_jerk(other, jerk, values[i]));
+        EXPECT_DOUBLE_EQ(lateral_distances[i], calc_lateral_dist_from_jerk(other, jerk, values[i]));
+        EXPECT_DOUBLE_EQ(
+          longitudinal_distances[i], calc_longitudinal_dist_from_jerk(other, jerk, values[i]));
+        EXPECT_DOUBLE_EQ(times[i], calc_shift_time_from_jerk(values[i], jerk, other));
+        EXPECT_DOUBLE_EQ(jerks[i], calc_jerk_from_lat_lon_distance(other, values[i], jerk));
+      }
+    }
+  }
+}
@@ -476,6 +476,52 @@ TEST(trajectory, findNearestSegmentIndex)
   EXPECT_EQ(findNearestSegmentIndex(sparse_points, create_point(9.0, 1.0, 0.0)), 0U);
 }
 
+TEST(trajectory, findNearestIndexWithHint)
+{
+  using autoware::motion_utils::findNearestIndexWithHint;
+  using autoware::motion_utils::findNearestSegmentIndexWithHint;
+
+  const auto traj = generateTestTrajectory<Trajectory>(10, 1.0);
+
+  // Empty
+  EXPECT_FALSE(findNearestIndexWithHint(Trajectory{}.points, geometry_msgs::msg::Pose{}, 0));
+
+  // Search forward and backward from the hint
+  EXPECT_EQ(
+    *findNearestIndexWithHint(traj.points, createPose(7.1, 0.3, 0.0, 0.0, 0.0, 0.0), 0), 7U);
+  EXPECT_EQ(
+    *findNearestIndexWithHint(traj.points, createPose(1.9, 0.3, 0.0, 0.0, 0.0, 0.0), 8), 2U);
+
+  // Hint out of the points
+  EXPECT_EQ(
+    *findNearestIndexWithHint(traj.points, createPose(4.2, 0.0, 0.0, 0.0, 0.0, 0.0), 100), 4U);
+
+  // Segment index
+  EXPECT_EQ(
+    *findNearestSegmentIndexWithHint(traj.points, createPose(4.2, 0.0, 0.0, 0.0, 0.0, 0.0), 0), 4U);
+  EXPECT_EQ(
+    *findNearestSegmentIndexWithHint(traj.points, createPose(9.2, 0.0, 0.0, 0.0, 0.0, 0.0), 0), 8U);
+
+  // Trajectory going back along itself
+  auto u_turn_traj = traj;
+  for (size_t i = 0; i < 10; ++i) {
+    auto p = traj.points.at(9 - i);
+    p.pose = createPose(9.0 - static_cast<double>(i), 1.0, 0.0, 0.0, 0.0, M_PI);
+    u_turn_traj.points.push_back(p);
+  }
+  const auto pose = createPose(3.0, 0.6, 0.0, 0.0, 0.0, 0.0);
+  const auto max_d = std::numeric_limits<double>::max();
+
+  // the local minimum from the hint is kept even if the other side of the trajectory is nearer
+  EXPECT_EQ(*findNearestIndexWithHint(u_turn_traj.points, pose, 2), 3U);
+  EXPECT_EQ(*findNearestIndexWithHint(u_turn_traj.points, pose, 15), 16U);
+
+  // the whole points are searched when the local minimum is out of the thresholds
+  EXPECT_EQ(*findNearestIndexWithHint(u_turn_traj.points, pose, 2, 0.5), 16U);
+  EXPECT_EQ(*findNearestIndexWithHint(u_turn_traj.points, pose, 15, max_d, 1.0), 3U);
+  EXPECT_FALSE(findNearestIndexWithHint(u_turn_traj.points, pose, 2, 0.3));
+}
+
 TEST(trajectory, calcLongitudinalOffsetToSegment_StraightTrajectory)
 {
   using autoware::motion_utils::calcLongitudinalOffsetToSegment;
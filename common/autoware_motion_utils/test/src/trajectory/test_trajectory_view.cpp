@@ -0,0 +1,148 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/motion_utils/trajectory/trajectory.hpp"
+#include "autoware/motion_utils/trajectory/trajectory_view.hpp"
+
+#include <autoware_utils_geometry/geometry.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+using autoware::motion_utils::TrajectoryView;
+using autoware_planning_msgs::msg::TrajectoryPoint;
+using TrajectoryPointArray = std::vector<TrajectoryPoint>;
+using autoware_utils_geometry::create_point;
+using autoware_utils_geometry::create_quaternion_from_yaw;
+
+constexpr double epsilon = 1e-6;
+
+TrajectoryPointArray generateTestTrajectoryPointArray(
+  const size_t num_points, const double point_interval, const double delta_theta)
+{
+  TrajectoryPointArray traj;
+  double x = 0.0;
+  double y = 0.0;
+  for (size_t i = 0; i < num_points; ++i) {
+    const double theta = static_cast<double>(i) * delta_theta;
+    TrajectoryPoint p;
+    p.pose.position = create_point(x, y, 0.0);
+    p.pose.orientation = create_quaternion_from_yaw(theta);
+    traj.push_back(p);
+    x += point_interval * std::cos(theta);
+    y += point_interval * std::sin(theta);
+  }
+  return traj;
+}
+}  // namespace
+
+TEST(trajectory_view, sameResultsAsPoints)
+{
+  using autoware::motion_utils::calcLateralOffset;
+  using autoware::motion_utils::calcLongitudinalOffsetToSegment;
+  using autoware::motion_utils::calcSignedArcLength;
+  using autoware::motion_utils::findNearestIndex;
+  using autoware::motion_utils::findNearestSegmentIndex;
+
+  const auto traj = generateTestTrajectoryPointArray(100, 1.0, 0.02);
+  const TrajectoryView view(traj);
+
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<double> dist_x(-5.0, 80.0);
+  std::uniform_real_distribution<double> dist_y(-5.0, 60.0);
+  std::uniform_real_distribution<double> dist_yaw(-M_PI, M_PI);
+  for (size_t i = 0; i < 100; ++i) {
+    const auto p_src = create_point(dist_x(engine), dist_y(engine), 0.0);
+    const auto p_dst = create_point(dist_x(engine), dist_y(engine), 0.0);
+    const size_t idx = i % traj.size();
+
+    EXPECT_EQ(findNearestIndex(view, p_src), findNearestIndex(traj, p_src));
+    EXPECT_EQ(findNearestSegmentIndex(view, p_src), findNearestSegmentIndex(traj, p_src));
+
+    geometry_msgs::msg::Pose pose;
+    pose.position = p_src;
+    pose.orientation = create_quaternion_from_yaw(dist_yaw(engine));
+    EXPECT_EQ(
+      findNearestIndex(view, pose, 10.0, M_PI_2), findNearestIndex(traj, pose, 10.0, M_PI_2));
+    EXPECT_EQ(
+      findNearestSegmentIndex(view, pose, 10.0, M_PI_2),
+      findNearestSegmentIndex(traj, pose, 10.0, M_PI_2));
+
+    const size_t seg_idx = idx == traj.size() - 1 ? idx - 1 : idx;
+    EXPECT_NEAR(
+      calcLongitudinalOffsetToSegment(view, seg_idx, p_src),
+      calcLongitudinalOffsetToSegment(traj, seg_idx, p_src), epsilon);
+    EXPECT_NEAR(
+      calcLateralOffset(view, p_src, seg_idx), calcLateralOffset(traj, p_src, seg_idx), epsilon);
+    EXPECT_NEAR(calcLateralOffset(view, p_src), calcLateralOffset(traj, p_src), epsilon);
+
+    EXPECT_NEAR(calcSignedArcLength(view, idx, 50), calcSignedArcLength(traj, idx, 50), epsilon);
+    EXPECT_NEAR(
+      calcSignedArcLength(view, p_src, idx), calcSignedArcLength(traj, p_src, idx), epsilon);
+    EXPECT_NEAR(
+      calcSignedArcLength(view, idx, p_dst), calcSignedArcLength(traj, idx, p_dst), epsilon);
+    EXPECT_NEAR(
+      calcSignedArcLength(view, p_src, p_dst), calcSignedArcLength(traj, p_src, p_dst), epsilon);
+  }
+}
+
+TEST(trajectory_view, overlappingPoints)
+{
+  using autoware::motion_utils::calcLateralOffset;
+  using autoware::motion_utils::calcLongitudinalOffsetToSegment;
+  using autoware::motion_utils::calcSignedArcLength;
+
+  // the point 2 overlaps with the point 1, and the last points overlap
+  auto traj = generateTestTrajectoryPointArray(6, 1.0, 0.0);
+  traj.at(2).pose.position = traj.at(1).pose.position;
+  traj.at(5).pose.position = traj.at(4).pose.position;
+  const TrajectoryView view(traj);
+
+  const auto p_target = create_point(1.5, 1.0, 0.0);
+  EXPECT_NEAR(
+    calcLongitudinalOffsetToSegment(view, 1, p_target),
+    calcLongitudinalOffsetToSegment(traj, 1, p_target), epsilon);
+  EXPECT_NEAR(calcLateralOffset(view, p_target, 1), 1.0, epsilon);
+  EXPECT_NEAR(calcLateralOffset(view, p_target, 4), 1.0, epsilon);
+  EXPECT_NEAR(calcSignedArcLength(view, 0, 5), calcSignedArcLength(traj, 0, 5), epsilon);
+
+  EXPECT_TRUE(std::isnan(calcLongitudinalOffsetToSegment(view, 4, p_target)));
+  EXPECT_THROW(calcLongitudinalOffsetToSegment(view, 4, p_target, true), std::runtime_error);
+  EXPECT_THROW(calcLongitudinalOffsetToSegment(view, 5, p_target, true), std::out_of_range);
+
+  // all the points overlap
+  const TrajectoryPointArray same_points(3, traj.front());
+  const TrajectoryView same_points_view(same_points);
+  EXPECT_TRUE(std::isnan(calcLateralOffset(same_points_view, p_target)));
+  EXPECT_THROW(calcLateralOffset(same_points_view, p_target, true), std::runtime_error);
+}
+
+TEST(trajectory_view, emptyPoints)
+{
+  using autoware::motion_utils::calcSignedArcLength;
+  using autoware::motion_utils::findNearestIndex;
+
+  const TrajectoryPointArray traj;
+  const TrajectoryView view(traj);
+  EXPECT_THROW(findNearestIndex(view, create_point(0.0, 0.0, 0.0)), std::invalid_argument);
+  EXPECT_EQ(findNearestIndex(view, geometry_msgs::msg::Pose{}), std::nullopt);
+  EXPECT_DOUBLE_EQ(calcSignedArcLength(view, 0, 0), 0.0);
+}
@@ -34,6 +34,7 @@ constexpr double STOP_DURATION_THRESHOLD_1000_MS = 1.0;
 
 using autoware::motion_utils::VehicleArrivalChecker;
 using autoware::motion_utils::VehicleStopChecker;
+using autoware::motion_utils::VehicleStopHistory;
 using autoware_utils_geometry::create_point;
 using autoware_utils_geometry::create_quaternion;
 using autoware_utils_geometry::create_translation;
@@ -158,6 +159,46 @@ public:
   }
 };
 
+TEST(vehicle_stop_history, getStopStartStamp)
+{
+  const auto to_time = [](const double t) { return rclcpp::Time(static_cast<int64_t>(t * 1e9)); };
+  VehicleStopHistory history(1.0, 4);
+  EXPECT_FALSE(history.getStopStartStamp());
+
+  // the vehicle stops at 0.2
+  history.addStopState(to_time(0.0), false, to_time(0.0));
+  history.addStopState(to_time(0.1), false, to_time(0.1));
+  EXPECT_FALSE(history.getStopStartStamp());
+  history.addStopState(to_time(0.2), true, to_time(0.2));
+  history.addStopState(to_time(0.3), true, to_time(0.3));
+  EXPECT_EQ(*history.getStopStartStamp(), to_time(0.2));
+  EXPECT_EQ(*history.getOldestStamp(), to_time(0.0));
+
+  // the capacity is exceeded
+  history.addStopState(to_time(0.4), true, to_time(0.4));
+  EXPECT_EQ(*history.getOldestStamp(), to_time(0.1));
+  EXPECT_EQ(*history.getStopStartStamp(), to_time(0.2));
+  history.addStopState(to_time(0.5), true, to_time(0.5));
+  history.addStopState(to_time(0.6), true, to_time(0.6));
+  EXPECT_EQ(*history.getOldestStamp(), to_time(0.3));
+  EXPECT_EQ(*history.getStopStartStamp(), to_time(0.3));
+
+  // the stop states older than the buffer duration are removed
+  history.addStopState(to_time(1.45), true, to_time(1.45));
+  EXPECT_EQ(*history.getOldestStamp(), to_time(0.5));
+  EXPECT_EQ(*history.getStopStartStamp(), to_time(0.5));
+
+  // the vehicle moves
+  history.addStopState(to_time(1.5), false, to_time(1.5));
+  EXPECT_FALSE(history.getStopStartStamp());
+  history.addStopState(to_time(1.6), true, to_time(1.6));
+  EXPECT_EQ(*history.getStopStartStamp(), to_time(1.6));
+
+  history.clear();
+  EXPECT_TRUE(history.empty());
+  EXPECT_FALSE(history.getStopStartStamp());
+}
+
 TEST(vehicle_stop_checker, isVehicleStopped)
 {
   {
@@ -0,0 +1,140 @@
+// Copyright 2025 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__NODE__DEADLINE_MONITOR_HPP_
+#define AUTOWARE__NODE__DEADLINE_MONITOR_HPP_
+
+#include "autoware/node/visibility_control.hpp"
+
+#include <rclcpp/node.hpp>
+
+#include <builtin_interfaces/msg/time.hpp>
+#include <diagnostic_msgs/msg/diagnostic_array.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+
+namespace autoware::node
+{
+/// @brief expected timing of a callback
+struct CallbackDeadline
+{
+  /// expected period between the starts of the callback, zero when it is not periodic
+  std::chrono::nanoseconds period{0};
+  /// maximum execution time of the callback
+  std::chrono::nanoseconds budget{0};
+  /// when set, a message older than this age is dropped by is_stale() instead of being processed
+  std::optional<std::chrono::nanoseconds> max_message_age{};
+};
+
+/**
+ * @brief Counts the deadline overruns of the callbacks of a node and reports them on /diagnostics.
+ * @details A callback measured with a ScopedCallback overruns when it runs longer than its
+ * budget, and misses its period when it starts later than the period after its previous start.
+ * The counts, the longest duration and the last overrun of each callback are reported with the
+ * callback name every report period, with the WARN level when an overrun happened in it.
+ */
+class DeadlineMonitor
+{
+  struct Callback;
+
+public:
+  /// @brief handle of a registered callback, valid as long as the monitor
+  using CallbackId = Callback *;
+
+  /// @brief measures one execution of a callback from the construction to the destruction
+  class ScopedCallback
+  {
+  public:
+    AUTOWARE_NODE_PUBLIC
+    explicit ScopedCallback(const CallbackId id);
+    ScopedCallback(const ScopedCallback &) = delete;
+    ScopedCallback & operator=(const ScopedCallback &) = delete;
+    AUTOWARE_NODE_PUBLIC
+    ~ScopedCallback();
+
+  private:
+    CallbackId id_;
+    std::chrono::steady_clock::time_point start_;
+  };
+
+  AUTOWARE_NODE_PUBLIC
+  DeadlineMonitor(rclcpp::Node * node, const std::chrono::nanoseconds & report_period);
+
+  /// @brief register a callback, it should be done once, e.g. in the constructor of the node
+  /// @details the id of the same name is returned if it exists, with its first deadline
+  AUTOWARE_NODE_PUBLIC
+  CallbackId register_callback(const std::string & name, const CallbackDeadline & deadline);
+
+  ScopedCallback scoped_callback(const CallbackId id) { return ScopedCallback(id); }
+
+  /// @brief whether the message of the given stamp is older than the maximum message age of the
+  /// callback, a stale message is counted as dropped
+  AUTOWARE_NODE_PUBLIC
+  bool is_stale(const CallbackId id, const builtin_interfaces::msg::Time & stamp);
+
+  /// @brief counts of a callback since the last report
+  struct Counts
+  {
+    uint64_t execution_num{0};
+    uint64_t overrun_num{0};
+    uint64_t missed_period_num{0};
+    uint64_t dropped_message_num{0};
+    int64_t max_duration_ns{0};
+    int64_t last_overrun_duration_ns{0};
+  };
+
+  /// @brief counts of a callback, they are reset when reset is true
+  AUTOWARE_NODE_PUBLIC
+  Counts get_counts(const CallbackId id, const bool reset);
+
+private:
+  struct Callback
+  {
+    Callback(std::string callback_name, const CallbackDeadline & callback_deadline)
+    : name(std::move(callback_name)), deadline(callback_deadline)
+    {
+    }
+
+    std::string name;
+    CallbackDeadline deadline;
+    std::atomic<int64_t> last_start_ns{0};
+    std::atomic<uint64_t> execution_num{0};
+    std::atomic<uint64_t> overrun_num{0};
+    std::atomic<uint64_t> missed_period_num{0};
+    std::atomic<uint64_t> dropped_message_num{0};
+    std::atomic<int64_t> max_duration_ns{0};
+    std::atomic<int64_t> last_overrun_duration_ns{0};
+  };
+
+  void report();
+
+  std::string node_name_;
+  rclcpp::Clock::SharedPtr clock_;
+  rclcpp::Logger logger_;
+  // NOTE: a deque keeps the addresses of the callbacks when new ones are registered
+  std::deque<Callback> callbacks_;
+  std::mutex callbacks_mutex_;
+  rclcpp::Publisher<diagnostic_msgs::msg::DiagnosticArray>::SharedPtr pub_diagnostics_;
+  rclcpp::TimerBase::SharedPtr timer_;
+};
+}  // namespace autoware::node
+
+#endif  // AUTOWARE__NODE__DEADLINE_MONITOR_HPP_
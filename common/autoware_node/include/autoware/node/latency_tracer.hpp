@@ -0,0 +1,138 @@
+// Copyright 2025 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__NODE__LATENCY_TRACER_HPP_
+#define AUTOWARE__NODE__LATENCY_TRACER_HPP_
+
+#include "autoware/node/visibility_control.hpp"
+
+#include <rclcpp/node.hpp>
+
+#include <diagnostic_msgs/msg/diagnostic_array.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace autoware::node
+{
+/// @brief latency histogram of a span, the bucket i counts the durations in [2^(i-1), 2^i) us
+/// and the bucket 0 the durations under 1 us
+struct SpanStatistics
+{
+  static constexpr size_t bucket_num = 24;
+
+  std::string name;
+  uint64_t count{0};
+  int64_t sum_ns{0};
+  int64_t max_ns{0};
+  std::array<uint64_t, bucket_num> buckets{};
+
+  /// @brief upper bound in ms of the bucket holding the given quantile, 0 when nothing is recorded
+  AUTOWARE_NODE_PUBLIC
+  double quantile_upper_bound_ms(const double quantile) const;
+};
+
+/**
+ * @brief Named latency spans of a node.
+ * @details The spans are registered once and their durations are recorded with a lock-free
+ * histogram, so that they can be measured in the hot path of any callback group. The histograms
+ * of all the spans are published together on ~/debug/latency_histogram every period and reset.
+ * When built with LTTng-UST, the end of every span also emits an lttng_ust_tracef:event, which is
+ * recorded in the same session as the ros2_tracing events when it is enabled.
+ */
+class LatencyTracer
+{
+  struct Span;
+
+public:
+  /// @brief handle of a registered span, valid as long as the tracer
+  using SpanId = Span *;
+
+  /// @brief measures the duration from the construction to the destruction or to stop()
+  class ScopedSpan
+  {
+  public:
+    ScopedSpan(LatencyTracer & tracer, const SpanId id);
+    ScopedSpan(const ScopedSpan &) = delete;
+    ScopedSpan & operator=(const ScopedSpan &) = delete;
+    ~ScopedSpan() { stop(); }
+
+    AUTOWARE_NODE_PUBLIC
+    void stop();
+
+  private:
+    LatencyTracer * tracer_;
+    SpanId id_;
+    std::chrono::steady_clock::time_point start_;
+  };
+
+  AUTOWARE_NODE_PUBLIC
+  explicit LatencyTracer(rclcpp::Node * node, const std::chrono::nanoseconds & publish_period);
+
+  /// @brief register a span and return its id, the id of the same name is returned if it exists
+  /// @details the ids should be registered once, e.g. in the constructor of the node
+  AUTOWARE_NODE_PUBLIC
+  SpanId register_span(const std::string & name);
+
+  ScopedSpan scoped_span(const SpanId id) { return ScopedSpan(*this, id); }
+
+  /// @brief record a span measured by the caller, e.g. from a message stamp
+  AUTOWARE_NODE_PUBLIC
+  void record(const SpanId id, const std::chrono::nanoseconds & duration);
+
+  /// @brief histograms of all the spans since the last reset
+  AUTOWARE_NODE_PUBLIC
+  std::vector<SpanStatistics> collect_statistics(const bool reset);
+
+private:
+  struct Span
+  {
+    explicit Span(std::string span_name) : name(std::move(span_name)) {}
+
+    void add(const int64_t duration_ns);
+
+    std::string name;
+    std::atomic<uint64_t> count{0};
+    std::atomic<int64_t> sum_ns{0};
+    std::atomic<int64_t> max_ns{0};
+    std::array<std::atomic<uint64_t>, SpanStatistics::bucket_num> buckets{};
+  };
+
+  void publish_statistics();
+
+  std::string node_name_;
+  rclcpp::Clock::SharedPtr clock_;
+  // NOTE: a deque keeps the addresses of the spans when new ones are registered, so that the
+  // recording through the ids does not need the lock
+  std::deque<Span> spans_;
+  std::mutex spans_mutex_;
+  rclcpp::Publisher<diagnostic_msgs::msg::DiagnosticArray>::SharedPtr pub_histogram_;
+  rclcpp::TimerBase::SharedPtr timer_;
+};
+
+inline LatencyTracer::ScopedSpan::ScopedSpan(LatencyTracer & tracer, const SpanId id)
+: tracer_(&tracer), id_(id), start_(std::chrono::steady_clock::now())
+{
+}
+}  // namespace autoware::node
+
+#endif  // AUTOWARE__NODE__LATENCY_TRACER_HPP_
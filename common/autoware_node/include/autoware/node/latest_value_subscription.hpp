@@ -0,0 +1,84 @@
+// Copyright 2025 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__NODE__LATEST_VALUE_SUBSCRIPTION_HPP_
+#define AUTOWARE__NODE__LATEST_VALUE_SUBSCRIPTION_HPP_
+
+#include <rclcpp/node.hpp>
+#include <rclcpp/qos.hpp>
+#include <rclcpp/subscription_options.hpp>
+
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace autoware::node
+{
+/**
+ * @brief Slot holding the latest value written by one thread and read by others.
+ * @details The value is swapped as a shared pointer, so a reader keeps the value it loaded alive
+ * while the writer stores a newer one, and the value itself is never copied.
+ */
+template <typename T>
+class LatestValueSlot
+{
+public:
+  using ConstSharedPtr = std::shared_ptr<const T>;
+
+  void store(ConstSharedPtr value) noexcept
+  {
+    std::atomic_store_explicit(&value_, std::move(value), std::memory_order_release);
+  }
+
+  /// @brief latest stored value, nullptr if nothing was stored yet
+  ConstSharedPtr load() const noexcept
+  {
+    return std::atomic_load_explicit(&value_, std::memory_order_acquire);
+  }
+
+private:
+  ConstSharedPtr value_;
+};
+
+/**
+ * @brief Subscription keeping only the latest message, as a replacement of the polling
+ * subscribers for the inputs read at the start of a processing cycle.
+ * @details The message given to the callback is stored as is. With the intra-process
+ * communication the reader gets the pointer published by the upstream node, and otherwise the
+ * message deserialized by rclcpp, without a copy into the node in both cases.
+ */
+template <typename MessageT>
+class LatestValueSubscription
+{
+public:
+  using ConstSharedPtr = typename LatestValueSlot<MessageT>::ConstSharedPtr;
+
+  LatestValueSubscription(
+    rclcpp::Node * node, const std::string & topic_name, const rclcpp::QoS & qos = rclcpp::QoS{1},
+    const rclcpp::SubscriptionOptions & options = rclcpp::SubscriptionOptions())
+  {
+    subscription_ = node->create_subscription<MessageT>(
+      topic_name, qos, [this](ConstSharedPtr msg) { slot_.store(std::move(msg)); }, options);
+  }
+
+  /// @brief latest received message, nullptr if no message was received yet
+  ConstSharedPtr take_data() const { return slot_.load(); }
+
+private:
+  LatestValueSlot<MessageT> slot_;
+  typename rclcpp::Subscription<MessageT>::SharedPtr subscription_;
+};
+}  // namespace autoware::node
+
+#endif  // AUTOWARE__NODE__LATEST_VALUE_SUBSCRIPTION_HPP_
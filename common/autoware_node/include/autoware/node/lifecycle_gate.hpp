@@ -0,0 +1,100 @@
+// Copyright 2025 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__NODE__LIFECYCLE_GATE_HPP_
+#define AUTOWARE__NODE__LIFECYCLE_GATE_HPP_
+
+#include "autoware/node/startup_timeline.hpp"
+#include "autoware/node/visibility_control.hpp"
+
+#include <rclcpp/node.hpp>
+
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace autoware::node
+{
+enum class LifecycleState { UNCONFIGURED, CONFIGURED, ACTIVE };
+
+struct LifecycleCallbacks
+{
+  /// @brief heavy precomputation, e.g. map indices, solver workspaces or lookup tables
+  std::function<void()> on_configure;
+  /// @brief called once configured and all the declared inputs are received, e.g. to start timers
+  std::function<void()> on_activate;
+};
+
+/**
+ * @brief Configure and activate phases of a node, without the managed node interface.
+ * @details The configuration runs once in the executor right after the construction, so that the
+ * constructor only declares the parameters and the interfaces. The node is activated once it is
+ * configured and every declared input has been received, so that its first cycle runs with warm
+ * caches and valid inputs. The processing callbacks return early while is_active() is false.
+ */
+class LifecycleGate
+{
+  struct Input;
+
+public:
+  /// @brief handle of a declared input, valid as long as the gate
+  using InputId = Input *;
+
+  /// @brief the timeline, if given, marks the configure phase and gets ready at the activation
+  AUTOWARE_NODE_PUBLIC
+  LifecycleGate(
+    rclcpp::Node * node, LifecycleCallbacks callbacks, StartupTimeline * timeline = nullptr);
+
+  /// @brief declare an input required for the activation, in the constructor of the node
+  AUTOWARE_NODE_PUBLIC
+  InputId declare_input(const std::string & name);
+
+  /// @brief notify that an input is received, e.g. from its subscription callback
+  AUTOWARE_NODE_PUBLIC
+  void notify_input(const InputId id);
+
+  AUTOWARE_NODE_PUBLIC
+  LifecycleState get_state() const;
+
+  bool is_active() const { return get_state() == LifecycleState::ACTIVE; }
+
+  /// @brief the declared inputs which have not been received yet
+  AUTOWARE_NODE_PUBLIC
+  std::vector<std::string> get_missing_inputs() const;
+
+private:
+  struct Input
+  {
+    std::string name;
+    bool is_received{false};
+  };
+
+  void configure();
+  void try_activate(std::unique_lock<std::mutex> & lock);
+
+  rclcpp::Logger logger_;
+  LifecycleCallbacks callbacks_;
+  StartupTimeline * timeline_;
+  // NOTE: a deque keeps the addresses of the inputs when new ones are declared
+  std::deque<Input> inputs_;
+  LifecycleState state_{LifecycleState::UNCONFIGURED};
+  bool is_activating_{false};
+  mutable std::mutex mutex_;
+  rclcpp::TimerBase::SharedPtr configure_timer_;
+};
+}  // namespace autoware::node
+
+#endif  // AUTOWARE__NODE__LIFECYCLE_GATE_HPP_
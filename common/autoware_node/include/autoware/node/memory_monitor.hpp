@@ -0,0 +1,113 @@
+// Copyright 2025 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__NODE__MEMORY_MONITOR_HPP_
+#define AUTOWARE__NODE__MEMORY_MONITOR_HPP_
+
+#include "autoware/node/visibility_control.hpp"
+
+#include <rclcpp/node.hpp>
+
+#include <diagnostic_msgs/msg/diagnostic_array.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace autoware::node
+{
+/// @brief allocations through the global operator new of the process, counted by the
+/// autoware_node_allocation_hook library
+struct AllocationCounts
+{
+  uint64_t allocation_num{0};
+  uint64_t allocated_bytes{0};
+  uint64_t deallocation_num{0};
+};
+
+/// @brief counts of the allocation hook since the start of the process, zero when it is not loaded
+AUTOWARE_NODE_PUBLIC
+AllocationCounts get_allocation_counts();
+
+/// @brief whether the allocation hook replaces the global operator new of the process
+AUTOWARE_NODE_PUBLIC
+bool is_allocation_hook_loaded();
+
+/**
+ * @brief Reports the memory held by the owners registered by a node, e.g. its maps or its
+ * solver workspaces, and the memory and the allocation rate of the process, on /diagnostics.
+ * @details An owner gives an estimate of its memory in bytes, which is evaluated on the report
+ * timer, so it has to be safe to call from the callback group of the timer. The resident set size
+ * and the allocations are those of the process, which the nodes of a container share. The
+ * allocation rate is only reported when the process is linked with or preloads the
+ * autoware_node_allocation_hook library.
+ */
+class MemoryMonitor
+{
+  struct Owner;
+
+public:
+  /// @brief estimate of the memory of an owner [bytes]
+  using Estimate = std::function<size_t()>;
+  /// @brief handle of a registered owner, valid until it is unregistered
+  using OwnerId = Owner *;
+
+  AUTOWARE_NODE_PUBLIC
+  MemoryMonitor(rclcpp::Node * node, const std::chrono::nanoseconds & report_period);
+
+  /// @brief register an owner, the estimate of the same name is replaced if it exists
+  AUTOWARE_NODE_PUBLIC
+  OwnerId register_owner(const std::string & name, Estimate estimate);
+
+  /// @brief unregister an owner, e.g. before it is destroyed
+  AUTOWARE_NODE_PUBLIC
+  void unregister_owner(const OwnerId id);
+
+  /// @brief memory of the registered owners [bytes], in the order of their registration
+  AUTOWARE_NODE_PUBLIC
+  std::vector<std::pair<std::string, size_t>> get_owner_usage();
+
+  /// @brief resident set size of the process [bytes], nullopt when it cannot be read
+  AUTOWARE_NODE_PUBLIC
+  static std::optional<size_t> get_process_rss_bytes();
+
+private:
+  struct Owner
+  {
+    std::string name;
+    Estimate estimate;
+  };
+
+  void report();
+
+  std::string node_name_;
+  rclcpp::Clock::SharedPtr clock_;
+  // NOTE: a list keeps the addresses of the owners when others are registered or unregistered
+  std::list<Owner> owners_;
+  std::mutex owners_mutex_;
+  AllocationCounts last_allocation_counts_;
+  std::chrono::steady_clock::time_point last_report_time_;
+  rclcpp::Publisher<diagnostic_msgs::msg::DiagnosticArray>::SharedPtr pub_diagnostics_;
+  rclcpp::TimerBase::SharedPtr timer_;
+};
+}  // namespace autoware::node
+
+#endif  // AUTOWARE__NODE__MEMORY_MONITOR_HPP_
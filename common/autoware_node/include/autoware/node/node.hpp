@@ -15,10 +15,17 @@
 #ifndef AUTOWARE__NODE__NODE_HPP_
 #define AUTOWARE__NODE__NODE_HPP_
 
+#include "autoware/node/deadline_monitor.hpp"
+#include "autoware/node/lifecycle_gate.hpp"
+#include "autoware/node/memory_monitor.hpp"
+#include "autoware/node/realtime_configurator.hpp"
+#include "autoware/node/startup_timeline.hpp"
 #include "autoware/node/visibility_control.hpp"
 
 #include <rclcpp/node.hpp>
 
+#include <chrono>
+#include <memory>
 #include <string>
 
 namespace autoware::node
@@ -30,6 +37,46 @@ public:
   explicit Node(
     const std::string & node_name, const std::string & ns = "",
     const rclcpp::NodeOptions & options = rclcpp::NodeOptions());
+
+  /// @brief the startup timeline which starts at the construction of the node
+  /// @details the node calls startup_timeline().mark_ready() once it can serve its outputs
+  StartupTimeline & startup_timeline() { return startup_timeline_; }
+
+  /// @brief opt in the deadline monitor of the callbacks, which reports every report period
+  /// @details calling it again returns the same monitor
+  AUTOWARE_NODE_PUBLIC
+  DeadlineMonitor & enable_deadline_monitor(
+    const std::chrono::nanoseconds & report_period = std::chrono::seconds(1));
+
+  /// @brief the deadline monitor, nullptr when it is not enabled
+  DeadlineMonitor * deadline_monitor() const { return deadline_monitor_.get(); }
+
+  /// @brief opt in the memory monitor of the node, which reports every report period
+  /// @details calling it again returns the same monitor
+  AUTOWARE_NODE_PUBLIC
+  MemoryMonitor & enable_memory_monitor(
+    const std::chrono::nanoseconds & report_period = std::chrono::seconds(1));
+
+  /// @brief the memory monitor, nullptr when it is not enabled
+  MemoryMonitor * memory_monitor() const { return memory_monitor_.get(); }
+
+  /// @brief opt in the configure and activate phases, whose timeline is the one of the node
+  /// @details calling it again returns the same gate and ignores the callbacks
+  AUTOWARE_NODE_PUBLIC
+  LifecycleGate & enable_lifecycle(LifecycleCallbacks callbacks);
+
+  /// @brief the lifecycle gate, nullptr when it is not enabled
+  LifecycleGate * lifecycle_gate() const { return lifecycle_gate_.get(); }
+
+  /// @brief the realtime.* parameters of the node, applied to the thread which spins it
+  const RealtimeConfigurator & realtime_configurator() const { return realtime_configurator_; }
+
+private:
+  StartupTimeline startup_timeline_;
+  RealtimeConfigurator realtime_configurator_;
+  std::unique_ptr<DeadlineMonitor> deadline_monitor_;
+  std::unique_ptr<MemoryMonitor> memory_monitor_;
+  std::unique_ptr<LifecycleGate> lifecycle_gate_;
 };
 }  // namespace autoware::node
 
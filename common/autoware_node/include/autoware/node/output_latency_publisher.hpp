@@ -0,0 +1,78 @@
+// Copyright 2025 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__NODE__OUTPUT_LATENCY_PUBLISHER_HPP_
+#define AUTOWARE__NODE__OUTPUT_LATENCY_PUBLISHER_HPP_
+
+#include "autoware/node/visibility_control.hpp"
+
+#include <rclcpp/node.hpp>
+#include <rclcpp/time.hpp>
+
+#include <autoware_internal_debug_msgs/msg/float64_stamped.hpp>
+#include <builtin_interfaces/msg/time.hpp>
+
+#include <chrono>
+#include <optional>
+#include <string>
+
+namespace autoware::node
+{
+/**
+ * @brief Age of the inputs of an output and the latency accumulated up to its publication.
+ * @details The inputs are given by their header stamps, which the upstream stages keep from the
+ * sensor data, so the age of the oldest input already includes the upstream latency. The time
+ * spent in the stage is added on the monotonic clock. For an output "trajectory", the values are
+ * published on ~/debug/trajectory/oldest_input_age_ms and ~/debug/trajectory/pipeline_latency_ms.
+ */
+class OutputLatencyPublisher
+{
+public:
+  AUTOWARE_NODE_PUBLIC
+  OutputLatencyPublisher(rclcpp::Node * node, const std::string & output_name);
+
+  /// @brief start the processing of an output, the inputs of the previous one are cleared
+  AUTOWARE_NODE_PUBLIC
+  void begin();
+
+  /// @brief add an input of the output by its header stamp, a zero stamp is ignored
+  AUTOWARE_NODE_PUBLIC
+  void add_input(const builtin_interfaces::msg::Time & stamp);
+
+  /// @brief publish the latencies when the output is published, nothing is published without input
+  AUTOWARE_NODE_PUBLIC
+  void publish();
+
+  /// @brief age of the oldest input at the begin of the processing
+  std::optional<double> oldest_input_age_ms() const { return oldest_input_age_ms_; }
+
+  /// @brief age of the oldest input plus the time spent in the stage, as of the last publish()
+  std::optional<double> pipeline_latency_ms() const { return pipeline_latency_ms_; }
+
+private:
+  rclcpp::Clock::SharedPtr clock_;
+  rclcpp::Publisher<autoware_internal_debug_msgs::msg::Float64Stamped>::SharedPtr
+    pub_oldest_input_age_;
+  rclcpp::Publisher<autoware_internal_debug_msgs::msg::Float64Stamped>::SharedPtr
+    pub_pipeline_latency_;
+
+  rclcpp::Time begin_time_;
+  std::chrono::steady_clock::time_point begin_steady_time_;
+  std::optional<rclcpp::Time> oldest_input_stamp_;
+  std::optional<double> oldest_input_age_ms_;
+  std::optional<double> pipeline_latency_ms_;
+};
+}  // namespace autoware::node
+
+#endif  // AUTOWARE__NODE__OUTPUT_LATENCY_PUBLISHER_HPP_
@@ -0,0 +1,84 @@
+// Copyright 2025 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__NODE__REALTIME_CONFIGURATOR_HPP_
+#define AUTOWARE__NODE__REALTIME_CONFIGURATOR_HPP_
+
+#include "autoware/node/visibility_control.hpp"
+
+#include <rclcpp/node.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace autoware::node
+{
+/// @brief scheduling and memory settings of the thread which spins a node, unchanged by default
+struct RealtimeSettings
+{
+  /// @brief CPUs the thread runs on, empty to keep the affinity of the process
+  std::vector<int64_t> cpu_affinity;
+  /// @brief SCHED_FIFO priority of the thread from 1 to 99, 0 to keep the default scheduling
+  int64_t sched_priority{0};
+  /// @brief lock the current and future pages of the process in memory with mlockall
+  bool lock_memory{false};
+  /// @brief size of the stack of the thread which is faulted in up front [bytes]
+  int64_t prefault_stack_bytes{0};
+
+  bool is_default() const
+  {
+    return cpu_affinity.empty() && sched_priority == 0 && !lock_memory &&
+           prefault_stack_bytes == 0;
+  }
+};
+
+/**
+ * @brief apply the settings to the calling thread, and the memory locking to the process
+ * @return the description of each setting which failed, e.g. without the permission, empty if
+ * all of them are applied
+ */
+AUTOWARE_NODE_PUBLIC
+std::vector<std::string> apply_realtime_settings(const RealtimeSettings & settings);
+
+/**
+ * @brief Applies the realtime.* parameters of a node to the thread which spins it.
+ * @details The parameters are declared in the constructor. The settings are applied once in the
+ * executor right after the construction, so that the thread is the one which runs the callbacks of
+ * the node, e.g. the executor thread of the node in a component_container_isolated. The threads
+ * created by the thread afterwards inherit its affinity and priority. The memory locking applies
+ * to the whole process, so to all the nodes of a container. A setting which fails, e.g. a
+ * SCHED_FIFO priority without the CAP_SYS_NICE capability or a large enough RLIMIT_RTPRIO, is
+ * reported as a warning and the node runs without it.
+ */
+class RealtimeConfigurator
+{
+public:
+  AUTOWARE_NODE_PUBLIC
+  explicit RealtimeConfigurator(rclcpp::Node * node);
+
+  const RealtimeSettings & settings() const { return settings_; }
+
+  /// @brief whether the settings have been applied, true for the default settings
+  bool is_applied() const { return is_applied_; }
+
+private:
+  RealtimeSettings settings_;
+  std::atomic<bool> is_applied_{false};
+  rclcpp::TimerBase::SharedPtr apply_timer_;
+};
+}  // namespace autoware::node
+
+#endif  // AUTOWARE__NODE__REALTIME_CONFIGURATOR_HPP_
@@ -0,0 +1,116 @@
+// Copyright 2025 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__NODE__STARTUP_TIMELINE_HPP_
+#define AUTOWARE__NODE__STARTUP_TIMELINE_HPP_
+
+#include "autoware/node/visibility_control.hpp"
+
+#include <rclcpp/node.hpp>
+
+#include <diagnostic_msgs/msg/diagnostic_array.hpp>
+
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace autoware::node
+{
+/// @brief transient local topic on which the nodes publish their timeline once they are ready
+constexpr const char * startup_timeline_topic = "/startup_timeline";
+
+/**
+ * @brief Startup phases of a node, from its construction to the moment it is ready, e.g. when its
+ * map is published or its graph is built.
+ * @details The phases are measured on the system clock, since the simulation clock may not run
+ * during the startup, so that the timelines of all the nodes can be put side by side. When the node
+ * is ready, its timeline is published once on /startup_timeline with the transient local
+ * durability, which also tells the dependent nodes that it is ready.
+ */
+class StartupTimeline
+{
+public:
+  struct Phase
+  {
+    std::string name;
+    std::chrono::system_clock::time_point end;
+  };
+
+  /// @brief starts the timeline, which should be constructed first in the node
+  AUTOWARE_NODE_PUBLIC
+  explicit StartupTimeline(rclcpp::Node * node);
+
+  /// @brief end the current phase, which started at the end of the previous one
+  AUTOWARE_NODE_PUBLIC
+  void mark_phase(const std::string & name);
+
+  /// @brief end the startup and publish the timeline, the calls after the first one are ignored
+  AUTOWARE_NODE_PUBLIC
+  void mark_ready();
+
+  AUTOWARE_NODE_PUBLIC
+  bool is_ready() const;
+
+  std::chrono::system_clock::time_point get_construction_time() const { return construction_; }
+
+  /// @brief the phases ended so far, the last one is "ready" when the node is ready
+  AUTOWARE_NODE_PUBLIC
+  std::vector<Phase> get_phases() const;
+
+private:
+  std::string node_name_;
+  std::chrono::system_clock::time_point construction_;
+  std::vector<Phase> phases_;
+  bool is_ready_{false};
+  mutable std::mutex mutex_;
+  rclcpp::Publisher<diagnostic_msgs::msg::DiagnosticArray>::SharedPtr pub_timeline_;
+};
+
+/**
+ * @brief Calls back once when all the given nodes have published their startup timeline, instead
+ * of waiting for them with a fixed sleep or a polling loop.
+ * @details The node names are the fully qualified ones, e.g. /map/lanelet2_map_loader. The
+ * callback is called from the subscription, in the callback group of the node, or from the
+ * constructor when no node is given.
+ */
+class ReadinessWaiter
+{
+public:
+  AUTOWARE_NODE_PUBLIC
+  ReadinessWaiter(
+    rclcpp::Node * node, const std::vector<std::string> & node_names,
+    std::function<void()> on_ready);
+
+  AUTOWARE_NODE_PUBLIC
+  bool is_ready() const;
+
+  /// @brief the nodes which are not ready yet
+  AUTOWARE_NODE_PUBLIC
+  std::vector<std::string> get_waiting_nodes() const;
+
+private:
+  void on_timeline(const diagnostic_msgs::msg::DiagnosticArray & msg);
+
+  std::set<std::string> waiting_nodes_;
+  std::function<void()> on_ready_;
+  bool is_ready_{false};
+  mutable std::mutex mutex_;
+  rclcpp::Subscription<diagnostic_msgs::msg::DiagnosticArray>::SharedPtr sub_timeline_;
+};
+}  // namespace autoware::node
+
+#endif  // AUTOWARE__NODE__STARTUP_TIMELINE_HPP_
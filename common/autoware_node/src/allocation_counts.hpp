@@ -0,0 +1,33 @@
+// Copyright 2025 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ALLOCATION_COUNTS_HPP_
+#define ALLOCATION_COUNTS_HPP_
+
+#include "autoware/node/visibility_control.hpp"
+
+#include <cstddef>
+
+namespace autoware::node::detail
+{
+// called by the global operator new and delete of autoware_node_allocation_hook, they must not
+// allocate
+AUTOWARE_NODE_PUBLIC
+void count_allocation(const size_t size) noexcept;
+
+AUTOWARE_NODE_PUBLIC
+void count_deallocation() noexcept;
+}  // namespace autoware::node::detail
+
+#endif  // ALLOCATION_COUNTS_HPP_
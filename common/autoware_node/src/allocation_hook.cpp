@@ -0,0 +1,134 @@
+// Copyright 2025 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Replacements of the global allocation functions which count the allocations of the process for
+// the MemoryMonitor. They are in the separate library autoware_node_allocation_hook, which is
+// linked into an executable or preloaded into a container, and forward to malloc and free.
+
+#include "allocation_counts.hpp"
+
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+void * allocate(const size_t size, const size_t alignment)
+{
+  const size_t request_size = size == 0 ? 1 : size;
+  while (true) {
+    void * ptr = nullptr;
+    if (alignment <= alignof(std::max_align_t)) {
+      ptr = std::malloc(request_size);
+    } else if (posix_memalign(&ptr, alignment, request_size) != 0) {
+      ptr = nullptr;
+    }
+    if (ptr) {
+      autoware::node::detail::count_allocation(size);
+      return ptr;
+    }
+    const auto handler = std::get_new_handler();
+    if (!handler) {
+      throw std::bad_alloc();
+    }
+    handler();
+  }
+}
+
+void deallocate(void * ptr) noexcept
+{
+  if (!ptr) {
+    return;
+  }
+  autoware::node::detail::count_deallocation();
+  std::free(ptr);
+}
+}  // namespace
+
+void * operator new(size_t size)
+{
+  return allocate(size, alignof(std::max_align_t));
+}
+
+void * operator new[](size_t size)
+{
+  return allocate(size, alignof(std::max_align_t));
+}
+
+void * operator new(size_t size, const std::nothrow_t &) noexcept
+{
+  try {
+    return allocate(size, alignof(std::max_align_t));
+  } catch (const std::bad_alloc &) {
+    return nullptr;
+  }
+}
+
+void * operator new[](size_t size, const std::nothrow_t &) noexcept
+{
+  try {
+    return allocate(size, alignof(std::max_align_t));
+  } catch (const std::bad_alloc &) {
+    return nullptr;
+  }
+}
+
+void * operator new(size_t size, std::align_val_t alignment)
+{
+  return allocate(size, static_cast<size_t>(alignment));
+}
+
+void * operator new[](size_t size, std::align_val_t alignment)
+{
+  return allocate(size, static_cast<size_t>(alignment));
+}
+
+void operator delete(void * ptr) noexcept
+{
+  deallocate(ptr);
+}
+
+void operator delete[](void * ptr) noexcept
+{
+  deallocate(ptr);
+}
+
+void operator delete(void * ptr, size_t) noexcept
+{
+  deallocate(ptr);
+}
+
+void operator delete[](void * ptr, size_t) noexcept
+{
+  deallocate(ptr);
+}
+
+void operator delete(void * ptr, std::align_val_t) noexcept
+{
+  deallocate(ptr);
+}
+
+void operator delete[](void * ptr, std::align_val_t) noexcept
+{
+  deallocate(ptr);
+}
+
+void operator delete(void * ptr, size_t, std::align_val_t) noexcept
+{
+  deallocate(ptr);
+}
+
+void operator delete[](void * ptr, size_t, std::align_val_t) noexcept
+{
+  deallocate(ptr);
+}
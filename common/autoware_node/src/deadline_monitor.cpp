@@ -0,0 +1,164 @@
+// Copyright 2025 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/node/deadline_monitor.hpp"
+
+#include <rclcpp/logging.hpp>
+#include <rclcpp/time.hpp>
+
+#include <diagnostic_msgs/msg/key_value.hpp>
+
+#include <algorithm>
+#include <string>
+
+namespace autoware::node
+{
+namespace
+{
+int64_t to_ns(const std::chrono::steady_clock::time_point & time)
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+}
+
+diagnostic_msgs::msg::KeyValue create_key_value(const std::string & key, const std::string & value)
+{
+  diagnostic_msgs::msg::KeyValue key_value;
+  key_value.key = key;
+  key_value.value = value;
+  return key_value;
+}
+}  // namespace
+
+DeadlineMonitor::ScopedCallback::ScopedCallback(const CallbackId id)
+: id_(id), start_(std::chrono::steady_clock::now())
+{
+  const int64_t start_ns = to_ns(start_);
+  const int64_t last_start_ns = id_->last_start_ns.exchange(start_ns, std::memory_order_relaxed);
+  const int64_t period_ns = id_->deadline.period.count();
+  if (period_ns > 0 && last_start_ns > 0 && start_ns - last_start_ns > period_ns) {
+    id_->missed_period_num.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+DeadlineMonitor::ScopedCallback::~ScopedCallback()
+{
+  const int64_t duration_ns = to_ns(std::chrono::steady_clock::now()) - to_ns(start_);
+  id_->execution_num.fetch_add(1, std::memory_order_relaxed);
+  int64_t current_max = id_->max_duration_ns.load(std::memory_order_relaxed);
+  while (duration_ns > current_max &&
+         !id_->max_duration_ns.compare_exchange_weak(
+           current_max, duration_ns, std::memory_order_relaxed)) {
+  }
+  const int64_t budget_ns = id_->deadline.budget.count();
+  if (budget_ns > 0 && duration_ns > budget_ns) {
+    id_->overrun_num.fetch_add(1, std::memory_order_relaxed);
+    id_->last_overrun_duration_ns.store(duration_ns, std::memory_order_relaxed);
+  }
+}
+
+DeadlineMonitor::DeadlineMonitor(
+  rclcpp::Node * node, const std::chrono::nanoseconds & report_period)
+: node_name_(node->get_fully_qualified_name()),
+  clock_(node->get_clock()),
+  logger_(node->get_logger().get_child("deadline_monitor"))
+{
+  pub_diagnostics_ =
+    node->create_publisher<diagnostic_msgs::msg::DiagnosticArray>("/diagnostics", rclcpp::QoS{1});
+  timer_ = node->create_wall_timer(report_period, [this]() { report(); });
+}
+
+DeadlineMonitor::CallbackId DeadlineMonitor::register_callback(
+  const std::string & name, const CallbackDeadline & deadline)
+{
+  std::lock_guard<std::mutex> lock(callbacks_mutex_);
+  const auto itr = std::find_if(
+    callbacks_.begin(), callbacks_.end(),
+    [&](const Callback & callback) { return callback.name == name; });
+  if (itr != callbacks_.end()) {
+    return &*itr;
+  }
+  return &callbacks_.emplace_back(name, deadline);
+}
+
+bool DeadlineMonitor::is_stale(const CallbackId id, const builtin_interfaces::msg::Time & stamp)
+{
+  if (!id->deadline.max_message_age) {
+    return false;
+  }
+  const auto age = clock_->now() - rclcpp::Time(stamp, clock_->get_clock_type());
+  if (age.nanoseconds() <= id->deadline.max_message_age->count()) {
+    return false;
+  }
+  id->dropped_message_num.fetch_add(1, std::memory_order_relaxed);
+  return true;
+}
+
+DeadlineMonitor::Counts DeadlineMonitor::get_counts(const CallbackId id, const bool reset)
+{
+  const auto take = [reset](auto & value) {
+    return reset ? value.exchange(0, std::memory_order_relaxed)
+                 : value.load(std::memory_order_relaxed);
+  };
+  Counts counts;
+  counts.execution_num = take(id->execution_num);
+  counts.overrun_num = take(id->overrun_num);
+  counts.missed_period_num = take(id->missed_period_num);
+  counts.dropped_message_num = take(id->dropped_message_num);
+  counts.max_duration_ns = take(id->max_duration_ns);
+  counts.last_overrun_duration_ns = take(id->last_overrun_duration_ns);
+  return counts;
+}
+
+void DeadlineMonitor::report()
+{
+  diagnostic_msgs::msg::DiagnosticArray msg;
+  msg.header.stamp = clock_->now();
+
+  std::lock_guard<std::mutex> lock(callbacks_mutex_);
+  for (auto & callback : callbacks_) {
+    const auto counts = get_counts(&callback, true);
+    auto & status = msg.status.emplace_back();
+    status.name = node_name_ + ": deadline of " + callback.name;
+    status.hardware_id = node_name_;
+    if (counts.overrun_num > 0 || counts.missed_period_num > 0) {
+      status.level = diagnostic_msgs::msg::DiagnosticStatus::WARN;
+      status.message = "deadline overrun";
+      RCLCPP_WARN_STREAM(
+        logger_, callback.name << " overran its budget " << counts.overrun_num
+                               << " times and missed its period " << counts.missed_period_num
+                               << " times, the last overrun took "
+                               << counts.last_overrun_duration_ns * 1e-6 << " ms");
+    } else {
+      status.level = diagnostic_msgs::msg::DiagnosticStatus::OK;
+      status.message = "OK";
+    }
+    status.values.push_back(
+      create_key_value("execution_num", std::to_string(counts.execution_num)));
+    status.values.push_back(create_key_value("overrun_num", std::to_string(counts.overrun_num)));
+    status.values.push_back(
+      create_key_value("missed_period_num", std::to_string(counts.missed_period_num)));
+    status.values.push_back(
+      create_key_value("dropped_message_num", std::to_string(counts.dropped_message_num)));
+    status.values.push_back(
+      create_key_value("max_duration_ms", std::to_string(counts.max_duration_ns * 1e-6)));
+    status.values.push_back(create_key_value(
+      "last_overrun_duration_ms", std::to_string(counts.last_overrun_duration_ns * 1e-6)));
+    status.values.push_back(
+      create_key_value("budget_ms", std::to_string(callback.deadline.budget.count() * 1e-6)));
+  }
+  if (!msg.status.empty()) {
+    pub_diagnostics_->publish(msg);
+  }
+}
+}  // namespace autoware::node
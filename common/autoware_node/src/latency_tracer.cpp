@@ -0,0 +1,174 @@
+// Copyright 2025 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/node/latency_tracer.hpp"
+
+#include <diagnostic_msgs/msg/key_value.hpp>
+
+#ifdef AUTOWARE_NODE_USE_LTTNG
+#include <lttng/tracef.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace autoware::node
+{
+namespace
+{
+constexpr std::array<std::pair<const char *, double>, 3> published_quantiles{
+  {{"p50_ms", 0.5}, {"p90_ms", 0.9}, {"p99_ms", 0.99}}};
+
+size_t to_bucket_index(const int64_t duration_ns)
+{
+  const auto duration_us = static_cast<uint64_t>(std::max<int64_t>(duration_ns, 0) / 1000);
+  size_t index = 0;
+  for (uint64_t v = duration_us; v > 0 && index + 1 < SpanStatistics::bucket_num; v >>= 1) {
+    ++index;
+  }
+  return index;
+}
+
+diagnostic_msgs::msg::KeyValue create_key_value(const std::string & key, const std::string & value)
+{
+  diagnostic_msgs::msg::KeyValue key_value;
+  key_value.key = key;
+  key_value.value = value;
+  return key_value;
+}
+}  // namespace
+
+double SpanStatistics::quantile_upper_bound_ms(const double quantile) const
+{
+  if (count == 0) {
+    return 0.0;
+  }
+  const auto rank = static_cast<uint64_t>(std::ceil(quantile * static_cast<double>(count)));
+  uint64_t accumulated = 0;
+  for (size_t i = 0; i < bucket_num; ++i) {
+    accumulated += buckets.at(i);
+    if (accumulated >= std::max<uint64_t>(rank, 1)) {
+      // the last bucket is not bounded, the maximum is its best bound
+      const double upper_bound_ms = std::ldexp(1.0, static_cast<int>(i)) * 1e-3;
+      return i + 1 < bucket_num ? std::min(upper_bound_ms, max_ns * 1e-6) : max_ns * 1e-6;
+    }
+  }
+  return max_ns * 1e-6;
+}
+
+void LatencyTracer::ScopedSpan::stop()
+{
+  if (!tracer_) {
+    return;
+  }
+  tracer_->record(id_, std::chrono::steady_clock::now() - start_);
+  tracer_ = nullptr;
+}
+
+void LatencyTracer::Span::add(const int64_t duration_ns)
+{
+  count.fetch_add(1, std::memory_order_relaxed);
+  sum_ns.fetch_add(duration_ns, std::memory_order_relaxed);
+  buckets.at(to_bucket_index(duration_ns)).fetch_add(1, std::memory_order_relaxed);
+  int64_t current_max = max_ns.load(std::memory_order_relaxed);
+  while (duration_ns > current_max &&
+         !max_ns.compare_exchange_weak(current_max, duration_ns, std::memory_order_relaxed)) {
+  }
+}
+
+LatencyTracer::LatencyTracer(rclcpp::Node * node, const std::chrono::nanoseconds & publish_period)
+: node_name_(node->get_fully_qualified_name()), clock_(node->get_clock())
+{
+  pub_histogram_ = node->create_publisher<diagnostic_msgs::msg::DiagnosticArray>(
+    "~/debug/latency_histogram", rclcpp::QoS{1});
+  timer_ = node->create_wall_timer(publish_period, [this]() { publish_statistics(); });
+}
+
+LatencyTracer::SpanId LatencyTracer::register_span(const std::string & name)
+{
+  std::lock_guard<std::mutex> lock(spans_mutex_);
+  const auto itr = std::find_if(
+    spans_.begin(), spans_.end(), [&](const Span & span) { return span.name == name; });
+  if (itr != spans_.end()) {
+    return &*itr;
+  }
+  return &spans_.emplace_back(name);
+}
+
+void LatencyTracer::record(const SpanId id, const std::chrono::nanoseconds & duration)
+{
+  id->add(duration.count());
+#ifdef AUTOWARE_NODE_USE_LTTNG
+  tracef(
+    "autoware_span node=%s span=%s duration_ns=%ld", node_name_.c_str(), id->name.c_str(),
+    static_cast<long>(duration.count()));  // NOLINT
+#endif
+}
+
+std::vector<SpanStatistics> LatencyTracer::collect_statistics(const bool reset)
+{
+  // NOTE: a span recorded during the collection can be counted in the next period only partially,
+  // which is accepted for the debug statistics
+  const auto take = [reset](auto & value) {
+    return reset ? value.exchange(0, std::memory_order_relaxed)
+                 : value.load(std::memory_order_relaxed);
+  };
+
+  std::lock_guard<std::mutex> lock(spans_mutex_);
+  std::vector<SpanStatistics> statistics;
+  statistics.reserve(spans_.size());
+  for (auto & span : spans_) {
+    auto & s = statistics.emplace_back();
+    s.name = span.name;
+    s.count = take(span.count);
+    s.sum_ns = take(span.sum_ns);
+    s.max_ns = take(span.max_ns);
+    for (size_t i = 0; i < SpanStatistics::bucket_num; ++i) {
+      s.buckets.at(i) = take(span.buckets.at(i));
+    }
+  }
+  return statistics;
+}
+
+void LatencyTracer::publish_statistics()
+{
+  diagnostic_msgs::msg::DiagnosticArray msg;
+  msg.header.stamp = clock_->now();
+  for (const auto & s : collect_statistics(true)) {
+    auto & status = msg.status.emplace_back();
+    status.level = diagnostic_msgs::msg::DiagnosticStatus::OK;
+    status.name = node_name_ + ": " + s.name;
+    status.hardware_id = node_name_;
+    const double mean_ms = s.count == 0 ? 0.0 : s.sum_ns * 1e-6 / static_cast<double>(s.count);
+    status.values.push_back(create_key_value("count", std::to_string(s.count)));
+    status.values.push_back(create_key_value("mean_ms", std::to_string(mean_ms)));
+    for (const auto & [key, quantile] : published_quantiles) {
+      status.values.push_back(
+        create_key_value(key, std::to_string(s.quantile_upper_bound_ms(quantile))));
+    }
+    status.values.push_back(create_key_value("max_ms", std::to_string(s.max_ns * 1e-6)));
+    for (size_t i = 0; i < SpanStatistics::bucket_num; ++i) {
+      if (s.buckets.at(i) > 0) {
+        status.values.push_back(create_key_value(
+          "bucket_lt_" + std::to_string(1ULL << i) + "us", std::to_string(s.buckets.at(i))));
+      }
+    }
+  }
+  pub_histogram_->publish(msg);
+}
+}  // namespace autoware::node
@@ -0,0 +1,110 @@
+// Copyright 2025 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/node/lifecycle_gate.hpp"
+
+#include <chrono>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace autoware::node
+{
+LifecycleGate::LifecycleGate(
+  rclcpp::Node * node, LifecycleCallbacks callbacks, StartupTimeline * timeline)
+: logger_(node->get_logger()), callbacks_(std::move(callbacks)), timeline_(timeline)
+{
+  // the first execution of the timer is the first spin of the node after its construction
+  configure_timer_ = node->create_wall_timer(std::chrono::nanoseconds(0), [this]() {
+    configure_timer_->cancel();
+    configure();
+  });
+}
+
+LifecycleGate::InputId LifecycleGate::declare_input(const std::string & name)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return &inputs_.emplace_back(Input{name});
+}
+
+void LifecycleGate::notify_input(const InputId id)
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (id->is_received) {
+    return;
+  }
+  id->is_received = true;
+  try_activate(lock);
+}
+
+LifecycleState LifecycleGate::get_state() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return state_;
+}
+
+std::vector<std::string> LifecycleGate::get_missing_inputs() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::vector<std::string> names;
+  for (const auto & input : inputs_) {
+    if (!input.is_received) {
+      names.push_back(input.name);
+    }
+  }
+  return names;
+}
+
+void LifecycleGate::configure()
+{
+  if (callbacks_.on_configure) {
+    callbacks_.on_configure();
+  }
+  if (timeline_) {
+    timeline_->mark_phase("configure");
+  }
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  state_ = LifecycleState::CONFIGURED;
+  RCLCPP_INFO(logger_, "Configured.");
+  try_activate(lock);
+}
+
+void LifecycleGate::try_activate(std::unique_lock<std::mutex> & lock)
+{
+  if (state_ != LifecycleState::CONFIGURED || is_activating_) {
+    return;
+  }
+  for (const auto & input : inputs_) {
+    if (!input.is_received) {
+      return;
+    }
+  }
+  // NOTE: the callback runs without the lock, so that it can query the gate
+  is_activating_ = true;
+  lock.unlock();
+  if (timeline_) {
+    timeline_->mark_phase("wait_inputs");
+  }
+  if (callbacks_.on_activate) {
+    callbacks_.on_activate();
+  }
+  if (timeline_) {
+    timeline_->mark_ready();
+  }
+  lock.lock();
+  state_ = LifecycleState::ACTIVE;
+  RCLCPP_INFO(logger_, "Activated.");
+}
+}  // namespace autoware::node
@@ -0,0 +1,193 @@
+// Copyright 2025 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/node/memory_monitor.hpp"
+
+#include "allocation_counts.hpp"
+
+#include <rclcpp/time.hpp>
+
+#include <diagnostic_msgs/msg/key_value.hpp>
+
+#include <malloc.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace autoware::node
+{
+namespace
+{
+// NOTE: constant initialized, so that they can be counted before the static initialization
+std::atomic<uint64_t> allocation_num{0};
+std::atomic<uint64_t> allocated_bytes{0};
+std::atomic<uint64_t> deallocation_num{0};
+
+constexpr double bytes_per_mb = 1024.0 * 1024.0;
+
+diagnostic_msgs::msg::KeyValue create_key_value(const std::string & key, const std::string & value)
+{
+  diagnostic_msgs::msg::KeyValue key_value;
+  key_value.key = key;
+  key_value.value = value;
+  return key_value;
+}
+
+std::string to_mb(const size_t bytes)
+{
+  return std::to_string(static_cast<double>(bytes) / bytes_per_mb);
+}
+}  // namespace
+
+namespace detail
+{
+void count_allocation(const size_t size) noexcept
+{
+  allocation_num.fetch_add(1, std::memory_order_relaxed);
+  allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+void count_deallocation() noexcept
+{
+  deallocation_num.fetch_add(1, std::memory_order_relaxed);
+}
+}  // namespace detail
+
+AllocationCounts get_allocation_counts()
+{
+  AllocationCounts counts;
+  counts.allocation_num = allocation_num.load(std::memory_order_relaxed);
+  counts.allocated_bytes = allocated_bytes.load(std::memory_order_relaxed);
+  counts.deallocation_num = deallocation_num.load(std::memory_order_relaxed);
+  return counts;
+}
+
+bool is_allocation_hook_loaded()
+{
+  // NOTE: the allocation function is called directly, a new expression could be elided
+  const auto before = allocation_num.load(std::memory_order_relaxed);
+  void * const ptr = ::operator new(1);
+  ::operator delete(ptr);
+  return allocation_num.load(std::memory_order_relaxed) != before;
+}
+
+MemoryMonitor::MemoryMonitor(rclcpp::Node * node, const std::chrono::nanoseconds & report_period)
+: node_name_(node->get_fully_qualified_name()),
+  clock_(node->get_clock()),
+  last_allocation_counts_(get_allocation_counts()),
+  last_report_time_(std::chrono::steady_clock::now())
+{
+  pub_diagnostics_ =
+    node->create_publisher<diagnostic_msgs::msg::DiagnosticArray>("/diagnostics", rclcpp::QoS{1});
+  timer_ = node->create_wall_timer(report_period, [this]() { report(); });
+}
+
+MemoryMonitor::OwnerId MemoryMonitor::register_owner(const std::string & name, Estimate estimate)
+{
+  std::lock_guard<std::mutex> lock(owners_mutex_);
+  const auto itr = std::find_if(
+    owners_.begin(), owners_.end(), [&](const Owner & owner) { return owner.name == name; });
+  if (itr != owners_.end()) {
+    itr->estimate = std::move(estimate);
+    return &*itr;
+  }
+  return &owners_.emplace_back(Owner{name, std::move(estimate)});
+}
+
+void MemoryMonitor::unregister_owner(const OwnerId id)
+{
+  std::lock_guard<std::mutex> lock(owners_mutex_);
+  owners_.remove_if([id](const Owner & owner) { return &owner == id; });
+}
+
+std::vector<std::pair<std::string, size_t>> MemoryMonitor::get_owner_usage()
+{
+  std::vector<std::pair<std::string, size_t>> usage;
+  std::lock_guard<std::mutex> lock(owners_mutex_);
+  for (const auto & owner : owners_) {
+    usage.emplace_back(owner.name, owner.estimate ? owner.estimate() : 0);
+  }
+  return usage;
+}
+
+std::optional<size_t> MemoryMonitor::get_process_rss_bytes()
+{
+  // the second field of statm is the number of resident pages
+  std::ifstream statm("/proc/self/statm");
+  size_t total_pages = 0;
+  size_t resident_pages = 0;
+  if (!(statm >> total_pages >> resident_pages)) {
+    return std::nullopt;
+  }
+  return resident_pages * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+}
+
+void MemoryMonitor::report()
+{
+  diagnostic_msgs::msg::DiagnosticArray msg;
+  msg.header.stamp = clock_->now();
+
+  auto & status = msg.status.emplace_back();
+  status.name = node_name_ + ": memory";
+  status.hardware_id = node_name_;
+  status.level = diagnostic_msgs::msg::DiagnosticStatus::OK;
+  status.message = "OK";
+
+  size_t owners_total_bytes = 0;
+  for (const auto & [name, bytes] : get_owner_usage()) {
+    status.values.push_back(create_key_value(name + "_mb", to_mb(bytes)));
+    owners_total_bytes += bytes;
+  }
+  status.values.push_back(create_key_value("owners_total_mb", to_mb(owners_total_bytes)));
+
+  if (const auto rss_bytes = get_process_rss_bytes()) {
+    status.values.push_back(create_key_value("process_rss_mb", to_mb(*rss_bytes)));
+  }
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+  // the blocks in use of the arenas and the blocks allocated with mmap
+  const auto heap = mallinfo2();
+  status.values.push_back(create_key_value("heap_in_use_mb", to_mb(heap.uordblks + heap.hblkhd)));
+#endif
+
+  const auto now = std::chrono::steady_clock::now();
+  const auto counts = get_allocation_counts();
+  const double period_s = std::chrono::duration<double>(now - last_report_time_).count();
+  const bool is_hooked = is_allocation_hook_loaded();
+  status.values.push_back(create_key_value("allocation_hook", is_hooked ? "true" : "false"));
+  if (is_hooked && period_s > 0.0) {
+    const auto rate = [period_s](const uint64_t current, const uint64_t last) {
+      return std::to_string(static_cast<double>(current - last) / period_s);
+    };
+    status.values.push_back(create_key_value(
+      "allocation_rate_hz", rate(counts.allocation_num, last_allocation_counts_.allocation_num)));
+    status.values.push_back(create_key_value(
+      "deallocation_rate_hz",
+      rate(counts.deallocation_num, last_allocation_counts_.deallocation_num)));
+    status.values.push_back(create_key_value(
+      "allocated_mb_per_s",
+      std::to_string(
+        static_cast<double>(counts.allocated_bytes - last_allocation_counts_.allocated_bytes) /
+        bytes_per_mb / period_s)));
+  }
+  last_allocation_counts_ = counts;
+  last_report_time_ = now;
+
+  pub_diagnostics_->publish(msg);
+}
+}  // namespace autoware::node
@@ -15,16 +15,44 @@
 #include <autoware/node/node.hpp>
 #include <rclcpp/node.hpp>
 
+#include <chrono>
+#include <memory>
 #include <string>
+#include <utility>
 
 namespace autoware::node
 {
 Node::Node(
   const std::string & node_name, const std::string & ns, const rclcpp::NodeOptions & options)
-: rclcpp::Node(node_name, ns, options)
+: rclcpp::Node(node_name, ns, options), startup_timeline_(this), realtime_configurator_(this)
 {
   RCLCPP_DEBUG(
     get_logger(), "Node %s constructor was called.",
     get_node_base_interface()->get_fully_qualified_name());
 }
+
+DeadlineMonitor & Node::enable_deadline_monitor(const std::chrono::nanoseconds & report_period)
+{
+  if (!deadline_monitor_) {
+    deadline_monitor_ = std::make_unique<DeadlineMonitor>(this, report_period);
+  }
+  return *deadline_monitor_;
+}
+
+MemoryMonitor & Node::enable_memory_monitor(const std::chrono::nanoseconds & report_period)
+{
+  if (!memory_monitor_) {
+    memory_monitor_ = std::make_unique<MemoryMonitor>(this, report_period);
+  }
+  return *memory_monitor_;
+}
+
+LifecycleGate & Node::enable_lifecycle(LifecycleCallbacks callbacks)
+{
+  if (!lifecycle_gate_) {
+    lifecycle_gate_ =
+      std::make_unique<LifecycleGate>(this, std::move(callbacks), &startup_timeline_);
+  }
+  return *lifecycle_gate_;
+}
 }  // namespace autoware::node
@@ -0,0 +1,70 @@
+// Copyright 2025 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/node/output_latency_publisher.hpp"
+
+#include <string>
+
+namespace autoware::node
+{
+OutputLatencyPublisher::OutputLatencyPublisher(
+  rclcpp::Node * node, const std::string & output_name)
+: clock_(node->get_clock()), begin_time_(0, 0, clock_->get_clock_type())
+{
+  using autoware_internal_debug_msgs::msg::Float64Stamped;
+  const auto prefix = "~/debug/" + output_name + "/";
+  pub_oldest_input_age_ =
+    node->create_publisher<Float64Stamped>(prefix + "oldest_input_age_ms", rclcpp::QoS{1});
+  pub_pipeline_latency_ =
+    node->create_publisher<Float64Stamped>(prefix + "pipeline_latency_ms", rclcpp::QoS{1});
+}
+
+void OutputLatencyPublisher::begin()
+{
+  begin_time_ = clock_->now();
+  begin_steady_time_ = std::chrono::steady_clock::now();
+  oldest_input_stamp_.reset();
+  oldest_input_age_ms_.reset();
+}
+
+void OutputLatencyPublisher::add_input(const builtin_interfaces::msg::Time & stamp)
+{
+  if (stamp.sec == 0 && stamp.nanosec == 0) {
+    return;
+  }
+  const rclcpp::Time input_stamp(stamp, clock_->get_clock_type());
+  if (!oldest_input_stamp_ || input_stamp < *oldest_input_stamp_) {
+    oldest_input_stamp_ = input_stamp;
+    oldest_input_age_ms_ = (begin_time_ - input_stamp).seconds() * 1e3;
+  }
+}
+
+void OutputLatencyPublisher::publish()
+{
+  if (!oldest_input_age_ms_) {
+    return;
+  }
+  const double stage_time_ms =
+    std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin_steady_time_)
+      .count();
+  pipeline_latency_ms_ = *oldest_input_age_ms_ + stage_time_ms;
+
+  autoware_internal_debug_msgs::msg::Float64Stamped msg;
+  msg.stamp = clock_->now();
+  msg.data = *oldest_input_age_ms_;
+  pub_oldest_input_age_->publish(msg);
+  msg.data = *pipeline_latency_ms_;
+  pub_pipeline_latency_->publish(msg);
+}
+}  // namespace autoware::node
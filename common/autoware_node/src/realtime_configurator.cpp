@@ -0,0 +1,165 @@
+// Copyright 2025 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/node/realtime_configurator.hpp"
+
+#include <alloca.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace autoware::node
+{
+namespace
+{
+// the stack below the frames of the caller which is left untouched [bytes]
+constexpr size_t stack_margin_bytes = 64 * 1024;
+
+std::string describe_error(const std::string & setting, const int error)
+{
+  return setting + ": " + std::strerror(error);
+}
+
+// NOTE: not inlined, so that the pages are allocated below the frame of the caller and released
+// with the frame of this function
+__attribute__((noinline)) void touch_stack(const size_t size)
+{
+  const auto page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  auto * buffer = static_cast<volatile unsigned char *>(alloca(size));  // NOLINT
+  for (size_t i = 0; i < size; i += page_size) {
+    buffer[i] = 0;
+  }
+}
+
+std::optional<std::string> prefault_stack(const size_t size)
+{
+  pthread_attr_t attr;
+  if (const auto error = pthread_getattr_np(pthread_self(), &attr); error != 0) {
+    return describe_error("prefault_stack_bytes", error);
+  }
+  size_t stack_size = 0;
+  pthread_attr_getstacksize(&attr, &stack_size);
+  pthread_attr_destroy(&attr);
+  if (size + stack_margin_bytes > stack_size) {
+    return "prefault_stack_bytes: " + std::to_string(size) + " bytes exceed the stack of " +
+           std::to_string(stack_size) + " bytes of the thread";
+  }
+  touch_stack(size);
+  return std::nullopt;
+}
+}  // namespace
+
+std::vector<std::string> apply_realtime_settings(const RealtimeSettings & settings)
+{
+  std::vector<std::string> errors;
+
+  // locked first, so that the pages faulted in below stay resident
+  if (settings.lock_memory && mlockall(MCL_CURRENT | MCL_FUTURE) != 0) {
+    errors.push_back(describe_error("lock_memory", errno));
+  }
+
+  if (!settings.cpu_affinity.empty()) {
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    bool is_valid = true;
+    for (const auto cpu : settings.cpu_affinity) {
+      if (cpu < 0 || cpu >= CPU_SETSIZE) {
+        errors.push_back("cpu_affinity: invalid CPU " + std::to_string(cpu));
+        is_valid = false;
+        break;
+      }
+      CPU_SET(static_cast<size_t>(cpu), &cpu_set);
+    }
+    if (is_valid) {
+      if (const auto error = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+          error != 0) {
+        errors.push_back(describe_error("cpu_affinity", error));
+      }
+    }
+  }
+
+  if (settings.sched_priority != 0) {
+    const auto min_priority = sched_get_priority_min(SCHED_FIFO);
+    const auto max_priority = sched_get_priority_max(SCHED_FIFO);
+    if (settings.sched_priority < min_priority || settings.sched_priority > max_priority) {
+      errors.push_back(
+        "sched_priority: " + std::to_string(settings.sched_priority) + " is out of [" +
+        std::to_string(min_priority) + ", " + std::to_string(max_priority) + "]");
+    } else {
+      sched_param param{};
+      param.sched_priority = static_cast<int>(settings.sched_priority);
+      if (const auto error = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+          error != 0) {
+        errors.push_back(describe_error("sched_priority", error));
+      }
+    }
+  }
+
+  if (settings.prefault_stack_bytes < 0) {
+    errors.push_back("prefault_stack_bytes: negative size");
+  } else if (settings.prefault_stack_bytes > 0) {
+    if (const auto error = prefault_stack(static_cast<size_t>(settings.prefault_stack_bytes))) {
+      errors.push_back(*error);
+    }
+  }
+
+  return errors;
+}
+
+RealtimeConfigurator::RealtimeConfigurator(rclcpp::Node * node)
+{
+  // the parameters may already be declared, e.g. from the overrides
+  const auto declare = [node](const std::string & name, const auto & default_value) {
+    using T = std::decay_t<decltype(default_value)>;
+    const auto full_name = "realtime." + name;
+    if (!node->has_parameter(full_name)) {
+      return node->declare_parameter<T>(full_name, default_value);
+    }
+    return node->get_parameter(full_name).get_value<T>();
+  };
+  settings_.cpu_affinity = declare("cpu_affinity", std::vector<int64_t>{});
+  settings_.sched_priority = declare("sched_priority", int64_t{0});
+  settings_.lock_memory = declare("lock_memory", false);
+  settings_.prefault_stack_bytes = declare("prefault_stack_bytes", int64_t{0});
+
+  if (settings_.is_default()) {
+    is_applied_ = true;
+    return;
+  }
+
+  // the first execution of the timer is the first spin of the node after its construction
+  apply_timer_ = node->create_wall_timer(
+    std::chrono::nanoseconds(0), [this, logger = node->get_logger()]() {
+      apply_timer_->cancel();
+      const auto errors = apply_realtime_settings(settings_);
+      for (const auto & error : errors) {
+        RCLCPP_WARN(logger, "failed to apply the realtime setting %s", error.c_str());
+      }
+      if (errors.empty()) {
+        RCLCPP_INFO(logger, "applied the realtime settings to the thread of the node");
+      }
+      is_applied_ = true;
+    });
+}
+}  // namespace autoware::node
@@ -0,0 +1,157 @@
+// Copyright 2025 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/node/startup_timeline.hpp"
+
+#include <rclcpp/time.hpp>
+
+#include <diagnostic_msgs/msg/key_value.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace autoware::node
+{
+namespace
+{
+// the timelines of all the nodes are kept for the late subscribers
+constexpr size_t max_timeline_num = 1000;
+
+diagnostic_msgs::msg::KeyValue create_key_value(const std::string & key, const std::string & value)
+{
+  diagnostic_msgs::msg::KeyValue key_value;
+  key_value.key = key;
+  key_value.value = value;
+  return key_value;
+}
+
+std::string to_ms(const std::chrono::system_clock::duration & duration)
+{
+  return std::to_string(std::chrono::duration<double, std::milli>(duration).count());
+}
+
+rclcpp::Time to_time(const std::chrono::system_clock::time_point & time)
+{
+  return rclcpp::Time(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count(),
+    RCL_SYSTEM_TIME);
+}
+}  // namespace
+
+StartupTimeline::StartupTimeline(rclcpp::Node * node)
+: node_name_(node->get_fully_qualified_name()), construction_(std::chrono::system_clock::now())
+{
+  pub_timeline_ = node->create_publisher<diagnostic_msgs::msg::DiagnosticArray>(
+    startup_timeline_topic, rclcpp::QoS{1}.transient_local());
+}
+
+void StartupTimeline::mark_phase(const std::string & name)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!is_ready_) {
+    phases_.push_back(Phase{name, std::chrono::system_clock::now()});
+  }
+}
+
+void StartupTimeline::mark_ready()
+{
+  diagnostic_msgs::msg::DiagnosticArray msg;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (is_ready_) {
+      return;
+    }
+    is_ready_ = true;
+    const auto ready = std::chrono::system_clock::now();
+    phases_.push_back(Phase{"ready", ready});
+    msg.header.stamp = to_time(ready);
+
+    auto & status = msg.status.emplace_back();
+    status.name = node_name_;
+    status.hardware_id = node_name_;
+    status.level = diagnostic_msgs::msg::DiagnosticStatus::OK;
+    status.message = "ready";
+    // the construction time in seconds since the epoch, then the duration of each phase
+    status.values.push_back(
+      create_key_value("constructed_at", std::to_string(to_time(construction_).seconds())));
+    auto start = construction_;
+    for (const auto & phase : phases_) {
+      status.values.push_back(create_key_value(phase.name + "_ms", to_ms(phase.end - start)));
+      start = phase.end;
+    }
+    status.values.push_back(create_key_value("total_ms", to_ms(ready - construction_)));
+  }
+  pub_timeline_->publish(msg);
+}
+
+bool StartupTimeline::is_ready() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return is_ready_;
+}
+
+std::vector<StartupTimeline::Phase> StartupTimeline::get_phases() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return phases_;
+}
+
+ReadinessWaiter::ReadinessWaiter(
+  rclcpp::Node * node, const std::vector<std::string> & node_names,
+  std::function<void()> on_ready)
+: waiting_nodes_(node_names.begin(), node_names.end()), on_ready_(std::move(on_ready))
+{
+  if (waiting_nodes_.empty()) {
+    is_ready_ = true;
+    on_ready_();
+    return;
+  }
+  sub_timeline_ = node->create_subscription<diagnostic_msgs::msg::DiagnosticArray>(
+    startup_timeline_topic, rclcpp::QoS{max_timeline_num}.transient_local(),
+    [this](const diagnostic_msgs::msg::DiagnosticArray::ConstSharedPtr msg) {
+      on_timeline(*msg);
+    });
+}
+
+bool ReadinessWaiter::is_ready() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return is_ready_;
+}
+
+std::vector<std::string> ReadinessWaiter::get_waiting_nodes() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return {waiting_nodes_.begin(), waiting_nodes_.end()};
+}
+
+void ReadinessWaiter::on_timeline(const diagnostic_msgs::msg::DiagnosticArray & msg)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (is_ready_) {
+      return;
+    }
+    for (const auto & status : msg.status) {
+      waiting_nodes_.erase(status.name);
+    }
+    if (!waiting_nodes_.empty()) {
+      return;
+    }
+    is_ready_ = true;
+  }
+  on_ready_();
+}
+}  // namespace autoware::node
@@ -0,0 +1,82 @@
+// Copyright 2025 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <autoware/node/deadline_monitor.hpp>
+#include <autoware/node/node.hpp>
+#include <rclcpp/rclcpp.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <thread>
+
+class DeadlineMonitorTest : public ::testing::Test
+{
+public:
+  void SetUp() override
+  {
+    rclcpp::init(0, nullptr);
+    node_ = std::make_shared<autoware::node::Node>("test_node", "test_ns");
+  }
+
+  void TearDown() override
+  {
+    node_.reset();
+    rclcpp::shutdown();
+  }
+
+  std::shared_ptr<autoware::node::Node> node_;
+};
+
+TEST_F(DeadlineMonitorTest, CountOverruns)
+{
+  using std::chrono::milliseconds;
+
+  EXPECT_EQ(node_->deadline_monitor(), nullptr);
+  auto & monitor = node_->enable_deadline_monitor();
+  EXPECT_EQ(node_->deadline_monitor(), &monitor);
+  EXPECT_EQ(&node_->enable_deadline_monitor(), &monitor);
+
+  autoware::node::CallbackDeadline deadline;
+  deadline.period = milliseconds(30);
+  deadline.budget = milliseconds(10);
+  deadline.max_message_age = milliseconds(100);
+  const auto id = monitor.register_callback("on_timer", deadline);
+
+  // the second execution overruns the budget and the last one starts after the period
+  for (const auto duration : {milliseconds(1), milliseconds(20), milliseconds(1)}) {
+    const auto callback = monitor.scoped_callback(id);
+    std::this_thread::sleep_for(duration);
+  }
+  std::this_thread::sleep_for(milliseconds(40));
+  {
+    const auto callback = monitor.scoped_callback(id);
+  }
+
+  const auto now = node_->now();
+  EXPECT_FALSE(monitor.is_stale(id, now));
+  EXPECT_TRUE(monitor.is_stale(id, now - rclcpp::Duration::from_seconds(0.2)));
+
+  const auto counts = monitor.get_counts(id, true);
+  EXPECT_EQ(counts.execution_num, 4U);
+  EXPECT_EQ(counts.overrun_num, 1U);
+  EXPECT_GE(counts.missed_period_num, 1U);
+  EXPECT_EQ(counts.dropped_message_num, 1U);
+  EXPECT_GE(counts.last_overrun_duration_ns, 20000000);
+  EXPECT_EQ(counts.max_duration_ns, counts.last_overrun_duration_ns);
+
+  // the counts are reset by the report
+  EXPECT_EQ(monitor.get_counts(id, false).execution_num, 0U);
+}
@@ -0,0 +1,80 @@
+// Copyright 2025 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <autoware/node/latency_tracer.hpp>
+#include <autoware/node/node.hpp>
+#include <rclcpp/rclcpp.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <thread>
+
+class LatencyTracerTest : public ::testing::Test
+{
+public:
+  void SetUp() override
+  {
+    rclcpp::init(0, nullptr);
+    node_ = std::make_shared<autoware::node::Node>("test_node", "test_ns");
+  }
+
+  void TearDown() override
+  {
+    node_.reset();
+    rclcpp::shutdown();
+  }
+
+  std::shared_ptr<autoware::node::Node> node_;
+};
+
+TEST_F(LatencyTracerTest, RecordSpans)
+{
+  using std::chrono::microseconds;
+  using std::chrono::milliseconds;
+
+  autoware::node::LatencyTracer tracer(node_.get(), std::chrono::seconds(1));
+  const auto span_a = tracer.register_span("a");
+  const auto span_b = tracer.register_span("b");
+  EXPECT_EQ(tracer.register_span("a"), span_a);
+
+  for (int i = 0; i < 3; ++i) {
+    tracer.record(span_a, microseconds(500));
+  }
+  tracer.record(span_a, milliseconds(5));
+  {
+    const auto span = tracer.scoped_span(span_b);
+    std::this_thread::sleep_for(milliseconds(1));
+  }
+
+  const auto statistics = tracer.collect_statistics(true);
+  ASSERT_EQ(statistics.size(), 2U);
+  const auto & a = statistics.at(0);
+  EXPECT_EQ(a.name, "a");
+  EXPECT_EQ(a.count, 4U);
+  EXPECT_EQ(a.sum_ns, 6500000);
+  EXPECT_EQ(a.max_ns, 5000000);
+  // 500 us is in [256, 512) us and 5 ms is the maximum
+  EXPECT_DOUBLE_EQ(a.quantile_upper_bound_ms(0.5), 0.512);
+  EXPECT_DOUBLE_EQ(a.quantile_upper_bound_ms(0.99), 5.0);
+  const auto & b = statistics.at(1);
+  EXPECT_EQ(b.count, 1U);
+  EXPECT_GE(b.max_ns, 1000000);
+
+  // the histograms are reset by the collection
+  const auto reset_statistics = tracer.collect_statistics(false);
+  EXPECT_EQ(reset_statistics.at(0).count, 0U);
+  EXPECT_DOUBLE_EQ(reset_statistics.at(0).quantile_upper_bound_ms(0.5), 0.0);
+}
@@ -0,0 +1,85 @@
+// Copyright 2025 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <autoware/node/latest_value_subscription.hpp>
+#include <rclcpp/rclcpp.hpp>
+
+#include <autoware_internal_debug_msgs/msg/float64_stamped.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+
+using autoware_internal_debug_msgs::msg::Float64Stamped;
+
+TEST(LatestValueSlotTest, ConcurrentStoreAndLoad)
+{
+  autoware::node::LatestValueSlot<Float64Stamped> slot;
+  EXPECT_FALSE(slot.load());
+
+  std::atomic_bool done{false};
+  std::thread writer([&]() {
+    for (int i = 1; i <= 10000; ++i) {
+      auto msg = std::make_shared<Float64Stamped>();
+      msg->data = i;
+      slot.store(std::move(msg));
+    }
+    done = true;
+  });
+
+  // a reader only sees complete values, in the order they are stored
+  double last_value = 0.0;
+  while (!done) {
+    if (const auto msg = slot.load()) {
+      EXPECT_GE(msg->data, last_value);
+      last_value = msg->data;
+    }
+  }
+  writer.join();
+  EXPECT_DOUBLE_EQ(slot.load()->data, 10000.0);
+}
+
+TEST(LatestValueSubscriptionTest, IntraProcessZeroCopy)
+{
+  rclcpp::init(0, nullptr);
+  const auto node = std::make_shared<rclcpp::Node>(
+    "test_node", "test_ns", rclcpp::NodeOptions().use_intra_process_comms(true));
+  autoware::node::LatestValueSubscription<Float64Stamped> sub(node.get(), "~/input");
+  const auto pub = node->create_publisher<Float64Stamped>("~/input", rclcpp::QoS{1});
+  EXPECT_FALSE(sub.take_data());
+
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(node);
+  std::shared_ptr<const Float64Stamped> previous_msg;
+  for (int i = 0; i < 2; ++i) {
+    auto msg = std::make_unique<Float64Stamped>();
+    msg->data = i;
+    const auto * published_msg = msg.get();
+    pub->publish(std::move(msg));
+    executor.spin_some();
+
+    // the subscriber gets the published message itself, which stays valid after newer messages
+    const auto taken_msg = sub.take_data();
+    ASSERT_TRUE(taken_msg);
+    EXPECT_EQ(taken_msg.get(), published_msg);
+    EXPECT_EQ(sub.take_data(), taken_msg);
+    if (previous_msg) {
+      EXPECT_DOUBLE_EQ(previous_msg->data, i - 1);
+    }
+    previous_msg = taken_msg;
+  }
+  rclcpp::shutdown();
+}
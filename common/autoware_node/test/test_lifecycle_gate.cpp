@@ -0,0 +1,102 @@
+// Copyright 2025 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <autoware/node/lifecycle_gate.hpp>
+#include <autoware/node/node.hpp>
+#include <rclcpp/rclcpp.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+using autoware::node::LifecycleState;
+
+class LifecycleGateTest : public ::testing::Test
+{
+public:
+  void SetUp() override
+  {
+    rclcpp::init(0, nullptr);
+    node_ = std::make_shared<autoware::node::Node>("test_node", "test_ns");
+  }
+
+  void TearDown() override
+  {
+    node_.reset();
+    rclcpp::shutdown();
+  }
+
+  void spin_some()
+  {
+    rclcpp::executors::SingleThreadedExecutor executor;
+    executor.add_node(node_);
+    executor.spin_some(std::chrono::milliseconds(100));
+  }
+
+  std::shared_ptr<autoware::node::Node> node_;
+};
+
+TEST_F(LifecycleGateTest, ActivateWithInputs)
+{
+  int configure_num = 0;
+  int activate_num = 0;
+  EXPECT_EQ(node_->lifecycle_gate(), nullptr);
+  auto & gate = node_->enable_lifecycle(
+    {[&configure_num]() { ++configure_num; }, [&activate_num]() { ++activate_num; }});
+  EXPECT_EQ(node_->lifecycle_gate(), &gate);
+  EXPECT_EQ(&node_->enable_lifecycle({}), &gate);
+
+  const auto odometry = gate.declare_input("odometry");
+  const auto map = gate.declare_input("map");
+
+  // an input received before the configuration is kept
+  gate.notify_input(odometry);
+  EXPECT_EQ(gate.get_state(), LifecycleState::UNCONFIGURED);
+  EXPECT_EQ(configure_num, 0);
+
+  // the configuration runs in the first spin
+  spin_some();
+  EXPECT_EQ(configure_num, 1);
+  EXPECT_EQ(gate.get_state(), LifecycleState::CONFIGURED);
+  EXPECT_EQ(gate.get_missing_inputs(), std::vector<std::string>{"map"});
+
+  gate.notify_input(map);
+  gate.notify_input(map);
+  EXPECT_TRUE(gate.is_active());
+  EXPECT_EQ(activate_num, 1);
+  EXPECT_TRUE(gate.get_missing_inputs().empty());
+
+  // the configuration runs once
+  spin_some();
+  EXPECT_EQ(configure_num, 1);
+
+  // the activation ends the startup timeline of the node
+  const auto phases = node_->startup_timeline().get_phases();
+  ASSERT_EQ(phases.size(), 3U);
+  EXPECT_EQ(phases.at(0).name, "configure");
+  EXPECT_EQ(phases.at(1).name, "wait_inputs");
+  EXPECT_EQ(phases.at(2).name, "ready");
+}
+
+TEST_F(LifecycleGateTest, ActivateWithoutInputs)
+{
+  autoware::node::LifecycleGate gate(node_.get(), {});
+  EXPECT_EQ(gate.get_state(), LifecycleState::UNCONFIGURED);
+  spin_some();
+  EXPECT_TRUE(gate.is_active());
+  EXPECT_FALSE(node_->startup_timeline().is_ready());
+}
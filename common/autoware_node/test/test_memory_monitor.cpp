@@ -0,0 +1,80 @@
+// Copyright 2025 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <autoware/node/memory_monitor.hpp>
+#include <autoware/node/node.hpp>
+#include <rclcpp/rclcpp.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+class MemoryMonitorTest : public ::testing::Test
+{
+public:
+  void SetUp() override
+  {
+    rclcpp::init(0, nullptr);
+    node_ = std::make_shared<autoware::node::Node>("test_node", "test_ns");
+  }
+
+  void TearDown() override
+  {
+    node_.reset();
+    rclcpp::shutdown();
+  }
+
+  std::shared_ptr<autoware::node::Node> node_;
+};
+
+TEST_F(MemoryMonitorTest, ReportOwners)
+{
+  using Usage = std::vector<std::pair<std::string, size_t>>;
+
+  EXPECT_EQ(node_->memory_monitor(), nullptr);
+  auto & monitor = node_->enable_memory_monitor();
+  EXPECT_EQ(node_->memory_monitor(), &monitor);
+  EXPECT_EQ(&node_->enable_memory_monitor(), &monitor);
+
+  std::vector<double> map(1000);
+  const auto map_id =
+    monitor.register_owner("map", [&map]() { return map.capacity() * sizeof(double); });
+  monitor.register_owner("workspace", []() { return size_t{100}; });
+  EXPECT_EQ(monitor.get_owner_usage(), (Usage{{"map", 8000}, {"workspace", 100}}));
+
+  // the estimate is evaluated at each call
+  map.resize(2000);
+  EXPECT_EQ(monitor.get_owner_usage().front(), (std::pair<std::string, size_t>{"map", 16000}));
+
+  // the estimate of the same name is replaced and keeps its position
+  monitor.register_owner("map", []() { return size_t{1}; });
+  EXPECT_EQ(monitor.get_owner_usage(), (Usage{{"map", 1}, {"workspace", 100}}));
+
+  monitor.unregister_owner(map_id);
+  EXPECT_EQ(monitor.get_owner_usage(), (Usage{{"workspace", 100}}));
+}
+
+TEST_F(MemoryMonitorTest, ProcessMemory)
+{
+  const auto rss_bytes = autoware::node::MemoryMonitor::get_process_rss_bytes();
+  ASSERT_TRUE(rss_bytes.has_value());
+  EXPECT_GT(*rss_bytes, 0U);
+
+  // the test is not linked with the allocation hook
+  EXPECT_FALSE(autoware::node::is_allocation_hook_loaded());
+  EXPECT_EQ(autoware::node::get_allocation_counts().allocation_num, 0U);
+}
@@ -0,0 +1,67 @@
+// Copyright 2025 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <autoware/node/node.hpp>
+#include <autoware/node/output_latency_publisher.hpp>
+#include <rclcpp/rclcpp.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <thread>
+
+class OutputLatencyPublisherTest : public ::testing::Test
+{
+public:
+  void SetUp() override
+  {
+    rclcpp::init(0, nullptr);
+    node_ = std::make_shared<autoware::node::Node>("test_node", "test_ns");
+  }
+
+  void TearDown() override
+  {
+    node_.reset();
+    rclcpp::shutdown();
+  }
+
+  std::shared_ptr<autoware::node::Node> node_;
+};
+
+TEST_F(OutputLatencyPublisherTest, OldestInput)
+{
+  autoware::node::OutputLatencyPublisher latency(node_.get(), "output");
+
+  // nothing is published without input
+  latency.begin();
+  latency.add_input(builtin_interfaces::msg::Time{});
+  latency.publish();
+  EXPECT_FALSE(latency.oldest_input_age_ms());
+  EXPECT_FALSE(latency.pipeline_latency_ms());
+
+  const auto now = node_->now();
+  latency.begin();
+  latency.add_input(now - rclcpp::Duration::from_seconds(0.1));
+  latency.add_input(now - rclcpp::Duration::from_seconds(0.3));
+  latency.add_input(now - rclcpp::Duration::from_seconds(0.2));
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  latency.publish();
+
+  ASSERT_TRUE(latency.oldest_input_age_ms());
+  EXPECT_GE(*latency.oldest_input_age_ms(), 300.0);
+  EXPECT_LT(*latency.oldest_input_age_ms(), 400.0);
+  ASSERT_TRUE(latency.pipeline_latency_ms());
+  EXPECT_GE(*latency.pipeline_latency_ms(), *latency.oldest_input_age_ms() + 10.0);
+}
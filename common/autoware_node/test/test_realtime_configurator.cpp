@@ -0,0 +1,121 @@
+// Copyright 2025 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <autoware/node/node.hpp>
+#include <autoware/node/realtime_configurator.hpp>
+#include <rclcpp/rclcpp.hpp>
+
+#include <gtest/gtest.h>
+#include <sched.h>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using autoware::node::apply_realtime_settings;
+using autoware::node::RealtimeSettings;
+
+namespace
+{
+// the first CPU the process may run on
+int64_t get_first_cpu()
+{
+  cpu_set_t cpu_set;
+  sched_getaffinity(0, sizeof(cpu_set), &cpu_set);
+  for (int64_t cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+    if (CPU_ISSET(cpu, &cpu_set)) {
+      return cpu;
+    }
+  }
+  return 0;
+}
+
+std::vector<int64_t> get_thread_cpus()
+{
+  cpu_set_t cpu_set;
+  sched_getaffinity(0, sizeof(cpu_set), &cpu_set);
+  std::vector<int64_t> cpus;
+  for (int64_t cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+    if (CPU_ISSET(cpu, &cpu_set)) {
+      cpus.push_back(cpu);
+    }
+  }
+  return cpus;
+}
+}  // namespace
+
+TEST(RealtimeSettings, DefaultIsNoop)
+{
+  EXPECT_TRUE(RealtimeSettings{}.is_default());
+  EXPECT_TRUE(apply_realtime_settings(RealtimeSettings{}).empty());
+}
+
+TEST(RealtimeSettings, ApplyToCallingThread)
+{
+  const auto cpu = get_first_cpu();
+  const auto process_cpus = get_thread_cpus();
+
+  // in another thread, so that the test process is not pinned
+  std::thread([cpu]() {
+    RealtimeSettings settings;
+    settings.cpu_affinity = {cpu};
+    settings.prefault_stack_bytes = 256 * 1024;
+    EXPECT_TRUE(apply_realtime_settings(settings).empty());
+    EXPECT_EQ(get_thread_cpus(), std::vector<int64_t>{cpu});
+  }).join();
+  EXPECT_EQ(get_thread_cpus(), process_cpus);
+}
+
+TEST(RealtimeSettings, ReportInvalidSettings)
+{
+  RealtimeSettings settings;
+  settings.cpu_affinity = {-1};
+  settings.sched_priority = 100;
+  settings.prefault_stack_bytes = int64_t{1} << 40;
+  EXPECT_EQ(apply_realtime_settings(settings).size(), 3U);
+}
+
+TEST(RealtimeConfigurator, ApplyParametersInFirstSpin)
+{
+  rclcpp::init(0, nullptr);
+  const auto cpu = get_first_cpu();
+  auto options = rclcpp::NodeOptions{}.parameter_overrides(
+    {rclcpp::Parameter("realtime.cpu_affinity", std::vector<int64_t>{cpu})});
+  const auto node = std::make_shared<autoware::node::Node>("test_node", "test_ns", options);
+  const auto & configurator = node->realtime_configurator();
+  EXPECT_EQ(configurator.settings().cpu_affinity, std::vector<int64_t>{cpu});
+  EXPECT_FALSE(configurator.is_applied());
+
+  // applied to the thread which spins the node
+  std::thread([&]() {
+    rclcpp::executors::SingleThreadedExecutor executor;
+    executor.add_node(node);
+    executor.spin_some(std::chrono::milliseconds(100));
+    EXPECT_TRUE(configurator.is_applied());
+    EXPECT_EQ(get_thread_cpus(), std::vector<int64_t>{cpu});
+  }).join();
+
+  rclcpp::shutdown();
+}
+
+TEST(RealtimeConfigurator, DefaultParametersAreApplied)
+{
+  rclcpp::init(0, nullptr);
+  const auto node = std::make_shared<autoware::node::Node>("test_node", "test_ns");
+  EXPECT_TRUE(node->realtime_configurator().settings().is_default());
+  EXPECT_TRUE(node->realtime_configurator().is_applied());
+  rclcpp::shutdown();
+}
@@ -0,0 +1,98 @@
+// Copyright 2025 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <autoware/node/node.hpp>
+#include <autoware/node/startup_timeline.hpp>
+#include <rclcpp/rclcpp.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+class StartupTimelineTest : public ::testing::Test
+{
+public:
+  void SetUp() override { rclcpp::init(0, nullptr); }
+
+  void TearDown() override { rclcpp::shutdown(); }
+};
+
+TEST_F(StartupTimelineTest, MarkPhases)
+{
+  auto node = std::make_shared<autoware::node::Node>("test_node", "test_ns");
+  auto & timeline = node->startup_timeline();
+  EXPECT_FALSE(timeline.is_ready());
+
+  timeline.mark_phase("load_map");
+  timeline.mark_phase("build_graph");
+  timeline.mark_ready();
+  EXPECT_TRUE(timeline.is_ready());
+
+  // the phases after the ready are ignored
+  timeline.mark_phase("late");
+  timeline.mark_ready();
+
+  const auto phases = timeline.get_phases();
+  ASSERT_EQ(phases.size(), 3U);
+  EXPECT_EQ(phases.at(0).name, "load_map");
+  EXPECT_EQ(phases.at(1).name, "build_graph");
+  EXPECT_EQ(phases.at(2).name, "ready");
+  EXPECT_GE(phases.at(0).end, timeline.get_construction_time());
+  EXPECT_GE(phases.at(2).end, phases.at(1).end);
+}
+
+TEST_F(StartupTimelineTest, WaitForReadiness)
+{
+  auto loader_a = std::make_shared<autoware::node::Node>("loader_a", "test_ns");
+  auto loader_b = std::make_shared<autoware::node::Node>("loader_b", "test_ns");
+  auto dependent = std::make_shared<rclcpp::Node>("dependent", "test_ns");
+
+  // loader_a is ready before the waiter, which receives its timeline as a late subscriber
+  loader_a->startup_timeline().mark_ready();
+  int ready_num = 0;
+  autoware::node::ReadinessWaiter waiter(
+    dependent.get(), {"/test_ns/loader_a", "/test_ns/loader_b"}, [&ready_num]() { ++ready_num; });
+
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(loader_a);
+  executor.add_node(loader_b);
+  executor.add_node(dependent);
+  const auto spin_for = [&executor](const std::chrono::milliseconds & duration) {
+    const auto end = std::chrono::steady_clock::now() + duration;
+    while (std::chrono::steady_clock::now() < end) {
+      executor.spin_some(std::chrono::milliseconds(10));
+    }
+  };
+
+  spin_for(std::chrono::milliseconds(200));
+  EXPECT_FALSE(waiter.is_ready());
+  EXPECT_EQ(waiter.get_waiting_nodes(), (std::vector<std::string>{"/test_ns/loader_b"}));
+
+  loader_b->startup_timeline().mark_ready();
+  spin_for(std::chrono::milliseconds(200));
+  EXPECT_TRUE(waiter.is_ready());
+  EXPECT_EQ(ready_num, 1);
+}
+
+TEST_F(StartupTimelineTest, WaitForNoNode)
+{
+  auto dependent = std::make_shared<rclcpp::Node>("dependent", "test_ns");
+  int ready_num = 0;
+  autoware::node::ReadinessWaiter waiter(dependent.get(), {}, [&ready_num]() { ++ready_num; });
+  EXPECT_TRUE(waiter.is_ready());
+  EXPECT_EQ(ready_num, 1);
+}
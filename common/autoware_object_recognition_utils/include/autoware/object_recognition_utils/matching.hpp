@@ -128,6 +128,94 @@ double get2dRecall(const T1 & source_object, const T2 & target_object)
 
   return std::min(1.0, intersection_area / target_area);
 }
+
+/// areas of the source and target polygons and of the intersections of all their pairs
+struct PairwiseIntersectionAreas
+{
+  std::vector<double> source_areas;
+  std::vector<double> target_areas;
+  /// indexed by [source index][target index]
+  std::vector<std::vector<double>> intersection_areas;
+};
+
+/**
+ * @brief calculate the intersection areas of all the pairs of the source and target polygons.
+ * Only the pairs whose bounding boxes overlap are intersected, and the intersection of two convex
+ * polygons is clipped on fixed-size vertex arrays without boost::geometry.
+ */
+PairwiseIntersectionAreas calcPairwiseIntersectionAreas(
+  const std::vector<Polygon2d> & source_polygons, const std::vector<Polygon2d> & target_polygons);
+
+template <class T>
+std::vector<Polygon2d> toPolygon2ds(const std::vector<T> & objects)
+{
+  std::vector<Polygon2d> polygons;
+  polygons.reserve(objects.size());
+  for (const auto & object : objects) {
+    polygons.push_back(autoware_utils_geometry::to_polygon2d(object));
+  }
+  return polygons;
+}
+
+template <class ScoreFunction>
+std::vector<std::vector<double>> getPairwiseScores(
+  const PairwiseIntersectionAreas & areas, const ScoreFunction & score_function)
+{
+  std::vector<std::vector<double>> scores(
+    areas.source_areas.size(), std::vector<double>(areas.target_areas.size(), 0.0));
+  for (size_t i = 0; i < areas.source_areas.size(); ++i) {
+    const double source_area = areas.source_areas.at(i);
+    if (source_area < MIN_AREA) continue;
+    for (size_t j = 0; j < areas.target_areas.size(); ++j) {
+      const double target_area = areas.target_areas.at(j);
+      const double intersection_area = areas.intersection_areas.at(i).at(j);
+      if (target_area < MIN_AREA || intersection_area < MIN_AREA) continue;
+      scores.at(i).at(j) = score_function(source_area, target_area, intersection_area);
+    }
+  }
+  return scores;
+}
+
+/// same as get2dIoU for all the pairs of the source and target objects, indexed by [source][target]
+template <class T1, class T2>
+std::vector<std::vector<double>> get2dIoUMatrix(
+  const std::vector<T1> & source_objects, const std::vector<T2> & target_objects,
+  const double min_union_area = 0.01)
+{
+  const auto areas =
+    calcPairwiseIntersectionAreas(toPolygon2ds(source_objects), toPolygon2ds(target_objects));
+  return getPairwiseScores(
+    areas, [&](const double source_area, const double target_area, const double intersection_area) {
+      const double union_area = source_area + target_area - intersection_area;
+      return union_area < min_union_area ? 0.0 : std::min(1.0, intersection_area / union_area);
+    });
+}
+
+/// same as get2dPrecision for all the pairs of the source and target objects
+template <class T1, class T2>
+std::vector<std::vector<double>> get2dPrecisionMatrix(
+  const std::vector<T1> & source_objects, const std::vector<T2> & target_objects)
+{
+  const auto areas =
+    calcPairwiseIntersectionAreas(toPolygon2ds(source_objects), toPolygon2ds(target_objects));
+  return getPairwiseScores(
+    areas, [](const double source_area, const double, const double intersection_area) {
+      return std::min(1.0, intersection_area / source_area);
+    });
+}
+
+/// same as get2dRecall for all the pairs of the source and target objects
+template <class T1, class T2>
+std::vector<std::vector<double>> get2dRecallMatrix(
+  const std::vector<T1> & source_objects, const std::vector<T2> & target_objects)
+{
+  const auto areas =
+    calcPairwiseIntersectionAreas(toPolygon2ds(source_objects), toPolygon2ds(target_objects));
+  return getPairwiseScores(
+    areas, [](const double, const double target_area, const double intersection_area) {
+      return std::min(1.0, intersection_area / target_area);
+    });
+}
 }  // namespace autoware::object_recognition_utils
 
 #endif  // AUTOWARE__OBJECT_RECOGNITION_UTILS__MATCHING_HPP_
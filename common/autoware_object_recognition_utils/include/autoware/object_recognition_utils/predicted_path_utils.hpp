@@ -61,6 +61,32 @@ autoware_perception_msgs::msg::PredictedPath resamplePredictedPath(
   const autoware_perception_msgs::msg::PredictedPath & path, const double sampling_time_interval,
   const double sampling_horizon, const bool use_spline_for_xy = true,
   const bool use_spline_for_z = false);
+
+/**
+ * @brief Resampling the predicted paths of many objects by the same time step vector. The work
+ * buffers are shared by all the paths, and the segments of the resampled time are located once
+ * for the consecutive paths with the same time step and size.
+ * @param paths Input predicted paths
+ * @param resampled_time resampled time at each resampling point
+ * @return resampled paths in the order of the input paths
+ */
+std::vector<autoware_perception_msgs::msg::PredictedPath> resamplePredictedPaths(
+  const std::vector<autoware_perception_msgs::msg::PredictedPath> & paths,
+  const std::vector<double> & resampled_time, const bool use_spline_for_xy = true,
+  const bool use_spline_for_z = false);
+
+/**
+ * @brief Resampling the predicted paths of many objects by sampling time interval, as
+ * resamplePredictedPath for each path with the work buffers shared by all the paths
+ * @param paths Input predicted paths
+ * @param sampling_time_interval sampling time interval for each point
+ * @param sampling_horizon sampling time horizon
+ * @return resampled paths in the order of the input paths
+ */
+std::vector<autoware_perception_msgs::msg::PredictedPath> resamplePredictedPaths(
+  const std::vector<autoware_perception_msgs::msg::PredictedPath> & paths,
+  const double sampling_time_interval, const double sampling_horizon,
+  const bool use_spline_for_xy = true, const bool use_spline_for_z = false);
 }  // namespace autoware::object_recognition_utils
 
 #endif  // AUTOWARE__OBJECT_RECOGNITION_UTILS__PREDICTED_PATH_UTILS_HPP_
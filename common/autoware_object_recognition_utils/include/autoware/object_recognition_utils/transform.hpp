@@ -18,6 +18,7 @@
 #include <pcl_ros/transforms.hpp>
 #include <tf2_eigen/tf2_eigen.hpp>
 
+#include <geometry_msgs/msg/pose_with_covariance.hpp>
 #include <geometry_msgs/msg/transform.hpp>
 #include <sensor_msgs/msg/point_cloud2.hpp>
 #include <sensor_msgs/msg/point_field.hpp>
@@ -29,6 +30,7 @@
 #include <tf2_ros/transform_listener.h>
 
 #include <string>
+#include <vector>
 
 namespace detail
 {
@@ -67,80 +69,108 @@ namespace detail
 
 namespace autoware::object_recognition_utils
 {
+/**
+ * @brief transform the poses in place by the same transform, in parallel over the poses
+ * @param transform_covariance if true, the covariances are also rotated by the transform
+ */
+void transformPosesWithCovariance(
+  const tf2::Transform & transform,
+  const std::vector<geometry_msgs::msg::PoseWithCovariance *> & poses_with_covariance,
+  const bool transform_covariance);
+
+/**
+ * @brief transform the points of the clouds in place by the same matrix, in parallel over the
+ * clouds, and set their frame id
+ */
+void transformPointClouds(
+  const Eigen::Matrix4f & matrix, const std::string & target_frame_id,
+  const std::vector<sensor_msgs::msg::PointCloud2 *> & clouds);
+
+/**
+ * @brief transform the objects to the target frame in place
+ * @return false if the transform is not available, in which case the message is not changed
+ */
 template <class T>
 bool transformObjects(
-  const T & input_msg, const std::string & target_frame_id, const tf2_ros::Buffer & tf_buffer,
-  T & output_msg)
+  T & msg, const std::string & target_frame_id, const tf2_ros::Buffer & tf_buffer)
 {
-  output_msg = input_msg;
+  if (msg.header.frame_id == target_frame_id) {
+    return true;
+  }
 
   // transform to world coordinate
-  if (input_msg.header.frame_id != target_frame_id) {
-    output_msg.header.frame_id = target_frame_id;
-    tf2::Transform tf_target2objects_world;
-    tf2::Transform tf_target2objects;
-    tf2::Transform tf_objects_world2objects;
-    {
-      const auto ros_target2objects_world = detail::getTransform(
-        tf_buffer, input_msg.header.frame_id, target_frame_id, input_msg.header.stamp);
-      if (!ros_target2objects_world) {
-        return false;
-      }
-      tf2::fromMsg(*ros_target2objects_world, tf_target2objects_world);
-    }
-    for (auto & object : output_msg.objects) {
-      auto & pose_with_cov = object.kinematics.pose_with_covariance;
-      tf2::fromMsg(pose_with_cov.pose, tf_objects_world2objects);
-      tf_target2objects = tf_target2objects_world * tf_objects_world2objects;
-      // transform pose, frame difference and object pose
-      tf2::toMsg(tf_target2objects, pose_with_cov.pose);
-      // transform covariance, only the frame difference
-      pose_with_cov.covariance =
-        tf2::transformCovariance(pose_with_cov.covariance, tf_target2objects_world);
-    }
+  const auto ros_target2objects_world =
+    detail::getTransform(tf_buffer, msg.header.frame_id, target_frame_id, msg.header.stamp);
+  if (!ros_target2objects_world) {
+    return false;
   }
+  tf2::Transform tf_target2objects_world;
+  tf2::fromMsg(*ros_target2objects_world, tf_target2objects_world);
+
+  std::vector<geometry_msgs::msg::PoseWithCovariance *> poses_with_covariance;
+  poses_with_covariance.reserve(msg.objects.size());
+  for (auto & object : msg.objects) {
+    poses_with_covariance.push_back(&object.kinematics.pose_with_covariance);
+  }
+  transformPosesWithCovariance(tf_target2objects_world, poses_with_covariance, true);
+  msg.header.frame_id = target_frame_id;
   return true;
 }
+
 template <class T>
-bool transformObjectsWithFeature(
+bool transformObjects(
   const T & input_msg, const std::string & target_frame_id, const tf2_ros::Buffer & tf_buffer,
   T & output_msg)
 {
   output_msg = input_msg;
-  if (input_msg.header.frame_id != target_frame_id) {
-    output_msg.header.frame_id = target_frame_id;
-    tf2::Transform tf_target2objects_world;
-    tf2::Transform tf_target2objects;
-    tf2::Transform tf_objects_world2objects;
-    const auto ros_target2objects_world = detail::getTransform(
-      tf_buffer, input_msg.header.frame_id, target_frame_id, input_msg.header.stamp);
-    if (!ros_target2objects_world) {
-      return false;
-    }
-    const auto tf_matrix = detail::getTransformMatrix(target_frame_id, input_msg.header, tf_buffer);
-    if (!tf_matrix) {
-      RCLCPP_WARN(
-        rclcpp::get_logger("object_recognition_utils:"), "failed to get transformed matrix");
-      return false;
-    }
-    for (auto & feature_object : output_msg.feature_objects) {
-      // transform object
-      tf2::fromMsg(
-        feature_object.object.kinematics.pose_with_covariance.pose, tf_objects_world2objects);
-      tf_target2objects = tf_target2objects_world * tf_objects_world2objects;
-      tf2::toMsg(tf_target2objects, feature_object.object.kinematics.pose_with_covariance.pose);
-
-      // transform cluster
-      sensor_msgs::msg::PointCloud2 transformed_cluster;
-      pcl_ros::transformPointCloud(*tf_matrix, feature_object.feature.cluster, transformed_cluster);
-      transformed_cluster.header.frame_id = target_frame_id;
-      feature_object.feature.cluster = transformed_cluster;
-    }
-    output_msg.header.frame_id = target_frame_id;
+  return transformObjects(output_msg, target_frame_id, tf_buffer);
+}
+
+/**
+ * @brief transform the objects and their clusters to the target frame in place, with the
+ * transform looked up once
+ * @return false if the transform is not available, in which case the message is not changed
+ */
+template <class T>
+bool transformObjectsWithFeature(
+  T & msg, const std::string & target_frame_id, const tf2_ros::Buffer & tf_buffer)
+{
+  if (msg.header.frame_id == target_frame_id) {
     return true;
   }
+
+  const auto ros_target2objects_world =
+    detail::getTransform(tf_buffer, msg.header.frame_id, target_frame_id, msg.header.stamp);
+  if (!ros_target2objects_world) {
+    return false;
+  }
+  tf2::Transform tf_target2objects_world;
+  tf2::fromMsg(*ros_target2objects_world, tf_target2objects_world);
+  const Eigen::Matrix4f tf_matrix =
+    tf2::transformToEigen(*ros_target2objects_world).matrix().cast<float>();
+
+  std::vector<geometry_msgs::msg::PoseWithCovariance *> poses_with_covariance;
+  std::vector<sensor_msgs::msg::PointCloud2 *> clusters;
+  poses_with_covariance.reserve(msg.feature_objects.size());
+  clusters.reserve(msg.feature_objects.size());
+  for (auto & feature_object : msg.feature_objects) {
+    poses_with_covariance.push_back(&feature_object.object.kinematics.pose_with_covariance);
+    clusters.push_back(&feature_object.feature.cluster);
+  }
+  transformPosesWithCovariance(tf_target2objects_world, poses_with_covariance, false);
+  transformPointClouds(tf_matrix, target_frame_id, clusters);
+  msg.header.frame_id = target_frame_id;
   return true;
 }
+
+template <class T>
+bool transformObjectsWithFeature(
+  const T & input_msg, const std::string & target_frame_id, const tf2_ros::Buffer & tf_buffer,
+  T & output_msg)
+{
+  output_msg = input_msg;
+  return transformObjectsWithFeature(output_msg, target_frame_id, tf_buffer);
+}
 }  // namespace autoware::object_recognition_utils
 
 #endif  // AUTOWARE__OBJECT_RECOGNITION_UTILS__TRANSFORM_HPP_
@@ -0,0 +1,199 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/object_recognition_utils/matching.hpp"
+
+#include <boost/geometry/index/rtree.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <iterator>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace autoware::object_recognition_utils
+{
+namespace
+{
+using autoware_utils_geometry::Box2d;
+using autoware_utils_geometry::Point2d;
+
+// the maximum number of vertices of a polygon clipped on the fixed-size arrays, which covers
+// the 4 vertices of a bounding box and the 6 vertices of a cylinder
+constexpr size_t max_convex_polygon_size = 16;
+
+struct ConvexPolygon
+{
+  // the intersection of two convex polygons has at most their total number of vertices
+  std::array<Point2d, max_convex_polygon_size * 2> points;
+  size_t size{0};
+};
+
+double cross(const Point2d & o, const Point2d & a, const Point2d & b)
+{
+  return (a.x() - o.x()) * (b.y() - o.y()) - (a.y() - o.y()) * (b.x() - o.x());
+}
+
+double calcArea(const ConvexPolygon & polygon)
+{
+  double area2 = 0.0;
+  for (size_t i = 0; i < polygon.size; ++i) {
+    const auto & p = polygon.points[i];
+    const auto & q = polygon.points[(i + 1) % polygon.size];
+    area2 += p.x() * q.y() - q.x() * p.y();
+  }
+  return std::abs(area2) * 0.5;
+}
+
+/**
+ * @brief get the vertices of the polygon without the closing point in counter-clockwise order
+ * @return std::nullopt if the polygon is not convex or has too many vertices
+ */
+std::optional<ConvexPolygon> toConvexPolygon(const Polygon2d & polygon)
+{
+  const auto & outer = polygon.outer();
+  if (!polygon.inners().empty() || outer.size() < 3) {
+    return std::nullopt;
+  }
+  const bool is_closed =
+    outer.front().x() == outer.back().x() && outer.front().y() == outer.back().y();
+  const size_t size = is_closed ? outer.size() - 1 : outer.size();
+  if (size < 3 || size > max_convex_polygon_size) {
+    return std::nullopt;
+  }
+
+  ConvexPolygon convex_polygon;
+  convex_polygon.size = size;
+  std::copy(outer.begin(), std::next(outer.begin(), size), convex_polygon.points.begin());
+  double signed_area2 = 0.0;
+  for (size_t i = 0; i < size; ++i) {
+    signed_area2 += cross(
+      convex_polygon.points[0], convex_polygon.points[i], convex_polygon.points[(i + 1) % size]);
+  }
+  if (signed_area2 < 0.0) {
+    std::reverse(convex_polygon.points.begin(), std::next(convex_polygon.points.begin(), size));
+  }
+
+  // NOTE: collinear vertices are allowed with a tolerance for the rounding errors
+  constexpr double max_concave_cross = -1e-9;
+  for (size_t i = 0; i < size; ++i) {
+    if (
+      cross(
+        convex_polygon.points[i], convex_polygon.points[(i + 1) % size],
+        convex_polygon.points[(i + 2) % size]) < max_concave_cross) {
+      return std::nullopt;
+    }
+  }
+  return convex_polygon;
+}
+
+/**
+ * @brief calculate the intersection area of two convex polygons by clipping the subject polygon
+ * with each edge of the clip polygon (Sutherland-Hodgman)
+ * @return std::nullopt if the clipped polygon does not fit in the array due to rounding errors
+ */
+std::optional<double> calcConvexIntersectionArea(
+  const ConvexPolygon & subject, const ConvexPolygon & clip)
+{
+  ConvexPolygon output = subject;
+  ConvexPolygon input;
+  for (size_t i = 0; i < clip.size && output.size != 0; ++i) {
+    const auto & a = clip.points[i];
+    const auto & b = clip.points[(i + 1) % clip.size];
+    std::swap(input, output);
+    output.size = 0;
+    for (size_t j = 0; j < input.size; ++j) {
+      const auto & p = input.points[j];
+      const auto & q = input.points[(j + 1) % input.size];
+      const double p_side = cross(a, b, p);
+      const double q_side = cross(a, b, q);
+      const bool is_p_inside = p_side >= 0.0;
+      const size_t added_size = (is_p_inside ? 1 : 0) + (is_p_inside != (q_side >= 0.0) ? 1 : 0);
+      if (output.size + added_size > output.points.size()) {
+        return std::nullopt;
+      }
+      if (is_p_inside) {
+        output.points[output.size++] = p;
+      }
+      if (is_p_inside != (q_side >= 0.0)) {
+        const double ratio = p_side / (p_side - q_side);
+        output.points[output.size++] =
+          Point2d(p.x() + ratio * (q.x() - p.x()), p.y() + ratio * (q.y() - p.y()));
+      }
+    }
+  }
+  return output.size < 3 ? 0.0 : calcArea(output);
+}
+}  // namespace
+
+PairwiseIntersectionAreas calcPairwiseIntersectionAreas(
+  const std::vector<Polygon2d> & source_polygons, const std::vector<Polygon2d> & target_polygons)
+{
+  namespace bgi = boost::geometry::index;
+  using RtreeNode = std::pair<Box2d, size_t>;
+
+  PairwiseIntersectionAreas areas;
+  areas.source_areas.reserve(source_polygons.size());
+  for (const auto & polygon : source_polygons) {
+    areas.source_areas.push_back(boost::geometry::area(polygon));
+  }
+  areas.target_areas.reserve(target_polygons.size());
+  for (const auto & polygon : target_polygons) {
+    areas.target_areas.push_back(boost::geometry::area(polygon));
+  }
+  areas.intersection_areas.assign(
+    source_polygons.size(), std::vector<double>(target_polygons.size(), 0.0));
+
+  // broad phase: only the pairs whose bounding boxes overlap are intersected
+  std::vector<RtreeNode> target_nodes;
+  std::vector<std::optional<ConvexPolygon>> target_convex_polygons;
+  target_nodes.reserve(target_polygons.size());
+  target_convex_polygons.reserve(target_polygons.size());
+  for (size_t i = 0; i < target_polygons.size(); ++i) {
+    target_nodes.emplace_back(boost::geometry::return_envelope<Box2d>(target_polygons[i]), i);
+    target_convex_polygons.push_back(toConvexPolygon(target_polygons[i]));
+  }
+  const bgi::rtree<RtreeNode, bgi::rstar<16>> target_rtree(target_nodes);
+
+  std::vector<RtreeNode> candidates;
+  for (size_t i = 0; i < source_polygons.size(); ++i) {
+    if (areas.source_areas[i] < MIN_AREA) {
+      continue;
+    }
+    const auto source_convex_polygon = toConvexPolygon(source_polygons[i]);
+    candidates.clear();
+    target_rtree.query(
+      bgi::intersects(boost::geometry::return_envelope<Box2d>(source_polygons[i])),
+      std::back_inserter(candidates));
+    for (const auto & candidate : candidates) {
+      const size_t j = candidate.second;
+      if (areas.target_areas[j] < MIN_AREA) {
+        continue;
+      }
+      // narrow phase: the convex polygons are clipped, and the others fall back to boost
+      std::optional<double> intersection_area;
+      if (source_convex_polygon && target_convex_polygons[j]) {
+        intersection_area =
+          calcConvexIntersectionArea(*source_convex_polygon, *target_convex_polygons[j]);
+      }
+      areas.intersection_areas[i][j] =
+        intersection_area ? *intersection_area
+                          : getIntersectionArea(source_polygons[i], target_polygons[j]);
+    }
+  }
+  return areas;
+}
+}  // namespace autoware::object_recognition_utils
@@ -15,14 +15,142 @@
 #include "autoware/object_recognition_utils/predicted_path_utils.hpp"
 
 #include "autoware/interpolation/linear_interpolation.hpp"
+#include "autoware/interpolation/query_segments.hpp"
 #include "autoware/interpolation/spherical_linear_interpolation.hpp"
 #include "autoware/interpolation/spline_interpolation.hpp"
 
 #include <algorithm>
+#include <cmath>
+#include <optional>
+#include <stdexcept>
+#include <utility>
 #include <vector>
 
 namespace autoware::object_recognition_utils
 {
+using autoware_perception_msgs::msg::PredictedPath;
+
+namespace
+{
+/**
+ * @brief resampler of predicted paths which keeps its work buffers and spline across the paths,
+ * and locates the segments of the resampled time again only when the time keys change, e.g. once
+ * for all the paths of the objects predicted with the same time step and size
+ */
+class PredictedPathResampler
+{
+public:
+  PredictedPathResampler(const bool use_spline_for_xy, const bool use_spline_for_z)
+  : use_spline_for_xy_(use_spline_for_xy), use_spline_for_z_(use_spline_for_z)
+  {
+  }
+
+  PredictedPath resample(const PredictedPath & path, const std::vector<double> & resampled_time)
+  {
+    if (path.path.empty() || resampled_time.empty()) {
+      throw std::invalid_argument("input path or resampled_time is empty");
+    }
+
+    const double time_step = rclcpp::Duration(path.time_step).seconds();
+    const size_t size = path.path.size();
+    x_.resize(size);
+    y_.resize(size);
+    z_.resize(size);
+    quat_.resize(size);
+    for (size_t i = 0; i < size; ++i) {
+      x_[i] = path.path[i].position.x;
+      y_[i] = path.path[i].position.y;
+      z_[i] = path.path[i].position.z;
+      quat_[i] = path.path[i].orientation;
+    }
+    const auto & segments = getSegments(time_step, size, resampled_time);
+
+    const auto interpolate = [&](const std::vector<double> & input, const bool use_spline) {
+      if (!use_spline) {
+        return autoware::interpolation::lerp(segments, input);
+      }
+      spline_.calcSplineCoefficients(input_time_, input);
+      return spline_.getSplineInterpolatedValues(segments);
+    };
+    const auto interpolated_x = interpolate(x_, use_spline_for_xy_);
+    const auto interpolated_y = interpolate(y_, use_spline_for_xy_);
+    const auto interpolated_z = interpolate(z_, use_spline_for_z_);
+    const auto interpolated_quat = autoware::interpolation::slerp(segments, quat_);
+
+    PredictedPath resampled_path;
+    const auto resampled_size = std::min(resampled_path.path.max_size(), resampled_time.size());
+    resampled_path.confidence = path.confidence;
+    resampled_path.path.resize(resampled_size);
+
+    // Set Position
+    for (size_t i = 0; i < resampled_size; ++i) {
+      const auto p = autoware_utils_geometry::create_point(
+        interpolated_x.at(i), interpolated_y.at(i), interpolated_z.at(i));
+      resampled_path.path.at(i).position = p;
+      resampled_path.path.at(i).orientation = interpolated_quat.at(i);
+    }
+
+    return resampled_path;
+  }
+
+private:
+  const autoware::interpolation::QuerySegments & getSegments(
+    const double time_step, const size_t size, const std::vector<double> & resampled_time)
+  {
+    if (
+      !segments_ || time_step != segments_time_step_ || size != input_time_.size() ||
+      resampled_time != segments_resampled_time_) {
+      input_time_.resize(size);
+      for (size_t i = 0; i < size; ++i) {
+        input_time_[i] = time_step * i;
+      }
+      segments_.emplace(input_time_, resampled_time);
+      segments_time_step_ = time_step;
+      segments_resampled_time_ = resampled_time;
+    }
+    return *segments_;
+  }
+
+  bool use_spline_for_xy_;
+  bool use_spline_for_z_;
+
+  std::vector<double> x_;
+  std::vector<double> y_;
+  std::vector<double> z_;
+  std::vector<geometry_msgs::msg::Quaternion> quat_;
+  autoware::interpolation::SplineInterpolation spline_;
+
+  std::vector<double> input_time_;
+  double segments_time_step_{0.0};
+  std::vector<double> segments_resampled_time_;
+  std::optional<autoware::interpolation::QuerySegments> segments_;
+};
+
+void validateSamplingTime(const double sampling_time_interval, const double sampling_horizon)
+{
+  if (sampling_time_interval <= 0.0 || sampling_horizon <= 0.0) {
+    throw std::invalid_argument("sampling time interval or sampling time horizon is negative");
+  }
+}
+
+std::vector<double> calcSamplingTimeVector(
+  const PredictedPath & path, const double sampling_time_interval, const double sampling_horizon)
+{
+  // Calculate Horizon
+  const double predicted_horizon =
+    rclcpp::Duration(path.time_step).seconds() * static_cast<double>(path.path.size() - 1);
+  const double horizon = std::min(predicted_horizon, sampling_horizon);
+
+  // Get sampling time vector
+  constexpr double epsilon = 1e-6;
+  std::vector<double> sampling_time_vector;
+  for (double t = 0.0; t < horizon + epsilon; t += sampling_time_interval) {
+    sampling_time_vector.push_back(t);
+  }
+  return sampling_time_vector;
+}
+}  // namespace
+
 boost::optional<geometry_msgs::msg::Pose> calcInterpolatedPose(
   const autoware_perception_msgs::msg::PredictedPath & path, const double relative_time)
 {
@@ -31,19 +159,32 @@ boost::optional<geometry_msgs::msg::Pose> calcInterpolatedPose(
     return boost::none;
   }
 
+  // the segment is the first one whose end time is after the relative time, which is calculated
+  // from the time step and then corrected for the rounding errors of the division
   constexpr double epsilon = 1e-6;
   const double & time_step = rclcpp::Duration(path.time_step).seconds();
-  for (size_t path_idx = 1; path_idx < path.path.size(); ++path_idx) {
-    const auto & pt = path.path.at(path_idx);
-    const auto & prev_pt = path.path.at(path_idx - 1);
-    if (relative_time - epsilon < time_step * path_idx) {
-      const double offset = relative_time - time_step * (path_idx - 1);
-      const double ratio = std::clamp(offset / time_step, 0.0, 1.0);
-      return autoware_utils_geometry::calc_interpolated_pose(prev_pt, pt, ratio, false);
-    }
+  const double query_time = relative_time - epsilon;
+  size_t path_idx = 1;
+  if (time_step > 0.0 && query_time > 0.0) {
+    path_idx = static_cast<size_t>(std::min(
+                 std::floor(query_time / time_step), static_cast<double>(path.path.size()))) +
+               1;
+  }
+  while (path_idx > 1 && query_time < time_step * (path_idx - 1)) {
+    --path_idx;
+  }
+  while (path_idx < path.path.size() && !(query_time < time_step * path_idx)) {
+    ++path_idx;
+  }
+  if (path_idx >= path.path.size()) {
+    return boost::none;
   }
 
-  return boost::none;
+  const auto & pt = path.path.at(path_idx);
+  const auto & prev_pt = path.path.at(path_idx - 1);
+  const double offset = relative_time - time_step * (path_idx - 1);
+  const double ratio = std::clamp(offset / time_step, 0.0, 1.0);
+  return autoware_utils_geometry::calc_interpolated_pose(prev_pt, pt, ratio, false);
 }
 
 autoware_perception_msgs::msg::PredictedPath resamplePredictedPath(
@@ -51,53 +192,7 @@ autoware_perception_msgs::msg::PredictedPath resamplePredictedPath(
   const std::vector<double> & resampled_time, const bool use_spline_for_xy,
   const bool use_spline_for_z)
 {
-  if (path.path.empty() || resampled_time.empty()) {
-    throw std::invalid_argument("input path or resampled_time is empty");
-  }
-
-  const double & time_step = rclcpp::Duration(path.time_step).seconds();
-  std::vector<double> input_time(path.path.size());
-  std::vector<double> x(path.path.size());
-  std::vector<double> y(path.path.size());
-  std::vector<double> z(path.path.size());
-  std::vector<geometry_msgs::msg::Quaternion> quat(path.path.size());
-  for (size_t i = 0; i < path.path.size(); ++i) {
-    input_time.at(i) = time_step * i;
-    x.at(i) = path.path.at(i).position.x;
-    y.at(i) = path.path.at(i).position.y;
-    z.at(i) = path.path.at(i).position.z;
-    quat.at(i) = path.path.at(i).orientation;
-  }
-
-  const auto lerp = [&](const auto & input) {
-    return autoware::interpolation::lerp(input_time, input, resampled_time);
-  };
-  const auto spline = [&](const auto & input) {
-    return autoware::interpolation::spline(input_time, input, resampled_time);
-  };
-  const auto slerp = [&](const auto & input) {
-    return autoware::interpolation::slerp(input_time, input, resampled_time);
-  };
-
-  const auto interpolated_x = use_spline_for_xy ? spline(x) : lerp(x);
-  const auto interpolated_y = use_spline_for_xy ? spline(y) : lerp(y);
-  const auto interpolated_z = use_spline_for_z ? spline(z) : lerp(z);
-  const auto interpolated_quat = slerp(quat);
-
-  autoware_perception_msgs::msg::PredictedPath resampled_path;
-  const auto resampled_size = std::min(resampled_path.path.max_size(), resampled_time.size());
-  resampled_path.confidence = path.confidence;
-  resampled_path.path.resize(resampled_size);
-
-  // Set Position
-  for (size_t i = 0; i < resampled_size; ++i) {
-    const auto p = autoware_utils_geometry::create_point(
-      interpolated_x.at(i), interpolated_y.at(i), interpolated_z.at(i));
-    resampled_path.path.at(i).position = p;
-    resampled_path.path.at(i).orientation = interpolated_quat.at(i);
-  }
-
-  return resampled_path;
+  return PredictedPathResampler(use_spline_for_xy, use_spline_for_z).resample(path, resampled_time);
 }
 
 autoware_perception_msgs::msg::PredictedPath resamplePredictedPath(
@@ -107,27 +202,57 @@ autoware_perception_msgs::msg::PredictedPath resamplePredictedPath(
   if (path.path.empty()) {
     throw std::invalid_argument("Predicted Path is empty");
   }
+  validateSamplingTime(sampling_time_interval, sampling_horizon);
 
-  if (sampling_time_interval <= 0.0 || sampling_horizon <= 0.0) {
-    throw std::invalid_argument("sampling time interval or sampling time horizon is negative");
+  // Resample and substitute time interval
+  auto resampled_path = resamplePredictedPath(
+    path, calcSamplingTimeVector(path, sampling_time_interval, sampling_horizon),
+    use_spline_for_xy, use_spline_for_z);
+  resampled_path.time_step = rclcpp::Duration::from_seconds(sampling_time_interval);
+  return resampled_path;
+}
+
+std::vector<autoware_perception_msgs::msg::PredictedPath> resamplePredictedPaths(
+  const std::vector<autoware_perception_msgs::msg::PredictedPath> & paths,
+  const std::vector<double> & resampled_time, const bool use_spline_for_xy,
+  const bool use_spline_for_z)
+{
+  PredictedPathResampler resampler(use_spline_for_xy, use_spline_for_z);
+  std::vector<PredictedPath> resampled_paths;
+  resampled_paths.reserve(paths.size());
+  for (const auto & path : paths) {
+    resampled_paths.push_back(resampler.resample(path, resampled_time));
   }
+  return resampled_paths;
+}
 
-  // Calculate Horizon
-  const double predicted_horizon =
-    rclcpp::Duration(path.time_step).seconds() * static_cast<double>(path.path.size() - 1);
-  const double horizon = std::min(predicted_horizon, sampling_horizon);
+std::vector<autoware_perception_msgs::msg::PredictedPath> resamplePredictedPaths(
+  const std::vector<autoware_perception_msgs::msg::PredictedPath> & paths,
+  const double sampling_time_interval, const double sampling_horizon, const bool use_spline_for_xy,
+  const bool use_spline_for_z)
+{
+  validateSamplingTime(sampling_time_interval, sampling_horizon);
 
-  // Get sampling time vector
-  constexpr double epsilon = 1e-6;
+  PredictedPathResampler resampler(use_spline_for_xy, use_spline_for_z);
+  std::vector<PredictedPath> resampled_paths;
+  resampled_paths.reserve(paths.size());
   std::vector<double> sampling_time_vector;
-  for (double t = 0.0; t < horizon + epsilon; t += sampling_time_interval) {
-    sampling_time_vector.push_back(t);
+  std::optional<std::pair<builtin_interfaces::msg::Duration, size_t>> sampled_path_key;
+  for (const auto & path : paths) {
+    if (path.path.empty()) {
+      throw std::invalid_argument("Predicted Path is empty");
+    }
+    // the sampling time only depends on the time step and the size of the path
+    if (
+      !sampled_path_key || sampled_path_key->first != path.time_step ||
+      sampled_path_key->second != path.path.size()) {
+      sampling_time_vector = calcSamplingTimeVector(path, sampling_time_interval, sampling_horizon);
+      sampled_path_key.emplace(path.time_step, path.path.size());
+    }
+    auto resampled_path = resampler.resample(path, sampling_time_vector);
+    resampled_path.time_step = rclcpp::Duration::from_seconds(sampling_time_interval);
+    resampled_paths.push_back(std::move(resampled_path));
   }
-
-  // Resample and substitute time interval
-  auto resampled_path =
-    resamplePredictedPath(path, sampling_time_vector, use_spline_for_xy, use_spline_for_z);
-  resampled_path.time_step = rclcpp::Duration::from_seconds(sampling_time_interval);
-  return resampled_path;
+  return resampled_paths;
 }
 }  // namespace autoware::object_recognition_utils
@@ -0,0 +1,119 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/object_recognition_utils/transform.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace autoware::object_recognition_utils
+{
+namespace
+{
+// the objects are transformed in parallel only when there are many of them, since transforming
+// one pose is much cheaper than starting the threads
+constexpr int64_t min_parallel_pose_num = 64;
+
+std::optional<uint32_t> getFloatFieldOffset(
+  const sensor_msgs::msg::PointCloud2 & cloud, const std::string & name)
+{
+  const auto field = std::find_if(cloud.fields.begin(), cloud.fields.end(), [&](const auto & f) {
+    return f.name == name;
+  });
+  if (
+    field == cloud.fields.end() || field->datatype != sensor_msgs::msg::PointField::FLOAT32 ||
+    field->offset + sizeof(float) > cloud.point_step) {
+    return std::nullopt;
+  }
+  return field->offset;
+}
+
+/**
+ * @brief transform x, y and z of the points in the data buffer of the cloud
+ * @return false if the cloud does not have float x, y and z fields
+ */
+bool transformPointCloudInPlace(
+  const Eigen::Matrix4f & matrix, sensor_msgs::msg::PointCloud2 & cloud)
+{
+  const auto x_offset = getFloatFieldOffset(cloud, "x");
+  const auto y_offset = getFloatFieldOffset(cloud, "y");
+  const auto z_offset = getFloatFieldOffset(cloud, "z");
+  if (
+    !x_offset || !y_offset || !z_offset ||
+    cloud.data.size() < static_cast<size_t>(cloud.row_step) * cloud.height ||
+    cloud.row_step < static_cast<size_t>(cloud.point_step) * cloud.width) {
+    return false;
+  }
+
+  const Eigen::Matrix3f rotation = matrix.topLeftCorner<3, 3>();
+  const Eigen::Vector3f translation = matrix.topRightCorner<3, 1>();
+  for (uint32_t row = 0; row < cloud.height; ++row) {
+    uint8_t * point = cloud.data.data() + static_cast<size_t>(row) * cloud.row_step;
+    for (uint32_t col = 0; col < cloud.width; ++col, point += cloud.point_step) {
+      Eigen::Vector3f p;
+      std::memcpy(&p.x(), point + *x_offset, sizeof(float));
+      std::memcpy(&p.y(), point + *y_offset, sizeof(float));
+      std::memcpy(&p.z(), point + *z_offset, sizeof(float));
+      const Eigen::Vector3f transformed = rotation * p + translation;
+      std::memcpy(point + *x_offset, &transformed.x(), sizeof(float));
+      std::memcpy(point + *y_offset, &transformed.y(), sizeof(float));
+      std::memcpy(point + *z_offset, &transformed.z(), sizeof(float));
+    }
+  }
+  return true;
+}
+}  // namespace
+
+void transformPosesWithCovariance(
+  const tf2::Transform & transform,
+  const std::vector<geometry_msgs::msg::PoseWithCovariance *> & poses_with_covariance,
+  const bool transform_covariance)
+{
+  const auto pose_num = static_cast<int64_t>(poses_with_covariance.size());
+#pragma omp parallel for if (pose_num >= min_parallel_pose_num)
+  for (int64_t i = 0; i < pose_num; ++i) {
+    auto & pose_with_cov = *poses_with_covariance[i];
+    tf2::Transform tf_objects_world2objects;
+    tf2::fromMsg(pose_with_cov.pose, tf_objects_world2objects);
+    // transform pose, frame difference and object pose
+    tf2::toMsg(transform * tf_objects_world2objects, pose_with_cov.pose);
+    // transform covariance, only the frame difference
+    if (transform_covariance) {
+      pose_with_cov.covariance = tf2::transformCovariance(pose_with_cov.covariance, transform);
+    }
+  }
+}
+
+void transformPointClouds(
+  const Eigen::Matrix4f & matrix, const std::string & target_frame_id,
+  const std::vector<sensor_msgs::msg::PointCloud2 *> & clouds)
+{
+  const auto cloud_num = static_cast<int64_t>(clouds.size());
+#pragma omp parallel for schedule(dynamic) if (cloud_num > 1)
+  for (int64_t i = 0; i < cloud_num; ++i) {
+    auto & cloud = *clouds[i];
+    if (!transformPointCloudInPlace(matrix, cloud)) {
+      sensor_msgs::msg::PointCloud2 transformed_cloud;
+      pcl_ros::transformPointCloud(matrix, cloud, transformed_cloud);
+      cloud = std::move(transformed_cloud);
+    }
+    cloud.header.frame_id = target_frame_id;
+  }
+}
+}  // namespace autoware::object_recognition_utils
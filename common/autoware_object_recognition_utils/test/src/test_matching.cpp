@@ -20,6 +20,9 @@
 
 #include <gtest/gtest.h>
 
+#include <utility>
+#include <vector>
+
 using autoware_utils_geometry::Point2d;
 using autoware_utils_geometry::Point3d;
 
@@ -34,6 +37,25 @@ geometry_msgs::msg::Pose createPose(const double x, const double y, const double
   p.orientation = autoware_utils_geometry::create_quaternion_from_yaw(yaw);
   return p;
 }
+
+autoware_perception_msgs::msg::DetectedObject createObject(
+  const double x, const double y, const double yaw, const uint8_t type)
+{
+  autoware_perception_msgs::msg::DetectedObject obj;
+  obj.kinematics.pose_with_covariance.pose = createPose(x, y, yaw);
+  obj.shape.type = type;
+  obj.shape.dimensions.x = 2.0;
+  obj.shape.dimensions.y = 1.0;
+  if (type == autoware_perception_msgs::msg::Shape::POLYGON) {
+    // non-convex L shape
+    for (const auto & [px, py] : std::vector<std::pair<double, double>>{
+           {-1.0, -1.0}, {1.0, -1.0}, {1.0, 0.0}, {0.0, 0.0}, {0.0, 1.0}, {-1.0, 1.0}}) {
+      obj.shape.footprint.points.push_back(
+        geometry_msgs::build<geometry_msgs::msg::Point32>().x(px).y(py).z(0.0));
+    }
+  }
+  return obj;
+}
 }  // namespace
 
 TEST(matching, test_get2dIoU)
@@ -285,3 +307,44 @@ TEST(matching, test_get2dRecall)
     EXPECT_DOUBLE_EQ(reversed_recall, quart_circle * 4);
   }
 }
+
+TEST(matching, test_pairwise_matrices)
+{
+  using autoware::object_recognition_utils::get2dIoU;
+  using autoware::object_recognition_utils::get2dIoUMatrix;
+  using autoware::object_recognition_utils::get2dPrecision;
+  using autoware::object_recognition_utils::get2dPrecisionMatrix;
+  using autoware::object_recognition_utils::get2dRecall;
+  using autoware::object_recognition_utils::get2dRecallMatrix;
+  using autoware_perception_msgs::msg::DetectedObject;
+
+  const std::vector<uint8_t> types{
+    autoware_perception_msgs::msg::Shape::BOUNDING_BOX,
+    autoware_perception_msgs::msg::Shape::CYLINDER, autoware_perception_msgs::msg::Shape::POLYGON};
+  std::vector<DetectedObject> source_objs;
+  std::vector<DetectedObject> target_objs;
+  for (size_t i = 0; i < 9; ++i) {
+    const double offset = static_cast<double>(i);
+    source_objs.push_back(createObject(offset, 0.5 * offset, 0.3 * offset, types.at(i % 3)));
+    target_objs.push_back(
+      createObject(offset + 0.4, 0.5 * offset - 0.3, -0.2 * offset, types.at((i + 1) % 3)));
+  }
+  // far from all the source objects
+  target_objs.push_back(createObject(100.0, 100.0, 0.0, types.at(0)));
+
+  const auto ious = get2dIoUMatrix(source_objs, target_objs);
+  const auto precisions = get2dPrecisionMatrix(source_objs, target_objs);
+  const auto recalls = get2dRecallMatrix(source_objs, target_objs);
+  ASSERT_EQ(ious.size(), source_objs.size());
+  for (size_t i = 0; i < source_objs.size(); ++i) {
+    ASSERT_EQ(ious.at(i).size(), target_objs.size());
+    for (size_t j = 0; j < target_objs.size(); ++j) {
+      EXPECT_NEAR(ious.at(i).at(j), get2dIoU(source_objs.at(i), target_objs.at(j)), epsilon);
+      EXPECT_NEAR(
+        precisions.at(i).at(j), get2dPrecision(source_objs.at(i), target_objs.at(j)), epsilon);
+      EXPECT_NEAR(recalls.at(i).at(j), get2dRecall(source_objs.at(i), target_objs.at(j)), epsilon);
+    }
+    EXPECT_DOUBLE_EQ(ious.at(i).back(), 0.0);
+  }
+  EXPECT_GT(ious.at(0).at(0), 0.0);
+}
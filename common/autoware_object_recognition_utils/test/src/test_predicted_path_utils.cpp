@@ -297,3 +297,50 @@ TEST(predicted_path_utils, resamplePredictedPath_by_sampling_time)
     EXPECT_THROW(resamplePredictedPath(empty_path, 1.0, 10.0), std::invalid_argument);
   }
 }
+
+TEST(predicted_path_utils, resamplePredictedPaths)
+{
+  using autoware::object_recognition_utils::resamplePredictedPath;
+  using autoware::object_recognition_utils::resamplePredictedPaths;
+
+  // the paths with the same time step and size share the segments, and the others locate them
+  std::vector<PredictedPath> paths;
+  for (size_t i = 0; i < 6; ++i) {
+    const double time_step = i < 4 ? 0.5 : 1.0;
+    paths.push_back(createTestPredictedPath(10 + i / 2, time_step, 1.0 + 0.1 * i, 0.2 * i, 0.05));
+  }
+
+  const auto expect_same_paths = [](const PredictedPath & path, const PredictedPath & expected) {
+    EXPECT_EQ(path.time_step, expected.time_step);
+    ASSERT_EQ(path.path.size(), expected.path.size());
+    for (size_t i = 0; i < path.path.size(); ++i) {
+      EXPECT_NEAR(path.path.at(i).position.x, expected.path.at(i).position.x, epsilon);
+      EXPECT_NEAR(path.path.at(i).position.y, expected.path.at(i).position.y, epsilon);
+      EXPECT_NEAR(path.path.at(i).position.z, expected.path.at(i).position.z, epsilon);
+      EXPECT_NEAR(path.path.at(i).orientation.z, expected.path.at(i).orientation.z, epsilon);
+      EXPECT_NEAR(path.path.at(i).orientation.w, expected.path.at(i).orientation.w, epsilon);
+    }
+  };
+
+  {  // by vector
+    const std::vector<double> resampling_vec{0.0, 0.3, 1.2, 2.5, 4.0};
+    const auto resampled_paths = resamplePredictedPaths(paths, resampling_vec, true, true);
+    ASSERT_EQ(resampled_paths.size(), paths.size());
+    for (size_t i = 0; i < paths.size(); ++i) {
+      expect_same_paths(
+        resampled_paths.at(i), resamplePredictedPath(paths.at(i), resampling_vec, true, true));
+    }
+  }
+
+  {  // by sampling time
+    const auto resampled_paths = resamplePredictedPaths(paths, 0.3, 6.0, false);
+    ASSERT_EQ(resampled_paths.size(), paths.size());
+    for (size_t i = 0; i < paths.size(); ++i) {
+      expect_same_paths(resampled_paths.at(i), resamplePredictedPath(paths.at(i), 0.3, 6.0, false));
+    }
+  }
+
+  EXPECT_TRUE(resamplePredictedPaths({}, 0.3, 6.0).empty());
+  EXPECT_THROW(resamplePredictedPaths(paths, 0.0, 6.0), std::invalid_argument);
+  EXPECT_THROW(resamplePredictedPaths({PredictedPath{}}, 0.3, 6.0), std::invalid_argument);
+}
@@ -0,0 +1,114 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/object_recognition_utils/transform.hpp"
+
+#include <autoware_utils_geometry/geometry.hpp>
+
+#include <gtest/gtest.h>
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+#include <pcl_conversions/pcl_conversions.h>
+
+#include <vector>
+
+namespace
+{
+geometry_msgs::msg::Transform createTransform()
+{
+  geometry_msgs::msg::Transform transform;
+  transform.translation.x = 1.0;
+  transform.translation.y = -2.0;
+  transform.translation.z = 0.5;
+  transform.rotation = autoware_utils_geometry::create_quaternion_from_rpy(0.1, -0.2, 1.2);
+  return transform;
+}
+
+sensor_msgs::msg::PointCloud2 createCloud(const float offset)
+{
+  pcl::PointCloud<pcl::PointXYZI> pcl_cloud;
+  for (int i = 0; i < 10; ++i) {
+    const auto v = static_cast<float>(i) + offset;
+    pcl_cloud.push_back(pcl::PointXYZI(v, -v, 0.5f * v, v));
+  }
+  sensor_msgs::msg::PointCloud2 cloud;
+  pcl::toROSMsg(pcl_cloud, cloud);
+  cloud.header.frame_id = "base_link";
+  return cloud;
+}
+}  // namespace
+
+TEST(transform, transformPointClouds)
+{
+  using autoware::object_recognition_utils::transformPointClouds;
+
+  const Eigen::Matrix4f matrix = tf2::transformToEigen(createTransform()).matrix().cast<float>();
+  std::vector<sensor_msgs::msg::PointCloud2> clouds{createCloud(0.0f), createCloud(3.0f)};
+  std::vector<sensor_msgs::msg::PointCloud2> expected_clouds(clouds.size());
+  std::vector<sensor_msgs::msg::PointCloud2 *> cloud_ptrs;
+  for (size_t i = 0; i < clouds.size(); ++i) {
+    pcl_ros::transformPointCloud(matrix, clouds.at(i), expected_clouds.at(i));
+    cloud_ptrs.push_back(&clouds.at(i));
+  }
+
+  transformPointClouds(matrix, "map", cloud_ptrs);
+  for (size_t i = 0; i < clouds.size(); ++i) {
+    EXPECT_EQ(clouds.at(i).header.frame_id, "map");
+    pcl::PointCloud<pcl::PointXYZI> result;
+    pcl::PointCloud<pcl::PointXYZI> expected;
+    pcl::fromROSMsg(clouds.at(i), result);
+    pcl::fromROSMsg(expected_clouds.at(i), expected);
+    ASSERT_EQ(result.size(), expected.size());
+    for (size_t j = 0; j < result.size(); ++j) {
+      EXPECT_NEAR(result.at(j).x, expected.at(j).x, 1e-5);
+      EXPECT_NEAR(result.at(j).y, expected.at(j).y, 1e-5);
+      EXPECT_NEAR(result.at(j).z, expected.at(j).z, 1e-5);
+      // the other fields are not changed
+      EXPECT_FLOAT_EQ(result.at(j).intensity, static_cast<float>(j) + 3.0f * i);
+    }
+  }
+}
+
+TEST(transform, transformPosesWithCovariance)
+{
+  using autoware::object_recognition_utils::transformPosesWithCovariance;
+
+  tf2::Transform transform;
+  tf2::fromMsg(createTransform(), transform);
+
+  // more poses than the threshold of the parallel transform
+  std::vector<geometry_msgs::msg::PoseWithCovariance> poses(100);
+  std::vector<geometry_msgs::msg::PoseWithCovariance *> pose_ptrs;
+  for (size_t i = 0; i < poses.size(); ++i) {
+    poses.at(i).pose.position.x = static_cast<double>(i);
+    poses.at(i).pose.orientation = autoware_utils_geometry::create_quaternion_from_yaw(0.1 * i);
+    poses.at(i).covariance.at(0) = 1.0;
+    pose_ptrs.push_back(&poses.at(i));
+  }
+  const auto original_poses = poses;
+
+  transformPosesWithCovariance(transform, pose_ptrs, true);
+  for (size_t i = 0; i < poses.size(); ++i) {
+    tf2::Transform original;
+    tf2::fromMsg(original_poses.at(i).pose, original);
+    geometry_msgs::msg::Pose expected;
+    tf2::toMsg(transform * original, expected);
+    EXPECT_DOUBLE_EQ(poses.at(i).pose.position.x, expected.position.x);
+    EXPECT_DOUBLE_EQ(poses.at(i).pose.position.y, expected.position.y);
+    EXPECT_DOUBLE_EQ(poses.at(i).pose.orientation.z, expected.orientation.z);
+    EXPECT_EQ(
+      poses.at(i).covariance,
+      tf2::transformCovariance(original_poses.at(i).covariance, transform));
+  }
+}
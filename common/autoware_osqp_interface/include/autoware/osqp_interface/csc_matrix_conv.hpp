@@ -19,6 +19,7 @@
 #include "osqp/glob_opts.h"  // for 'c_int' type ('long' or 'long long')
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 #include <vector>
 
@@ -77,6 +78,17 @@ struct OSQP_INTERFACE_PUBLIC CSC_Matrix
 OSQP_INTERFACE_PUBLIC CSC_Matrix calCSCMatrix(const Eigen::MatrixXd & mat);
 /// \brief Calculate upper trapezoidal CSC matrix from square Eigen matrix
 OSQP_INTERFACE_PUBLIC CSC_Matrix calCSCMatrixTrapezoidal(const Eigen::MatrixXd & mat);
+/// \brief Calculate CSC matrix from Eigen sparse matrix, keeping its stored zeros
+OSQP_INTERFACE_PUBLIC CSC_Matrix calCSCMatrix(const Eigen::SparseMatrix<double> & mat);
+/// \brief Calculate upper trapezoidal CSC matrix from square Eigen sparse matrix
+OSQP_INTERFACE_PUBLIC CSC_Matrix calCSCMatrixTrapezoidal(const Eigen::SparseMatrix<double> & mat);
+/// \brief Calculate CSC matrix from triplets, summing up the duplicated entries
+OSQP_INTERFACE_PUBLIC CSC_Matrix calCSCMatrix(
+  const Eigen::Index rows, const Eigen::Index cols,
+  const std::vector<Eigen::Triplet<double>> & triplets);
+/// \brief Calculate upper trapezoidal CSC matrix from triplets of a (n, n) matrix
+OSQP_INTERFACE_PUBLIC CSC_Matrix calCSCMatrixTrapezoidal(
+  const Eigen::Index n, const std::vector<Eigen::Triplet<double>> & triplets);
 /// \brief Print the given CSC matrix to the standard output
 OSQP_INTERFACE_PUBLIC void printCSCMatrix(const CSC_Matrix & csc_mat);
 
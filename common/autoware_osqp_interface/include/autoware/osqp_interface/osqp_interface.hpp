@@ -127,6 +127,11 @@ public:
   OSQPResult optimize(
     const Eigen::MatrixXd & P, const Eigen::MatrixXd & A, const std::vector<double> & q,
     const std::vector<double> & l, const std::vector<double> & u);
+  /// \brief Solves convex quadratic programs (QPs) given as CSC matrices, without densifying them.
+  /// \details P is the upper trapezoidal part of the cost matrix, as from calCSCMatrixTrapezoidal.
+  OSQPResult optimize(
+    CSC_Matrix P, CSC_Matrix A, const std::vector<double> & q, const std::vector<double> & l,
+    const std::vector<double> & u);
 
   /// \brief Converts the input data and sets up the workspace object.
   /// \param P (n,n) matrix defining relations between parameters.
@@ -14,101 +14,58 @@
 
 #include "autoware/osqp_interface/csc_matrix_conv.hpp"
 
+#include <autoware/qp_interface/osqp_csc_matrix_conv.hpp>
+
 #include <Eigen/Core>
 #include <Eigen/SparseCore>
 
-#include <exception>
 #include <iostream>
+#include <utility>
 #include <vector>
 
 namespace autoware::osqp_interface
 {
-CSC_Matrix calCSCMatrix(const Eigen::MatrixXd & mat)
+namespace
 {
-  const size_t elem = static_cast<size_t>(mat.nonZeros());
-  const Eigen::Index rows = mat.rows();
-  const Eigen::Index cols = mat.cols();
-
-  std::vector<c_float> vals;
-  vals.reserve(elem);
-  std::vector<c_int> row_idxs;
-  row_idxs.reserve(elem);
-  std::vector<c_int> col_idxs;
-  col_idxs.reserve(elem);
-
-  // Construct CSC matrix arrays
-  c_float val;
-  c_int elem_count = 0;
-
-  col_idxs.push_back(0);
-
-  for (Eigen::Index j = 0; j < cols; j++) {    // col iteration
-    for (Eigen::Index i = 0; i < rows; i++) {  // row iteration
-      // Get values of nonzero elements
-      val = mat(i, j);
-      if (std::fabs(val) < 1e-9) {
-        continue;
-      }
-      elem_count += 1;
-
-      // Store values
-      vals.push_back(val);
-      row_idxs.push_back(i);
-    }
-
-    col_idxs.push_back(elem_count);
-  }
-
-  CSC_Matrix csc_matrix = {vals, row_idxs, col_idxs};
+// NOTE: the conversion is shared with autoware_qp_interface, whose CSC matrix only differs by the
+// member names.
+CSC_Matrix fromQPInterface(qp_interface::CSC_Matrix && mat)
+{
+  return CSC_Matrix{std::move(mat.vals_), std::move(mat.row_idxs_), std::move(mat.col_idxs_)};
+}
+}  // namespace
 
-  return csc_matrix;
+CSC_Matrix calCSCMatrix(const Eigen::MatrixXd & mat)
+{
+  return fromQPInterface(qp_interface::calCSCMatrix(mat));
 }
 
 CSC_Matrix calCSCMatrixTrapezoidal(const Eigen::MatrixXd & mat)
 {
-  const size_t elem = static_cast<size_t>(mat.nonZeros());
-  const Eigen::Index rows = mat.rows();
-  const Eigen::Index cols = mat.cols();
-
-  if (rows != cols) {
-    throw std::invalid_argument("Matrix must be square (n, n)");
-  }
-
-  std::vector<c_float> vals;
-  vals.reserve(elem);
-  std::vector<c_int> row_idxs;
-  row_idxs.reserve(elem);
-  std::vector<c_int> col_idxs;
-  col_idxs.reserve(elem);
-
-  // Construct CSC matrix arrays
-  c_float val;
-  Eigen::Index trap_last_idx = 0;
-  c_int elem_count = 0;
-
-  col_idxs.push_back(0);
-
-  for (Eigen::Index j = 0; j < cols; j++) {              // col iteration
-    for (Eigen::Index i = 0; i <= trap_last_idx; i++) {  // row iteration
-      // Get values of nonzero elements
-      val = mat(i, j);
-      if (std::fabs(val) < 1e-9) {
-        continue;
-      }
-      elem_count += 1;
+  return fromQPInterface(qp_interface::calCSCMatrixTrapezoidal(mat));
+}
 
-      // Store values
-      vals.push_back(val);
-      row_idxs.push_back(i);
-    }
+CSC_Matrix calCSCMatrix(const Eigen::SparseMatrix<double> & mat)
+{
+  return fromQPInterface(qp_interface::calCSCMatrix(mat));
+}
 
-    col_idxs.push_back(elem_count);
-    trap_last_idx += 1;
-  }
+CSC_Matrix calCSCMatrixTrapezoidal(const Eigen::SparseMatrix<double> & mat)
+{
+  return fromQPInterface(qp_interface::calCSCMatrixTrapezoidal(mat));
+}
 
-  CSC_Matrix csc_matrix = {vals, row_idxs, col_idxs};
+CSC_Matrix calCSCMatrix(
+  const Eigen::Index rows, const Eigen::Index cols,
+  const std::vector<Eigen::Triplet<double>> & triplets)
+{
+  return fromQPInterface(qp_interface::calCSCMatrix(rows, cols, triplets));
+}
 
-  return csc_matrix;
+CSC_Matrix calCSCMatrixTrapezoidal(
+  const Eigen::Index n, const std::vector<Eigen::Triplet<double>> & triplets)
+{
+  return fromQPInterface(qp_interface::calCSCMatrixTrapezoidal(n, triplets));
 }
 
 void printCSCMatrix(const CSC_Matrix & csc_mat)
@@ -23,6 +23,7 @@
 #include <memory>
 #include <string>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 namespace autoware::osqp_interface
@@ -414,6 +415,22 @@ OSQPResult OSQPInterface::optimize(
   return result;
 }
 
+OSQPResult OSQPInterface::optimize(
+  CSC_Matrix P, CSC_Matrix A, const std::vector<double> & q, const std::vector<double> & l,
+  const std::vector<double> & u)
+{
+  // Allocate memory for problem
+  initializeProblem(std::move(P), std::move(A), q, l, u);
+
+  // Run the solver on the stored problem representation.
+  OSQPResult result = solve();
+
+  m_work.reset();
+  m_work_initialized = false;
+
+  return result;
+}
+
 void OSQPInterface::logUnsolvedStatus(const std::string & prefix_message) const
 {
   const int status = getStatus();
@@ -16,6 +16,7 @@
 #include "gtest/gtest.h"
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 #include <iostream>
 #include <tuple>
@@ -109,6 +110,15 @@ TEST(TestOsqpInterface, BasicQp)
     check_result(result);
   }
 
+  {
+    // Define problem during optimization with csc matrix built from sparse matrices
+    autoware::osqp_interface::OSQPInterface osqp;
+    autoware::osqp_interface::OSQPResult result = osqp.optimize(
+      calCSCMatrixTrapezoidal(Eigen::SparseMatrix<double>(P.sparseView())),
+      calCSCMatrix(Eigen::SparseMatrix<double>(A.sparseView())), q, l, u);
+    check_result(result);
+  }
+
   {
     autoware::osqp_interface::OSQPResult result;
     // Dummy initial problem with csc matrix
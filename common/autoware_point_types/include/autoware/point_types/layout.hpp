@@ -0,0 +1,251 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__POINT_TYPES__LAYOUT_HPP_
+#define AUTOWARE__POINT_TYPES__LAYOUT_HPP_
+
+#include "autoware/point_types/types.hpp"
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+#include <sensor_msgs/msg/point_field.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace autoware::point_types
+{
+
+/// One field of a point type, as it appears in sensor_msgs::msg::PointCloud2::fields.
+struct FieldLayout
+{
+  const char * name;
+  std::uint32_t offset;
+  std::uint8_t datatype;
+};
+
+/// Compile-time layout of a point type in a PointCloud2 buffer.
+///   point_step, x_offset, y_offset, z_offset and intensity_offset are constant expressions, so
+///   that the loops templated on the layout access the fields at fixed offsets. fields lists the
+///   fields in the order of the message, and exact_field_num tells whether a compatible message
+///   has these fields only or may have more after them.
+template <typename PointT>
+struct PointLayout;
+
+template <>
+struct PointLayout<PointXYZI>
+{
+  using IntensityType = float;
+  static constexpr std::uint32_t point_step = sizeof(PointXYZI);
+  static constexpr std::uint32_t x_offset = offsetof(PointXYZI, x);
+  static constexpr std::uint32_t y_offset = offsetof(PointXYZI, y);
+  static constexpr std::uint32_t z_offset = offsetof(PointXYZI, z);
+  static constexpr std::uint32_t intensity_offset = offsetof(PointXYZI, intensity);
+  static constexpr bool exact_field_num = false;
+  static constexpr std::array<FieldLayout, 4> fields{{
+    {"x", x_offset, sensor_msgs::msg::PointField::FLOAT32},
+    {"y", y_offset, sensor_msgs::msg::PointField::FLOAT32},
+    {"z", z_offset, sensor_msgs::msg::PointField::FLOAT32},
+    {"intensity", intensity_offset, sensor_msgs::msg::PointField::FLOAT32},
+  }};
+};
+
+template <>
+struct PointLayout<PointXYZIRC>
+{
+  using IntensityType = std::uint8_t;
+  static constexpr std::uint32_t point_step = sizeof(PointXYZIRC);
+  static constexpr std::uint32_t x_offset = offsetof(PointXYZIRC, x);
+  static constexpr std::uint32_t y_offset = offsetof(PointXYZIRC, y);
+  static constexpr std::uint32_t z_offset = offsetof(PointXYZIRC, z);
+  static constexpr std::uint32_t intensity_offset = offsetof(PointXYZIRC, intensity);
+  static constexpr bool exact_field_num = false;
+  static constexpr std::array<FieldLayout, 6> fields{{
+    {"x", x_offset, sensor_msgs::msg::PointField::FLOAT32},
+    {"y", y_offset, sensor_msgs::msg::PointField::FLOAT32},
+    {"z", z_offset, sensor_msgs::msg::PointField::FLOAT32},
+    {"intensity", intensity_offset, sensor_msgs::msg::PointField::UINT8},
+    {"return_type", offsetof(PointXYZIRC, return_type), sensor_msgs::msg::PointField::UINT8},
+    {"channel", offsetof(PointXYZIRC, channel), sensor_msgs::msg::PointField::UINT16},
+  }};
+};
+
+template <>
+struct PointLayout<PointXYZIRADRT>
+{
+  using IntensityType = float;
+  static constexpr std::uint32_t point_step = sizeof(PointXYZIRADRT);
+  static constexpr std::uint32_t x_offset = offsetof(PointXYZIRADRT, x);
+  static constexpr std::uint32_t y_offset = offsetof(PointXYZIRADRT, y);
+  static constexpr std::uint32_t z_offset = offsetof(PointXYZIRADRT, z);
+  static constexpr std::uint32_t intensity_offset = offsetof(PointXYZIRADRT, intensity);
+  static constexpr bool exact_field_num = false;
+  static constexpr std::array<FieldLayout, 9> fields{{
+    {"x", x_offset, sensor_msgs::msg::PointField::FLOAT32},
+    {"y", y_offset, sensor_msgs::msg::PointField::FLOAT32},
+    {"z", z_offset, sensor_msgs::msg::PointField::FLOAT32},
+    {"intensity", intensity_offset, sensor_msgs::msg::PointField::FLOAT32},
+    {"ring", offsetof(PointXYZIRADRT, ring), sensor_msgs::msg::PointField::UINT16},
+    {"azimuth", offsetof(PointXYZIRADRT, azimuth), sensor_msgs::msg::PointField::FLOAT32},
+    {"distance", offsetof(PointXYZIRADRT, distance), sensor_msgs::msg::PointField::FLOAT32},
+    {"return_type", offsetof(PointXYZIRADRT, return_type), sensor_msgs::msg::PointField::UINT8},
+    {"time_stamp", offsetof(PointXYZIRADRT, time_stamp), sensor_msgs::msg::PointField::FLOAT64},
+  }};
+};
+
+template <>
+struct PointLayout<PointXYZIRCAEDT>
+{
+  using IntensityType = std::uint8_t;
+  static constexpr std::uint32_t point_step = sizeof(PointXYZIRCAEDT);
+  static constexpr std::uint32_t x_offset = offsetof(PointXYZIRCAEDT, x);
+  static constexpr std::uint32_t y_offset = offsetof(PointXYZIRCAEDT, y);
+  static constexpr std::uint32_t z_offset = offsetof(PointXYZIRCAEDT, z);
+  static constexpr std::uint32_t intensity_offset = offsetof(PointXYZIRCAEDT, intensity);
+  static constexpr bool exact_field_num = true;
+  static constexpr std::array<FieldLayout, 10> fields{{
+    {"x", x_offset, sensor_msgs::msg::PointField::FLOAT32},
+    {"y", y_offset, sensor_msgs::msg::PointField::FLOAT32},
+    {"z", z_offset, sensor_msgs::msg::PointField::FLOAT32},
+    {"intensity", intensity_offset, sensor_msgs::msg::PointField::UINT8},
+    {"return_type", offsetof(PointXYZIRCAEDT, return_type), sensor_msgs::msg::PointField::UINT8},
+    {"channel", offsetof(PointXYZIRCAEDT, channel), sensor_msgs::msg::PointField::UINT16},
+    {"azimuth", offsetof(PointXYZIRCAEDT, azimuth), sensor_msgs::msg::PointField::FLOAT32},
+    {"elevation", offsetof(PointXYZIRCAEDT, elevation), sensor_msgs::msg::PointField::FLOAT32},
+    {"distance", offsetof(PointXYZIRCAEDT, distance), sensor_msgs::msg::PointField::FLOAT32},
+    {"time_stamp", offsetof(PointXYZIRCAEDT, time_stamp), sensor_msgs::msg::PointField::UINT32},
+  }};
+};
+
+/// Same check as the is_data_layout_compatible_with_point_*() functions of memory.hpp, generated
+/// from PointLayout<PointT>.
+template <typename PointT>
+bool is_data_layout_compatible(const std::vector<sensor_msgs::msg::PointField> & fields)
+{
+  using Layout = PointLayout<PointT>;
+  constexpr std::size_t field_num = Layout::fields.size();
+  if (Layout::exact_field_num ? fields.size() != field_num : fields.size() < field_num) {
+    return false;
+  }
+  for (std::size_t i = 0; i < field_num; ++i) {
+    const auto & field = fields[i];
+    const auto & expected = Layout::fields[i];
+    if (
+      field.name != expected.name || field.offset != expected.offset ||
+      field.datatype != expected.datatype || field.count != 1) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename PointT>
+bool is_data_layout_compatible(const sensor_msgs::msg::PointCloud2 & input)
+{
+  return is_data_layout_compatible<PointT>(input.fields);
+}
+
+/// Typed view over the buffer of a PointCloud2 in the layout of PointT, without copy.
+///   The view is valid when the fields match PointLayout<PointT> and the point step is the size
+///   of PointT. The accessors read and write the fields at compile-time offsets through memcpy,
+///   which is free of alignment and aliasing issues and compiles to plain loads and stores.
+///   The view is mutable when CloudT is a non-const PointCloud2, it must not outlive the cloud
+///   and is invalidated when the cloud data are resized.
+template <typename PointT, typename CloudT = const sensor_msgs::msg::PointCloud2>
+class PointCloud2View
+{
+  static_assert(
+    std::is_same_v<std::remove_const_t<CloudT>, sensor_msgs::msg::PointCloud2>,
+    "PointCloud2View is a view over a sensor_msgs::msg::PointCloud2");
+
+public:
+  using Layout = PointLayout<PointT>;
+  using IntensityType = typename Layout::IntensityType;
+  using DataPointer =
+    std::conditional_t<std::is_const_v<CloudT>, const std::uint8_t *, std::uint8_t *>;
+
+  explicit PointCloud2View(CloudT & cloud)
+  : data_(cloud.data.data()),
+    valid_(
+      cloud.point_step == Layout::point_step &&
+      cloud.data.size() % Layout::point_step == 0 && is_data_layout_compatible<PointT>(cloud)),
+    size_(valid_ ? cloud.data.size() / Layout::point_step : 0)
+  {
+  }
+
+  bool valid() const { return valid_; }
+  std::size_t size() const { return size_; }
+  DataPointer data() const { return data_; }
+
+  float x(std::size_t i) const { return load<float>(i, Layout::x_offset); }
+  float y(std::size_t i) const { return load<float>(i, Layout::y_offset); }
+  float z(std::size_t i) const { return load<float>(i, Layout::z_offset); }
+  IntensityType intensity(std::size_t i) const
+  {
+    return load<IntensityType>(i, Layout::intensity_offset);
+  }
+
+  PointT point(std::size_t i) const
+  {
+    PointT point;
+    std::memcpy(&point, data_ + i * Layout::point_step, sizeof(PointT));
+    return point;
+  }
+
+  void set_xyz(std::size_t i, float x, float y, float z) const
+  {
+    store(i, Layout::x_offset, x);
+    store(i, Layout::y_offset, y);
+    store(i, Layout::z_offset, z);
+  }
+
+  void set_point(std::size_t i, const PointT & point) const
+  {
+    static_assert(!std::is_const_v<CloudT>, "set_point() needs a mutable view");
+    std::memcpy(data_ + i * Layout::point_step, &point, sizeof(PointT));
+  }
+
+private:
+  template <typename T>
+  T load(std::size_t i, std::uint32_t offset) const
+  {
+    T value;
+    std::memcpy(&value, data_ + i * Layout::point_step + offset, sizeof(T));
+    return value;
+  }
+
+  template <typename T>
+  void store(std::size_t i, std::uint32_t offset, const T & value) const
+  {
+    static_assert(!std::is_const_v<CloudT>, "the setters need a mutable view");
+    std::memcpy(data_ + i * Layout::point_step + offset, &value, sizeof(T));
+  }
+
+  DataPointer data_;
+  bool valid_;
+  std::size_t size_;
+};
+
+template <typename PointT, typename CloudT>
+PointCloud2View<PointT, CloudT> make_point_cloud2_view(CloudT & cloud)
+{
+  return PointCloud2View<PointT, CloudT>(cloud);
+}
+
+}  // namespace autoware::point_types
+
+#endif  // AUTOWARE__POINT_TYPES__LAYOUT_HPP_
@@ -0,0 +1,77 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__POINT_TYPES__PIPELINE_LATENCY_HPP_
+#define AUTOWARE__POINT_TYPES__PIPELINE_LATENCY_HPP_
+
+#include <builtin_interfaces/msg/time.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace autoware::point_types
+{
+
+/// Depth of the input queue of a point cloud stage. With process_latest_only, the queue keeps
+/// the newest cloud only: a cloud arriving while the stage is busy replaces the waiting one, so
+/// a stalled stage drops the oldest frames instead of accumulating latency.
+constexpr std::size_t input_queue_depth(bool process_latest_only, std::size_t max_queue_size)
+{
+  return process_latest_only ? 1 : max_queue_size;
+}
+
+/// Latency of one cloud through a stage.
+/// The sensor to stage entry latency is read once from the node clock at the entry, and the time
+/// spent in the stage is measured with the monotonic clock between entry and exit, so that a
+/// clock jump during the processing does not show up as stage latency.
+class StageLatency
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  /// Call when the stage starts processing a cloud, with its sensor stamp and the node time.
+  void enter(const builtin_interfaces::msg::Time & sensor_stamp, int64_t now_ns)
+  {
+    const int64_t stamp_ns =
+      static_cast<int64_t>(sensor_stamp.sec) * 1000000000LL + sensor_stamp.nanosec;
+    input_latency_ns_ = now_ns - stamp_ns;
+    entry_ = Clock::now();
+    exit_ = entry_;
+  }
+
+  /// Call when the stage hands the output over.
+  void exit() { exit_ = Clock::now(); }
+
+  /// Sensor stamp to stage entry, including the time spent in the upstream stages and queues.
+  double input_latency_ms() const { return static_cast<double>(input_latency_ns_) * 1e-6; }
+
+  /// Stage entry to stage exit, on the monotonic clock.
+  double stage_time_ms() const
+  {
+    return std::chrono::duration<double, std::milli>(exit_ - entry_).count();
+  }
+
+  /// Sensor stamp to stage output.
+  double end_to_end_latency_ms() const { return input_latency_ms() + stage_time_ms(); }
+
+private:
+  int64_t input_latency_ns_{0};
+  Clock::time_point entry_{};
+  Clock::time_point exit_{};
+};
+
+}  // namespace autoware::point_types
+
+#endif  // AUTOWARE__POINT_TYPES__PIPELINE_LATENCY_HPP_
@@ -0,0 +1,126 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/point_types/layout.hpp"
+#include "autoware/point_types/memory.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <vector>
+
+using autoware::point_types::PointCloud2View;
+using autoware::point_types::PointLayout;
+using autoware::point_types::PointXYZI;
+using autoware::point_types::PointXYZIRADRT;
+using autoware::point_types::PointXYZIRC;
+using autoware::point_types::PointXYZIRCAEDT;
+
+namespace
+{
+template <typename PointT>
+sensor_msgs::msg::PointCloud2 make_cloud(
+  const std::vector<sensor_msgs::msg::PointField> & fields, const std::vector<PointT> & points)
+{
+  sensor_msgs::msg::PointCloud2 cloud;
+  cloud.fields = fields;
+  cloud.point_step = sizeof(PointT);
+  cloud.width = points.size();
+  cloud.height = 1;
+  cloud.row_step = cloud.width * cloud.point_step;
+  cloud.data.resize(cloud.row_step);
+  std::memcpy(cloud.data.data(), points.data(), cloud.data.size());
+  return cloud;
+}
+}  // namespace
+
+TEST(PointLayout, OffsetsAreConstantExpressions)
+{
+  static_assert(PointLayout<PointXYZIRC>::x_offset == 0);
+  static_assert(PointLayout<PointXYZIRC>::z_offset == 8);
+  static_assert(PointLayout<PointXYZIRC>::intensity_offset == 12);
+  static_assert(PointLayout<PointXYZIRCAEDT>::point_step == sizeof(PointXYZIRCAEDT));
+  EXPECT_EQ(PointLayout<PointXYZIRCAEDT>::fields.size(), 10U);
+}
+
+TEST(PointLayout, MatchesRuntimeLayoutCheck)
+{
+  using autoware::point_types::is_data_layout_compatible;
+  namespace pt = autoware::point_types;
+  const auto xyzi = pt::create_fields_point_xyzi();
+  const auto xyzirc = pt::create_fields_point_xyzirc();
+  const auto xyziradrt = pt::create_fields_point_xyziradrt();
+  const auto xyzircaedt = pt::create_fields_point_xyzircaedt();
+
+  for (const auto & fields : {xyzi, xyzirc, xyziradrt, xyzircaedt}) {
+    EXPECT_EQ(
+      is_data_layout_compatible<PointXYZI>(fields),
+      pt::is_data_layout_compatible_with_point_xyzi(fields));
+    EXPECT_EQ(
+      is_data_layout_compatible<PointXYZIRC>(fields),
+      pt::is_data_layout_compatible_with_point_xyzirc(fields));
+    EXPECT_EQ(
+      is_data_layout_compatible<PointXYZIRADRT>(fields),
+      pt::is_data_layout_compatible_with_point_xyziradrt(fields));
+    EXPECT_EQ(
+      is_data_layout_compatible<PointXYZIRCAEDT>(fields),
+      pt::is_data_layout_compatible_with_point_xyzircaedt(fields));
+  }
+  EXPECT_TRUE(is_data_layout_compatible<PointXYZIRCAEDT>(xyzircaedt));
+  // PointXYZIRCAEDT starts with the fields of PointXYZIRC
+  EXPECT_TRUE(is_data_layout_compatible<PointXYZIRC>(xyzircaedt));
+  EXPECT_FALSE(is_data_layout_compatible<PointXYZI>(xyzirc));
+}
+
+TEST(PointCloud2View, ReadsAndWritesFields)
+{
+  std::vector<PointXYZIRC> points(3);
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    points[i].x = static_cast<float>(i);
+    points[i].y = static_cast<float>(i) + 0.5F;
+    points[i].z = -static_cast<float>(i);
+    points[i].intensity = static_cast<std::uint8_t>(10 * i);
+    points[i].channel = static_cast<std::uint16_t>(i + 1);
+  }
+  auto cloud = make_cloud(autoware::point_types::create_fields_point_xyzirc(), points);
+
+  const auto view = autoware::point_types::make_point_cloud2_view<PointXYZIRC>(
+    static_cast<const sensor_msgs::msg::PointCloud2 &>(cloud));
+  ASSERT_TRUE(view.valid());
+  ASSERT_EQ(view.size(), 3U);
+  EXPECT_FLOAT_EQ(view.x(2), 2.0F);
+  EXPECT_FLOAT_EQ(view.y(1), 1.5F);
+  EXPECT_FLOAT_EQ(view.z(2), -2.0F);
+  EXPECT_EQ(view.intensity(1), 10U);
+  EXPECT_EQ(view.point(2), points[2]);
+
+  PointCloud2View<PointXYZIRC, sensor_msgs::msg::PointCloud2> mutable_view(cloud);
+  mutable_view.set_xyz(0, 7.0F, 8.0F, 9.0F);
+  EXPECT_FLOAT_EQ(view.x(0), 7.0F);
+  EXPECT_FLOAT_EQ(view.z(0), 9.0F);
+  EXPECT_EQ(view.point(0).channel, 1U);
+}
+
+TEST(PointCloud2View, RejectsOtherLayouts)
+{
+  auto cloud = make_cloud(
+    autoware::point_types::create_fields_point_xyzirc(), std::vector<PointXYZIRC>(2));
+  EXPECT_FALSE(PointCloud2View<PointXYZI>(cloud).valid());
+  EXPECT_EQ(PointCloud2View<PointXYZI>(cloud).size(), 0U);
+
+  // padding after the fields changes the point step
+  cloud.point_step = sizeof(PointXYZIRC) + 4;
+  cloud.data.resize(2 * cloud.point_step);
+  EXPECT_FALSE(PointCloud2View<PointXYZIRC>(cloud).valid());
+}
@@ -0,0 +1,44 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/point_types/pipeline_latency.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+
+TEST(PipelineLatency, InputQueueDepth)
+{
+  EXPECT_EQ(autoware::point_types::input_queue_depth(true, 5), 1U);
+  EXPECT_EQ(autoware::point_types::input_queue_depth(false, 5), 5U);
+}
+
+TEST(PipelineLatency, StageLatency)
+{
+  builtin_interfaces::msg::Time stamp;
+  stamp.sec = 100;
+  stamp.nanosec = 500000000;
+
+  autoware::point_types::StageLatency latency;
+  // received 20 ms after the sensor stamp
+  latency.enter(stamp, 100520000000LL);
+  EXPECT_DOUBLE_EQ(latency.input_latency_ms(), 20.0);
+  EXPECT_DOUBLE_EQ(latency.stage_time_ms(), 0.0);
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  latency.exit();
+  EXPECT_GE(latency.stage_time_ms(), 5.0);
+  EXPECT_DOUBLE_EQ(latency.end_to_end_latency_ms(), 20.0 + latency.stage_time_ms());
+}
@@ -16,6 +16,7 @@
 #define AUTOWARE__QP_INTERFACE__OSQP_CSC_MATRIX_CONV_HPP_
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 #include <osqp/glob_opts.h>
 
@@ -38,6 +39,19 @@ struct CSC_Matrix
 CSC_Matrix calCSCMatrix(const Eigen::MatrixXd & mat);
 /// \brief Calculate upper trapezoidal CSC matrix from square Eigen matrix
 CSC_Matrix calCSCMatrixTrapezoidal(const Eigen::MatrixXd & mat);
+/// Sparse matrices keep their stored entries, zeros included, to keep a fixed sparsity pattern.
+CSC_Matrix calCSCMatrix(const Eigen::SparseMatrix<double> & mat);
+CSC_Matrix calCSCMatrixTrapezoidal(const Eigen::SparseMatrix<double> & mat);
+/// \brief Calculate CSC matrix from triplets without an intermediate matrix.
+/// It takes O(nnz + cols) for the few entries per column of the usual QP matrices.
+/// Triplets of the same entry are summed up as in Eigen::SparseMatrix::setFromTriplets.
+/// \throw std::invalid_argument if a triplet is out of the matrix
+CSC_Matrix calCSCMatrix(
+  const Eigen::Index rows, const Eigen::Index cols,
+  const std::vector<Eigen::Triplet<double>> & triplets);
+/// \brief Calculate upper trapezoidal CSC matrix from triplets of a (n, n) matrix
+CSC_Matrix calCSCMatrixTrapezoidal(
+  const Eigen::Index n, const std::vector<Eigen::Triplet<double>> & triplets);
 /// \brief Print the given CSC matrix to the standard output
 void printCSCMatrix(const CSC_Matrix & csc_mat);
 
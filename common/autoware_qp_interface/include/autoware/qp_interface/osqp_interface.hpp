@@ -22,6 +22,7 @@
 
 #include <limits>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -67,6 +68,7 @@ public:
   int getIterationNumber() const override;
   bool isSolved() const override;
   std::string getStatus() const override;
+  QPSettings getSettings() const override;
 
   int getPolishStatus() const;
   std::vector<double> getDualSolution() const;
@@ -109,7 +111,8 @@ public:
     return static_cast<std::string>(latest_work_info_.status);
   }
   /// \brief Get the runtime of the latest problem solved
-  inline double getRunTime() const { return latest_work_info_.run_time; }
+  /// \note It is always 0 unless OSQP is built with PROFILING.
+  inline double getRunTime() const override { return latest_work_info_.run_time; }
   /// \brief Get the objective value the latest problem solved
   inline double getObjVal() const { return latest_work_info_.obj_val; }
   /// \brief Returns flag asserting interface condition (Healthy condition: 0).
@@ -118,7 +121,7 @@ public:
   // Setter functions for warm start
   bool setWarmStart(
     const std::vector<double> & primal_variables, const std::vector<double> & dual_variables);
-  bool setPrimalVariables(const std::vector<double> & primal_variables);
+  bool setPrimalVariables(const std::vector<double> & primal_variables) override;
   bool setDualVariables(const std::vector<double> & dual_variables);
 
 private:
@@ -133,14 +136,16 @@ private:
   bool work__initialized = false;
   // Exitflag
   int64_t exitflag_;
+  // Initial guess of the primal variables for the next optimization
+  std::optional<std::vector<double>> primal_variables_{std::nullopt};
 
   void initializeProblemImpl(
     const Eigen::MatrixXd & P, const Eigen::MatrixXd & A, const std::vector<double> & q,
     const std::vector<double> & l, const std::vector<double> & u) override;
 
   void initializeCSCProblemImpl(
-    CSC_Matrix P, CSC_Matrix A, const std::vector<double> & q, const std::vector<double> & l,
-    const std::vector<double> & u);
+    const CSC_Matrix & P, const CSC_Matrix & A, const std::vector<double> & q,
+    const std::vector<double> & l, const std::vector<double> & u) override;
 
   std::vector<double> optimizeImpl() override;
 };
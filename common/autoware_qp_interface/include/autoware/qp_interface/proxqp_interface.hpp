@@ -22,6 +22,7 @@
 
 #include <limits>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -38,6 +39,12 @@ public:
   int getIterationNumber() const override;
   bool isSolved() const override;
   std::string getStatus() const override;
+  double getRunTime() const override;
+  QPSettings getSettings() const override;
+
+  /// \brief Warm start the next optimization from the given primal variables instead of the
+  /// previous result.
+  bool setPrimalVariables(const std::vector<double> & primal_variables) override;
 
   void updateEpsAbs(const double eps_abs) override;
   void updateEpsRel(const double eps_rel) override;
@@ -46,11 +53,20 @@ public:
 private:
   proxsuite::proxqp::Settings<double> settings_{};
   std::shared_ptr<proxsuite::proxqp::sparse::QP<double, int>> qp_ptr_{nullptr};
+  std::optional<Eigen::VectorXd> primal_variables_{std::nullopt};
 
   void initializeProblemImpl(
     const Eigen::MatrixXd & P, const Eigen::MatrixXd & A, const std::vector<double> & q,
     const std::vector<double> & l, const std::vector<double> & u) override;
 
+  void initializeCSCProblemImpl(
+    const CSC_Matrix & P, const CSC_Matrix & A, const std::vector<double> & q,
+    const std::vector<double> & l, const std::vector<double> & u) override;
+
+  void initializeSparseProblem(
+    const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+    const std::vector<double> & q, const std::vector<double> & l, const std::vector<double> & u);
+
   std::vector<double> optimizeImpl() override;
 };
 }  // namespace autoware::qp_interface
@@ -15,8 +15,12 @@
 #ifndef AUTOWARE__QP_INTERFACE__QP_INTERFACE_HPP_
 #define AUTOWARE__QP_INTERFACE__QP_INTERFACE_HPP_
 
+#include "autoware/qp_interface/osqp_csc_matrix_conv.hpp"
+#include "autoware/qp_interface/qp_problem_recorder.hpp"
+
 #include <Eigen/Core>
 
+#include <memory>
 #include <optional>
 #include <string>
 #include <vector>
@@ -32,10 +36,26 @@ public:
   std::vector<double> optimize(
     const Eigen::MatrixXd & P, const Eigen::MatrixXd & A, const std::vector<double> & q,
     const std::vector<double> & l, const std::vector<double> & u);
+  /// \brief Solve the problem given as CSC matrices, without densifying them.
+  /// \param P: upper triangular part of the (n,n) cost matrix.
+  /// \param A: (m,n) constraint matrix, where m is the size of l and u.
+  std::vector<double> optimize(
+    const CSC_Matrix & P, const CSC_Matrix & A, const std::vector<double> & q,
+    const std::vector<double> & l, const std::vector<double> & u);
 
   virtual bool isSolved() const = 0;
   virtual int getIterationNumber() const = 0;
   virtual std::string getStatus() const = 0;
+  /// \brief Get the time taken by the solver for the latest problem [s].
+  virtual double getRunTime() const = 0;
+
+  /// \brief Set the initial guess of the primal variables for the next optimization.
+  /// \return false if the size does not match the problem or the solver rejects it.
+  virtual bool setPrimalVariables(const std::vector<double> & primal_variables) = 0;
+
+  virtual QPSettings getSettings() const = 0;
+  /// \brief Record every optimized problem with the settings and the result. nullptr disables it.
+  void setProblemRecorder(std::shared_ptr<QPProblemRecorder> recorder) { recorder_ = recorder; }
 
   virtual void updateEpsAbs([[maybe_unused]] const double eps_abs) = 0;
   virtual void updateEpsRel([[maybe_unused]] const double eps_rel) = 0;
@@ -52,10 +72,24 @@ protected:
     const Eigen::MatrixXd & P, const Eigen::MatrixXd & A, const std::vector<double> & q,
     const std::vector<double> & l, const std::vector<double> & u) = 0;
 
+  void initializeCSCProblem(
+    const CSC_Matrix & P, const CSC_Matrix & A, const std::vector<double> & q,
+    const std::vector<double> & l, const std::vector<double> & u);
+
+  virtual void initializeCSCProblemImpl(
+    const CSC_Matrix & P, const CSC_Matrix & A, const std::vector<double> & q,
+    const std::vector<double> & l, const std::vector<double> & u) = 0;
+
   virtual std::vector<double> optimizeImpl() = 0;
 
+  void recordProblem(
+    const CSC_Matrix & P, const CSC_Matrix & A, const std::vector<double> & q,
+    const std::vector<double> & l, const std::vector<double> & u,
+    const double optimization_time) const;
+
   std::optional<size_t> variables_num_{std::nullopt};
   std::optional<size_t> constraints_num_{std::nullopt};
+  std::shared_ptr<QPProblemRecorder> recorder_{nullptr};
 };
 }  // namespace autoware::qp_interface
 
@@ -0,0 +1,79 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__QP_INTERFACE__QP_PROBLEM_RECORDER_HPP_
+#define AUTOWARE__QP_INTERFACE__QP_PROBLEM_RECORDER_HPP_
+
+#include "autoware/qp_interface/osqp_csc_matrix_conv.hpp"
+
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace autoware::qp_interface
+{
+/// \brief Settings of a QP solver, common to the backends
+struct QPSettings
+{
+  std::string solver_name;
+  bool enable_warm_start{false};
+  int max_iteration{0};
+  double eps_abs{0.0};
+  double eps_rel{0.0};
+};
+
+/// \brief Problem solved by a QPInterface with the settings and the result of the solve
+struct QPProblemRecord
+{
+  QPSettings settings;
+  /// upper triangular part of the (n,n) cost matrix
+  CSC_Matrix P;
+  /// (m,n) constraint matrix
+  CSC_Matrix A;
+  std::vector<double> q;
+  std::vector<double> l;
+  std::vector<double> u;
+
+  bool is_solved{false};
+  std::string status;
+  int iteration_num{0};
+  /// time taken by the solver [s]
+  double solver_time{0.0};
+  /// time taken by the whole optimization including the problem setup [s]
+  double optimization_time{0.0};
+};
+
+/// \brief Append the records to a binary file, to replay the problems offline.
+/// The file starts with a magic number and the format version, followed by the records as fixed
+/// size integers and doubles in the native byte order.
+class QPProblemRecorder
+{
+public:
+  /// \throw std::runtime_error if the file cannot be opened
+  explicit QPProblemRecorder(const std::string & file_path);
+
+  void record(const QPProblemRecord & record);
+
+private:
+  std::ofstream ofs_;
+  std::mutex mutex_;
+};
+
+/// \brief Read all the records of a file written by QPProblemRecorder.
+/// \throw std::runtime_error if the file cannot be opened or is not a record file
+std::vector<QPProblemRecord> readQPProblemRecords(const std::string & file_path);
+}  // namespace autoware::qp_interface
+
+#endif  // AUTOWARE__QP_INTERFACE__QP_PROBLEM_RECORDER_HPP_
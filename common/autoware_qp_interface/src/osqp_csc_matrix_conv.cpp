@@ -17,12 +17,87 @@
 #include <Eigen/Core>
 #include <Eigen/SparseCore>
 
+#include <algorithm>
 #include <exception>
 #include <iostream>
+#include <stdexcept>
+#include <utility>
 #include <vector>
 
 namespace autoware::qp_interface
 {
+namespace
+{
+CSC_Matrix buildCSCMatrix(
+  const Eigen::Index rows, const Eigen::Index cols,
+  const std::vector<Eigen::Triplet<double>> & triplets, const bool is_upper_trapezoidal)
+{
+  const auto is_stored = [&](const Eigen::Triplet<double> & t) {
+    return !is_upper_trapezoidal || t.row() <= t.col();
+  };
+
+  // bucket the entries by column with a counting sort
+  std::vector<c_int> col_idxs(static_cast<size_t>(cols) + 1, 0);
+  for (const auto & t : triplets) {
+    if (t.row() < 0 || rows <= t.row() || t.col() < 0 || cols <= t.col()) {
+      throw std::invalid_argument("Triplet is out of the matrix");
+    }
+    if (is_stored(t)) {
+      ++col_idxs[static_cast<size_t>(t.col()) + 1];
+    }
+  }
+  for (size_t j = 0; j < static_cast<size_t>(cols); ++j) {
+    col_idxs[j + 1] += col_idxs[j];
+  }
+  CSC_Matrix csc_matrix;
+  csc_matrix.vals_.resize(static_cast<size_t>(col_idxs.back()));
+  csc_matrix.row_idxs_.resize(static_cast<size_t>(col_idxs.back()));
+  std::vector<c_int> col_ends(col_idxs.begin(), col_idxs.end() - 1);
+  for (const auto & t : triplets) {
+    if (is_stored(t)) {
+      const auto idx = static_cast<size_t>(col_ends[static_cast<size_t>(t.col())]++);
+      csc_matrix.vals_[idx] = t.value();
+      csc_matrix.row_idxs_[idx] = static_cast<c_int>(t.row());
+    }
+  }
+
+  // sort the rows of each column, which are only a few, and sum up the duplicated entries in place
+  size_t stored_num = 0;
+  for (size_t j = 0; j < static_cast<size_t>(cols); ++j) {
+    const auto col_begin = static_cast<size_t>(col_idxs[j]);
+    const auto col_end = static_cast<size_t>(col_idxs[j + 1]);
+    for (size_t i = col_begin + 1; i < col_end; ++i) {
+      const auto row = csc_matrix.row_idxs_[i];
+      const auto val = csc_matrix.vals_[i];
+      size_t k = i;
+      for (; k > col_begin && csc_matrix.row_idxs_[k - 1] > row; --k) {
+        csc_matrix.row_idxs_[k] = csc_matrix.row_idxs_[k - 1];
+        csc_matrix.vals_[k] = csc_matrix.vals_[k - 1];
+      }
+      csc_matrix.row_idxs_[k] = row;
+      csc_matrix.vals_[k] = val;
+    }
+    col_idxs[j] = static_cast<c_int>(stored_num);
+    for (size_t i = col_begin; i < col_end; ++i) {
+      if (
+        stored_num > static_cast<size_t>(col_idxs[j]) &&
+        csc_matrix.row_idxs_[stored_num - 1] == csc_matrix.row_idxs_[i]) {
+        csc_matrix.vals_[stored_num - 1] += csc_matrix.vals_[i];
+        continue;
+      }
+      csc_matrix.row_idxs_[stored_num] = csc_matrix.row_idxs_[i];
+      csc_matrix.vals_[stored_num] = csc_matrix.vals_[i];
+      ++stored_num;
+    }
+  }
+  col_idxs.back() = static_cast<c_int>(stored_num);
+  csc_matrix.vals_.resize(stored_num);
+  csc_matrix.row_idxs_.resize(stored_num);
+  csc_matrix.col_idxs_ = std::move(col_idxs);
+  return csc_matrix;
+}
+}  // namespace
+
 CSC_Matrix calCSCMatrix(const Eigen::MatrixXd & mat)
 {
   const size_t elem = static_cast<size_t>(mat.nonZeros());
@@ -34,7 +109,7 @@ CSC_Matrix calCSCMatrix(const Eigen::MatrixXd & mat)
   std::vector<c_int> row_idxs;
   row_idxs.reserve(elem);
   std::vector<c_int> col_idxs;
-  col_idxs.reserve(elem);
+  col_idxs.reserve(static_cast<size_t>(cols) + 1);
 
   // Construct CSC matrix arrays
   c_float val;
@@ -79,7 +154,7 @@ CSC_Matrix calCSCMatrixTrapezoidal(const Eigen::MatrixXd & mat)
   std::vector<c_int> row_idxs;
   row_idxs.reserve(elem);
   std::vector<c_int> col_idxs;
-  col_idxs.reserve(elem);
+  col_idxs.reserve(static_cast<size_t>(cols) + 1);
 
   // Construct CSC matrix arrays
   c_float val;
@@ -111,6 +186,49 @@ CSC_Matrix calCSCMatrixTrapezoidal(const Eigen::MatrixXd & mat)
   return csc_matrix;
 }
 
+CSC_Matrix calCSCMatrix(const Eigen::SparseMatrix<double> & mat)
+{
+  const Eigen::Index cols = mat.cols();
+  CSC_Matrix csc_matrix;
+  csc_matrix.vals_.reserve(static_cast<size_t>(mat.nonZeros()));
+  csc_matrix.row_idxs_.reserve(static_cast<size_t>(mat.nonZeros()));
+  csc_matrix.col_idxs_.reserve(static_cast<size_t>(cols + 1));
+
+  csc_matrix.col_idxs_.push_back(0);
+  for (Eigen::Index j = 0; j < cols; j++) {  // col iteration
+    for (Eigen::SparseMatrix<double>::InnerIterator it(mat, j); it; ++it) {
+      csc_matrix.vals_.push_back(it.value());
+      csc_matrix.row_idxs_.push_back(static_cast<c_int>(it.row()));
+    }
+    csc_matrix.col_idxs_.push_back(static_cast<c_int>(csc_matrix.vals_.size()));
+  }
+
+  return csc_matrix;
+}
+
+CSC_Matrix calCSCMatrixTrapezoidal(const Eigen::SparseMatrix<double> & mat)
+{
+  if (mat.rows() != mat.cols()) {
+    throw std::invalid_argument("Matrix must be square (n, n)");
+  }
+
+  const Eigen::SparseMatrix<double> upper_mat = mat.triangularView<Eigen::Upper>();
+  return calCSCMatrix(upper_mat);
+}
+
+CSC_Matrix calCSCMatrix(
+  const Eigen::Index rows, const Eigen::Index cols,
+  const std::vector<Eigen::Triplet<double>> & triplets)
+{
+  return buildCSCMatrix(rows, cols, triplets, false);
+}
+
+CSC_Matrix calCSCMatrixTrapezoidal(
+  const Eigen::Index n, const std::vector<Eigen::Triplet<double>> & triplets)
+{
+  return buildCSCMatrix(n, n, triplets, true);
+}
+
 void printCSCMatrix(const CSC_Matrix & csc_mat)
 {
   std::cout << "[";
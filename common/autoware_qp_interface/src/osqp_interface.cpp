@@ -18,6 +18,7 @@
 
 #include <rclcpp/rclcpp.hpp>
 
+#include <chrono>
 #include <iostream>
 #include <memory>
 #include <string>
@@ -63,7 +64,7 @@ OSQPInterface::OSQPInterface(
   const c_float eps_abs)
 : OSQPInterface(enable_warm_start, OSQP_MAX_ITERATION, eps_abs)
 {
-  initializeCSCProblemImpl(P, A, q, l, u);
+  initializeCSCProblem(P, A, q, l, u);
 }
 
 OSQPInterface::~OSQPInterface()
@@ -82,8 +83,8 @@ void OSQPInterface::initializeProblemImpl(
 }
 
 void OSQPInterface::initializeCSCProblemImpl(
-  CSC_Matrix P_csc, CSC_Matrix A_csc, const std::vector<double> & q, const std::vector<double> & l,
-  const std::vector<double> & u)
+  const CSC_Matrix & P_csc, const CSC_Matrix & A_csc, const std::vector<double> & q,
+  const std::vector<double> & l, const std::vector<double> & u)
 {
   // Dynamic float arrays
   std::vector<double> q_tmp(q.begin(), q.end());
@@ -104,22 +105,46 @@ void OSQPInterface::initializeCSCProblemImpl(
    *****************/
   data_->n = param_n_;
   if (data_->P) free(data_->P);
+  // NOTE: csc_matrix only wraps the arrays without const, and osqp_setup copies them.
   data_->P = csc_matrix(
-    data_->n, data_->n, static_cast<c_int>(P_csc.vals_.size()), P_csc.vals_.data(),
-    P_csc.row_idxs_.data(), P_csc.col_idxs_.data());
+    data_->n, data_->n, static_cast<c_int>(P_csc.vals_.size()),
+    const_cast<c_float *>(P_csc.vals_.data()), const_cast<c_int *>(P_csc.row_idxs_.data()),
+    const_cast<c_int *>(P_csc.col_idxs_.data()));
   data_->q = q_dyn;
   if (data_->A) free(data_->A);
   data_->A = csc_matrix(
-    data_->m, data_->n, static_cast<c_int>(A_csc.vals_.size()), A_csc.vals_.data(),
-    A_csc.row_idxs_.data(), A_csc.col_idxs_.data());
+    data_->m, data_->n, static_cast<c_int>(A_csc.vals_.size()),
+    const_cast<c_float *>(A_csc.vals_.data()), const_cast<c_int *>(A_csc.row_idxs_.data()),
+    const_cast<c_int *>(A_csc.col_idxs_.data()));
   data_->l = l_dyn;
   data_->u = u_dyn;
 
+  // NOTE: osqp_setup discards the previous solution, so it is kept to warm start the new workspace
+  // of a problem with the same dimensions.
+  std::vector<c_float> prev_primal_variables;
+  std::vector<c_float> prev_dual_variables;
+  if (
+    enable_warm_start_ && work__initialized && work_ && work_->data->n == data_->n &&
+    work_->data->m == data_->m) {
+    prev_primal_variables.assign(work_->solution->x, work_->solution->x + data_->n);
+    prev_dual_variables.assign(work_->solution->y, work_->solution->y + data_->m);
+  }
+
   // Setup workspace
   OSQPWorkspace * workspace;
   exitflag_ = osqp_setup(&workspace, data_.get(), settings_.get());
   work_.reset(workspace);
   work__initialized = true;
+
+  if (exitflag_ == 0) {
+    if (!prev_primal_variables.empty()) {
+      osqp_warm_start(work_.get(), prev_primal_variables.data(), prev_dual_variables.data());
+    }
+    if (primal_variables_ && primal_variables_->size() == static_cast<size_t>(param_n_)) {
+      osqp_warm_start_x(work_.get(), primal_variables_->data());
+    }
+  }
+  primal_variables_ = std::nullopt;
 }
 
 void OSQPInterface::OSQPWorkspaceDeleter(OSQPWorkspace * ptr) noexcept
@@ -229,9 +254,15 @@ bool OSQPInterface::setWarmStart(
 
 bool OSQPInterface::setPrimalVariables(const std::vector<double> & primal_variables)
 {
+  // the initial guess is also applied to the workspace set up by the next optimization
+  primal_variables_ = primal_variables;
   if (!work__initialized) {
     return false;
   }
+  if (primal_variables.size() != static_cast<size_t>(param_n_)) {
+    std::cerr << "The size of the primal variables for warm start is invalid" << std::endl;
+    return false;
+  }
 
   const auto result = osqp_warm_start_x(work_.get(), primal_variables.data());
   if (result != 0) {
@@ -337,6 +368,17 @@ std::string OSQPInterface::getStatus() const
   return "OSQP_SOLVED";
 }
 
+QPSettings OSQPInterface::getSettings() const
+{
+  QPSettings settings;
+  settings.solver_name = "osqp";
+  settings.enable_warm_start = enable_warm_start_;
+  settings.max_iteration = static_cast<int>(settings_->max_iter);
+  settings.eps_abs = settings_->eps_abs;
+  settings.eps_rel = settings_->eps_rel;
+  return settings;
+}
+
 bool OSQPInterface::isSolved() const
 {
   return latest_work_info_.status_val == 1;
@@ -375,8 +417,14 @@ std::vector<double> OSQPInterface::optimize(
   CSC_Matrix P, CSC_Matrix A, const std::vector<double> & q, const std::vector<double> & l,
   const std::vector<double> & u)
 {
-  initializeCSCProblemImpl(P, A, q, l, u);
+  const auto start_time = std::chrono::steady_clock::now();
+  initializeCSCProblem(P, A, q, l, u);
   const auto result = optimizeImpl();
+  if (recorder_) {
+    recordProblem(
+      P, A, q, l, u,
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count());
+  }
 
   // show polish status if not successful
   const int status_polish = static_cast<int>(latest_work_info_.status_polish);
@@ -31,11 +31,34 @@ ProxQPInterface::ProxQPInterface(
   settings_.eps_abs = eps_abs;
   settings_.eps_rel = eps_rel;
   settings_.verbose = verbose;
+  settings_.compute_timings = true;
 }
 
 void ProxQPInterface::initializeProblemImpl(
   const Eigen::MatrixXd & P, const Eigen::MatrixXd & A, const std::vector<double> & q,
   const std::vector<double> & l, const std::vector<double> & u)
+{
+  initializeSparseProblem(P.sparseView(), A.sparseView(), q, l, u);
+}
+
+void ProxQPInterface::initializeCSCProblemImpl(
+  const CSC_Matrix & P, const CSC_Matrix & A, const std::vector<double> & q,
+  const std::vector<double> & l, const std::vector<double> & u)
+{
+  // NOTE: the sparse proxqp only uses the upper triangular part of P.
+  const auto to_sparse = [](const CSC_Matrix & mat, const size_t rows) {
+    const Eigen::Map<const Eigen::SparseMatrix<double, Eigen::ColMajor, c_int>> mat_map(
+      static_cast<Eigen::Index>(rows), static_cast<Eigen::Index>(mat.col_idxs_.size() - 1),
+      static_cast<Eigen::Index>(mat.vals_.size()), mat.col_idxs_.data(), mat.row_idxs_.data(),
+      mat.vals_.data());
+    return Eigen::SparseMatrix<double>(mat_map);
+  };
+  initializeSparseProblem(to_sparse(P, q.size()), to_sparse(A, l.size()), q, l, u);
+}
+
+void ProxQPInterface::initializeSparseProblem(
+  const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+  const std::vector<double> & q, const std::vector<double> & l, const std::vector<double> & u)
 {
   const size_t variables_num = q.size();
   const size_t constraints_num = l.size();
@@ -65,9 +88,6 @@ void ProxQPInterface::initializeProblemImpl(
 
   qp_ptr_->settings = settings_;
 
-  Eigen::SparseMatrix<double> P_sparse(variables_num, constraints_num);
-  P_sparse = P.sparseView();
-
   // NOTE: const std vector cannot be converted to eigen vector
   std::vector<double> non_const_q = q;
   Eigen::VectorXd eigen_q =
@@ -80,11 +100,9 @@ void ProxQPInterface::initializeProblemImpl(
     Eigen::Map<Eigen::VectorXd, Eigen::Unaligned>(u_std_vec.data(), u_std_vec.size());
 
   if (enable_warm_start) {
-    qp_ptr_->update(
-      P_sparse, eigen_q, proxsuite::nullopt, proxsuite::nullopt, A.sparseView(), eigen_l, eigen_u);
+    qp_ptr_->update(P, eigen_q, proxsuite::nullopt, proxsuite::nullopt, A, eigen_l, eigen_u);
   } else {
-    qp_ptr_->init(
-      P_sparse, eigen_q, proxsuite::nullopt, proxsuite::nullopt, A.sparseView(), eigen_l, eigen_u);
+    qp_ptr_->init(P, eigen_q, proxsuite::nullopt, proxsuite::nullopt, A, eigen_l, eigen_u);
   }
 }
 
@@ -103,6 +121,17 @@ void ProxQPInterface::updateVerbose(const bool is_verbose)
   settings_.verbose = is_verbose;
 }
 
+QPSettings ProxQPInterface::getSettings() const
+{
+  QPSettings settings;
+  settings.solver_name = "proxqp";
+  settings.enable_warm_start = enable_warm_start_;
+  settings.max_iteration = static_cast<int>(settings_.max_iter);
+  settings.eps_abs = settings_.eps_abs;
+  settings.eps_rel = settings_.eps_rel;
+  return settings;
+}
+
 bool ProxQPInterface::isSolved() const
 {
   if (qp_ptr_) {
@@ -119,6 +148,25 @@ int ProxQPInterface::getIterationNumber() const
   return 0;
 }
 
+double ProxQPInterface::getRunTime() const
+{
+  if (qp_ptr_) {
+    // NOTE: proxqp measures the run time in microseconds.
+    return qp_ptr_->results.info.run_time * 1.0e-6;
+  }
+  return 0.0;
+}
+
+bool ProxQPInterface::setPrimalVariables(const std::vector<double> & primal_variables)
+{
+  if (primal_variables.empty()) {
+    return false;
+  }
+  primal_variables_ = Eigen::Map<const Eigen::VectorXd>(
+    primal_variables.data(), static_cast<Eigen::Index>(primal_variables.size()));
+  return true;
+}
+
 std::string ProxQPInterface::getStatus() const
 {
   if (qp_ptr_) {
@@ -146,7 +194,14 @@ std::string ProxQPInterface::getStatus() const
 
 std::vector<double> ProxQPInterface::optimizeImpl()
 {
-  qp_ptr_->solve();
+  if (primal_variables_ && primal_variables_->size() == qp_ptr_->model.dim) {
+    qp_ptr_->settings.initial_guess = proxsuite::proxqp::InitialGuessStatus::WARM_START;
+    const Eigen::Ref<const Eigen::VectorXd> primal_variables = *primal_variables_;
+    qp_ptr_->solve(primal_variables, proxsuite::nullopt, proxsuite::nullopt);
+  } else {
+    qp_ptr_->solve();
+  }
+  primal_variables_ = std::nullopt;
 
   std::vector<double> result;
   result.reserve(qp_ptr_->results.x.size());
@@ -14,6 +14,8 @@
 
 #include "autoware/qp_interface/qp_interface.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -58,11 +60,94 @@ void QPInterface::initializeProblem(
   constraints_num_ = l.size();
 }
 
+void QPInterface::initializeCSCProblem(
+  const CSC_Matrix & P, const CSC_Matrix & A, const std::vector<double> & q,
+  const std::vector<double> & l, const std::vector<double> & u)
+{
+  // check if arguments are valid
+  std::stringstream ss;
+  if (P.col_idxs_.size() != q.size() + 1) {
+    ss << "P.cols() and q.size() are not the same. P.cols() = " << P.col_idxs_.size() - 1
+       << ", q.size() = " << q.size();
+    throw std::invalid_argument(ss.str());
+  }
+  if (A.col_idxs_.size() != q.size() + 1) {
+    ss << "A.cols() and q.size() are not the same. A.cols() = " << A.col_idxs_.size() - 1
+       << ", q.size() = " << q.size();
+    throw std::invalid_argument(ss.str());
+  }
+  if (l.size() != u.size()) {
+    ss << "l.size() and u.size() are not the same. l.size() = " << l.size()
+       << ", u.size() = " << u.size();
+    throw std::invalid_argument(ss.str());
+  }
+  const auto is_row_out_of_range = [](const CSC_Matrix & mat, const size_t rows) {
+    return std::any_of(mat.row_idxs_.begin(), mat.row_idxs_.end(), [&](const c_int row) {
+      return row < 0 || static_cast<size_t>(row) >= rows;
+    });
+  };
+  if (is_row_out_of_range(P, q.size())) {
+    ss << "P has a row index out of range. q.size() = " << q.size();
+    throw std::invalid_argument(ss.str());
+  }
+  if (is_row_out_of_range(A, l.size())) {
+    ss << "A has a row index out of range. l.size() = " << l.size();
+    throw std::invalid_argument(ss.str());
+  }
+
+  initializeCSCProblemImpl(P, A, q, l, u);
+
+  variables_num_ = q.size();
+  constraints_num_ = l.size();
+}
+
 std::vector<double> QPInterface::optimize(
   const Eigen::MatrixXd & P, const Eigen::MatrixXd & A, const std::vector<double> & q,
   const std::vector<double> & l, const std::vector<double> & u)
 {
+  const auto start_time = std::chrono::steady_clock::now();
   initializeProblem(P, A, q, l, u);
-  return optimizeImpl();
+  const auto result = optimizeImpl();
+  if (recorder_) {
+    recordProblem(
+      calCSCMatrixTrapezoidal(P), calCSCMatrix(A), q, l, u,
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count());
+  }
+  return result;
+}
+
+std::vector<double> QPInterface::optimize(
+  const CSC_Matrix & P, const CSC_Matrix & A, const std::vector<double> & q,
+  const std::vector<double> & l, const std::vector<double> & u)
+{
+  const auto start_time = std::chrono::steady_clock::now();
+  initializeCSCProblem(P, A, q, l, u);
+  const auto result = optimizeImpl();
+  if (recorder_) {
+    recordProblem(
+      P, A, q, l, u,
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count());
+  }
+  return result;
+}
+
+void QPInterface::recordProblem(
+  const CSC_Matrix & P, const CSC_Matrix & A, const std::vector<double> & q,
+  const std::vector<double> & l, const std::vector<double> & u,
+  const double optimization_time) const
+{
+  QPProblemRecord record;
+  record.settings = getSettings();
+  record.P = P;
+  record.A = A;
+  record.q = q;
+  record.l = l;
+  record.u = u;
+  record.is_solved = isSolved();
+  record.status = getStatus();
+  record.iteration_num = getIterationNumber();
+  record.solver_time = getRunTime();
+  record.optimization_time = optimization_time;
+  recorder_->record(record);
 }
 }  // namespace autoware::qp_interface
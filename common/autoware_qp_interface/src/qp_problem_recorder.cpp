@@ -0,0 +1,189 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/qp_interface/qp_problem_recorder.hpp"
+
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace autoware::qp_interface
+{
+namespace
+{
+constexpr uint32_t record_file_magic = 0x50514157;  // "WAQP"
+constexpr uint32_t record_file_version = 1;
+
+template <class T>
+void writeValue(std::ostream & os, const T value)
+{
+  os.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+void writeString(std::ostream & os, const std::string & str)
+{
+  writeValue(os, static_cast<uint64_t>(str.size()));
+  os.write(str.data(), static_cast<std::streamsize>(str.size()));
+}
+
+template <class T, class StoredT = T>
+void writeVector(std::ostream & os, const std::vector<T> & vec)
+{
+  writeValue(os, static_cast<uint64_t>(vec.size()));
+  for (const auto & value : vec) {
+    writeValue(os, static_cast<StoredT>(value));
+  }
+}
+
+void writeCSCMatrix(std::ostream & os, const CSC_Matrix & mat)
+{
+  writeVector(os, mat.vals_);
+  writeVector<c_int, int64_t>(os, mat.row_idxs_);
+  writeVector<c_int, int64_t>(os, mat.col_idxs_);
+}
+
+template <class T>
+T readValue(std::istream & is)
+{
+  T value{};
+  is.read(reinterpret_cast<char *>(&value), sizeof(T));
+  return value;
+}
+
+// NOTE: the sizes are checked against the stream to reject a truncated or corrupted file before
+// allocating.
+uint64_t readSize(std::istream & is, const size_t element_size)
+{
+  const auto size = readValue<uint64_t>(is);
+  if (!is) {
+    throw std::runtime_error("The QP problem record file is truncated.");
+  }
+  const auto pos = is.tellg();
+  is.seekg(0, std::ios::end);
+  const auto remaining_bytes = static_cast<uint64_t>(is.tellg() - pos);
+  is.seekg(pos);
+  if (size > remaining_bytes / element_size) {
+    throw std::runtime_error("The QP problem record file is corrupted.");
+  }
+  return size;
+}
+
+std::string readString(std::istream & is)
+{
+  std::string str(readSize(is, sizeof(char)), '\0');
+  is.read(str.data(), static_cast<std::streamsize>(str.size()));
+  return str;
+}
+
+template <class T, class StoredT = T>
+std::vector<T> readVector(std::istream & is)
+{
+  std::vector<T> vec(readSize(is, sizeof(StoredT)));
+  for (auto & value : vec) {
+    value = static_cast<T>(readValue<StoredT>(is));
+  }
+  return vec;
+}
+
+CSC_Matrix readCSCMatrix(std::istream & is)
+{
+  CSC_Matrix mat;
+  mat.vals_ = readVector<c_float>(is);
+  mat.row_idxs_ = readVector<c_int, int64_t>(is);
+  mat.col_idxs_ = readVector<c_int, int64_t>(is);
+  return mat;
+}
+}  // namespace
+
+QPProblemRecorder::QPProblemRecorder(const std::string & file_path)
+: ofs_(file_path, std::ios::binary | std::ios::trunc)
+{
+  if (!ofs_) {
+    throw std::runtime_error("Failed to open the QP problem record file: " + file_path);
+  }
+  writeValue(ofs_, record_file_magic);
+  writeValue(ofs_, record_file_version);
+  ofs_.flush();
+}
+
+void QPProblemRecorder::record(const QPProblemRecord & record)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  writeString(ofs_, record.settings.solver_name);
+  writeValue(ofs_, static_cast<uint8_t>(record.settings.enable_warm_start));
+  writeValue(ofs_, static_cast<int32_t>(record.settings.max_iteration));
+  writeValue(ofs_, record.settings.eps_abs);
+  writeValue(ofs_, record.settings.eps_rel);
+
+  writeCSCMatrix(ofs_, record.P);
+  writeCSCMatrix(ofs_, record.A);
+  writeVector(ofs_, record.q);
+  writeVector(ofs_, record.l);
+  writeVector(ofs_, record.u);
+
+  writeValue(ofs_, static_cast<uint8_t>(record.is_solved));
+  writeString(ofs_, record.status);
+  writeValue(ofs_, static_cast<int32_t>(record.iteration_num));
+  writeValue(ofs_, record.solver_time);
+  writeValue(ofs_, record.optimization_time);
+
+  // flush every record so that the file is usable even if the process is killed
+  ofs_.flush();
+}
+
+std::vector<QPProblemRecord> readQPProblemRecords(const std::string & file_path)
+{
+  std::ifstream ifs(file_path, std::ios::binary);
+  if (!ifs) {
+    throw std::runtime_error("Failed to open the QP problem record file: " + file_path);
+  }
+  const auto magic = readValue<uint32_t>(ifs);
+  const auto version = readValue<uint32_t>(ifs);
+  if (!ifs || magic != record_file_magic || version != record_file_version) {
+    throw std::runtime_error("Unsupported QP problem record file: " + file_path);
+  }
+
+  std::vector<QPProblemRecord> records;
+  while (ifs.peek() != std::ifstream::traits_type::eof()) {
+    QPProblemRecord record;
+    record.settings.solver_name = readString(ifs);
+    record.settings.enable_warm_start = readValue<uint8_t>(ifs) != 0;
+    record.settings.max_iteration = readValue<int32_t>(ifs);
+    record.settings.eps_abs = readValue<double>(ifs);
+    record.settings.eps_rel = readValue<double>(ifs);
+
+    record.P = readCSCMatrix(ifs);
+    record.A = readCSCMatrix(ifs);
+    record.q = readVector<double>(ifs);
+    record.l = readVector<double>(ifs);
+    record.u = readVector<double>(ifs);
+
+    record.is_solved = readValue<uint8_t>(ifs) != 0;
+    record.status = readString(ifs);
+    record.iteration_num = readValue<int32_t>(ifs);
+    record.solver_time = readValue<double>(ifs);
+    record.optimization_time = readValue<double>(ifs);
+    if (!ifs) {
+      throw std::runtime_error("The QP problem record file is truncated: " + file_path);
+    }
+    records.push_back(std::move(record));
+  }
+  return records;
+}
+}  // namespace autoware::qp_interface
@@ -0,0 +1,91 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Time per conversion to a CSC matrix of the constraint matrix of the jerk filtered velocity
+// smoother, from a dense matrix, from an Eigen sparse matrix and from triplets.
+// The (4N, 5N) matrix has 3 non-zero entries per row and the benchmark argument is N.
+
+#include "autoware/qp_interface/osqp_csc_matrix_conv.hpp"
+
+#include <Eigen/Core>
+#include <Eigen/SparseCore>
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+namespace
+{
+struct Fixture
+{
+  Eigen::Index rows;
+  Eigen::Index cols;
+  std::vector<Eigen::Triplet<double>> triplets;
+};
+
+Fixture create_fixture(const Eigen::Index N)
+{
+  Fixture f;
+  f.rows = 4 * N;
+  f.cols = 5 * N;
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<double> distribution(0.1, 1.0);
+  for (Eigen::Index i = 0; i < f.rows; ++i) {
+    const Eigen::Index col = i % N;
+    f.triplets.emplace_back(i, col, distribution(engine));
+    f.triplets.emplace_back(i, (col + 1) % N + N, distribution(engine));
+    f.triplets.emplace_back(i, i / N * N + col + N, distribution(engine));
+  }
+  return f;
+}
+
+Eigen::SparseMatrix<double> to_sparse(const Fixture & f)
+{
+  Eigen::SparseMatrix<double> mat(f.rows, f.cols);
+  mat.setFromTriplets(f.triplets.begin(), f.triplets.end());
+  return mat;
+}
+
+void BM_DenseMatrix(benchmark::State & state)
+{
+  const auto f = create_fixture(state.range(0));
+  const Eigen::MatrixXd mat(to_sparse(f));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(autoware::qp_interface::calCSCMatrix(mat));
+  }
+}
+
+void BM_SparseMatrix(benchmark::State & state)
+{
+  const auto f = create_fixture(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(autoware::qp_interface::calCSCMatrix(to_sparse(f)));
+  }
+}
+
+void BM_Triplets(benchmark::State & state)
+{
+  const auto f = create_fixture(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(autoware::qp_interface::calCSCMatrix(f.rows, f.cols, f.triplets));
+  }
+}
+}  // namespace
+
+BENCHMARK(BM_DenseMatrix)->Arg(100)->Arg(300)->Arg(1000);
+BENCHMARK(BM_SparseMatrix)->Arg(100)->Arg(300)->Arg(1000);
+BENCHMARK(BM_Triplets)->Arg(100)->Arg(300)->Arg(1000);
+
+BENCHMARK_MAIN();
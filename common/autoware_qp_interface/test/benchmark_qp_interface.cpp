@@ -0,0 +1,203 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Time per solve of the QP of the jerk filtered velocity smoother with OSQP and ProxQP, with and
+// without warm start from the previous result.
+// The QP is formulated as in autoware_velocity_smoother from a velocity limit profile of a cruise
+// at 15 m/s, a slow down to 5 m/s and a stop, resampled every 0.1 m over the benchmark argument
+// number of points.
+
+#include "autoware/qp_interface/osqp_interface.hpp"
+#include "autoware/qp_interface/proxqp_interface.hpp"
+
+#include <Eigen/Sparse>
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+using autoware::qp_interface::CSC_Matrix;
+using autoware::qp_interface::OSQPInterface;
+using autoware::qp_interface::ProxQPInterface;
+using autoware::qp_interface::QPInterface;
+
+struct Problem
+{
+  CSC_Matrix P;
+  CSC_Matrix A;
+  std::vector<double> q;
+  std::vector<double> l;
+  std::vector<double> u;
+};
+
+Problem create_jerk_filtered_problem(const size_t N)
+{
+  constexpr double ds = 0.1;
+  constexpr double v0 = 10.0;
+  constexpr double a_max = 1.0;
+  constexpr double a_min = -1.0;
+  constexpr double j_max = 1.0;
+  constexpr double j_min = -1.0;
+  constexpr double a_stop_decel = 0.0;
+  constexpr double jerk_weight = 10.0;
+  constexpr double over_v_weight = 100000.0;
+  constexpr double over_a_weight = 5000.0;
+  constexpr double over_j_weight = 2000.0;
+
+  std::vector<double> v_max(N, 15.0);
+  for (size_t i = N / 2; i < N; ++i) {
+    v_max.at(i) = 5.0;
+  }
+  v_max.back() = 0.0;
+
+  const size_t idx_b0 = 0;
+  const size_t idx_a0 = N;
+  const size_t idx_delta0 = 2 * N;
+  const size_t idx_sigma0 = 3 * N;
+  const size_t idx_gamma0 = 4 * N;
+  const size_t variables_num = 5 * N;
+  const size_t constraints_num = 4 * N;
+
+  Problem problem;
+  problem.q.assign(variables_num, 0.0);
+  problem.l.assign(constraints_num, 0.0);
+  problem.u.assign(constraints_num, 0.0);
+
+  std::vector<Eigen::Triplet<double>> P_triplets;
+  for (size_t i = 0; i + 1 < N; ++i) {
+    const double ref_vel = 0.5 * (v_max.at(i) + v_max.at(i + 1));
+    const double w = jerk_weight * (ref_vel / ds) * (ref_vel / ds) * ds;
+    P_triplets.emplace_back(idx_a0 + i, idx_a0 + i, w);
+    P_triplets.emplace_back(idx_a0 + i, idx_a0 + i + 1, -w);
+    P_triplets.emplace_back(idx_a0 + i + 1, idx_a0 + i, -w);
+    P_triplets.emplace_back(idx_a0 + i + 1, idx_a0 + i + 1, w);
+  }
+  for (size_t i = 0; i < N; ++i) {
+    if (v_max.at(i) > 0.01) {
+      problem.q.at(idx_b0 + i) = -ds / (v_max.at(i) * v_max.at(i));
+    }
+    P_triplets.emplace_back(idx_delta0 + i, idx_delta0 + i, over_v_weight);
+    P_triplets.emplace_back(idx_sigma0 + i, idx_sigma0 + i, over_a_weight);
+    P_triplets.emplace_back(idx_gamma0 + i, idx_gamma0 + i, over_j_weight);
+  }
+
+  std::vector<Eigen::Triplet<double>> A_triplets;
+  size_t constr_idx = 0;
+  for (size_t i = 0; i < N; ++i, ++constr_idx) {
+    A_triplets.emplace_back(constr_idx, idx_b0 + i, 1.0);
+    A_triplets.emplace_back(constr_idx, idx_delta0 + i, -1.0);
+    problem.u.at(constr_idx) = v_max.at(i) * v_max.at(i);
+  }
+  for (size_t i = 0; i < N; ++i, ++constr_idx) {
+    A_triplets.emplace_back(constr_idx, idx_a0 + i, 1.0);
+    A_triplets.emplace_back(constr_idx, idx_sigma0 + i, -1.0);
+    problem.l.at(constr_idx) = v_max.at(i) < 1e-3 ? a_stop_decel : a_min;
+    problem.u.at(constr_idx) = v_max.at(i) < 1e-3 ? a_stop_decel : a_max;
+  }
+  for (size_t i = 0; i + 1 < N; ++i, ++constr_idx) {
+    const double ref_vel = 0.5 * (v_max.at(i) + v_max.at(i + 1));
+    A_triplets.emplace_back(constr_idx, idx_a0 + i, -ref_vel);
+    A_triplets.emplace_back(constr_idx, idx_a0 + i + 1, ref_vel);
+    A_triplets.emplace_back(constr_idx, idx_gamma0 + i, -ds);
+    problem.l.at(constr_idx) = j_min * ds;
+    problem.u.at(constr_idx) = j_max * ds;
+  }
+  for (size_t i = 0; i + 1 < N; ++i, ++constr_idx) {
+    A_triplets.emplace_back(constr_idx, idx_b0 + i, -1.0);
+    A_triplets.emplace_back(constr_idx, idx_b0 + i + 1, 1.0);
+    A_triplets.emplace_back(constr_idx, idx_a0 + i, -2.0 * ds);
+  }
+  // initial velocity and acceleration
+  A_triplets.emplace_back(constr_idx, idx_b0, 1.0);
+  problem.l.at(constr_idx) = v0 * v0;
+  problem.u.at(constr_idx) = v0 * v0;
+  ++constr_idx;
+  A_triplets.emplace_back(constr_idx, idx_a0, 1.0);
+
+  const auto rows = static_cast<Eigen::Index>(constraints_num);
+  const auto cols = static_cast<Eigen::Index>(variables_num);
+  Eigen::SparseMatrix<double> P(cols, cols);
+  P.setFromTriplets(P_triplets.begin(), P_triplets.end());
+  Eigen::SparseMatrix<double> A(rows, cols);
+  A.setFromTriplets(A_triplets.begin(), A_triplets.end());
+  problem.P = autoware::qp_interface::calCSCMatrixTrapezoidal(P);
+  problem.A = autoware::qp_interface::calCSCMatrix(A);
+  return problem;
+}
+
+std::shared_ptr<QPInterface> create_osqp(const bool enable_warm_start)
+{
+  return std::make_shared<OSQPInterface>(enable_warm_start, 20000, 1.0e-8, 1.0e-6, true, false);
+}
+
+std::shared_ptr<QPInterface> create_proxqp(const bool enable_warm_start)
+{
+  return std::make_shared<ProxQPInterface>(enable_warm_start, 20000, 1.0e-8, 1.0e-6, false);
+}
+
+void solve(
+  benchmark::State & state, std::shared_ptr<QPInterface> (*create_qp_interface)(const bool),
+  const bool enable_warm_start)
+{
+  const auto problem = create_jerk_filtered_problem(static_cast<size_t>(state.range(0)));
+  const auto qp_interface = create_qp_interface(enable_warm_start);
+  qp_interface->optimize(problem.P, problem.A, problem.q, problem.l, problem.u);
+  if (!qp_interface->isSolved()) {
+    throw std::runtime_error("failed to solve the benchmark problem");
+  }
+
+  int iteration_num = 0;
+  double run_time = 0.0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+      qp_interface->optimize(problem.P, problem.A, problem.q, problem.l, problem.u));
+    iteration_num += qp_interface->getIterationNumber();
+    run_time += qp_interface->getRunTime();
+  }
+  state.counters["iterations"] =
+    benchmark::Counter(iteration_num, benchmark::Counter::kAvgIterations);
+  state.counters["solver_time"] = benchmark::Counter(run_time, benchmark::Counter::kAvgIterations);
+}
+
+void BM_OSQP(benchmark::State & state)
+{
+  solve(state, create_osqp, false);
+}
+
+void BM_OSQPWarmStart(benchmark::State & state)
+{
+  solve(state, create_osqp, true);
+}
+
+void BM_ProxQP(benchmark::State & state)
+{
+  solve(state, create_proxqp, false);
+}
+
+void BM_ProxQPWarmStart(benchmark::State & state)
+{
+  solve(state, create_proxqp, true);
+}
+}  // namespace
+
+BENCHMARK(BM_OSQP)->Arg(100)->Arg(300)->Arg(1000);
+BENCHMARK(BM_OSQPWarmStart)->Arg(100)->Arg(300)->Arg(1000);
+BENCHMARK(BM_ProxQP)->Arg(100)->Arg(300)->Arg(1000);
+BENCHMARK(BM_ProxQPWarmStart)->Arg(100)->Arg(300)->Arg(1000);
+
+BENCHMARK_MAIN();
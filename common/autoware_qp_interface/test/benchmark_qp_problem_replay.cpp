@@ -0,0 +1,154 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Time to re-solve in order all the problems of a file written by QPProblemRecorder, with OSQP and
+// ProxQP, with and without warm start.
+// The recorded settings are used unless they are overridden by the options.
+//
+// usage: benchmark_qp_problem_replay [benchmark options] <record file> [--eps_abs=<value>]
+//        [--eps_rel=<value>] [--max_iteration=<value>]
+
+#include "autoware/qp_interface/osqp_interface.hpp"
+#include "autoware/qp_interface/proxqp_interface.hpp"
+#include "autoware/qp_interface/qp_problem_recorder.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace
+{
+using autoware::qp_interface::OSQPInterface;
+using autoware::qp_interface::ProxQPInterface;
+using autoware::qp_interface::QPInterface;
+using autoware::qp_interface::QPProblemRecord;
+using autoware::qp_interface::QPSettings;
+
+struct SettingsOverride
+{
+  std::optional<double> eps_abs;
+  std::optional<double> eps_rel;
+  std::optional<int> max_iteration;
+};
+
+QPSettings get_settings(
+  const QPProblemRecord & record, const SettingsOverride & settings_override,
+  const bool enable_warm_start)
+{
+  auto settings = record.settings;
+  settings.enable_warm_start = enable_warm_start;
+  settings.eps_abs = settings_override.eps_abs.value_or(settings.eps_abs);
+  settings.eps_rel = settings_override.eps_rel.value_or(settings.eps_rel);
+  settings.max_iteration = settings_override.max_iteration.value_or(settings.max_iteration);
+  return settings;
+}
+
+std::shared_ptr<QPInterface> create_qp_interface(
+  const std::string & solver_name, const QPSettings & settings)
+{
+  if (solver_name == "osqp") {
+    return std::make_shared<OSQPInterface>(
+      settings.enable_warm_start, settings.max_iteration, settings.eps_abs, settings.eps_rel, true,
+      false);
+  }
+  return std::make_shared<ProxQPInterface>(
+    settings.enable_warm_start, settings.max_iteration, settings.eps_abs, settings.eps_rel, false);
+}
+
+void replay(
+  benchmark::State & state, const std::vector<QPProblemRecord> & records,
+  const SettingsOverride & settings_override, const std::string & solver_name,
+  const bool enable_warm_start)
+{
+  // NOTE: the settings of the first record are used for all the problems to keep one solver, so
+  // that the warm start carries over as during the recording.
+  const auto qp_interface = create_qp_interface(
+    solver_name, get_settings(records.front(), settings_override, enable_warm_start));
+
+  int64_t solved_num = 0;
+  int64_t iteration_num = 0;
+  for (auto _ : state) {
+    for (const auto & record : records) {
+      benchmark::DoNotOptimize(
+        qp_interface->optimize(record.P, record.A, record.q, record.l, record.u));
+      solved_num += qp_interface->isSolved() ? 1 : 0;
+      iteration_num += qp_interface->getIterationNumber();
+    }
+  }
+
+  const auto problem_num = static_cast<double>(state.iterations() * records.size());
+  state.counters["solved_ratio"] = static_cast<double>(solved_num) / problem_num;
+  state.counters["iterations"] = static_cast<double>(iteration_num) / problem_num;
+  state.SetItemsProcessed(static_cast<int64_t>(problem_num));
+}
+
+std::optional<std::string> get_option(const std::string & arg, const std::string & name)
+{
+  const auto prefix = "--" + name + "=";
+  if (arg.rfind(prefix, 0) != 0) {
+    return std::nullopt;
+  }
+  return arg.substr(prefix.size());
+}
+}  // namespace
+
+int main(int argc, char ** argv)
+{
+  benchmark::Initialize(&argc, argv);
+
+  std::optional<std::string> record_file_path;
+  SettingsOverride settings_override;
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+    if (const auto eps_abs = get_option(arg, "eps_abs")) {
+      settings_override.eps_abs = std::stod(*eps_abs);
+    } else if (const auto eps_rel = get_option(arg, "eps_rel")) {
+      settings_override.eps_rel = std::stod(*eps_rel);
+    } else if (const auto max_iteration = get_option(arg, "max_iteration")) {
+      settings_override.max_iteration = std::stoi(*max_iteration);
+    } else {
+      record_file_path = arg;
+    }
+  }
+  if (!record_file_path) {
+    std::cerr << "usage: " << argv[0]
+              << " [benchmark options] <record file> [--eps_abs=<value>] [--eps_rel=<value>]"
+                 " [--max_iteration=<value>]"
+              << std::endl;
+    return 1;
+  }
+
+  const auto records = autoware::qp_interface::readQPProblemRecords(*record_file_path);
+  if (records.empty()) {
+    std::cerr << "no problem is recorded in " << *record_file_path << std::endl;
+    return 1;
+  }
+  std::cout << records.size() << " problems are loaded from " << *record_file_path << std::endl;
+
+  for (const std::string solver_name : {"osqp", "proxqp"}) {
+    for (const bool enable_warm_start : {false, true}) {
+      benchmark::RegisterBenchmark(
+        ("BM_Replay/" + solver_name + (enable_warm_start ? "/warm_start" : "/cold_start")).c_str(),
+        replay, records, settings_override, solver_name, enable_warm_start);
+    }
+  }
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
@@ -16,6 +16,7 @@
 #include "gtest/gtest.h"
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 #include <string>
 #include <tuple>
@@ -164,6 +165,74 @@ TEST(TestCscMatrixConv, Trapezoidal)
     EXPECT_EQ(e.what(), std::string("Matrix must be square (n, n)"));
   }
 }
+TEST(TestCscMatrixConv, SparseMatrix)
+{
+  using autoware::qp_interface::calCSCMatrix;
+  using autoware::qp_interface::calCSCMatrixTrapezoidal;
+  using autoware::qp_interface::CSC_Matrix;
+
+  const auto expect_same = [](const CSC_Matrix & expected, const CSC_Matrix & actual) {
+    EXPECT_EQ(expected.vals_, actual.vals_);
+    EXPECT_EQ(expected.row_idxs_, actual.row_idxs_);
+    EXPECT_EQ(expected.col_idxs_, actual.col_idxs_);
+  };
+
+  Eigen::MatrixXd rect(2, 4);
+  rect << 1.0, 0.0, 3.0, 0.0, 0.0, 6.0, 7.0, 0.0;
+  expect_same(calCSCMatrix(rect), calCSCMatrix(Eigen::SparseMatrix<double>(rect.sparseView())));
+
+  Eigen::MatrixXd square(3, 3);
+  square << 2.0, 1.0, 0.0, 1.0, 5.0, 4.0, 0.0, 4.0, 6.0;
+  expect_same(
+    calCSCMatrixTrapezoidal(square),
+    calCSCMatrixTrapezoidal(Eigen::SparseMatrix<double>(square.sparseView())));
+
+  // the stored zeros are kept in the sparsity pattern
+  std::vector<Eigen::Triplet<double>> triplets{{0, 0, 1.0}, {1, 0, 0.0}, {0, 1, 2.0}};
+  Eigen::SparseMatrix<double> sparse(2, 2);
+  sparse.setFromTriplets(triplets.begin(), triplets.end());
+  const CSC_Matrix sparse_m = calCSCMatrix(sparse);
+  ASSERT_EQ(sparse_m.vals_.size(), size_t(3));
+  EXPECT_EQ(sparse_m.vals_[1], 0.0);
+  EXPECT_EQ(sparse_m.row_idxs_[1], c_int(1));
+  ASSERT_EQ(sparse_m.col_idxs_.size(), size_t(3));
+  EXPECT_EQ(sparse_m.col_idxs_[1], c_int(2));
+  EXPECT_EQ(sparse_m.col_idxs_[2], c_int(3));
+
+  EXPECT_THROW(
+    calCSCMatrixTrapezoidal(Eigen::SparseMatrix<double>(rect.sparseView())),
+    std::invalid_argument);
+}
+
+TEST(TestCscMatrixConv, Triplets)
+{
+  using autoware::qp_interface::calCSCMatrix;
+  using autoware::qp_interface::calCSCMatrixTrapezoidal;
+  using autoware::qp_interface::CSC_Matrix;
+
+  const auto expect_same = [](const CSC_Matrix & expected, const CSC_Matrix & actual) {
+    EXPECT_EQ(expected.vals_, actual.vals_);
+    EXPECT_EQ(expected.row_idxs_, actual.row_idxs_);
+    EXPECT_EQ(expected.col_idxs_, actual.col_idxs_);
+  };
+
+  // unordered triplets with a duplicated entry and a stored zero
+  const std::vector<Eigen::Triplet<double>> triplets{
+    {2, 1, 4.0}, {0, 0, 2.0}, {1, 1, 5.0}, {0, 1, 1.0}, {1, 0, 1.0},
+    {1, 2, 4.0}, {2, 2, 6.0}, {1, 1, -1.0}, {2, 0, 0.0}};
+  Eigen::SparseMatrix<double> sparse(3, 3);
+  sparse.setFromTriplets(triplets.begin(), triplets.end());
+  expect_same(calCSCMatrix(sparse), calCSCMatrix(3, 3, triplets));
+  expect_same(calCSCMatrixTrapezoidal(sparse), calCSCMatrixTrapezoidal(3, triplets));
+
+  const CSC_Matrix rect_m = calCSCMatrix(3, 4, triplets);
+  ASSERT_EQ(rect_m.col_idxs_.size(), size_t(5));
+  EXPECT_EQ(rect_m.col_idxs_[3], rect_m.col_idxs_[4]);
+
+  EXPECT_THROW(calCSCMatrix(2, 3, triplets), std::invalid_argument);
+  EXPECT_THROW(calCSCMatrixTrapezoidal(2, triplets), std::invalid_argument);
+}
+
 TEST(TestCscMatrixConv, Print)
 {
   using autoware::qp_interface::calCSCMatrix;
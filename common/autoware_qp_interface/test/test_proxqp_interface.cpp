@@ -65,6 +65,16 @@ TEST(TestProxqpInterface, BasicQp)
     check_result(solution, status);
   }
 
+  {
+    // Define problem during optimization with csc matrix
+    autoware::qp_interface::ProxQPInterface proxqp(false, 4000, 1e-9, 1e-9, false);
+    const auto solution = proxqp.QPInterface::optimize(
+      autoware::qp_interface::calCSCMatrixTrapezoidal(P),
+      autoware::qp_interface::calCSCMatrix(A), q, l, u);
+    const auto status = proxqp.getStatus();
+    check_result(solution, status);
+  }
+
   {
     // Define problem during optimization with warm start
     autoware::qp_interface::ProxQPInterface proxqp(true, 4000, 1e-9, 1e-9, false);
@@ -90,5 +100,19 @@ TEST(TestProxqpInterface, BasicQp)
       EXPECT_EQ(proxqp.getIterationNumber(), 0);
     }
   }
+
+  {
+    // Warm start from the given primal variables
+    autoware::qp_interface::ProxQPInterface proxqp(false, 4000, 1e-9, 1e-9, false);
+    const auto cold_solution = proxqp.QPInterface::optimize(P, A, q, l, u);
+    check_result(cold_solution, proxqp.getStatus());
+    const auto cold_iteration_num = proxqp.getIterationNumber();
+    EXPECT_GT(proxqp.getRunTime(), 0.0);
+
+    EXPECT_TRUE(proxqp.setPrimalVariables(cold_solution));
+    const auto solution = proxqp.QPInterface::optimize(P, A, q, l, u);
+    check_result(solution, proxqp.getStatus());
+    EXPECT_LT(proxqp.getIterationNumber(), cold_iteration_num);
+  }
 }
 }  // namespace
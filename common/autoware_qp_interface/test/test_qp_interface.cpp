@@ -13,12 +13,14 @@
 // limitations under the License.
 
 #include "autoware/qp_interface/osqp_interface.hpp"
+#include "autoware/qp_interface/proxqp_interface.hpp"
 #include "autoware/qp_interface/qp_interface.hpp"
 
 #include <Eigen/Dense>
 
 #include <gtest/gtest.h>
 
+#include <memory>
 #include <stdexcept>
 #include <vector>
 
@@ -132,4 +134,80 @@ TEST(QPInterfaceTest, Optimize_ValidInputs_ReturnsResult)
   EXPECT_EQ(result.size(), 2);
 }
 
+TEST(QPInterfaceTest, InitializeCSCProblem_InvalidInputs_ThrowsException)
+{
+  Eigen::MatrixXd P(2, 2);
+  P << 1, 0, 0, 1;
+  Eigen::MatrixXd A(1, 2);
+  A << 1, 1;
+  const CSC_Matrix P_csc = calCSCMatrixTrapezoidal(P);
+  const CSC_Matrix A_csc = calCSCMatrix(A);
+  std::vector<double> q = {1.0, 2.0};
+  std::vector<double> l = {1.0};
+  std::vector<double> u = {1.0};
+
+  OSQPInterface osqp;
+  EXPECT_THROW(osqp.QPInterface::optimize(P_csc, A_csc, {1.0}, l, u), std::invalid_argument);
+  EXPECT_THROW(
+    osqp.QPInterface::optimize(P_csc, calCSCMatrix(Eigen::MatrixXd::Ones(1, 3)), q, l, u),
+    std::invalid_argument);
+  EXPECT_THROW(osqp.QPInterface::optimize(P_csc, A_csc, q, l, {1.0, 2.0}), std::invalid_argument);
+  EXPECT_THROW(
+    osqp.QPInterface::optimize(P_csc, calCSCMatrix(Eigen::MatrixXd::Ones(2, 2)), q, l, u),
+    std::invalid_argument);
+}
+
+TEST(QPInterfaceTest, OptimizeCSC_ValidInputs_ReturnsResult)
+{
+  Eigen::MatrixXd P(2, 2);
+  P << 1, 0, 0, 1;
+  Eigen::MatrixXd A(1, 2);
+  A << 1, 1;
+  std::vector<double> q = {1.0, 2.0};
+  std::vector<double> l = {1.0};
+  std::vector<double> u = {1.0};
+
+  OSQPInterface osqp;
+  const std::vector<double> result =
+    osqp.QPInterface::optimize(calCSCMatrixTrapezoidal(P), calCSCMatrix(A), q, l, u);
+  ASSERT_EQ(result.size(), 2);
+  EXPECT_NEAR(result[0], 1.0, 1e-3);
+  EXPECT_NEAR(result[1], 0.0, 1e-3);
+}
+
+TEST(QPInterfaceTest, WarmStart_SameResultWithEachBackend)
+{
+  Eigen::MatrixXd P(2, 2);
+  P << 4, 1, 1, 2;
+  Eigen::MatrixXd A(3, 2);
+  A << 1, 1, 1, 0, 0, 1;
+  const CSC_Matrix P_csc = calCSCMatrixTrapezoidal(P);
+  const CSC_Matrix A_csc = calCSCMatrix(A);
+  std::vector<double> q = {1.0, 1.0};
+  std::vector<double> l = {1.0, 0.0, 0.0};
+  std::vector<double> u = {1.0, 0.7, 0.7};
+
+  const std::vector<std::shared_ptr<QPInterface>> qp_interfaces{
+    std::make_shared<OSQPInterface>(true, 4000, 1e-8, 1e-8),
+    std::make_shared<ProxQPInterface>(true, 4000, 1e-8, 1e-8)};
+  for (const auto & qp_interface : qp_interfaces) {
+    const auto cold_result = qp_interface->optimize(P_csc, A_csc, q, l, u);
+    ASSERT_TRUE(qp_interface->isSolved());
+    const auto cold_iteration_num = qp_interface->getIterationNumber();
+    ASSERT_EQ(cold_result.size(), 2);
+    EXPECT_NEAR(cold_result[0], 0.3, 1e-3);
+    EXPECT_NEAR(cold_result[1], 0.7, 1e-3);
+
+    // the previous result is kept for the problem of the same dimensions
+    const auto warm_result = qp_interface->optimize(P_csc, A_csc, q, l, u);
+    ASSERT_TRUE(qp_interface->isSolved());
+    EXPECT_LE(qp_interface->getIterationNumber(), cold_iteration_num);
+    ASSERT_EQ(warm_result.size(), 2);
+    EXPECT_NEAR(warm_result[0], 0.3, 1e-3);
+    EXPECT_NEAR(warm_result[1], 0.7, 1e-3);
+
+    EXPECT_FALSE(qp_interface->setPrimalVariables({}));
+  }
+}
+
 }  // namespace autoware::qp_interface
@@ -0,0 +1,88 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/qp_interface/osqp_interface.hpp"
+#include "autoware/qp_interface/proxqp_interface.hpp"
+#include "autoware/qp_interface/qp_problem_recorder.hpp"
+
+#include <Eigen/Core>
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace autoware::qp_interface
+{
+TEST(QPProblemRecorderTest, ReplayRecordedProblems)
+{
+  const std::string file_path =
+    (std::filesystem::temp_directory_path() / "test_qp_problem_recorder.bin").string();
+
+  Eigen::MatrixXd P(2, 2);
+  P << 4, 1, 1, 2;
+  Eigen::MatrixXd A(3, 2);
+  A << 1, 1, 1, 0, 0, 1;
+  const std::vector<double> q = {1.0, 1.0};
+  const std::vector<double> l = {1.0, 0.0, 0.0};
+  const std::vector<double> u = {1.0, 0.7, 0.7};
+
+  {
+    const auto recorder = std::make_shared<QPProblemRecorder>(file_path);
+    OSQPInterface osqp(false, 4000, 1e-8, 1e-8);
+    osqp.setProblemRecorder(recorder);
+    osqp.QPInterface::optimize(P, A, q, l, u);
+    ProxQPInterface proxqp(true, 4000, 1e-8, 1e-8);
+    proxqp.setProblemRecorder(recorder);
+    proxqp.QPInterface::optimize(calCSCMatrixTrapezoidal(P), calCSCMatrix(A), q, l, u);
+    proxqp.setProblemRecorder(nullptr);
+    proxqp.QPInterface::optimize(P, A, q, l, u);
+  }
+
+  const auto records = readQPProblemRecords(file_path);
+  ASSERT_EQ(records.size(), 2U);
+  EXPECT_EQ(records[0].settings.solver_name, "osqp");
+  EXPECT_FALSE(records[0].settings.enable_warm_start);
+  EXPECT_EQ(records[1].settings.solver_name, "proxqp");
+  EXPECT_TRUE(records[1].settings.enable_warm_start);
+  EXPECT_EQ(records[1].settings.max_iteration, 4000);
+  EXPECT_DOUBLE_EQ(records[1].settings.eps_abs, 1e-8);
+  for (const auto & record : records) {
+    EXPECT_TRUE(record.is_solved);
+    EXPECT_GT(record.optimization_time, 0.0);
+    EXPECT_EQ(record.q, q);
+    EXPECT_EQ(record.l, l);
+    EXPECT_EQ(record.u, u);
+    EXPECT_EQ(record.P.vals_, calCSCMatrixTrapezoidal(P).vals_);
+    EXPECT_EQ(record.A.row_idxs_, calCSCMatrix(A).row_idxs_);
+
+    // the recorded problem gives the same result again
+    ProxQPInterface proxqp(false, 4000, 1e-8, 1e-8);
+    const auto result =
+      proxqp.QPInterface::optimize(record.P, record.A, record.q, record.l, record.u);
+    ASSERT_EQ(result.size(), 2U);
+    EXPECT_NEAR(result[0], 0.3, 1e-3);
+    EXPECT_NEAR(result[1], 0.7, 1e-3);
+  }
+
+  // a truncated file is rejected
+  std::filesystem::resize_file(file_path, std::filesystem::file_size(file_path) - 1);
+  EXPECT_THROW(readQPProblemRecords(file_path), std::runtime_error);
+  std::filesystem::remove(file_path);
+  EXPECT_THROW(readQPProblemRecords(file_path), std::runtime_error);
+}
+}  // namespace autoware::qp_interface
@@ -0,0 +1,165 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__SIGNAL_PROCESSING__BIQUAD_CASCADE_HPP_
+#define AUTOWARE__SIGNAL_PROCESSING__BIQUAD_CASCADE_HPP_
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+namespace autoware::signal_processing
+{
+/**
+ * @brief coefficients of a second-order section
+ *        H(z) = (b0 + b1 z^-1 + b2 z^-2) / (1 + a1 z^-1 + a2 z^-2)
+ */
+struct BiquadCoefficients
+{
+  double b0{1.0};
+  double b1{0.0};
+  double b2{0.0};
+  double a1{0.0};
+  double a2{0.0};
+};
+
+/**
+ * @brief calculate a section of the Butterworth filter of ButterworthFilter with the sampling
+ *        frequency
+ * @details The filter has (order + 1) / 2 sections and the last one is first-order for an odd
+ *          order. Its gain is 1 at DC.
+ * @param cutoff_frequency cut-off frequency [Hz], less than sampling_frequency / 2
+ * @param sampling_frequency sampling frequency [Hz]
+ */
+BiquadCoefficients calcButterworthSection(
+  const int order, const int section_index, const double cutoff_frequency,
+  const double sampling_frequency);
+
+namespace detail
+{
+/**
+ * @brief set the states, [section][state index][channel], to the steady state of the input u
+ */
+inline void initializeBiquadStates(
+  const BiquadCoefficients * sections, const size_t num_sections, const size_t num_channels,
+  const double * u, double * states)
+{
+  for (size_t c = 0; c < num_channels; ++c) {
+    double x = u[c];
+    for (size_t i = 0; i < num_sections; ++i) {
+      const auto & s = sections[i];
+      const double y = x * (s.b0 + s.b1 + s.b2) / (1.0 + s.a1 + s.a2);
+      states[(2 * i) * num_channels + c] = y - s.b0 * x;
+      states[(2 * i + 1) * num_channels + c] = s.b2 * x - s.a2 * y;
+      x = y;
+    }
+  }
+}
+
+/**
+ * @brief filter one sample of each channel in the transposed direct form II
+ * @details y can be u. The states of a section are contiguous over the channels, so that the loop
+ *          over the channels is vectorized.
+ */
+inline void filterBiquadCascade(
+  const BiquadCoefficients * sections, const size_t num_sections, const size_t num_channels,
+  const double * u, double * y, double * states)
+{
+  for (size_t c = 0; c < num_channels; ++c) {
+    y[c] = u[c];
+  }
+  for (size_t i = 0; i < num_sections; ++i) {
+    const auto s = sections[i];
+    double * z1 = states + 2 * i * num_channels;
+    double * z2 = z1 + num_channels;
+    for (size_t c = 0; c < num_channels; ++c) {
+      const double x = y[c];
+      const double out = s.b0 * x + z1[c];
+      z1[c] = s.b1 * x - s.a1 * out + z2[c];
+      z2[c] = s.b2 * x - s.a2 * out;
+      y[c] = out;
+    }
+  }
+}
+}  // namespace detail
+
+/**
+ * @class Fixed-size cascade of second-order sections
+ * @brief filtering NumChannels values in the same way without heap allocation
+ * @details As LowpassFilter1d, the filter starts at the steady state of the first input.
+ */
+template <size_t NumSections, size_t NumChannels = 1>
+class BiquadCascade
+{
+public:
+  using Values = std::array<double, NumChannels>;
+
+  explicit BiquadCascade(const std::array<BiquadCoefficients, NumSections> & sections)
+  : sections_(sections)
+  {
+  }
+
+  const std::array<BiquadCoefficients, NumSections> & getSections() const { return sections_; }
+
+  void reset() { is_initialized_ = false; }
+  void reset(const Values & x)
+  {
+    detail::initializeBiquadStates(
+      sections_.data(), NumSections, NumChannels, x.data(), states_.data());
+    is_initialized_ = true;
+  }
+
+  Values filter(const Values & u)
+  {
+    if (!is_initialized_) {
+      reset(u);
+    }
+    Values y;
+    detail::filterBiquadCascade(
+      sections_.data(), NumSections, NumChannels, u.data(), y.data(), states_.data());
+    return y;
+  }
+
+  template <size_t N = NumChannels, std::enable_if_t<N == 1, std::nullptr_t> = nullptr>
+  double filter(const double u)
+  {
+    return filter(Values{u}).front();
+  }
+
+private:
+  std::array<BiquadCoefficients, NumSections> sections_;
+  std::array<double, 2 * NumSections * NumChannels> states_{};  // [section][state][channel]
+  bool is_initialized_{false};
+};
+
+/**
+ * @brief cascade of the Butterworth filter of ButterworthFilter with the sampling frequency, whose
+ *        order is fixed at compile time
+ * @details The coefficients are calculated once here, e.g. at the startup of a node.
+ */
+template <int Order, size_t NumChannels = 1>
+BiquadCascade<(Order + 1) / 2, NumChannels> createButterworthCascade(
+  const double cutoff_frequency, const double sampling_frequency)
+{
+  static_assert(Order > 0, "the order of the Butterworth filter must be positive");
+  std::array<BiquadCoefficients, (Order + 1) / 2> sections;
+  for (size_t i = 0; i < sections.size(); ++i) {
+    sections[i] =
+      calcButterworthSection(Order, static_cast<int>(i), cutoff_frequency, sampling_frequency);
+  }
+  return BiquadCascade<(Order + 1) / 2, NumChannels>(sections);
+}
+}  // namespace autoware::signal_processing
+
+#endif  // AUTOWARE__SIGNAL_PROCESSING__BIQUAD_CASCADE_HPP_
@@ -0,0 +1,75 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__SIGNAL_PROCESSING__LOWPASS_FILTER_BANK_HPP_
+#define AUTOWARE__SIGNAL_PROCESSING__LOWPASS_FILTER_BANK_HPP_
+
+#include "autoware/signal_processing/biquad_cascade.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace autoware::signal_processing
+{
+/**
+ * @class Bank of low-pass filters
+ * @brief filtering the same way several channels, e.g. the six components of a twist, in one call
+ * @details The filter is a cascade of second-order sections as BiquadCascade, with the number of
+ *          channels and sections given at runtime. As LowpassFilter1d, the filter starts at the
+ *          steady state of the first input.
+ */
+class LowpassFilterBank
+{
+private:
+  size_t num_channels_;
+  std::vector<BiquadCoefficients> sections_;
+  std::vector<double> states_;  //!< @brief [section][state index][channel]
+  bool is_initialized_{false};
+
+public:
+  LowpassFilterBank(const size_t num_channels, const std::vector<BiquadCoefficients> & sections);
+
+  /**
+   * @brief create the bank of first-order low-pass filters of LowpassFilter1d
+   * @param gain gain value of first-order low-pass filter
+   */
+  static LowpassFilterBank createFirstOrder(const size_t num_channels, const double gain);
+
+  /**
+   * @brief create the bank of Butterworth filters of ButterworthFilter with the sampling frequency
+   * @param order order of the filter
+   * @param cutoff_frequency cut-off frequency [Hz], less than sampling_frequency / 2
+   * @param sampling_frequency sampling frequency [Hz]
+   */
+  static LowpassFilterBank createButterworth(
+    const size_t num_channels, const int order, const double cutoff_frequency,
+    const double sampling_frequency);
+
+  size_t getNumChannels() const { return num_channels_; }
+  const std::vector<BiquadCoefficients> & getSections() const { return sections_; }
+
+  void reset();
+  void reset(const std::vector<double> & x);
+
+  /**
+   * @brief filter one sample of each channel
+   * @param u input of size getNumChannels()
+   * @param y output of size getNumChannels(), which can be the input
+   */
+  void filter(const double * u, double * y);
+  std::vector<double> filter(const std::vector<double> & u);
+};
+}  // namespace autoware::signal_processing
+
+#endif  // AUTOWARE__SIGNAL_PROCESSING__LOWPASS_FILTER_BANK_HPP_
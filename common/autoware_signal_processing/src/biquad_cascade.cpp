@@ -0,0 +1,61 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/signal_processing/biquad_cascade.hpp"
+
+#include <cmath>
+#include <complex>
+#include <stdexcept>
+
+namespace autoware::signal_processing
+{
+BiquadCoefficients calcButterworthSection(
+  const int order, const int section_index, const double cutoff_frequency,
+  const double sampling_frequency)
+{
+  if (order < 1 || section_index < 0 || section_index >= (order + 1) / 2) {
+    throw std::invalid_argument("invalid order or section index of the Butterworth filter");
+  }
+  if (cutoff_frequency <= 0.0 || cutoff_frequency >= sampling_frequency / 2.0) {
+    throw std::invalid_argument("the cut-off frequency must be in (0, sampling_frequency / 2)");
+  }
+
+  // analog pole with the pre-warped cut-off frequency, mapped by the bilinear transformation.
+  // The zeros are at -1, as ButterworthFilter does.
+  const double prewarped_cutoff =
+    2.0 * sampling_frequency * std::tan(M_PI * cutoff_frequency / sampling_frequency);
+  const double phase_angle = M_PI_2 + M_PI * (2.0 * section_index + 1.0) / (2.0 * order);
+  const auto analog_pole = std::polar(prewarped_cutoff, phase_angle) / (2.0 * sampling_frequency);
+  const auto pole = (1.0 + analog_pole) / (1.0 - analog_pole);
+
+  BiquadCoefficients section;
+  if (2 * section_index + 1 == order) {
+    // first-order section of the real pole
+    section.a1 = -pole.real();
+    const double k = (1.0 + section.a1) / 2.0;
+    section.b0 = k;
+    section.b1 = k;
+    return section;
+  }
+
+  // second-order section of the pole and its conjugate
+  section.a1 = -2.0 * pole.real();
+  section.a2 = std::norm(pole);
+  const double k = (1.0 + section.a1 + section.a2) / 4.0;
+  section.b0 = k;
+  section.b1 = 2.0 * k;
+  section.b2 = k;
+  return section;
+}
+}  // namespace autoware::signal_processing
@@ -0,0 +1,88 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/signal_processing/lowpass_filter_bank.hpp"
+
+#include <stdexcept>
+#include <vector>
+
+namespace autoware::signal_processing
+{
+LowpassFilterBank::LowpassFilterBank(
+  const size_t num_channels, const std::vector<BiquadCoefficients> & sections)
+: num_channels_(num_channels),
+  sections_(sections),
+  states_(2 * sections.size() * num_channels, 0.0)
+{
+}
+
+LowpassFilterBank LowpassFilterBank::createFirstOrder(const size_t num_channels, const double gain)
+{
+  BiquadCoefficients section;
+  section.b0 = 1.0 - gain;
+  section.a1 = -gain;
+  return LowpassFilterBank(num_channels, {section});
+}
+
+LowpassFilterBank LowpassFilterBank::createButterworth(
+  const size_t num_channels, const int order, const double cutoff_frequency,
+  const double sampling_frequency)
+{
+  if (order < 1) {
+    throw std::invalid_argument("the order of the Butterworth filter must be positive");
+  }
+  std::vector<BiquadCoefficients> sections((order + 1) / 2);
+  for (size_t i = 0; i < sections.size(); ++i) {
+    sections.at(i) =
+      calcButterworthSection(order, static_cast<int>(i), cutoff_frequency, sampling_frequency);
+  }
+  return LowpassFilterBank(num_channels, sections);
+}
+
+void LowpassFilterBank::reset()
+{
+  is_initialized_ = false;
+}
+
+void LowpassFilterBank::reset(const std::vector<double> & x)
+{
+  if (x.size() != num_channels_) {
+    throw std::invalid_argument("the size of the values differs from the number of channels");
+  }
+  detail::initializeBiquadStates(
+    sections_.data(), sections_.size(), num_channels_, x.data(), states_.data());
+  is_initialized_ = true;
+}
+
+void LowpassFilterBank::filter(const double * u, double * y)
+{
+  if (!is_initialized_) {
+    detail::initializeBiquadStates(
+      sections_.data(), sections_.size(), num_channels_, u, states_.data());
+    is_initialized_ = true;
+  }
+  detail::filterBiquadCascade(
+    sections_.data(), sections_.size(), num_channels_, u, y, states_.data());
+}
+
+std::vector<double> LowpassFilterBank::filter(const std::vector<double> & u)
+{
+  if (u.size() != num_channels_) {
+    throw std::invalid_argument("the size of the values differs from the number of channels");
+  }
+  std::vector<double> y(num_channels_);
+  filter(u.data(), y.data());
+  return y;
+}
+}  // namespace autoware::signal_processing
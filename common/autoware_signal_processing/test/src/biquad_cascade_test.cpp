@@ -0,0 +1,78 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/signal_processing/biquad_cascade.hpp"
+#include "autoware/signal_processing/lowpass_filter_bank.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+constexpr double epsilon = 1e-12;
+
+using autoware::signal_processing::BiquadCascade;
+using autoware::signal_processing::calcButterworthSection;
+using autoware::signal_processing::createButterworthCascade;
+using autoware::signal_processing::LowpassFilterBank;
+
+TEST(biquad_cascade, sameAsFilterBank)
+{
+  auto cascade = createButterworthCascade<5, 2>(2.0, 30.0);
+  auto bank = LowpassFilterBank::createButterworth(2, 5, 2.0, 30.0);
+  static_assert(std::tuple_size_v<std::decay_t<decltype(cascade.getSections())>> == 3);
+
+  for (size_t step = 0; step < 100; ++step) {
+    const double t = static_cast<double>(step);
+    const std::vector<double> u{std::sin(0.5 * t), std::cos(0.2 * t) + 1.0};
+    const auto y = cascade.filter({u.at(0), u.at(1)});
+    const auto expected = bank.filter(u);
+    EXPECT_NEAR(y.at(0), expected.at(0), epsilon);
+    EXPECT_NEAR(y.at(1), expected.at(1), epsilon);
+  }
+}
+
+TEST(biquad_cascade, singleChannel)
+{
+  auto cascade = createButterworthCascade<2>(1.0, 10.0);
+
+  {  // the filter starts at the steady state of the first input
+    EXPECT_NEAR(cascade.filter(3.0), 3.0, 1e-9);
+    EXPECT_NEAR(cascade.filter(3.0), 3.0, 1e-9);
+  }
+
+  {  // the step response converges to the input
+    cascade.reset({0.0});
+    double y = 0.0;
+    for (size_t i = 0; i < 200; ++i) {
+      y = cascade.filter(1.0);
+    }
+    EXPECT_NEAR(y, 1.0, 1e-6);
+  }
+
+  {  // reset without value
+    cascade.reset();
+    EXPECT_NEAR(cascade.filter(-1.0), -1.0, 1e-9);
+  }
+}
+
+TEST(biquad_cascade, invalidButterworthSection)
+{
+  EXPECT_THROW(calcButterworthSection(2, 1, 1.0, 10.0), std::invalid_argument);
+  EXPECT_THROW(calcButterworthSection(2, 0, 5.0, 10.0), std::invalid_argument);
+  EXPECT_THROW(createButterworthCascade<3>(0.0, 10.0), std::invalid_argument);
+}
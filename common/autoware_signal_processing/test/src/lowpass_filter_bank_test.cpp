@@ -0,0 +1,131 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/signal_processing/butterworth.hpp"
+#include "autoware/signal_processing/lowpass_filter_1d.hpp"
+#include "autoware/signal_processing/lowpass_filter_bank.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+constexpr double epsilon = 1e-9;
+
+using autoware::signal_processing::ButterworthFilter;
+using autoware::signal_processing::LowpassFilter1d;
+using autoware::signal_processing::LowpassFilterBank;
+
+namespace
+{
+double createInput(const size_t channel, const size_t step)
+{
+  return std::sin(0.3 * static_cast<double>(step) + static_cast<double>(channel)) +
+         0.1 * static_cast<double>(channel);
+}
+}  // namespace
+
+TEST(lowpass_filter_bank, firstOrder)
+{
+  constexpr size_t num_channels = 6;
+  auto bank = LowpassFilterBank::createFirstOrder(num_channels, 0.8);
+  std::vector<LowpassFilter1d> filters(num_channels, LowpassFilter1d(0.8));
+
+  for (size_t step = 0; step < 50; ++step) {
+    std::vector<double> u(num_channels);
+    for (size_t c = 0; c < num_channels; ++c) {
+      u.at(c) = createInput(c, step);
+    }
+    const auto y = bank.filter(u);
+    for (size_t c = 0; c < num_channels; ++c) {
+      EXPECT_NEAR(y.at(c), filters.at(c).filter(u.at(c)), epsilon);
+    }
+  }
+
+  {  // reset without value
+    bank.reset();
+    const std::vector<double> u(num_channels, 1.0);
+    const auto y = bank.filter(u);
+    for (size_t c = 0; c < num_channels; ++c) {
+      EXPECT_NEAR(y.at(c), 1.0, epsilon);
+    }
+  }
+
+  {  // reset with value
+    bank.reset(std::vector<double>(num_channels, 2.0));
+    std::vector<double> y(num_channels, 0.0);
+    bank.filter(y.data(), y.data());
+    for (size_t c = 0; c < num_channels; ++c) {
+      EXPECT_NEAR(y.at(c), 0.8 * 2.0, epsilon);
+    }
+  }
+
+  EXPECT_THROW(bank.filter(std::vector<double>(num_channels + 1, 0.0)), std::invalid_argument);
+}
+
+TEST(lowpass_filter_bank, butterworth)
+{
+  constexpr double cutoff_frequency = 5.0;
+  constexpr double sampling_frequency = 50.0;
+  constexpr size_t num_channels = 3;
+
+  for (const int order : {1, 2, 3, 4, 5}) {
+    ButterworthFilter bf;
+    bf.setOrder(order);
+    bf.setCutOffFrequency(cutoff_frequency, sampling_frequency);
+    bf.computeContinuousTimeTF(true);
+    bf.computeDiscreteTimeTF(true);
+    const auto An = bf.getAn();
+    const auto Bn = bf.getBn();
+
+    auto bank = LowpassFilterBank::createButterworth(
+      num_channels, order, cutoff_frequency, sampling_frequency);
+    ASSERT_EQ(bank.getSections().size(), static_cast<size_t>((order + 1) / 2));
+
+    // filter in the direct form from the steady state of the first input
+    std::vector<std::vector<double>> inputs(num_channels);
+    std::vector<std::vector<double>> outputs(num_channels);
+    for (size_t step = 0; step < 100; ++step) {
+      std::vector<double> u(num_channels);
+      for (size_t c = 0; c < num_channels; ++c) {
+        u.at(c) = createInput(c, step);
+      }
+      const auto y = bank.filter(u);
+
+      for (size_t c = 0; c < num_channels; ++c) {
+        auto & x_history = inputs.at(c);
+        auto & y_history = outputs.at(c);
+        if (x_history.empty()) {
+          x_history.assign(order, u.at(c));
+          y_history.assign(order, u.at(c));
+        }
+        x_history.push_back(u.at(c));
+        const size_t n = x_history.size() - 1;
+        double expected = 0.0;
+        for (int k = 0; k <= order; ++k) {
+          expected += Bn.at(k) * x_history.at(n - k);
+        }
+        for (int k = 1; k <= order; ++k) {
+          expected -= An.at(k) * y_history.at(n - k);
+        }
+        y_history.push_back(expected);
+        EXPECT_NEAR(y.at(c), expected, 1e-6) << "order: " << order << ", step: " << step;
+      }
+    }
+  }
+
+  EXPECT_THROW(LowpassFilterBank::createButterworth(1, 0, 5.0, 50.0), std::invalid_argument);
+  EXPECT_THROW(LowpassFilterBank::createButterworth(1, 2, 25.0, 50.0), std::invalid_argument);
+}
@@ -56,12 +56,13 @@ public:
 
   /**
    * @brief Copy constructor.
+   * @details The interpolator is shared with other until one of them is built again.
    * @param other The InterpolatedArray to copy from.
    */
   InterpolatedArray(const InterpolatedArray & other)
   : bases_(other.bases_),
     values_(other.values_),
-    interpolator_(other.interpolator_->clone()),
+    interpolator_(other.interpolator_),
     base_addition_callback_slot_(other.base_addition_callback_slot_)
   {
   }
@@ -73,7 +74,7 @@ public:
   {
     bases_ = bases;
     values_ = values;
-    return interpolator_->build(bases_, values_);
+    return interpolator::detail::get_mutable(interpolator_).build(bases_, values_);
   }
 
   interpolator::InterpolationResult build(
@@ -81,7 +82,7 @@ public:
   {
     bases_ = bases;
     values_ = std::move(values);
-    return interpolator_->build(bases_, values_);
+    return interpolator::detail::get_mutable(interpolator_).build(bases_, values_);
   }
 
   /**
@@ -100,7 +101,7 @@ public:
     if (this != &other) {
       bases_ = other.bases_;
       values_ = other.values_;
-      interpolator_ = other.interpolator_->clone();
+      interpolator_ = other.interpolator_;
       base_addition_callback_slot_ = other.base_addition_callback_slot_;
     }
     return *this;
@@ -181,7 +182,8 @@ public:
       // Set the values in the specified range
       std::fill(values.begin() + start_index, values.begin() + end_index + 1, value);
 
-      const auto success = parent_.interpolator_->build(bases, values);
+      const auto success =
+        interpolator::detail::get_mutable(parent_.interpolator_).build(bases, values);
       if (!success) {
         throw std::runtime_error(
           "Failed to build interpolator.");  // This Exception should not be thrown.
@@ -216,7 +218,7 @@ public:
   InterpolatedArray & operator=(const T & value)
   {
     std::fill(values_.begin(), values_.end(), value);
-    const auto success = interpolator_->build(bases_, values_);
+    const auto success = interpolator::detail::get_mutable(interpolator_).build(bases_, values_);
     if (!success) {
       throw std::runtime_error(
         "Failed to build interpolator.");  // This Exception should not be thrown.
@@ -231,6 +233,16 @@ public:
    */
   T compute(const double x) const { return interpolator_->compute(x); }
 
+  /**
+   * @brief Compute the interpolated values at given positions in one call of the interpolator.
+   * @param xs The positions to compute the values at.
+   * @return The interpolated values.
+   */
+  std::vector<T> compute(const std::vector<double> & xs) const
+  {
+    return interpolator_->compute(xs);
+  }
+
   /**
    * @brief Get the underlying data of the array.
    * @return A pair containing the axis and values.
@@ -58,6 +58,22 @@ protected:
    */
   virtual T compute_impl(const double s) const = 0;
 
+  /**
+   * @brief Compute the interpolated values at the given points.
+   *
+   * This method can be overridden by subclasses to evaluate all the points in one call. The
+   * default implementation calls compute_impl for each point.
+   *
+   * @param ss The points at which to compute the interpolated values, already clamped.
+   * @param values The interpolated values, already sized as ss.
+   */
+  virtual void compute_batch_impl(const std::vector<double> & ss, std::vector<T> & values) const
+  {
+    for (size_t i = 0; i < ss.size(); ++i) {
+      values[i] = compute_impl(ss[i]);
+    }
+  }
+
   /**
    * @brief Build the interpolator with the given values.
    *
@@ -124,6 +140,29 @@ protected:
            1;
   }
 
+  /**
+   * @brief Get the index of the interval containing the input value, searching forward from the
+   * interval of the previous input value.
+   *
+   * This gives the same result as `get_index(s)`, in amortized constant time when the input values
+   * are sorted. If the input value is before the hint, it falls back to `get_index(s)`.
+   *
+   * @param s The input value for which to find the interval index.
+   * @param hint The index returned for the previous input value, or a negative value if none.
+   * @return The index of the interval containing the input value.
+   */
+  int32_t get_index_from_hint(const double s, const int32_t hint) const
+  {
+    if (hint < 0 || s < bases_.at(hint)) {
+      return get_index(s);
+    }
+    int32_t index = hint;
+    while (index + 2 < static_cast<int32_t>(bases_.size()) && bases_.at(index + 1) <= s) {
+      ++index;
+    }
+    return index;
+  }
+
 public:
   InterpolatorCommonInterface() = default;
   virtual ~InterpolatorCommonInterface() = default;
@@ -186,18 +225,24 @@ public:
   }
 
   /**
-   * @brief Compute the interpolated value at the given point.
+   * @brief Compute the interpolated values at the given points.
    *
-   * @param s The point at which to compute the interpolated value.
-   * @return The interpolated value.
+   * The points are evaluated in one call of the interpolator, which sweeps the intervals once
+   * when the points are sorted.
+   *
+   * @param ss The points at which to compute the interpolated values.
+   * @return The interpolated values.
    * @throw std::runtime_error if the interpolator has not been built.
    */
   std::vector<T> compute(const std::vector<double> & ss) const
   {
-    std::vector<T> ret;
+    std::vector<double> clamped_ss;
+    clamped_ss.reserve(ss.size());
     for (const auto s : ss) {
-      ret.push_back(compute(s));
+      clamped_ss.push_back(validate_compute_input(s));
     }
+    std::vector<T> ret(ss.size());
+    compute_batch_impl(clamped_ss, ret);
     return ret;
   }
 
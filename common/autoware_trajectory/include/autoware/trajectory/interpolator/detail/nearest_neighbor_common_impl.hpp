@@ -54,6 +54,24 @@ protected:
              : this->values_.at(idx + 1);
   }
 
+  /**
+   * @brief Compute the interpolated values at the given points, sweeping the intervals once.
+   *
+   * @param ss The points at which to compute the interpolated values.
+   * @param values The interpolated values.
+   */
+  void compute_batch_impl(const std::vector<double> & ss, std::vector<T> & values) const override
+  {
+    int32_t i = -1;
+    for (size_t k = 0; k < ss.size(); ++k) {
+      i = this->get_index_from_hint(ss[k], i);
+      const double s = ss[k];
+      values[k] = (std::abs(s - this->bases_[i]) <= std::abs(s - this->bases_[i + 1]))
+                    ? this->values_.at(i)
+                    : this->values_.at(i + 1);
+    }
+  }
+
   /**
    * @brief Build the interpolator with the given values.
    *
@@ -53,6 +53,22 @@ protected:
     const int32_t idx = this->get_index(s, false);
     return this->values_.at(idx);
   }
+
+  /**
+   * @brief Compute the interpolated values at the given points, sweeping the intervals once.
+   *
+   * @param ss The points at which to compute the interpolated values.
+   * @param values The interpolated values.
+   */
+  void compute_batch_impl(const std::vector<double> & ss, std::vector<T> & values) const override
+  {
+    int32_t i = -1;
+    for (size_t k = 0; k < ss.size(); ++k) {
+      i = this->get_index_from_hint(ss[k], i);
+      // the end belongs to the last value, see get_index(s, false)
+      values[k] = ss[k] == this->end() ? this->values_.back() : this->values_.at(i);
+    }
+  }
   /**
    * @brief Build the interpolator with the given values.
    *
@@ -65,6 +65,40 @@ protected:
    */
   virtual double compute_second_derivative_impl(const double s) const = 0;
 
+  /**
+   * @brief Compute the first derivatives at the given points.
+   *
+   * This method can be overridden by subclasses to evaluate all the points in one call. The
+   * default implementation calls compute_first_derivative_impl for each point.
+   *
+   * @param ss The points at which to compute the first derivatives, already clamped.
+   * @param d The first derivatives, already sized as ss.
+   */
+  virtual void compute_first_derivative_batch_impl(
+    const std::vector<double> & ss, std::vector<double> & d) const
+  {
+    for (size_t i = 0; i < ss.size(); ++i) {
+      d[i] = compute_first_derivative_impl(ss[i]);
+    }
+  }
+
+  /**
+   * @brief Compute the second derivatives at the given points.
+   *
+   * This method can be overridden by subclasses to evaluate all the points in one call. The
+   * default implementation calls compute_second_derivative_impl for each point.
+   *
+   * @param ss The points at which to compute the second derivatives, already clamped.
+   * @param d The second derivatives, already sized as ss.
+   */
+  virtual void compute_second_derivative_batch_impl(
+    const std::vector<double> & ss, std::vector<double> & d) const
+  {
+    for (size_t i = 0; i < ss.size(); ++i) {
+      d[i] = compute_second_derivative_impl(ss[i]);
+    }
+  }
+
 public:
   /**
    * @brief Compute the first derivative at the given point.
@@ -86,11 +120,13 @@ public:
    */
   std::vector<double> compute_first_derivative(const std::vector<double> & ss) const
   {
-    std::vector<double> d;
+    std::vector<double> clamped_ss;
+    clamped_ss.reserve(ss.size());
     for (const auto s : ss) {
-      const double clamped_s = this->validate_compute_input(s);
-      d.push_back(compute_first_derivative_impl(clamped_s));
+      clamped_ss.push_back(this->validate_compute_input(s));
     }
+    std::vector<double> d(ss.size());
+    compute_first_derivative_batch_impl(clamped_ss, d);
     return d;
   }
 
@@ -114,17 +150,40 @@ public:
    */
   std::vector<double> compute_second_derivative(const std::vector<double> & ss) const
   {
-    std::vector<double> d;
+    std::vector<double> clamped_ss;
+    clamped_ss.reserve(ss.size());
     for (const auto s : ss) {
-      const double clamped_s = this->validate_compute_input(s);
-      d.push_back(compute_second_derivative_impl(clamped_s));
+      clamped_ss.push_back(this->validate_compute_input(s));
     }
+    std::vector<double> d(ss.size());
+    compute_second_derivative_batch_impl(clamped_ss, d);
     return d;
   }
 
   virtual std::shared_ptr<InterpolatorInterface<double>> clone() const = 0;
 };
 
+namespace detail
+{
+/**
+ * @brief Get the interpolator to be built again, cloning it first if it is shared.
+ *
+ * Copies of a trajectory share their interpolators, which are not modified by compute. An
+ * interpolator is cloned only when a copy sharing it is built again (copy-on-write).
+ *
+ * @param interpolator The interpolator, replaced with its clone if it is shared.
+ * @return The interpolator exclusively owned by the caller.
+ */
+template <typename T>
+InterpolatorInterface<T> & get_mutable(std::shared_ptr<InterpolatorInterface<T>> & interpolator)
+{
+  if (interpolator.use_count() > 1) {
+    interpolator = interpolator->clone();
+  }
+  return *interpolator;
+}
+}  // namespace detail
+
 }  // namespace autoware::experimental::trajectory::interpolator
 
 #endif  // AUTOWARE__TRAJECTORY__INTERPOLATOR__INTERPOLATOR_HPP_
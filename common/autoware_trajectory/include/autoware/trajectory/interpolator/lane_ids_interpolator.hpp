@@ -43,6 +43,24 @@ protected:
    */
   std::vector<int64_t> compute_impl(const double s) const override;
 
+  /**
+   * @brief Compute the interpolated lane IDs at the given points, sweeping the intervals once.
+   *
+   * @param ss The points at which to compute the interpolated values.
+   * @param values The interpolated lane IDs.
+   */
+  void compute_batch_impl(
+    const std::vector<double> & ss, std::vector<std::vector<int64_t>> & values) const override;
+
+  /**
+   * @brief Compute the interpolated lane IDs at the given point in the given interval.
+   *
+   * @param s The point at which to compute the interpolated value.
+   * @param idx The index of the interval containing s.
+   * @return The interpolated lane IDs.
+   */
+  const std::vector<int64_t> & compute_in_interval(const double s, const int32_t idx) const;
+
   /**
    * @brief Build the interpolator with the given values.
    *
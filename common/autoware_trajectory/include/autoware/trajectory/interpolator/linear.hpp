@@ -78,6 +78,33 @@ private:
    */
   double compute_second_derivative_impl(const double) const override;
 
+  /**
+   * @brief Compute the interpolated values at the given points, sweeping the intervals once.
+   *
+   * @param ss The points at which to compute the interpolated values.
+   * @param values The interpolated values.
+   */
+  void compute_batch_impl(
+    const std::vector<double> & ss, std::vector<double> & values) const override;
+
+  /**
+   * @brief Compute the first derivatives at the given points, sweeping the intervals once.
+   *
+   * @param ss The points at which to compute the first derivatives.
+   * @param d The first derivatives.
+   */
+  void compute_first_derivative_batch_impl(
+    const std::vector<double> & ss, std::vector<double> & d) const override;
+
+  /**
+   * @brief Compute the second derivatives at the given points, sweeping the intervals once.
+   *
+   * @param ss The points at which to compute the second derivatives.
+   * @param d The second derivatives.
+   */
+  void compute_second_derivative_batch_impl(
+    const std::vector<double> & ss, std::vector<double> & d) const override;
+
 public:
   /**
    * @brief Default constructor.
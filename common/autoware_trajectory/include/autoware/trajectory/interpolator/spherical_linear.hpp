@@ -65,6 +65,25 @@ private:
    */
   geometry_msgs::msg::Quaternion compute_impl(const double s) const override;
 
+  /**
+   * @brief Compute the interpolated value at the given point in the given interval.
+   *
+   * @param s The point at which to compute the interpolated value.
+   * @param idx The index of the interval containing the point.
+   * @return The interpolated value.
+   */
+  geometry_msgs::msg::Quaternion compute_slerp(const double s, const int32_t idx) const;
+
+  /**
+   * @brief Compute the interpolated values at the given points, sweeping the intervals once.
+   *
+   * @param ss The points at which to compute the interpolated values.
+   * @param quaternions The interpolated quaternions.
+   */
+  void compute_batch_impl(
+    const std::vector<double> & ss,
+    std::vector<geometry_msgs::msg::Quaternion> & quaternions) const override;
+
 public:
   /**
    * @brief Default constructor.
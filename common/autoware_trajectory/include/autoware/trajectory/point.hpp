@@ -23,6 +23,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <memory>
+#include <mutex>
 #include <utility>
 #include <vector>
 
@@ -51,6 +52,24 @@ protected:
 
   double start_{0.0}, end_{0.0};  //!< Start and end of the arc length of the trajectory
 
+  /**
+   * @brief curvatures at the underlying bases, which are computed on the first request and kept
+   * until the trajectory is built again or cropped
+   */
+  struct CurvatureCache
+  {
+    std::mutex mutex;
+    std::vector<double> bases;
+    std::vector<double> curvatures;
+    bool valid{false};
+  };
+  mutable std::unique_ptr<CurvatureCache> curvature_cache_{std::make_unique<CurvatureCache>()};
+
+  /**
+   * @brief invalidate the cached curvatures, to be called when the xy interpolators are modified
+   */
+  void invalidate_curvature_cache();
+
   /**
    * @brief add the input s if it is not contained in bases_
    */
@@ -62,6 +81,12 @@ protected:
    */
   double clamp(const double s, bool show_warning = false) const;
 
+  /**
+   * @brief Validate the arc lengths are within the trajectory
+   * @param ss Arc lengths
+   */
+  std::vector<double> clamp(const std::vector<double> & ss, bool show_warning = false) const;
+
 public:
   Trajectory();
   virtual ~Trajectory() = default;
@@ -144,6 +169,15 @@ public:
    */
   std::vector<double> curvature(const std::vector<double> & ss) const;
 
+  /**
+   * @brief Get the curvatures at the underlying bases
+   * @details they are computed in one pass over the interpolators on the first call and cached
+   * until the trajectory is built again or cropped, so the modules querying the curvature
+   * profile of the same trajectory compute it once
+   * @return Curvatures at get_underlying_bases()
+   */
+  std::vector<double> curvature_profile() const;
+
   /**
    * @brief Restore the trajectory points
    * @param min_points Minimum number of points
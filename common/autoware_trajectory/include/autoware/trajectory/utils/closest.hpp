@@ -20,6 +20,8 @@
 
 #include <Eigen/Core>
 
+#include <geometry_msgs/msg/point.hpp>
+
 #include <functional>
 #include <optional>
 #include <utility>
@@ -45,6 +47,19 @@ std::optional<double> closest_with_constraint_impl(
   const std::function<Eigen::Vector3d(const double & s)> & trajectory_compute,
   const std::vector<double> & bases, const Eigen::Vector3d & point,
   const std::function<bool(const double &)> & constraint);
+
+/**
+ * @brief Internal implementation to find the closest points on a trajectory to the given points.
+ * @details Each point is first projected onto the polyline of the underlying bases, which are
+ * computed once for all the points. The projection is then refined by a few Newton steps on the
+ * interpolated curve in the X-Y plane, using the azimuth and the curvature of the trajectory.
+ * @param trajectory The trajectory to evaluate, as the base class holding the interpolated curve.
+ * @param points The 3D points to which the closest points on the trajectory are to be found.
+ * @return The parameter `s` of the closest point on the trajectory for each point.
+ */
+std::vector<double> closest_impl(
+  const trajectory::Trajectory<geometry_msgs::msg::Point> & trajectory,
+  const std::vector<Eigen::Vector3d> & points);
 }  // namespace detail::impl
 
 /**
@@ -91,12 +106,36 @@ template <class TrajectoryPointType, class ArgPointType>
 double closest(
   const trajectory::Trajectory<TrajectoryPointType> & trajectory, const ArgPointType & point)
 {
-  std::optional<double> s =
-    *closest_with_constraint(trajectory, point, [](const TrajectoryPointType &) { return true; });
-  if (!s) {
-    throw std::runtime_error("No closest point found.");  // This Exception should not be thrown.
+  using autoware::experimental::trajectory::detail::to_point;
+
+  const auto p = to_point(point);
+  return detail::impl::closest_impl(trajectory, {Eigen::Vector3d(p.x, p.y, p.z)}).front();
+}
+
+/**
+ * @brief Finds the closest points on a trajectory to the given points.
+ * @details This is faster than calling `closest` for each point, since the polyline of the
+ * trajectory is computed once for all the points.
+ * @tparam TrajectoryPointType The type of points in the trajectory.
+ * @tparam ArgPointType The type of the input points.
+ * @param trajectory The trajectory to evaluate.
+ * @param points The points to which the closest points on the trajectory are to be found.
+ * @return The parameter `s` of the closest point on the trajectory for each point.
+ */
+template <class TrajectoryPointType, class ArgPointType>
+std::vector<double> closest(
+  const trajectory::Trajectory<TrajectoryPointType> & trajectory,
+  const std::vector<ArgPointType> & points)
+{
+  using autoware::experimental::trajectory::detail::to_point;
+
+  std::vector<Eigen::Vector3d> eigen_points;
+  eigen_points.reserve(points.size());
+  for (const auto & point : points) {
+    const auto p = to_point(point);
+    eigen_points.emplace_back(p.x, p.y, p.z);
   }
-  return *s;
+  return detail::impl::closest_impl(trajectory, eigen_points);
 }
 }  // namespace autoware::experimental::trajectory
 
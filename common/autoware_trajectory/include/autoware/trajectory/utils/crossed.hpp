@@ -45,6 +45,23 @@ std::vector<double> crossed_with_constraint_impl(
   const std::vector<double> & bases,  //
   const std::vector<std::pair<Eigen::Vector2d, Eigen::Vector2d>> & linestring,
   const std::function<bool(const double &)> & constraint);
+
+/**
+ * @brief Internal implementation to find intersections between a trajectory and a linestring with
+ * constraints.
+ * @param polyline A vector of 2D points of the trajectory at each of the bases.
+ * @param bases A vector of double values representing the sequence of bases for the trajectory.
+ * @param linestring A vector of pairs representing the linestring as a sequence of 2D line
+ * segments.
+ * @param constraint A function that evaluates whether a given parameter `s` satisfies the
+ * constraint.
+ * @return A vector of double values representing the parameters `s` where the trajectory intersects
+ * the linestring and satisfies the constraint.
+ */
+std::vector<double> crossed_with_constraint_impl(
+  const std::vector<Eigen::Vector2d> & polyline, const std::vector<double> & bases,
+  const std::vector<std::pair<Eigen::Vector2d, Eigen::Vector2d>> & linestring,
+  const std::function<bool(const double &)> & constraint);
 }  // namespace detail::impl
 
 /**
@@ -66,20 +83,20 @@ template <class TrajectoryPointType, class LineStringType, class Constraint>
 {
   using autoware::experimental::trajectory::detail::to_point;
 
-  std::function<Eigen::Vector2d(const double & s)> trajectory_compute =
-    [&trajectory](const double & s) {
-      TrajectoryPointType point = trajectory.compute(s);
-      Eigen::Vector2d result;
-      result << to_point(point).x, to_point(point).y;
-      return result;
-    };
-
   std::vector<std::pair<Eigen::Vector2d, Eigen::Vector2d>> linestring_eigen;
 
   if (linestring.end() - linestring.begin() < 2) {
     return {};
   }
 
+  // compute the trajectory at the bases once for all the segments of the linestring
+  const auto bases = trajectory.get_underlying_bases();
+  std::vector<Eigen::Vector2d> polyline;
+  polyline.reserve(bases.size());
+  for (const auto & point : trajectory.compute(bases)) {
+    polyline.emplace_back(to_point(point).x, to_point(point).y);
+  }
+
   auto point_it = linestring.begin();
   auto point_it_next = linestring.begin() + 1;
 
@@ -92,7 +109,7 @@ template <class TrajectoryPointType, class LineStringType, class Constraint>
   }
 
   return detail::impl::crossed_with_constraint_impl(
-    trajectory_compute, trajectory.get_underlying_bases(), linestring_eigen,
+    polyline, bases, linestring_eigen,
     [&constraint, &trajectory](const double & s) { return constraint(trajectory.compute(s)); });
 }
 
@@ -25,8 +25,7 @@ template <class PointType>
 double max_curvature(const Trajectory<PointType> & trajectory)
 {
   double max_curvature = 0.0;
-  for (const auto & base : trajectory.get_underlying_bases()) {
-    const auto curvature = trajectory.curvature(base);
+  for (const auto curvature : trajectory.curvature_profile()) {
     max_curvature = std::max(max_curvature, curvature);
   }
   return max_curvature;
@@ -19,7 +19,6 @@
 #include "autoware/trajectory/forward.hpp"
 
 #include <functional>
-#include <utility>
 #include <vector>
 
 namespace autoware::experimental::trajectory
@@ -38,6 +37,73 @@ struct Interval
 namespace detail::impl
 {
 
+/**
+ * @brief Binary search of the boundary of a constraint between a base where it is not satisfied
+ * and a base where it is satisfied.
+ * @param low The base that does not satisfy the constraint.
+ * @param high The base that satisfies the constraint.
+ * @param constraint A function that evaluates whether a given base satisfies the constraint.
+ * @param max_iter The number of iterations of the binary search.
+ * @return The closest value to the boundary that satisfies the constraint.
+ */
+template <class Constraint>
+double binary_search_boundary(double low, double high, const Constraint & constraint, int max_iter)
+{
+  for (int i = 0; i < max_iter; ++i) {
+    const double mid = 0.5 * (low + high);
+    if (constraint(mid)) {
+      high = mid;  // Mid is valid → move end closer
+    } else {
+      low = mid;  // Mid is invalid → move start forward
+    }
+  }
+  return high;
+}
+
+/**
+ * @brief Internal implementation to find intervals in a sequence of bases that satisfy a
+ * constraint, from the constraint already evaluated at every base.
+ * @param bases A vector of double values representing the sequence of bases.
+ * @param is_satisfied Whether each of the bases satisfies the constraint.
+ * @param constraint A function that evaluates whether a given base satisfies the constraint. It is
+ * called only by the binary search between the bases, if max_iter is positive.
+ * @return A vector of Interval objects representing the intervals where the constraint is
+ * satisfied.
+ */
+template <class Constraint>
+std::vector<Interval> find_intervals_impl(
+  const std::vector<double> & bases, const std::vector<bool> & is_satisfied,
+  const Constraint & constraint, int max_iter = 0)
+{
+  std::vector<Interval> intervals;
+
+  double start = -1.0;
+  bool is_started = false;
+
+  for (size_t i = 0; i < bases.size(); ++i) {
+    if (!is_started && is_satisfied.at(i)) {
+      if (i > 0) {
+        start = binary_search_boundary(bases.at(i - 1), bases.at(i), constraint, max_iter);
+      } else {
+        start = bases.at(i);  // Start a new interval
+      }
+      is_started = true;  // Set the flag to indicate the interval has started
+    } else if (is_started && !is_satisfied.at(i)) {
+      // End the current interval if the constraint fails
+      double end = binary_search_boundary(bases.at(i), bases.at(i - 1), constraint, max_iter);
+      intervals.emplace_back(Interval{start, end});
+      start = -1.0;        // Reset the start
+      is_started = false;  // Reset the flag
+    } else if (is_started && i == bases.size() - 1) {
+      // If the last element is valid, end the interval
+      intervals.emplace_back(Interval{start, bases.at(i)});
+      start = -1.0;        // Reset the start
+      is_started = false;  // Reset the flag
+    }
+  }
+  return intervals;
+}
+
 /**
  * @brief Internal implementation to find intervals in a sequence of bases that satisfy a
  * constraint.
@@ -60,18 +126,25 @@ std::vector<Interval> find_intervals_impl(
  * @param constraint The constraint to apply to each point in the trajectory.
  * @return A vector of Interval objects representing the intervals where the constraint is
  * satisfied.
+ * @note The points at the underlying bases are computed at once and the constraint is inlined, so
+ * that the scan over the bases does not go through std::function.
  */
 template <class TrajectoryPointType, class Constraint>
 std::vector<Interval> find_intervals(
   const Trajectory<TrajectoryPointType> & trajectory, Constraint && constraint, int max_iter = 0)
 {
-  using autoware::experimental::trajectory::detail::to_point;
+  const auto bases = trajectory.get_underlying_bases();
+  const auto points = trajectory.compute(bases);
+
+  std::vector<bool> is_satisfied;
+  is_satisfied.reserve(points.size());
+  for (const auto & point : points) {
+    is_satisfied.push_back(constraint(point));
+  }
 
   return detail::impl::find_intervals_impl(
-    trajectory.get_underlying_bases(),
-    [constraint = std::forward<Constraint>(constraint), &trajectory](const double & s) {
-      return constraint(trajectory.compute(s));
-    },
+    bases, is_satisfied,
+    [&constraint, &trajectory](const double & s) { return constraint(trajectory.compute(s)); },
     max_iter);
 }
 
@@ -37,6 +37,7 @@
 #include <optional>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace autoware::experimental::trajectory
@@ -63,33 +64,30 @@ template <typename PointType>
 std::optional<Trajectory<PointType>> pretty_build(
   const std::vector<PointType> & points, const bool use_akima = false)
 {
-  if (use_akima) {
-    const auto try_input5 = detail::populate5(points);
-    if (!try_input5) {
-      return std::nullopt;
+  using Builder = typename Trajectory<PointType>::Builder;
+  const auto build =
+    [use_akima](const std::vector<PointType> & inputs) -> std::optional<Trajectory<PointType>> {
+    Builder builder{};
+    if (use_akima) {
+      builder.template set_xy_interpolator<interpolator::AkimaSpline>();
     }
-    const auto & points_get5 = try_input5.value();
-
-    using Builder = typename Trajectory<PointType>::Builder;
-    const auto try_trajectory =
-      Builder{}.template set_xy_interpolator<interpolator::AkimaSpline>().build(points_get5);
+    auto try_trajectory = builder.build(inputs);
     if (!try_trajectory) {
       return std::nullopt;
     }
-    return try_trajectory.value();
-  }
-  const auto try_input4 = detail::populate4(points);
-  if (!try_input4) {
-    return std::nullopt;
-  }
-  const auto & points_get4 = try_input4.value();
+    return std::move(try_trajectory.value());
+  };
 
-  using Builder = typename Trajectory<PointType>::Builder;
-  const auto try_trajectory = Builder{}.build(points_get4);
-  if (!try_trajectory) {
+  // the points which are already enough for the spline are built as is, without being copied by
+  // populate4() or populate5()
+  if (points.size() >= (use_akima ? 5 : 4)) {
+    return build(points);
+  }
+  const auto try_populated = use_akima ? detail::populate5(points) : detail::populate4(points);
+  if (!try_populated) {
     return std::nullopt;
   }
-  return try_trajectory.value();
+  return build(try_populated.value());
 }
 
 namespace detail
@@ -172,9 +170,13 @@ tl::expected<std::vector<PointType>, std::string> populate4(const std::vector<Po
     return tl::unexpected(std::string("cannot populate4() from less than 1 points!"));
   }
 
-  const auto try_inputs3 = populate3(inputs);
-  if (!try_inputs3) {
-    return tl::unexpected(try_inputs3.error());
+  // populate3() is only needed for 2 points, otherwise it just copies the inputs
+  tl::expected<std::vector<PointType>, std::string> try_inputs3{};
+  if (inputs.size() == 2) {
+    try_inputs3 = populate3(inputs);
+    if (!try_inputs3) {
+      return tl::unexpected(try_inputs3.error());
+    }
   }
   const auto & inputs3 = inputs.size() == 2 ? try_inputs3.value() : inputs;
 
@@ -228,9 +230,13 @@ tl::expected<std::vector<PointType>, std::string> populate5(const std::vector<Po
     return tl::unexpected(std::string("cannot populate5() from less than 1 points!"));
   }
 
-  const auto try_inputs4 = populate4(inputs);
-  if (!try_inputs4) {
-    return tl::unexpected(try_inputs4.error());
+  // populate4() is only needed for less than 4 points, otherwise it just copies the inputs
+  tl::expected<std::vector<PointType>, std::string> try_inputs4{};
+  if (inputs.size() < 4) {
+    try_inputs4 = populate4(inputs);
+    if (!try_inputs4) {
+      return tl::unexpected(try_inputs4.error());
+    }
   }
   const auto & inputs4 = inputs.size() == 4 ? inputs : try_inputs4.value();
 
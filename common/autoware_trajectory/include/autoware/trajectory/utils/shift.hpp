@@ -17,12 +17,13 @@
 
 #include "autoware/trajectory/detail/types.hpp"
 #include "autoware/trajectory/forward.hpp"
+#include "autoware/trajectory/interpolator/cubic_spline.hpp"
 
-#include <range/v3/view/zip.hpp>
 #include <tl_expected/expected.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <string>
-#include <utility>
 #include <vector>
 
 namespace autoware::experimental::trajectory
@@ -61,39 +62,90 @@ struct ShiftError
 namespace detail
 {
 
-struct ShiftElement
+/**
+ * @struct ShiftProfile
+ * @brief Lateral shift of a single shift interval, which follows the lateral jerk profile
+ */
+struct ShiftProfile
 {
-  std::vector<double> lon_bases;
-  std::vector<double> lat_shifts;
-
-  // Constructor
-  explicit ShiftElement(const std::vector<double> & lon_bases)
-  : lon_bases(lon_bases), lat_shifts(lon_bases.size(), 0.0)
-  {
-  }
-  size_t size() const { return lon_bases.size(); }
+  double start;                     ///< Start position of the shift interval.
+  double end;                       ///< End position of the shift interval.
+  std::vector<double> knots;        ///< Positions of the base points of the profile from start.
+  interpolator::CubicSpline curve;  ///< Lateral shift at the distance from start.
+  double final_shift;               ///< Lateral shift after the end of the interval.
 };
 
 /**
- * @brief Internal implementation to apply a shift to a trajectory.
- * @param reference_bases A vector of double values representing the sequence of bases for the
- * trajectory.
+ * @brief Internal implementation to compute the lateral shift profile of a single interval.
  * @param shift_interval The interval over which the shift is applied.
  * @param shift_parameters The parameters for the shift.
- * @return pair of two vector<double> indicating the new base (original base + additional shift
- * base) and shift value at each base if feasible, otherwise ShiftError type
+ * @return the profile if feasible, otherwise ShiftError type
  */
-tl::expected<ShiftElement, ShiftError> shift_impl(
-  ShiftElement shift_element, const ShiftInterval & shift_interval,
-  const ShiftParameters & shift_parameters);
+tl::expected<ShiftProfile, ShiftError> shift_impl(
+  const ShiftInterval & shift_interval, const ShiftParameters & shift_parameters);
 
 }  // namespace detail
 
 /**
- * @brief Shifts a trajectory based on a single shift interval and parameters.
+ * @class LateralShift
+ * @brief Lateral shift along the reference trajectory accumulated from several shift intervals,
+ * which is evaluated at the requested positions instead of being resampled.
+ */
+class LateralShift
+{
+public:
+  /**
+   * @brief Computes the sum of the lateral shifts of the intervals at the given position.
+   * @param s The position on the reference trajectory.
+   * @return The lateral shift.
+   */
+  double compute(const double s) const;
+
+  /**
+   * @brief Computes the lateral shifts at the given positions. Each interval only evaluates its
+   * profile at the positions inside of it.
+   * @param ss The positions on the reference trajectory, sorted in ascending order.
+   * @return The lateral shift at each position.
+   */
+  std::vector<double> compute(const std::vector<double> & ss) const;
+
+  /**
+   * @brief Gets the positions of the base points of the shift profiles in [start, end], which
+   * should be sampled to reproduce the shift.
+   * @param start The start of the range.
+   * @param end The end of the range.
+   * @return The sorted positions.
+   */
+  std::vector<double> knots(const double start, const double end) const;
+
+private:
+  friend tl::expected<LateralShift, ShiftError> build_lateral_shift(
+    const double reference_start, const double reference_end,
+    const std::vector<ShiftInterval> & shift_intervals, const ShiftParameters & shift_parameters);
+
+  std::vector<detail::ShiftProfile> profiles_;
+  double constant_shift_{0.0};  ///< Sum of the shifts of the intervals before the reference.
+};
+
+/**
+ * @brief Builds the lateral shift of the shift intervals along a reference trajectory.
+ * @param reference_start The start position of the reference trajectory.
+ * @param reference_end The end position of the reference trajectory.
+ * @param shift_intervals The intervals for shifting. The intervals which end before
+ * reference_start shift the whole trajectory by their offset, and the ones which start after
+ * reference_end are ignored.
+ * @param shift_parameters The parameters for the shift.
+ * @return The lateral shift if all the intervals are feasible, otherwise ShiftError type.
+ */
+tl::expected<LateralShift, ShiftError> build_lateral_shift(
+  const double reference_start, const double reference_end,
+  const std::vector<ShiftInterval> & shift_intervals, const ShiftParameters & shift_parameters);
+
+/**
+ * @brief Shifts a trajectory based on multiple shift intervals and parameters.
  * @tparam PointType The type of points in the trajectory.
  * @param reference_trajectory The reference trajectory to be shifted.
- * @param shift_interval The interval for shifting.
+ * @param shift_intervals The intervals for shifting, whose shifts are summed up.
  * @param shift_parameters The parameters for the shift.
  * @return The shifted trajectory.
  */
@@ -102,29 +154,27 @@ tl::expected<trajectory::Trajectory<PointType>, ShiftError> shift(
   const trajectory::Trajectory<PointType> & reference_trajectory,
   const std::vector<ShiftInterval> & shift_intervals, const ShiftParameters & shift_parameters)
 {
-  if (shift_parameters.velocity < 0.0) {
-    return tl::unexpected{ShiftError{"Longitudinal velocity must be positive."}};
+  const auto reference_bases = reference_trajectory.get_underlying_bases();
+  const auto try_lateral_shift = build_lateral_shift(
+    reference_bases.front(), reference_bases.back(), shift_intervals, shift_parameters);
+  if (!try_lateral_shift) {
+    return tl::unexpected{try_lateral_shift.error()};
   }
+  const auto & lateral_shift = try_lateral_shift.value();
 
-  detail::ShiftElement shift_element{reference_trajectory.get_underlying_bases()};
-
-  for (const ShiftInterval & shift_interval : shift_intervals) {
-    auto try_shift = detail::shift_impl(shift_element, shift_interval, shift_parameters);
-    if (!try_shift) {
-      return tl::unexpected{try_shift.error()};
-    }
-    shift_element = std::move(try_shift.value());
-  }
+  // the shifted trajectory is sampled at the reference bases and the knots of the profiles
+  auto bases = lateral_shift.knots(reference_bases.front(), reference_bases.back());
+  bases.insert(bases.end(), reference_bases.begin(), reference_bases.end());
+  std::sort(bases.begin(), bases.end());
+  bases.erase(std::unique(bases.begin(), bases.end()), bases.end());
 
   // Apply shift.
-  std::vector<PointType> shifted_points;
-  shifted_points.reserve(shift_element.lon_bases.size());
-  for (const auto [base, shift_length] :
-       ranges::views::zip(shift_element.lon_bases, shift_element.lat_shifts)) {
-    shifted_points.emplace_back(reference_trajectory.compute(base));
-    const double azimuth = reference_trajectory.azimuth(base);
-    detail::to_point(shifted_points.back()).x += std::sin(azimuth) * shift_length;
-    detail::to_point(shifted_points.back()).y -= std::cos(azimuth) * shift_length;
+  auto shifted_points = reference_trajectory.compute(bases);
+  const auto azimuths = reference_trajectory.azimuth(bases);
+  const auto shift_lengths = lateral_shift.compute(bases);
+  for (size_t i = 0; i < bases.size(); ++i) {
+    detail::to_point(shifted_points[i]).x += std::sin(azimuths[i]) * shift_lengths[i];
+    detail::to_point(shifted_points[i]).y -= std::cos(azimuths[i]) * shift_lengths[i];
   }
   auto shifted_trajectory = reference_trajectory;
   const auto valid = shifted_trajectory.build(shifted_points);
@@ -99,4 +99,37 @@ double AkimaSpline::compute_second_derivative_impl(const double s) const
   return 2 * c_[i] + 6 * d_[i] * dx;
 }
 
+void AkimaSpline::compute_batch_impl(
+  const std::vector<double> & ss, std::vector<double> & values) const
+{
+  int32_t i = -1;
+  for (size_t k = 0; k < ss.size(); ++k) {
+    i = this->get_index_from_hint(ss[k], i);
+    const double dx = ss[k] - this->bases_[i];
+    values[k] = a_[i] + b_[i] * dx + c_[i] * dx * dx + d_[i] * dx * dx * dx;
+  }
+}
+
+void AkimaSpline::compute_first_derivative_batch_impl(
+  const std::vector<double> & ss, std::vector<double> & d) const
+{
+  int32_t i = -1;
+  for (size_t k = 0; k < ss.size(); ++k) {
+    i = this->get_index_from_hint(ss[k], i);
+    const double dx = ss[k] - this->bases_[i];
+    d[k] = b_[i] + 2 * c_[i] * dx + 3 * d_[i] * dx * dx;
+  }
+}
+
+void AkimaSpline::compute_second_derivative_batch_impl(
+  const std::vector<double> & ss, std::vector<double> & d) const
+{
+  int32_t i = -1;
+  for (size_t k = 0; k < ss.size(); ++k) {
+    i = this->get_index_from_hint(ss[k], i);
+    const double dx = ss[k] - this->bases_[i];
+    d[k] = 2 * c_[i] + 6 * d_[i] * dx;
+  }
+}
+
 }  // namespace autoware::experimental::trajectory::interpolator
@@ -23,8 +23,22 @@ namespace autoware::experimental::trajectory::interpolator
 
 std::vector<int64_t> LaneIdsInterpolator::compute_impl(const double s) const
 {
-  const int32_t idx = this->get_index(s);
+  return compute_in_interval(s, this->get_index(s));
+}
+
+void LaneIdsInterpolator::compute_batch_impl(
+  const std::vector<double> & ss, std::vector<std::vector<int64_t>> & values) const
+{
+  int32_t i = -1;
+  for (size_t k = 0; k < ss.size(); ++k) {
+    i = this->get_index_from_hint(ss[k], i);
+    values[k] = compute_in_interval(ss[k], i);
+  }
+}
 
+const std::vector<int64_t> & LaneIdsInterpolator::compute_in_interval(
+  const double s, const int32_t idx) const
+{
   // Check for exact matches at base points
   if (s == this->bases_[idx]) {
     return values_.at(idx);
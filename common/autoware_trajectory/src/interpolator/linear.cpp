@@ -16,6 +16,7 @@
 
 #include <Eigen/Dense>
 
+#include <algorithm>
 #include <utility>
 #include <vector>
 
@@ -63,6 +64,39 @@ double Linear::compute_second_derivative_impl(const double) const
   return 0.0;
 }
 
+void Linear::compute_batch_impl(const std::vector<double> & ss, std::vector<double> & values) const
+{
+  int32_t idx = -1;
+  for (size_t k = 0; k < ss.size(); ++k) {
+    idx = this->get_index_from_hint(ss[k], idx);
+    const double x0 = this->bases_.at(idx);
+    const double x1 = this->bases_.at(idx + 1);
+    const double y0 = this->values_(idx);
+    const double y1 = this->values_(idx + 1);
+    values[k] = y0 + (y1 - y0) * (ss[k] - x0) / (x1 - x0);
+  }
+}
+
+void Linear::compute_first_derivative_batch_impl(
+  const std::vector<double> & ss, std::vector<double> & d) const
+{
+  int32_t idx = -1;
+  for (size_t k = 0; k < ss.size(); ++k) {
+    idx = this->get_index_from_hint(ss[k], idx);
+    const double x0 = this->bases_.at(idx);
+    const double x1 = this->bases_.at(idx + 1);
+    const double y0 = this->values_(idx);
+    const double y1 = this->values_(idx + 1);
+    d[k] = (y1 - y0) / (x1 - x0);
+  }
+}
+
+void Linear::compute_second_derivative_batch_impl(
+  const std::vector<double> &, std::vector<double> & d) const
+{
+  std::fill(d.begin(), d.end(), 0.0);
+}
+
 size_t Linear::minimum_required_points() const
 {
   return 2;
@@ -41,7 +41,22 @@ bool SphericalLinear::build_impl(
 
 geometry_msgs::msg::Quaternion SphericalLinear::compute_impl(const double s) const
 {
-  const int32_t idx = this->get_index(s);
+  return compute_slerp(s, this->get_index(s));
+}
+
+void SphericalLinear::compute_batch_impl(
+  const std::vector<double> & ss, std::vector<geometry_msgs::msg::Quaternion> & quaternions) const
+{
+  int32_t idx = -1;
+  for (size_t k = 0; k < ss.size(); ++k) {
+    idx = this->get_index_from_hint(ss[k], idx);
+    quaternions[k] = compute_slerp(ss[k], idx);
+  }
+}
+
+geometry_msgs::msg::Quaternion SphericalLinear::compute_slerp(
+  const double s, const int32_t idx) const
+{
   const double x0 = this->bases_.at(idx);
   const double x1 = this->bases_.at(idx + 1);
   const geometry_msgs::msg::Quaternion y0 = this->quaternions_.at(idx);
@@ -161,10 +161,18 @@ PointType Trajectory<PointType>::compute(const double s) const
 
 std::vector<PointType> Trajectory<PointType>::compute(const std::vector<double> & ss) const
 {
-  std::vector<PointType> points;
-  points.reserve(ss.size());
-  for (const auto s : ss) {
-    points.emplace_back(compute(s));
+  const auto poses = Trajectory<geometry_msgs::msg::Pose>::compute(ss);
+  const auto ss_clamp = clamp(ss);
+  const auto longitudinal_velocities = this->longitudinal_velocity_mps().compute(ss_clamp);
+  const auto lateral_velocities = this->lateral_velocity_mps().compute(ss_clamp);
+  const auto heading_rates = this->heading_rate_rps().compute(ss_clamp);
+
+  std::vector<PointType> points(ss.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    points[i].pose = poses[i];
+    points[i].longitudinal_velocity_mps = static_cast<float>(longitudinal_velocities[i]);
+    points[i].lateral_velocity_mps = static_cast<float>(lateral_velocities[i]);
+    points[i].heading_rate_rps = static_cast<float>(heading_rates[i]);
   }
   return points;
 }
@@ -177,11 +185,12 @@ std::vector<PointType> Trajectory<PointType>::restore(const size_t min_points) c
     std::vector<PointType> points;
 
     points.reserve(bases.size());
-    for (const auto & s : bases) {
-      const auto point = compute(s);
+    const auto computed = compute(bases);
+    for (size_t i = 0; i < bases.size(); ++i) {
+      const auto & point = computed[i];
       if (points.empty() || !is_almost_same(point, points.back())) {
         points.push_back(point);
-        sanitized_bases.push_back(s);
+        sanitized_bases.push_back(bases[i]);
       }
     }
     if (points.size() >= min_points) {
@@ -193,8 +202,7 @@ std::vector<PointType> Trajectory<PointType>::restore(const size_t min_points) c
   const auto bases = detail::fill_bases(sanitized_bases, min_points);
   std::vector<PointType> points;
   points.reserve(bases.size());
-  for (const auto & s : bases) {
-    const auto point = compute(s);
+  for (const auto & point : compute(bases)) {
     if (points.empty() || !is_almost_same(point, points.back())) {
       points.push_back(point);
     }
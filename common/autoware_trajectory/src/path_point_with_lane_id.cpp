@@ -145,10 +145,13 @@ PointType Trajectory<PointType>::compute(const double s) const
 
 std::vector<PointType> Trajectory<PointType>::compute(const std::vector<double> & ss) const
 {
-  std::vector<PointType> points;
-  points.reserve(ss.size());
-  for (const auto s : ss) {
-    points.emplace_back(compute(s));
+  const auto path_points = BaseClass::compute(ss);
+  const auto lane_ids = this->lane_ids().compute(clamp(ss));
+
+  std::vector<PointType> points(ss.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    points[i].point = path_points[i];
+    points[i].lane_ids = lane_ids[i];
   }
   return points;
 }
@@ -161,11 +164,12 @@ std::vector<PointType> Trajectory<PointType>::restore(const size_t min_points) c
     std::vector<PointType> points;
 
     points.reserve(bases.size());
-    for (const auto & s : bases) {
-      const auto point = compute(s);
+    const auto computed = compute(bases);
+    for (size_t i = 0; i < bases.size(); ++i) {
+      const auto & point = computed[i];
       if (points.empty() || !is_almost_same(point, points.back())) {
         points.push_back(point);
-        sanitized_bases.push_back(s);
+        sanitized_bases.push_back(bases[i]);
       }
     }
     if (points.size() >= min_points) {
@@ -177,8 +181,7 @@ std::vector<PointType> Trajectory<PointType>::restore(const size_t min_points) c
   const auto bases = detail::fill_bases(sanitized_bases, min_points);
   std::vector<PointType> points;
   points.reserve(bases.size());
-  for (const auto & s : bases) {
-    const auto point = compute(s);
+  for (const auto & point : compute(bases)) {
     if (points.empty() || !is_almost_same(point, points.back())) {
       points.push_back(point);
     }
@@ -26,6 +26,7 @@
 #include <cmath>
 #include <cstddef>
 #include <memory>
+#include <mutex>
 #include <utility>
 #include <vector>
 
@@ -40,31 +41,56 @@ Trajectory<PointType>::Trajectory()
 }
 
 Trajectory<PointType>::Trajectory(const Trajectory & rhs)
-: x_interpolator_(rhs.x_interpolator_->clone()),
-  y_interpolator_(rhs.y_interpolator_->clone()),
-  z_interpolator_(rhs.z_interpolator_->clone()),
+: x_interpolator_(rhs.x_interpolator_),
+  y_interpolator_(rhs.y_interpolator_),
+  z_interpolator_(rhs.z_interpolator_),
   bases_(rhs.bases_),
   start_(rhs.start_),
   end_(rhs.end_)
 {
+  if (rhs.curvature_cache_) {
+    const std::lock_guard<std::mutex> lock(rhs.curvature_cache_->mutex);
+    curvature_cache_->bases = rhs.curvature_cache_->bases;
+    curvature_cache_->curvatures = rhs.curvature_cache_->curvatures;
+    curvature_cache_->valid = rhs.curvature_cache_->valid;
+  }
 }
 
 Trajectory<PointType> & Trajectory<PointType>::operator=(const Trajectory & rhs)
 {
   if (this != &rhs) {
-    x_interpolator_ = rhs.x_interpolator_->clone();
-    y_interpolator_ = rhs.y_interpolator_->clone();
-    z_interpolator_ = rhs.z_interpolator_->clone();
+    x_interpolator_ = rhs.x_interpolator_;
+    y_interpolator_ = rhs.y_interpolator_;
+    z_interpolator_ = rhs.z_interpolator_;
     bases_ = rhs.bases_;
     start_ = rhs.start_;
     end_ = rhs.end_;
+    invalidate_curvature_cache();
+    if (rhs.curvature_cache_) {
+      const std::lock_guard<std::mutex> lock(rhs.curvature_cache_->mutex);
+      curvature_cache_->bases = rhs.curvature_cache_->bases;
+      curvature_cache_->curvatures = rhs.curvature_cache_->curvatures;
+      curvature_cache_->valid = rhs.curvature_cache_->valid;
+    }
   }
   return *this;
 }
 
+void Trajectory<PointType>::invalidate_curvature_cache()
+{
+  // a moved-from trajectory gets a new cache
+  if (!curvature_cache_) {
+    curvature_cache_ = std::make_unique<CurvatureCache>();
+    return;
+  }
+  const std::lock_guard<std::mutex> lock(curvature_cache_->mutex);
+  curvature_cache_->valid = false;
+}
+
 interpolator::InterpolationResult Trajectory<PointType>::build(
   const std::vector<PointType> & points)
 {
+  invalidate_curvature_cache();
   if (points.empty()) {
     return tl::unexpected(interpolator::InterpolationFailure{"cannot interpolate 0 size points"});
   }
@@ -103,15 +129,21 @@ interpolator::InterpolationResult Trajectory<PointType>::build(
   start_ = bases_.front();
   end_ = bases_.back();
 
-  if (const auto result = x_interpolator_->build(bases_, std::move(xs)); !result) {
+  if (const auto result = interpolator::detail::get_mutable(x_interpolator_).build(
+        bases_, std::move(xs));
+      !result) {
     return tl::unexpected(
       interpolator::InterpolationFailure{"failed to interpolate Point::x"} + result.error());
   }
-  if (const auto result = y_interpolator_->build(bases_, std::move(ys)); !result) {
+  if (const auto result = interpolator::detail::get_mutable(y_interpolator_).build(
+        bases_, std::move(ys));
+      !result) {
     return tl::unexpected(
       interpolator::InterpolationFailure{"failed to interpolate Point::y"} + result.error());
   }
-  if (const auto result = z_interpolator_->build(bases_, std::move(zs)); !result) {
+  if (const auto result = interpolator::detail::get_mutable(z_interpolator_).build(
+        bases_, std::move(zs));
+      !result) {
     return tl::unexpected(
       interpolator::InterpolationFailure{"failed to interpolate Point::z"} + result.error());
   }
@@ -129,6 +161,17 @@ double Trajectory<PointType>::clamp(const double s, bool show_warning) const
   return std::clamp(s, 0.0, length()) + start_;
 }
 
+std::vector<double> Trajectory<PointType>::clamp(
+  const std::vector<double> & ss, bool show_warning) const
+{
+  std::vector<double> ss_clamp;
+  ss_clamp.reserve(ss.size());
+  for (const auto s : ss) {
+    ss_clamp.push_back(clamp(s, show_warning));
+  }
+  return ss_clamp;
+}
+
 std::vector<double> Trajectory<PointType>::get_internal_bases() const
 {
   return get_underlying_bases();
@@ -173,10 +216,16 @@ PointType Trajectory<PointType>::compute(const double s) const
 
 std::vector<PointType> Trajectory<PointType>::compute(const std::vector<double> & ss) const
 {
-  std::vector<PointType> points;
-  points.reserve(ss.size());
-  for (const auto s : ss) {
-    points.emplace_back(compute(s));
+  const auto ss_clamp = clamp(ss, true);
+  const auto xs = x_interpolator_->compute(ss_clamp);
+  const auto ys = y_interpolator_->compute(ss_clamp);
+  const auto zs = z_interpolator_->compute(ss_clamp);
+
+  std::vector<PointType> points(ss.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    points[i].x = xs[i];
+    points[i].y = ys[i];
+    points[i].z = zs[i];
   }
   return points;
 }
@@ -191,10 +240,13 @@ double Trajectory<PointType>::azimuth(const double s) const
 
 std::vector<double> Trajectory<PointType>::azimuth(const std::vector<double> & ss) const
 {
-  std::vector<double> a;
-  a.reserve(ss.size());
-  for (const auto s : ss) {
-    a.push_back(azimuth(s));
+  const auto ss_clamp = clamp(ss, true);
+  const auto dxs = x_interpolator_->compute_first_derivative(ss_clamp);
+  const auto dys = y_interpolator_->compute_first_derivative(ss_clamp);
+
+  std::vector<double> a(ss.size());
+  for (size_t i = 0; i < a.size(); ++i) {
+    a[i] = std::atan2(dys[i], dxs[i]);
   }
   return a;
 }
@@ -218,14 +270,36 @@ double Trajectory<PointType>::curvature(const double s) const
 
 std::vector<double> Trajectory<PointType>::curvature(const std::vector<double> & ss) const
 {
-  std::vector<double> ks;
-  ks.reserve(ss.size());
-  for (const auto s : ss) {
-    ks.push_back(curvature(s));
+  const auto ss_clamp = clamp(ss, true);
+  const auto dxs = x_interpolator_->compute_first_derivative(ss_clamp);
+  const auto ddxs = x_interpolator_->compute_second_derivative(ss_clamp);
+  const auto dys = y_interpolator_->compute_first_derivative(ss_clamp);
+  const auto ddys = y_interpolator_->compute_second_derivative(ss_clamp);
+
+  std::vector<double> ks(ss.size());
+  for (size_t i = 0; i < ks.size(); ++i) {
+    ks[i] =
+      (dxs[i] * ddys[i] - dys[i] * ddxs[i]) / std::pow(dxs[i] * dxs[i] + dys[i] * dys[i], 1.5);
   }
   return ks;
 }
 
+std::vector<double> Trajectory<PointType>::curvature_profile() const
+{
+  auto bases = get_underlying_bases();
+  if (!curvature_cache_) {
+    return curvature(bases);
+  }
+  const std::lock_guard<std::mutex> lock(curvature_cache_->mutex);
+  // the bases of the derived trajectories can be added without modifying the xy interpolators
+  if (!curvature_cache_->valid || curvature_cache_->bases != bases) {
+    curvature_cache_->curvatures = curvature(bases);
+    curvature_cache_->bases = std::move(bases);
+    curvature_cache_->valid = true;
+  }
+  return curvature_cache_->curvatures;
+}
+
 std::vector<PointType> Trajectory<PointType>::restore(const size_t min_points) const
 {
   std::vector<double> sanitized_bases{};
@@ -234,11 +308,12 @@ std::vector<PointType> Trajectory<PointType>::restore(const size_t min_points) c
     std::vector<PointType> points;
 
     points.reserve(bases.size());
-    for (const auto & s : bases) {
-      const auto point = compute(s);
+    const auto computed = compute(bases);
+    for (size_t i = 0; i < bases.size(); ++i) {
+      const auto & point = computed[i];
       if (points.empty() || !is_almost_same(point, points.back())) {
         points.push_back(point);
-        sanitized_bases.push_back(s);
+        sanitized_bases.push_back(bases[i]);
       }
     }
     if (points.size() >= min_points) {
@@ -250,8 +325,7 @@ std::vector<PointType> Trajectory<PointType>::restore(const size_t min_points) c
   const auto bases = detail::fill_bases(sanitized_bases, min_points);
   std::vector<PointType> points;
   points.reserve(bases.size());
-  for (const auto & s : bases) {
-    const auto point = compute(s);
+  for (const auto & point : compute(bases)) {
     if (points.empty() || !is_almost_same(point, points.back())) {
       points.push_back(point);
     }
@@ -263,6 +337,7 @@ void Trajectory<PointType>::crop(const double start, const double length)
 {
   start_ = std::clamp(start_ + start, start_, end_);
   end_ = std::clamp(start_ + length, start_, end_);
+  invalidate_curvature_cache();
 }
 
 Trajectory<PointType>::Builder::Builder() : trajectory_(std::make_unique<Trajectory<PointType>>())
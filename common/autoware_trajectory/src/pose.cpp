@@ -39,16 +39,16 @@ Trajectory<PointType>::Trajectory()
 }
 
 Trajectory<PointType>::Trajectory(const Trajectory & rhs)
-: BaseClass(rhs), orientation_interpolator_(rhs.orientation_interpolator_->clone())
+: BaseClass(rhs), orientation_interpolator_(rhs.orientation_interpolator_)
 {
 }
 
 Trajectory<PointType>::Trajectory(const Trajectory<geometry_msgs::msg::Point> & point_trajectory)
 : Trajectory()
 {
-  x_interpolator_ = point_trajectory.x_interpolator_->clone();
-  y_interpolator_ = point_trajectory.y_interpolator_->clone();
-  z_interpolator_ = point_trajectory.z_interpolator_->clone();
+  x_interpolator_ = point_trajectory.x_interpolator_;
+  y_interpolator_ = point_trajectory.y_interpolator_;
+  z_interpolator_ = point_trajectory.z_interpolator_;
   bases_ = point_trajectory.get_underlying_bases();
   start_ = point_trajectory.start_;
   end_ = point_trajectory.end_;
@@ -58,7 +58,8 @@ Trajectory<PointType>::Trajectory(const Trajectory<geometry_msgs::msg::Point> &
   for (size_t i = 0; i < bases_.size(); ++i) {
     orientations[i].w = 1.0;
   }
-  auto success = orientation_interpolator_->build(bases_, orientations);
+  auto success =
+    interpolator::detail::get_mutable(orientation_interpolator_).build(bases_, orientations);
 
   if (!success) {
     throw std::runtime_error(
@@ -73,7 +74,7 @@ Trajectory<PointType> & Trajectory<PointType>::operator=(const Trajectory & rhs)
 {
   if (this != &rhs) {
     BaseClass::operator=(rhs);
-    orientation_interpolator_ = rhs.orientation_interpolator_->clone();
+    orientation_interpolator_ = rhs.orientation_interpolator_;
   }
   return *this;
 }
@@ -94,7 +95,8 @@ interpolator::InterpolationResult Trajectory<PointType>::build(
     return tl::unexpected(
       interpolator::InterpolationFailure{"failed to interpolate Pose::points"} + result.error());
   }
-  if (const auto result = orientation_interpolator_->build(bases_, std::move(orientations));
+  if (const auto result = interpolator::detail::get_mutable(orientation_interpolator_)
+                            .build(bases_, std::move(orientations));
       !result) {
     return tl::unexpected(
       interpolator::InterpolationFailure{"failed to interpolate Pose::orientation"} +
@@ -128,10 +130,14 @@ PointType Trajectory<PointType>::compute(const double s) const
 
 std::vector<PointType> Trajectory<PointType>::compute(const std::vector<double> & ss) const
 {
-  std::vector<PointType> points;
-  points.reserve(ss.size());
-  for (const auto s : ss) {
-    points.emplace_back(compute(s));
+  const auto positions = BaseClass::compute(ss);
+  const auto ss_clamp = clamp(ss);
+  const auto orientations = orientation_interpolator_->compute(ss_clamp);
+
+  std::vector<PointType> points(ss.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    points[i].position = positions[i];
+    points[i].orientation = orientations[i];
   }
   return points;
 }
@@ -188,7 +194,8 @@ void Trajectory<PointType>::align_orientation_with_trajectory_direction()
 
     aligned_orientations.emplace_back(aligned_orientation);
   }
-  const auto success = orientation_interpolator_->build(bases_, std::move(aligned_orientations));
+  const auto success = interpolator::detail::get_mutable(orientation_interpolator_)
+                         .build(bases_, std::move(aligned_orientations));
   if (!success) {
     throw std::runtime_error(
       "Failed to build orientation interpolator.");  // This exception should not be thrown.
@@ -203,11 +210,12 @@ std::vector<PointType> Trajectory<PointType>::restore(const size_t min_points) c
     std::vector<PointType> points;
 
     points.reserve(bases.size());
-    for (const auto & s : bases) {
-      const auto point = compute(s);
+    const auto computed = compute(bases);
+    for (size_t i = 0; i < bases.size(); ++i) {
+      const auto & point = computed[i];
       if (points.empty() || !is_almost_same(point, points.back())) {
         points.push_back(point);
-        sanitized_bases.push_back(s);
+        sanitized_bases.push_back(bases[i]);
       }
     }
     if (points.size() >= min_points) {
@@ -219,8 +227,7 @@ std::vector<PointType> Trajectory<PointType>::restore(const size_t min_points) c
   const auto bases = detail::fill_bases(sanitized_bases, min_points);
   std::vector<PointType> points;
   points.reserve(bases.size());
-  for (const auto & s : bases) {
-    const auto point = compute(s);
+  for (const auto & point : compute(bases)) {
     if (points.empty() || !is_almost_same(point, points.back())) {
       points.push_back(point);
     }
@@ -222,10 +222,24 @@ PointType Trajectory<PointType>::compute(const double s) const
 
 std::vector<PointType> Trajectory<PointType>::compute(const std::vector<double> & ss) const
 {
-  std::vector<PointType> points;
-  points.reserve(ss.size());
-  for (const auto s : ss) {
-    points.emplace_back(compute(s));
+  const auto poses = Trajectory<geometry_msgs::msg::Pose>::compute(ss);
+  const auto ss_clamp = clamp(ss);
+  const auto longitudinal_velocities = this->longitudinal_velocity_mps().compute(ss_clamp);
+  const auto lateral_velocities = this->lateral_velocity_mps().compute(ss_clamp);
+  const auto heading_rates = this->heading_rate_rps().compute(ss_clamp);
+  const auto accelerations = this->acceleration_mps2().compute(ss_clamp);
+  const auto front_wheel_angles = this->front_wheel_angle_rad().compute(ss_clamp);
+  const auto rear_wheel_angles = this->rear_wheel_angle_rad().compute(ss_clamp);
+
+  std::vector<PointType> points(ss.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    points[i].pose = poses[i];
+    points[i].longitudinal_velocity_mps = static_cast<float>(longitudinal_velocities[i]);
+    points[i].lateral_velocity_mps = static_cast<float>(lateral_velocities[i]);
+    points[i].heading_rate_rps = static_cast<float>(heading_rates[i]);
+    points[i].acceleration_mps2 = static_cast<float>(accelerations[i]);
+    points[i].front_wheel_angle_rad = static_cast<float>(front_wheel_angles[i]);
+    points[i].rear_wheel_angle_rad = static_cast<float>(rear_wheel_angles[i]);
   }
   return points;
 }
@@ -238,11 +252,12 @@ std::vector<PointType> Trajectory<PointType>::restore(const size_t min_points) c
     std::vector<PointType> points;
 
     points.reserve(bases.size());
-    for (const auto & s : bases) {
-      const auto point = compute(s);
+    const auto computed = compute(bases);
+    for (size_t i = 0; i < bases.size(); ++i) {
+      const auto & point = computed[i];
       if (points.empty() || !is_almost_same(point, points.back())) {
         points.push_back(point);
-        sanitized_bases.push_back(s);
+        sanitized_bases.push_back(bases[i]);
       }
     }
     if (points.size() >= min_points) {
@@ -254,8 +269,7 @@ std::vector<PointType> Trajectory<PointType>::restore(const size_t min_points) c
   const auto bases = detail::fill_bases(sanitized_bases, min_points);
   std::vector<PointType> points;
   points.reserve(bases.size());
-  for (const auto & s : bases) {
-    const auto point = compute(s);
+  for (const auto & point : compute(bases)) {
     if (points.empty() || !is_almost_same(point, points.back())) {
       points.push_back(point);
     }
@@ -14,7 +14,10 @@
 
 #include "autoware/trajectory/utils/closest.hpp"
 
+#include "autoware/trajectory/point.hpp"
+
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <vector>
 
@@ -72,4 +75,78 @@ std::optional<double> closest_with_constraint_impl(
 
   return lengths_from_start_points[std::distance(distances_from_segments.begin(), min_it)];
 }
+
+std::vector<double> closest_impl(
+  const trajectory::Trajectory<geometry_msgs::msg::Point> & trajectory,
+  const std::vector<Eigen::Vector3d> & points)
+{
+  constexpr size_t max_newton_iterations = 5;
+  constexpr double newton_tolerance = 1e-6;
+
+  const auto bases = trajectory.get_underlying_bases();
+  std::vector<Eigen::Vector3d> polyline;
+  polyline.reserve(bases.size());
+  for (const auto & p : trajectory.compute(bases)) {
+    polyline.emplace_back(p.x, p.y, p.z);
+  }
+
+  const auto squared_distance_2d =
+    [](const geometry_msgs::msg::Point & p, const Eigen::Vector3d & point) {
+      return std::pow(p.x - point.x(), 2) + std::pow(p.y - point.y(), 2);
+    };
+
+  std::vector<double> closest_ss;
+  closest_ss.reserve(points.size());
+  for (const auto & point : points) {
+    // project onto the closest segment of the polyline
+    size_t closest_segment = 0;
+    double closest_s = bases.front();
+    double min_distance = std::numeric_limits<double>::max();
+    for (size_t i = 1; i < bases.size(); ++i) {
+      const Eigen::Vector3d v = polyline.at(i) - polyline.at(i - 1);
+      const Eigen::Vector3d w = point - polyline.at(i - 1);
+      const double c1 = w.dot(v);
+      const double c2 = v.dot(v);
+      const double ratio = c2 > 0.0 ? std::clamp(c1 / c2, 0.0, 1.0) : 0.0;
+      const double distance = (w - ratio * v).norm();
+      if (distance < min_distance) {
+        min_distance = distance;
+        closest_segment = i - 1;
+        closest_s = bases.at(i - 1) + ratio * (bases.at(i) - bases.at(i - 1));
+      }
+    }
+
+    // refine on the curve, within the closest segment and its neighbors.
+    // NOTE: the speed of the curve along s is approximately 1, so that the gradient and the
+    // Hessian of the half squared distance are approximated with the azimuth and the curvature.
+    const double lower_s = bases.at(closest_segment == 0 ? 0 : closest_segment - 1);
+    const double upper_s = bases.at(std::min(closest_segment + 2, bases.size() - 1));
+    double s = closest_s;
+    auto p = trajectory.compute(s);
+    for (size_t iteration = 0; iteration < max_newton_iterations; ++iteration) {
+      const double azimuth = trajectory.azimuth(s);
+      const double dx = p.x - point.x();
+      const double dy = p.y - point.y();
+      const double gradient = dx * std::cos(azimuth) + dy * std::sin(azimuth);
+      const double hessian =
+        1.0 + trajectory.curvature(s) * (-dx * std::sin(azimuth) + dy * std::cos(azimuth));
+      if (!std::isfinite(gradient) || !std::isfinite(hessian) || hessian <= 0.0) {
+        break;
+      }
+      const double next_s = std::clamp(s - gradient / hessian, lower_s, upper_s);
+      const auto next_p = trajectory.compute(next_s);
+      if (squared_distance_2d(next_p, point) >= squared_distance_2d(p, point)) {
+        break;
+      }
+      const bool converged = std::abs(next_s - s) < newton_tolerance;
+      s = next_s;
+      p = next_p;
+      if (converged) {
+        break;
+      }
+    }
+    closest_ss.push_back(s);
+  }
+  return closest_ss;
+}
 }  // namespace autoware::experimental::trajectory::detail::impl
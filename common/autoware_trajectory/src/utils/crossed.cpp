@@ -14,25 +14,54 @@
 
 #include "autoware/trajectory/utils/crossed.hpp"
 
+#include <cmath>
 #include <optional>
 #include <vector>
 
 namespace autoware::experimental::trajectory::detail::impl
 {
+namespace
+{
+struct BoundingBox
+{
+  Eigen::Vector2d min;
+  Eigen::Vector2d max;
+};
+
+BoundingBox make_bounding_box(const Eigen::Vector2d & p0, const Eigen::Vector2d & p1)
+{
+  return {p0.cwiseMin(p1), p0.cwiseMax(p1)};
+}
+
+bool overlaps(const BoundingBox & a, const BoundingBox & b)
+{
+  return (a.min.array() <= b.max.array()).all() && (b.min.array() <= a.max.array()).all();
+}
 
+/**
+ * @brief first intersection, in the order of the bases, of the segments of the polyline given by
+ * `candidates` with the line which satisfies the constraint
+ * @param candidates indices i of the segments from polyline[i - 1] to polyline[i] whose bounding
+ * boxes overlap the one of the linestring, in ascending order
+ */
 std::optional<double> crossed_with_constraint_impl(
-  const std::function<Eigen::Vector2d(const double & s)> & trajectory_compute,
-  const std::vector<double> & bases,  //
+  const std::vector<Eigen::Vector2d> & polyline, const std::vector<double> & bases,
+  const std::vector<size_t> & candidates, const std::vector<BoundingBox> & segment_boxes,
   const Eigen::Vector2d & line_start, const Eigen::Vector2d & line_end,
   const std::function<bool(const double &)> & constraint)
 {
-  Eigen::Vector2d line_dir = line_end - line_start;
+  const Eigen::Vector2d line_dir = line_end - line_start;
+  const auto line_box = make_bounding_box(line_start, line_end);
 
-  for (size_t i = 1; i < bases.size(); ++i) {
-    const Eigen::Vector2d p0 = trajectory_compute(bases.at(i - 1));
-    const Eigen::Vector2d p1 = trajectory_compute(bases.at(i));
+  for (const auto i : candidates) {
+    if (!overlaps(segment_boxes[i - 1], line_box)) {
+      continue;
+    }
+
+    const Eigen::Vector2d & p0 = polyline[i - 1];
+    const Eigen::Vector2d & p1 = polyline[i];
 
-    Eigen::Vector2d segment_dir = p1 - p0;
+    const Eigen::Vector2d segment_dir = p1 - p0;
 
     const double det = segment_dir.x() * line_dir.y() - segment_dir.y() * line_dir.x();
 
@@ -40,7 +69,7 @@ std::optional<double> crossed_with_constraint_impl(
       continue;
     }
 
-    Eigen::Vector2d p0_to_line_start = line_start - p0;
+    const Eigen::Vector2d p0_to_line_start = line_start - p0;
 
     const double t =
       (p0_to_line_start.x() * line_dir.y() - p0_to_line_start.y() * line_dir.x()) / det;
@@ -48,7 +77,7 @@ std::optional<double> crossed_with_constraint_impl(
       (p0_to_line_start.x() * segment_dir.y() - p0_to_line_start.y() * segment_dir.x()) / det;
 
     if (t >= 0.0 && t <= 1.0 && u >= 0.0 && u <= 1.0) {
-      double intersection = bases.at(i - 1) + t * (bases.at(i) - bases.at(i - 1));
+      double intersection = bases[i - 1] + t * (bases[i] - bases[i - 1]);
       if (constraint(intersection)) {
         return intersection;
       }
@@ -57,6 +86,7 @@ std::optional<double> crossed_with_constraint_impl(
 
   return std::nullopt;
 }
+}  // namespace
 
 std::vector<double> crossed_with_constraint_impl(
   const std::function<Eigen::Vector2d(const double & s)> & trajectory_compute,
@@ -64,16 +94,50 @@ std::vector<double> crossed_with_constraint_impl(
   const std::vector<std::pair<Eigen::Vector2d, Eigen::Vector2d>> & linestring,
   const std::function<bool(const double &)> & constraint)
 {
-  using trajectory::detail::to_point;
+  std::vector<Eigen::Vector2d> polyline;
+  polyline.reserve(bases.size());
+  for (const auto & base : bases) {
+    polyline.push_back(trajectory_compute(base));
+  }
+  return crossed_with_constraint_impl(polyline, bases, linestring, constraint);
+}
 
+std::vector<double> crossed_with_constraint_impl(
+  const std::vector<Eigen::Vector2d> & polyline, const std::vector<double> & bases,
+  const std::vector<std::pair<Eigen::Vector2d, Eigen::Vector2d>> & linestring,
+  const std::function<bool(const double &)> & constraint)
+{
   std::vector<double> intersections;
+  if (linestring.empty() || bases.size() < 2) {
+    return intersections;
+  }
+
+  // only the segments of the polyline whose bounding boxes overlap the one of the whole linestring
+  // are tested, then against the bounding box of each line of the linestring
+  auto linestring_box = make_bounding_box(linestring.front().first, linestring.front().second);
+  for (const auto & [line_start, line_end] : linestring) {
+    linestring_box.min = linestring_box.min.cwiseMin(line_start.cwiseMin(line_end));
+    linestring_box.max = linestring_box.max.cwiseMax(line_start.cwiseMax(line_end));
+  }
+  std::vector<BoundingBox> segment_boxes;
+  segment_boxes.reserve(bases.size() - 1);
+  std::vector<size_t> candidates;
+  for (size_t i = 1; i < bases.size(); ++i) {
+    segment_boxes.push_back(make_bounding_box(polyline[i - 1], polyline[i]));
+    if (overlaps(segment_boxes.back(), linestring_box)) {
+      candidates.push_back(i);
+    }
+  }
+  if (candidates.empty()) {
+    return intersections;
+  }
 
   for (const auto & line : linestring) {
     const Eigen::Vector2d & line_start = line.first;
     const Eigen::Vector2d & line_end = line.second;
 
-    std::optional<double> intersection =
-      crossed_with_constraint_impl(trajectory_compute, bases, line_start, line_end, constraint);
+    std::optional<double> intersection = crossed_with_constraint_impl(
+      polyline, bases, candidates, segment_boxes, line_start, line_end, constraint);
 
     if (intersection) {
       intersections.push_back(*intersection);
@@ -30,6 +30,7 @@
 #include <algorithm>
 #include <set>
 #include <tuple>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 namespace autoware::experimental::trajectory
@@ -226,14 +227,16 @@ static std::vector<Waypoint> sanitize_and_crop(
 
 /**
  * @param waypoint_chunks WaypointGroupChunk defined on the lanelet_sequence
- * @param lanelet_sequence consecutive lanelet sequence
+ * @param lanelet_with_acc_dist_sequence consecutive lanelet sequence with the accumulated distance
+ * to each lanelet, from accumulate_distance()
  * @param s_start On the interval of [0.0, length(lanelet_sequence)], trim the path from s_start
  * @param s_end On the interval of [0.0, length(lanelet_sequence)], trim the path from s_end
  * @pre s_start < s_end
  */
 static std::vector<Waypoint> consolidate_user_defined_waypoints_and_native_centerline(
   const std::vector<WaypointsGroupChunk> & waypoints_chunks,
-  const lanelet::ConstLanelets & lanelet_sequence, const double s_start, const double s_end)
+  const std::vector<std::pair<lanelet::ConstLanelet, double>> & lanelet_with_acc_dist_sequence,
+  const double s_start, const double s_end)
 {
   // reference path generation algorithm
   //
@@ -255,7 +258,6 @@ static std::vector<Waypoint> consolidate_user_defined_waypoints_and_native_cente
       reference_lanelet_points.emplace_back(point, id);
     }
   };
-  const auto lanelet_with_acc_dist_sequence = accumulate_distance(lanelet_sequence);
 
   // flag to indicate that native point iteration has not passed current_overlapped_chunk_iter yet,
   // which is important if current_overlapped_chunk_iter "steps over" to next lanelet
@@ -436,6 +438,17 @@ LaneletSequenceWithRange supplement_lanelet_sequence(
   auto new_s_start = s_start;
   auto new_s_end = s_end;
 
+  // the longest lanelet of the candidates, measuring each of them once
+  const auto longest_lanelet = [](const lanelet::ConstLanelets & lanelets) {
+    std::pair<lanelet::ConstLanelet, double> longest{lanelets.front(), -1.0};
+    for (const auto & lanelet : lanelets) {
+      if (const double length = lanelet::geometry::length3d(lanelet); length > longest.second) {
+        longest = {lanelet, length};
+      }
+    }
+    return longest;
+  };
+
   std::set<lanelet::Id> visited_prev_lane_ids{extended_lanelet_sequence.front().id()};
   while (new_s_start < 0.0) {
     const auto previous_lanes = previous_lanelets(extended_lanelet_sequence.front(), routing_graph);
@@ -444,39 +457,36 @@ LaneletSequenceWithRange supplement_lanelet_sequence(
       break;
     }
     // take the longest previous lane to construct underlying lanelets
-    const auto longest_previous_lane = *std::max_element(
-      previous_lanes.begin(), previous_lanes.end(), [](const auto & lane1, const auto & lane2) {
-        return lanelet::geometry::length3d(lane1) < lanelet::geometry::length3d(lane2);
-      });
+    const auto [longest_previous_lane, longest_previous_length] = longest_lanelet(previous_lanes);
     if (visited_prev_lane_ids.find(longest_previous_lane.id()) != visited_prev_lane_ids.end()) {
       // loop detected
       break;
     }
     extended_lanelet_sequence.insert(extended_lanelet_sequence.begin(), longest_previous_lane);
     visited_prev_lane_ids.insert(longest_previous_lane.id());
-    new_s_start += lanelet::geometry::length3d(longest_previous_lane);
-    new_s_end += lanelet::geometry::length3d(longest_previous_lane);
+    new_s_start += longest_previous_length;
+    new_s_end += longest_previous_length;
   }
 
+  // the length of extended_lanelet_sequence, which is only extended forward from here
+  double extended_length =
+    lanelet::geometry::length3d(lanelet::LaneletSequence(extended_lanelet_sequence));
   std::set<lanelet::Id> visited_next_lane_ids{extended_lanelet_sequence.back().id()};
-  while (new_s_end >
-         lanelet::geometry::length3d(lanelet::LaneletSequence(extended_lanelet_sequence))) {
+  while (new_s_end > extended_length) {
     const auto next_lanes = following_lanelets(extended_lanelet_sequence.back(), routing_graph);
     if (next_lanes.empty()) {
-      new_s_end = lanelet::geometry::length3d(lanelet::LaneletSequence(extended_lanelet_sequence));
+      new_s_end = extended_length;
       break;
     }
     // take the longest previous lane to construct underlying lanelets
-    const auto longest_next_lane = *std::max_element(
-      next_lanes.begin(), next_lanes.end(), [](const auto & lane1, const auto & lane2) {
-        return lanelet::geometry::length3d(lane1) < lanelet::geometry::length3d(lane2);
-      });
+    const auto [longest_next_lane, longest_next_length] = longest_lanelet(next_lanes);
     if (visited_next_lane_ids.find(longest_next_lane.id()) != visited_next_lane_ids.end()) {
       // loop detected
       break;
     }
     visited_next_lane_ids.insert(longest_next_lane.id());
     extended_lanelet_sequence.push_back(longest_next_lane);
+    extended_length += longest_next_length;
   }
 
   return {extended_lanelet_sequence, new_s_start, new_s_end};
@@ -509,23 +519,34 @@ build_reference_path(
     return std::nullopt;
   }
 
+  // each lanelet is measured once and shared by the waypoints and the centerline consolidation
+  const auto lanelet_with_acc_dist_sequence = accumulate_distance(lanelet_sequence);
+
   UserDefinedWaypointsGroup waypoint_group;
-  for (auto [lanelet, acc_dist] = std::make_tuple(lanelet_sequence.begin(), 0.0);
-       lanelet != lanelet_sequence.end(); ++lanelet) {
-    if (lanelet != lanelet_sequence.begin()) {
-      acc_dist += lanelet::geometry::length3d(*std::prev(lanelet));
-    }
-    if (auto user_defined_waypoint_opt = get_user_defined_waypoint(*lanelet, lanelet_map);
+  for (const auto & [lanelet, acc_dist] : lanelet_with_acc_dist_sequence) {
+    if (auto user_defined_waypoint_opt = get_user_defined_waypoint(lanelet, lanelet_map);
         user_defined_waypoint_opt) {
       waypoint_group.add(
-        std::move(user_defined_waypoint_opt.value()), acc_dist, *lanelet,
+        std::move(user_defined_waypoint_opt.value()), acc_dist, lanelet,
         waypoint_group_separation_distance, waypoint_connection_from_default_point_gradient);
     }
   }
   const auto waypoints_chunks = waypoint_group.waypoints_chunks();
 
   const auto reference_lanelet_points = consolidate_user_defined_waypoints_and_native_centerline(
-    waypoints_chunks, lanelet_sequence, s_start, s_end);
+    waypoints_chunks, lanelet_with_acc_dist_sequence, s_start, s_end);
+
+  // the speed limit is looked up once per lanelet instead of once per point
+  std::unordered_map<lanelet::Id, double> speed_limits;
+  const auto speed_limit = [&](const lanelet::Id lane_id) {
+    if (const auto it = speed_limits.find(lane_id); it != speed_limits.end()) {
+      return it->second;
+    }
+    const double limit =
+      traffic_rules->speedLimit(lanelet_map->laneletLayer.get(lane_id)).speedLimit.value();
+    speed_limits.emplace(lane_id, limit);
+    return limit;
+  };
 
   const auto path_points_with_lane_ids =
     reference_lanelet_points | ranges::views::transform([&](const auto & waypoint) {
@@ -533,9 +554,7 @@ build_reference_path(
       // position
       point.point.pose.position = lanelet::utils::conversion::toGeomMsgPt(waypoint.first);
       // longitudinal_velocity
-      point.point.longitudinal_velocity_mps =
-        traffic_rules->speedLimit(lanelet_map->laneletLayer.get(waypoint.second))
-          .speedLimit.value();
+      point.point.longitudinal_velocity_mps = speed_limit(waypoint.second);
       // lane_ids
       point.lane_ids.push_back(waypoint.second);
       return point;
@@ -17,11 +17,11 @@
 #include "autoware/trajectory/detail/logging.hpp"
 #include "autoware/trajectory/interpolator/cubic_spline.hpp"
 
+#include <range/v3/view/zip.hpp>
 #include <rclcpp/logging.hpp>
 
 #include <algorithm>
 #include <cmath>
-#include <set>
 #include <sstream>
 #include <utility>
 #include <vector>
@@ -235,30 +235,9 @@ static std::pair<std::vector<double>, std::vector<double>> sanitize_same_base(
   return {base_lon, base_lat};
 }
 
-tl::expected<ShiftElement, ShiftError> shift_impl(
-  ShiftElement shift_element, const ShiftInterval & shift_interval,
-  const ShiftParameters & shift_parameters)
+tl::expected<ShiftProfile, ShiftError> shift_impl(
+  const ShiftInterval & shift_interval, const ShiftParameters & shift_parameters)
 {
-  if (std::max(shift_interval.start, shift_interval.end) <= shift_element.lon_bases.front()) {
-    for (auto & lateral_shift : shift_element.lat_shifts) {
-      lateral_shift += shift_interval.lateral_offset;
-    }
-    return shift_element;
-  }
-
-  if (std::min(shift_interval.start, shift_interval.end) >= shift_element.lon_bases.back()) {
-    return shift_element;
-  }
-
-  auto cubic_spline_original = interpolator::CubicSpline::Builder{}
-                                 .set_bases(shift_element.lon_bases)
-                                 .set_values(shift_element.lat_shifts)
-                                 .build();
-
-  if (!cubic_spline_original) {
-    return tl::unexpected(ShiftError{"Failed to build cubic spline of original"});
-  }
-
   const double shift_arc_length = std::abs(shift_interval.end - shift_interval.start);
   // Calculate base lengths
   const auto try_calc_base_length = calc_base_lengths(
@@ -290,55 +269,100 @@ tl::expected<ShiftElement, ShiftError> shift_impl(
     return tl::unexpected{ShiftError{ss.str()}};
   }
 
-  std::set<double> merged_bases{shift_element.lon_bases.begin(), shift_element.lon_bases.end()};
-  for (const auto new_base : base_lon) {
-    merged_bases.insert(new_base + shift_interval.start);
+  const double final_shift = cubic_spline_shift->compute(shift_arc_length);
+  return ShiftProfile{
+    shift_interval.start, shift_interval.end, base_lon, std::move(cubic_spline_shift.value()),
+    final_shift};
+}
+}  // namespace detail
+
+double LateralShift::compute(const double s) const
+{
+  double shift = constant_shift_;
+  for (const auto & profile : profiles_) {
+    if (s < profile.start) {
+      // before shifted
+      continue;
+    }
+    if (s <= profile.end) {
+      // middle
+      shift += profile.curve.compute(s - profile.start);
+    } else {
+      // after shifted
+      shift += profile.final_shift;
+    }
   }
+  return shift;
+}
 
-  const auto shift_start_it = merged_bases.find(base_lon.front() + shift_interval.start);
-  if (shift_start_it == merged_bases.end()) {
-    return tl::unexpected(ShiftError{"could not find shift start base in shift_impl"});
+std::vector<double> LateralShift::compute(const std::vector<double> & ss) const
+{
+  std::vector<double> shifts(ss.size(), constant_shift_);
+  // final_shift of each profile is added from the first position after it by a prefix sum
+  std::vector<double> final_shift_steps(ss.size() + 1, 0.0);
+  for (const auto & profile : profiles_) {
+    const auto first = std::lower_bound(ss.begin(), ss.end(), profile.start);
+    const auto last = std::max(first, std::upper_bound(ss.begin(), ss.end(), profile.end));
+    std::vector<double> distances_from_start;
+    distances_from_start.reserve(std::distance(first, last));
+    for (auto it = first; it != last; ++it) {
+      distances_from_start.push_back(*it - profile.start);
+    }
+    const auto offset = std::distance(ss.begin(), first);
+    if (!distances_from_start.empty()) {
+      const auto middle_shifts = profile.curve.compute(distances_from_start);
+      for (size_t i = 0; i < middle_shifts.size(); ++i) {
+        shifts[offset + i] += middle_shifts[i];
+      }
+    }
+    final_shift_steps[std::distance(ss.begin(), last)] += profile.final_shift;
   }
-  const auto shift_end_it = merged_bases.find(base_lon.back() + shift_interval.start);
-  if (shift_end_it == merged_bases.end()) {
-    return tl::unexpected(ShiftError{"could not find shift end base in shift_impl"});
+  double final_shift = 0.0;
+  for (size_t i = 0; i < ss.size(); ++i) {
+    final_shift += final_shift_steps[i];
+    shifts[i] += final_shift;
   }
+  return shifts;
+}
 
-  // Erase elements from merged_bases that are less than shift_element.lon_bases.front() or greater
-  // than shift_element.lon_bases.back().
-  for (auto it = merged_bases.begin(); it != merged_bases.end();) {
-    if (*it < shift_element.lon_bases.front() || *it > shift_element.lon_bases.back()) {
-      it = merged_bases.erase(it);  // erase returns the next iterator
-    } else {
-      ++it;
+std::vector<double> LateralShift::knots(const double start, const double end) const
+{
+  std::vector<double> knots;
+  for (const auto & profile : profiles_) {
+    for (const auto knot : profile.knots) {
+      if (const double s = knot + profile.start; start <= s && s <= end) {
+        knots.push_back(s);
+      }
     }
   }
+  std::sort(knots.begin(), knots.end());
+  return knots;
+}
 
-  std::vector<double> new_bases;
-  std::vector<double> shift_values;
-  new_bases.reserve(merged_bases.size());
-  shift_values.reserve(merged_bases.size());
+tl::expected<LateralShift, ShiftError> build_lateral_shift(
+  const double reference_start, const double reference_end,
+  const std::vector<ShiftInterval> & shift_intervals, const ShiftParameters & shift_parameters)
+{
+  if (shift_parameters.velocity < 0.0) {
+    return tl::unexpected{ShiftError{"Longitudinal velocity must be positive."}};
+  }
 
-  for (const auto s : merged_bases) {
-    // Calculate the shift length at the current base
-    new_bases.push_back(s);
-    double original = cubic_spline_original->compute(s);
-    if (s < shift_interval.start) {
-      // before shifted
-      shift_values.push_back(original);
-    } else if (s <= shift_interval.end) {
-      // middle
-      shift_values.push_back(original + cubic_spline_shift->compute(s - shift_interval.start));
-    } else {
-      // after shifted
-      shift_values.push_back(original + cubic_spline_shift->compute(shift_arc_length));
+  LateralShift lateral_shift;
+  lateral_shift.profiles_.reserve(shift_intervals.size());
+  for (const ShiftInterval & shift_interval : shift_intervals) {
+    if (std::max(shift_interval.start, shift_interval.end) <= reference_start) {
+      lateral_shift.constant_shift_ += shift_interval.lateral_offset;
+      continue;
+    }
+    if (std::min(shift_interval.start, shift_interval.end) >= reference_end) {
+      continue;
+    }
+    auto try_profile = detail::shift_impl(shift_interval, shift_parameters);
+    if (!try_profile) {
+      return tl::unexpected{try_profile.error()};
     }
+    lateral_shift.profiles_.push_back(std::move(try_profile.value()));
   }
-
-  shift_element.lon_bases = std::move(new_bases);
-  shift_element.lat_shifts = std::move(shift_values);
-
-  return shift_element;
+  return lateral_shift;
 }
-}  // namespace detail
 }  // namespace autoware::experimental::trajectory
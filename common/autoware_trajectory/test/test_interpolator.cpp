@@ -69,6 +69,37 @@ TYPED_TEST(TestInterpolator, compute)
   }
 }
 
+TYPED_TEST(TestInterpolator, compute_batch)
+{
+  this->interpolator =
+    typename TypeParam::Builder().set_bases(this->bases).set_values(this->values).build().value();
+
+  // sorted queries sweeping the intervals, including the bases and the out of range queries
+  std::vector<double> ss{-0.5};
+  for (double s = 0.0; s < this->bases.back(); s += 0.25) {
+    ss.push_back(s);
+  }
+  ss.push_back(this->bases.back());
+  ss.push_back(this->bases.back() + 0.5);
+
+  // unsorted queries fall back to the search from the beginning
+  std::vector<double> unsorted_ss{7.5, 2.0, 8.25, 0.0, 9.0, 3.3};
+
+  for (const auto & queries : {ss, unsorted_ss}) {
+    const auto results = this->interpolator->compute(queries);
+    const auto first_derivatives = this->interpolator->compute_first_derivative(queries);
+    const auto second_derivatives = this->interpolator->compute_second_derivative(queries);
+    ASSERT_EQ(results.size(), queries.size());
+    for (size_t i = 0; i < queries.size(); ++i) {
+      EXPECT_DOUBLE_EQ(results[i], this->interpolator->compute(queries[i]));
+      EXPECT_DOUBLE_EQ(
+        first_derivatives[i], this->interpolator->compute_first_derivative(queries[i]));
+      EXPECT_DOUBLE_EQ(
+        second_derivatives[i], this->interpolator->compute_second_derivative(queries[i]));
+    }
+  }
+}
+
 // Instantiate test cases for all interpolators
 template class TestInterpolator<autoware::experimental::trajectory::interpolator::CubicSpline>;
 template class TestInterpolator<autoware::experimental::trajectory::interpolator::AkimaSpline>;
@@ -121,6 +152,31 @@ TEST(TestLaneIdsInterpolator, compute)
   }
 }
 
+TEST(TestLaneIdsInterpolator, compute_batch)
+{
+  using autoware::experimental::trajectory::interpolator::LaneIdsInterpolator;
+
+  std::vector<double> bases = {0.0, 1.0, 3.0, 3.5, 4.0, 6.0, 7.0, 8.0, 9.0};
+  std::vector<std::vector<int64_t>> values = {{1}, {1}, {1}, {1}, {1, 2}, {2}, {2}, {2}, {2}};
+  auto interpolator = LaneIdsInterpolator::Builder().set_bases(bases).set_values(values).build();
+  ASSERT_TRUE(interpolator);
+
+  std::vector<double> ss;
+  for (double s = 0.0; s < bases.back(); s += 0.25) {
+    ss.push_back(s);
+  }
+  ss.push_back(bases.back());
+  std::vector<double> unsorted_ss{7.5, 3.2, 4.0, 0.0, 9.0, 3.75};
+
+  for (const auto & queries : {ss, unsorted_ss}) {
+    const auto results = interpolator->compute(queries);
+    ASSERT_EQ(results.size(), queries.size());
+    for (size_t i = 0; i < queries.size(); ++i) {
+      EXPECT_EQ(results[i], interpolator->compute(queries[i]));
+    }
+  }
+}
+
 /*
  * Test SphericalLinear interpolator
  */
@@ -172,4 +228,11 @@ TEST(TestSphericalLinearInterpolator, compute)
   EXPECT_NEAR(results[0].x, expected_x, 1e-6);
   EXPECT_NEAR(results[0].y, expected_y, 1e-6);
   EXPECT_NEAR(results[0].z, expected_z, 1e-6);
+  for (size_t i = 0; i < ss.size(); ++i) {
+    const auto expected = interpolator->compute(ss[i]);
+    EXPECT_DOUBLE_EQ(results[i].w, expected.w);
+    EXPECT_DOUBLE_EQ(results[i].x, expected.x);
+    EXPECT_DOUBLE_EQ(results[i].y, expected.y);
+    EXPECT_DOUBLE_EQ(results[i].z, expected.z);
+  }
 }
@@ -680,3 +680,28 @@ TEST(pretty_build, from_4_akima_fail_because_points_are_too_few)
   auto trajectory_opt = autoware::experimental::trajectory::pretty_build(points, true);
   EXPECT_EQ(trajectory_opt.has_value(), false);
 }
+
+TEST(pretty_build, from_enough_points_as_is)
+{
+  std::vector<PathPointWithLaneId> points;
+  for (int i = 0; i < 6; ++i) {
+    PathPointWithLaneId point;
+    point.point.pose = build<Pose>()
+                         .position(build<Point>().x(i).y(0.1 * i * i).z(0.0))
+                         .orientation(create_quaternion_from_yaw(0.0));
+    point.point.longitudinal_velocity_mps = 10.0;
+    point.lane_ids = std::vector<std::int64_t>{1};
+    points.push_back(point);
+  }
+  for (const bool use_akima : {false, true}) {
+    const auto trajectory_opt = autoware::experimental::trajectory::pretty_build(points, use_akima);
+    ASSERT_TRUE(trajectory_opt.has_value());
+    const auto bases = trajectory_opt->get_underlying_bases();
+    ASSERT_EQ(bases.size(), points.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+      EXPECT_NEAR(
+        trajectory_opt->compute(bases.at(i)).point.pose.position.x,
+        points.at(i).point.pose.position.x, 1e-6);
+    }
+  }
+}
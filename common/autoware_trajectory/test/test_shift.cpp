@@ -20,6 +20,7 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <vector>
 
 geometry_msgs::msg::Point point(double x, double y)
@@ -215,4 +216,40 @@ TEST(ShiftInvalid, multiple_shift)
   EXPECT_NEAR(end_point.y, 0.0, 1e-3);
 }
 
+TEST(LateralShift, batch_compute_matches_compute)
+{
+  const double lateral_shift = 2.5;
+  const ShiftInterval shift_interval1{1.0, 9.0, lateral_shift};
+  const ShiftInterval shift_interval2{9.0, 17.0, -lateral_shift};
+  const ShiftInterval shift_interval_before{-10.0, -5.0, 1.0};
+  const ShiftInterval shift_interval_after{20.0, 30.0, 1.0};
+  const ShiftParameters shift_parameter{2.77, 5.0};
+
+  const auto lateral_shift_opt = build_lateral_shift(
+    0.0, 18.0, {shift_interval1, shift_interval2, shift_interval_before, shift_interval_after},
+    shift_parameter);
+  ASSERT_TRUE(lateral_shift_opt);
+
+  std::vector<double> ss;
+  for (double s = 0.0; s <= 18.0; s += 0.5) {
+    ss.push_back(s);
+  }
+  const auto shifts = lateral_shift_opt->compute(ss);
+  ASSERT_EQ(shifts.size(), ss.size());
+  for (size_t i = 0; i < ss.size(); ++i) {
+    EXPECT_DOUBLE_EQ(shifts.at(i), lateral_shift_opt->compute(ss.at(i)));
+  }
+  // the interval before the reference shifts the whole trajectory
+  EXPECT_NEAR(lateral_shift_opt->compute(0.0), 1.0, 1e-3);
+  EXPECT_NEAR(lateral_shift_opt->compute(9.0), 1.0 + lateral_shift, 1e-3);
+  EXPECT_NEAR(lateral_shift_opt->compute(18.0), 1.0, 1e-3);
+
+  const auto knots = lateral_shift_opt->knots(0.0, 18.0);
+  EXPECT_TRUE(std::is_sorted(knots.begin(), knots.end()));
+  for (const auto knot : knots) {
+    EXPECT_GE(knot, 0.0);
+    EXPECT_LE(knot, 18.0);
+  }
+}
+
 }  // namespace autoware::experimental::trajectory
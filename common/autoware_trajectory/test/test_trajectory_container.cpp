@@ -27,6 +27,7 @@
 #include <gtest/gtest.h>
 
 #include <cmath>
+#include <functional>
 #include <utility>
 #include <vector>
 namespace
@@ -297,6 +298,33 @@ TEST_F(TrajectoryTest, manipulate_velocities_with_copy_ctor)
   }
 }
 
+TEST_F(TrajectoryTest, copy_shares_interpolators_until_modified)
+{
+  const auto s = trajectory->length() * 0.5;
+  const auto original_point = trajectory->compute(s);
+
+  // modifying the copies does not modify the shared interpolators of the original
+  Trajectory trajectory2(*trajectory);
+  trajectory2.longitudinal_velocity_mps().range(0.0, trajectory2.length()).set(5.0);
+  Trajectory trajectory3 = trajectory2;
+  const std::vector<autoware_internal_planning_msgs::msg::PathPointWithLaneId> other_points{
+    path_point_with_lane_id(0.0, 0.0, 2), path_point_with_lane_id(1.0, -1.0, 2),
+    path_point_with_lane_id(2.0, -3.0, 2), path_point_with_lane_id(3.0, -6.0, 2)};
+  ASSERT_TRUE(trajectory3.build(other_points));
+
+  const auto point = trajectory->compute(s);
+  EXPECT_DOUBLE_EQ(point.point.pose.position.x, original_point.point.pose.position.x);
+  EXPECT_DOUBLE_EQ(point.point.pose.position.y, original_point.point.pose.position.y);
+  EXPECT_FLOAT_EQ(point.point.longitudinal_velocity_mps, 0.0);
+  EXPECT_EQ(point.lane_ids, original_point.lane_ids);
+
+  EXPECT_FLOAT_EQ(trajectory2.compute(s).point.longitudinal_velocity_mps, 5.0);
+  EXPECT_DOUBLE_EQ(
+    trajectory2.compute(s).point.pose.position.y, original_point.point.pose.position.y);
+  EXPECT_LT(trajectory3.compute(1.0).point.pose.position.y, 0.0);
+  EXPECT_EQ(trajectory3.compute(1.0).lane_ids.front(), 2);
+}
+
 TEST_F(TrajectoryTest, manipulate_velocities_with_copy_assignment)
 {
   auto trajectory2 = *trajectory;
@@ -521,6 +549,32 @@ TEST_F(TrajectoryTest, crossed)
   EXPECT_LT(crossed_point.at(0), trajectory->length());
 }
 
+TEST_F(TrajectoryTest, crossed_with_distant_lines)
+{
+  lanelet::LineString2d line_string;
+  line_string.push_back(lanelet::Point3d(lanelet::InvalId, 0.0, 10.0, 0.0));
+  line_string.push_back(lanelet::Point3d(lanelet::InvalId, 10.0, 0.0, 0.0));
+  const auto expected = autoware::experimental::trajectory::crossed(*trajectory, line_string);
+  ASSERT_EQ(expected.size(), 1);
+
+  // the lines far from the trajectory do not change the crossing of the others
+  lanelet::LineString2d long_line_string;
+  long_line_string.push_back(lanelet::Point3d(lanelet::InvalId, -20.0, 30.0, 0.0));
+  long_line_string.push_back(lanelet::Point3d(lanelet::InvalId, 0.0, 10.0, 0.0));
+  long_line_string.push_back(lanelet::Point3d(lanelet::InvalId, 10.0, 0.0, 0.0));
+  long_line_string.push_back(lanelet::Point3d(lanelet::InvalId, 30.0, -20.0, 0.0));
+  const auto crossed_points =
+    autoware::experimental::trajectory::crossed(*trajectory, long_line_string);
+  ASSERT_EQ(crossed_points.size(), 1);
+  EXPECT_DOUBLE_EQ(crossed_points.at(0), expected.at(0));
+
+  lanelet::LineString2d distant_line_string;
+  distant_line_string.push_back(lanelet::Point3d(lanelet::InvalId, 20.0, 0.0, 0.0));
+  distant_line_string.push_back(lanelet::Point3d(lanelet::InvalId, 30.0, 10.0, 0.0));
+  EXPECT_TRUE(
+    autoware::experimental::trajectory::crossed(*trajectory, distant_line_string).empty());
+}
+
 TEST_F(TrajectoryTest, closest)
 {
   geometry_msgs::msg::Pose pose;
@@ -537,6 +591,36 @@ TEST_F(TrajectoryTest, closest)
   EXPECT_LT(distance, 3.0);
 }
 
+TEST_F(TrajectoryTest, closest_batch)
+{
+  std::vector<geometry_msgs::msg::Pose> poses(3);
+  poses.at(0).position.x = 5.0;
+  poses.at(0).position.y = 5.0;
+  poses.at(1).position.x = 1.0;
+  poses.at(1).position.y = -1.0;
+  poses.at(2).position.x = 8.0;
+  poses.at(2).position.y = 3.0;
+
+  const auto closest_s = autoware::experimental::trajectory::closest(*trajectory, poses);
+  ASSERT_EQ(closest_s.size(), poses.size());
+  for (size_t i = 0; i < poses.size(); ++i) {
+    EXPECT_DOUBLE_EQ(
+      closest_s.at(i), autoware::experimental::trajectory::closest(*trajectory, poses.at(i)));
+
+    // the closest point is not farther than the nearest base point
+    const auto closest_point = trajectory->compute(closest_s.at(i)).point.pose.position;
+    const double distance = std::hypot(
+      closest_point.x - poses.at(i).position.x, closest_point.y - poses.at(i).position.y);
+    for (const auto & base : trajectory->get_underlying_bases()) {
+      const auto base_point = trajectory->compute(base).point.pose.position;
+      EXPECT_LE(
+        distance,
+        std::hypot(base_point.x - poses.at(i).position.x, base_point.y - poses.at(i).position.y) +
+          1e-3);
+    }
+  }
+}
+
 TEST_F(TrajectoryTest, crop)
 {
   double length = trajectory->length();
@@ -615,12 +699,61 @@ TEST_F(TrajectoryTest, find_interval_with_binary_search)
   EXPECT_GT(interval_0_end_error_decrease, 0);
 }
 
+TEST_F(TrajectoryTest, find_interval_same_as_function_constraint)
+{
+  const auto constraint =
+    [](const autoware_internal_planning_msgs::msg::PathPointWithLaneId & point) {
+      return point.point.pose.position.x > 2.0 && point.point.pose.position.x < 6.0;
+    };
+  const std::function<bool(const double &)> function_constraint = [&](const double & s) {
+    return constraint(trajectory->compute(s));
+  };
+
+  for (const int max_iter : {0, 10}) {
+    const auto intervals =
+      autoware::experimental::trajectory::find_intervals(*trajectory, constraint, max_iter);
+    const auto expected = autoware::experimental::trajectory::detail::impl::find_intervals_impl(
+      trajectory->get_underlying_bases(), function_constraint, max_iter);
+    ASSERT_EQ(intervals.size(), expected.size());
+    for (size_t i = 0; i < intervals.size(); ++i) {
+      EXPECT_DOUBLE_EQ(intervals.at(i).start, expected.at(i).start);
+      EXPECT_DOUBLE_EQ(intervals.at(i).end, expected.at(i).end);
+    }
+  }
+}
+
 TEST_F(TrajectoryTest, max_curvature)
 {
   double max_curvature = autoware::experimental::trajectory::max_curvature(*trajectory);
   EXPECT_LT(0, max_curvature);
 }
 
+TEST_F(TrajectoryTest, curvature_profile)
+{
+  const auto check = [](const Trajectory & trajectory) {
+    const auto bases = trajectory.get_underlying_bases();
+    const auto profile = trajectory.curvature_profile();
+    ASSERT_EQ(profile.size(), bases.size());
+    for (size_t i = 0; i < bases.size(); ++i) {
+      EXPECT_NEAR(profile.at(i), trajectory.curvature(bases.at(i)), 1e-9);
+    }
+  };
+  check(*trajectory);
+  // the cached profile is copied with the trajectory
+  const auto copied = *trajectory;
+  check(copied);
+
+  // the profile is updated when the trajectory is cropped or built again
+  trajectory->crop(1.0, trajectory->length() - 2.0);
+  check(*trajectory);
+  std::vector<autoware_internal_planning_msgs::msg::PathPointWithLaneId> points{
+    path_point_with_lane_id(0.00, 0.00, 0), path_point_with_lane_id(2.00, 0.50, 0),
+    path_point_with_lane_id(4.00, 2.00, 0), path_point_with_lane_id(5.00, 4.00, 1),
+    path_point_with_lane_id(5.50, 6.00, 1)};
+  ASSERT_TRUE(trajectory->build(points));
+  check(*trajectory);
+}
+
 TEST_F(TrajectoryTest, get_contained_lane_ids)
 {
   auto contained_lane_ids = trajectory->get_contained_lane_ids();
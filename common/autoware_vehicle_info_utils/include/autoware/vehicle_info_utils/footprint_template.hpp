@@ -0,0 +1,61 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__VEHICLE_INFO_UTILS__FOOTPRINT_TEMPLATE_HPP_
+#define AUTOWARE__VEHICLE_INFO_UTILS__FOOTPRINT_TEMPLATE_HPP_
+
+#include "autoware_utils/geometry/boost_geometry.hpp"
+
+#include <geometry_msgs/msg/pose.hpp>
+
+namespace autoware::vehicle_info_utils
+{
+/**
+ * @brief footprint relative to base_link which is calculated once and placed at many poses, e.g. at
+ * all the points of a trajectory. Each point is placed with the 2x2 rotation of the pose projected
+ * on the xy plane, which is calculated once per pose, instead of an offset pose per point.
+ */
+class FootprintTemplate
+{
+public:
+  explicit FootprintTemplate(autoware_utils::LinearRing2d local_footprint);
+
+  /**
+   * @brief create the rectangle of autoware_utils::to_footprint, i.e. front-left, front-right,
+   * rear-right, rear-left and front-left again
+   */
+  [[nodiscard]] static FootprintTemplate createRectangle(
+    const double base_to_front, const double base_to_rear, const double width);
+
+  [[nodiscard]] const autoware_utils::LinearRing2d & getLocalFootprint() const
+  {
+    return local_footprint_;
+  }
+
+  /**
+   * @brief place the footprint at the pose, with the same x and y as transforming each point by
+   * the pose
+   */
+  [[nodiscard]] autoware_utils::LinearRing2d transform(const geometry_msgs::msg::Pose & pose) const;
+
+  /// @brief place the footprint at the pose as the outer ring of a polygon
+  [[nodiscard]] autoware_utils::Polygon2d transformToPolygon(
+    const geometry_msgs::msg::Pose & pose) const;
+
+private:
+  autoware_utils::LinearRing2d local_footprint_;
+};
+}  // namespace autoware::vehicle_info_utils
+
+#endif  // AUTOWARE__VEHICLE_INFO_UTILS__FOOTPRINT_TEMPLATE_HPP_
@@ -15,6 +15,7 @@
 #ifndef AUTOWARE__VEHICLE_INFO_UTILS__VEHICLE_INFO_HPP_
 #define AUTOWARE__VEHICLE_INFO_UTILS__VEHICLE_INFO_HPP_
 
+#include "autoware/vehicle_info_utils/footprint_template.hpp"
 #include "autoware_utils/geometry/boost_geometry.hpp"
 
 namespace autoware::vehicle_info_utils
@@ -87,6 +88,15 @@ struct VehicleInfo
     const double front_lon_margin, const double rear_lon_margin,
     const bool center_at_base_link = false) const;
 
+  /**
+   * @brief create the template of the rectangular footprint of autoware_utils::to_footprint, from
+   * base_link to the front and rear ends with the vehicle width inflated on each side, to place it
+   * at many poses
+   * @param lat_margin lateral inflation margin on each side
+   */
+  [[nodiscard]] FootprintTemplate createRectangleFootprintTemplate(
+    const double lat_margin = 0.0) const;
+
   [[nodiscard]] double calcMaxCurvature() const;
   [[nodiscard]] double calcCurvatureFromSteerAngle(const double steer_angle) const;
   [[nodiscard]] double calcSteerAngleFromCurvature(const double curvature) const;
@@ -0,0 +1,68 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/vehicle_info_utils/footprint_template.hpp"
+
+#include <utility>
+
+namespace autoware::vehicle_info_utils
+{
+FootprintTemplate::FootprintTemplate(autoware_utils::LinearRing2d local_footprint)
+: local_footprint_(std::move(local_footprint))
+{
+}
+
+FootprintTemplate FootprintTemplate::createRectangle(
+  const double base_to_front, const double base_to_rear, const double width)
+{
+  autoware_utils::LinearRing2d footprint;
+  footprint.reserve(5);
+  footprint.emplace_back(base_to_front, width / 2.0);
+  footprint.emplace_back(base_to_front, -width / 2.0);
+  footprint.emplace_back(-base_to_rear, -width / 2.0);
+  footprint.emplace_back(-base_to_rear, width / 2.0);
+  footprint.emplace_back(base_to_front, width / 2.0);
+  return FootprintTemplate(std::move(footprint));
+}
+
+autoware_utils::LinearRing2d FootprintTemplate::transform(
+  const geometry_msgs::msg::Pose & pose) const
+{
+  // upper-left block of the rotation matrix of the quaternion, normalized as in tf2
+  const auto & q = pose.orientation;
+  const double norm2 = q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w;
+  const double s = norm2 > 0.0 ? 2.0 / norm2 : 0.0;
+  const double r00 = 1.0 - s * (q.y * q.y + q.z * q.z);
+  const double r01 = s * (q.x * q.y - q.z * q.w);
+  const double r10 = s * (q.x * q.y + q.z * q.w);
+  const double r11 = 1.0 - s * (q.x * q.x + q.z * q.z);
+  const double tx = pose.position.x;
+  const double ty = pose.position.y;
+
+  autoware_utils::LinearRing2d footprint;
+  footprint.reserve(local_footprint_.size());
+  for (const auto & p : local_footprint_) {
+    footprint.emplace_back(r00 * p.x() + r01 * p.y() + tx, r10 * p.x() + r11 * p.y() + ty);
+  }
+  return footprint;
+}
+
+autoware_utils::Polygon2d FootprintTemplate::transformToPolygon(
+  const geometry_msgs::msg::Pose & pose) const
+{
+  autoware_utils::Polygon2d polygon;
+  polygon.outer() = transform(pose);
+  return polygon;
+}
+}  // namespace autoware::vehicle_info_utils
@@ -65,6 +65,12 @@ autoware_utils::LinearRing2d VehicleInfo::createFootprint(
   return footprint;
 }
 
+FootprintTemplate VehicleInfo::createRectangleFootprintTemplate(const double lat_margin) const
+{
+  return FootprintTemplate::createRectangle(
+    max_longitudinal_offset_m, rear_overhang_m, vehicle_width_m + lat_margin * 2.0);
+}
+
 VehicleInfo createVehicleInfo(
   const double wheel_radius_m, const double wheel_width_m, const double wheel_base_m_arg,
   const double wheel_tread_m, const double front_overhang_m, const double rear_overhang_m,
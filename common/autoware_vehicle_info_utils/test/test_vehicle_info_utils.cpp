@@ -14,6 +14,8 @@
 
 #include <ament_index_cpp/get_package_share_directory.hpp>
 #include <autoware/vehicle_info_utils/vehicle_info_utils.hpp>
+#include <autoware_utils/geometry/boost_polygon_utils.hpp>
+#include <autoware_utils/geometry/geometry.hpp>
 
 #include <gtest/gtest.h>
 
@@ -85,3 +87,31 @@ TEST_F(VehicleInfoUtilTest, check_vehicle_info_value)
     0.7);
   EXPECT_FLOAT_EQ(vehicle_info.calcSteerAngleFromCurvature(1e-8), 0.0);
 }
+
+TEST(FootprintTemplateTest, transform)
+{
+  using autoware::vehicle_info_utils::createVehicleInfo;
+
+  const auto vehicle_info =
+    createVehicleInfo(0.39, 0.42, 2.74, 1.63, 1.0, 1.03, 0.1, 0.1, 2.5, 0.7);
+  const auto footprint_template = vehicle_info.createRectangleFootprintTemplate(0.5);
+
+  for (const double pitch : {0.0, 0.3}) {
+    for (const double yaw : {0.0, 1.0, -2.5}) {
+      geometry_msgs::msg::Pose pose;
+      pose.position = autoware_utils::create_point(10.0, -5.0, 1.0);
+      pose.orientation = autoware_utils::create_quaternion_from_rpy(0.0, pitch, yaw);
+
+      // same points as the footprint calculated from the offset poses
+      const auto expected = autoware_utils::to_footprint(
+        pose, vehicle_info.max_longitudinal_offset_m, vehicle_info.rear_overhang_m,
+        vehicle_info.vehicle_width_m + 1.0);
+      const auto polygon = footprint_template.transformToPolygon(pose);
+      ASSERT_EQ(polygon.outer().size(), expected.outer().size());
+      for (size_t i = 0; i < expected.outer().size(); ++i) {
+        EXPECT_NEAR(polygon.outer().at(i).x(), expected.outer().at(i).x(), 1e-9);
+        EXPECT_NEAR(polygon.outer().at(i).y(), expected.outer().at(i).y(), 1e-9);
+      }
+    }
+  }
+}
@@ -17,12 +17,28 @@
 #include <autoware/motion_utils/trajectory/trajectory.hpp>
 #include <tf2/utils.hpp>
 
+#include <diagnostic_msgs/msg/diagnostic_status.hpp>
+
+#include <time.h>
+
 #include <algorithm>
+#include <cmath>
 
 namespace autoware::control::simple_pure_pursuit
 {
 using autoware::motion_utils::findNearestIndex;
 
+namespace
+{
+constexpr std::chrono::milliseconds control_period{30};
+constexpr std::chrono::seconds diagnostics_period{1};
+
+double to_milliseconds(const std::chrono::steady_clock::duration & duration)
+{
+  return std::chrono::duration<double, std::milli>(duration).count();
+}
+}  // namespace
+
 SimplePurePursuitNode::SimplePurePursuitNode(const rclcpp::NodeOptions & node_options)
 : Node("simple_pure_pursuit", node_options),
   pub_control_command_(create_publisher<autoware_control_msgs::msg::Control>(
@@ -32,15 +48,121 @@ SimplePurePursuitNode::SimplePurePursuitNode(const rclcpp::NodeOptions & node_op
   lookahead_min_distance_(declare_parameter<float>("lookahead_min_distance")),
   speed_proportional_gain_(declare_parameter<float>("speed_proportional_gain")),
   use_external_target_vel_(declare_parameter<bool>("use_external_target_vel")),
-  external_target_vel_(declare_parameter<float>("external_target_vel"))
+  external_target_vel_(declare_parameter<float>("external_target_vel")),
+  real_time_mode_(declare_parameter<bool>("real_time_mode")),
+  real_time_priority_(declare_parameter<int>("real_time_priority")),
+  real_time_cpu_core_(declare_parameter<int>("real_time_cpu_core")),
+  allowed_period_jitter_ms_(declare_parameter<double>("allowed_period_jitter_ms")),
+  diagnostics_interface_(
+    std::make_unique<autoware_utils_diagnostics::DiagnosticsInterface>(this, "control_loop"))
 {
-  using namespace std::literals::chrono_literals;
+  if (real_time_mode_) {
+    real_time_thread_ = std::thread(&SimplePurePursuitNode::run_real_time_loop, this);
+    return;
+  }
   timer_ = rclcpp::create_timer(
-    this, get_clock(), 30ms, std::bind(&SimplePurePursuitNode::on_timer, this));
+    this, get_clock(), control_period, std::bind(&SimplePurePursuitNode::on_timer, this));
+}
+
+SimplePurePursuitNode::~SimplePurePursuitNode()
+{
+  is_real_time_thread_stopped_ = true;
+  if (real_time_thread_.joinable()) {
+    real_time_thread_.join();
+  }
+}
+
+void SimplePurePursuitNode::run_real_time_loop()
+{
+  configure_real_time_thread();
+
+  // NOTE: the loop sleeps until an absolute time of the monotonic clock, so that neither the
+  // processing time nor a jump of the ROS time shifts the next control.
+  const auto period_ns = std::chrono::nanoseconds(control_period).count();
+  const auto add_period = [&](timespec & time) {
+    time.tv_nsec += period_ns;
+    while (time.tv_nsec >= 1000000000L) {
+      time.tv_nsec -= 1000000000L;
+      ++time.tv_sec;
+    }
+  };
+  const auto is_before = [](const timespec & lhs, const timespec & rhs) {
+    return lhs.tv_sec < rhs.tv_sec || (lhs.tv_sec == rhs.tv_sec && lhs.tv_nsec < rhs.tv_nsec);
+  };
+
+  timespec next_time{};
+  clock_gettime(CLOCK_MONOTONIC, &next_time);
+  while (rclcpp::ok() && !is_real_time_thread_stopped_) {
+    add_period(next_time);
+    clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next_time, nullptr);
+    on_timer();
+
+    // skip the controls missed by an overrun instead of running them in a burst
+    timespec current_time{};
+    clock_gettime(CLOCK_MONOTONIC, &current_time);
+    if (is_before(next_time, current_time)) {
+      next_time = current_time;
+    }
+  }
+}
+
+void SimplePurePursuitNode::configure_real_time_thread()
+{
+  // the memory locking and the stack of the realtime.* parameters are applied by the executor
+  // thread, only the scheduling of this thread is set here
+  autoware::node::RealtimeSettings settings;
+  settings.sched_priority = real_time_priority_;
+  if (real_time_cpu_core_ >= 0) {
+    settings.cpu_affinity = {real_time_cpu_core_};
+  }
+  for (const auto & error : autoware::node::apply_realtime_settings(settings)) {
+    RCLCPP_WARN(get_logger(), "failed to configure the real-time thread, %s", error.c_str());
+  }
+}
+
+void SimplePurePursuitNode::update_control_loop_statistics()
+{
+  auto & statistics = control_loop_statistics_;
+  const auto start_time = std::chrono::steady_clock::now();
+  if (!statistics.prev_start_time) {
+    statistics.prev_start_time = start_time;
+    statistics.window_start_time = start_time;
+    return;
+  }
+
+  const double period_ms = to_milliseconds(start_time - *statistics.prev_start_time);
+  statistics.prev_start_time = start_time;
+  ++statistics.period_count;
+  statistics.period_sum_ms += period_ms;
+  statistics.max_period_ms = std::max(statistics.max_period_ms, period_ms);
+  statistics.max_jitter_ms =
+    std::max(statistics.max_jitter_ms, std::abs(period_ms - to_milliseconds(control_period)));
+  if (start_time - statistics.window_start_time < diagnostics_period) {
+    return;
+  }
+
+  diagnostics_interface_->clear();
+  diagnostics_interface_->add_key_value("is_real_time_mode", real_time_mode_);
+  diagnostics_interface_->add_key_value(
+    "mean_period_ms", statistics.period_sum_ms / static_cast<double>(statistics.period_count));
+  diagnostics_interface_->add_key_value("max_period_ms", statistics.max_period_ms);
+  diagnostics_interface_->add_key_value("max_jitter_ms", statistics.max_jitter_ms);
+  if (statistics.max_jitter_ms > allowed_period_jitter_ms_) {
+    diagnostics_interface_->update_level_and_message(
+      diagnostic_msgs::msg::DiagnosticStatus::WARN,
+      "The jitter of the control period exceeds the allowed one");
+  }
+  diagnostics_interface_->publish(now());
+
+  statistics = ControlLoopStatistics{};
+  statistics.prev_start_time = start_time;
+  statistics.window_start_time = start_time;
 }
 
 void SimplePurePursuitNode::on_timer()
 {
+  update_control_loop_statistics();
+
   // 1. subscribe data
   const auto odom_ptr = odom_sub_.take_data();
   const auto traj_ptr = traj_sub_.take_data();
@@ -48,21 +170,69 @@ void SimplePurePursuitNode::on_timer()
     return;
   }
 
-  // 2. extract subscribed data
-  const auto odom = *odom_ptr;
-  const auto traj = *traj_ptr;
+  // 2. preprocess the trajectory when a new one is received
+  if (traj_ptr != traj_ptr_) {
+    preprocess_trajectory(traj_ptr);
+  }
 
   // 3. create control command
-  const auto control_command = create_control_command(odom, traj);
+  const auto control_command = create_control_command(*odom_ptr);
 
   // 4. publish control command
   pub_control_command_->publish(control_command);
 }
 
+void SimplePurePursuitNode::preprocess_trajectory(const Trajectory::ConstSharedPtr & traj_ptr)
+{
+  traj_ptr_ = traj_ptr;
+  prev_closest_traj_point_idx_ = std::nullopt;
+
+  const auto & points = traj_ptr_->points;
+  traj_arc_lengths_.resize(points.size());
+  double arc_length = 0.0;
+  for (size_t i = 0; i < points.size(); ++i) {
+    if (i != 0) {
+      arc_length += std::hypot(
+        points.at(i).pose.position.x - points.at(i - 1).pose.position.x,
+        points.at(i).pose.position.y - points.at(i - 1).pose.position.y);
+    }
+    traj_arc_lengths_.at(i) = arc_length;
+  }
+}
+
+size_t SimplePurePursuitNode::find_closest_traj_point_idx(const Odometry & odom) const
+{
+  const auto & points = traj_ptr_->points;
+  const auto & ego_position = odom.pose.pose.position;
+  if (!prev_closest_traj_point_idx_) {
+    return findNearestIndex(points, ego_position);
+  }
+
+  // NOTE: the ego moves little between the control ticks, so the closest point is searched
+  // locally from the previous one. The search is global again for each new trajectory.
+  const auto calc_squared_distance = [&](const size_t idx) {
+    const double dx = points.at(idx).pose.position.x - ego_position.x;
+    const double dy = points.at(idx).pose.position.y - ego_position.y;
+    return dx * dx + dy * dy;
+  };
+  size_t closest_idx = std::min(*prev_closest_traj_point_idx_, points.size() - 1);
+  while (closest_idx + 1 < points.size() &&
+         calc_squared_distance(closest_idx + 1) <= calc_squared_distance(closest_idx)) {
+    ++closest_idx;
+  }
+  while (closest_idx > 0 &&
+         calc_squared_distance(closest_idx - 1) < calc_squared_distance(closest_idx)) {
+    --closest_idx;
+  }
+  return closest_idx;
+}
+
 autoware_control_msgs::msg::Control SimplePurePursuitNode::create_control_command(
-  const Odometry & odom, const Trajectory & traj)
+  const Odometry & odom)
 {
-  const size_t closest_traj_point_idx = findNearestIndex(traj.points, odom.pose.pose.position);
+  const auto & traj = *traj_ptr_;
+  const size_t closest_traj_point_idx = find_closest_traj_point_idx(odom);
+  prev_closest_traj_point_idx_ = closest_traj_point_idx;
 
   // when the ego reaches the goal
   if (closest_traj_point_idx == traj.points.size() - 1 || traj.points.size() <= 5) {
@@ -85,7 +255,7 @@ autoware_control_msgs::msg::Control SimplePurePursuitNode::create_control_comman
   control_command.stamp = odom.header.stamp;
   control_command.longitudinal = calc_longitudinal_control(odom, target_longitudinal_vel);
   control_command.lateral =
-    calc_lateral_control(odom, traj, target_longitudinal_vel, closest_traj_point_idx);
+    calc_lateral_control(odom, target_longitudinal_vel, closest_traj_point_idx);
 
   return control_command;
 }
@@ -104,9 +274,11 @@ autoware_control_msgs::msg::Longitudinal SimplePurePursuitNode::calc_longitudina
 }
 
 autoware_control_msgs::msg::Lateral SimplePurePursuitNode::calc_lateral_control(
-  const Odometry & odom, const Trajectory & traj, const double target_longitudinal_vel,
+  const Odometry & odom, const double target_longitudinal_vel,
   const size_t closest_traj_point_idx) const
 {
+  const auto & traj = *traj_ptr_;
+
   // calculate lookahead distance
   const double lookahead_distance =
     lookahead_gain_ * target_longitudinal_vel + lookahead_min_distance_;
@@ -119,8 +291,19 @@ autoware_control_msgs::msg::Lateral SimplePurePursuitNode::calc_lateral_control(
     odom.pose.pose.position.y - vehicle_info_.wheel_base_m / 2.0 * std::sin(vehicle_heading);
 
   // search lookahead point
+  // NOTE: by the triangle inequality, the points closer than the lookahead distance along the
+  // trajectory from the rear wheel center are also closer in distance, so they are skipped by a
+  // binary search.
+  const auto & closest_position = traj.points.at(closest_traj_point_idx).pose.position;
+  const double rear_arc_length =
+    traj_arc_lengths_.at(closest_traj_point_idx) -
+    std::hypot(closest_position.x - rear_x, closest_position.y - rear_y);
+  const auto arc_length_itr = std::lower_bound(
+    traj_arc_lengths_.begin() + closest_traj_point_idx, traj_arc_lengths_.end(),
+    rear_arc_length + lookahead_distance);
   auto lookahead_point_itr = std::find_if(
-    traj.points.begin() + closest_traj_point_idx, traj.points.end(),
+    traj.points.begin() + std::distance(traj_arc_lengths_.begin(), arc_length_itr),
+    traj.points.end(),
     [&](const TrajectoryPoint & point) {
       return std::hypot(point.pose.position.x - rear_x, point.pose.position.y - rear_y) >=
              lookahead_distance;
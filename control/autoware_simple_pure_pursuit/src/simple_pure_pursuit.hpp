@@ -15,6 +15,8 @@
 #ifndef SIMPLE_PURE_PURSUIT_HPP_
 #define SIMPLE_PURE_PURSUIT_HPP_
 
+#include <autoware/node/realtime_configurator.hpp>
+#include <autoware_utils_diagnostics/diagnostics_interface.hpp>
 #include <autoware_utils_rclcpp/polling_subscriber.hpp>
 #include <autoware_vehicle_info_utils/vehicle_info_utils.hpp>
 #include <rclcpp/rclcpp.hpp>
@@ -24,16 +26,34 @@
 #include <autoware_planning_msgs/msg/trajectory_point.hpp>
 #include <nav_msgs/msg/odometry.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
+
 namespace autoware::control::simple_pure_pursuit
 {
 using autoware_planning_msgs::msg::Trajectory;
 using autoware_planning_msgs::msg::TrajectoryPoint;
 using nav_msgs::msg::Odometry;
 
+struct ControlLoopStatistics
+{
+  std::optional<std::chrono::steady_clock::time_point> prev_start_time;
+  std::chrono::steady_clock::time_point window_start_time;
+  size_t period_count{0};
+  double period_sum_ms{0.0};
+  double max_period_ms{0.0};
+  double max_jitter_ms{0.0};
+};
+
 class SimplePurePursuitNode : public rclcpp::Node
 {
 public:
   explicit SimplePurePursuitNode(const rclcpp::NodeOptions & node_options);
+  ~SimplePurePursuitNode() override;
 
 private:
   // subscribers
@@ -48,6 +68,19 @@ private:
   // timer
   rclcpp::TimerBase::SharedPtr timer_;
 
+  // real-time mode
+  const bool real_time_mode_;
+  const int real_time_priority_;
+  const int real_time_cpu_core_;
+  std::thread real_time_thread_;
+  std::atomic<bool> is_real_time_thread_stopped_{false};
+  autoware::node::RealtimeConfigurator realtime_configurator_{this};
+
+  // control loop diagnostics
+  const double allowed_period_jitter_ms_;
+  std::unique_ptr<autoware_utils_diagnostics::DiagnosticsInterface> diagnostics_interface_;
+  ControlLoopStatistics control_loop_statistics_;
+
   // vehicle info
   const autoware::vehicle_info_utils::VehicleInfo vehicle_info_;
 
@@ -58,14 +91,23 @@ private:
   const bool use_external_target_vel_;
   const double external_target_vel_;
 
+  // trajectory preprocessed once per received message
+  Trajectory::ConstSharedPtr traj_ptr_;
+  std::vector<double> traj_arc_lengths_;
+  std::optional<size_t> prev_closest_traj_point_idx_;
+
   // functions
   void on_timer();
-  autoware_control_msgs::msg::Control create_control_command(
-    const Odometry & odom, const Trajectory & traj);
+  void run_real_time_loop();
+  void configure_real_time_thread();
+  void update_control_loop_statistics();
+  void preprocess_trajectory(const Trajectory::ConstSharedPtr & traj_ptr);
+  size_t find_closest_traj_point_idx(const Odometry & odom) const;
+  autoware_control_msgs::msg::Control create_control_command(const Odometry & odom);
   autoware_control_msgs::msg::Longitudinal calc_longitudinal_control(
     const Odometry & odom, const double target_longitudinal_vel) const;
   autoware_control_msgs::msg::Lateral calc_lateral_control(
-    const Odometry & odom, const Trajectory & traj, const double target_longitudinal_vel,
+    const Odometry & odom, const double target_longitudinal_vel,
     const size_t closest_traj_point_idx) const;
 
 public:
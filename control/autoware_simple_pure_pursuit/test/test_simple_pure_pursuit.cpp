@@ -58,7 +58,13 @@ protected:
   autoware_control_msgs::msg::Control create_control_command(
     const Odometry & odom, const Trajectory & traj) const
   {
-    return node_->create_control_command(odom, traj);
+    node_->preprocess_trajectory(std::make_shared<Trajectory>(traj));
+    return node_->create_control_command(odom);
+  }
+
+  autoware_control_msgs::msg::Control create_control_command(const Odometry & odom) const
+  {
+    return node_->create_control_command(odom);
   }
 
   autoware_control_msgs::msg::Longitudinal calc_longitudinal_control(
@@ -71,7 +77,8 @@ protected:
     const Odometry & odom, const Trajectory & traj, const double target_longitudinal_vel,
     const size_t closest_traj_point_idx) const
   {
-    return node_->calc_lateral_control(odom, traj, target_longitudinal_vel, closest_traj_point_idx);
+    node_->preprocess_trajectory(std::make_shared<Trajectory>(traj));
+    return node_->calc_lateral_control(odom, target_longitudinal_vel, closest_traj_point_idx);
   }
 
   double speed_proportional_gain() const { return node_->speed_proportional_gain_; }
@@ -111,6 +118,16 @@ TEST_F(SimplePurePursuitNodeTest, create_control_command)
     EXPECT_DOUBLE_EQ(result.longitudinal.velocity, 0.0);
     EXPECT_DOUBLE_EQ(result.longitudinal.acceleration, -10.0);
   }
+
+  {  // the closest point is searched from the one of the previous control
+    const auto traj = autoware::test_utils::generateTrajectory<Trajectory>(10, 1.0, 1.0);
+    create_control_command(makeOdometry(0.0, 0.0, 0.0), traj);
+
+    const auto result = create_control_command(makeOdometry(10.0, 0.0, 0.0));
+
+    EXPECT_DOUBLE_EQ(result.longitudinal.velocity, 0.0);
+    EXPECT_DOUBLE_EQ(result.longitudinal.acceleration, -10.0);
+  }
 }
 
 TEST_F(SimplePurePursuitNodeTest, calc_longitudinal_control)
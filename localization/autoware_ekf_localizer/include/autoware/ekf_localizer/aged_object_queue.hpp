@@ -15,8 +15,10 @@
 #ifndef AUTOWARE__EKF_LOCALIZER__AGED_OBJECT_QUEUE_HPP_
 #define AUTOWARE__EKF_LOCALIZER__AGED_OBJECT_QUEUE_HPP_
 
+#include <algorithm>
 #include <cstddef>
-#include <queue>
+#include <deque>
+#include <utility>
 
 namespace autoware::ekf_localizer
 {
@@ -35,35 +37,62 @@ public:
 
   void push(const Object & object)
   {
-    objects_.push(object);
-    ages_.push(0);
+    objects_.push_back(object);
+    ages_.push_back(0);
   }
 
   Object pop_increment_age()
   {
     const Object object = objects_.front();
     const size_t age = ages_.front() + 1;
-    objects_.pop();
-    ages_.pop();
+    objects_.pop_front();
+    ages_.pop_front();
 
     if (age < max_age_) {
-      objects_.push(object);
-      ages_.push(age);
+      objects_.push_back(object);
+      ages_.push_back(age);
     }
 
     return object;
   }
 
+  /**
+   * @brief same as calling pop_increment_age() size() times, without popping and pushing the
+   * objects
+   */
+  template <typename Function>
+  void for_each_increment_age(Function function)
+  {
+    size_t kept_num = 0;
+    for (size_t i = 0; i < objects_.size(); ++i) {
+      function(static_cast<const Object &>(objects_[i]));
+      if (ages_[i] + 1 < max_age_) {
+        if (kept_num != i) {
+          objects_[kept_num] = std::move(objects_[i]);
+        }
+        ages_[kept_num++] = ages_[i] + 1;
+      }
+    }
+    objects_.erase(objects_.begin() + static_cast<std::ptrdiff_t>(kept_num), objects_.end());
+    ages_.erase(ages_.begin() + static_cast<std::ptrdiff_t>(kept_num), ages_.end());
+  }
+
+  template <typename Predicate>
+  [[nodiscard]] bool any_of(Predicate predicate) const
+  {
+    return std::any_of(objects_.begin(), objects_.end(), predicate);
+  }
+
   void clear()
   {
-    objects_ = std::queue<Object>();
-    ages_ = std::queue<size_t>();
+    objects_.clear();
+    ages_.clear();
   }
 
 private:
   const size_t max_age_;
-  std::queue<Object> objects_;
-  std::queue<size_t> ages_;
+  std::deque<Object> objects_;
+  std::deque<size_t> ages_;
 };
 
 }  // namespace autoware::ekf_localizer
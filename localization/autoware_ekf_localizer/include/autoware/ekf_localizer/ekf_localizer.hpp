@@ -18,8 +18,10 @@
 #include "autoware/ekf_localizer/aged_object_queue.hpp"
 #include "autoware/ekf_localizer/ekf_module.hpp"
 #include "autoware/ekf_localizer/hyper_parameters.hpp"
+#include "autoware/ekf_localizer/measurement_ring.hpp"
 #include "autoware/ekf_localizer/warning.hpp"
 
+#include <autoware/node/realtime_configurator.hpp>
 #include <autoware_utils_logging/logger_level_configure.hpp>
 #include <autoware_utils_system/stop_watch.hpp>
 #include <rclcpp/rclcpp.hpp>
@@ -42,10 +44,12 @@
 #include <tf2_ros/transform_broadcaster.h>
 #include <tf2_ros/transform_listener.h>
 
+#include <atomic>
 #include <chrono>
 #include <iostream>
 #include <memory>
-#include <queue>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -66,12 +70,17 @@ public:
 private:
   const std::shared_ptr<Warning> warning_;
 
+  //!< @brief applies the realtime.* parameters to the thread which spins the node
+  autoware::node::RealtimeConfigurator realtime_configurator_{this};
+
   //!< @brief ekf estimated pose publisher
   rclcpp::Publisher<geometry_msgs::msg::PoseStamped>::SharedPtr pub_pose_;
   //!< @brief estimated ekf pose with covariance publisher
   rclcpp::Publisher<geometry_msgs::msg::PoseWithCovarianceStamped>::SharedPtr pub_pose_cov_;
   //!< @brief estimated ekf odometry publisher
   rclcpp::Publisher<nav_msgs::msg::Odometry>::SharedPtr pub_odom_;
+  //!< @brief ekf odometry extrapolated at extrapolation_frequency publisher
+  rclcpp::Publisher<nav_msgs::msg::Odometry>::SharedPtr pub_extrapolated_odom_;
   //!< @brief ekf estimated twist publisher
   rclcpp::Publisher<geometry_msgs::msg::TwistStamped>::SharedPtr pub_twist_;
   //!< @brief ekf estimated twist with covariance publisher
@@ -94,8 +103,13 @@ private:
   //!< @brief measurement twist with covariance subscriber
   rclcpp::Subscription<geometry_msgs::msg::TwistWithCovarianceStamped>::SharedPtr
     sub_twist_with_cov_;
+  //!< @brief callback group of the measurement subscribers, if node.event_driven_measurement
+  rclcpp::CallbackGroup::SharedPtr measurement_callback_group_;
   //!< @brief time for ekf calculation callback
   rclcpp::TimerBase::SharedPtr timer_control_;
+  //!< @brief timer of the extrapolated odometry, in its own callback group
+  rclcpp::CallbackGroup::SharedPtr extrapolation_callback_group_;
+  rclcpp::TimerBase::SharedPtr timer_extrapolation_;
   //!< @brief last predict time
   std::shared_ptr<const rclcpp::Time> last_predict_time_;
   //!< @brief trigger_node service
@@ -117,21 +131,41 @@ private:
   const HyperParameters params_;
 
   double ekf_dt_;
+  //!< @brief whether the last timer callbacks coasted with the last estimate
+  bool is_coasting_{false};
 
-  bool is_activated_;
-  bool is_set_initialpose_;
+  std::atomic<bool> is_activated_;
+  std::atomic<bool> is_set_initialpose_;
 
   EKFDiagnosticInfo pose_diag_info_;
   EKFDiagnosticInfo twist_diag_info_;
 
-  AgedObjectQueue<geometry_msgs::msg::PoseWithCovarianceStamped::SharedPtr> pose_queue_;
-  AgedObjectQueue<geometry_msgs::msg::TwistWithCovarianceStamped::SharedPtr> twist_queue_;
+  AgedObjectQueue<PoseMeasurement> pose_queue_;
+  AgedObjectQueue<TwistMeasurement> twist_queue_;
+
+  //!< @brief latest odometry of the filter, extrapolated by timer_extrapolation_
+  std::mutex latest_odometry_mutex_;
+  std::optional<nav_msgs::msg::Odometry> latest_odometry_;
+
+  //!< @brief measurements from the subscribers to the timer, if node.event_driven_measurement
+  std::unique_ptr<MeasurementRing<PoseMeasurement>> pose_ring_;
+  std::unique_ptr<MeasurementRing<TwistMeasurement>> twist_ring_;
 
   /**
    * @brief computes update & prediction of EKF for each ekf_dt_[s] time
    */
   void timer_callback();
 
+  /**
+   * @brief publish the latest odometry extrapolated to the current time
+   */
+  void timer_extrapolation_callback();
+
+  /**
+   * @brief move the measurements of the rings to the queues
+   */
+  void take_measurements_from_rings();
+
   /**
    * @brief set pose with covariance measurement
    */
@@ -153,6 +187,12 @@ private:
    */
   void update_predict_frequency(const rclcpp::Time & current_time);
 
+  /**
+   * @brief whether the filter can be skipped, when the vehicle is stopped, no pose nor moving
+   * twist is queued and the last prediction is more recent than the idle period
+   */
+  bool is_idle(const rclcpp::Time & current_time) const;
+
   /**
    * @brief get transform from frame_id
    */
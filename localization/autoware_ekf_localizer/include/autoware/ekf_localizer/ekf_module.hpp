@@ -16,11 +16,11 @@
 #define AUTOWARE__EKF_LOCALIZER__EKF_MODULE_HPP_
 
 #include "autoware/ekf_localizer/hyper_parameters.hpp"
+#include "autoware/ekf_localizer/matrix_types.hpp"
 #include "autoware/ekf_localizer/state_index.hpp"
 #include "autoware/ekf_localizer/warning.hpp"
 
-#include <autoware/kalman_filter/kalman_filter.hpp>
-#include <autoware/kalman_filter/time_delay_kalman_filter.hpp>
+#include <autoware/kalman_filter/fixed_time_delay_kalman_filter.hpp>
 #include <rclcpp/rclcpp.hpp>
 #include <tf2/utils.hpp>
 
@@ -31,11 +31,12 @@
 #include <geometry_msgs/msg/twist_with_covariance_stamped.hpp>
 
 #include <memory>
+#include <optional>
 #include <vector>
 
 namespace autoware::ekf_localizer
 {
-using autoware::kalman_filter::TimeDelayKalmanFilter;
+using autoware::kalman_filter::FixedTimeDelayKalmanFilter;
 
 struct EKFDiagnosticInfo
 {
@@ -48,6 +49,26 @@ struct EKFDiagnosticInfo
   double mahalanobis_distance{0.0};
 };
 
+/**
+ * @brief pose measurement, pre-processed once on arrival and applied pose_smoothing_steps times
+ */
+struct PoseMeasurement
+{
+  geometry_msgs::msg::PoseWithCovarianceStamped::ConstSharedPtr pose;
+  Eigen::Vector3d y;  //!< @brief x, y, yaw, where yaw is not offset by the EKF yaw yet
+  Eigen::Matrix3d r;  //!< @brief covariance of y, multiplied by pose_smoothing_steps
+};
+
+/**
+ * @brief twist measurement, pre-processed once on arrival and applied twist_smoothing_steps times
+ */
+struct TwistMeasurement
+{
+  geometry_msgs::msg::TwistWithCovarianceStamped::ConstSharedPtr twist;
+  Eigen::Vector2d y;  //!< @brief vx, wz
+  Eigen::Matrix2d r;  //!< @brief covariance of y, multiplied by twist_smoothing_steps
+};
+
 class Simple1DFilter
 {
 public:
@@ -118,12 +139,33 @@ public:
   void accumulate_delay_time(const double dt);
 
   void predict_with_delay(const double dt);
+
+  /**
+   * @brief check a measurement and compute what does not depend on the EKF state, empty if the
+   * measurement is invalid
+   */
+  [[nodiscard]] std::optional<PoseMeasurement> preprocess_pose(
+    const PoseWithCovariance::ConstSharedPtr & pose) const;
+  [[nodiscard]] std::optional<TwistMeasurement> preprocess_twist(
+    const TwistWithCovariance::ConstSharedPtr & twist) const;
+
+  /**
+   * @brief gate a measurement and stack it into the update of the cycle, which is applied by
+   * apply_measurement_update(), false if it is rejected
+   * @details the gates of all the measurements of the cycle use the state before the update
+   */
   bool measurement_update_pose(
-    const PoseWithCovariance & pose, const rclcpp::Time & t_curr,
+    const PoseMeasurement & pose, const rclcpp::Time & t_curr,
     EKFDiagnosticInfo & pose_diag_info);
   bool measurement_update_twist(
-    const TwistWithCovariance & twist, const rclcpp::Time & t_curr,
+    const TwistMeasurement & twist, const rclcpp::Time & t_curr,
     EKFDiagnosticInfo & twist_diag_info);
+
+  /**
+   * @brief apply the measurements of the cycle as a single update, with one inversion of the
+   * stacked innovation covariance
+   */
+  bool apply_measurement_update();
   geometry_msgs::msg::PoseWithCovarianceStamped compensate_rph_with_delay(
     const PoseWithCovariance & pose, tf2::Vector3 last_angular_velocity, const double delay_time);
 
@@ -131,7 +173,7 @@ private:
   void update_simple_1d_filters(
     const geometry_msgs::msg::PoseWithCovarianceStamped & pose, const size_t smoothing_step);
 
-  TimeDelayKalmanFilter kalman_filter_;
+  FixedTimeDelayKalmanFilter<6> kalman_filter_;  // x, y, yaw, yaw_bias, vx, wz
 
   std::shared_ptr<Warning> warning_;
   const int dim_x_;
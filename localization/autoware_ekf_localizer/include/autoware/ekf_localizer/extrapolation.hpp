@@ -0,0 +1,32 @@
+// Copyright 2025 Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__EKF_LOCALIZER__EXTRAPOLATION_HPP_
+#define AUTOWARE__EKF_LOCALIZER__EXTRAPOLATION_HPP_
+
+#include <nav_msgs/msg/odometry.hpp>
+
+namespace autoware::ekf_localizer
+{
+
+/**
+ * @brief move the pose of the odometry by its twist during dt, with the kinematics model of the
+ * EKF: constant longitudinal and yaw velocities in the horizontal plane
+ */
+nav_msgs::msg::Odometry extrapolate_odometry(
+  const nav_msgs::msg::Odometry & odometry, const double dt);
+
+}  // namespace autoware::ekf_localizer
+
+#endif  // AUTOWARE__EKF_LOCALIZER__EXTRAPOLATION_HPP_
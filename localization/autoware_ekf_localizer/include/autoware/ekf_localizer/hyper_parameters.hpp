@@ -31,8 +31,13 @@ public:
     ekf_rate(node->declare_parameter<double>("node.predict_frequency")),
     ekf_dt(1.0 / std::max(ekf_rate, 0.1)),
     tf_rate_(node->declare_parameter<double>("node.tf_rate")),
+    extrapolation_frequency(node->declare_parameter<double>("node.extrapolation_frequency")),
     enable_yaw_bias_estimation(node->declare_parameter<bool>("node.enable_yaw_bias_estimation")),
     extend_state_step(node->declare_parameter<int>("node.extend_state_step")),
+    event_driven_measurement(node->declare_parameter<bool>("node.event_driven_measurement")),
+    idle_predict_frequency(node->declare_parameter<double>("node.idle_predict_frequency")),
+    idle_max_velocity(node->declare_parameter<double>("node.idle_max_velocity")),
+    idle_max_angular_velocity(node->declare_parameter<double>("node.idle_max_angular_velocity")),
     pose_frame_id(node->declare_parameter<std::string>("misc.pose_frame_id")),
     pose_additional_delay(
       node->declare_parameter<double>("pose_measurement.pose_additional_delay")),
@@ -75,8 +80,13 @@ public:
   const double ekf_rate;
   const double ekf_dt;
   const double tf_rate_;
+  const double extrapolation_frequency;
   const bool enable_yaw_bias_estimation;
   const size_t extend_state_step;
+  const bool event_driven_measurement;
+  const double idle_predict_frequency;     //!< @brief  filter rate while stopped, disabled if 0
+  const double idle_max_velocity;          //!< @brief  [m/s] max |vx| of the stopped vehicle
+  const double idle_max_angular_velocity;  //!< @brief  [rad/s] max |wz| of the stopped vehicle
   const std::string pose_frame_id;
   const double pose_additional_delay;
   const double pose_gate_dist;
@@ -0,0 +1,74 @@
+// Copyright 2025 Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__EKF_LOCALIZER__MEASUREMENT_RING_HPP_
+#define AUTOWARE__EKF_LOCALIZER__MEASUREMENT_RING_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace autoware::ekf_localizer
+{
+
+/**
+ * @brief lock-free ring of a fixed capacity, between one producer thread calling push() and one
+ * consumer thread calling pop()
+ */
+template <typename Object>
+class MeasurementRing
+{
+public:
+  explicit MeasurementRing(const size_t capacity) : objects_(capacity + 1) {}
+
+  /**
+   * @brief add an object, or return false if the ring is full
+   */
+  bool push(Object object)
+  {
+    const size_t tail = tail_.load(std::memory_order_relaxed);
+    const size_t next_tail = (tail + 1) % objects_.size();
+    if (next_tail == head_.load(std::memory_order_acquire)) {
+      return false;
+    }
+    objects_[tail] = std::move(object);
+    tail_.store(next_tail, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief take the oldest object, or return false if the ring is empty
+   */
+  bool pop(Object & object)
+  {
+    const size_t head = head_.load(std::memory_order_relaxed);
+    if (head == tail_.load(std::memory_order_acquire)) {
+      return false;
+    }
+    object = std::move(objects_[head]);
+    head_.store((head + 1) % objects_.size(), std::memory_order_release);
+    return true;
+  }
+
+private:
+  std::vector<Object> objects_;
+  // on separate cache lines, as they are written by different threads
+  alignas(64) std::atomic<size_t> head_{0};
+  alignas(64) std::atomic<size_t> tail_{0};
+};
+
+}  // namespace autoware::ekf_localizer
+
+#endif  // AUTOWARE__EKF_LOCALIZER__MEASUREMENT_RING_HPP_
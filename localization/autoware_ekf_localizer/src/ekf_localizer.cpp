@@ -15,6 +15,7 @@
 #include "autoware/ekf_localizer/ekf_localizer.hpp"
 
 #include "autoware/ekf_localizer/diagnostics.hpp"
+#include "autoware/ekf_localizer/extrapolation.hpp"
 #include "autoware/ekf_localizer/string.hpp"
 #include "autoware/ekf_localizer/warning_message.hpp"
 #include "autoware/localization_util/covariance_ellipse.hpp"
@@ -27,9 +28,9 @@
 #include <fmt/core.h>
 
 #include <algorithm>
+#include <cmath>
 #include <functional>
 #include <memory>
-#include <queue>
 #include <string>
 #include <utility>
 #include <vector>
@@ -44,6 +45,14 @@ namespace autoware::ekf_localizer
 
 using std::placeholders::_1;
 
+namespace
+{
+// number of measurements received between two timer callbacks before they are dropped
+constexpr size_t measurement_ring_capacity = 100;
+// the extrapolated odometry is not published if the filter has not run for this time [s]
+constexpr double max_extrapolation_time = 1.0;
+}  // namespace
+
 EKFLocalizer::EKFLocalizer(const rclcpp::NodeOptions & node_options)
 : rclcpp::Node("ekf_localizer", node_options),
   warning_(std::make_shared<Warning>(this)),
@@ -66,6 +75,7 @@ EKFLocalizer::EKFLocalizer(const rclcpp::NodeOptions & node_options)
   pub_pose_cov_ =
     create_publisher<geometry_msgs::msg::PoseWithCovarianceStamped>("ekf_pose_with_covariance", 1);
   pub_odom_ = create_publisher<nav_msgs::msg::Odometry>("ekf_odom", 1);
+  pub_extrapolated_odom_ = create_publisher<nav_msgs::msg::Odometry>("ekf_extrapolated_odom", 1);
   pub_twist_ = create_publisher<geometry_msgs::msg::TwistStamped>("ekf_twist", 1);
   pub_twist_cov_ = create_publisher<geometry_msgs::msg::TwistWithCovarianceStamped>(
     "ekf_twist_with_covariance", 1);
@@ -79,12 +89,24 @@ EKFLocalizer::EKFLocalizer(const rclcpp::NodeOptions & node_options)
     "debug/processing_time_ms", 1);
   sub_initialpose_ = create_subscription<geometry_msgs::msg::PoseWithCovarianceStamped>(
     "initialpose", 1, std::bind(&EKFLocalizer::callback_initial_pose, this, _1));
+  rclcpp::SubscriptionOptions measurement_subscription_options;
+  if (params_.event_driven_measurement) {
+    // the measurements are pre-processed on arrival, concurrently with the timer on a
+    // multi-threaded executor, and handed over to the timer through the rings
+    measurement_callback_group_ =
+      create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+    measurement_subscription_options.callback_group = measurement_callback_group_;
+    pose_ring_ = std::make_unique<MeasurementRing<PoseMeasurement>>(measurement_ring_capacity);
+    twist_ring_ = std::make_unique<MeasurementRing<TwistMeasurement>>(measurement_ring_capacity);
+  }
   sub_pose_with_cov_ = create_subscription<geometry_msgs::msg::PoseWithCovarianceStamped>(
     "in_pose_with_covariance", 1,
-    std::bind(&EKFLocalizer::callback_pose_with_covariance, this, _1));
+    std::bind(&EKFLocalizer::callback_pose_with_covariance, this, _1),
+    measurement_subscription_options);
   sub_twist_with_cov_ = create_subscription<geometry_msgs::msg::TwistWithCovarianceStamped>(
     "in_twist_with_covariance", 1,
-    std::bind(&EKFLocalizer::callback_twist_with_covariance, this, _1));
+    std::bind(&EKFLocalizer::callback_twist_with_covariance, this, _1),
+    measurement_subscription_options);
 #if ROS_DISTRO_HUMBLE
   const auto service_trigger_qos = rclcpp::ServicesQoS().get_rmw_qos_profile();
 #else
@@ -96,6 +118,16 @@ EKFLocalizer::EKFLocalizer(const rclcpp::NodeOptions & node_options)
       &EKFLocalizer::service_trigger_node, this, std::placeholders::_1, std::placeholders::_2),
     service_trigger_qos);
 
+  if (params_.extrapolation_frequency > 0.0) {
+    // does not wait for the filter on a multi-threaded executor
+    extrapolation_callback_group_ =
+      create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+    timer_extrapolation_ = rclcpp::create_timer(
+      this, get_clock(), rclcpp::Duration::from_seconds(1.0 / params_.extrapolation_frequency),
+      std::bind(&EKFLocalizer::timer_extrapolation_callback, this),
+      extrapolation_callback_group_);
+  }
+
   tf_br_ = std::make_shared<tf2_ros::TransformBroadcaster>(
     std::shared_ptr<rclcpp::Node>(this, [](auto) {}));
 
@@ -120,7 +152,9 @@ void EKFLocalizer::update_predict_frequency(const rclcpp::Time & current_time)
       if (ekf_dt_ > 10.0) {
         ekf_dt_ = 10.0;
         warning_->warn(large_ekf_dt_waring_message(ekf_dt_));
-      } else if (ekf_dt_ > static_cast<double>(params_.pose_smoothing_steps) / params_.ekf_rate) {
+      } else if (
+        !is_coasting_ &&
+        ekf_dt_ > static_cast<double>(params_.pose_smoothing_steps) / params_.ekf_rate) {
         warning_->warn_throttle(too_slow_ekf_dt_waring_message(ekf_dt_), 2000);
       }
 
@@ -131,6 +165,37 @@ void EKFLocalizer::update_predict_frequency(const rclcpp::Time & current_time)
   last_predict_time_ = std::make_shared<const rclcpp::Time>(current_time);
 }
 
+/*
+ * is_idle
+ */
+bool EKFLocalizer::is_idle(const rclcpp::Time & current_time) const
+{
+  if (params_.idle_predict_frequency <= 0.0 || !last_predict_time_) {
+    return false;
+  }
+  const auto is_moving = [this](const double vx, const double wz) {
+    return std::abs(vx) > params_.idle_max_velocity ||
+           std::abs(wz) > params_.idle_max_angular_velocity;
+  };
+  // a new pose or a motion, estimated or measured, resumes the full rate, while the twists of the
+  // stopped vehicle wait in the queue for the next cycle
+  if (!pose_queue_.empty()) {
+    return false;
+  }
+  const auto twist = ekf_module_->get_current_twist(current_time).twist;
+  if (is_moving(twist.linear.x, twist.angular.z)) {
+    return false;
+  }
+  const auto is_moving_twist = [&is_moving](const TwistMeasurement & measurement) {
+    return is_moving(measurement.y(0), measurement.y(1));
+  };
+  if (twist_queue_.any_of(is_moving_twist)) {
+    return false;
+  }
+  const double elapsed_time = (current_time - *last_predict_time_).seconds();
+  return elapsed_time >= 0.0 && elapsed_time < 1.0 / params_.idle_predict_frequency;
+}
+
 /*
  * timer_callback
  */
@@ -140,6 +205,8 @@ void EKFLocalizer::timer_callback()
 
   const rclcpp::Time current_time = this->now();
 
+  take_measurements_from_rings();
+
   if (!is_activated_) {
     warning_->warn_throttle(
       "The node is not activated. Provide initial pose to pose_initializer", 2000);
@@ -156,9 +223,21 @@ void EKFLocalizer::timer_callback()
 
   DEBUG_INFO(get_logger(), "========================= timer called =========================");
 
+  /* coast with the last estimate, which is constant while the vehicle is stopped */
+  if (is_idle(current_time)) {
+    is_coasting_ = true;
+    publish_estimate_result(
+      ekf_module_->get_current_pose(current_time, false),
+      ekf_module_->get_current_pose(current_time, true),
+      ekf_module_->get_current_twist(current_time));
+    return;
+  }
+
   /* update predict frequency with measured timer rate */
   update_predict_frequency(current_time);
 
+  is_coasting_ = false;
+
   /* predict model in EKF */
   stop_watch_.tic();
   DEBUG_INFO(get_logger(), "------------------------- start prediction -------------------------");
@@ -180,15 +259,12 @@ void EKFLocalizer::timer_callback()
     DEBUG_INFO(get_logger(), "------------------------- start Pose -------------------------");
     stop_watch_.tic();
 
-    // save the initial size because the queue size can change in the loop
-    const size_t n = pose_queue_.size();
-    for (size_t i = 0; i < n; ++i) {
-      const auto pose = pose_queue_.pop_increment_age();
-      bool is_updated = ekf_module_->measurement_update_pose(*pose, current_time, pose_diag_info_);
+    pose_queue_.for_each_increment_age([&](const PoseMeasurement & pose) {
+      bool is_updated = ekf_module_->measurement_update_pose(pose, current_time, pose_diag_info_);
       if (is_updated) {
         pose_is_updated = true;
       }
-    }
+    });
     DEBUG_INFO(
       get_logger(), "[EKF] measurement_update_pose calc time = %f [ms]", stop_watch_.toc());
     DEBUG_INFO(get_logger(), "------------------------- end Pose -------------------------\n");
@@ -209,22 +285,27 @@ void EKFLocalizer::timer_callback()
     DEBUG_INFO(get_logger(), "------------------------- start Twist -------------------------");
     stop_watch_.tic();
 
-    // save the initial size because the queue size can change in the loop
-    const size_t n = twist_queue_.size();
-    for (size_t i = 0; i < n; ++i) {
-      const auto twist = twist_queue_.pop_increment_age();
+    twist_queue_.for_each_increment_age([&](const TwistMeasurement & twist) {
       bool is_updated =
-        ekf_module_->measurement_update_twist(*twist, current_time, twist_diag_info_);
+        ekf_module_->measurement_update_twist(twist, current_time, twist_diag_info_);
       if (is_updated) {
         twist_is_updated = true;
       }
-    }
+    });
     DEBUG_INFO(
       get_logger(), "[EKF] measurement_update_twist calc time = %f [ms]", stop_watch_.toc());
     DEBUG_INFO(get_logger(), "------------------------- end Twist -------------------------\n");
   }
   twist_diag_info_.no_update_count = twist_is_updated ? 0 : (twist_diag_info_.no_update_count + 1);
 
+  /* stacked update of the pose and twist measurements of the cycle */
+  if (pose_is_updated || twist_is_updated) {
+    stop_watch_.tic();
+    ekf_module_->apply_measurement_update();
+    DEBUG_INFO(
+      get_logger(), "[EKF] apply_measurement_update calc time = %f [ms]", stop_watch_.toc());
+  }
+
   const geometry_msgs::msg::PoseStamped current_ekf_pose =
     ekf_module_->get_current_pose(current_time, false);
   const geometry_msgs::msg::PoseStamped current_biased_ekf_pose =
@@ -244,6 +325,31 @@ void EKFLocalizer::timer_callback()
       .data(elapsed_time));
 }
 
+/*
+ * timer_extrapolation_callback
+ */
+void EKFLocalizer::timer_extrapolation_callback()
+{
+  std::optional<nav_msgs::msg::Odometry> odometry;
+  {
+    std::lock_guard<std::mutex> lock(latest_odometry_mutex_);
+    odometry = latest_odometry_;
+  }
+  if (!odometry) {
+    return;
+  }
+
+  const rclcpp::Time current_time = this->now();
+  const double dt = (current_time - rclcpp::Time(odometry->header.stamp)).seconds();
+  if (dt < 0.0 || dt > max_extrapolation_time) {
+    return;
+  }
+
+  nav_msgs::msg::Odometry extrapolated_odometry = extrapolate_odometry(*odometry, dt);
+  extrapolated_odometry.header.stamp = current_time;
+  pub_extrapolated_odom_->publish(extrapolated_odometry);
+}
+
 /*
  * get_transform_from_tf
  */
@@ -280,6 +386,25 @@ void EKFLocalizer::callback_initial_pose(
   is_set_initialpose_ = true;
 }
 
+/*
+ * take_measurements_from_rings
+ */
+void EKFLocalizer::take_measurements_from_rings()
+{
+  if (pose_ring_) {
+    PoseMeasurement pose;
+    while (pose_ring_->pop(pose)) {
+      pose_queue_.push(pose);
+    }
+  }
+  if (twist_ring_) {
+    TwistMeasurement twist;
+    while (twist_ring_->pop(twist)) {
+      twist_queue_.push(twist);
+    }
+  }
+}
+
 /*
  * callback_pose_with_covariance
  */
@@ -290,7 +415,13 @@ void EKFLocalizer::callback_pose_with_covariance(
     return;
   }
 
-  pose_queue_.push(msg);
+  if (auto pose = ekf_module_->preprocess_pose(msg)) {
+    if (!pose_ring_) {
+      pose_queue_.push(*pose);
+    } else if (!pose_ring_->push(std::move(*pose))) {
+      warning_->warn_throttle("[EKF] pose measurement is dropped, too many are waiting", 2000);
+    }
+  }
 
   publish_callback_return_diagnostics("pose", msg->header.stamp);
 }
@@ -306,7 +437,14 @@ void EKFLocalizer::callback_twist_with_covariance(
   if (std::abs(msg->twist.twist.linear.x) < params_.threshold_observable_velocity_mps) {
     msg->twist.covariance[0 * 6 + 0] = 10000.0;
   }
-  twist_queue_.push(msg);
+
+  if (auto twist = ekf_module_->preprocess_twist(msg)) {
+    if (!twist_ring_) {
+      twist_queue_.push(*twist);
+    } else if (!twist_ring_->push(std::move(*twist))) {
+      warning_->warn_throttle("[EKF] twist measurement is dropped, too many are waiting", 2000);
+    }
+  }
 
   publish_callback_return_diagnostics("twist", msg->header.stamp);
 }
@@ -360,6 +498,10 @@ void EKFLocalizer::publish_estimate_result(
   odometry.pose = pose_cov.pose;
   odometry.twist = twist_cov.twist;
   pub_odom_->publish(odometry);
+  if (timer_extrapolation_) {
+    std::lock_guard<std::mutex> lock(latest_odometry_mutex_);
+    latest_odometry_ = odometry;
+  }
 
   /* publish tf */
   const geometry_msgs::msg::TransformStamped transform_stamped =
@@ -449,12 +591,15 @@ void EKFLocalizer::service_trigger_node(
   std_srvs::srv::SetBool::Response::SharedPtr res)
 {
   if (req->data) {
+    take_measurements_from_rings();
     pose_queue_.clear();
     twist_queue_.clear();
     is_activated_ = true;
   } else {
     is_activated_ = false;
     is_set_initialpose_ = false;
+    std::lock_guard<std::mutex> lock(latest_odometry_mutex_);
+    latest_odometry_.reset();
   }
   res->success = true;
 }
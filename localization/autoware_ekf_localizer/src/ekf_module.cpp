@@ -30,6 +30,7 @@
 #include <fmt/core.h>
 
 #include <algorithm>
+#include <optional>
 #include <utility>
 
 namespace autoware::ekf_localizer
@@ -46,9 +47,9 @@ EKFModule::EKFModule(std::shared_ptr<Warning> warning, const HyperParameters & p
   params_(params),
   last_angular_velocity_(0.0, 0.0, 0.0)
 {
-  Eigen::MatrixXd x = Eigen::MatrixXd::Zero(dim_x_, 1);
-  Eigen::MatrixXd p = Eigen::MatrixXd::Identity(dim_x_, dim_x_) * 1.0E15;  // for x & y
-  p(IDX::YAW, IDX::YAW) = 50.0;                                            // for yaw
+  Vector6d x = Vector6d::Zero();
+  Matrix6d p = Matrix6d::Identity() * 1.0E15;  // for x & y
+  p(IDX::YAW, IDX::YAW) = 50.0;                // for yaw
   if (params_.enable_yaw_bias_estimation) {
     p(IDX::YAWB, IDX::YAWB) = 50.0;  // for yaw bias
   }
@@ -64,8 +65,8 @@ EKFModule::EKFModule(std::shared_ptr<Warning> warning, const HyperParameters & p
 void EKFModule::initialize(
   const PoseWithCovariance & initial_pose, const geometry_msgs::msg::TransformStamped & transform)
 {
-  Eigen::MatrixXd x(dim_x_, 1);
-  Eigen::MatrixXd p = Eigen::MatrixXd::Zero(dim_x_, dim_x_);
+  Vector6d x;
+  Matrix6d p = Matrix6d::Zero();
 
   x(IDX::X) = initial_pose.pose.pose.position.x + transform.transform.translation.x;
   x(IDX::Y) = initial_pose.pose.pose.position.y + transform.transform.translation.y;
@@ -214,8 +215,7 @@ void EKFModule::accumulate_delay_time(const double dt)
 
 void EKFModule::predict_with_delay(const double dt)
 {
-  const Eigen::MatrixXd x_curr = kalman_filter_.getLatestX();
-  const Eigen::MatrixXd p_curr = kalman_filter_.getLatestP();
+  const Vector6d x_curr = kalman_filter_.getLatestX();
 
   const double proc_cov_vx_d = std::pow(params_.proc_stddev_vx_c * dt, 2.0);
   const double proc_cov_wz_d = std::pow(params_.proc_stddev_wz_c * dt, 2.0);
@@ -228,23 +228,65 @@ void EKFModule::predict_with_delay(const double dt)
   ekf_dt_ = dt;
 }
 
-bool EKFModule::measurement_update_pose(
-  const PoseWithCovariance & pose, const rclcpp::Time & t_curr, EKFDiagnosticInfo & pose_diag_info)
+std::optional<PoseMeasurement> EKFModule::preprocess_pose(
+  const PoseWithCovariance::ConstSharedPtr & pose) const
 {
-  if (pose.header.frame_id != params_.pose_frame_id) {
+  if (pose->header.frame_id != params_.pose_frame_id) {
     warning_->warn_throttle(
       fmt::format(
         "pose frame_id is %s, but pose_frame is set as %s. They must be same.",
-        pose.header.frame_id.c_str(), params_.pose_frame_id.c_str()),
+        pose->header.frame_id.c_str(), params_.pose_frame_id.c_str()),
       2000);
   }
-  const Eigen::MatrixXd x_curr = kalman_filter_.getLatestX();
+
+  PoseMeasurement measurement;
+  measurement.pose = pose;
+  measurement.y << pose->pose.pose.position.x, pose->pose.pose.position.y,
+    tf2::getYaw(pose->pose.pose.orientation);
+
+  if (has_nan(measurement.y) || has_inf(measurement.y)) {
+    warning_->warn(
+      "[EKF] pose measurement matrix includes NaN of Inf. ignore update. check pose message.");
+    return std::nullopt;
+  }
+
+  measurement.r = pose_measurement_covariance(pose->pose.covariance, params_.pose_smoothing_steps);
+  return measurement;
+}
+
+std::optional<TwistMeasurement> EKFModule::preprocess_twist(
+  const TwistWithCovariance::ConstSharedPtr & twist) const
+{
+  if (twist->header.frame_id != "base_link") {
+    warning_->warn_throttle("twist frame_id must be base_link", 2000);
+  }
+
+  TwistMeasurement measurement;
+  measurement.twist = twist;
+  measurement.y << twist->twist.twist.linear.x, twist->twist.twist.angular.z;
+
+  if (has_nan(measurement.y) || has_inf(measurement.y)) {
+    warning_->warn(
+      "[EKF] twist measurement matrix includes NaN of Inf. ignore update. check twist message.");
+    return std::nullopt;
+  }
+
+  measurement.r =
+    twist_measurement_covariance(twist->twist.covariance, params_.twist_smoothing_steps);
+  return measurement;
+}
+
+bool EKFModule::measurement_update_pose(
+  const PoseMeasurement & pose, const rclcpp::Time & t_curr, EKFDiagnosticInfo & pose_diag_info)
+{
+  const Vector6d x_curr = kalman_filter_.getLatestX();
   DEBUG_PRINT_MAT(x_curr.transpose());
 
   constexpr int dim_y = 3;  // pos_x, pos_y, yaw, depending on Pose output
 
   /* Calculate delay step */
-  double delay_time = (t_curr - pose.header.stamp).seconds() + params_.pose_additional_delay;
+  double delay_time =
+    (t_curr - pose.pose->header.stamp).seconds() + params_.pose_additional_delay;
   if (delay_time < 0.0) {
     warning_->warn_throttle(pose_delay_time_warning_message(delay_time), 1000);
   }
@@ -267,27 +309,20 @@ bool EKFModule::measurement_update_pose(
   /* Since the kalman filter cannot handle the rotation angle directly,
     offset the yaw angle so that the difference from the yaw angle that ekf holds internally
     is less than 2 pi. */
-  double yaw = tf2::getYaw(pose.pose.pose.orientation);
   const double ekf_yaw = kalman_filter_.getXelement(delay_step * dim_x_ + IDX::YAW);
-  const double yaw_error = normalize_yaw(yaw - ekf_yaw);  // normalize the error not to exceed 2 pi
-  yaw = yaw_error + ekf_yaw;
+  // normalize the error not to exceed 2 pi
+  const double yaw_error = normalize_yaw(pose.y(2) - ekf_yaw);
 
   /* Set measurement matrix */
-  Eigen::MatrixXd y(dim_y, 1);
-  y << pose.pose.pose.position.x, pose.pose.pose.position.y, yaw;
-
-  if (has_nan(y) || has_inf(y)) {
-    warning_->warn(
-      "[EKF] pose measurement matrix includes NaN of Inf. ignore update. check pose message.");
-    return false;
-  }
+  Eigen::Vector3d y = pose.y;
+  y(2) = yaw_error + ekf_yaw;
 
   /* Gate */
   const Eigen::Vector3d y_ekf(
     kalman_filter_.getXelement(delay_step * dim_x_ + IDX::X),
     kalman_filter_.getXelement(delay_step * dim_x_ + IDX::Y), ekf_yaw);
-  const Eigen::MatrixXd p_curr = kalman_filter_.getLatestP();
-  const Eigen::MatrixXd p_y = p_curr.block(0, 0, dim_y, dim_y);
+  const Matrix6d p_curr = kalman_filter_.getLatestP();
+  const Eigen::Matrix3d p_y = p_curr.block<dim_y, dim_y>(0, 0);
 
   const double distance = mahalanobis(y_ekf, y, p_y);
   pose_diag_info.mahalanobis_distance = std::max(distance, pose_diag_info.mahalanobis_distance);
@@ -303,22 +338,17 @@ bool EKFModule::measurement_update_pose(
   DEBUG_PRINT_MAT((y - y_ekf).transpose());
 
   const Eigen::Matrix<double, 3, 6> c = pose_measurement_matrix();
-  const Eigen::Matrix3d r =
-    pose_measurement_covariance(pose.pose.covariance, params_.pose_smoothing_steps);
 
-  kalman_filter_.updateWithDelay(y, c, r, static_cast<int>(delay_step));
+  if (!kalman_filter_.addBatchMeasurement(y, c, pose.r, static_cast<int>(delay_step))) {
+    return false;
+  }
 
   // Update Simple 1D filter with considering change of roll, pitch and height (position z)
   // values due to measurement pose delay
   auto pose_with_rph_delay_compensation =
-    compensate_rph_with_delay(pose, last_angular_velocity_, delay_time);
+    compensate_rph_with_delay(*pose.pose, last_angular_velocity_, delay_time);
   update_simple_1d_filters(pose_with_rph_delay_compensation, params_.pose_smoothing_steps);
 
-  // debug
-  const Eigen::MatrixXd x_result = kalman_filter_.getLatestX();
-  DEBUG_PRINT_MAT(x_result.transpose());
-  DEBUG_PRINT_MAT((x_result - x_curr).transpose());
-
   return true;
 }
 
@@ -358,22 +388,19 @@ geometry_msgs::msg::PoseWithCovarianceStamped EKFModule::compensate_rph_with_del
 }
 
 bool EKFModule::measurement_update_twist(
-  const TwistWithCovariance & twist, const rclcpp::Time & t_curr,
+  const TwistMeasurement & twist, const rclcpp::Time & t_curr,
   EKFDiagnosticInfo & twist_diag_info)
 {
-  if (twist.header.frame_id != "base_link") {
-    warning_->warn_throttle("twist frame_id must be base_link", 2000);
-  }
-
   last_angular_velocity_ = tf2::Vector3(0.0, 0.0, 0.0);
 
-  const Eigen::MatrixXd x_curr = kalman_filter_.getLatestX();
+  const Vector6d x_curr = kalman_filter_.getLatestX();
   DEBUG_PRINT_MAT(x_curr.transpose());
 
   constexpr int dim_y = 2;  // vx, wz
 
   /* Calculate delay step */
-  double delay_time = (t_curr - twist.header.stamp).seconds() + params_.twist_additional_delay;
+  double delay_time =
+    (t_curr - twist.twist->header.stamp).seconds() + params_.twist_additional_delay;
   if (delay_time < 0.0) {
     warning_->warn_throttle(twist_delay_time_warning_message(delay_time), 1000);
   }
@@ -393,20 +420,13 @@ bool EKFModule::measurement_update_twist(
   }
 
   /* Set measurement matrix */
-  Eigen::MatrixXd y(dim_y, 1);
-  y << twist.twist.twist.linear.x, twist.twist.twist.angular.z;
-
-  if (has_nan(y) || has_inf(y)) {
-    warning_->warn(
-      "[EKF] twist measurement matrix includes NaN of Inf. ignore update. check twist message.");
-    return false;
-  }
+  const Eigen::Vector2d & y = twist.y;
 
   const Eigen::Vector2d y_ekf(
     kalman_filter_.getXelement(delay_step * dim_x_ + IDX::VX),
     kalman_filter_.getXelement(delay_step * dim_x_ + IDX::WZ));
-  const Eigen::MatrixXd p_curr = kalman_filter_.getLatestP();
-  const Eigen::MatrixXd p_y = p_curr.block(4, 4, dim_y, dim_y);
+  const Matrix6d p_curr = kalman_filter_.getLatestP();
+  const Eigen::Matrix2d p_y = p_curr.block<dim_y, dim_y>(4, 4);
 
   const double distance = mahalanobis(y_ekf, y, p_y);
   twist_diag_info.mahalanobis_distance = std::max(distance, twist_diag_info.mahalanobis_distance);
@@ -422,19 +442,30 @@ bool EKFModule::measurement_update_twist(
   DEBUG_PRINT_MAT((y - y_ekf).transpose());
 
   const Eigen::Matrix<double, 2, 6> c = twist_measurement_matrix();
-  const Eigen::Matrix2d r =
-    twist_measurement_covariance(twist.twist.covariance, params_.twist_smoothing_steps);
 
-  kalman_filter_.updateWithDelay(y, c, r, static_cast<int>(delay_step));
+  if (!kalman_filter_.addBatchMeasurement(y, c, twist.r, static_cast<int>(delay_step))) {
+    return false;
+  }
 
   last_angular_velocity_ = tf2::Vector3(
-    twist.twist.twist.angular.x, twist.twist.twist.angular.y, twist.twist.twist.angular.z);
+    twist.twist->twist.twist.angular.x, twist.twist->twist.twist.angular.y,
+    twist.twist->twist.twist.angular.z);
+
+  return true;
+}
+
+bool EKFModule::apply_measurement_update()
+{
+  const Vector6d x_curr = kalman_filter_.getLatestX();
+  if (!kalman_filter_.applyBatchUpdate()) {
+    warning_->warn("[EKF] kalman gain includes NaN or Inf. ignore the measurements of the cycle.");
+    return false;
+  }
 
   // debug
-  const Eigen::MatrixXd x_result = kalman_filter_.getLatestX();
+  const Vector6d x_result = kalman_filter_.getLatestX();
   DEBUG_PRINT_MAT(x_result.transpose());
   DEBUG_PRINT_MAT((x_result - x_curr).transpose());
-
   return true;
 }
 
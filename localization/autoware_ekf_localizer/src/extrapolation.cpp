@@ -0,0 +1,44 @@
+// Copyright 2025 Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/ekf_localizer/extrapolation.hpp"
+
+#include <autoware_utils_geometry/geometry.hpp>
+
+#include <cmath>
+
+namespace autoware::ekf_localizer
+{
+
+nav_msgs::msg::Odometry extrapolate_odometry(
+  const nav_msgs::msg::Odometry & odometry, const double dt)
+{
+  const double vx = odometry.twist.twist.linear.x;
+  const double wz = odometry.twist.twist.angular.z;
+  const auto rpy = autoware_utils_geometry::get_rpy(odometry.pose.pose.orientation);
+  const double yaw = rpy.z;
+  const double delta_yaw = wz * dt;
+
+  nav_msgs::msg::Odometry extrapolated = odometry;
+  // heading at the middle of dt, close to the arc of a constant yaw velocity
+  extrapolated.pose.pose.position.x += vx * std::cos(yaw + 0.5 * delta_yaw) * dt;
+  extrapolated.pose.pose.position.y += vx * std::sin(yaw + 0.5 * delta_yaw) * dt;
+
+  extrapolated.pose.pose.orientation =
+    autoware_utils_geometry::create_quaternion_from_rpy(rpy.x, rpy.y, yaw + delta_yaw);
+
+  return extrapolated;
+}
+
+}  // namespace autoware::ekf_localizer
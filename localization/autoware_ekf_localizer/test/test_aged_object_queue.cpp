@@ -105,4 +105,42 @@ TEST(AgedObjectQueue, Back)
   EXPECT_EQ(queue.back(), std::string{"b"});
 }
 
+TEST(AgedObjectQueue, ForEachIncrementAge)
+{
+  AgedObjectQueue<std::string> queue(2);
+  std::string visited;
+  const auto visit = [&visited](const std::string & object) { visited += object; };
+
+  queue.push("a");
+  queue.for_each_increment_age(visit);  // age of a = 1
+  queue.push("b");
+  EXPECT_EQ(queue.size(), 2U);
+
+  queue.for_each_increment_age(visit);  // age of a = 2, age of b = 1
+  EXPECT_EQ(queue.size(), 1U);
+  EXPECT_EQ(queue.back(), std::string{"b"});
+
+  queue.push("c");
+  queue.for_each_increment_age(visit);  // age of b = 2, age of c = 1
+  EXPECT_EQ(queue.size(), 1U);
+  EXPECT_EQ(queue.back(), std::string{"c"});
+
+  EXPECT_EQ(visited, std::string{"aabbc"});
+}
+
+TEST(AgedObjectQueue, AnyOf)
+{
+  AgedObjectQueue<int> queue(3);
+  const auto is_negative = [](const int object) { return object < 0; };
+  EXPECT_FALSE(queue.any_of(is_negative));
+
+  queue.push(1);
+  queue.push(2);
+  EXPECT_FALSE(queue.any_of(is_negative));
+
+  queue.push(-1);
+  EXPECT_TRUE(queue.any_of(is_negative));
+  EXPECT_EQ(queue.size(), 3U);
+}
+
 }  // namespace autoware::ekf_localizer
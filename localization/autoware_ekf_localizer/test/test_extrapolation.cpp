@@ -0,0 +1,75 @@
+// Copyright 2025 Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/ekf_localizer/extrapolation.hpp"
+
+#include <autoware_utils_geometry/geometry.hpp>
+#include <tf2/utils.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+namespace autoware::ekf_localizer
+{
+
+nav_msgs::msg::Odometry make_odometry(
+  const double yaw, const double pitch, const double vx, const double wz)
+{
+  nav_msgs::msg::Odometry odometry;
+  odometry.pose.pose.position = autoware_utils_geometry::create_point(1.0, 2.0, 3.0);
+  odometry.pose.pose.orientation =
+    autoware_utils_geometry::create_quaternion_from_rpy(0.0, pitch, yaw);
+  odometry.twist.twist.linear.x = vx;
+  odometry.twist.twist.angular.z = wz;
+  return odometry;
+}
+
+TEST(ExtrapolateOdometry, Straight)
+{
+  const auto odometry = make_odometry(M_PI / 2.0, 0.0, 10.0, 0.0);
+  const auto extrapolated = extrapolate_odometry(odometry, 0.1);
+  EXPECT_NEAR(extrapolated.pose.pose.position.x, 1.0, 1e-9);
+  EXPECT_NEAR(extrapolated.pose.pose.position.y, 3.0, 1e-9);
+  EXPECT_DOUBLE_EQ(extrapolated.pose.pose.position.z, 3.0);
+  EXPECT_NEAR(tf2::getYaw(extrapolated.pose.pose.orientation), M_PI / 2.0, 1e-9);
+  EXPECT_EQ(extrapolated.twist, odometry.twist);
+}
+
+TEST(ExtrapolateOdometry, Turn)
+{
+  // a quarter of a circle of radius 1: vx = 1, wz = 1 during pi / 2
+  constexpr double dt = 0.01;
+  auto odometry = make_odometry(0.0, 0.1, 1.0, 1.0);
+  for (int i = 0; i < static_cast<int>(std::round(M_PI / 2.0 / dt)); ++i) {
+    odometry = extrapolate_odometry(odometry, dt);
+  }
+  EXPECT_NEAR(odometry.pose.pose.position.x, 2.0, 2e-3);
+  EXPECT_NEAR(odometry.pose.pose.position.y, 3.0, 2e-3);
+  const auto rpy = autoware_utils_geometry::get_rpy(odometry.pose.pose.orientation);
+  EXPECT_NEAR(rpy.x, 0.0, 1e-9);
+  EXPECT_NEAR(rpy.y, 0.1, 1e-9);
+  EXPECT_NEAR(rpy.z, M_PI / 2.0, 1e-2);
+}
+
+TEST(ExtrapolateOdometry, ZeroTime)
+{
+  const auto odometry = make_odometry(0.3, 0.0, 5.0, 0.5);
+  const auto extrapolated = extrapolate_odometry(odometry, 0.0);
+  EXPECT_DOUBLE_EQ(extrapolated.pose.pose.position.x, odometry.pose.pose.position.x);
+  EXPECT_DOUBLE_EQ(extrapolated.pose.pose.position.y, odometry.pose.pose.position.y);
+  EXPECT_NEAR(tf2::getYaw(extrapolated.pose.pose.orientation), 0.3, 1e-9);
+}
+
+}  // namespace autoware::ekf_localizer
@@ -0,0 +1,72 @@
+// Copyright 2025 Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/ekf_localizer/measurement_ring.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+
+namespace autoware::ekf_localizer
+{
+
+TEST(MeasurementRing, FirstInFirstOut)
+{
+  MeasurementRing<std::string> ring(2);
+
+  std::string object;
+  EXPECT_FALSE(ring.pop(object));
+
+  EXPECT_TRUE(ring.push("a"));
+  EXPECT_TRUE(ring.push("b"));
+  EXPECT_FALSE(ring.push("c"));  // full
+
+  EXPECT_TRUE(ring.pop(object));
+  EXPECT_EQ(object, std::string{"a"});
+  EXPECT_TRUE(ring.push("d"));
+
+  EXPECT_TRUE(ring.pop(object));
+  EXPECT_EQ(object, std::string{"b"});
+  EXPECT_TRUE(ring.pop(object));
+  EXPECT_EQ(object, std::string{"d"});
+  EXPECT_FALSE(ring.pop(object));
+}
+
+TEST(MeasurementRing, ProducerAndConsumerThreads)
+{
+  constexpr int object_num = 10000;
+  MeasurementRing<int> ring(16);
+
+  std::thread producer([&ring]() {
+    for (int i = 0; i < object_num; ++i) {
+      while (!ring.push(i)) {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  int expected = 0;
+  int object = -1;
+  while (expected < object_num) {
+    if (ring.pop(object)) {
+      EXPECT_EQ(object, expected);
+      ++expected;
+    }
+  }
+  producer.join();
+  EXPECT_FALSE(ring.pop(object));
+}
+
+}  // namespace autoware::ekf_localizer
@@ -47,6 +47,7 @@ GyroOdometerNode::GyroOdometerNode(const rclcpp::NodeOptions & node_options)
 : Node("gyro_odometer", node_options),
   output_frame_(declare_parameter<std::string>("output_frame")),
   message_timeout_sec_(declare_parameter<double>("message_timeout_sec")),
+  min_output_interval_sec_(declare_parameter<double>("min_output_interval_sec")),
   vehicle_twist_arrived_(false),
   imu_arrived_(false)
 {
@@ -85,7 +86,10 @@ void GyroOdometerNode::callback_vehicle_twist(
 
   vehicle_twist_arrived_ = true;
   latest_vehicle_twist_ros_time_ = vehicle_twist_msg_ptr->header.stamp;
-  vehicle_twist_queue_.push_back(*vehicle_twist_msg_ptr);
+  ++vehicle_twist_sum_.count;
+  vehicle_twist_sum_.vx += vehicle_twist_msg_ptr->twist.twist.linear.x;
+  vehicle_twist_sum_.vx_covariance += vehicle_twist_msg_ptr->twist.covariance[0 * 6 + 0];
+  vehicle_twist_sum_.latest_stamp = vehicle_twist_msg_ptr->header.stamp;
   concat_gyro_and_odometer();
 
   diagnostics_->publish(vehicle_twist_msg_ptr->header.stamp);
@@ -99,7 +103,16 @@ void GyroOdometerNode::callback_imu(const sensor_msgs::msg::Imu::ConstSharedPtr
 
   imu_arrived_ = true;
   latest_imu_ros_time_ = imu_msg_ptr->header.stamp;
-  gyro_queue_.push_back(*imu_msg_ptr);
+  if (gyro_sum_.count == 0) {
+    gyro_sum_.frame_id = imu_msg_ptr->header.frame_id;
+  }
+  ++gyro_sum_.count;
+  gyro_sum_.angular_velocity.x += imu_msg_ptr->angular_velocity.x;
+  gyro_sum_.angular_velocity.y += imu_msg_ptr->angular_velocity.y;
+  gyro_sum_.angular_velocity.z += imu_msg_ptr->angular_velocity.z;
+  gyro_sum_.angular_velocity_covariance +=
+    transform_covariance(imu_msg_ptr->angular_velocity_covariance)[COV_IDX::X_X];
+  gyro_sum_.latest_stamp = imu_msg_ptr->header.stamp;
   concat_gyro_and_odometer();
 
   diagnostics_->publish(imu_msg_ptr->header.stamp);
@@ -117,8 +130,7 @@ void GyroOdometerNode::concat_gyro_and_odometer()
     diagnostics_->update_level_and_message(
       diagnostic_msgs::msg::DiagnosticStatus::WARN, message.str());
 
-    vehicle_twist_queue_.clear();
-    gyro_queue_.clear();
+    clear_sums();
     return;
   }
   if (!imu_arrived_) {
@@ -128,8 +140,7 @@ void GyroOdometerNode::concat_gyro_and_odometer()
     diagnostics_->update_level_and_message(
       diagnostic_msgs::msg::DiagnosticStatus::WARN, message.str());
 
-    vehicle_twist_queue_.clear();
-    gyro_queue_.clear();
+    clear_sums();
     return;
   }
 
@@ -146,8 +157,7 @@ void GyroOdometerNode::concat_gyro_and_odometer()
     RCLCPP_ERROR_STREAM_THROTTLE(this->get_logger(), *this->get_clock(), 1000, message);
     diagnostics_->update_level_and_message(diagnostic_msgs::msg::DiagnosticStatus::ERROR, message);
 
-    vehicle_twist_queue_.clear();
-    gyro_queue_.clear();
+    clear_sums();
     return;
   }
   if (imu_dt > message_timeout_sec_) {
@@ -156,117 +166,100 @@ void GyroOdometerNode::concat_gyro_and_odometer()
     RCLCPP_ERROR_STREAM_THROTTLE(this->get_logger(), *this->get_clock(), 1000, message);
     diagnostics_->update_level_and_message(diagnostic_msgs::msg::DiagnosticStatus::ERROR, message);
 
-    vehicle_twist_queue_.clear();
-    gyro_queue_.clear();
+    clear_sums();
     return;
   }
 
   // check queue size
-  diagnostics_->add_key_value("vehicle_twist_queue_size", vehicle_twist_queue_.size());
-  diagnostics_->add_key_value("imu_queue_size", gyro_queue_.size());
-  if (vehicle_twist_queue_.empty()) {
+  diagnostics_->add_key_value("vehicle_twist_queue_size", vehicle_twist_sum_.count);
+  diagnostics_->add_key_value("imu_queue_size", gyro_sum_.count);
+  if (vehicle_twist_sum_.count == 0) {
     // not output error and clear queue
     return;
   }
-  if (gyro_queue_.empty()) {
+  if (gyro_sum_.count == 0) {
     // not output error and clear queue
     return;
   }
 
+  // decimate the output, the messages until the next output are accumulated in it
+  const rclcpp::Time output_stamp = vehicle_twist_sum_.latest_stamp < gyro_sum_.latest_stamp
+                                      ? gyro_sum_.latest_stamp
+                                      : vehicle_twist_sum_.latest_stamp;
+  if (
+    min_output_interval_sec_ > 0.0 && latest_output_stamp_ &&
+    output_stamp >= *latest_output_stamp_ &&
+    (output_stamp - *latest_output_stamp_).seconds() < min_output_interval_sec_) {
+    return;
+  }
+
   // get transformation
   geometry_msgs::msg::TransformStamped::ConstSharedPtr tf_imu2base_ptr =
-    transform_listener_->get_latest_transform(gyro_queue_.front().header.frame_id, output_frame_);
+    transform_listener_->get_latest_transform(gyro_sum_.frame_id, output_frame_);
 
   const bool is_succeed_transform_imu = (tf_imu2base_ptr != nullptr);
   diagnostics_->add_key_value("is_succeed_transform_imu", is_succeed_transform_imu);
   if (!is_succeed_transform_imu) {
     std::stringstream message;
-    message << "Please publish TF " << output_frame_ << " to "
-            << gyro_queue_.front().header.frame_id;
+    message << "Please publish TF " << output_frame_ << " to " << gyro_sum_.frame_id;
     RCLCPP_ERROR_STREAM_THROTTLE(this->get_logger(), *this->get_clock(), 1000, message.str());
     diagnostics_->update_level_and_message(
       diagnostic_msgs::msg::DiagnosticStatus::ERROR, message.str());
 
-    vehicle_twist_queue_.clear();
-    gyro_queue_.clear();
+    clear_sums();
     return;
   }
 
-  // transform gyro frame
-  for (auto & gyro : gyro_queue_) {
-    geometry_msgs::msg::Vector3Stamped angular_velocity;
-    angular_velocity.header = gyro.header;
-    angular_velocity.vector = gyro.angular_velocity;
-
-    geometry_msgs::msg::Vector3Stamped transformed_angular_velocity;
-    transformed_angular_velocity.header = tf_imu2base_ptr->header;
-    tf2::doTransform(angular_velocity, transformed_angular_velocity, *tf_imu2base_ptr);
-
-    gyro.header.frame_id = output_frame_;
-    gyro.angular_velocity = transformed_angular_velocity.vector;
-    gyro.angular_velocity_covariance = transform_covariance(gyro.angular_velocity_covariance);
-  }
-
-  using COV_IDX_XYZ = autoware_utils_geometry::xyz_covariance_index::XYZ_COV_IDX;
   using COV_IDX_XYZRPY = autoware_utils_geometry::xyzrpy_covariance_index::XYZRPY_COV_IDX;
 
   // calc mean, covariance
-  double vx_mean = 0;
-  geometry_msgs::msg::Vector3 gyro_mean{};
-  double vx_covariance_original = 0;
-  geometry_msgs::msg::Vector3 gyro_covariance_original{};
-  for (const auto & vehicle_twist : vehicle_twist_queue_) {
-    vx_mean += vehicle_twist.twist.twist.linear.x;
-    vx_covariance_original += vehicle_twist.twist.covariance[0 * 6 + 0];
-  }
-  vx_mean /= static_cast<double>(vehicle_twist_queue_.size());
-  vx_covariance_original /= static_cast<double>(vehicle_twist_queue_.size());
-
-  for (const auto & gyro : gyro_queue_) {
-    gyro_mean.x += gyro.angular_velocity.x;
-    gyro_mean.y += gyro.angular_velocity.y;
-    gyro_mean.z += gyro.angular_velocity.z;
-    gyro_covariance_original.x += gyro.angular_velocity_covariance[COV_IDX_XYZ::X_X];
-    gyro_covariance_original.y += gyro.angular_velocity_covariance[COV_IDX_XYZ::Y_Y];
-    gyro_covariance_original.z += gyro.angular_velocity_covariance[COV_IDX_XYZ::Z_Z];
-  }
-  gyro_mean.x /= static_cast<double>(gyro_queue_.size());
-  gyro_mean.y /= static_cast<double>(gyro_queue_.size());
-  gyro_mean.z /= static_cast<double>(gyro_queue_.size());
-  gyro_covariance_original.x /= static_cast<double>(gyro_queue_.size());
-  gyro_covariance_original.y /= static_cast<double>(gyro_queue_.size());
-  gyro_covariance_original.z /= static_cast<double>(gyro_queue_.size());
+  const auto vehicle_twist_count = static_cast<double>(vehicle_twist_sum_.count);
+  const auto gyro_count = static_cast<double>(gyro_sum_.count);
+  const double vx_mean = vehicle_twist_sum_.vx / vehicle_twist_count;
+  const double vx_covariance_original = vehicle_twist_sum_.vx_covariance / vehicle_twist_count;
+  const double gyro_covariance_original = gyro_sum_.angular_velocity_covariance / gyro_count;
+
+  // transform gyro frame, the rotation of the mean is the mean of the rotations
+  geometry_msgs::msg::Vector3Stamped gyro_mean;
+  gyro_mean.header.frame_id = gyro_sum_.frame_id;
+  gyro_mean.header.stamp = gyro_sum_.latest_stamp;
+  gyro_mean.vector.x = gyro_sum_.angular_velocity.x / gyro_count;
+  gyro_mean.vector.y = gyro_sum_.angular_velocity.y / gyro_count;
+  gyro_mean.vector.z = gyro_sum_.angular_velocity.z / gyro_count;
+
+  geometry_msgs::msg::Vector3Stamped transformed_gyro_mean;
+  transformed_gyro_mean.header = tf_imu2base_ptr->header;
+  tf2::doTransform(gyro_mean, transformed_gyro_mean, *tf_imu2base_ptr);
 
   // concat
   geometry_msgs::msg::TwistWithCovarianceStamped twist_with_cov;
-  const auto latest_vehicle_twist_stamp = rclcpp::Time(vehicle_twist_queue_.back().header.stamp);
-  const auto latest_imu_stamp = rclcpp::Time(gyro_queue_.back().header.stamp);
-  if (latest_vehicle_twist_stamp < latest_imu_stamp) {
-    twist_with_cov.header.stamp = latest_imu_stamp;
-  } else {
-    twist_with_cov.header.stamp = latest_vehicle_twist_stamp;
-  }
-  twist_with_cov.header.frame_id = gyro_queue_.front().header.frame_id;
+  twist_with_cov.header.stamp = output_stamp;
+  twist_with_cov.header.frame_id = output_frame_;
   twist_with_cov.twist.twist.linear.x = vx_mean;
-  twist_with_cov.twist.twist.angular = gyro_mean;
+  twist_with_cov.twist.twist.angular = transformed_gyro_mean.vector;
 
   // From a statistical point of view, here we reduce the covariances according to the number of
   // observed data
   twist_with_cov.twist.covariance[COV_IDX_XYZRPY::X_X] =
-    vx_covariance_original / static_cast<double>(vehicle_twist_queue_.size());
+    vx_covariance_original / vehicle_twist_count;
   twist_with_cov.twist.covariance[COV_IDX_XYZRPY::Y_Y] = 100000.0;
   twist_with_cov.twist.covariance[COV_IDX_XYZRPY::Z_Z] = 100000.0;
   twist_with_cov.twist.covariance[COV_IDX_XYZRPY::ROLL_ROLL] =
-    gyro_covariance_original.x / static_cast<double>(gyro_queue_.size());
+    gyro_covariance_original / gyro_count;
   twist_with_cov.twist.covariance[COV_IDX_XYZRPY::PITCH_PITCH] =
-    gyro_covariance_original.y / static_cast<double>(gyro_queue_.size());
-  twist_with_cov.twist.covariance[COV_IDX_XYZRPY::YAW_YAW] =
-    gyro_covariance_original.z / static_cast<double>(gyro_queue_.size());
+    gyro_covariance_original / gyro_count;
+  twist_with_cov.twist.covariance[COV_IDX_XYZRPY::YAW_YAW] = gyro_covariance_original / gyro_count;
 
   publish_data(twist_with_cov);
+  latest_output_stamp_ = output_stamp;
 
-  vehicle_twist_queue_.clear();
-  gyro_queue_.clear();
+  clear_sums();
+}
+
+void GyroOdometerNode::clear_sums()
+{
+  vehicle_twist_sum_ = VehicleTwistSum{};
+  gyro_sum_ = GyroSum{};
 }
 
 void GyroOdometerNode::publish_data(
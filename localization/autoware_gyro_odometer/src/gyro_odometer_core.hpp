@@ -27,8 +27,9 @@
 #include <sensor_msgs/msg/imu.hpp>
 #include <tf2_geometry_msgs/tf2_geometry_msgs.hpp>
 
-#include <deque>
+#include <cstddef>
 #include <memory>
+#include <optional>
 #include <string>
 
 namespace autoware::gyro_odometer
@@ -39,6 +40,25 @@ class GyroOdometerNode : public rclcpp::Node
 private:
   using COV_IDX = autoware_utils_geometry::xyz_covariance_index::XYZ_COV_IDX;
 
+  // running sums of the messages received since the last output, instead of the messages
+  struct VehicleTwistSum
+  {
+    size_t count{0};
+    double vx{0.0};
+    double vx_covariance{0.0};
+    rclcpp::Time latest_stamp;
+  };
+
+  // angular velocities in the frame of the imu, transformed once on output
+  struct GyroSum
+  {
+    size_t count{0};
+    geometry_msgs::msg::Vector3 angular_velocity{};
+    double angular_velocity_covariance{0.0};  // sum of the largest of the variances
+    std::string frame_id;
+    rclcpp::Time latest_stamp;
+  };
+
 public:
   explicit GyroOdometerNode(const rclcpp::NodeOptions & node_options);
 
@@ -47,6 +67,7 @@ private:
     const geometry_msgs::msg::TwistWithCovarianceStamped::ConstSharedPtr vehicle_twist_msg_ptr);
   void callback_imu(const sensor_msgs::msg::Imu::ConstSharedPtr imu_msg_ptr);
   void concat_gyro_and_odometer();
+  void clear_sums();
   void publish_data(const geometry_msgs::msg::TwistWithCovarianceStamped & twist_with_cov_raw);
 
   rclcpp::Subscription<geometry_msgs::msg::TwistWithCovarianceStamped>::SharedPtr
@@ -66,13 +87,15 @@ private:
 
   std::string output_frame_;
   double message_timeout_sec_;
+  double min_output_interval_sec_;
 
   bool vehicle_twist_arrived_;
   bool imu_arrived_;
   rclcpp::Time latest_vehicle_twist_ros_time_;
   rclcpp::Time latest_imu_ros_time_;
-  std::deque<geometry_msgs::msg::TwistWithCovarianceStamped> vehicle_twist_queue_;
-  std::deque<sensor_msgs::msg::Imu> gyro_queue_;
+  std::optional<rclcpp::Time> latest_output_stamp_;
+  VehicleTwistSum vehicle_twist_sum_;
+  GyroSum gyro_sum_;
 
   std::unique_ptr<autoware_utils_diagnostics::DiagnosticsInterface> diagnostics_;
 };
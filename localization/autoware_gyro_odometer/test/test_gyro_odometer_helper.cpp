@@ -42,5 +42,6 @@ rclcpp::NodeOptions get_node_options_with_default_params()
   // for gyro_odometer
   node_options.append_parameter_override("output_frame", "base_link");
   node_options.append_parameter_override("message_timeout_sec", 1e12);
+  node_options.append_parameter_override("min_output_interval_sec", 0.0);
   return node_options;
 }
@@ -160,3 +160,45 @@ TEST(GyroOdometer, TestGyroOdometerImuOnly)
 
   EXPECT_TRUE(gyro_odometer_validator_node->received_latest_twist_ptr == nullptr);
 }
+
+// Decimation test
+// Verify that the gyro_odometer publishes the mean of all the inputs received within
+// min_output_interval_sec in one fused twist message
+TEST(GyroOdometer, TestGyroOdometerDecimation)
+{
+  Imu input_imu = generate_sample_imu();
+  TwistWithCovarianceStamped input_velocity = generate_sample_velocity();
+
+  rclcpp::NodeOptions node_options = get_node_options_with_default_params();
+  node_options.append_parameter_override("min_output_interval_sec", 1.0);
+  auto gyro_odometer_node =
+    std::make_shared<autoware::gyro_odometer::GyroOdometerNode>(node_options);
+  auto imu_generator = std::make_shared<ImuGenerator>();
+  auto velocity_generator = std::make_shared<VelocityGenerator>();
+  auto gyro_odometer_validator_node = std::make_shared<GyroOdometerValidator>();
+
+  // first output
+  velocity_generator->vehicle_velocity_pub->publish(input_velocity);
+  imu_generator->imu_pub->publish(input_imu);
+  wait_spin_some(gyro_odometer_node);
+
+  // accumulated, as received within the interval
+  input_velocity.header.stamp = rclcpp::Time(0, 500000000);
+  input_velocity.twist.twist.linear.x = 3.0;
+  velocity_generator->vehicle_velocity_pub->publish(input_velocity);
+  imu_generator->imu_pub->publish(input_imu);
+  wait_spin_some(gyro_odometer_node);
+
+  // second output, the mean of the velocities since the first output
+  input_velocity.header.stamp = rclcpp::Time(1, 0);
+  input_velocity.twist.twist.linear.x = 5.0;
+  velocity_generator->vehicle_velocity_pub->publish(input_velocity);
+  imu_generator->imu_pub->publish(input_imu);
+  wait_spin_some(gyro_odometer_node);
+
+  wait_spin_some(gyro_odometer_validator_node);
+
+  ASSERT_FALSE(gyro_odometer_validator_node->received_latest_twist_ptr == nullptr);
+  EXPECT_DOUBLE_EQ(
+    gyro_odometer_validator_node->received_latest_twist_ptr->twist.twist.linear.x, 4.0);
+}
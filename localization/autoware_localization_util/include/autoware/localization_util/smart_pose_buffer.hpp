@@ -22,6 +22,8 @@
 #include <geometry_msgs/msg/pose_with_covariance_stamped.hpp>
 
 #include <deque>
+#include <mutex>
+#include <optional>
 
 namespace autoware::localization_util
 {
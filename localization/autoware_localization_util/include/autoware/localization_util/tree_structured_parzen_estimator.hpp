@@ -62,6 +62,9 @@ public:
     std::vector<double> sample_stddev);
   void add_trial(const Trial & trial);
   [[nodiscard]] Input get_next_input() const;
+  // Same as calling get_next_input() num times without adding trials in between, with the
+  // kernels of the trials evaluated once per candidate for all of them.
+  [[nodiscard]] std::vector<Input> get_next_inputs(const int64_t num) const;
 
 private:
   static constexpr double max_good_rate = 0.10;
@@ -69,11 +72,22 @@ private:
 
   static std::mt19937_64 engine;
 
-  [[nodiscard]] double compute_log_likelihood_ratio(const Input & input) const;
-  [[nodiscard]] static double log_gaussian_pdf(
-    const Input & input, const Input & mu, const Input & sigma);
+  [[nodiscard]] Input propose_input(std::vector<double> & log_p_buffer) const;
+  [[nodiscard]] double compute_log_likelihood_ratio(
+    const Input & input, std::vector<double> & log_p_buffer) const;
+  void update_kernels();
 
   std::vector<Trial> trials_;
+  // Kernel centers of the trials in the order of trials_, on the dimensions used by the kernel
+  // (trans_x, trans_y and angle_z in [-pi, pi)), contiguous to be evaluated in one loop.
+  std::vector<double> kernel_x_;
+  std::vector<double> kernel_y_;
+  std::vector<double> kernel_yaw_;
+  // log of the normalization of the kernel, and 1 / (2 sigma^2) of each of its dimensions
+  double kernel_log_normalizer_;
+  double kernel_x_coefficient_;
+  double kernel_y_coefficient_;
+  double kernel_yaw_coefficient_;
   int64_t above_num_;
   const Direction direction_;
   const int64_t n_startup_trials_;
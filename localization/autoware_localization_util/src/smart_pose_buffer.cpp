@@ -14,6 +14,9 @@
 
 #include "autoware/localization_util/smart_pose_buffer.hpp"
 
+#include <algorithm>
+#include <iterator>
+
 namespace autoware::localization_util
 {
 SmartPoseBuffer::SmartPoseBuffer(
@@ -28,7 +31,9 @@ SmartPoseBuffer::SmartPoseBuffer(
 std::optional<SmartPoseBuffer::InterpolateResult> SmartPoseBuffer::interpolate(
   const rclcpp::Time & target_ros_time)
 {
-  InterpolateResult result;
+  // only the two nearest messages are taken under the lock, and copied after it
+  PoseWithCovarianceStamped::ConstSharedPtr old_pose_ptr;
+  PoseWithCovarianceStamped::ConstSharedPtr new_pose_ptr;
 
   {
     std::lock_guard<std::mutex> lock(mutex_);
@@ -39,7 +44,6 @@ std::optional<SmartPoseBuffer::InterpolateResult> SmartPoseBuffer::interpolate(
     }
 
     const rclcpp::Time time_first = pose_buffer_.front()->header.stamp;
-    const rclcpp::Time time_last = pose_buffer_.back()->header.stamp;
 
     if (target_ros_time < time_first) {
       RCLCPP_INFO(logger_, "Mismatch between pose timestamp and current timestamp");
@@ -52,18 +56,26 @@ std::optional<SmartPoseBuffer::InterpolateResult> SmartPoseBuffer::interpolate(
     // However, if the timestamp difference is too large,
     // it will later be rejected by validate_time_stamp_difference.
 
-    // get the nearest poses
-    result.old_pose = *pose_buffer_.front();
-    for (const PoseWithCovarianceStamped::ConstSharedPtr & pose_cov_msg_ptr : pose_buffer_) {
-      result.new_pose = *pose_cov_msg_ptr;
-      const rclcpp::Time pose_time_stamp = result.new_pose.header.stamp;
-      if (pose_time_stamp > target_ros_time) {
-        break;
-      }
-      result.old_pose = *pose_cov_msg_ptr;
+    // get the nearest poses, the buffer is sorted by time stamp (see push_back)
+    const auto new_pose_it = std::upper_bound(
+      pose_buffer_.begin(), pose_buffer_.end(), target_ros_time,
+      [](const rclcpp::Time & time, const PoseWithCovarianceStamped::ConstSharedPtr & pose) {
+        return time < rclcpp::Time(pose->header.stamp);
+      });
+    if (new_pose_it == pose_buffer_.end()) {
+      old_pose_ptr = pose_buffer_.back();
+      new_pose_ptr = pose_buffer_.back();
+    } else {
+      // not the first pose, which is not newer than target_ros_time
+      old_pose_ptr = *std::prev(new_pose_it);
+      new_pose_ptr = *new_pose_it;
     }
   }
 
+  InterpolateResult result;
+  result.old_pose = *old_pose_ptr;
+  result.new_pose = *new_pose_ptr;
+
   // check the time stamp
   const bool is_old_pose_valid = validate_time_stamp_difference(
     result.old_pose.header.stamp, target_ros_time, pose_timeout_sec_);
@@ -110,12 +122,12 @@ void SmartPoseBuffer::push_back(const PoseWithCovarianceStamped::ConstSharedPtr
 void SmartPoseBuffer::pop_old(const rclcpp::Time & target_ros_time)
 {
   std::lock_guard<std::mutex> lock(mutex_);
-  while (!pose_buffer_.empty()) {
-    if (rclcpp::Time(pose_buffer_.front()->header.stamp) >= target_ros_time) {
-      break;
-    }
-    pose_buffer_.pop_front();
-  }
+  const auto first_kept_it = std::lower_bound(
+    pose_buffer_.begin(), pose_buffer_.end(), target_ros_time,
+    [](const PoseWithCovarianceStamped::ConstSharedPtr & pose, const rclcpp::Time & time) {
+      return rclcpp::Time(pose->header.stamp) < time;
+    });
+  pose_buffer_.erase(pose_buffer_.begin(), first_kept_it);
 }
 
 void SmartPoseBuffer::clear()
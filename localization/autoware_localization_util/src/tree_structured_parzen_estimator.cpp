@@ -18,7 +18,6 @@
 #include <cassert>
 #include <iostream>
 #include <limits>
-#include <numeric>
 #include <utility>
 #include <vector>
 
@@ -53,6 +52,14 @@ TreeStructuredParzenEstimator::TreeStructuredParzenEstimator(
   base_stddev_[ANGLE_X] = 1.0 / 180.0 * M_PI;  // [rad]
   base_stddev_[ANGLE_Y] = 1.0 / 180.0 * M_PI;  // [rad]
   base_stddev_[ANGLE_Z] = 2.5 / 180.0 * M_PI;  // [rad]
+
+  // Experimentally, it is better to consider only trans_xy and yaw, so ignore trans_z, angle_x,
+  // angle_y.
+  kernel_log_normalizer_ = -1.5 * std::log(2.0 * M_PI) - std::log(base_stddev_[TRANS_X]) -
+                           std::log(base_stddev_[TRANS_Y]) - std::log(base_stddev_[ANGLE_Z]);
+  kernel_x_coefficient_ = 1.0 / (2.0 * base_stddev_[TRANS_X] * base_stddev_[TRANS_X]);
+  kernel_y_coefficient_ = 1.0 / (2.0 * base_stddev_[TRANS_Y] * base_stddev_[TRANS_Y]);
+  kernel_yaw_coefficient_ = 1.0 / (2.0 * base_stddev_[ANGLE_Z] * base_stddev_[ANGLE_Z]);
 }
 
 void TreeStructuredParzenEstimator::add_trial(const Trial & trial)
@@ -64,9 +71,50 @@ void TreeStructuredParzenEstimator::add_trial(const Trial & trial)
   above_num_ = std::min(
     {static_cast<int64_t>(10),
      static_cast<int64_t>(static_cast<double>(trials_.size()) * max_good_rate)});
+  update_kernels();
+}
+
+void TreeStructuredParzenEstimator::update_kernels()
+{
+  const size_t n = trials_.size();
+  kernel_x_.resize(n);
+  kernel_y_.resize(n);
+  kernel_yaw_.resize(n);
+  for (size_t i = 0; i < n; i++) {
+    const Input & input = trials_[i].input;
+    kernel_x_[i] = input[TRANS_X];
+    kernel_y_[i] = input[TRANS_Y];
+    // Normalize to [-pi, pi), so that the difference to a candidate is in (-2 pi, 2 pi)
+    double yaw = input.size() > ANGLE_Z ? input[ANGLE_Z] : 0.0;
+    while (yaw >= M_PI) {
+      yaw -= 2 * M_PI;
+    }
+    while (yaw < -M_PI) {
+      yaw += 2 * M_PI;
+    }
+    kernel_yaw_[i] = yaw;
+  }
 }
 
 TreeStructuredParzenEstimator::Input TreeStructuredParzenEstimator::get_next_input() const
+{
+  return get_next_inputs(1).front();
+}
+
+std::vector<TreeStructuredParzenEstimator::Input> TreeStructuredParzenEstimator::get_next_inputs(
+  const int64_t num) const
+{
+  std::vector<Input> inputs;
+  inputs.reserve(num);
+  std::vector<double> log_p_buffer(trials_.size());
+  for (int64_t i = 0; i < num; i++) {
+    inputs.push_back(propose_input(log_p_buffer));
+  }
+  return inputs;
+}
+
+TreeStructuredParzenEstimator::Input TreeStructuredParzenEstimator::propose_input(
+  std::vector<double> & log_p_buffer) const
 {
   std::normal_distribution<double> dist_normal_trans_x(
     sample_mean_[TRANS_X], sample_stddev_[TRANS_X]);
@@ -102,7 +150,7 @@ TreeStructuredParzenEstimator::Input TreeStructuredParzenEstimator::get_next_inp
     input[ANGLE_X] = dist_normal_angle_x(engine);
     input[ANGLE_Y] = dist_normal_angle_y(engine);
     input[ANGLE_Z] = dist_uniform_angle_z(engine);
-    const double log_likelihood_ratio = compute_log_likelihood_ratio(input);
+    const double log_likelihood_ratio = compute_log_likelihood_ratio(input, log_p_buffer);
     if (log_likelihood_ratio > best_log_likelihood_ratio) {
       best_log_likelihood_ratio = log_likelihood_ratio;
       best_input = input;
@@ -111,38 +159,39 @@ TreeStructuredParzenEstimator::Input TreeStructuredParzenEstimator::get_next_inp
   return best_input;
 }
 
-double TreeStructuredParzenEstimator::compute_log_likelihood_ratio(const Input & input) const
+double TreeStructuredParzenEstimator::compute_log_likelihood_ratio(
+  const Input & input, std::vector<double> & log_p_buffer) const
 {
   const auto n = static_cast<int64_t>(trials_.size());
 
-  // The above KDE and the below KDE are calculated respectively, and the ratio is the criteria to
-  // select best sample.
-  std::vector<double> above_logs;
-  std::vector<double> below_logs;
-
+  // The gaussian kernels of all the trials, in one loop over the contiguous kernel centers
+  const double x = input[TRANS_X];
+  const double y = input[TRANS_Y];
+  const double yaw = input[ANGLE_Z];
   for (int64_t i = 0; i < n; i++) {
-    const double log_p = log_gaussian_pdf(input, trials_[i].input, base_stddev_);
-    if (i < above_num_) {
-      const double w = 1.0 / static_cast<double>(above_num_);
-      const double log_w = std::log(w);
-      above_logs.push_back(log_p + log_w);
-    } else {
-      const double w = 1.0 / static_cast<double>(n - above_num_);
-      const double log_w = std::log(w);
-      below_logs.push_back(log_p + log_w);
-    }
+    const double diff_x = x - kernel_x_[i];
+    const double diff_y = y - kernel_y_[i];
+    double diff_yaw = yaw - kernel_yaw_[i];
+    // Normalize the loop variable to [-pi, pi)
+    diff_yaw += (diff_yaw < -M_PI) ? 2 * M_PI : ((diff_yaw >= M_PI) ? -2 * M_PI : 0.0);
+    log_p_buffer[i] = kernel_log_normalizer_ - diff_x * diff_x * kernel_x_coefficient_ -
+                      diff_y * diff_y * kernel_y_coefficient_ -
+                      diff_yaw * diff_yaw * kernel_yaw_coefficient_;
   }
 
-  auto log_sum_exp = [](const std::vector<double> & log_vec) {
-    const double max = *std::max_element(log_vec.begin(), log_vec.end());
-    double sum = std::accumulate(
-      log_vec.begin(), log_vec.end(), 0.0,
-      [max](double total, double log_v) { return total + std::exp(log_v - max); });
+  auto log_sum_exp = [&log_p_buffer](const int64_t begin, const int64_t end) {
+    const double max = *std::max_element(log_p_buffer.begin() + begin, log_p_buffer.begin() + end);
+    double sum = 0.0;
+    for (int64_t i = begin; i < end; i++) {
+      sum += std::exp(log_p_buffer[i] - max);
+    }
     return max + std::log(sum);
   };
 
-  const double above = log_sum_exp(above_logs);
-  const double below = log_sum_exp(below_logs);
+  // The above KDE and the below KDE are calculated respectively, and the ratio is the criteria to
+  // select best sample. The weights of the kernels are uniform in each of them.
+  const double above = log_sum_exp(0, above_num_) - std::log(static_cast<double>(above_num_));
+  const double below = log_sum_exp(above_num_, n) - std::log(static_cast<double>(n - above_num_));
 
   // Multiply by a constant so that the score near the "below sample" becomes lower.
   // cspell:disable-line TODO(Shintaro Sakoda): It's theoretically incorrect, consider it again
@@ -150,36 +199,4 @@ double TreeStructuredParzenEstimator::compute_log_likelihood_ratio(const Input &
   const double r = above - below * 5.0;
   return r;
 }
-
-double TreeStructuredParzenEstimator::log_gaussian_pdf(
-  const Input & input, const Input & mu, const Input & sigma)
-{
-  const double log_2pi = std::log(2.0 * M_PI);
-  auto log_gaussian_pdf_1d = [&](const double diff, const double sigma) {
-    return -0.5 * log_2pi - std::log(sigma) - (diff * diff) / (2.0 * sigma * sigma);
-  };
-
-  const auto n = static_cast<int64_t>(input.size());
-
-  double result = 0.0;
-  for (int64_t i = 0; i < n; i++) {
-    double diff = input[i] - mu[i];
-    if (i == ANGLE_Z) {
-      // Normalize the loop variable to [-pi, pi)
-      while (diff >= M_PI) {
-        diff -= 2 * M_PI;
-      }
-      while (diff < -M_PI) {
-        diff += 2 * M_PI;
-      }
-    }
-    // Experimentally, it is better to consider only trans_xy and yaw, so ignore trans_z, angle_x,
-    // angle_y.
-    if (i == TRANS_Z || i == ANGLE_X || i == ANGLE_Y) {
-      continue;
-    }
-    result += log_gaussian_pdf_1d(diff, sigma[i]);
-  }
-  return result;
-}
 }  // namespace autoware::localization_util
@@ -295,6 +295,55 @@ TEST(TestSmartPoseBuffer, target_time_after_last_pose)  // NOLINT
   EXPECT_FALSE(result2.has_value());
 }
 
+TEST(TestSmartPoseBuffer, nearest_poses)  // NOLINT
+{
+  rclcpp::Logger logger = rclcpp::get_logger("test_logger");
+  SmartPoseBuffer smart_pose_buffer(logger, 10.0, 10.0);
+
+  // poses every 0.1 sec, two of them at 0.5 sec
+  for (int i = 0; i < 10; ++i) {
+    auto pose = std::make_shared<PoseWithCovarianceStamped>();
+    pose->header.stamp.nanosec = static_cast<uint32_t>(i) * 100000000;
+    pose->pose.pose.position.x = i;
+    smart_pose_buffer.push_back(pose);
+    if (i == 5) {
+      auto same_time_pose = std::make_shared<PoseWithCovarianceStamped>(*pose);
+      same_time_pose->pose.pose.position.x = 5.5;
+      smart_pose_buffer.push_back(same_time_pose);
+    }
+  }
+
+  builtin_interfaces::msg::Time target_time;
+  target_time.nanosec = 350000000;  // 0.35 sec
+  auto result = smart_pose_buffer.interpolate(target_time);
+  ASSERT_TRUE(result.has_value());
+  EXPECT_EQ(result->old_pose.pose.pose.position.x, 3.0);
+  EXPECT_EQ(result->new_pose.pose.pose.position.x, 4.0);
+
+  // the latest of the poses at the target time is the old one
+  target_time.nanosec = 500000000;  // 0.5 sec
+  result = smart_pose_buffer.interpolate(target_time);
+  ASSERT_TRUE(result.has_value());
+  EXPECT_EQ(result->old_pose.pose.pose.position.x, 5.5);
+  EXPECT_EQ(result->new_pose.pose.pose.position.x, 6.0);
+
+  // newer than the last pose
+  target_time.nanosec = 950000000;  // 0.95 sec
+  result = smart_pose_buffer.interpolate(target_time);
+  ASSERT_TRUE(result.has_value());
+  EXPECT_EQ(result->old_pose.pose.pose.position.x, 9.0);
+  EXPECT_EQ(result->new_pose.pose.pose.position.x, 9.0);
+
+  // the poses at the pop time are kept
+  target_time.nanosec = 500000000;  // 0.5 sec
+  smart_pose_buffer.pop_old(target_time);
+  result = smart_pose_buffer.interpolate(target_time);
+  ASSERT_TRUE(result.has_value());
+  EXPECT_EQ(result->old_pose.pose.pose.position.x, 5.5);
+  target_time.nanosec = 450000000;  // 0.45 sec
+  EXPECT_FALSE(smart_pose_buffer.interpolate(target_time).has_value());
+}
+
 int main(int argc, char ** argv)
 {
   rclcpp::init(argc, argv);
@@ -251,3 +251,25 @@ TEST(TreeStructuredParzenEstimatorTest, AngleWrappingHandling)
     EXPECT_EQ(input.size(), 6);
   });
 }
+
+// Test the batch proposals in the startup and the optimization phases
+TEST(TreeStructuredParzenEstimatorTest, GetNextInputs)
+{
+  std::vector<double> sample_mean(5, 0.0);
+  std::vector<double> sample_stddev(5, 1.0);
+
+  TreeStructuredParzenEstimator estimator(
+    TreeStructuredParzenEstimator::Direction::MAXIMIZE, 5, sample_mean, sample_stddev);
+  EXPECT_TRUE(estimator.get_next_inputs(0).empty());
+
+  for (int64_t trial = 0; trial < 20; trial++) {
+    const std::vector<TreeStructuredParzenEstimator::Input> inputs = estimator.get_next_inputs(4);
+    ASSERT_EQ(inputs.size(), 4);
+    for (const TreeStructuredParzenEstimator::Input & input : inputs) {
+      EXPECT_EQ(input.size(), 6);
+      EXPECT_GE(input[TreeStructuredParzenEstimator::ANGLE_Z], -M_PI);
+      EXPECT_LE(input[TreeStructuredParzenEstimator::ANGLE_Z], M_PI);
+      estimator.add_trial({input, -(input[0] * input[0] + input[1] * input[1])});
+    }
+  }
+}
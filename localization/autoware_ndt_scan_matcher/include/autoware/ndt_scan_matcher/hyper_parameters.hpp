@@ -61,6 +61,7 @@ struct HyperParameters
   {
     int64_t particles_num{};
     int64_t n_startup_trials{};
+    int64_t batch_size{};
   } initial_pose_estimation{};
 
   struct Validation
@@ -95,6 +96,7 @@ struct HyperParameters
       std::vector<double> initial_pose_offset_model_y{};
       double temperature{};
       double scale_factor{};
+      double time_budget_ms{};
     } covariance_estimation{};
   } covariance{};
 
@@ -103,6 +105,9 @@ struct HyperParameters
     double update_distance{};
     double map_radius{};
     double lidar_radius{};
+    double prefetch_time{};
+    std::string leaf_map_directory{};
+    double max_memory_mb{};
   } dynamic_map_loading{};
 
 public:
@@ -122,6 +127,15 @@ public:
     ndt.max_iterations = static_cast<int>(node->declare_parameter<int64_t>("ndt.max_iterations"));
     ndt.num_threads = static_cast<int>(node->declare_parameter<int64_t>("ndt.num_threads"));
     ndt.num_threads = std::max(ndt.num_threads, 1);
+    ndt.first_cpu = static_cast<int>(node->declare_parameter<int64_t>("ndt.first_cpu"));
+    ndt.thread_nice = static_cast<int>(node->declare_parameter<int64_t>("ndt.thread_nice"));
+    const int64_t search_method_tmp = node->declare_parameter<int64_t>("ndt.search_method");
+    ndt.search_method = static_cast<pclomp::NeighborSearchMethod>(search_method_tmp);
+    ndt.mixed_precision = node->declare_parameter<bool>("ndt.mixed_precision");
+    ndt.coarse_stride = static_cast<int>(node->declare_parameter<int64_t>("ndt.coarse_stride"));
+    ndt.coarse_stride = std::max(ndt.coarse_stride, 1);
+    ndt.coarse_iterations =
+      static_cast<int>(node->declare_parameter<int64_t>("ndt.coarse_iterations"));
     ndt_regularization_enable = node->declare_parameter<bool>("ndt.regularization.enable");
     ndt.regularization_scale_factor =
       static_cast<float>(node->declare_parameter<float>("ndt.regularization.scale_factor"));
@@ -130,6 +144,8 @@ public:
       node->declare_parameter<int64_t>("initial_pose_estimation.particles_num");
     initial_pose_estimation.n_startup_trials =
       node->declare_parameter<int64_t>("initial_pose_estimation.n_startup_trials");
+    initial_pose_estimation.batch_size =
+      node->declare_parameter<int64_t>("initial_pose_estimation.batch_size");
 
     validation.initial_pose_timeout_sec =
       node->declare_parameter<double>("validation.initial_pose_timeout_sec");
@@ -184,6 +200,8 @@ public:
       node->declare_parameter<double>("covariance.covariance_estimation.temperature");
     covariance.covariance_estimation.scale_factor =
       node->declare_parameter<double>("covariance.covariance_estimation.scale_factor");
+    covariance.covariance_estimation.time_budget_ms =
+      node->declare_parameter<double>("covariance.covariance_estimation.time_budget_ms");
 
     dynamic_map_loading.update_distance =
       node->declare_parameter<double>("dynamic_map_loading.update_distance");
@@ -191,6 +209,12 @@ public:
       node->declare_parameter<double>("dynamic_map_loading.map_radius");
     dynamic_map_loading.lidar_radius =
       node->declare_parameter<double>("dynamic_map_loading.lidar_radius");
+    dynamic_map_loading.prefetch_time =
+      node->declare_parameter<double>("dynamic_map_loading.prefetch_time");
+    dynamic_map_loading.leaf_map_directory =
+      node->declare_parameter<std::string>("dynamic_map_loading.leaf_map_directory");
+    dynamic_map_loading.max_memory_mb =
+      node->declare_parameter<double>("dynamic_map_loading.max_memory_mb");
   }
 };
 
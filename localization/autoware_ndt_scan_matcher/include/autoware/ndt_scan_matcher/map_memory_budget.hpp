@@ -0,0 +1,84 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__NDT_SCAN_MATCHER__MAP_MEMORY_BUDGET_HPP_
+#define AUTOWARE__NDT_SCAN_MATCHER__MAP_MEMORY_BUDGET_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace autoware::ndt_scan_matcher
+{
+/**
+ * Memory budget of the map pieces loaded in the NDT.
+ * - The pieces used by the scan matching, within a radius of the vehicle, are never evicted.
+ * - Beyond max_bytes, the other pieces are evicted from the least recently used one, and from the
+ *   one farthest behind the direction of travel between the pieces used at the same time.
+ * - The evicted pieces are reported as cached to the map loader, so that it does not send them
+ *   again, until they are within the radius of the vehicle again.
+ */
+class MapMemoryBudget
+{
+public:
+  struct Bounds
+  {
+    double min_x;
+    double min_y;
+    double max_x;
+    double max_y;
+  };
+
+  /// max_bytes of 0 does not limit the memory
+  explicit MapMemoryBudget(const size_t max_bytes) : max_bytes_(max_bytes) {}
+
+  void add(const std::string & id, const Bounds & bounds);
+  void set_bytes(const std::string & id, const size_t bytes);
+  void remove(const std::string & id);
+  void clear();
+
+  /// Mark the pieces within radius of (x, y) as used, and release the evicted ones in it
+  void use(const double x, const double y, const double radius);
+
+  /// Pieces to remove from the NDT so that the loaded ones fit in max_bytes, marked evicted.
+  /// (direction_x, direction_y) is the direction of travel, which may be zero.
+  [[nodiscard]] std::vector<std::string> evict(
+    const double x, const double y, const double direction_x, const double direction_y,
+    const double radius);
+
+  [[nodiscard]] std::vector<std::string> get_evicted_ids() const;
+  [[nodiscard]] size_t get_used_bytes() const { return used_bytes_; }
+  [[nodiscard]] size_t get_max_bytes() const { return max_bytes_; }
+
+private:
+  struct Piece
+  {
+    Bounds bounds;
+    size_t bytes{0};
+    uint64_t last_used{0};
+    bool is_evicted{false};
+  };
+
+  static double distance(const Bounds & bounds, const double x, const double y);
+
+  size_t max_bytes_;
+  size_t used_bytes_{0};
+  uint64_t use_count_{0};
+  std::map<std::string, Piece> pieces_;
+};
+}  // namespace autoware::ndt_scan_matcher
+
+#endif  // AUTOWARE__NDT_SCAN_MATCHER__MAP_MEMORY_BUDGET_HPP_
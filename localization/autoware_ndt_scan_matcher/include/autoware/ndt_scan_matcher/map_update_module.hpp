@@ -16,6 +16,7 @@
 #define AUTOWARE__NDT_SCAN_MATCHER__MAP_UPDATE_MODULE_HPP_
 
 #include "hyper_parameters.hpp"
+#include "map_memory_budget.hpp"
 #include "ndt_omp/multigrid_ndt_omp.h"
 #include "particle.hpp"
 
@@ -65,17 +66,31 @@ private:
     const bool is_activated, const std::optional<geometry_msgs::msg::Point> & position,
     std::unique_ptr<DiagnosticsInterface> & diagnostics_ptr);
 
+  // Center of the map to load, moved ahead of the position along the estimated velocity
+  geometry_msgs::msg::Point predict_map_center(
+    const geometry_msgs::msg::Point & position,
+    std::unique_ptr<DiagnosticsInterface> & diagnostics_ptr);
+
   [[nodiscard]] bool should_update_map(
     const geometry_msgs::msg::Point & position,
     std::unique_ptr<DiagnosticsInterface> & diagnostics_ptr);
 
+  // Load the map around position, keeping the map used at vehicle_position in the memory budget
   void update_map(
-    const geometry_msgs::msg::Point & position,
+    const geometry_msgs::msg::Point & position, const geometry_msgs::msg::Point & vehicle_position,
     std::unique_ptr<DiagnosticsInterface> & diagnostics_ptr);
   // Update the specified NDT
   bool update_ndt(
-    const geometry_msgs::msg::Point & position, NdtType & ndt,
-    std::unique_ptr<DiagnosticsInterface> & diagnostics_ptr);
+    const geometry_msgs::msg::Point & position, const geometry_msgs::msg::Point & vehicle_position,
+    NdtType & ndt, std::unique_ptr<DiagnosticsInterface> & diagnostics_ptr);
+  // Evict the map pieces beyond the memory budget from the NDT
+  void apply_memory_budget(
+    const geometry_msgs::msg::Point & position, const geometry_msgs::msg::Point & vehicle_position,
+    NdtType & ndt, std::unique_ptr<DiagnosticsInterface> & diagnostics_ptr);
+  // Path of the leaf map file of a map piece in leaf_map_directory
+  std::string get_leaf_map_path(const std::string & cell_id) const;
+  // Swap ndt_ptr_ with the updated NDT under the lock, keeping the input source
+  void swap_ndt(NdtPtrType & new_ndt_ptr);
   void publish_partial_pcd_map();
 
   rclcpp::Publisher<sensor_msgs::msg::PointCloud2>::SharedPtr loaded_pcd_pub_;
@@ -90,11 +105,17 @@ private:
 
   std::optional<geometry_msgs::msg::Point> last_update_position_ = std::nullopt;
 
+  // Position and time of the previous timer callback, to estimate the velocity for the prefetch
+  std::optional<geometry_msgs::msg::Point> last_timer_position_ = std::nullopt;
+  rclcpp::Time last_timer_time_;
+
   HyperParameters::DynamicMapLoading param_;
 
   // Indicate if there is a prefetch thread waiting for being collected
   NdtPtrType secondary_ndt_ptr_;
   bool need_rebuild_;
+  // Memory of the map pieces of the NDT, and the pieces evicted from it
+  MapMemoryBudget memory_budget_;
   // Keep the last_update_position_ unchanged while checking map range
   std::mutex last_update_position_mtx_;
 };
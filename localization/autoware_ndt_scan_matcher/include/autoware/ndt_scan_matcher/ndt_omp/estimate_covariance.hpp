@@ -34,19 +34,23 @@ struct ResultOfMultiNdtCovarianceEstimation
   std::vector<NdtResult> ndt_results;
 };
 
-/** \brief Estimate functions */
+/** \brief Estimate functions
+ * The poses_to_search are evaluated in parallel on copies of ndt_ptr. Only the poses evaluated
+ * within time_budget_ms (no limit if not positive) are used, and returned in ndt_initial_poses.
+ */
 Eigen::Matrix2d estimate_xy_covariance_by_laplace_approximation(
   const Eigen::Matrix<double, 6, 6> & hessian);
 ResultOfMultiNdtCovarianceEstimation estimate_xy_covariance_by_multi_ndt(
   const NdtResult & ndt_result,
   const std::shared_ptr<
     pclomp::MultiGridNormalDistributionsTransform<pcl::PointXYZ, pcl::PointXYZ>> & ndt_ptr,
-  const std::vector<Eigen::Matrix4f> & poses_to_search);
+  const std::vector<Eigen::Matrix4f> & poses_to_search, const double time_budget_ms = 0.0);
 ResultOfMultiNdtCovarianceEstimation estimate_xy_covariance_by_multi_ndt_score(
   const NdtResult & ndt_result,
   const std::shared_ptr<
     pclomp::MultiGridNormalDistributionsTransform<pcl::PointXYZ, pcl::PointXYZ>> & ndt_ptr,
-  const std::vector<Eigen::Matrix4f> & poses_to_search, const double temperature);
+  const std::vector<Eigen::Matrix4f> & poses_to_search, const double temperature,
+  const double time_budget_ms = 0.0);
 
 /** \brief Propose poses to search.
  * (1) Compute covariance by Laplace approximation
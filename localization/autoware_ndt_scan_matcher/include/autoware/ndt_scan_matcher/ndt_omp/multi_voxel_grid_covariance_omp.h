@@ -54,6 +54,9 @@
 
 // cspell:ignore Magnusson, Okorn, evecs, evals, covar, eigvalue, futs
 
+#include "ndt_leaf_map.hpp"
+#include "ndt_struct.hpp"
+
 #include <Eigen/Cholesky>
 #include <Eigen/Dense>
 
@@ -216,8 +219,29 @@ public:
     Eigen::Vector4i div_mul;
   };
 
-  // Each grid contains a vector of leaves and a kdtree built from those leaves
-  using GridNodeType = std::vector<Leaf>;
+  /** \brief The leaves of one map piece and their search indices.
+   * The indices are built with the leaves when the piece is added, and the node is not modified
+   * afterwards, so that adding or removing a piece does not touch the other pieces. */
+  struct GridNode
+  {
+    std::vector<Leaf> leaves;
+
+    /** \brief Kdtree of the leaf centroids for radiusSearch() */
+    PointCloudPtr centroids;
+    pcl::KdTreeFLANN<PointT> kdtree;
+
+    /** \brief Index in leaves of each voxel key for directSearch() */
+    std::unordered_map<int64_t, uint32_t> voxel_leaf_indices;
+
+    /** \brief Bounds of the leaf centroids and of the leaf voxels, to skip the nodes far from a
+     * query */
+    Eigen::Vector3f min_centroid{Eigen::Vector3f::Zero()};
+    Eigen::Vector3f max_centroid{Eigen::Vector3f::Zero()};
+    Eigen::Vector3i min_voxel{Eigen::Vector3i::Zero()};
+    Eigen::Vector3i max_voxel{Eigen::Vector3i::Zero()};
+  };
+
+  using GridNodeType = GridNode;
   using GridNodePtr = std::shared_ptr<GridNodeType>;
 
 public:
@@ -245,11 +269,27 @@ public:
    */
   void setInputCloudAndFilter(const PointCloudConstPtr & cloud, const std::string & grid_id);
 
+  /** \brief Add the ND voxel grid of a map piece from a leaf map file written by saveLeaves(),
+   * instead of filtering its points.
+   * \return false if the file can not be read or was computed with other voxel parameters, the
+   * grid is then not added
+   */
+  bool setInputLeavesFromFile(const std::string & path, const std::string & grid_id);
+
+  /** \brief Write the leaves of the ND voxel grid of the specified id to a leaf map file.
+   * \note The grid must have been made visible by createKdtree().
+   * \return false if there is no such grid or the file can not be written
+   */
+  bool saveLeaves(const std::string & grid_id, const std::string & path) const;
+
   /** \brief Remove a ND voxel grid corresponding to the specified id
    */
   void removeCloud(const std::string & grid_id);
 
-  /** \brief Build KdTrees from the NDT voxel for later radius search
+  /** \brief Make the clouds added and removed since the last call visible to the searches.
+   * \note Each ND voxel grid holds its own search indices, built when its cloud is added, so this
+   * call only waits for the filtering threads and compacts the grid list. Its cost does not grow
+   * with the number of grids that are kept loaded.
    */
   void createKdtree();
 
@@ -278,12 +318,29 @@ public:
     const PointCloud & cloud, int index, double radius, std::vector<LeafConstPtr> & k_leaves,
     unsigned int max_nn = 0) const;
 
+  /** \brief Search for the occupied voxels around the voxel containing the query point, without
+   * the kdtree. DIRECT1 returns the voxel of the point, DIRECT7 adds its 6 face neighbors and
+   * DIRECT26 all of its 26 neighbors.
+   * \note The leaves are looked up in the voxel table of each grid. A voxel on the boundary of
+   * two map pieces may hold one leaf of each.
+   * \param[in] point the given query point
+   * \param[in] method DIRECT1, DIRECT7 or DIRECT26
+   * \param[out] k_leaves the resultant leaves of the neighboring voxels
+   * \return number of neighbors found
+   */
+  int directSearch(
+    const PointT & point, NeighborSearchMethod method, std::vector<LeafConstPtr> & k_leaves) const;
+
   // Return a pointer to avoid multiple deep copies
   PointCloud getVoxelPCD() const;
 
   // Return the string indices of currently loaded map pieces
   std::vector<std::string> getCurrentMapIDs() const;
 
+  // Return the estimated memory of the leaves and of the search indices of each loaded map piece
+  // [bytes], once the pieces are filtered by createKdtree()
+  std::map<std::string, size_t> getMapMemoryUsage() const;
+
   void setThreadNum(int thread_num)
   {
     sync();
@@ -364,16 +421,27 @@ protected:
 
   int64_t getLeafID(const PointT & point, const BoundingBox & bbox) const;
 
+  // Key of the voxel table, 21 bits per axis, i.e. +/- 2^20 voxels around the map origin
+  static int64_t getVoxelKey(int x, int y, int z)
+  {
+    constexpr int64_t mask = (int64_t{1} << 21) - 1;
+    return ((static_cast<int64_t>(x) & mask) << 42) | ((static_cast<int64_t>(y) & mask) << 21) |
+           (static_cast<int64_t>(z) & mask);
+  }
+
+  // Build the search indices of a grid whose leaves are set
+  void buildGridIndex(GridNodeType & node) const;
+
+  // Append the leaf of the voxel in the grid to k_leaves
+  static void appendVoxelLeaf(
+    const GridNodeType & node, int x, int y, int z, std::vector<LeafConstPtr> & k_leaves);
+
   /** \brief Minimum points contained with in a voxel to allow it to be usable. */
   int min_points_per_voxel_;
 
   /** \brief Minimum allowable ratio between eigenvalues to prevent singular covariance matrices. */
   double min_covar_eigvalue_mult_;
 
-  // The point cloud containing the centroids of leaves
-  // Used to build a kdtree for radius search
-  PointCloudPtr voxel_centroids_ptr_;
-
   // Thread pooling, for parallel processing
   int thread_num_;
   std::vector<std::future<bool>> thread_futs_;
@@ -384,10 +452,8 @@ protected:
   std::map<std::string, int> sid_to_iid_;
   // Grids of leaves are held in a vector for faster access speed
   std::vector<GridNodePtr> grid_list_;
-  // A kdtree built from the leaves of grids
-  pcl::KdTreeFLANN<PointT> kdtree_;
-  // To access leaf by the search results by kdtree
-  std::vector<LeafConstPtr> leaf_ptrs_;
+  // The grids visible to the searches, updated by createKdtree()
+  std::vector<GridNodePtr> searchable_grid_list_;
 };
 }  // namespace pclomp
 
@@ -68,7 +68,9 @@
 #include <pcl/registration/registration.h>
 
 #include <iostream>
+#include <map>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 namespace pclomp
@@ -162,6 +164,28 @@ public:
     target_cells_.setInputCloudAndFilter(cloud, target_id);
   }
 
+  /** \brief Add a map piece whose voxels were precomputed in a leaf map file by
+   * MultiVoxelGridCovariance::saveLeaves(), instead of computing them from the cloud.
+   * \return false if the file can not be used, the map piece is then not added
+   */
+  inline bool addTargetLeaves(
+    const PointCloudTargetConstPtr & cloud, const std::string & path, const std::string & target_id)
+  {
+    target_cells_.setLeafSize(params_.resolution, params_.resolution, params_.resolution);
+    if (!target_cells_.setInputLeavesFromFile(path, target_id)) {
+      return false;
+    }
+    BaseRegType::setInputTarget(cloud);
+    return true;
+  }
+
+  /** \brief Write the voxels of a map piece to a leaf map file for addTargetLeaves().
+   */
+  inline bool saveTargetLeaves(const std::string & target_id, const std::string & path) const
+  {
+    return target_cells_.saveLeaves(target_id, path);
+  }
+
   inline void removeTarget(const std::string & target_id) { target_cells_.removeCloud(target_id); }
 
   inline void createVoxelKdtree()
@@ -262,6 +286,11 @@ public:
 
   std::vector<std::string> getCurrentMapIDs() const { return target_cells_.getCurrentMapIDs(); }
 
+  std::map<std::string, size_t> getMapMemoryUsage() const
+  {
+    return target_cells_.getMapMemoryUsage();
+  }
+
 protected:
   using BaseRegType::converged_;
   using BaseRegType::final_transformation_;
@@ -294,6 +323,15 @@ protected:
   /** \brief Initiate covariance voxel structure. */
   void inline init() {}
 
+  /** \brief Apply NdtParams::first_cpu and NdtParams::thread_nice to the OpenMP team of the
+   * calling thread. The team is reused by every parallel region of the calling thread, so that
+   * this is done again only when the parameters change.
+   */
+  void bindThreads() const;
+
+  /** \brief Resize thread_buffers_ to NdtParams::num_threads. */
+  void initThreadBuffers();
+
   /** \brief Compute derivatives of probability function w.r.t. the transformation vector.
    * \note Equation 6.10, 6.12 and 6.13 [Magnusson 2009].
    * \param[out] score_gradient the gradient vector of the probability function w.r.t. the
@@ -314,11 +352,12 @@ protected:
    * c_inv covariance of occupied covariance voxel \param[in] compute_hessian flag to calculate
    * hessian, unnecessary for step calculation.
    */
-  double updateDerivatives(
-    Eigen::Matrix<double, 6, 1> & score_gradient, Eigen::Matrix<double, 6, 6> & hessian,
-    const Eigen::Matrix<double, 4, 6> & point_gradient,
-    const Eigen::Matrix<double, 24, 6> & point_hessian, const Eigen::Vector3d & x_trans,
-    const Eigen::Matrix3d & c_inv, bool compute_hessian = true) const;
+  template <typename Scalar>
+  Scalar updateDerivatives(
+    Eigen::Matrix<Scalar, 6, 1> & score_gradient, Eigen::Matrix<Scalar, 6, 6> & hessian,
+    const Eigen::Matrix<Scalar, 4, 6> & point_gradient,
+    const Eigen::Matrix<Scalar, 24, 6> & point_hessian, const Eigen::Matrix<Scalar, 3, 1> & x_trans,
+    const Eigen::Matrix<Scalar, 3, 3> & c_inv, bool compute_hessian = true) const;
 
   /** \brief Precompute angular components of derivatives.
    * \note Equation 6.19 and 6.21 [Magnusson 2009].
@@ -332,9 +371,31 @@ protected:
    * \param[in] x point from the input cloud
    * \param[in] compute_hessian flag to calculate hessian, unnecessary for step calculation.
    */
+  template <typename Scalar>
   void computePointDerivatives(
-    Eigen::Vector3d & x, Eigen::Matrix<double, 4, 6> & point_gradient,
-    Eigen::Matrix<double, 24, 6> & point_hessian, bool compute_hessian = true) const;
+    Eigen::Matrix<Scalar, 3, 1> & x, Eigen::Matrix<Scalar, 4, 6> & point_gradient,
+    Eigen::Matrix<Scalar, 24, 6> & point_hessian, bool compute_hessian = true) const;
+
+  /** \brief Precomputed angular derivatives in the precision of the point derivatives. */
+  template <typename Scalar>
+  const Eigen::Matrix<Scalar, 8, 4> & angularGradient() const
+  {
+    if constexpr (std::is_same_v<Scalar, float>) {
+      return j_ang_float_;
+    } else {
+      return j_ang_;
+    }
+  }
+
+  template <typename Scalar>
+  const Eigen::Matrix<Scalar, 16, 4> & angularHessian() const
+  {
+    if constexpr (std::is_same_v<Scalar, float>) {
+      return h_ang_float_;
+    } else {
+      return h_ang_;
+    }
+  }
 
   /** \brief Compute hessian of probability function w.r.t. the transformation vector.
    * \note Equation 6.13 [Magnusson 2009].
@@ -449,6 +510,21 @@ protected:
     return (g_a - mu * g_0);
   }
 
+  /** \brief Search the target leaves neighboring a transformed point with the search method of
+   * \ref params_: a radius search of the kdtree, or a direct lookup of the neighboring voxels.
+   * \param[in] point the transformed point
+   * \param[out] neighborhood the leaves neighboring the point
+   */
+  inline void searchNeighborhood(
+    const PointSource & point, std::vector<TargetGridLeafConstPtr> & neighborhood) const
+  {
+    if (params_.search_method == KDTREE) {
+      target_cells_.radiusSearch(point, params_.resolution, neighborhood);
+    } else {
+      target_cells_.directSearch(point, params_.search_method, neighborhood);
+    }
+  }
+
   /** \brief The voxel grid generated from target cloud containing point means and covariances. */
   TargetGrid target_cells_;
 
@@ -480,6 +556,30 @@ protected:
    */
   Eigen::Matrix<double, 16, 4> h_ang_;
 
+  /** \brief Float copies of j_ang_ and h_ang_ for NdtParams::mixed_precision */
+  Eigen::Matrix<float, 8, 4> j_ang_float_;
+  Eigen::Matrix<float, 16, 4> h_ang_float_;
+
+  /** \brief Thread-wise accumulators and scratch of computeDerivatives() and computeHessian(),
+   * kept between the calls. Each buffer starts on its own cache line, so that the threads do not
+   * write to the same line.
+   */
+  struct alignas(64) ThreadBuffer
+  {
+    double score;
+    double nearest_voxel_score;
+    size_t found_neighborhood_voxel_num;
+    int neighborhood_count;
+    Eigen::Matrix<double, 6, 1> score_gradient;
+    Eigen::Matrix<double, 6, 6> hessian;
+    Eigen::Matrix<double, 4, 6> point_gradient;
+    Eigen::Matrix<double, 24, 6> point_hessian;
+    Eigen::Matrix<float, 4, 6> point_gradient_float;
+    Eigen::Matrix<float, 24, 6> point_hessian_float;
+    std::vector<TargetGridLeafConstPtr> neighborhood;
+  };
+  std::vector<ThreadBuffer> thread_buffers_;
+
   Eigen::Matrix<double, 6, 6> hessian_;
   std::vector<Eigen::Matrix4f, Eigen::aligned_allocator<Eigen::Matrix4f>> transformation_array_;
   std::vector<float> transform_probability_array_;
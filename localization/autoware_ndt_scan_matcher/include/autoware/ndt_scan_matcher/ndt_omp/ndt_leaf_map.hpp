@@ -0,0 +1,103 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__NDT_SCAN_MATCHER__NDT_OMP__NDT_LEAF_MAP_HPP_
+#define AUTOWARE__NDT_SCAN_MATCHER__NDT_OMP__NDT_LEAF_MAP_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace pclomp
+{
+
+// Binary file of the NDT leaves of one map piece, precomputed from its points.
+// The file is a NdtLeafMapHeader followed by header.leaf_num NdtLeafRecord, in the byte order of
+// the machine that wrote it. It is read through a memory mapping, so that loading a map piece
+// costs a page-in and a copy instead of the computation of the covariances.
+
+constexpr char ndt_leaf_map_magic[8] = {'N', 'D', 'T', 'L', 'E', 'A', 'F', '\0'};
+constexpr uint32_t ndt_leaf_map_version = 1;
+
+struct NdtLeafMapHeader
+{
+  char magic[8];
+  uint32_t version;
+  uint32_t leaf_num;
+  // Voxel parameters the leaves were computed with, a loader rejects the file if they differ
+  float resolution;
+  int32_t min_points_per_voxel;
+  double min_covar_eigvalue_mult;
+};
+
+struct NdtLeafRecord
+{
+  double mean[3];
+  // Upper triangle of the inverse covariance: xx, xy, xz, yy, yz, zz
+  double inverse_cov[6];
+  float centroid[3];
+  // -1 for a leaf whose covariance was rejected, as in MultiVoxelGridCovariance::Leaf
+  int32_t nr_points;
+};
+
+static_assert(sizeof(NdtLeafMapHeader) == 32, "NdtLeafMapHeader must not have padding");
+static_assert(sizeof(NdtLeafRecord) == 88, "NdtLeafRecord must not have padding");
+
+/** \brief Read-only memory mapping of a NDT leaf map file. */
+class NdtLeafMap
+{
+public:
+  NdtLeafMap() = default;
+  ~NdtLeafMap();
+
+  NdtLeafMap(const NdtLeafMap &) = delete;
+  NdtLeafMap & operator=(const NdtLeafMap &) = delete;
+
+  /** \brief Map the file.
+   * \return false if the file can not be mapped, or is not a leaf map of the current version
+   */
+  bool open(const std::string & path);
+
+  void close();
+
+  bool isOpen() const { return data_ != nullptr; }
+
+  const NdtLeafMapHeader & header() const
+  {
+    return *static_cast<const NdtLeafMapHeader *>(data_);
+  }
+
+  const NdtLeafRecord * records() const
+  {
+    return reinterpret_cast<const NdtLeafRecord *>(
+      static_cast<const char *>(data_) + sizeof(NdtLeafMapHeader));
+  }
+
+  size_t size() const { return isOpen() ? header().leaf_num : 0; }
+
+private:
+  void * data_{nullptr};
+  size_t length_{0};
+};
+
+/** \brief Write a NDT leaf map file, the magic and the version of the header are set here.
+ * \return false if the file can not be written
+ */
+bool saveNdtLeafMap(
+  const std::string & path, NdtLeafMapHeader header, const std::vector<NdtLeafRecord> & records);
+
+}  // namespace pclomp
+
+#endif  // AUTOWARE__NDT_SCAN_MATCHER__NDT_OMP__NDT_LEAF_MAP_HPP_
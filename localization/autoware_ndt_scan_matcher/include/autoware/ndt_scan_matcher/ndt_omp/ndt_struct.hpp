@@ -97,6 +97,19 @@ struct NdtParams
   int num_threads{};
   float regularization_scale_factor{};
 
+  // Pin the i-th alignment thread to the CPU first_cpu + i, -1 to let the scheduler move them
+  int first_cpu = -1;
+  // Nice value of the alignment threads, 0 to keep the one of the process
+  int thread_nice = 0;
+
+  // Run the first coarse_iterations iterations on every coarse_stride-th point of the input, and
+  // the remaining iterations and the score on all of them. 1 or 0 iterations to use all the points
+  int coarse_stride = 1;
+  int coarse_iterations = 0;
+
+  // Accumulate the derivatives of the neighbors of each point in float, and the points in double
+  bool mixed_precision = false;
+
   // line search is false by default
   // "use_lines_search = true" is not tested well
   bool use_line_search = false;
@@ -53,10 +53,12 @@
 #endif
 
 #include <array>
+#include <condition_variable>
 #include <deque>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <sstream>
 #include <string>
 #include <thread>
@@ -75,6 +77,7 @@ class NDTScanMatcher : public rclcpp::Node
 
 public:
   explicit NDTScanMatcher(const rclcpp::NodeOptions & options = rclcpp::NodeOptions());
+  ~NDTScanMatcher() override;
 
   // This function is only used in static tools to know when timer callbacks are triggered.
   std::chrono::nanoseconds time_until_trigger() const
@@ -83,6 +86,19 @@ public:
   }
 
 private:
+  /**
+   * @brief result of a scan matching, from which the debug clouds are generated off the scan
+   * matching callback. The clouds of the topics without a subscriber are null.
+   */
+  struct DebugCloudSnapshot
+  {
+    rclcpp::Time sensor_ros_time;
+    pcl::shared_ptr<const pcl::PointCloud<PointSource>> sensor_points_in_map_ptr;
+    pcl::shared_ptr<const pcl::PointCloud<PointSource>> no_ground_points_in_map_ptr;
+    pcl::shared_ptr<const pcl::PointCloud<PointSource>> voxel_score_points_in_map_ptr;
+    std::shared_ptr<const NormalDistributionsTransform> ndt_ptr;  // used for the voxel score
+  };
+
   void callback_timer();
 
   void callback_initial_pose(
@@ -141,9 +157,14 @@ private:
     const pclomp::NdtResult & ndt_result, const Eigen::Matrix4f & initial_pose_matrix,
     const rclcpp::Time & sensor_ros_time);
 
-  pcl::PointCloud<pcl::PointXYZRGB>::Ptr visualize_point_score(
-    const pcl::shared_ptr<pcl::PointCloud<PointSource>> & sensor_points_in_map_ptr,
-    const float & lower_nvs, const float & upper_nvs);
+  static pcl::PointCloud<pcl::PointXYZRGB>::Ptr visualize_point_score(
+    const NormalDistributionsTransform & ndt,
+    const pcl::PointCloud<PointSource> & sensor_points_in_map, const float & lower_nvs,
+    const float & upper_nvs);
+
+  void push_debug_clouds(DebugCloudSnapshot snapshot);
+  void debug_cloud_worker();
+  void publish_debug_clouds(const DebugCloudSnapshot & snapshot);
 
   void add_regularization_pose(const rclcpp::Time & sensor_ros_time);
 
@@ -219,6 +240,17 @@ private:
   std::unique_ptr<autoware_utils_logging::LoggerLevelConfigure> logger_configure_;
 
   HyperParameters param_;
+
+  // Copy of the NDT for the voxel score, made again when the map is updated
+  std::shared_ptr<const NormalDistributionsTransform> debug_ndt_ptr_;
+  std::weak_ptr<const NormalDistributionsTransform> debug_ndt_source_ptr_;
+
+  // Only the latest snapshot is kept, an older one not taken by the worker yet is dropped
+  std::mutex debug_cloud_mtx_;
+  std::condition_variable debug_cloud_cv_;
+  std::optional<DebugCloudSnapshot> debug_cloud_snapshot_;
+  bool is_debug_cloud_worker_stopped_{false};
+  std::thread debug_cloud_thread_;
 };
 
 }  // namespace autoware::ndt_scan_matcher
@@ -0,0 +1,134 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/ndt_scan_matcher/map_memory_budget.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace autoware::ndt_scan_matcher
+{
+
+void MapMemoryBudget::add(const std::string & id, const Bounds & bounds)
+{
+  auto & piece = pieces_[id];
+  if (!piece.is_evicted) {
+    used_bytes_ -= piece.bytes;
+  }
+  piece = Piece{bounds, 0, use_count_, false};
+}
+
+void MapMemoryBudget::set_bytes(const std::string & id, const size_t bytes)
+{
+  const auto it = pieces_.find(id);
+  if (it == pieces_.end() || it->second.is_evicted) {
+    return;
+  }
+  used_bytes_ = used_bytes_ - it->second.bytes + bytes;
+  it->second.bytes = bytes;
+}
+
+void MapMemoryBudget::remove(const std::string & id)
+{
+  const auto it = pieces_.find(id);
+  if (it == pieces_.end()) {
+    return;
+  }
+  if (!it->second.is_evicted) {
+    used_bytes_ -= it->second.bytes;
+  }
+  pieces_.erase(it);
+}
+
+void MapMemoryBudget::clear()
+{
+  pieces_.clear();
+  used_bytes_ = 0;
+}
+
+void MapMemoryBudget::use(const double x, const double y, const double radius)
+{
+  ++use_count_;
+  for (auto it = pieces_.begin(); it != pieces_.end();) {
+    if (distance(it->second.bounds, x, y) >= radius) {
+      ++it;
+    } else if (it->second.is_evicted) {
+      // no longer reported as cached, so that the map loader sends it again
+      it = pieces_.erase(it);
+    } else {
+      it->second.last_used = use_count_;
+      ++it;
+    }
+  }
+}
+
+std::vector<std::string> MapMemoryBudget::evict(
+  const double x, const double y, const double direction_x, const double direction_y,
+  const double radius)
+{
+  std::vector<std::string> evicted_ids;
+  if (max_bytes_ == 0 || used_bytes_ <= max_bytes_) {
+    return evicted_ids;
+  }
+
+  // (last use, distance ahead along the direction of travel, piece)
+  std::vector<std::tuple<uint64_t, double, std::map<std::string, Piece>::iterator>> candidates;
+  for (auto it = pieces_.begin(); it != pieces_.end(); ++it) {
+    const auto & piece = it->second;
+    if (piece.is_evicted || distance(piece.bounds, x, y) < radius) {
+      continue;
+    }
+    const double center_x = (piece.bounds.min_x + piece.bounds.max_x) / 2.0;
+    const double center_y = (piece.bounds.min_y + piece.bounds.max_y) / 2.0;
+    const double ahead = (center_x - x) * direction_x + (center_y - y) * direction_y;
+    candidates.emplace_back(piece.last_used, ahead, it);
+  }
+  std::sort(candidates.begin(), candidates.end(), [](const auto & a, const auto & b) {
+    return std::tie(std::get<0>(a), std::get<1>(a)) < std::tie(std::get<0>(b), std::get<1>(b));
+  });
+
+  for (const auto & candidate : candidates) {
+    if (used_bytes_ <= max_bytes_) {
+      break;
+    }
+    auto & [id, piece] = *std::get<2>(candidate);
+    used_bytes_ -= piece.bytes;
+    piece.bytes = 0;
+    piece.is_evicted = true;
+    evicted_ids.push_back(id);
+  }
+  return evicted_ids;
+}
+
+std::vector<std::string> MapMemoryBudget::get_evicted_ids() const
+{
+  std::vector<std::string> evicted_ids;
+  for (const auto & [id, piece] : pieces_) {
+    if (piece.is_evicted) {
+      evicted_ids.push_back(id);
+    }
+  }
+  return evicted_ids;
+}
+
+double MapMemoryBudget::distance(const Bounds & bounds, const double x, const double y)
+{
+  const double dx = std::max({bounds.min_x - x, 0.0, x - bounds.max_x});
+  const double dy = std::max({bounds.min_y - y, 0.0, y - bounds.max_y});
+  return std::hypot(dx, dy);
+}
+}  // namespace autoware::ndt_scan_matcher
@@ -14,6 +14,9 @@
 
 #include <autoware/ndt_scan_matcher/map_update_module.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
 #include <memory>
 #include <string>
 
@@ -27,10 +30,15 @@ MapUpdateModule::MapUpdateModule(
   ndt_ptr_mutex_(ndt_ptr_mutex),
   logger_(node->get_logger()),
   clock_(node->get_clock()),
-  param_(param)
+  param_(param),
+  memory_budget_(static_cast<size_t>(std::max(0.0, param.max_memory_mb) * 1024.0 * 1024.0))
 {
+  // NOTE: intra-process communication does not support the transient local durability, so it is
+  // disabled for this publisher to be able to load the node with use_intra_process_comms
+  rclcpp::PublisherOptions loaded_pcd_pub_options;
+  loaded_pcd_pub_options.use_intra_process_comm = rclcpp::IntraProcessSetting::Disable;
   loaded_pcd_pub_ = node->create_publisher<sensor_msgs::msg::PointCloud2>(
-    "debug/loaded_pointcloud_map", rclcpp::QoS{1}.transient_local());
+    "debug/loaded_pointcloud_map", rclcpp::QoS{1}.transient_local(), loaded_pcd_pub_options);
 
   pcd_loader_client_ =
     node->create_client<autoware_map_msgs::srv::GetDifferentialPointCloudMap>("pcd_loader_service");
@@ -46,11 +54,10 @@ MapUpdateModule::MapUpdateModule(
     throw std::runtime_error(message.str());
   }
 
-  // Initially, a direct map update on ndt_ptr_ is needed.
-  // ndt_ptr_'s mutex is locked until it is fully rebuilt.
-  // From the second update, the update is done on secondary_ndt_ptr_,
-  // and ndt_ptr_ is only locked when swapping its pointer with
-  // secondary_ndt_ptr_.
+  // Initially, the NDT is rebuilt from an empty map.
+  // From the second update, the update is done on secondary_ndt_ptr_.
+  // In both cases, ndt_ptr_ is only locked when swapping its pointer with
+  // the updated NDT.
   need_rebuild_ = true;
 }
 
@@ -80,11 +87,47 @@ void MapUpdateModule::callback_timer(
     return;
   }
 
+  const geometry_msgs::msg::Point map_center =
+    predict_map_center(position.value(), diagnostics_ptr);
   if (should_update_map(position.value(), diagnostics_ptr)) {
-    update_map(position.value(), diagnostics_ptr);
+    update_map(map_center, position.value(), diagnostics_ptr);
   }
 }
 
+geometry_msgs::msg::Point MapUpdateModule::predict_map_center(
+  const geometry_msgs::msg::Point & position,
+  std::unique_ptr<DiagnosticsInterface> & diagnostics_ptr)
+{
+  const rclcpp::Time now = clock_->now();
+  geometry_msgs::msg::Point map_center = position;
+
+  if (last_timer_position_ != std::nullopt) {
+    const double dt = (now - last_timer_time_).seconds();
+    if (dt > 0.0) {
+      double offset_x = (position.x - last_timer_position_.value().x) / dt * param_.prefetch_time;
+      double offset_y = (position.y - last_timer_position_.value().y) / dt * param_.prefetch_time;
+
+      // Keep the LiDAR range in the loaded map until the next update
+      const double max_offset =
+        std::max(0.0, param_.map_radius - param_.lidar_radius - param_.update_distance);
+      const double offset = std::hypot(offset_x, offset_y);
+      if (offset > max_offset) {
+        offset_x *= max_offset / offset;
+        offset_y *= max_offset / offset;
+      }
+      map_center.x += offset_x;
+      map_center.y += offset_y;
+    }
+  }
+
+  last_timer_position_ = position;
+  last_timer_time_ = now;
+
+  diagnostics_ptr->add_key_value(
+    "map_center_offset", std::hypot(map_center.x - position.x, map_center.y - position.y));
+  return map_center;
+}
+
 bool MapUpdateModule::should_update_map(
   const geometry_msgs::msg::Point & position,
   std::unique_ptr<DiagnosticsInterface> & diagnostics_ptr)
@@ -113,7 +156,7 @@ bool MapUpdateModule::should_update_map(
       diagnostic_msgs::msg::DiagnosticStatus::ERROR, message.str());
 
     // If the map does not keep up with the current position,
-    // lock ndt_ptr_ entirely until it is fully rebuilt.
+    // rebuild ndt_ptr_ from an empty map.
     need_rebuild_ = true;
   }
 
@@ -142,31 +185,36 @@ bool MapUpdateModule::out_of_map_range(const geometry_msgs::msg::Point & positio
 }
 
 void MapUpdateModule::update_map(
-  const geometry_msgs::msg::Point & position,
+  const geometry_msgs::msg::Point & position, const geometry_msgs::msg::Point & vehicle_position,
   std::unique_ptr<DiagnosticsInterface> & diagnostics_ptr)
 {
   diagnostics_ptr->add_key_value("is_need_rebuild", need_rebuild_);
 
+  // The map is loaded and indexed on this thread into a NDT that is not used by the scan matching,
+  // and ndt_ptr_ is only locked to swap the pointers. The scan matching therefore never waits for
+  // the map loader or for the construction of the voxels.
+  NdtPtrType new_ndt_ptr;
+
   // If the current position is super far from the previous loading position,
-  // lock and rebuild ndt_ptr_
+  // rebuild the NDT from an empty map
   if (need_rebuild_) {
-    ndt_ptr_mutex_->lock();
-
-    auto param = ndt_ptr_->getParams();
-    auto input_source = ndt_ptr_->getInputSource();
-
-    ndt_ptr_.reset(new NdtType);
+    new_ndt_ptr.reset(new NdtType);
 
-    ndt_ptr_->setParams(param);
-    if (input_source != nullptr) {
-      ndt_ptr_->setInputSource(input_source);
-    }
+    ndt_ptr_mutex_->lock();
+    new_ndt_ptr->setParams(ndt_ptr_->getParams());
+    ndt_ptr_mutex_->unlock();
+    memory_budget_.clear();
+  } else {
+    // Load map to the secondary_ndt_ptr, which is a copy of ndt_ptr_ sharing its map pieces
+    new_ndt_ptr = secondary_ndt_ptr_;
+  }
 
-    const bool updated = update_ndt(position, *ndt_ptr_, diagnostics_ptr);
+  const bool updated = update_ndt(position, vehicle_position, *new_ndt_ptr, diagnostics_ptr);
 
-    // check is_updated_map
-    diagnostics_ptr->add_key_value("is_updated_map", updated);
-    if (!updated) {
+  // check is_updated_map
+  diagnostics_ptr->add_key_value("is_updated_map", updated);
+  if (!updated) {
+    if (need_rebuild_) {
       std::stringstream message;
       message
         << "update_ndt failed. If this happens with initial position estimation, make sure that"
@@ -175,48 +223,21 @@ void MapUpdateModule::update_map(
       diagnostics_ptr->update_level_and_message(
         diagnostic_msgs::msg::DiagnosticStatus::ERROR, message.str());
       RCLCPP_ERROR_STREAM_THROTTLE(logger_, *clock_, 1000, message.str());
-      ndt_ptr_mutex_->unlock();
-
-      last_update_position_mtx_.lock();
-      last_update_position_ = position;
-      last_update_position_mtx_.unlock();
-
-      return;
-    }
-
-    ndt_ptr_mutex_->unlock();
-    need_rebuild_ = false;
 
-  } else {
-    // Load map to the secondary_ndt_ptr, which does not require a mutex lock
-    // Since the update of the secondary ndt ptr and the NDT align (done on
-    // the main ndt_ptr_) overlap, the latency of updating/alignment reduces partly.
-    // If the updating is done the main ndt_ptr_, either the update or the NDT
-    // align will be blocked by the other.
-    const bool updated = update_ndt(position, *secondary_ndt_ptr_, diagnostics_ptr);
-
-    // check is_updated_map
-    diagnostics_ptr->add_key_value("is_updated_map", updated);
-    if (!updated) {
-      last_update_position_mtx_.lock();
-      last_update_position_ = position;
-      last_update_position_mtx_.unlock();
-
-      return;
+      // The map of the previous position is not valid anymore, the empty NDT is swapped in
+      swap_ndt(new_ndt_ptr);
     }
 
-    ndt_ptr_mutex_->lock();
-    auto dummy_ptr = ndt_ptr_;
-    auto input_source = ndt_ptr_->getInputSource();
-    ndt_ptr_ = secondary_ndt_ptr_;
-    if (input_source != nullptr) {
-      ndt_ptr_->setInputSource(input_source);
-    }
-    ndt_ptr_mutex_->unlock();
+    last_update_position_mtx_.lock();
+    last_update_position_ = position;
+    last_update_position_mtx_.unlock();
 
-    dummy_ptr.reset();
+    return;
   }
 
+  swap_ndt(new_ndt_ptr);
+  need_rebuild_ = false;
+
   secondary_ndt_ptr_.reset(new NdtType);
   *secondary_ndt_ptr_ = *ndt_ptr_;
 
@@ -229,18 +250,40 @@ void MapUpdateModule::update_map(
   publish_partial_pcd_map();
 }
 
+void MapUpdateModule::swap_ndt(NdtPtrType & new_ndt_ptr)
+{
+  ndt_ptr_mutex_->lock();
+  auto dummy_ptr = ndt_ptr_;
+  auto input_source = ndt_ptr_->getInputSource();
+  ndt_ptr_ = new_ndt_ptr;
+  if (input_source != nullptr) {
+    ndt_ptr_->setInputSource(input_source);
+  }
+  ndt_ptr_mutex_->unlock();
+
+  // The previous NDT is released outside of the lock
+  dummy_ptr.reset();
+}
+
 bool MapUpdateModule::update_ndt(
-  const geometry_msgs::msg::Point & position, NdtType & ndt,
-  std::unique_ptr<DiagnosticsInterface> & diagnostics_ptr)
+  const geometry_msgs::msg::Point & position, const geometry_msgs::msg::Point & vehicle_position,
+  NdtType & ndt, std::unique_ptr<DiagnosticsInterface> & diagnostics_ptr)
 {
   diagnostics_ptr->add_key_value("maps_size_before", ndt.getCurrentMapIDs().size());
 
+  // The pieces needed until the next update are used, and loaded again if they were evicted
+  memory_budget_.use(
+    vehicle_position.x, vehicle_position.y, param_.lidar_radius + param_.update_distance);
+
   auto request = std::make_shared<autoware_map_msgs::srv::GetDifferentialPointCloudMap::Request>();
 
   request->area.center_x = static_cast<float>(position.x);
   request->area.center_y = static_cast<float>(position.y);
   request->area.radius = static_cast<float>(param_.map_radius);
   request->cached_ids = ndt.getCurrentMapIDs();
+  // The evicted pieces are reported as cached, so that the map loader does not send them again
+  const auto evicted_ids = memory_budget_.get_evicted_ids();
+  request->cached_ids.insert(request->cached_ids.end(), evicted_ids.begin(), evicted_ids.end());
 
   while (!pcd_loader_client_->wait_for_service(std::chrono::seconds(1)) && rclcpp::ok()) {
     diagnostics_ptr->add_key_value("is_succeed_call_pcd_loader", false);
@@ -286,20 +329,33 @@ bool MapUpdateModule::update_ndt(
   const auto exe_start_time = std::chrono::system_clock::now();
   // Perform heavy processing outside of the lock scope
 
-  // Add pcd
+  // Add pcd, with the precomputed voxels when a leaf map of the piece is available
+  size_t maps_from_leaf_map_size = 0;
   for (auto & map : maps_to_add) {
     auto cloud = pcl::make_shared<pcl::PointCloud<PointTarget>>();
 
     pcl::fromROSMsg(map.pointcloud, *cloud);
+    memory_budget_.add(
+      map.cell_id, {map.metadata.min_x, map.metadata.min_y, map.metadata.max_x,
+                    map.metadata.max_y});
+    if (
+      !param_.leaf_map_directory.empty() &&
+      ndt.addTargetLeaves(cloud, get_leaf_map_path(map.cell_id), map.cell_id)) {
+      ++maps_from_leaf_map_size;
+      continue;
+    }
     ndt.addTarget(cloud, map.cell_id);
   }
+  diagnostics_ptr->add_key_value("maps_from_leaf_map_size", maps_from_leaf_map_size);
 
   // Remove pcd
   for (const std::string & map_id_to_remove : map_ids_to_remove) {
     ndt.removeTarget(map_id_to_remove);
+    memory_budget_.remove(map_id_to_remove);
   }
 
   ndt.createVoxelKdtree();
+  apply_memory_budget(position, vehicle_position, ndt, diagnostics_ptr);
 
   const auto exe_end_time = std::chrono::system_clock::now();
   const auto duration_micro_sec =
@@ -311,6 +367,47 @@ bool MapUpdateModule::update_ndt(
   return true;  // Updated
 }
 
+void MapUpdateModule::apply_memory_budget(
+  const geometry_msgs::msg::Point & position, const geometry_msgs::msg::Point & vehicle_position,
+  NdtType & ndt, std::unique_ptr<DiagnosticsInterface> & diagnostics_ptr)
+{
+  for (const auto & [map_id, bytes] : ndt.getMapMemoryUsage()) {
+    memory_budget_.set_bytes(map_id, bytes);
+  }
+
+  // The map is requested ahead of the vehicle, so the pieces behind it are evicted first
+  const auto evicted_ids = memory_budget_.evict(
+    vehicle_position.x, vehicle_position.y, position.x - vehicle_position.x,
+    position.y - vehicle_position.y, param_.lidar_radius + param_.update_distance);
+  for (const std::string & map_id : evicted_ids) {
+    ndt.removeTarget(map_id);
+  }
+  if (!evicted_ids.empty()) {
+    ndt.createVoxelKdtree();
+  }
+
+  constexpr double bytes_per_mb = 1024.0 * 1024.0;
+  const double memory_usage_mb =
+    static_cast<double>(memory_budget_.get_used_bytes()) / bytes_per_mb;
+  diagnostics_ptr->add_key_value("map_memory_usage_mb", memory_usage_mb);
+  diagnostics_ptr->add_key_value("maps_evicted_size", evicted_ids.size());
+
+  // check map_memory_usage_mb
+  if (param_.max_memory_mb > 0.0 && memory_usage_mb > param_.max_memory_mb) {
+    std::stringstream message;
+    message << "The map pieces within the LiDAR range exceed the memory budget.";
+    diagnostics_ptr->update_level_and_message(
+      diagnostic_msgs::msg::DiagnosticStatus::WARN, message.str());
+  }
+}
+
+std::string MapUpdateModule::get_leaf_map_path(const std::string & cell_id) const
+{
+  // The cell id of the pointcloud_map_loader is the path of the PCD file
+  const auto file_name = std::filesystem::path(cell_id).stem().string() + ".ndtleaf";
+  return (std::filesystem::path(param_.leaf_map_directory) / file_name).string();
+}
+
 void MapUpdateModule::publish_partial_pcd_map()
 {
   pcl::PointCloud<PointTarget> map_pcl = ndt_ptr_->getVoxelPCD();
@@ -0,0 +1,98 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Offline tool writing the NDT leaf map of each PCD map piece, to be loaded by ndt_scan_matcher
+// through dynamic_map_loading.leaf_map_directory instead of computing the voxels at run time.
+
+#include <autoware/ndt_scan_matcher/ndt_omp/multigrid_ndt_omp.h>
+
+#include <pcl/io/pcd_io.h>
+
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// cspell:ignore ndtleaf
+
+namespace fs = std::filesystem;
+
+namespace
+{
+using PointTarget = pcl::PointXYZ;
+using NdtType = pclomp::MultiGridNormalDistributionsTransform<PointTarget, PointTarget>;
+
+std::vector<fs::path> collect_pcd_paths(const std::vector<std::string> & inputs)
+{
+  std::vector<fs::path> pcd_paths;
+  for (const auto & input : inputs) {
+    if (fs::is_directory(input)) {
+      for (const auto & entry : fs::directory_iterator(input)) {
+        if (entry.path().extension() == ".pcd") {
+          pcd_paths.push_back(entry.path());
+        }
+      }
+    } else {
+      pcd_paths.emplace_back(input);
+    }
+  }
+  return pcd_paths;
+}
+
+bool generate_leaf_map(const fs::path & pcd_path, const fs::path & output_path, float resolution)
+{
+  auto cloud = pcl::make_shared<pcl::PointCloud<PointTarget>>();
+  if (pcl::io::loadPCDFile(pcd_path.string(), *cloud) != 0) {
+    std::cerr << "Failed to read " << pcd_path << std::endl;
+    return false;
+  }
+
+  NdtType ndt;
+  pclomp::NdtParams params = ndt.getParams();
+  params.resolution = resolution;
+  ndt.setParams(params);
+  ndt.addTarget(cloud, pcd_path.string());
+  ndt.createVoxelKdtree();
+
+  if (!ndt.saveTargetLeaves(pcd_path.string(), output_path.string())) {
+    std::cerr << "Failed to write " << output_path << std::endl;
+    return false;
+  }
+  std::cout << pcd_path << " -> " << output_path << std::endl;
+  return true;
+}
+}  // namespace
+
+int main(int argc, char ** argv)
+{
+  if (argc < 4) {
+    std::cerr << "Usage: " << argv[0]
+              << " <resolution> <output_directory> <pcd_file_or_directory>...\n"
+                 "resolution must be the ndt.resolution of ndt_scan_matcher."
+              << std::endl;
+    return 1;
+  }
+
+  const float resolution = std::stof(argv[1]);
+  const fs::path output_directory(argv[2]);
+  fs::create_directories(output_directory);
+
+  bool succeeded = true;
+  for (const auto & pcd_path : collect_pcd_paths({argv + 3, argv + argc})) {
+    // Same file name as MapUpdateModule::get_leaf_map_path()
+    const fs::path output_path = output_directory / (pcd_path.stem().string() + ".ndtleaf");
+    succeeded &= generate_leaf_map(pcd_path, output_path, resolution);
+  }
+  return succeeded ? 0 : 1;
+}
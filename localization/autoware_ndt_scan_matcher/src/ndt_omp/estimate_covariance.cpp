@@ -15,9 +15,14 @@
 #include <autoware/ndt_scan_matcher/ndt_omp/estimate_covariance.hpp>
 
 #include <algorithm>
+#include <chrono>
+#include <condition_variable>
 #include <fstream>
+#include <functional>
 #include <iomanip>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -32,25 +37,105 @@ Eigen::Matrix2d estimate_xy_covariance_by_laplace_approximation(
   return covariance_xy;
 }
 
+namespace
+{
+using NdtType = MultiGridNormalDistributionsTransform<pcl::PointXYZ, pcl::PointXYZ>;
+
+// Results of the searches of evaluate_poses_in_parallel(), shared with the search threads, which
+// may outlive the call when the time budget is exceeded
+template <typename Result>
+struct ParallelSearchState
+{
+  std::mutex mutex;
+  std::condition_variable finished;
+  std::vector<Result> results;
+  std::vector<bool> is_finished;
+  size_t finished_num{0};
+};
+
+/** \brief Run evaluate(ndt, pose) for each pose, each on its own thread and copy of ndt_ptr. The
+ * copies share the voxel grids of the map, which are not modified once built, and split the
+ * threads of ndt_ptr. A search left running after time_budget_ms (no limit if not positive) ends
+ * on its own, and its result is dropped.
+ * \return the indices of the finished poses in ascending order, and their results
+ */
+template <typename Result>
+std::pair<std::vector<size_t>, std::vector<Result>> evaluate_poses_in_parallel(
+  const std::shared_ptr<NdtType> & ndt_ptr, const std::vector<Eigen::Matrix4f> & poses,
+  const double time_budget_ms,
+  const std::function<Result(NdtType &, const Eigen::Matrix4f &)> & evaluate)
+{
+  const auto deadline =
+    std::chrono::steady_clock::now() + std::chrono::duration<double, std::milli>(time_budget_ms);
+
+  auto state = std::make_shared<ParallelSearchState<Result>>();
+  state->results.resize(poses.size());
+  state->is_finished.resize(poses.size(), false);
+
+  NdtParams params = ndt_ptr->getParams();
+  const int num_threads = params.num_threads;
+  params.num_threads = std::max(1, num_threads / std::max(1, static_cast<int>(poses.size())));
+  for (size_t i = 0; i < poses.size(); ++i) {
+    auto search_ndt_ptr = std::make_shared<NdtType>(*ndt_ptr);
+    NdtParams search_params = params;
+    if (search_params.first_cpu >= 0) {
+      search_params.first_cpu += static_cast<int>(i) * params.num_threads;
+    }
+    search_ndt_ptr->setParams(search_params);
+
+    std::thread([state, search_ndt_ptr, pose = poses[i], i, evaluate]() {
+      Result result = evaluate(*search_ndt_ptr, pose);
+      std::lock_guard<std::mutex> lock(state->mutex);
+      state->results[i] = std::move(result);
+      state->is_finished[i] = true;
+      ++state->finished_num;
+      state->finished.notify_one();
+    }).detach();
+  }
+
+  std::unique_lock<std::mutex> lock(state->mutex);
+  const auto all_finished = [&]() { return state->finished_num == poses.size(); };
+  if (time_budget_ms > 0.0) {
+    state->finished.wait_until(lock, deadline, all_finished);
+  } else {
+    state->finished.wait(lock, all_finished);
+  }
+
+  std::vector<size_t> indices;
+  std::vector<Result> results;
+  for (size_t i = 0; i < poses.size(); ++i) {
+    if (state->is_finished[i]) {
+      indices.push_back(i);
+      results.push_back(state->results[i]);
+    }
+  }
+  return {indices, results};
+}
+}  // namespace
+
 ResultOfMultiNdtCovarianceEstimation estimate_xy_covariance_by_multi_ndt(
   const NdtResult & ndt_result,
   const std::shared_ptr<
     pclomp::MultiGridNormalDistributionsTransform<pcl::PointXYZ, pcl::PointXYZ>> & ndt_ptr,
-  const std::vector<Eigen::Matrix4f> & poses_to_search)
+  const std::vector<Eigen::Matrix4f> & poses_to_search, const double time_budget_ms)
 {
   // initialize by the main result
   const Eigen::Vector2d ndt_pose_2d(ndt_result.pose(0, 3), ndt_result.pose(1, 3));
   std::vector<Eigen::Vector2d> ndt_pose_2d_vec{ndt_pose_2d};
 
   // multiple searches
-  std::vector<NdtResult> ndt_results;
-  for (const Eigen::Matrix4f & curr_pose : poses_to_search) {
-    auto sub_output_cloud = std::make_shared<pcl::PointCloud<pcl::PointXYZ>>();
-    ndt_ptr->align(*sub_output_cloud, curr_pose);
-    const NdtResult sub_ndt_result = ndt_ptr->getResult();
-    ndt_results.push_back(sub_ndt_result);
+  const auto [indices, ndt_results] = evaluate_poses_in_parallel<NdtResult>(
+    ndt_ptr, poses_to_search, time_budget_ms,
+    [](NdtType & ndt, const Eigen::Matrix4f & curr_pose) {
+      pcl::PointCloud<pcl::PointXYZ> sub_output_cloud;
+      ndt.align(sub_output_cloud, curr_pose);
+      return ndt.getResult();
+    });
 
-    const Eigen::Matrix4f sub_ndt_pose = sub_ndt_result.pose;
+  std::vector<Eigen::Matrix4f> ndt_initial_poses;
+  for (size_t i = 0; i < indices.size(); ++i) {
+    ndt_initial_poses.push_back(poses_to_search[indices[i]]);
+    const Eigen::Matrix4f sub_ndt_pose = ndt_results[i].pose;
     const Eigen::Vector2d sub_ndt_pose_2d = sub_ndt_pose.topRightCorner<2, 1>().cast<double>();
     ndt_pose_2d_vec.emplace_back(sub_ndt_pose_2d);
   }
@@ -65,37 +150,43 @@ ResultOfMultiNdtCovarianceEstimation estimate_xy_covariance_by_multi_ndt(
   // unbiased covariance
   covariance *= static_cast<double>(n - 1) / n;
 
-  return {mean, covariance, poses_to_search, ndt_results};
+  return {mean, covariance, ndt_initial_poses, ndt_results};
 }
 
 ResultOfMultiNdtCovarianceEstimation estimate_xy_covariance_by_multi_ndt_score(
   const NdtResult & ndt_result,
   const std::shared_ptr<
     pclomp::MultiGridNormalDistributionsTransform<pcl::PointXYZ, pcl::PointXYZ>> & ndt_ptr,
-  const std::vector<Eigen::Matrix4f> & poses_to_search, const double temperature)
+  const std::vector<Eigen::Matrix4f> & poses_to_search, const double temperature,
+  const double time_budget_ms)
 {
   // initialize by the main result
   const Eigen::Vector2d ndt_pose_2d(ndt_result.pose(0, 3), ndt_result.pose(1, 3));
   std::vector<Eigen::Vector2d> ndt_pose_2d_vec{ndt_pose_2d};
   std::vector<double> score_vec{ndt_result.nearest_voxel_transformation_likelihood};
 
-  const pcl::PointCloud<pcl::PointXYZ>::ConstPtr input_cloud = ndt_ptr->getInputCloud();
-  pcl::PointCloud<pcl::PointXYZ> trans_cloud;
-
   // multiple searches
+  const auto [indices, nvtl_vec] = evaluate_poses_in_parallel<double>(
+    ndt_ptr, poses_to_search, time_budget_ms,
+    [](NdtType & ndt, const Eigen::Matrix4f & curr_pose) {
+      pcl::PointCloud<pcl::PointXYZ> trans_cloud;
+      transformPointCloud(*ndt.getInputCloud(), trans_cloud, curr_pose);
+      return ndt.calculateNearestVoxelTransformationLikelihood(trans_cloud);
+    });
+
+  std::vector<Eigen::Matrix4f> ndt_initial_poses;
   std::vector<NdtResult> ndt_results;
-  for (const Eigen::Matrix4f & curr_pose : poses_to_search) {
+  for (size_t i = 0; i < indices.size(); ++i) {
+    const Eigen::Matrix4f & curr_pose = poses_to_search[indices[i]];
+    ndt_initial_poses.push_back(curr_pose);
     const Eigen::Vector2d sub_ndt_pose_2d = curr_pose.topRightCorner<2, 1>().cast<double>();
     ndt_pose_2d_vec.emplace_back(sub_ndt_pose_2d);
-
-    transformPointCloud(*input_cloud, trans_cloud, curr_pose);
-    const double nvtl = ndt_ptr->calculateNearestVoxelTransformationLikelihood(trans_cloud);
-    score_vec.emplace_back(nvtl);
+    score_vec.emplace_back(nvtl_vec[i]);
 
     NdtResult sub_ndt_result{};
     sub_ndt_result.pose = curr_pose;
     sub_ndt_result.iteration_num = 0;
-    sub_ndt_result.nearest_voxel_transformation_likelihood = static_cast<float>(nvtl);
+    sub_ndt_result.nearest_voxel_transformation_likelihood = static_cast<float>(nvtl_vec[i]);
     ndt_results.push_back(sub_ndt_result);
   }
 
@@ -104,7 +195,7 @@ ResultOfMultiNdtCovarianceEstimation estimate_xy_covariance_by_multi_ndt_score(
 
   // calculate mean and covariance
   const auto [mean, covariance] = calculate_weighted_mean_and_cov(ndt_pose_2d_vec, weight_vec);
-  return {mean, covariance, poses_to_search, ndt_results};
+  return {mean, covariance, ndt_initial_poses, ndt_results};
 }
 
 std::vector<Eigen::Matrix4f> propose_poses_to_search(
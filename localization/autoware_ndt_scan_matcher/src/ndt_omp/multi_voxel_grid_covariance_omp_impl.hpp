@@ -58,6 +58,8 @@
 #include <pcl/common/common.h>
 #include <pcl/filters/boost.h>
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
 #include <map>
 #include <string>
@@ -72,19 +74,12 @@ MultiVoxelGridCovariance<PointT>::MultiVoxelGridCovariance(const MultiVoxelGridC
 : pcl::VoxelGrid<PointT>(other),
   sid_to_iid_(other.sid_to_iid_),
   grid_list_(other.grid_list_),
-  kdtree_(other.kdtree_),
-  leaf_ptrs_(other.leaf_ptrs_)
+  searchable_grid_list_(other.searchable_grid_list_)
 {
   min_points_per_voxel_ = other.min_points_per_voxel_;
   min_covar_eigvalue_mult_ = other.min_covar_eigvalue_mult_;
 
-  // Deep copy
-  voxel_centroids_ptr_.reset(new PointCloud);
-
-  if (other.voxel_centroids_ptr_) {
-    *voxel_centroids_ptr_ = *other.voxel_centroids_ptr_;
-  }
-
+  // The grids are not modified once built, so that the copies share them
   setThreadNum(other.thread_num_);
   last_check_tid_ = -1;
 }
@@ -93,11 +88,9 @@ template <typename PointT>
 MultiVoxelGridCovariance<PointT>::MultiVoxelGridCovariance(
   MultiVoxelGridCovariance && other) noexcept
 : pcl::VoxelGrid<PointT>(std::move(other)),
-  voxel_centroids_ptr_(std::move(other.voxel_centroids_ptr_)),
   sid_to_iid_(std::move(other.sid_to_iid_)),
   grid_list_(std::move(other.grid_list_)),
-  kdtree_(std::move(other.kdtree_)),
-  leaf_ptrs_(std::move(other.leaf_ptrs_))
+  searchable_grid_list_(std::move(other.searchable_grid_list_))
 {
   min_points_per_voxel_ = other.min_points_per_voxel_;
   min_covar_eigvalue_mult_ = other.min_covar_eigvalue_mult_;
@@ -111,21 +104,12 @@ MultiVoxelGridCovariance<PointT> & pclomp::MultiVoxelGridCovariance<PointT>::ope
   const MultiVoxelGridCovariance & other)
 {
   pcl::VoxelGrid<PointT>::operator=(other);
-  voxel_centroids_ptr_ = other.voxel_centroids_ptr_;
   sid_to_iid_ = other.sid_to_iid_;
   grid_list_ = other.grid_list_;
-  kdtree_ = other.kdtree_;
-  leaf_ptrs_ = other.leaf_ptrs_;
+  searchable_grid_list_ = other.searchable_grid_list_;
   min_points_per_voxel_ = other.min_points_per_voxel_;
   min_covar_eigvalue_mult_ = other.min_covar_eigvalue_mult_;
 
-  // Deep copy
-  voxel_centroids_ptr_.reset(new PointCloud);
-
-  if (other.voxel_centroids_ptr_) {
-    *voxel_centroids_ptr_ = *other.voxel_centroids_ptr_;
-  }
-
   setThreadNum(other.thread_num_);
   last_check_tid_ = -1;
 
@@ -136,11 +120,9 @@ template <typename PointT>
 MultiVoxelGridCovariance<PointT> & pclomp::MultiVoxelGridCovariance<PointT>::operator=(
   MultiVoxelGridCovariance && other) noexcept
 {
-  voxel_centroids_ptr_ = std::move(other.voxel_centroids_ptr_);
   sid_to_iid_ = std::move(other.sid_to_iid_);
   grid_list_ = std::move(other.grid_list_);
-  kdtree_ = std::move(other.kdtree_);
-  leaf_ptrs_ = std::move(other.leaf_ptrs_);
+  searchable_grid_list_ = std::move(other.searchable_grid_list_);
 
   min_points_per_voxel_ = other.min_points_per_voxel_;
   min_covar_eigvalue_mult_ = other.min_covar_eigvalue_mult_;
@@ -178,6 +160,79 @@ void MultiVoxelGridCovariance<PointT>::setInputCloudAndFilter(
   }
 }
 
+template <typename PointT>
+bool MultiVoxelGridCovariance<PointT>::setInputLeavesFromFile(
+  const std::string & path, const std::string & grid_id)
+{
+  NdtLeafMap leaf_map;
+  if (!leaf_map.open(path)) {
+    return false;
+  }
+
+  const NdtLeafMapHeader & header = leaf_map.header();
+  if (
+    std::abs(header.resolution - leaf_size_[0]) > 1e-6f ||
+    header.min_points_per_voxel != min_points_per_voxel_ ||
+    header.min_covar_eigvalue_mult != min_covar_eigvalue_mult_) {
+    return false;
+  }
+
+  GridNodePtr new_grid(new GridNodeType);
+  new_grid->leaves.resize(leaf_map.size());
+  const NdtLeafRecord * records = leaf_map.records();
+  for (size_t i = 0; i < leaf_map.size(); ++i) {
+    const NdtLeafRecord & record = records[i];
+    Leaf & leaf = new_grid->leaves[i];
+    leaf.nr_points_ = record.nr_points;
+    leaf.mean_ = Eigen::Vector3d(record.mean[0], record.mean[1], record.mean[2]);
+    leaf.centroid_ =
+      Eigen::Vector4f(record.centroid[0], record.centroid[1], record.centroid[2], 0.0f);
+    const double * ic = record.inverse_cov;
+    leaf.icov_ << ic[0], ic[1], ic[2], ic[1], ic[3], ic[4], ic[2], ic[4], ic[5];
+    if (leaf.nr_points_ > 0) {
+      leaf.cov_ = leaf.icov_.inverse();
+    }
+  }
+  buildGridIndex(*new_grid);
+
+  grid_list_.push_back(new_grid);
+  sid_to_iid_[grid_id] = grid_list_.size() - 1;
+
+  return true;
+}
+
+template <typename PointT>
+bool MultiVoxelGridCovariance<PointT>::saveLeaves(
+  const std::string & grid_id, const std::string & path) const
+{
+  const auto iid = sid_to_iid_.find(grid_id);
+  if (iid == sid_to_iid_.end() || !grid_list_[iid->second]) {
+    return false;
+  }
+
+  const GridNodeType & grid = *grid_list_[iid->second];
+  std::vector<NdtLeafRecord> records(grid.leaves.size());
+  for (size_t i = 0; i < grid.leaves.size(); ++i) {
+    const Leaf & leaf = grid.leaves[i];
+    NdtLeafRecord & record = records[i];
+    record.nr_points = leaf.nr_points_;
+    for (int j = 0; j < 3; ++j) {
+      record.mean[j] = leaf.mean_[j];
+      record.centroid[j] = leaf.centroid_[j];
+    }
+    const Eigen::Matrix3d & icov = leaf.icov_;
+    const double inverse_cov[6] = {icov(0, 0), icov(0, 1), icov(0, 2),
+                                   icov(1, 1), icov(1, 2), icov(2, 2)};
+    std::copy(std::begin(inverse_cov), std::end(inverse_cov), record.inverse_cov);
+  }
+
+  NdtLeafMapHeader header{};
+  header.resolution = leaf_size_[0];
+  header.min_points_per_voxel = min_points_per_voxel_;
+  header.min_covar_eigvalue_mult = min_covar_eigvalue_mult_;
+  return saveNdtLeafMap(path, header, records);
+}
+
 template <typename PointT>
 void MultiVoxelGridCovariance<PointT>::removeCloud(const std::string & grid_id)
 {
@@ -203,7 +258,6 @@ void MultiVoxelGridCovariance<PointT>::createKdtree()
   const int new_grid_num = sid_to_iid_.size();
   std::vector<GridNodePtr> new_grid_list(new_grid_num);
   int new_pos = 0;
-  int total_leaf_num = 0;
 
   for (auto & it : sid_to_iid_) {
     int & old_pos = it.second;
@@ -212,33 +266,18 @@ void MultiVoxelGridCovariance<PointT>::createKdtree()
     new_grid_list[new_pos] = grid_ptr;
     old_pos = new_pos;
     ++new_pos;
-    total_leaf_num = grid_ptr->size();
   }
 
   grid_list_ = std::move(new_grid_list);
 
-  // Rebuild the voxel_centroids_ptr_
-  voxel_centroids_ptr_.reset(new PointCloud);
-  voxel_centroids_ptr_->reserve(total_leaf_num);
-  leaf_ptrs_.clear();
-  leaf_ptrs_.reserve(total_leaf_num);
-
+  // The search indices of each grid are already built, only the list of grids is updated
+  searchable_grid_list_.clear();
+  searchable_grid_list_.reserve(grid_list_.size());
   for (const auto & grid_ptr : grid_list_) {
-    for (const auto & leaf : *grid_ptr) {
-      PointT new_leaf;
-
-      new_leaf.x = leaf.centroid_[0];
-      new_leaf.y = leaf.centroid_[1];
-      new_leaf.z = leaf.centroid_[2];
-      voxel_centroids_ptr_->push_back(new_leaf);
-      leaf_ptrs_.push_back(&leaf);
+    if (!grid_ptr->leaves.empty()) {
+      searchable_grid_list_.push_back(grid_ptr);
     }
   }
-
-  // Rebuild the kdtree_ of leaves
-  if (voxel_centroids_ptr_->size() > 0) {
-    kdtree_.setInputCloud(voxel_centroids_ptr_);
-  }
 }
 
 template <typename PointT>
@@ -248,19 +287,39 @@ int MultiVoxelGridCovariance<PointT>::radiusSearch(
 {
   k_leaves.clear();
 
-  // Search from the kdtree to find neighbors of @point
+  // Search from the kdtree of each grid near @point
   std::vector<float> k_sqr_distances;
   std::vector<int> k_indices;
-  const int k = kdtree_.radiusSearch(point, radius, k_indices, k_sqr_distances, max_nn);
+  std::vector<std::pair<float, LeafConstPtr>> sorted_leaves;
+  const Eigen::Vector3f query(point.x, point.y, point.z);
+  const auto margin = Eigen::Vector3f::Constant(static_cast<float>(radius));
+
+  for (const auto & grid_ptr : searchable_grid_list_) {
+    const GridNodeType & grid = *grid_ptr;
+    if (
+      (query.array() < (grid.min_centroid - margin).array()).any() ||
+      (query.array() > (grid.max_centroid + margin).array()).any()) {
+      continue;
+    }
 
-  if (k <= 0) {
-    return 0;
+    const int k = grid.kdtree.radiusSearch(point, radius, k_indices, k_sqr_distances, max_nn);
+    for (int i = 0; i < k; ++i) {
+      k_leaves.push_back(&grid.leaves[k_indices[i]]);
+      if (max_nn > 0) {
+        sorted_leaves.emplace_back(k_sqr_distances[i], k_leaves.back());
+      }
+    }
   }
 
-  k_leaves.reserve(k);
-
-  for (auto & nn_idx : k_indices) {
-    k_leaves.push_back(leaf_ptrs_[nn_idx]);
+  // Keep the max_nn nearest leaves of all grids
+  if (max_nn > 0 && k_leaves.size() > max_nn) {
+    std::partial_sort(
+      sorted_leaves.begin(), sorted_leaves.begin() + max_nn, sorted_leaves.end(),
+      [](const auto & a, const auto & b) { return a.first < b.first; });
+    for (unsigned int i = 0; i < max_nn; ++i) {
+      k_leaves[i] = sorted_leaves[i].second;
+    }
+    k_leaves.resize(max_nn);
   }
 
   return k_leaves.size();
@@ -278,11 +337,79 @@ int MultiVoxelGridCovariance<PointT>::radiusSearch(
   return (radiusSearch(cloud[index], radius, k_leaves, max_nn));
 }
 
+template <typename PointT>
+int MultiVoxelGridCovariance<PointT>::directSearch(
+  const PointT & point, NeighborSearchMethod method, std::vector<LeafConstPtr> & k_leaves) const
+{
+  k_leaves.clear();
+
+  if (!std::isfinite(point.x) || !std::isfinite(point.y) || !std::isfinite(point.z)) {
+    return 0;
+  }
+
+  const Eigen::Vector3i voxel(
+    static_cast<int>(std::floor(point.x * inverse_leaf_size_[0])),
+    static_cast<int>(std::floor(point.y * inverse_leaf_size_[1])),
+    static_cast<int>(std::floor(point.z * inverse_leaf_size_[2])));
+  const int x = voxel.x();
+  const int y = voxel.y();
+  const int z = voxel.z();
+
+  for (const auto & grid_ptr : searchable_grid_list_) {
+    const GridNodeType & grid = *grid_ptr;
+    if (
+      ((voxel.array() + 1) < grid.min_voxel.array()).any() ||
+      ((voxel.array() - 1) > grid.max_voxel.array()).any()) {
+      continue;
+    }
+
+    switch (method) {
+      case DIRECT1:
+        appendVoxelLeaf(grid, x, y, z, k_leaves);
+        break;
+      case DIRECT7:
+        appendVoxelLeaf(grid, x, y, z, k_leaves);
+        appendVoxelLeaf(grid, x - 1, y, z, k_leaves);
+        appendVoxelLeaf(grid, x + 1, y, z, k_leaves);
+        appendVoxelLeaf(grid, x, y - 1, z, k_leaves);
+        appendVoxelLeaf(grid, x, y + 1, z, k_leaves);
+        appendVoxelLeaf(grid, x, y, z - 1, k_leaves);
+        appendVoxelLeaf(grid, x, y, z + 1, k_leaves);
+        break;
+      default:
+        for (int dx = -1; dx <= 1; ++dx) {
+          for (int dy = -1; dy <= 1; ++dy) {
+            for (int dz = -1; dz <= 1; ++dz) {
+              appendVoxelLeaf(grid, x + dx, y + dy, z + dz, k_leaves);
+            }
+          }
+        }
+        break;
+    }
+  }
+
+  return k_leaves.size();
+}
+
+template <typename PointT>
+void MultiVoxelGridCovariance<PointT>::appendVoxelLeaf(
+  const GridNodeType & node, int x, int y, int z, std::vector<LeafConstPtr> & k_leaves)
+{
+  const auto it = node.voxel_leaf_indices.find(getVoxelKey(x, y, z));
+  if (it != node.voxel_leaf_indices.end()) {
+    k_leaves.push_back(&node.leaves[it->second]);
+  }
+}
+
 template <typename PointT>
 typename MultiVoxelGridCovariance<PointT>::PointCloud
 MultiVoxelGridCovariance<PointT>::getVoxelPCD() const
 {
-  return *voxel_centroids_ptr_;
+  PointCloud output;
+  for (const auto & grid_ptr : searchable_grid_list_) {
+    output += *grid_ptr->centroids;
+  }
+  return output;
 }
 
 template <typename PointT>
@@ -299,6 +426,30 @@ std::vector<std::string> MultiVoxelGridCovariance<PointT>::getCurrentMapIDs() co
   return output;
 }
 
+template <typename PointT>
+std::map<std::string, size_t> MultiVoxelGridCovariance<PointT>::getMapMemoryUsage() const
+{
+  std::map<std::string, size_t> output;
+
+  for (const auto & element : sid_to_iid_) {
+    const auto & node = grid_list_[element.second];
+    if (!node) {
+      continue;
+    }
+    // the kdtree holds an index and a copy of the coordinates per centroid, and the nodes of the
+    // voxel table hold their key, value and next pointer
+    const size_t centroid_num = node->centroids ? node->centroids->size() : 0;
+    output[element.first] =
+      sizeof(GridNodeType) + node->leaves.capacity() * sizeof(Leaf) +
+      centroid_num * (2 * sizeof(PointT) + sizeof(int)) +
+      node->voxel_leaf_indices.size() *
+        (sizeof(std::pair<const int64_t, uint32_t>) + sizeof(void *)) +
+      node->voxel_leaf_indices.bucket_count() * sizeof(void *);
+  }
+
+  return output;
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////
 template <typename PointT>
 void MultiVoxelGridCovariance<PointT>::apply_filter(
@@ -341,7 +492,7 @@ void MultiVoxelGridCovariance<PointT>::apply_filter(
   div_b[3] = 0;
 
   // Clear the leaves
-  node.clear();
+  node.leaves.clear();
 
   // Set up the division multiplier
   bbox.div_mul = Eigen::Vector4i(1, div_b[0], div_b[0] * div_b[1], 0);
@@ -366,7 +517,7 @@ void MultiVoxelGridCovariance<PointT>::apply_filter(
   Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> eigensolver;
   Eigen::Vector3d pt_sum;
 
-  node.reserve(map_leaves.size());
+  node.leaves.reserve(map_leaves.size());
 
   // Eigen values less than a threshold of max eigen value are inflated to a set fraction of the max
   // eigen value.
@@ -377,10 +528,10 @@ void MultiVoxelGridCovariance<PointT>::apply_filter(
     }
 
     // Append qualified leaves to the end of the output vector
-    node.push_back(it.second);
+    node.leaves.push_back(it.second);
 
     // Normalize the centroid
-    Leaf & leaf = node.back();
+    Leaf & leaf = node.leaves.back();
 
     // Normalize the centroid
     leaf.centroid_ /= static_cast<float>(leaf.nr_points_);
@@ -391,6 +542,46 @@ void MultiVoxelGridCovariance<PointT>::apply_filter(
     // Compute covariance matrices
     computeLeafParams(pt_sum, eigensolver, leaf);
   }
+
+  buildGridIndex(node);
+}
+
+template <typename PointT>
+void MultiVoxelGridCovariance<PointT>::buildGridIndex(GridNodeType & node) const
+{
+  node.centroids.reset(new PointCloud);
+  node.centroids->reserve(node.leaves.size());
+  node.voxel_leaf_indices.clear();
+  node.voxel_leaf_indices.reserve(node.leaves.size());
+  node.min_centroid.setConstant(std::numeric_limits<float>::max());
+  node.max_centroid.setConstant(std::numeric_limits<float>::lowest());
+  node.min_voxel.setConstant(std::numeric_limits<int>::max());
+  node.max_voxel.setConstant(std::numeric_limits<int>::lowest());
+
+  for (size_t i = 0; i < node.leaves.size(); ++i) {
+    const Eigen::Vector3f centroid = node.leaves[i].centroid_.template head<3>();
+    PointT new_leaf;
+    new_leaf.x = centroid[0];
+    new_leaf.y = centroid[1];
+    new_leaf.z = centroid[2];
+    node.centroids->push_back(new_leaf);
+    node.min_centroid = node.min_centroid.cwiseMin(centroid);
+    node.max_centroid = node.max_centroid.cwiseMax(centroid);
+
+    // The voxel of a leaf is the one of its centroid
+    const Eigen::Vector3i voxel(
+      static_cast<int>(std::floor(centroid[0] * inverse_leaf_size_[0])),
+      static_cast<int>(std::floor(centroid[1] * inverse_leaf_size_[1])),
+      static_cast<int>(std::floor(centroid[2] * inverse_leaf_size_[2])));
+    node.voxel_leaf_indices.emplace(
+      getVoxelKey(voxel.x(), voxel.y(), voxel.z()), static_cast<uint32_t>(i));
+    node.min_voxel = node.min_voxel.cwiseMin(voxel);
+    node.max_voxel = node.max_voxel.cwiseMax(voxel);
+  }
+
+  if (!node.centroids->empty()) {
+    node.kdtree.setInputCloud(node.centroids);
+  }
 }
 
 template <typename PointT>
@@ -59,7 +59,14 @@
 
 #include <autoware/ndt_scan_matcher/ndt_omp/multigrid_ndt_omp.h>
 
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
 #include <algorithm>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -77,7 +84,7 @@ MultiGridNormalDistributionsTransform<PointSource, PointTarget>::
   gauss_d2_ = other.gauss_d2_;
   gauss_d3_ = other.gauss_d3_;
   trans_probability_ = other.trans_probability_;
-  // No need to copy j_ang_ and h_ang_, as those matrices are re-computed on every
+  // No need to copy j_ang_, h_ang_ and thread_buffers_, as those are re-computed on every
   // computeDerivatives() call
 
   hessian_ = other.hessian_;
@@ -191,7 +198,7 @@ MultiGridNormalDistributionsTransform<
   params_.step_size = 0.1;
   params_.resolution = 1.0f;
   params_.max_iterations = 35;
-  params_.search_method = KDTREE;  // Only KDTREE is supported in multigrid_ndt_omp
+  params_.search_method = KDTREE;
   params_.num_threads = omp_get_max_threads();
   params_.regularization_scale_factor = 0.0f;
   params_.use_line_search = false;
@@ -212,6 +219,9 @@ void MultiGridNormalDistributionsTransform<PointSource, PointTarget>::computeTra
   nr_iterations_ = 0;
   converged_ = false;
 
+  bindThreads();
+  initThreadBuffers();
+
   // Initializes the gaussian fitting parameters (eq. 6.8) [Magnusson 2009]
   double gauss_c1 = 10 * (1 - outlier_ratio_);
   double gauss_c2 = outlier_ratio_ / pow(params_.resolution, 3);
@@ -255,9 +265,35 @@ void MultiGridNormalDistributionsTransform<PointSource, PointTarget>::computeTra
     regularization_pose_translation_ = regularization_pose_transformation.translation();
   }
 
+  // Coarse-to-fine: the first coarse_iterations iterations run on every coarse_stride-th point, as
+  // the input and its transformed cloud, and the others and the final score on the full input
+  const PointCloudSourceConstPtr full_input = input_;
+  PointCloudSource coarse_output;
+  PointCloudSource * trans_cloud = &output;
+  bool coarse_stage = params_.coarse_stride > 1 && params_.coarse_iterations > 0 &&
+                      input_->size() > static_cast<size_t>(params_.coarse_stride);
+  if (coarse_stage) {
+    PointCloudSourcePtr coarse_input(new PointCloudSource);
+    for (size_t idx = 0; idx < full_input->size(); idx += params_.coarse_stride) {
+      coarse_input->push_back((*full_input)[idx]);
+      coarse_output.push_back(output[idx]);
+    }
+    input_ = coarse_input;
+    trans_cloud = &coarse_output;
+  }
+
   // Calculate derivatives of initial transform vector, subsequent derivative calculations are done
   // in the step length determination.
-  score = computeDerivatives(score_gradient, hessian, output, p);
+  score = computeDerivatives(score_gradient, hessian, *trans_cloud, p);
+
+  // Switch to the full input at the current transformation
+  const auto end_coarse_stage = [&]() {
+    input_ = full_input;
+    transformPointCloud(*input_, output, final_transformation_);
+    trans_cloud = &output;
+    coarse_stage = false;
+    score = computeDerivatives(score_gradient, hessian, output, p);
+  };
 
   while (!converged_) {
     // Store previous transformation
@@ -273,6 +309,14 @@ void MultiGridNormalDistributionsTransform<PointSource, PointTarget>::computeTra
     double delta_p_norm = delta_p.norm();
 
     if (delta_p_norm == 0 || delta_p_norm != delta_p_norm) {
+      if (coarse_stage) {
+        end_coarse_stage();
+        // A stationary point of the coarse score is refined on the full input
+        if (delta_p_norm == 0) {
+          continue;
+        }
+      }
+
       if (input_->empty()) {
         trans_probability_ = 0.0f;
       } else {
@@ -286,7 +330,7 @@ void MultiGridNormalDistributionsTransform<PointSource, PointTarget>::computeTra
     delta_p.normalize();
     delta_p_norm = computeStepLengthMT(
       p, delta_p, delta_p_norm, params_.step_size, params_.trans_epsilon / 2.0, score,
-      score_gradient, hessian, output);
+      score_gradient, hessian, *trans_cloud);
     delta_p *= delta_p_norm;
 
     transformation_ =
@@ -304,11 +348,17 @@ void MultiGridNormalDistributionsTransform<PointSource, PointTarget>::computeTra
 
     // Update Visualizer (untested)
     if (update_visualizer_ != 0)
-      update_visualizer_(output, std::vector<int>(), *target_, std::vector<int>());
+      update_visualizer_(*trans_cloud, std::vector<int>(), *target_, std::vector<int>());
 
     nr_iterations_++;
 
     if (
+      coarse_stage && (nr_iterations_ >= params_.coarse_iterations ||
+                       std::fabs(delta_p_norm) < params_.trans_epsilon)) {
+      // The convergence is only decided on the full input
+      end_coarse_stage();
+      converged_ = nr_iterations_ >= params_.max_iterations;
+    } else if (
       nr_iterations_ >= params_.max_iterations ||
       (nr_iterations_ && (std::fabs(delta_p_norm) < params_.trans_epsilon))) {
       converged_ = true;
@@ -337,6 +387,59 @@ int omp_get_thread_num()
 }
 #endif
 
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <typename PointSource, typename PointTarget>
+void MultiGridNormalDistributionsTransform<PointSource, PointTarget>::bindThreads() const
+{
+  // libgomp keeps the threads of the team of each calling thread between the parallel regions, in
+  // the same order, so that the binding stays until the number of threads changes
+  static thread_local std::tuple<int, int, int> bound_params{0, -1, 0};
+  const std::tuple<int, int, int> params{
+    params_.num_threads, params_.first_cpu, params_.thread_nice};
+  if (params == bound_params) {
+    return;
+  }
+  // Only the settings that are or were applied are touched, to keep the ones of the process
+  const bool set_affinity = params_.first_cpu >= 0 || std::get<1>(bound_params) >= 0;
+  const bool set_nice = params_.thread_nice != 0 || std::get<2>(bound_params) != 0;
+  bound_params = params;
+  if (!set_affinity && !set_nice) {
+    return;
+  }
+
+  const int cpu_num = static_cast<int>(sysconf(_SC_NPROCESSORS_CONF));
+#pragma omp parallel num_threads(params_.num_threads)
+  {
+    // Failures, e.g. a CPU out of the cpuset of the process or a nice value below the limit of the
+    // user, leave the thread as it was
+    if (set_affinity) {
+      cpu_set_t cpu_set;
+      CPU_ZERO(&cpu_set);
+      if (params_.first_cpu >= 0) {
+        CPU_SET((params_.first_cpu + omp_get_thread_num()) % cpu_num, &cpu_set);
+      } else {
+        for (int cpu = 0; cpu < cpu_num; ++cpu) {
+          CPU_SET(cpu, &cpu_set);
+        }
+      }
+      pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+    }
+    if (set_nice) {
+      // On Linux, the nice value of PRIO_PROCESS with a thread id applies to that thread only
+      setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), params_.thread_nice);
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <typename PointSource, typename PointTarget>
+void MultiGridNormalDistributionsTransform<PointSource, PointTarget>::initThreadBuffers()
+{
+  if (thread_buffers_.size() != static_cast<size_t>(params_.num_threads)) {
+    thread_buffers_.resize(params_.num_threads);
+  }
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 template <typename PointSource, typename PointTarget>
 double MultiGridNormalDistributionsTransform<PointSource, PointTarget>::computeDerivatives(
@@ -351,31 +454,22 @@ double MultiGridNormalDistributionsTransform<PointSource, PointTarget>::computeD
   double nearest_voxel_score = 0;
   size_t found_neighborhood_voxel_num = 0;
 
-  std::vector<double> scores(params_.num_threads);
-  std::vector<double> nearest_voxel_scores(params_.num_threads);
-  std::vector<size_t> found_neighborhood_voxel_nums(params_.num_threads);
-  std::vector<Eigen::Matrix<double, 6, 1>, Eigen::aligned_allocator<Eigen::Matrix<double, 6, 1>>>
-    score_gradients(params_.num_threads);
-  std::vector<Eigen::Matrix<double, 6, 6>, Eigen::aligned_allocator<Eigen::Matrix<double, 6, 6>>>
-    hessians(params_.num_threads);
-  std::vector<int> neighborhood_counts(params_.num_threads);
-
-  // Pre-allocate thread-wise point derivative matrices to avoid reallocate too many times
-  std::vector<Eigen::Matrix<double, 4, 6>> t_point_gradients(params_.num_threads);
-  std::vector<Eigen::Matrix<double, 24, 6>> t_point_hessians(params_.num_threads);
-
-  for (int i = 0; i < params_.num_threads; ++i) {
-    scores[i] = 0;
-    nearest_voxel_scores[i] = 0;
-    found_neighborhood_voxel_nums[i] = 0;
-    score_gradients[i].setZero();
-    hessians[i].setZero();
-    neighborhood_counts[i] = 0;
+  // The thread-wise accumulators are allocated once by initThreadBuffers(), and only reset here
+  for (auto & buffer : thread_buffers_) {
+    buffer.score = 0;
+    buffer.nearest_voxel_score = 0;
+    buffer.found_neighborhood_voxel_num = 0;
+    buffer.score_gradient.setZero();
+    buffer.hessian.setZero();
+    buffer.neighborhood_count = 0;
 
     // Initialize point derivatives
-    t_point_gradients[i].setZero();
-    t_point_gradients[i].block<3, 3>(0, 0).setIdentity();
-    t_point_hessians[i].setZero();
+    buffer.point_gradient.setZero();
+    buffer.point_gradient.block<3, 3>(0, 0).setIdentity();
+    buffer.point_hessian.setZero();
+    buffer.point_gradient_float.setZero();
+    buffer.point_gradient_float.block<3, 3>(0, 0).setIdentity();
+    buffer.point_hessian_float.setZero();
   }
 
   // Precompute Angular Derivatives (eq. 6.19 and 6.21)[Magnusson 2009]
@@ -384,13 +478,11 @@ double MultiGridNormalDistributionsTransform<PointSource, PointTarget>::computeD
   // Update gradient and hessian for each point, line 17 in Algorithm 2 [Magnusson 2009]
 #pragma omp parallel for num_threads(params_.num_threads) schedule(guided, 8)
   for (size_t idx = 0; idx < input_->size(); ++idx) {
-    int tid = omp_get_thread_num();
+    auto & buffer = thread_buffers_[omp_get_thread_num()];
     // Searching for neighbors of the current transformed point
     auto & x_trans_pt = trans_cloud[idx];
-    std::vector<TargetGridLeafConstPtr> neighborhood;
-
-    // Neighborhood search method other than kdtree is disabled in multigrid_ndt_omp
-    target_cells_.radiusSearch(x_trans_pt, params_.resolution, neighborhood);
+    auto & neighborhood = buffer.neighborhood;
+    searchNeighborhood(x_trans_pt, neighborhood);
 
     if (neighborhood.empty()) {
       continue;
@@ -398,52 +490,84 @@ double MultiGridNormalDistributionsTransform<PointSource, PointTarget>::computeD
 
     // Original Point
     auto & x_pt = (*input_)[idx];
-    // Original Point and Transformed Point (for math)
-    Eigen::Vector3d x(x_pt.x, x_pt.y, x_pt.z);
-    // Current Point Gradient and Hessian
-    auto & point_gradient = t_point_gradients[tid];
-    auto & point_hessian = t_point_hessians[tid];
-
-    // Compute derivative of transform function w.r.t. transform vector, J_E and H_E in
-    // Equations 6.18 and 6.20 [Magnusson 2009]
-    computePointDerivatives(x, point_gradient, point_hessian);
 
     // Denorm point, x_k' in Equations 6.12 and 6.13 [Magnusson 2009]
     const Eigen::Vector3d x_trans(x_trans_pt.x, x_trans_pt.y, x_trans_pt.z);
 
     double sum_score_pt = 0;
     double nearest_voxel_score_pt = 0;
-    auto & score_gradient_pt = score_gradients[tid];
-    auto & hessian_pt = hessians[tid];
 
-    for (auto & cell : neighborhood) {
-      // Update score, gradient and hessian, lines 19-21 in Algorithm 2, according to
-      // Equations 6.10, 6.12 and 6.13, respectively [Magnusson 2009]
-      double score_pt = updateDerivatives(
-        score_gradient_pt, hessian_pt, point_gradient, point_hessian, x_trans - cell->getMean(),
-        cell->getInverseCov(), compute_hessian);
-      sum_score_pt += score_pt;
-
-      if (score_pt > nearest_voxel_score_pt) {
-        nearest_voxel_score_pt = score_pt;
+    if (params_.mixed_precision) {
+      // The derivatives of the neighbors of the point are accumulated in float, and the points
+      // are reduced in double into the thread-wise gradient and hessian
+      Eigen::Vector3f x(x_pt.x, x_pt.y, x_pt.z);
+      auto & point_gradient = buffer.point_gradient_float;
+      auto & point_hessian = buffer.point_hessian_float;
+      computePointDerivatives(x, point_gradient, point_hessian);
+
+      Eigen::Matrix<float, 6, 1> score_gradient_pt = Eigen::Matrix<float, 6, 1>::Zero();
+      Eigen::Matrix<float, 6, 6> hessian_pt = Eigen::Matrix<float, 6, 6>::Zero();
+
+      for (auto & cell : neighborhood) {
+        // The difference is taken in double, the map coordinates lose centimeters in float
+        const Eigen::Vector3f x_trans_diff = (x_trans - cell->getMean()).cast<float>();
+        const Eigen::Matrix3f c_inv = cell->getInverseCov().cast<float>();
+        const double score_pt = updateDerivatives(
+          score_gradient_pt, hessian_pt, point_gradient, point_hessian, x_trans_diff, c_inv,
+          compute_hessian);
+        sum_score_pt += score_pt;
+
+        if (score_pt > nearest_voxel_score_pt) {
+          nearest_voxel_score_pt = score_pt;
+        }
+      }
+
+      buffer.score_gradient += score_gradient_pt.cast<double>();
+      buffer.hessian += hessian_pt.cast<double>();
+    } else {
+      // Original Point and Transformed Point (for math)
+      Eigen::Vector3d x(x_pt.x, x_pt.y, x_pt.z);
+      // Current Point Gradient and Hessian
+      auto & point_gradient = buffer.point_gradient;
+      auto & point_hessian = buffer.point_hessian;
+
+      // Compute derivative of transform function w.r.t. transform vector, J_E and H_E in
+      // Equations 6.18 and 6.20 [Magnusson 2009]
+      computePointDerivatives(x, point_gradient, point_hessian);
+
+      auto & score_gradient_pt = buffer.score_gradient;
+      auto & hessian_pt = buffer.hessian;
+
+      for (auto & cell : neighborhood) {
+        // Update score, gradient and hessian, lines 19-21 in Algorithm 2, according to
+        // Equations 6.10, 6.12 and 6.13, respectively [Magnusson 2009]
+        const Eigen::Vector3d x_trans_diff = x_trans - cell->getMean();
+        double score_pt = updateDerivatives(
+          score_gradient_pt, hessian_pt, point_gradient, point_hessian, x_trans_diff,
+          cell->getInverseCov(), compute_hessian);
+        sum_score_pt += score_pt;
+
+        if (score_pt > nearest_voxel_score_pt) {
+          nearest_voxel_score_pt = score_pt;
+        }
       }
     }
 
-    ++found_neighborhood_voxel_nums[tid];
+    ++buffer.found_neighborhood_voxel_num;
 
-    scores[tid] += sum_score_pt;
-    nearest_voxel_scores[tid] += nearest_voxel_score_pt;
-    neighborhood_counts[tid] += neighborhood.size();
+    buffer.score += sum_score_pt;
+    buffer.nearest_voxel_score += nearest_voxel_score_pt;
+    buffer.neighborhood_count += static_cast<int>(neighborhood.size());
   }
 
   // Ensure that the result is invariant against the summing up order
-  for (int i = 0; i < params_.num_threads; ++i) {
-    score += scores[i];
-    nearest_voxel_score += nearest_voxel_scores[i];
-    found_neighborhood_voxel_num += found_neighborhood_voxel_nums[i];
-    score_gradient += score_gradients[i];
-    hessian += hessians[i];
-    total_neighborhood_count += neighborhood_counts[i];
+  for (const auto & buffer : thread_buffers_) {
+    score += buffer.score;
+    nearest_voxel_score += buffer.nearest_voxel_score;
+    found_neighborhood_voxel_num += buffer.found_neighborhood_voxel_num;
+    score_gradient += buffer.score_gradient;
+    hessian += buffer.hessian;
+    total_neighborhood_count += buffer.neighborhood_count;
   }
 
   if (regularization_pose_) {
@@ -571,20 +695,27 @@ void MultiGridNormalDistributionsTransform<PointSource, PointTarget>::computeAng
     h_ang_.row(13) << (-cx * sz - sx * sy * cz), (-cx * cz + sx * sy * sz), 0.0f, 0.0f;  // f2
     h_ang_.row(14) << (-sx * sz + cx * sy * cz), (-cx * sy * sz - sx * cz), 0.0f, 0.0f;  // f3
   }
+
+  if (params_.mixed_precision) {
+    j_ang_float_ = j_ang_.cast<float>();
+    h_ang_float_ = h_ang_.cast<float>();
+  }
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 template <typename PointSource, typename PointTarget>
+template <typename Scalar>
 void MultiGridNormalDistributionsTransform<PointSource, PointTarget>::computePointDerivatives(
-  Eigen::Vector3d & x, Eigen::Matrix<double, 4, 6> & point_gradient,
-  Eigen::Matrix<double, 24, 6> & point_hessian, bool compute_hessian) const
+  Eigen::Matrix<Scalar, 3, 1> & x, Eigen::Matrix<Scalar, 4, 6> & point_gradient,
+  Eigen::Matrix<Scalar, 24, 6> & point_hessian, bool compute_hessian) const
 {
-  Eigen::Vector4d x4(x[0], x[1], x[2], 0.0f);
+  using Vector4 = Eigen::Matrix<Scalar, 4, 1>;
+  Vector4 x4(x[0], x[1], x[2], 0.0f);
 
   // Calculate first derivative of Transformation Equation 6.17 w.r.t. transform vector p.
   // Derivative w.r.t. ith element of transform vector corresponds to column i, Equation 6.18
   // and 6.19 [Magnusson 2009]
-  auto x_j_ang = j_ang_ * x4;
+  auto x_j_ang = angularGradient<Scalar>() * x4;
 
   point_gradient(1, 3) = x_j_ang[0];
   point_gradient(2, 3) = x_j_ang[1];
@@ -596,79 +727,83 @@ void MultiGridNormalDistributionsTransform<PointSource, PointTarget>::computePoi
   point_gradient(2, 5) = x_j_ang[7];
 
   if (compute_hessian) {
-    auto x_h_ang = h_ang_ * x4;
+    auto x_h_ang = angularHessian<Scalar>() * x4;
 
     // Vectors from Equation 6.21 [Magnusson 2009]
-    Eigen::Vector4d a(0.0f, x_h_ang[0], x_h_ang[1], 0.0f);
-    Eigen::Vector4d b(0.0f, x_h_ang[2], x_h_ang[3], 0.0f);
-    Eigen::Vector4d c(0.0f, x_h_ang[4], x_h_ang[5], 0.0f);
-    Eigen::Vector4d d(x_h_ang[6], x_h_ang[7], x_h_ang[8], 0.0f);
-    Eigen::Vector4d e(x_h_ang[9], x_h_ang[10], x_h_ang[11], 0.0f);
-    Eigen::Vector4d f(x_h_ang[12], x_h_ang[13], x_h_ang[14], 0.0f);
+    Vector4 a(0.0f, x_h_ang[0], x_h_ang[1], 0.0f);
+    Vector4 b(0.0f, x_h_ang[2], x_h_ang[3], 0.0f);
+    Vector4 c(0.0f, x_h_ang[4], x_h_ang[5], 0.0f);
+    Vector4 d(x_h_ang[6], x_h_ang[7], x_h_ang[8], 0.0f);
+    Vector4 e(x_h_ang[9], x_h_ang[10], x_h_ang[11], 0.0f);
+    Vector4 f(x_h_ang[12], x_h_ang[13], x_h_ang[14], 0.0f);
 
     // Calculate second derivative of Transformation Equation 6.17 w.r.t. transform vector p.
     // Derivative w.r.t. ith and jth elements of transform vector corresponds to the 3x1 block
     // matrix starting at (3i,j), Equation 6.20 and 6.21 [Magnusson 2009]
-    point_hessian.block<4, 1>(12, 3) = a;
-    point_hessian.block<4, 1>(16, 3) = b;
-    point_hessian.block<4, 1>(20, 3) = c;
-    point_hessian.block<4, 1>(12, 4) = b;
-    point_hessian.block<4, 1>(16, 4) = d;
-    point_hessian.block<4, 1>(20, 4) = e;
-    point_hessian.block<4, 1>(12, 5) = c;
-    point_hessian.block<4, 1>(16, 5) = e;
-    point_hessian.block<4, 1>(20, 5) = f;
+    point_hessian.template block<4, 1>(12, 3) = a;
+    point_hessian.template block<4, 1>(16, 3) = b;
+    point_hessian.template block<4, 1>(20, 3) = c;
+    point_hessian.template block<4, 1>(12, 4) = b;
+    point_hessian.template block<4, 1>(16, 4) = d;
+    point_hessian.template block<4, 1>(20, 4) = e;
+    point_hessian.template block<4, 1>(12, 5) = c;
+    point_hessian.template block<4, 1>(16, 5) = e;
+    point_hessian.template block<4, 1>(20, 5) = f;
   }
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 template <typename PointSource, typename PointTarget>
-double MultiGridNormalDistributionsTransform<PointSource, PointTarget>::updateDerivatives(
-  Eigen::Matrix<double, 6, 1> & score_gradient, Eigen::Matrix<double, 6, 6> & hessian,
-  const Eigen::Matrix<double, 4, 6> & point_gradient,
-  const Eigen::Matrix<double, 24, 6> & point_hessian, const Eigen::Vector3d & x_trans,
-  const Eigen::Matrix3d & c_inv, bool compute_hessian) const
+template <typename Scalar>
+Scalar MultiGridNormalDistributionsTransform<PointSource, PointTarget>::updateDerivatives(
+  Eigen::Matrix<Scalar, 6, 1> & score_gradient, Eigen::Matrix<Scalar, 6, 6> & hessian,
+  const Eigen::Matrix<Scalar, 4, 6> & point_gradient,
+  const Eigen::Matrix<Scalar, 24, 6> & point_hessian, const Eigen::Matrix<Scalar, 3, 1> & x_trans,
+  const Eigen::Matrix<Scalar, 3, 3> & c_inv, bool compute_hessian) const
 {
-  Eigen::Matrix<double, 1, 4> x_trans4(x_trans[0], x_trans[1], x_trans[2], 0.0f);
-  Eigen::Matrix4d c_inv4 = Eigen::Matrix4d::Zero();
+  const auto gauss_d1 = static_cast<Scalar>(gauss_d1_);
+  const auto gauss_d2 = static_cast<Scalar>(gauss_d2_);
+
+  Eigen::Matrix<Scalar, 1, 4> x_trans4(x_trans[0], x_trans[1], x_trans[2], 0.0f);
+  Eigen::Matrix<Scalar, 4, 4> c_inv4 = Eigen::Matrix<Scalar, 4, 4>::Zero();
 
   c_inv4.topLeftCorner(3, 3) = c_inv;
 
   // e^(-d_2/2 * (x_k - mu_k)^T Sigma_k^-1 (x_k - mu_k)) Equation 6.9 [Magnusson 2009]
-  double e_x_cov_x = exp(-gauss_d2_ * x_trans4.dot(x_trans4 * c_inv4) * 0.5f);
+  Scalar e_x_cov_x = std::exp(-gauss_d2 * x_trans4.dot(x_trans4 * c_inv4) * Scalar(0.5));
   // Calculate probability of transformed points existence, Equation 6.9 [Magnusson 2009]
-  double score_inc = -gauss_d1_ * e_x_cov_x;
+  Scalar score_inc = -gauss_d1 * e_x_cov_x;
 
-  e_x_cov_x = gauss_d2_ * e_x_cov_x;
+  e_x_cov_x = gauss_d2 * e_x_cov_x;
 
   // Error checking for invalid values.
   if (e_x_cov_x > 1 || e_x_cov_x < 0 || e_x_cov_x != e_x_cov_x) return (0);
 
   // Reusable portion of Equation 6.12 and 6.13 [Magnusson 2009]
-  e_x_cov_x *= gauss_d1_;
+  e_x_cov_x *= gauss_d1;
 
-  Eigen::Matrix<double, 4, 6> c_inv4_x_point_gradient4 = c_inv4 * point_gradient;
-  Eigen::Matrix<double, 6, 1> x_trans4_dot_c_inv4_x_point_gradient4 =
+  Eigen::Matrix<Scalar, 4, 6> c_inv4_x_point_gradient4 = c_inv4 * point_gradient;
+  Eigen::Matrix<Scalar, 6, 1> x_trans4_dot_c_inv4_x_point_gradient4 =
     x_trans4 * c_inv4_x_point_gradient4;
 
-  score_gradient.noalias() += (e_x_cov_x * x_trans4_dot_c_inv4_x_point_gradient4).cast<double>();
+  score_gradient.noalias() += e_x_cov_x * x_trans4_dot_c_inv4_x_point_gradient4;
 
   if (compute_hessian) {
-    Eigen::Matrix<double, 1, 4> x_trans4_x_c_inv4 = x_trans4 * c_inv4;
-    Eigen::Matrix<double, 6, 6> point_gradient4_colj_dot_c_inv4_x_point_gradient4_col_i =
+    Eigen::Matrix<Scalar, 1, 4> x_trans4_x_c_inv4 = x_trans4 * c_inv4;
+    Eigen::Matrix<Scalar, 6, 6> point_gradient4_colj_dot_c_inv4_x_point_gradient4_col_i =
       point_gradient.transpose() * c_inv4_x_point_gradient4;
-    Eigen::Matrix<double, 6, 1> x_trans4_dot_c_inv4_x_ext_point_hessian_4ij;
+    Eigen::Matrix<Scalar, 6, 1> x_trans4_dot_c_inv4_x_ext_point_hessian_4ij;
 
     for (int i = 0; i < 6; ++i) {
       // Sigma_k^-1 d(T(x,p))/dpi, Reusable portion of Equation 6.12 and 6.13 [Magnusson 2009]
       // Update gradient, Equation 6.12 [Magnusson 2009]
       x_trans4_dot_c_inv4_x_ext_point_hessian_4ij.noalias() =
-        x_trans4_x_c_inv4 * point_hessian.block<4, 6>(i * 4, 0);
+        x_trans4_x_c_inv4 * point_hessian.template block<4, 6>(i * 4, 0);
 
       for (int j = 0; j < hessian.cols(); j++) {
         // Update hessian, Equation 6.13 [Magnusson 2009]
         hessian(i, j) +=
-          e_x_cov_x * (-gauss_d2_ * x_trans4_dot_c_inv4_x_point_gradient4(i) *
+          e_x_cov_x * (-gauss_d2 * x_trans4_dot_c_inv4_x_point_gradient4(i) *
                          x_trans4_dot_c_inv4_x_point_gradient4(j) +
                        x_trans4_dot_c_inv4_x_ext_point_hessian_4ij(j) +
                        point_gradient4_colj_dot_c_inv4_x_point_gradient4_col_i(j, i));
@@ -685,17 +820,12 @@ void MultiGridNormalDistributionsTransform<PointSource, PointTarget>::computeHes
   Eigen::Matrix<double, 6, 6> & hessian, PointCloudSource & trans_cloud,
   Eigen::Matrix<double, 6, 1> &)
 {
-  // Initialize Point Gradient and Hessian
-  // Pre-allocate thread-wise point gradients and point hessians
-  std::vector<Eigen::Matrix<double, 4, 6>> t_point_gradients(params_.num_threads);
-  std::vector<Eigen::Matrix<double, 24, 6>> t_point_hessians(params_.num_threads);
-  std::vector<Eigen::Matrix<double, 6, 6>> t_hessians(params_.num_threads);
-
-  for (int i = 0; i < params_.num_threads; ++i) {
-    t_point_gradients[i].setZero();
-    t_point_gradients[i].block<3, 3>(0, 0).setIdentity();
-    t_point_hessians[i].setZero();
-    t_hessians[i].setZero();
+  // Initialize Point Gradient and Hessian of the thread-wise buffers
+  for (auto & buffer : thread_buffers_) {
+    buffer.point_gradient.setZero();
+    buffer.point_gradient.block<3, 3>(0, 0).setIdentity();
+    buffer.point_hessian.setZero();
+    buffer.hessian.setZero();
   }
 
   hessian.setZero();
@@ -706,14 +836,12 @@ void MultiGridNormalDistributionsTransform<PointSource, PointTarget>::computeHes
   // Update hessian for each point, line 17 in Algorithm 2 [Magnusson 2009]
 #pragma omp parallel for num_threads(params_.num_threads) schedule(guided, 8)
   for (size_t idx = 0; idx < input_->size(); ++idx) {
-    int tid = omp_get_thread_num();
+    auto & buffer = thread_buffers_[omp_get_thread_num()];
     auto & x_trans_pt = trans_cloud[idx];
 
-    // Find neighbors (Radius search has been experimentally faster than direct neighbor checking.
-    std::vector<TargetGridLeafConstPtr> neighborhood;
-
-    // Neighborhood search method other than kdtree is disabled in multigrid_ndt_omp
-    target_cells_.radiusSearch(x_trans_pt, params_.resolution, neighborhood);
+    // Find neighbors
+    auto & neighborhood = buffer.neighborhood;
+    searchNeighborhood(x_trans_pt, neighborhood);
 
     if (neighborhood.empty()) {
       continue;
@@ -724,9 +852,9 @@ void MultiGridNormalDistributionsTransform<PointSource, PointTarget>::computeHes
     Eigen::Vector3d x(x_pt.x, x_pt.y, x_pt.z);
     const Eigen::Vector3d x_trans(x_trans_pt.x, x_trans_pt.y, x_trans_pt.z);
 
-    auto & point_gradient = t_point_gradients[tid];
-    auto & point_hessian = t_point_hessians[tid];
-    auto & tmp_hessian = t_hessians[tid];
+    auto & point_gradient = buffer.point_gradient;
+    auto & point_hessian = buffer.point_hessian;
+    auto & tmp_hessian = buffer.hessian;
 
     // Compute derivative of transform function w.r.t. transform vector, J_E and H_E in
     // Equations 6.18 and 6.20 [Magnusson 2009]
@@ -741,9 +869,9 @@ void MultiGridNormalDistributionsTransform<PointSource, PointTarget>::computeHes
     }
   }
 
-  // Sum over t_hessians
-  for (const auto & th : t_hessians) {
-    hessian += th;
+  // Sum over the thread-wise hessians
+  for (const auto & buffer : thread_buffers_) {
+    hessian += buffer.hessian;
   }
 }
 
@@ -1074,11 +1202,9 @@ MultiGridNormalDistributionsTransform<PointSource, PointTarget>::calculateTransf
     int tid = omp_get_thread_num();
     PointSource x_trans_pt = trans_cloud[idx];
 
-    // Find neighbors (Radius search has been experimentally faster than direct neighbor checking.
+    // Find neighbors
     std::vector<TargetGridLeafConstPtr> neighborhood;
-
-    // Neighborhood search method other than kdtree is disabled in multigrid_ndt_omp
-    target_cells_.radiusSearch(x_trans_pt, params_.resolution, neighborhood);
+    searchNeighborhood(x_trans_pt, neighborhood);
 
     if (neighborhood.empty()) {
       continue;
@@ -1133,11 +1259,9 @@ double MultiGridNormalDistributionsTransform<PointSource, PointTarget>::
     int tid = omp_get_thread_num();
     PointSource x_trans_pt = trans_cloud[idx];
 
-    // Find neighbors (Radius search has been experimentally faster than direct neighbor checking.
+    // Find neighbors
     std::vector<TargetGridLeafConstPtr> neighborhood;
-
-    // Neighborhood search method other than kdtree is disabled in multigrid_ndt_omp
-    target_cells_.radiusSearch(x_trans_pt, params_.resolution, neighborhood);
+    searchNeighborhood(x_trans_pt, neighborhood);
 
     if (neighborhood.empty()) {
       continue;
@@ -1192,11 +1316,9 @@ pcl::PointCloud<pcl::PointXYZI> MultiGridNormalDistributionsTransform<PointSourc
     int tid = omp_get_thread_num();
     PointSource x_trans_pt = trans_cloud[idx];
 
-    // Find neighbors (Radius search has been experimentally faster than direct neighbor checking.
+    // Find neighbors
     std::vector<TargetGridLeafConstPtr> neighborhood;
-
-    // Neighborhood search method other than kdtree is disabled in multigrid_ndt_omp
-    target_cells_.radiusSearch(x_trans_pt, params_.resolution, neighborhood);
+    searchNeighborhood(x_trans_pt, neighborhood);
 
     if (neighborhood.empty()) {
       continue;
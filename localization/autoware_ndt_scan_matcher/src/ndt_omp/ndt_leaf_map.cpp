@@ -0,0 +1,104 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <autoware/ndt_scan_matcher/ndt_omp/ndt_leaf_map.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace pclomp
+{
+
+NdtLeafMap::~NdtLeafMap()
+{
+  close();
+}
+
+bool NdtLeafMap::open(const std::string & path)
+{
+  close();
+
+  const int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+
+  struct stat file_stat;
+  if (
+    ::fstat(fd, &file_stat) != 0 ||
+    static_cast<size_t>(file_stat.st_size) < sizeof(NdtLeafMapHeader)) {
+    ::close(fd);
+    return false;
+  }
+
+  const auto length = static_cast<size_t>(file_stat.st_size);
+  void * data = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+  // The mapping stays valid after the descriptor is closed
+  ::close(fd);
+  if (data == MAP_FAILED) {
+    return false;
+  }
+
+  const auto & header = *static_cast<const NdtLeafMapHeader *>(data);
+  if (
+    std::memcmp(header.magic, ndt_leaf_map_magic, sizeof(header.magic)) != 0 ||
+    header.version != ndt_leaf_map_version ||
+    length != sizeof(NdtLeafMapHeader) + header.leaf_num * sizeof(NdtLeafRecord)) {
+    ::munmap(data, length);
+    return false;
+  }
+
+  // The records are all read right after the mapping
+  ::madvise(data, length, MADV_WILLNEED);
+
+  data_ = data;
+  length_ = length;
+  return true;
+}
+
+void NdtLeafMap::close()
+{
+  if (data_ != nullptr) {
+    ::munmap(data_, length_);
+    data_ = nullptr;
+    length_ = 0;
+  }
+}
+
+bool saveNdtLeafMap(
+  const std::string & path, NdtLeafMapHeader header, const std::vector<NdtLeafRecord> & records)
+{
+  std::memcpy(header.magic, ndt_leaf_map_magic, sizeof(header.magic));
+  header.version = ndt_leaf_map_version;
+  header.leaf_num = static_cast<uint32_t>(records.size());
+
+  std::ofstream ofs(path, std::ios::binary | std::ios::trunc);
+  if (!ofs) {
+    return false;
+  }
+  ofs.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  ofs.write(
+    reinterpret_cast<const char *>(records.data()),
+    static_cast<std::streamsize>(records.size() * sizeof(NdtLeafRecord)));
+  return static_cast<bool>(ofs);
+}
+
+}  // namespace pclomp
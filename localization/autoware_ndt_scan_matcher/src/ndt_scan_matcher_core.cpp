@@ -22,6 +22,8 @@
 #include <autoware_utils_pcl/transforms.hpp>
 
 #include <pcl_conversions/pcl_conversions.h>
+#include <pthread.h>
+#include <sched.h>
 
 #include <memory>
 #include <string>
@@ -220,6 +222,18 @@ NDTScanMatcher::NDTScanMatcher(const rclcpp::NodeOptions & options)
     std::make_unique<DiagnosticsInterface>(this, "trigger_node_service_status");
 
   logger_configure_ = std::make_unique<autoware_utils_logging::LoggerLevelConfigure>(this);
+
+  debug_cloud_thread_ = std::thread(&NDTScanMatcher::debug_cloud_worker, this);
+}
+
+NDTScanMatcher::~NDTScanMatcher()
+{
+  {
+    std::lock_guard<std::mutex> lock(debug_cloud_mtx_);
+    is_debug_cloud_worker_stopped_ = true;
+  }
+  debug_cloud_cv_.notify_one();
+  debug_cloud_thread_.join();
 }
 
 void NDTScanMatcher::callback_timer()
@@ -651,21 +665,20 @@ bool NDTScanMatcher::callback_sensor_points_main(
     new pcl::PointCloud<PointSource>);
   autoware_utils_pcl::transform_pointcloud(
     *sensor_points_in_baselink_frame, *sensor_points_in_map_ptr, ndt_result.pose);
-  publish_point_cloud(sensor_ros_time, param_.frame.map_frame, sensor_points_in_map_ptr);
 
-  // check each of point score
-  const float lower_nvs = 1.0f;
-  const float upper_nvs = 3.5f;
+  // The debug clouds are generated by the worker, only for the topics with a subscriber
+  DebugCloudSnapshot debug_cloud_snapshot;
+  debug_cloud_snapshot.sensor_ros_time = sensor_ros_time;
+  if (sensor_aligned_pose_pub_->get_subscription_count() > 0) {
+    debug_cloud_snapshot.sensor_points_in_map_ptr = sensor_points_in_map_ptr;
+  }
   if (voxel_score_points_pub_->get_subscription_count() > 0) {
-    pcl::PointCloud<pcl::PointXYZRGB>::Ptr nvs_points_in_map_ptr_rgb{
-      new pcl::PointCloud<pcl::PointXYZRGB>};
-    nvs_points_in_map_ptr_rgb =
-      visualize_point_score(sensor_points_in_map_ptr, lower_nvs, upper_nvs);
-    sensor_msgs::msg::PointCloud2 nvs_points_msg_in_map;
-    pcl::toROSMsg(*nvs_points_in_map_ptr_rgb, nvs_points_msg_in_map);
-    nvs_points_msg_in_map.header.stamp = sensor_ros_time;
-    nvs_points_msg_in_map.header.frame_id = param_.frame.map_frame;
-    voxel_score_points_pub_->publish(nvs_points_msg_in_map);
+    if (debug_ndt_source_ptr_.lock() != ndt_ptr_) {
+      debug_ndt_ptr_ = std::make_shared<const NormalDistributionsTransform>(*ndt_ptr_);
+      debug_ndt_source_ptr_ = ndt_ptr_;
+    }
+    debug_cloud_snapshot.voxel_score_points_in_map_ptr = sensor_points_in_map_ptr;
+    debug_cloud_snapshot.ndt_ptr = debug_ndt_ptr_;
   }
 
   // whether use no ground points to calculate score
@@ -681,12 +694,9 @@ bool NDTScanMatcher::callback_sensor_points_main(
         no_ground_points_in_map_ptr->points.push_back(sensor_points_in_map_ptr->points[i]);
       }
     }
-    // pub remove-ground points
-    sensor_msgs::msg::PointCloud2 no_ground_points_msg_in_map;
-    pcl::toROSMsg(*no_ground_points_in_map_ptr, no_ground_points_msg_in_map);
-    no_ground_points_msg_in_map.header.stamp = sensor_ros_time;
-    no_ground_points_msg_in_map.header.frame_id = param_.frame.map_frame;
-    no_ground_points_aligned_pose_pub_->publish(no_ground_points_msg_in_map);
+    if (no_ground_points_aligned_pose_pub_->get_subscription_count() > 0) {
+      debug_cloud_snapshot.no_ground_points_in_map_ptr = no_ground_points_in_map_ptr;
+    }
     // calculate score
     const auto no_ground_transform_probability = static_cast<float>(
       ndt_ptr_->calculateTransformationProbability(*no_ground_points_in_map_ptr));
@@ -699,6 +709,8 @@ bool NDTScanMatcher::callback_sensor_points_main(
       make_float32_stamped(sensor_ros_time, no_ground_nearest_voxel_transformation_likelihood));
   }
 
+  push_debug_clouds(std::move(debug_cloud_snapshot));
+
   return is_converged;
 }
 
@@ -880,7 +892,9 @@ Eigen::Matrix2d NDTScanMatcher::estimate_covariance(
       ndt_result, param_.covariance.covariance_estimation.initial_pose_offset_model_x,
       param_.covariance.covariance_estimation.initial_pose_offset_model_y);
     const pclomp::ResultOfMultiNdtCovarianceEstimation result_of_multi_ndt_covariance_estimation =
-      estimate_xy_covariance_by_multi_ndt(ndt_result, ndt_ptr_, poses_to_search);
+      estimate_xy_covariance_by_multi_ndt(
+        ndt_result, ndt_ptr_, poses_to_search,
+        param_.covariance.covariance_estimation.time_budget_ms);
     for (size_t i = 0; i < result_of_multi_ndt_covariance_estimation.ndt_initial_poses.size();
          i++) {
       multi_ndt_result_msg.poses.push_back(
@@ -899,8 +913,10 @@ Eigen::Matrix2d NDTScanMatcher::estimate_covariance(
       param_.covariance.covariance_estimation.initial_pose_offset_model_y);
     const pclomp::ResultOfMultiNdtCovarianceEstimation
       result_of_multi_ndt_score_covariance_estimation = estimate_xy_covariance_by_multi_ndt_score(
-        ndt_result, ndt_ptr_, poses_to_search, param_.covariance.covariance_estimation.temperature);
-    for (const auto & sub_initial_pose_matrix : poses_to_search) {
+        ndt_result, ndt_ptr_, poses_to_search, param_.covariance.covariance_estimation.temperature,
+        param_.covariance.covariance_estimation.time_budget_ms);
+    for (const auto & sub_initial_pose_matrix :
+         result_of_multi_ndt_score_covariance_estimation.ndt_initial_poses) {
       multi_initial_pose_msg.poses.push_back(matrix4f_to_pose(sub_initial_pose_matrix));
     }
     multi_initial_pose_pub_->publish(multi_initial_pose_msg);
@@ -911,12 +927,12 @@ Eigen::Matrix2d NDTScanMatcher::estimate_covariance(
 }
 
 pcl::PointCloud<pcl::PointXYZRGB>::Ptr NDTScanMatcher::visualize_point_score(
-  const pcl::shared_ptr<pcl::PointCloud<PointSource>> & sensor_points_in_map_ptr,
-  const float & lower_nvs, const float & upper_nvs)
+  const NormalDistributionsTransform & ndt,
+  const pcl::PointCloud<PointSource> & sensor_points_in_map, const float & lower_nvs,
+  const float & upper_nvs)
 {
   pcl::PointCloud<pcl::PointXYZI> nvs_points_in_map_ptr_i;
-  nvs_points_in_map_ptr_i =
-    ndt_ptr_->calculateNearestVoxelScoreEachPoint(*sensor_points_in_map_ptr);
+  nvs_points_in_map_ptr_i = ndt.calculateNearestVoxelScoreEachPoint(sensor_points_in_map);
   pcl::PointCloud<pcl::PointXYZRGB>::Ptr nvs_points_in_map_ptr_rgb{
     new pcl::PointCloud<pcl::PointXYZRGB>};
 
@@ -936,6 +952,72 @@ pcl::PointCloud<pcl::PointXYZRGB>::Ptr NDTScanMatcher::visualize_point_score(
   return nvs_points_in_map_ptr_rgb;
 }
 
+void NDTScanMatcher::push_debug_clouds(DebugCloudSnapshot snapshot)
+{
+  if (
+    !snapshot.sensor_points_in_map_ptr && !snapshot.no_ground_points_in_map_ptr &&
+    !snapshot.voxel_score_points_in_map_ptr) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(debug_cloud_mtx_);
+    debug_cloud_snapshot_ = std::move(snapshot);
+  }
+  debug_cloud_cv_.notify_one();
+}
+
+void NDTScanMatcher::debug_cloud_worker()
+{
+  // The debug clouds only use the CPU time left by the other threads
+  const sched_param idle_param{};
+  if (pthread_setschedparam(pthread_self(), SCHED_IDLE, &idle_param) != 0) {
+    RCLCPP_WARN(get_logger(), "Failed to lower the priority of the debug cloud thread.");
+  }
+
+  while (true) {
+    DebugCloudSnapshot snapshot;
+    {
+      std::unique_lock<std::mutex> lock(debug_cloud_mtx_);
+      debug_cloud_cv_.wait(
+        lock, [this] { return is_debug_cloud_worker_stopped_ || debug_cloud_snapshot_; });
+      if (is_debug_cloud_worker_stopped_) {
+        return;
+      }
+      snapshot = std::move(*debug_cloud_snapshot_);
+      debug_cloud_snapshot_.reset();
+    }
+    publish_debug_clouds(snapshot);
+  }
+}
+
+void NDTScanMatcher::publish_debug_clouds(const DebugCloudSnapshot & snapshot)
+{
+  const auto make_msg = [&](const auto & points) {
+    sensor_msgs::msg::PointCloud2 points_msg;
+    pcl::toROSMsg(points, points_msg);
+    points_msg.header.stamp = snapshot.sensor_ros_time;
+    points_msg.header.frame_id = param_.frame.map_frame;
+    return points_msg;
+  };
+
+  if (snapshot.sensor_points_in_map_ptr) {
+    sensor_aligned_pose_pub_->publish(make_msg(*snapshot.sensor_points_in_map_ptr));
+  }
+
+  if (snapshot.no_ground_points_in_map_ptr) {
+    no_ground_points_aligned_pose_pub_->publish(make_msg(*snapshot.no_ground_points_in_map_ptr));
+  }
+
+  // check each of point score
+  if (snapshot.voxel_score_points_in_map_ptr) {
+    const float lower_nvs = 1.0f;
+    const float upper_nvs = 3.5f;
+    const pcl::PointCloud<pcl::PointXYZRGB>::Ptr nvs_points_in_map_ptr_rgb = visualize_point_score(
+      *snapshot.ndt_ptr, *snapshot.voxel_score_points_in_map_ptr, lower_nvs, upper_nvs);
+    voxel_score_points_pub_->publish(make_msg(*nvs_points_in_map_ptr_rgb));
+  }
+}
+
 void NDTScanMatcher::add_regularization_pose(const rclcpp::Time & sensor_ros_time)
 {
   ndt_ptr_->unsetRegularizationPose();
@@ -1029,6 +1111,7 @@ void NDTScanMatcher::service_ndt_align_main(
     autoware::localization_util::transform(req->pose_with_covariance, transform_s2t);
   initial_pose_msg_in_map_frame.header.stamp = req->pose_with_covariance.header.stamp;
   map_update_module_->update_map(
+    initial_pose_msg_in_map_frame.pose.pose.position,
     initial_pose_msg_in_map_frame.pose.pose.position, diagnostics_ndt_align_);
 
   // mutex Map
@@ -1105,61 +1188,111 @@ std::tuple<geometry_msgs::msg::PoseWithCovarianceStamped, double> NDTScanMatcher
     TreeStructuredParzenEstimator::Direction::MAXIMIZE,
     param_.initial_pose_estimation.n_startup_trials, sample_mean, sample_stddev);
 
+  // The trials of a batch are proposed from the same trials, and aligned in parallel on copies of
+  // the NDT, which share the voxel grids of the map and split its threads and CPUs
+  const int64_t batch_size = std::clamp<int64_t>(
+    param_.initial_pose_estimation.batch_size, 1, param_.initial_pose_estimation.particles_num);
+  std::vector<std::shared_ptr<NormalDistributionsTransform>> batch_ndt_ptrs{ndt_ptr_};
+  if (batch_size > 1) {
+    batch_ndt_ptrs.clear();
+    pclomp::NdtParams batch_params = ndt_ptr_->getParams();
+    const int num_threads = batch_params.num_threads;
+    batch_params.num_threads = std::max(1, num_threads / static_cast<int>(batch_size));
+    for (int64_t b = 0; b < batch_size; ++b) {
+      auto batch_ndt_ptr = std::make_shared<NormalDistributionsTransform>(*ndt_ptr_);
+      pclomp::NdtParams params = batch_params;
+      if (params.first_cpu >= 0) {
+        params.first_cpu += static_cast<int>(b) * params.num_threads;
+      }
+      batch_ndt_ptr->setParams(params);
+      batch_ndt_ptrs.push_back(batch_ndt_ptr);
+    }
+  }
+
+  const auto input_to_pose = [](const TreeStructuredParzenEstimator::Input & input) {
+    geometry_msgs::msg::Pose pose;
+    pose.position.x = input[0];
+    pose.position.y = input[1];
+    pose.position.z = input[2];
+    tf2::Quaternion tf_quaternion;
+    tf_quaternion.setRPY(input[3], input[4], input[5]);
+    pose.orientation = tf2::toMsg(tf_quaternion);
+    return pose;
+  };
+
   std::vector<Particle> particle_array;
-  auto output_cloud = std::make_shared<pcl::PointCloud<PointSource>>();
+  std::vector<TreeStructuredParzenEstimator::Input> batch_inputs;
+  std::vector<pclomp::NdtResult> batch_results(batch_size);
+  std::vector<pcl::PointCloud<PointSource>> batch_output_clouds(batch_size);
 
   // publish the estimated poses in 20 times to see the progress and to avoid dropping data
   visualization_msgs::msg::MarkerArray marker_array;
   constexpr int64_t publish_num = 20;
   const int64_t publish_interval = param_.initial_pose_estimation.particles_num / publish_num;
 
-  for (int64_t i = 0; i < param_.initial_pose_estimation.particles_num; i++) {
-    const TreeStructuredParzenEstimator::Input input = tpe.get_next_input();
-
-    geometry_msgs::msg::Pose initial_pose;
-    initial_pose.position.x = input[0];
-    initial_pose.position.y = input[1];
-    initial_pose.position.z = input[2];
-    geometry_msgs::msg::Vector3 init_rpy;
-    init_rpy.x = input[3];
-    init_rpy.y = input[4];
-    init_rpy.z = input[5];
-    tf2::Quaternion tf_quaternion;
-    tf_quaternion.setRPY(init_rpy.x, init_rpy.y, init_rpy.z);
-    initial_pose.orientation = tf2::toMsg(tf_quaternion);
-
-    const Eigen::Matrix4f initial_pose_matrix = pose_to_matrix4f(initial_pose);
-    ndt_ptr_->align(*output_cloud, initial_pose_matrix);
-    const pclomp::NdtResult ndt_result = ndt_ptr_->getResult();
-
-    Particle particle(
-      initial_pose, matrix4f_to_pose(ndt_result.pose),
-      ndt_result.nearest_voxel_transformation_likelihood, ndt_result.iteration_num);
-    particle_array.push_back(particle);
-    push_debug_markers(marker_array, get_clock()->now(), param_.frame.map_frame, particle, i);
-    if (
-      (i + 1) % publish_interval == 0 || (i + 1) == param_.initial_pose_estimation.particles_num) {
-      ndt_monte_carlo_initial_pose_marker_pub_->publish(marker_array);
-      marker_array.markers.clear();
+  for (int64_t batch_begin = 0; batch_begin < param_.initial_pose_estimation.particles_num;
+       batch_begin += batch_size) {
+    const int64_t batch_num =
+      std::min(batch_size, param_.initial_pose_estimation.particles_num - batch_begin);
+    batch_inputs = tpe.get_next_inputs(batch_num);
+
+    const auto align_trial = [&](const int64_t b) {
+      const Eigen::Matrix4f initial_pose_matrix = pose_to_matrix4f(input_to_pose(batch_inputs[b]));
+      batch_ndt_ptrs[b]->align(batch_output_clouds[b], initial_pose_matrix);
+      batch_results[b] = batch_ndt_ptrs[b]->getResult();
+    };
+    if (batch_num == 1) {
+      align_trial(0);
+    } else {
+      std::vector<std::thread> workers;
+      for (int64_t b = 0; b < batch_num; ++b) {
+        workers.emplace_back(align_trial, b);
+      }
+      for (auto & worker : workers) {
+        worker.join();
+      }
     }
 
-    const geometry_msgs::msg::Pose pose = matrix4f_to_pose(ndt_result.pose);
-    const geometry_msgs::msg::Vector3 rpy = autoware::localization_util::get_rpy(pose);
-
-    TreeStructuredParzenEstimator::Input result(6);
-    result[0] = pose.position.x;
-    result[1] = pose.position.y;
-    result[2] = pose.position.z;
-    result[3] = rpy.x;
-    result[4] = rpy.y;
-    result[5] = rpy.z;
-    tpe.add_trial(TreeStructuredParzenEstimator::Trial{result, ndt_result.transform_probability});
-
-    auto sensor_points_in_map_ptr = std::make_shared<pcl::PointCloud<PointSource>>();
-    autoware_utils_pcl::transform_pointcloud(
-      *ndt_ptr_->getInputSource(), *sensor_points_in_map_ptr, ndt_result.pose);
-    publish_point_cloud(
-      initial_pose_with_cov.header.stamp, param_.frame.map_frame, sensor_points_in_map_ptr);
+    // The results are fed back in the order of the trials, so that a batch size of 1 is the
+    // sequential search
+    for (int64_t b = 0; b < batch_num; ++b) {
+      const int64_t i = batch_begin + b;
+      const pclomp::NdtResult & ndt_result = batch_results[b];
+      const geometry_msgs::msg::Pose initial_pose = input_to_pose(batch_inputs[b]);
+
+      Particle particle(
+        initial_pose, matrix4f_to_pose(ndt_result.pose),
+        ndt_result.nearest_voxel_transformation_likelihood, ndt_result.iteration_num);
+      particle_array.push_back(particle);
+      push_debug_markers(marker_array, get_clock()->now(), param_.frame.map_frame, particle, i);
+      if (
+        (i + 1) % publish_interval == 0 ||
+        (i + 1) == param_.initial_pose_estimation.particles_num) {
+        ndt_monte_carlo_initial_pose_marker_pub_->publish(marker_array);
+        marker_array.markers.clear();
+      }
+
+      const geometry_msgs::msg::Pose pose = matrix4f_to_pose(ndt_result.pose);
+      const geometry_msgs::msg::Vector3 rpy = autoware::localization_util::get_rpy(pose);
+
+      TreeStructuredParzenEstimator::Input result(6);
+      result[0] = pose.position.x;
+      result[1] = pose.position.y;
+      result[2] = pose.position.z;
+      result[3] = rpy.x;
+      result[4] = rpy.y;
+      result[5] = rpy.z;
+      tpe.add_trial(
+        TreeStructuredParzenEstimator::Trial{result, ndt_result.transform_probability});
+
+      if (sensor_aligned_pose_pub_->get_subscription_count() > 0) {
+        auto sensor_points_in_map_ptr = std::make_shared<pcl::PointCloud<PointSource>>();
+        autoware_utils_pcl::transform_pointcloud(
+          *ndt_ptr_->getInputSource(), *sensor_points_in_map_ptr, ndt_result.pose);
+        publish_point_cloud(
+          initial_pose_with_cov.header.stamp, param_.frame.map_frame, sensor_points_in_map_ptr);
+      }
+    }
   }
 
   auto best_particle_ptr = std::max_element(
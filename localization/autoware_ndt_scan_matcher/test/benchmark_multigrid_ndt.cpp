@@ -0,0 +1,146 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Alignment time, iteration time and accuracy of the neighbor search methods of the NDT, with the
+// derivatives in double or in mixed precision, and with or without the coarse-to-fine iterations.
+// The scan is a subsample of the map in the map frame, so the true pose is the identity, and the
+// alignment starts from a perturbed initial guess. The sample half cubic map is used unless
+// AUTOWARE_NDT_BENCHMARK_MAP_PCD and AUTOWARE_NDT_BENCHMARK_SCAN_PCD give a recorded map and a
+// scan already aligned to it.
+
+#include "test_util.hpp"
+
+#include <autoware/ndt_scan_matcher/ndt_omp/multigrid_ndt_omp.h>
+
+#include <pcl/io/pcd_io.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <string>
+
+// cspell:ignore multigrid
+
+namespace
+{
+using PointCloud = pcl::PointCloud<pcl::PointXYZ>;
+using Ndt = pclomp::MultiGridNormalDistributionsTransform<pcl::PointXYZ, pcl::PointXYZ>;
+
+struct Fixture
+{
+  PointCloud::Ptr map{new PointCloud};
+  PointCloud::Ptr scan{new PointCloud};
+};
+
+const Fixture & get_fixture()
+{
+  static const Fixture fixture = []() {
+    Fixture fixture;
+    const char * map_path = std::getenv("AUTOWARE_NDT_BENCHMARK_MAP_PCD");
+    const char * scan_path = std::getenv("AUTOWARE_NDT_BENCHMARK_SCAN_PCD");
+    if (
+      map_path != nullptr && scan_path != nullptr &&
+      pcl::io::loadPCDFile(std::string(map_path), *fixture.map) == 0 &&
+      pcl::io::loadPCDFile(std::string(scan_path), *fixture.scan) == 0) {
+      return fixture;
+    }
+    *fixture.map = make_sample_half_cubic_pcd();
+    fixture.scan->clear();
+    for (size_t i = 0; i < fixture.map->size(); i += 5) {
+      fixture.scan->push_back((*fixture.map)[i]);
+    }
+    return fixture;
+  }();
+  return fixture;
+}
+
+void align(
+  benchmark::State & state, const pclomp::NeighborSearchMethod search_method,
+  const bool mixed_precision, const int coarse_stride = 1, const int coarse_iterations = 0)
+{
+  const auto & fixture = get_fixture();
+
+  Ndt ndt;
+  pclomp::NdtParams params = ndt.getParams();
+  params.resolution = 2.0f;
+  params.trans_epsilon = 0.01;
+  params.step_size = 0.1;
+  params.max_iterations = 30;
+  params.num_threads = static_cast<int>(state.range(0));
+  params.search_method = search_method;
+  params.mixed_precision = mixed_precision;
+  params.coarse_stride = coarse_stride;
+  params.coarse_iterations = coarse_iterations;
+  ndt.setParams(params);
+  ndt.setInputTarget(fixture.map);
+  ndt.setInputSource(fixture.scan);
+
+  const Eigen::Matrix4f initial_guess =
+    (Eigen::Translation3f(0.5f, -0.4f, 0.1f) * Eigen::AngleAxisf(0.03f, Eigen::Vector3f::UnitZ()))
+      .matrix();
+
+  PointCloud output;
+  int64_t iteration_num = 0;
+  for (auto _ : state) {
+    ndt.align(output, initial_guess);
+    iteration_num += ndt.getResult().iteration_num;
+  }
+
+  const Eigen::Matrix4f pose = ndt.getResult().pose;
+  const float yaw_error = std::atan2(pose(1, 0), pose(0, 0));
+  state.counters["iterations"] =
+    benchmark::Counter(static_cast<double>(iteration_num), benchmark::Counter::kAvgIterations);
+  // time per NDT iteration, the inverse of the rate of iteration_num
+  state.counters["iteration_time"] = benchmark::Counter(
+    static_cast<double>(iteration_num), benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+  state.counters["translation_error_m"] = pose.block<3, 1>(0, 3).norm();
+  state.counters["yaw_error_rad"] = std::abs(yaw_error);
+  state.SetItemsProcessed(state.iterations() * fixture.scan->size());
+}
+
+BENCHMARK_CAPTURE(align, kdtree, pclomp::KDTREE, false)
+  ->Arg(1)
+  ->Arg(4)
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(align, kdtree_mixed_precision, pclomp::KDTREE, true)
+  ->Arg(1)
+  ->Arg(4)
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(align, direct26, pclomp::DIRECT26, false)
+  ->Arg(1)
+  ->Arg(4)
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(align, direct26_mixed_precision, pclomp::DIRECT26, true)
+  ->Arg(1)
+  ->Arg(4)
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(align, direct7, pclomp::DIRECT7, false)
+  ->Arg(1)
+  ->Arg(4)
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(align, direct1, pclomp::DIRECT1, false)
+  ->Arg(1)
+  ->Arg(4)
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(align, kdtree_coarse_to_fine, pclomp::KDTREE, false, 4, 5)
+  ->Arg(1)
+  ->Arg(4)
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(align, direct26_coarse_to_fine, pclomp::DIRECT26, false, 4, 5)
+  ->Arg(1)
+  ->Arg(4)
+  ->Unit(benchmark::kMillisecond);
+
+}  // namespace
@@ -0,0 +1,88 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "test_util.hpp"
+
+#include <autoware/ndt_scan_matcher/ndt_omp/multigrid_ndt_omp.h>
+
+#include <gtest/gtest.h>
+
+// cspell:ignore multigrid
+
+using Ndt = pclomp::MultiGridNormalDistributionsTransform<pcl::PointXYZ, pcl::PointXYZ>;
+
+class CoarseToFineAlignTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    map_.reset(new pcl::PointCloud<pcl::PointXYZ>(make_sample_half_cubic_pcd()));
+
+    // the map seen from a sensor moved by (0.3, -0.2, 0.1)
+    scan_.reset(new pcl::PointCloud<pcl::PointXYZ>);
+    for (size_t i = 0; i < map_->size(); i += 3) {
+      const auto & point = (*map_)[i];
+      scan_->push_back(pcl::PointXYZ(point.x - 0.3f, point.y + 0.2f, point.z - 0.1f));
+    }
+  }
+
+  pclomp::NdtResult align(const int coarse_stride, const int coarse_iterations)
+  {
+    pclomp::NdtParams params = ndt_.getParams();
+    params.resolution = 2.0f;
+    params.trans_epsilon = 0.01;
+    params.max_iterations = 30;
+    params.num_threads = 2;
+    params.coarse_stride = coarse_stride;
+    params.coarse_iterations = coarse_iterations;
+    ndt_.setParams(params);
+    ndt_.setInputTarget(map_);
+    ndt_.setInputSource(scan_);
+
+    ndt_.align(output_, Eigen::Matrix4f::Identity());
+    return ndt_.getResult();
+  }
+
+  pcl::PointCloud<pcl::PointXYZ>::Ptr map_;
+  pcl::PointCloud<pcl::PointXYZ>::Ptr scan_;
+  pcl::PointCloud<pcl::PointXYZ> output_;
+  Ndt ndt_;
+};
+
+TEST_F(CoarseToFineAlignTest, MatchFullResolution)
+{
+  const auto expected = align(1, 0);
+  const auto actual = align(8, 5);
+
+  const Eigen::Vector3f translation = actual.pose.block<3, 1>(0, 3);
+  EXPECT_NEAR(translation.x(), 0.3, 0.1);
+  EXPECT_NEAR(translation.y(), -0.2, 0.1);
+  EXPECT_NEAR(translation.z(), 0.1, 0.1);
+  EXPECT_LT((translation - expected.pose.block<3, 1>(0, 3)).norm(), 0.05);
+  EXPECT_LE(actual.iteration_num, 30);
+
+  // the output and the scores are the ones of the full input
+  ASSERT_EQ(output_.size(), scan_->size());
+  EXPECT_NEAR(
+    actual.nearest_voxel_transformation_likelihood,
+    ndt_.calculateNearestVoxelTransformationLikelihood(output_), 1e-4);
+}
+
+TEST_F(CoarseToFineAlignTest, StrideLargerThanTheInputUsesAllThePoints)
+{
+  const auto expected = align(1, 0);
+  const auto actual = align(static_cast<int>(scan_->size()) + 1, 5);
+  EXPECT_EQ(actual.pose, expected.pose);
+  EXPECT_EQ(actual.iteration_num, expected.iteration_num);
+}
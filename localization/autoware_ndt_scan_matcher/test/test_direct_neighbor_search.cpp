@@ -0,0 +1,191 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "test_util.hpp"
+
+#include <autoware/ndt_scan_matcher/ndt_omp/multigrid_ndt_omp.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <set>
+#include <vector>
+
+// cspell:ignore multigrid
+
+using Grid = pclomp::MultiVoxelGridCovariance<pcl::PointXYZ>;
+using Ndt = pclomp::MultiGridNormalDistributionsTransform<pcl::PointXYZ, pcl::PointXYZ>;
+
+namespace
+{
+constexpr float resolution = 2.0f;
+
+std::set<Grid::LeafConstPtr> to_set(const std::vector<Grid::LeafConstPtr> & leaves)
+{
+  return std::set<Grid::LeafConstPtr>(leaves.begin(), leaves.end());
+}
+
+std::set<std::array<float, 3>> to_centroid_set(const std::vector<Grid::LeafConstPtr> & leaves)
+{
+  std::set<std::array<float, 3>> centroids;
+  for (const auto & leaf : leaves) {
+    centroids.insert({leaf->centroid_[0], leaf->centroid_[1], leaf->centroid_[2]});
+  }
+  return centroids;
+}
+
+bool includes(const std::set<Grid::LeafConstPtr> & a, const std::set<Grid::LeafConstPtr> & b)
+{
+  return std::includes(a.begin(), a.end(), b.begin(), b.end());
+}
+}  // namespace
+
+class DirectNeighborSearchTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    // two overlapping map pieces, so that some voxels hold a leaf of each piece
+    const auto map = make_sample_half_cubic_pcd();
+    for (const auto & point : map) {
+      (point.x < 11.0f ? first_piece_ : second_piece_)->push_back(point);
+    }
+    grid_.setLeafSize(resolution, resolution, resolution);
+    grid_.setInputCloudAndFilter(first_piece_, "first");
+    grid_.setInputCloudAndFilter(second_piece_, "second");
+    grid_.createKdtree();
+
+    std::mt19937 engine(0);
+    std::uniform_real_distribution<float> coordinate(-3.0f, 23.0f);
+    for (int i = 0; i < 2000; ++i) {
+      queries_.emplace_back(coordinate(engine), coordinate(engine), coordinate(engine));
+    }
+  }
+
+  pcl::PointCloud<pcl::PointXYZ>::Ptr first_piece_{new pcl::PointCloud<pcl::PointXYZ>};
+  pcl::PointCloud<pcl::PointXYZ>::Ptr second_piece_{new pcl::PointCloud<pcl::PointXYZ>};
+  Grid grid_;
+  std::vector<pcl::PointXYZ> queries_;
+};
+
+TEST_F(DirectNeighborSearchTest, Direct26CoversRadiusSearch)
+{
+  // a centroid within one voxel size of the query is in the voxel of the query or in a neighbor
+  std::vector<Grid::LeafConstPtr> radius_leaves;
+  std::vector<Grid::LeafConstPtr> direct_leaves;
+  size_t found_num = 0;
+  for (const auto & query : queries_) {
+    grid_.radiusSearch(query, resolution, radius_leaves);
+    grid_.directSearch(query, pclomp::DIRECT26, direct_leaves);
+    EXPECT_TRUE(includes(to_set(direct_leaves), to_set(radius_leaves)));
+    found_num += radius_leaves.size();
+  }
+  EXPECT_GT(found_num, 0U);
+}
+
+TEST_F(DirectNeighborSearchTest, SmallerNeighborhoodsAreSubsets)
+{
+  std::vector<Grid::LeafConstPtr> leaves26;
+  std::vector<Grid::LeafConstPtr> leaves7;
+  std::vector<Grid::LeafConstPtr> leaves1;
+  for (const auto & query : queries_) {
+    EXPECT_EQ(
+      grid_.directSearch(query, pclomp::DIRECT26, leaves26), static_cast<int>(leaves26.size()));
+    EXPECT_EQ(
+      grid_.directSearch(query, pclomp::DIRECT7, leaves7), static_cast<int>(leaves7.size()));
+    EXPECT_EQ(
+      grid_.directSearch(query, pclomp::DIRECT1, leaves1), static_cast<int>(leaves1.size()));
+    EXPECT_TRUE(includes(to_set(leaves26), to_set(leaves7)));
+    EXPECT_TRUE(includes(to_set(leaves7), to_set(leaves1)));
+  }
+}
+
+TEST_F(DirectNeighborSearchTest, Direct1FindsTheLeafOfACentroid)
+{
+  std::vector<Grid::LeafConstPtr> leaves;
+  for (const auto & centroid : grid_.getVoxelPCD()) {
+    grid_.directSearch(centroid, pclomp::DIRECT1, leaves);
+    const bool found = std::any_of(leaves.begin(), leaves.end(), [&](const auto & leaf) {
+      return leaf->centroid_[0] == centroid.x && leaf->centroid_[1] == centroid.y &&
+             leaf->centroid_[2] == centroid.z;
+    });
+    EXPECT_TRUE(found);
+  }
+}
+
+TEST_F(DirectNeighborSearchTest, RemovingAPieceMatchesAFreshBuild)
+{
+  // the indices of the first piece are kept as they are when the second piece is removed
+  const Grid copy = grid_;
+  grid_.removeCloud("second");
+  grid_.createKdtree();
+
+  Grid fresh;
+  fresh.setLeafSize(resolution, resolution, resolution);
+  fresh.setInputCloudAndFilter(first_piece_, "first");
+  fresh.createKdtree();
+
+  std::vector<Grid::LeafConstPtr> leaves;
+  std::vector<Grid::LeafConstPtr> fresh_leaves;
+  std::vector<Grid::LeafConstPtr> copy_leaves;
+  for (const auto & query : queries_) {
+    grid_.radiusSearch(query, resolution, leaves);
+    fresh.radiusSearch(query, resolution, fresh_leaves);
+    EXPECT_EQ(to_centroid_set(leaves), to_centroid_set(fresh_leaves));
+    grid_.directSearch(query, pclomp::DIRECT26, leaves);
+    fresh.directSearch(query, pclomp::DIRECT26, fresh_leaves);
+    EXPECT_EQ(to_centroid_set(leaves), to_centroid_set(fresh_leaves));
+
+    // the copy made before the removal still sees both pieces
+    copy.directSearch(query, pclomp::DIRECT26, copy_leaves);
+    EXPECT_TRUE(includes(to_set(copy_leaves), to_set(leaves)));
+  }
+  EXPECT_EQ(grid_.getVoxelPCD().size(), fresh.getVoxelPCD().size());
+}
+
+TEST(MultiGridNdtTest, AlignWithEachSearchMethod)
+{
+  pcl::PointCloud<pcl::PointXYZ>::Ptr map(
+    new pcl::PointCloud<pcl::PointXYZ>(make_sample_half_cubic_pcd()));
+
+  // the map seen from a sensor moved by (0.3, -0.2, 0.1)
+  pcl::PointCloud<pcl::PointXYZ>::Ptr scan(new pcl::PointCloud<pcl::PointXYZ>);
+  for (size_t i = 0; i < map->size(); i += 7) {
+    const auto & point = (*map)[i];
+    scan->push_back(pcl::PointXYZ(point.x - 0.3f, point.y + 0.2f, point.z - 0.1f));
+  }
+
+  // DIRECT1 is left out, it misses the planes whose points moved to the neighboring voxels
+  for (const auto method : {pclomp::KDTREE, pclomp::DIRECT26, pclomp::DIRECT7}) {
+    Ndt ndt;
+    pclomp::NdtParams params = ndt.getParams();
+    params.resolution = resolution;
+    params.trans_epsilon = 0.01;
+    params.max_iterations = 30;
+    params.num_threads = 1;
+    params.search_method = method;
+    ndt.setParams(params);
+    ndt.setInputTarget(map);
+    ndt.setInputSource(scan);
+
+    pcl::PointCloud<pcl::PointXYZ> output;
+    ndt.align(output, Eigen::Matrix4f::Identity());
+    const Eigen::Vector3f translation = ndt.getResult().pose.block<3, 1>(0, 3);
+    EXPECT_NEAR(translation.x(), 0.3, 0.1) << "search method " << method;
+    EXPECT_NEAR(translation.y(), -0.2, 0.1) << "search method " << method;
+    EXPECT_NEAR(translation.z(), 0.1, 0.1) << "search method " << method;
+  }
+}
@@ -0,0 +1,102 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <autoware/ndt_scan_matcher/map_memory_budget.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using autoware::ndt_scan_matcher::MapMemoryBudget;
+
+namespace
+{
+// piece i covers x in [10 i, 10 (i + 1)] and y in [0, 10], and has 100 bytes
+void add_pieces(MapMemoryBudget & budget, const int first, const int last)
+{
+  for (int i = first; i <= last; ++i) {
+    const double x = 10.0 * i;
+    budget.add(std::to_string(i), {x, 0.0, x + 10.0, 10.0});
+    budget.set_bytes(std::to_string(i), 100);
+  }
+}
+}  // namespace
+
+TEST(MapMemoryBudget, UnlimitedBudgetEvictsNothing)
+{
+  MapMemoryBudget budget(0);
+  add_pieces(budget, -5, 5);
+  EXPECT_EQ(budget.get_used_bytes(), 1100U);
+  EXPECT_TRUE(budget.evict(0.0, 5.0, 1.0, 0.0, 15.0).empty());
+
+  budget.remove("0");
+  EXPECT_EQ(budget.get_used_bytes(), 1000U);
+  budget.clear();
+  EXPECT_EQ(budget.get_used_bytes(), 0U);
+}
+
+TEST(MapMemoryBudget, EvictBehindTheVehicleFirst)
+{
+  MapMemoryBudget budget(700);
+  add_pieces(budget, -5, 4);
+
+  // the pieces 1 to 4 ahead and -5 to -1 behind the vehicle at x = 5 are unused since the load
+  budget.use(5.0, 5.0, 1.0);
+  const auto evicted_ids = budget.evict(5.0, 5.0, 1.0, 0.0, 1.0);
+  EXPECT_EQ(evicted_ids, (std::vector<std::string>{"-5", "-4", "-3"}));
+  EXPECT_EQ(budget.get_used_bytes(), 700U);
+  EXPECT_EQ(budget.get_evicted_ids().size(), 3U);
+
+  // the evicted pieces are not counted nor sized again
+  budget.set_bytes("-5", 100);
+  EXPECT_EQ(budget.get_used_bytes(), 700U);
+}
+
+TEST(MapMemoryBudget, EvictLeastRecentlyUsedFirst)
+{
+  MapMemoryBudget budget(300);
+  add_pieces(budget, 0, 3);
+
+  // the vehicle goes from the piece 0 to the piece 1, and back
+  budget.use(5.0, 5.0, 1.0);
+  budget.use(15.0, 5.0, 1.0);
+  budget.use(5.0, 5.0, 1.0);
+  EXPECT_EQ(budget.evict(5.0, 5.0, 1.0, 0.0, 1.0), (std::vector<std::string>{"2"}));
+}
+
+TEST(MapMemoryBudget, KeepPiecesInRadius)
+{
+  MapMemoryBudget budget(100);
+  add_pieces(budget, 0, 3);
+
+  // only the pieces 2 and 3 are out of the radius of the vehicle in the piece 0, so the budget is
+  // exceeded after their eviction
+  EXPECT_EQ(budget.evict(5.0, 5.0, 1.0, 0.0, 10.0), (std::vector<std::string>{"2", "3"}));
+  EXPECT_EQ(budget.get_used_bytes(), 200U);
+}
+
+TEST(MapMemoryBudget, ReleaseEvictedPiecesInRadius)
+{
+  MapMemoryBudget budget(200);
+  add_pieces(budget, 0, 3);
+  budget.use(5.0, 5.0, 1.0);
+  EXPECT_EQ(budget.evict(5.0, 5.0, -1.0, 0.0, 1.0), (std::vector<std::string>{"3", "2"}));
+
+  // the evicted pieces near the vehicle are no longer reported, so that they are loaded again
+  budget.use(25.0, 5.0, 1.0);
+  EXPECT_EQ(budget.get_evicted_ids(), (std::vector<std::string>{"3"}));
+  add_pieces(budget, 2, 2);
+  EXPECT_EQ(budget.get_used_bytes(), 300U);
+}
@@ -0,0 +1,93 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "test_util.hpp"
+
+#include <autoware/ndt_scan_matcher/ndt_omp/multigrid_ndt_omp.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+
+// cspell:ignore multigrid
+
+using Ndt = pclomp::MultiGridNormalDistributionsTransform<pcl::PointXYZ, pcl::PointXYZ>;
+
+namespace
+{
+struct AlignResult
+{
+  pclomp::NdtResult result;
+  double score;
+};
+
+AlignResult align(const bool mixed_precision, const Eigen::Vector3f & map_offset)
+{
+  // the half cubic map moved far from the origin, as the maps are in a projected frame
+  pcl::PointCloud<pcl::PointXYZ>::Ptr map(new pcl::PointCloud<pcl::PointXYZ>);
+  for (const auto & point : make_sample_half_cubic_pcd()) {
+    map->push_back(pcl::PointXYZ(
+      point.x + map_offset.x(), point.y + map_offset.y(), point.z + map_offset.z()));
+  }
+
+  // the map seen from a sensor moved by (0.3, -0.2, 0.1)
+  pcl::PointCloud<pcl::PointXYZ>::Ptr scan(new pcl::PointCloud<pcl::PointXYZ>);
+  for (size_t i = 0; i < map->size(); i += 7) {
+    const auto & point = (*map)[i];
+    scan->push_back(pcl::PointXYZ(
+      point.x - map_offset.x() - 0.3f, point.y - map_offset.y() + 0.2f,
+      point.z - map_offset.z() - 0.1f));
+  }
+
+  Ndt ndt;
+  pclomp::NdtParams params = ndt.getParams();
+  params.resolution = 2.0f;
+  params.trans_epsilon = 0.01;
+  params.max_iterations = 30;
+  params.num_threads = 2;
+  params.mixed_precision = mixed_precision;
+  ndt.setParams(params);
+  ndt.setInputTarget(map);
+  ndt.setInputSource(scan);
+
+  pcl::PointCloud<pcl::PointXYZ> output;
+  Eigen::Matrix4f initial_pose = Eigen::Matrix4f::Identity();
+  initial_pose.block<3, 1>(0, 3) = map_offset;
+  ndt.align(output, initial_pose);
+  return {ndt.getResult(), ndt.getTransformationProbability()};
+}
+}  // namespace
+
+TEST(MixedPrecisionDerivativesTest, MatchDoublePrecision)
+{
+  for (const Eigen::Vector3f map_offset :
+       {Eigen::Vector3f(0.0f, 0.0f, 0.0f), Eigen::Vector3f(81000.0f, 49000.0f, 40.0f)}) {
+    const auto expected = align(false, map_offset);
+    const auto actual = align(true, map_offset);
+
+    const Eigen::Vector3f translation = actual.result.pose.block<3, 1>(0, 3) - map_offset;
+    EXPECT_NEAR(translation.x(), 0.3, 0.1);
+    EXPECT_NEAR(translation.y(), -0.2, 0.1);
+    EXPECT_NEAR(translation.z(), 0.1, 0.1);
+
+    // the poses differ by far less than trans_epsilon, plus a few ulps of the float pose
+    const Eigen::Vector3f difference =
+      actual.result.pose.block<3, 1>(0, 3) - expected.result.pose.block<3, 1>(0, 3);
+    const float tolerance =
+      1e-3f + 4.0f * map_offset.norm() * std::numeric_limits<float>::epsilon();
+    EXPECT_LT(difference.norm(), tolerance);
+    EXPECT_NEAR(actual.score, expected.score, 1e-3 * std::abs(expected.score));
+  }
+}
@@ -0,0 +1,132 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "test_util.hpp"
+
+#include <autoware/ndt_scan_matcher/ndt_omp/multigrid_ndt_omp.h>
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+// cspell:ignore multigrid ndtleaf
+
+using Grid = pclomp::MultiVoxelGridCovariance<pcl::PointXYZ>;
+using Ndt = pclomp::MultiGridNormalDistributionsTransform<pcl::PointXYZ, pcl::PointXYZ>;
+
+namespace
+{
+constexpr float resolution = 2.0f;
+}  // namespace
+
+class NdtLeafMapTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    map_.reset(new pcl::PointCloud<pcl::PointXYZ>(make_sample_half_cubic_pcd()));
+    path_ = (std::filesystem::temp_directory_path() /
+             ("test_ndt_leaf_map_" + std::to_string(::getpid()) + ".ndtleaf"))
+              .string();
+
+    computed_.setLeafSize(resolution, resolution, resolution);
+    computed_.setInputCloudAndFilter(map_, "map");
+    computed_.createKdtree();
+    ASSERT_TRUE(computed_.saveLeaves("map", path_));
+  }
+
+  void TearDown() override { std::filesystem::remove(path_); }
+
+  pcl::PointCloud<pcl::PointXYZ>::Ptr map_;
+  std::string path_;
+  Grid computed_;
+};
+
+TEST_F(NdtLeafMapTest, LoadedLeavesMatchTheComputedLeaves)
+{
+  Grid loaded;
+  loaded.setLeafSize(resolution, resolution, resolution);
+  ASSERT_TRUE(loaded.setInputLeavesFromFile(path_, "map"));
+  loaded.createKdtree();
+  EXPECT_EQ(loaded.getCurrentMapIDs(), computed_.getCurrentMapIDs());
+
+  std::vector<Grid::LeafConstPtr> computed_leaves;
+  std::vector<Grid::LeafConstPtr> loaded_leaves;
+  size_t found_num = 0;
+  for (const auto & centroid : computed_.getVoxelPCD()) {
+    computed_.directSearch(centroid, pclomp::DIRECT1, computed_leaves);
+    loaded.directSearch(centroid, pclomp::DIRECT1, loaded_leaves);
+    ASSERT_EQ(loaded_leaves.size(), computed_leaves.size());
+    for (size_t i = 0; i < loaded_leaves.size(); ++i) {
+      EXPECT_EQ(loaded_leaves[i]->nr_points_, computed_leaves[i]->nr_points_);
+      EXPECT_EQ(loaded_leaves[i]->centroid_, computed_leaves[i]->centroid_);
+      EXPECT_EQ(loaded_leaves[i]->getMean(), computed_leaves[i]->getMean());
+      EXPECT_EQ(loaded_leaves[i]->getInverseCov(), computed_leaves[i]->getInverseCov());
+    }
+    found_num += loaded_leaves.size();
+  }
+  EXPECT_GT(found_num, 0U);
+}
+
+TEST_F(NdtLeafMapTest, AlignOnTheLoadedLeaves)
+{
+  pcl::PointCloud<pcl::PointXYZ>::Ptr scan(new pcl::PointCloud<pcl::PointXYZ>);
+  for (size_t i = 0; i < map_->size(); i += 7) {
+    const auto & point = (*map_)[i];
+    scan->push_back(pcl::PointXYZ(point.x - 0.3f, point.y + 0.2f, point.z - 0.1f));
+  }
+
+  const auto align = [&](const bool from_file) {
+    Ndt ndt;
+    pclomp::NdtParams params = ndt.getParams();
+    params.resolution = resolution;
+    params.num_threads = 1;
+    ndt.setParams(params);
+    if (from_file) {
+      EXPECT_TRUE(ndt.addTargetLeaves(map_, path_, "map"));
+    } else {
+      ndt.addTarget(map_, "map");
+    }
+    ndt.createVoxelKdtree();
+    ndt.setInputSource(scan);
+    pcl::PointCloud<pcl::PointXYZ> output;
+    ndt.align(output, Eigen::Matrix4f::Identity());
+    return ndt.getResult().pose;
+  };
+
+  EXPECT_EQ(align(true), align(false));
+}
+
+TEST_F(NdtLeafMapTest, RejectOtherResolution)
+{
+  Grid loaded;
+  loaded.setLeafSize(2.0f * resolution, 2.0f * resolution, 2.0f * resolution);
+  EXPECT_FALSE(loaded.setInputLeavesFromFile(path_, "map"));
+  EXPECT_TRUE(loaded.getCurrentMapIDs().empty());
+}
+
+TEST_F(NdtLeafMapTest, RejectTruncatedFile)
+{
+  std::filesystem::resize_file(path_, std::filesystem::file_size(path_) - 1);
+  pclomp::NdtLeafMap leaf_map;
+  EXPECT_FALSE(leaf_map.open(path_));
+
+  Grid loaded;
+  loaded.setLeafSize(resolution, resolution, resolution);
+  EXPECT_FALSE(loaded.setInputLeavesFromFile(path_, "map"));
+  EXPECT_FALSE(loaded.setInputLeavesFromFile(path_ + ".missing", "map"));
+}
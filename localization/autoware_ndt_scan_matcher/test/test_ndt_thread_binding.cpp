@@ -0,0 +1,88 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "test_util.hpp"
+
+#include <autoware/ndt_scan_matcher/ndt_omp/multigrid_ndt_omp.h>
+
+#include <gtest/gtest.h>
+#include <pthread.h>
+#include <sched.h>
+
+// cspell:ignore multigrid
+
+using Ndt = pclomp::MultiGridNormalDistributionsTransform<pcl::PointXYZ, pcl::PointXYZ>;
+
+class NdtThreadBindingTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    pcl::PointCloud<pcl::PointXYZ>::Ptr map(
+      new pcl::PointCloud<pcl::PointXYZ>(make_sample_half_cubic_pcd()));
+
+    // the map seen from a sensor moved by (0.3, -0.2, 0.1)
+    pcl::PointCloud<pcl::PointXYZ>::Ptr scan(new pcl::PointCloud<pcl::PointXYZ>);
+    for (size_t i = 0; i < map->size(); i += 7) {
+      const auto & point = (*map)[i];
+      scan->push_back(pcl::PointXYZ(point.x - 0.3f, point.y + 0.2f, point.z - 0.1f));
+    }
+
+    pclomp::NdtParams params = ndt_.getParams();
+    params.resolution = 2.0f;
+    params.num_threads = 2;
+    ndt_.setParams(params);
+    ndt_.setInputTarget(map);
+    ndt_.setInputSource(scan);
+  }
+
+  Eigen::Matrix4f align(const int num_threads, const int first_cpu, const int thread_nice)
+  {
+    pclomp::NdtParams params = ndt_.getParams();
+    params.num_threads = num_threads;
+    params.first_cpu = first_cpu;
+    params.thread_nice = thread_nice;
+    ndt_.setParams(params);
+
+    pcl::PointCloud<pcl::PointXYZ> output;
+    ndt_.align(output, Eigen::Matrix4f::Identity());
+    return ndt_.getResult().pose;
+  }
+
+  Ndt ndt_;
+};
+
+TEST_F(NdtThreadBindingTest, ReusedBuffersGiveTheSameResult)
+{
+  const Eigen::Matrix4f expected = align(2, -1, 0);
+  EXPECT_EQ(align(2, -1, 0), expected);
+
+  // the buffers are resized, the result only differs by the summing up order
+  EXPECT_TRUE(align(3, -1, 0).isApprox(expected, 1e-5f));
+  EXPECT_TRUE(align(1, -1, 0).isApprox(expected, 1e-5f));
+}
+
+TEST_F(NdtThreadBindingTest, BindingDoesNotChangeTheResult)
+{
+  const Eigen::Matrix4f expected = align(2, -1, 0);
+  // raising the nice value is allowed to any user
+  EXPECT_EQ(align(2, 0, 1), expected);
+
+  // the calling thread is the first thread of the team
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  ASSERT_EQ(pthread_getaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set), 0);
+  EXPECT_EQ(CPU_COUNT(&cpu_set), 1);
+  EXPECT_TRUE(CPU_ISSET(0, &cpu_set));
+}
@@ -0,0 +1,103 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "test_util.hpp"
+
+#include <autoware/ndt_scan_matcher/ndt_omp/estimate_covariance.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+// cspell:ignore multigrid
+
+using Ndt = pclomp::MultiGridNormalDistributionsTransform<pcl::PointXYZ, pcl::PointXYZ>;
+
+class ParallelCovarianceEstimationTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    pcl::PointCloud<pcl::PointXYZ>::Ptr map(
+      new pcl::PointCloud<pcl::PointXYZ>(make_sample_half_cubic_pcd()));
+    pcl::PointCloud<pcl::PointXYZ>::Ptr scan(new pcl::PointCloud<pcl::PointXYZ>);
+    for (size_t i = 0; i < map->size(); i += 7) {
+      scan->push_back((*map)[i]);
+    }
+
+    ndt_ptr_ = std::make_shared<Ndt>();
+    pclomp::NdtParams params = ndt_ptr_->getParams();
+    params.resolution = 2.0f;
+    params.num_threads = 4;
+    ndt_ptr_->setParams(params);
+    ndt_ptr_->setInputTarget(map);
+    ndt_ptr_->setInputSource(scan);
+
+    pcl::PointCloud<pcl::PointXYZ> output;
+    ndt_ptr_->align(output, Eigen::Matrix4f::Identity());
+    ndt_result_ = ndt_ptr_->getResult();
+    poses_to_search_ = pclomp::propose_poses_to_search(
+      ndt_result_, {0.0, 0.0, 0.5, -0.5, 1.0, -1.0}, {0.5, -0.5, 0.0, 0.0, 0.0, 0.0});
+  }
+
+  std::shared_ptr<Ndt> ndt_ptr_;
+  pclomp::NdtResult ndt_result_;
+  std::vector<Eigen::Matrix4f> poses_to_search_;
+};
+
+TEST_F(ParallelCovarianceEstimationTest, MultiNdtMatchesSequentialSearches)
+{
+  const auto result =
+    pclomp::estimate_xy_covariance_by_multi_ndt(ndt_result_, ndt_ptr_, poses_to_search_);
+  ASSERT_EQ(result.ndt_initial_poses.size(), poses_to_search_.size());
+  ASSERT_EQ(result.ndt_results.size(), poses_to_search_.size());
+
+  for (size_t i = 0; i < poses_to_search_.size(); ++i) {
+    EXPECT_EQ(result.ndt_initial_poses[i], poses_to_search_[i]);
+
+    Ndt ndt(*ndt_ptr_);
+    pclomp::NdtParams params = ndt.getParams();
+    params.num_threads = 1;
+    ndt.setParams(params);
+    pcl::PointCloud<pcl::PointXYZ> output;
+    ndt.align(output, poses_to_search_[i]);
+    EXPECT_TRUE(result.ndt_results[i].pose.isApprox(ndt.getResult().pose, 1e-5f));
+  }
+}
+
+TEST_F(ParallelCovarianceEstimationTest, MultiNdtScoreMatchesSequentialScores)
+{
+  const auto result = pclomp::estimate_xy_covariance_by_multi_ndt_score(
+    ndt_result_, ndt_ptr_, poses_to_search_, 0.05);
+  ASSERT_EQ(result.ndt_results.size(), poses_to_search_.size());
+
+  for (size_t i = 0; i < poses_to_search_.size(); ++i) {
+    pcl::PointCloud<pcl::PointXYZ> trans_cloud;
+    transformPointCloud(*ndt_ptr_->getInputCloud(), trans_cloud, poses_to_search_[i]);
+    EXPECT_NEAR(
+      result.ndt_results[i].nearest_voxel_transformation_likelihood,
+      ndt_ptr_->calculateNearestVoxelTransformationLikelihood(trans_cloud), 1e-5);
+  }
+}
+
+TEST_F(ParallelCovarianceEstimationTest, TimeBudgetKeepsTheFinishedSearches)
+{
+  // a budget too short for most searches, the covariance comes from the finished ones
+  const auto result = pclomp::estimate_xy_covariance_by_multi_ndt(
+    ndt_result_, ndt_ptr_, poses_to_search_, 1e-6);
+  EXPECT_LE(result.ndt_initial_poses.size(), poses_to_search_.size());
+  EXPECT_EQ(result.ndt_initial_poses.size(), result.ndt_results.size());
+  EXPECT_TRUE(result.covariance.allFinite());
+}
@@ -38,16 +38,11 @@ void EkfLocalizationTriggerModule::wait_for_service()
   RCLCPP_INFO(node_->get_logger(), "EKF triggering service is available!");
 }
 
-void EkfLocalizationTriggerModule::send_request(bool flag, bool need_spin) const
+EkfLocalizationTriggerModule::SharedFuture EkfLocalizationTriggerModule::async_send_request(
+  bool flag) const
 {
   const auto req = std::make_shared<SetBool::Request>();
-  std::string command_name;
   req->data = flag;
-  if (flag) {
-    command_name = "Activation";
-  } else {
-    command_name = "Deactivation";
-  }
 
   if (!client_ekf_trigger_->service_is_ready()) {
     autoware_adapi_v1_msgs::msg::ResponseStatus respose_status;
@@ -57,13 +52,19 @@ void EkfLocalizationTriggerModule::send_request(bool flag, bool need_spin) const
     throw respose_status;
   }
 
-  auto future_ekf = client_ekf_trigger_->async_send_request(req);
+  return client_ekf_trigger_->async_send_request(req).share();
+}
+
+void EkfLocalizationTriggerModule::wait_response(
+  const SharedFuture & future, bool flag, bool need_spin) const
+{
+  const std::string command_name = flag ? "Activation" : "Deactivation";
 
   if (need_spin) {
-    rclcpp::spin_until_future_complete(node_->get_node_base_interface(), future_ekf);
+    rclcpp::spin_until_future_complete(node_->get_node_base_interface(), future);
   }
 
-  if (future_ekf.get()->success) {
+  if (future.get()->success) {
     RCLCPP_INFO(node_->get_logger(), "EKF %s succeeded", command_name.c_str());
   } else {
     RCLCPP_INFO(node_->get_logger(), "EKF %s failed", command_name.c_str());
@@ -34,6 +34,12 @@ LocalizationModule::LocalizationModule(rclcpp::Node * node, const std::string &
 
 std::tuple<PoseWithCovarianceStamped, bool> LocalizationModule::align_pose(
   const PoseWithCovarianceStamped & pose)
+{
+  return get_aligned_pose(async_align_pose(pose));
+}
+
+LocalizationModule::SharedFuture LocalizationModule::async_align_pose(
+  const PoseWithCovarianceStamped & pose)
 {
   const auto req = std::make_shared<RequestPoseAlignment::Request>();
   req->pose_with_covariance = pose;
@@ -47,7 +53,13 @@ std::tuple<PoseWithCovarianceStamped, bool> LocalizationModule::align_pose(
   }
 
   RCLCPP_INFO(logger_, "Call align server.");
-  const auto res = cli_align_->async_send_request(req).get();
+  return cli_align_->async_send_request(req).share();
+}
+
+std::tuple<PoseWithCovarianceStamped, bool> LocalizationModule::get_aligned_pose(
+  const SharedFuture & future)
+{
+  const auto res = future.get();
   if (!res->success) {
     autoware_adapi_v1_msgs::msg::ResponseStatus respose_status;
     respose_status.success = false;
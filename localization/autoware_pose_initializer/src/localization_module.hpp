@@ -32,8 +32,13 @@ private:
   using RequestPoseAlignment = autoware_internal_localization_msgs::srv::PoseWithCovarianceStamped;
 
 public:
+  using SharedFuture = rclcpp::Client<RequestPoseAlignment>::SharedFuture;
+
   LocalizationModule(rclcpp::Node * node, const std::string & service_name);
   std::tuple<PoseWithCovarianceStamped, bool> align_pose(const PoseWithCovarianceStamped & pose);
+  // Send the align request without waiting for the result, which is returned by get_aligned_pose
+  SharedFuture async_align_pose(const PoseWithCovarianceStamped & pose);
+  std::tuple<PoseWithCovarianceStamped, bool> get_aligned_pose(const SharedFuture & future);
 
 private:
   rclcpp::Logger logger_;
@@ -38,16 +38,11 @@ void NdtLocalizationTriggerModule::wait_for_service()
   RCLCPP_INFO(node_->get_logger(), "NDT triggering service is available!");
 }
 
-void NdtLocalizationTriggerModule::send_request(bool flag, bool need_spin) const
+NdtLocalizationTriggerModule::SharedFuture NdtLocalizationTriggerModule::async_send_request(
+  bool flag) const
 {
   const auto req = std::make_shared<SetBool::Request>();
-  std::string command_name;
   req->data = flag;
-  if (flag) {
-    command_name = "Activation";
-  } else {
-    command_name = "Deactivation";
-  }
 
   if (!client_ndt_trigger_->service_is_ready()) {
     autoware_adapi_v1_msgs::msg::ResponseStatus respose_status;
@@ -57,13 +52,19 @@ void NdtLocalizationTriggerModule::send_request(bool flag, bool need_spin) const
     throw respose_status;
   }
 
-  auto future_ndt = client_ndt_trigger_->async_send_request(req);
+  return client_ndt_trigger_->async_send_request(req).share();
+}
+
+void NdtLocalizationTriggerModule::wait_response(
+  const SharedFuture & future, bool flag, bool need_spin) const
+{
+  const std::string command_name = flag ? "Activation" : "Deactivation";
 
   if (need_spin) {
-    rclcpp::spin_until_future_complete(node_->get_node_base_interface(), future_ndt);
+    rclcpp::spin_until_future_complete(node_->get_node_base_interface(), future);
   }
 
-  if (future_ndt.get()->success) {
+  if (future.get()->success) {
     RCLCPP_INFO(node_->get_logger(), "NDT %s succeeded", command_name.c_str());
   } else {
     RCLCPP_INFO(node_->get_logger(), "NDT %s failed", command_name.c_str());
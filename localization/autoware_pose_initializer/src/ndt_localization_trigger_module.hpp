@@ -27,9 +27,13 @@ private:
   using SetBool = std_srvs::srv::SetBool;
 
 public:
+  using SharedFuture = rclcpp::Client<SetBool>::SharedFuture;
+
   explicit NdtLocalizationTriggerModule(rclcpp::Node * node);
   void wait_for_service();
-  void send_request(bool flag, bool need_spin = false) const;
+  // Send the request without waiting for the response, which is checked by wait_response
+  SharedFuture async_send_request(bool flag) const;
+  void wait_response(const SharedFuture & future, bool flag, bool need_spin = false) const;
 
 private:
   rclcpp::Node * node_;
@@ -24,12 +24,23 @@
 
 #include <autoware_adapi_v1_msgs/msg/response_status.hpp>
 
+#include <chrono>
 #include <memory>
+#include <optional>
 #include <sstream>
 #include <vector>
 
 namespace autoware::pose_initializer
 {
+namespace
+{
+double get_elapsed_time_ms(const std::chrono::steady_clock::time_point & start_time)
+{
+  const auto elapsed = std::chrono::steady_clock::now() - start_time;
+  return std::chrono::duration<double, std::milli>(elapsed).count();
+}
+}  // namespace
+
 PoseInitializer::PoseInitializer(const rclcpp::NodeOptions & options)
 : rclcpp::Node("pose_initializer", options),
   group_srv_(create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive))
@@ -113,17 +124,32 @@ void PoseInitializer::change_state(State::Message::_state_type state)
 // Conversely, ros spin should not be called elsewhere
 void PoseInitializer::change_node_trigger(bool flag, bool need_spin)
 {
-  try {
-    if (ekf_localization_trigger_) {
-      ekf_localization_trigger_->wait_for_service();
-      ekf_localization_trigger_->send_request(flag, need_spin);
-    }
-    if (ndt_localization_trigger_) {
-      ndt_localization_trigger_->wait_for_service();
-      ndt_localization_trigger_->send_request(flag, need_spin);
-    }
-  } catch (const autoware_adapi_v1_msgs::msg::ResponseStatus & error) {
-    throw;
+  wait_node_trigger(send_node_trigger(flag), flag, need_spin);
+}
+
+PoseInitializer::NodeTriggerFutures PoseInitializer::send_node_trigger(bool flag)
+{
+  // The EKF and NDT triggers are independent, so that both requests are sent before waiting
+  NodeTriggerFutures futures;
+  if (ekf_localization_trigger_) {
+    ekf_localization_trigger_->wait_for_service();
+    futures.ekf = ekf_localization_trigger_->async_send_request(flag);
+  }
+  if (ndt_localization_trigger_) {
+    ndt_localization_trigger_->wait_for_service();
+    futures.ndt = ndt_localization_trigger_->async_send_request(flag);
+  }
+  return futures;
+}
+
+void PoseInitializer::wait_node_trigger(
+  const NodeTriggerFutures & futures, bool flag, bool need_spin)
+{
+  if (futures.ekf.valid()) {
+    ekf_localization_trigger_->wait_response(futures.ekf, flag, need_spin);
+  }
+  if (futures.ndt.valid()) {
+    ndt_localization_trigger_->wait_response(futures.ndt, flag, need_spin);
   }
 }
 
@@ -166,29 +192,49 @@ void PoseInitializer::on_initialize(
     }
 
     if (req->method == Initialize::Service::Request::AUTO) {
+      // The stages are overlapped where they do not depend on each other:
+      // - the GNSS pose is fitted to the map while the nodes are deactivated,
+      // - the GNSS pose to check the result is fitted while the pose is aligned,
+      // while the align waits for both the initial pose and the deactivation.
+      const auto start_time = std::chrono::steady_clock::now();
       change_state(State::Message::INITIALIZING);
-      change_node_trigger(false, false);
+      const auto deactivation = send_node_trigger(false);
 
       auto pose =
         req->pose_with_covariance.empty() ? get_gnss_pose() : req->pose_with_covariance.front();
+      const double initial_pose_time_ms = get_elapsed_time_ms(start_time);
+
+      wait_node_trigger(deactivation, false);
+      const double deactivation_time_ms = get_elapsed_time_ms(start_time);
+
+      // If both the NDT and YabLoc initializer are enabled, prioritize NDT as it offers more
+      // accuracy pose.
+      LocalizationModule * const localization = ndt_ ? ndt_.get() : yabloc_.get();
+      const auto align_start_time = std::chrono::steady_clock::now();
+      const auto aligned = localization ? localization->async_align_pose(pose)
+                                        : LocalizationModule::SharedFuture{};
+
+      std::optional<PoseWithCovarianceStamped> latest_gnss_pose;
+      if (pose_error_check_ && gnss_) {
+        latest_gnss_pose = get_gnss_pose();
+      }
+
       bool reliable = true;
-      if (ndt_) {
-        std::tie(pose, reliable) = ndt_->align_pose(pose);
-      } else if (yabloc_) {
-        // If both the NDT and YabLoc initializer are enabled, prioritize NDT as it offers more
-        // accuracy pose.
-        std::tie(pose, reliable) = yabloc_->align_pose(pose);
+      if (aligned.valid()) {
+        std::tie(pose, reliable) = localization->get_aligned_pose(aligned);
       }
+      const double align_time_ms = get_elapsed_time_ms(align_start_time);
 
       diagnostics_pose_reliable_->clear();
+      diagnostics_pose_reliable_->add_key_value("initial_pose_time_ms", initial_pose_time_ms);
+      diagnostics_pose_reliable_->add_key_value("deactivation_time_ms", deactivation_time_ms);
+      diagnostics_pose_reliable_->add_key_value("align_time_ms", align_time_ms);
 
       // check pose error between gnss pose and initial pose result
-      if (pose_error_check_ && gnss_) {
-        const auto latest_gnss_pose = get_gnss_pose();
-
+      if (latest_gnss_pose) {
         double gnss_error_2d;
         const bool is_gnss_pose_error_small = pose_error_check_->check_pose_error(
-          latest_gnss_pose.pose.pose, pose.pose.pose, gnss_error_2d);
+          latest_gnss_pose->pose.pose, pose.pose.pose, gnss_error_2d);
 
         diagnostics_pose_reliable_->add_key_value("gnss_pose_error_2d", gnss_error_2d);
         diagnostics_pose_reliable_->add_key_value(
@@ -213,10 +259,18 @@ void PoseInitializer::on_initialize(
       pose.pose.covariance = output_pose_covariance_;
       pub_reset_->publish(pose);
 
+      const auto activation_start_time = std::chrono::steady_clock::now();
       change_node_trigger(true, false);
       res->status.success = true;
       change_state(State::Message::INITIALIZED);
 
+      RCLCPP_INFO(
+        get_logger(),
+        "Initialized in %.1f [ms] (initial pose: %.1f, deactivation: %.1f, align: %.1f, "
+        "activation: %.1f)",
+        get_elapsed_time_ms(start_time), initial_pose_time_ms, deactivation_time_ms, align_time_ms,
+        get_elapsed_time_ms(activation_start_time));
+
     } else if (req->method == Initialize::Service::Request::DIRECT) {
       if (req->pose_with_covariance.empty()) {
         std::stringstream message;
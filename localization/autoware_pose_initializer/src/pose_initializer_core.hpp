@@ -23,6 +23,7 @@
 #include <autoware_adapi_v1_msgs/msg/localization_initialization_state.hpp>
 #include <autoware_internal_localization_msgs/srv/initialize_localization.hpp>
 #include <geometry_msgs/msg/pose_with_covariance_stamped.hpp>
+#include <std_srvs/srv/set_bool.hpp>
 
 #include <memory>
 #include <string>
@@ -45,6 +46,14 @@ private:
   using Initialize = autoware::component_interface_specs::localization::Initialize;
   using State = autoware::component_interface_specs::localization::InitializationState;
   using PoseWithCovarianceStamped = geometry_msgs::msg::PoseWithCovarianceStamped;
+  using TriggerFuture = rclcpp::Client<std_srvs::srv::SetBool>::SharedFuture;
+
+  // Responses of the node triggers, not valid for the disabled modules
+  struct NodeTriggerFutures
+  {
+    TriggerFuture ekf;
+    TriggerFuture ndt;
+  };
 
   rclcpp::CallbackGroup::SharedPtr group_srv_;
   rclcpp::Publisher<PoseWithCovarianceStamped>::SharedPtr pub_reset_;
@@ -65,6 +74,8 @@ private:
   double stop_check_duration_;
 
   void change_node_trigger(bool flag, bool need_spin = false);
+  NodeTriggerFutures send_node_trigger(bool flag);
+  void wait_node_trigger(const NodeTriggerFutures & futures, bool flag, bool need_spin = false);
   void set_user_defined_initial_pose(
     const geometry_msgs::msg::Pose initial_pose, bool need_spin = false);
   void change_state(State::Message::_state_type state);
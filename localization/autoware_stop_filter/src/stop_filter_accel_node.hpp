@@ -0,0 +1,59 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef STOP_FILTER_ACCEL_NODE_HPP_
+#define STOP_FILTER_ACCEL_NODE_HPP_
+
+#include "stop_filter_node.hpp"
+
+#include <autoware/twist2accel/accel_estimator.hpp>
+#include <rclcpp/rclcpp.hpp>
+
+#include <autoware_internal_debug_msgs/msg/bool_stamped.hpp>
+#include <geometry_msgs/msg/accel_with_covariance_stamped.hpp>
+#include <nav_msgs/msg/odometry.hpp>
+
+namespace autoware::stop_filter
+{
+/**
+ * @brief Applies the stop filter to the odometry and estimates the acceleration from the filtered
+ * twist in the same callback.
+ *
+ * It replaces the pair of StopFilterNode and autoware_twist2accel with use_odom, which subscribes
+ * to the output of StopFilterNode, with the same topics, parameters and outputs.
+ */
+class StopFilterAccelNode : public rclcpp::Node
+{
+public:
+  explicit StopFilterAccelNode(const rclcpp::NodeOptions & node_options);
+
+private:
+  rclcpp::Publisher<nav_msgs::msg::Odometry>::SharedPtr pub_odom_;  //!< @brief odom publisher
+  rclcpp::Publisher<autoware_internal_debug_msgs::msg::BoolStamped>::SharedPtr
+    pub_stop_flag_;  //!< @brief stop flag publisher
+  rclcpp::Publisher<geometry_msgs::msg::AccelWithCovarianceStamped>::SharedPtr
+    pub_accel_;  //!< @brief acceleration publisher
+  rclcpp::Subscription<nav_msgs::msg::Odometry>::SharedPtr
+    sub_odom_;  //!< @brief measurement odometry subscriber
+
+  StopFilterProcessor message_processor_;
+  autoware::twist2accel::AccelEstimator accel_estimator_;
+
+  /**
+   * @brief set odometry measurement
+   */
+  void callback_odometry(const nav_msgs::msg::Odometry::SharedPtr msg);
+};
+}  // namespace autoware::stop_filter
+#endif  // STOP_FILTER_ACCEL_NODE_HPP_
@@ -0,0 +1,62 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__TWIST2ACCEL__ACCEL_ESTIMATOR_HPP_
+#define AUTOWARE__TWIST2ACCEL__ACCEL_ESTIMATOR_HPP_
+
+#include "autoware/signal_processing/lowpass_filter_bank.hpp"
+
+#include <geometry_msgs/msg/accel_with_covariance_stamped.hpp>
+#include <geometry_msgs/msg/twist.hpp>
+#include <std_msgs/msg/header.hpp>
+
+#include <optional>
+
+namespace autoware::twist2accel
+{
+/**
+ * @brief Estimates the acceleration from consecutive twists, with a first order lowpass filter on
+ * each of the linear and angular components.
+ *
+ * It does not depend on rclcpp::Node so that the nodes which already receive the twist can
+ * estimate the acceleration in the same callback instead of through an extra topic.
+ */
+class AccelEstimator
+{
+public:
+  explicit AccelEstimator(const double lowpass_gain);
+
+  /**
+   * @brief Updates the estimation with a new twist.
+   * @param header The header of the twist, whose stamp gives the time step.
+   * @param twist The twist.
+   * @return The filtered acceleration with the header of the twist. It is zero, with a zero
+   * covariance, for the first twist.
+   */
+  geometry_msgs::msg::AccelWithCovarianceStamped update(
+    const std_msgs::msg::Header & header, const geometry_msgs::msg::Twist & twist);
+
+private:
+  struct StampedTwist
+  {
+    double stamp;  // [s]
+    geometry_msgs::msg::Twist twist;
+  };
+
+  autoware::signal_processing::LowpassFilterBank lpf_accel_;
+  std::optional<StampedTwist> prev_twist_;
+};
+}  // namespace autoware::twist2accel
+
+#endif  // AUTOWARE__TWIST2ACCEL__ACCEL_ESTIMATOR_HPP_
@@ -0,0 +1,67 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/twist2accel/accel_estimator.hpp"
+
+#include <rclcpp/time.hpp>
+
+#include <algorithm>
+#include <array>
+
+namespace autoware::twist2accel
+{
+using autoware::signal_processing::LowpassFilterBank;
+
+AccelEstimator::AccelEstimator(const double lowpass_gain)
+: lpf_accel_(LowpassFilterBank::createFirstOrder(6, lowpass_gain))
+{
+}
+
+geometry_msgs::msg::AccelWithCovarianceStamped AccelEstimator::update(
+  const std_msgs::msg::Header & header, const geometry_msgs::msg::Twist & twist)
+{
+  geometry_msgs::msg::AccelWithCovarianceStamped accel_msg;
+  accel_msg.header = header;
+
+  const double stamp = rclcpp::Time(header.stamp).seconds();
+  if (prev_twist_) {
+    const double dt = std::max(stamp - prev_twist_->stamp, 1.0e-3);
+    const auto & prev = prev_twist_->twist;
+
+    std::array<double, 6> accel{
+      (twist.linear.x - prev.linear.x) / dt,   (twist.linear.y - prev.linear.y) / dt,
+      (twist.linear.z - prev.linear.z) / dt,   (twist.angular.x - prev.angular.x) / dt,
+      (twist.angular.y - prev.angular.y) / dt, (twist.angular.z - prev.angular.z) / dt};
+    lpf_accel_.filter(accel.data(), accel.data());
+
+    accel_msg.accel.accel.linear.x = accel[0];
+    accel_msg.accel.accel.linear.y = accel[1];
+    accel_msg.accel.accel.linear.z = accel[2];
+    accel_msg.accel.accel.angular.x = accel[3];
+    accel_msg.accel.accel.angular.y = accel[4];
+    accel_msg.accel.accel.angular.z = accel[5];
+
+    // Ideally speaking, these covariance should be properly estimated.
+    accel_msg.accel.covariance[0 * 6 + 0] = 1.0;
+    accel_msg.accel.covariance[1 * 6 + 1] = 1.0;
+    accel_msg.accel.covariance[2 * 6 + 2] = 1.0;
+    accel_msg.accel.covariance[3 * 6 + 3] = 0.05;
+    accel_msg.accel.covariance[4 * 6 + 4] = 0.05;
+    accel_msg.accel.covariance[5 * 6 + 5] = 0.05;
+  }
+
+  prev_twist_ = StampedTwist{stamp, twist};
+  return accel_msg;
+}
+}  // namespace autoware::twist2accel
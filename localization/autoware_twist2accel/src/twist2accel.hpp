@@ -15,7 +15,7 @@
 #ifndef TWIST2ACCEL_HPP_
 #define TWIST2ACCEL_HPP_
 
-#include "autoware/signal_processing/lowpass_filter_1d.hpp"
+#include "autoware/twist2accel/accel_estimator.hpp"
 
 #include <rclcpp/rclcpp.hpp>
 #include <tf2/LinearMath/Quaternion.hpp>
@@ -31,12 +31,11 @@
 #include <iostream>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <queue>
 #include <string>
 #include <vector>
 
-using autoware::signal_processing::LowpassFilter1d;
-
 namespace autoware::twist2accel
 {
 class Twist2Accel : public rclcpp::Node
@@ -52,15 +51,8 @@ private:
   rclcpp::Subscription<geometry_msgs::msg::TwistWithCovarianceStamped>::SharedPtr
     sub_twist_;  //!< @brief measurement odometry subscriber
 
-  geometry_msgs::msg::TwistStamped::SharedPtr prev_twist_ptr_;
-  double accel_lowpass_gain_;
   bool use_odom_;
-  std::shared_ptr<LowpassFilter1d> lpf_aax_ptr_;
-  std::shared_ptr<LowpassFilter1d> lpf_aay_ptr_;
-  std::shared_ptr<LowpassFilter1d> lpf_aaz_ptr_;
-  std::shared_ptr<LowpassFilter1d> lpf_alx_ptr_;
-  std::shared_ptr<LowpassFilter1d> lpf_aly_ptr_;
-  std::shared_ptr<LowpassFilter1d> lpf_alz_ptr_;
+  std::optional<AccelEstimator> accel_estimator_;
 
   /**
    * @brief set odometry measurement
@@ -68,7 +60,6 @@ private:
   void callback_twist_with_covariance(
     const geometry_msgs::msg::TwistWithCovarianceStamped::SharedPtr msg);
   void callback_odometry(const nav_msgs::msg::Odometry::SharedPtr msg);
-  void estimate_accel(const geometry_msgs::msg::TwistStamped::SharedPtr msg);
 };
 }  // namespace autoware::twist2accel
 #endif  // TWIST2ACCEL_HPP_
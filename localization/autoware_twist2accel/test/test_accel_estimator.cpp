@@ -0,0 +1,81 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/twist2accel/accel_estimator.hpp"
+
+#include <gtest/gtest.h>
+
+using autoware::twist2accel::AccelEstimator;
+
+namespace
+{
+std_msgs::msg::Header make_header(const int32_t sec, const uint32_t nanosec)
+{
+  std_msgs::msg::Header header;
+  header.frame_id = "base_link";
+  header.stamp.sec = sec;
+  header.stamp.nanosec = nanosec;
+  return header;
+}
+
+geometry_msgs::msg::Twist make_twist(const double vx, const double wz)
+{
+  geometry_msgs::msg::Twist twist;
+  twist.linear.x = vx;
+  twist.angular.z = wz;
+  return twist;
+}
+}  // namespace
+
+TEST(AccelEstimatorTest, FirstTwistGivesZeroAccel)
+{
+  AccelEstimator estimator(0.9);
+  const auto accel = estimator.update(make_header(1, 0), make_twist(5.0, 0.1));
+
+  EXPECT_EQ(accel.header.frame_id, "base_link");
+  EXPECT_EQ(accel.header.stamp.sec, 1);
+  EXPECT_DOUBLE_EQ(accel.accel.accel.linear.x, 0.0);
+  EXPECT_DOUBLE_EQ(accel.accel.accel.angular.z, 0.0);
+  EXPECT_DOUBLE_EQ(accel.accel.covariance[0], 0.0);
+}
+
+TEST(AccelEstimatorTest, ConstantAccelWithoutFilter)
+{
+  // a zero gain disables the lowpass filter
+  AccelEstimator estimator(0.0);
+  estimator.update(make_header(0, 0), make_twist(0.0, 0.0));
+  for (int i = 1; i <= 5; ++i) {
+    const auto accel =
+      estimator.update(make_header(0, i * 100000000), make_twist(0.2 * i, 0.01 * i));
+    EXPECT_NEAR(accel.accel.accel.linear.x, 2.0, 1e-6);
+    EXPECT_NEAR(accel.accel.accel.angular.z, 0.1, 1e-6);
+    EXPECT_DOUBLE_EQ(accel.accel.covariance[0 * 6 + 0], 1.0);
+    EXPECT_DOUBLE_EQ(accel.accel.covariance[5 * 6 + 5], 0.05);
+  }
+}
+
+TEST(AccelEstimatorTest, LowpassFilterConverges)
+{
+  AccelEstimator estimator(0.9);
+  estimator.update(make_header(0, 0), make_twist(0.0, 0.0));
+  double prev_accel = 0.0;
+  for (int i = 1; i <= 100; ++i) {
+    const auto accel = estimator.update(make_header(0, i * 10000000), make_twist(0.01 * i, 0.0));
+    // the filtered acceleration rises monotonically towards the true one
+    EXPECT_GE(accel.accel.accel.linear.x, prev_accel);
+    EXPECT_LE(accel.accel.accel.linear.x, 1.0 + 1e-6);
+    prev_accel = accel.accel.accel.linear.x;
+  }
+  EXPECT_NEAR(prev_accel, 1.0, 1e-3);
+}
@@ -33,8 +33,8 @@
 
 #include "lanelet2_map_visualization_node.hpp"
 
+#include <autoware/lanelet2_utils/map_registry.hpp>
 #include <autoware_lanelet2_extension/regulatory_elements/autoware_traffic_light.hpp>
-#include <autoware_lanelet2_extension/utility/message_conversion.hpp>
 #include <autoware_lanelet2_extension/utility/query.hpp>
 #include <autoware_lanelet2_extension/visualization/visualization.hpp>
 #include <rclcpp/rclcpp.hpp>
@@ -46,15 +46,69 @@
 #include <lanelet2_core/LaneletMap.h>
 #include <lanelet2_projection/UTM.h>
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <iterator>
 #include <memory>
+#include <thread>
+#include <utility>
 #include <vector>
 
 namespace autoware::lanelet2_map_visualizer
 {
 void insert_marker_array(
-  visualization_msgs::msg::MarkerArray * a1, const visualization_msgs::msg::MarkerArray & a2)
+  visualization_msgs::msg::MarkerArray * a1, visualization_msgs::msg::MarkerArray && a2)
 {
-  a1->markers.insert(a1->markers.end(), a2.markers.begin(), a2.markers.end());
+  a1->markers.insert(
+    a1->markers.end(), std::make_move_iterator(a2.markers.begin()),
+    std::make_move_iterator(a2.markers.end()));
+}
+
+visualization_msgs::msg::MarkerArray build_marker_array(
+  const std::vector<std::function<visualization_msgs::msg::MarkerArray()>> & layers)
+{
+  std::vector<visualization_msgs::msg::MarkerArray> layer_marker_arrays(layers.size());
+  std::vector<std::exception_ptr> errors(layers.size());
+  std::atomic<size_t> next_index{0};
+  const auto build_next_layers = [&]() {
+    for (size_t i = next_index++; i < layers.size(); i = next_index++) {
+      try {
+        layer_marker_arrays[i] = layers[i]();
+      } catch (...) {
+        errors[i] = std::current_exception();
+      }
+    }
+  };
+
+  // the calling thread is one of the building threads
+  const size_t thread_num =
+    std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()), layers.size());
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < thread_num; ++i) {
+    threads.emplace_back(build_next_layers);
+  }
+  build_next_layers();
+  for (auto & thread : threads) {
+    thread.join();
+  }
+  for (const auto & error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+
+  visualization_msgs::msg::MarkerArray marker_array;
+  size_t marker_num = 0;
+  for (const auto & layer_marker_array : layer_marker_arrays) {
+    marker_num += layer_marker_array.markers.size();
+  }
+  marker_array.markers.reserve(marker_num);
+  for (auto & layer_marker_array : layer_marker_arrays) {
+    insert_marker_array(&marker_array, std::move(layer_marker_array));
+  }
+  return marker_array;
 }
 
 void set_color(std_msgs::msg::ColorRGBA * cl, double r, double g, double b, double a)
@@ -83,9 +137,8 @@ Lanelet2MapVisualizationNode::Lanelet2MapVisualizationNode(const rclcpp::NodeOpt
 void Lanelet2MapVisualizationNode::on_map_bin(
   const autoware_map_msgs::msg::LaneletMapBin::ConstSharedPtr msg)
 {
-  lanelet::LaneletMapPtr viz_lanelet_map(new lanelet::LaneletMap);
-
-  lanelet::utils::conversion::fromBinMsg(*msg, viz_lanelet_map);
+  const lanelet::LaneletMapPtr viz_lanelet_map =
+    autoware::experimental::lanelet2_utils::get_shared_lanelet_map(*msg).lanelet_map;
   RCLCPP_INFO(this->get_logger(), "Map is loaded\n");
 
   // get lanelets etc to visualize
@@ -137,6 +190,12 @@ void Lanelet2MapVisualizationNode::on_map_bin(
     lanelet::utils::query::busStopAreas(all_lanelets);
   lanelet::ConstLineStrings3d waypoints = lanelet::utils::query::getAllWaypoints(viz_lanelet_map);
 
+  // the lanelets compute their centerline on the first access and cache it, so they are computed
+  // here before the lanelets are read by the threads building the layers
+  for (const auto & lanelet : all_lanelets) {
+    static_cast<void>(lanelet.centerline());
+  }
+
   std_msgs::msg::ColorRGBA cl_road;
   std_msgs::msg::ColorRGBA cl_shoulder;
   std_msgs::msg::ColorRGBA cl_cross;
@@ -194,137 +253,155 @@ void Lanelet2MapVisualizationNode::on_map_bin(
   set_color(&cl_bicycle_lane, 0.0, 0.3843, 0.6274, 0.5);
   set_color(&cl_waypoints, 0.6, 0.4, 0.3, 0.999);
 
-  visualization_msgs::msg::MarkerArray map_marker_array;
-
-  insert_marker_array(
-    &map_marker_array,
-    lanelet::visualization::lineStringsAsMarkerArray(stop_lines, "stop_lines", cl_stoplines, 0.5));
-  insert_marker_array(
-    &map_marker_array,
-    lanelet::visualization::lineStringsAsMarkerArray(partitions, "partitions", cl_partitions, 0.1));
-  insert_marker_array(
-    &map_marker_array, lanelet::visualization::lineStringsAsMarkerArray(
-                         road_borders, "road_borders", cl_road_borders, 0.2));
-  insert_marker_array(
-    &map_marker_array,
-    lanelet::visualization::laneletDirectionAsMarkerArray(shoulder_lanelets, "shoulder_"));
-  insert_marker_array(
-    &map_marker_array, lanelet::visualization::laneletDirectionAsMarkerArray(road_lanelets));
-  insert_marker_array(
-    &map_marker_array, lanelet::visualization::laneletsAsTriangleMarkerArray(
-                         "crosswalk_lanelets", crosswalk_lanelets, cl_cross));
-  insert_marker_array(
-    &map_marker_array, lanelet::visualization::pedestrianPolygonMarkingsAsMarkerArray(
-                         pedestrian_polygon_markings, cl_pedestrian_markings));
-
-  insert_marker_array(
-    &map_marker_array, lanelet::visualization::pedestrianLineMarkingsAsMarkerArray(
-                         pedestrian_line_markings, cl_pedestrian_markings));
-  insert_marker_array(
-    &map_marker_array, lanelet::visualization::laneletsAsTriangleMarkerArray(
-                         "walkway_lanelets", walkway_lanelets, cl_cross));
-  insert_marker_array(
-    &map_marker_array,
-    lanelet::visualization::obstaclePolygonsAsMarkerArray(obstacle_polygons, cl_obstacle_polygons));
-  insert_marker_array(
-    &map_marker_array,
-    lanelet::visualization::detectionAreasAsMarkerArray(da_reg_elems, cl_detection_areas));
-  insert_marker_array(
-    &map_marker_array,
-    lanelet::visualization::noStoppingAreasAsMarkerArray(no_reg_elems, cl_no_stopping_areas));
-  insert_marker_array(
-    &map_marker_array,
-    lanelet::visualization::speedBumpsAsMarkerArray(sb_reg_elems, cl_speed_bumps));
-  insert_marker_array(
-    &map_marker_array,
-    lanelet::visualization::crosswalkAreasAsMarkerArray(cw_reg_elems, cl_crosswalks));
-  insert_marker_array(
-    &map_marker_array,
-    lanelet::visualization::parkingLotsAsMarkerArray(parking_lots, cl_parking_lots));
-  insert_marker_array(
-    &map_marker_array,
-    lanelet::visualization::parkingSpacesAsMarkerArray(parking_spaces, cl_parking_spaces));
-  insert_marker_array(
-    &map_marker_array,
-    lanelet::visualization::laneletsBoundaryAsMarkerArray(
-      shoulder_lanelets, cl_shoulder_borders, viz_lanelets_centerline_, "shoulder_"));
-  insert_marker_array(
-    &map_marker_array, lanelet::visualization::laneletsBoundaryAsMarkerArray(
-                         road_lanelets, cl_ll_borders, viz_lanelets_centerline_));
-  insert_marker_array(
-    &map_marker_array,
-    lanelet::visualization::autowareTrafficLightsAsMarkerArray(aw_tl_reg_elems, cl_trafficlights));
-  insert_marker_array(
-    &map_marker_array, lanelet::visualization::generateTrafficLightRegulatoryElementIdMaker(
-                         road_lanelets, cl_trafficlights));
-  insert_marker_array(
-    &map_marker_array, lanelet::visualization::generateTrafficLightRegulatoryElementIdMaker(
-                         crosswalk_lanelets, cl_trafficlights));
-  insert_marker_array(
-    &map_marker_array,
-    lanelet::visualization::generateTrafficLightIdMaker(aw_tl_reg_elems, cl_trafficlights));
-  insert_marker_array(
-    &map_marker_array,
-    lanelet::visualization::generateLaneletIdMarker(shoulder_lanelets, cl_lanelet_id));
-  insert_marker_array(
-    &map_marker_array,
-    lanelet::visualization::generateLaneletIdMarker(road_lanelets, cl_lanelet_id));
-  insert_marker_array(
-    &map_marker_array, lanelet::visualization::generateLaneletIdMarker(
-                         crosswalk_lanelets, cl_lanelet_id, "crosswalk_lanelet_id"));
-  insert_marker_array(
-    &map_marker_array, lanelet::visualization::laneletsAsTriangleMarkerArray(
-                         "shoulder_road_lanelets", shoulder_lanelets, cl_shoulder));
-  insert_marker_array(
-    &map_marker_array,
-    lanelet::visualization::laneletsAsTriangleMarkerArray("road_lanelets", road_lanelets, cl_road));
-  insert_marker_array(
-    &map_marker_array, lanelet::visualization::noObstacleSegmentationAreaAsMarkerArray(
-                         no_obstacle_segmentation_area, cl_no_obstacle_segmentation_area));
-  insert_marker_array(
-    &map_marker_array,
-    lanelet::visualization::noObstacleSegmentationAreaForRunOutAsMarkerArray(
-      no_obstacle_segmentation_area_for_run_out, cl_no_obstacle_segmentation_area_for_run_out));
-
-  insert_marker_array(
-    &map_marker_array,
-    lanelet::visualization::hatchedRoadMarkingsAreaAsMarkerArray(
-      hatched_road_markings_area, cl_hatched_road_markings_area, cl_hatched_road_markings_line));
-
-  insert_marker_array(
-    &map_marker_array,
-    lanelet::visualization::noParkingAreasAsMarkerArray(no_parking_reg_elems, cl_no_parking_areas));
-
-  insert_marker_array(
-    &map_marker_array,
-    lanelet::visualization::lineStringsAsMarkerArray(curbstones, "curbstone", cl_curbstones, 0.2));
-
-  insert_marker_array(
-    &map_marker_array, lanelet::visualization::intersectionAreaAsMarkerArray(
-                         intersection_areas, cl_intersection_area));
-
-  insert_marker_array(
-    &map_marker_array,
-    lanelet::visualization::busStopAreasAsMarkerArray(bus_stop_reg_elems, cl_bus_stop_area));
-
-  insert_marker_array(
-    &map_marker_array,
-    lanelet::visualization::laneletDirectionAsMarkerArray(bicycle_lane_lanelets, "bicycle_lane_"));
-  insert_marker_array(
-    &map_marker_array, lanelet::visualization::laneletsBoundaryAsMarkerArray(
-                         bicycle_lane_lanelets, cl_ll_borders /* use ll_border color */,
-                         viz_lanelets_centerline_, "bicycle_lane_"));
-  insert_marker_array(
-    &map_marker_array, lanelet::visualization::generateLaneletIdMarker(
-                         bicycle_lane_lanelets, cl_lanelet_id /* use lanelet_id color */));
-  insert_marker_array(
-    &map_marker_array, lanelet::visualization::laneletsAsTriangleMarkerArray(
-                         "bicycle_lane_lanelets", bicycle_lane_lanelets, cl_bicycle_lane));
-
-  insert_marker_array(
-    &map_marker_array,
-    lanelet::visualization::lineStringsAsMarkerArray(waypoints, "waypoints", cl_waypoints, 0.02));
+  // the layers only read the map, and are concatenated in this order after they are built
+  std::vector<std::function<visualization_msgs::msg::MarkerArray()>> layers;
+  layers.emplace_back([&] {
+    return lanelet::visualization::lineStringsAsMarkerArray(
+      stop_lines, "stop_lines", cl_stoplines, 0.5);
+  });
+  layers.emplace_back([&] {
+    return lanelet::visualization::lineStringsAsMarkerArray(
+      partitions, "partitions", cl_partitions, 0.1);
+  });
+  layers.emplace_back([&] {
+    return lanelet::visualization::lineStringsAsMarkerArray(
+      road_borders, "road_borders", cl_road_borders, 0.2);
+  });
+  layers.emplace_back([&] {
+    return lanelet::visualization::laneletDirectionAsMarkerArray(shoulder_lanelets, "shoulder_");
+  });
+  layers.emplace_back([&] {
+    return lanelet::visualization::laneletDirectionAsMarkerArray(road_lanelets);
+  });
+  layers.emplace_back([&] {
+    return lanelet::visualization::laneletsAsTriangleMarkerArray(
+      "crosswalk_lanelets", crosswalk_lanelets, cl_cross);
+  });
+  layers.emplace_back([&] {
+    return lanelet::visualization::pedestrianPolygonMarkingsAsMarkerArray(
+      pedestrian_polygon_markings, cl_pedestrian_markings);
+  });
+  layers.emplace_back([&] {
+    return lanelet::visualization::pedestrianLineMarkingsAsMarkerArray(
+      pedestrian_line_markings, cl_pedestrian_markings);
+  });
+  layers.emplace_back([&] {
+    return lanelet::visualization::laneletsAsTriangleMarkerArray(
+      "walkway_lanelets", walkway_lanelets, cl_cross);
+  });
+  layers.emplace_back([&] {
+    return lanelet::visualization::obstaclePolygonsAsMarkerArray(
+      obstacle_polygons, cl_obstacle_polygons);
+  });
+  layers.emplace_back([&] {
+    return lanelet::visualization::detectionAreasAsMarkerArray(da_reg_elems, cl_detection_areas);
+  });
+  layers.emplace_back([&] {
+    return lanelet::visualization::noStoppingAreasAsMarkerArray(no_reg_elems, cl_no_stopping_areas);
+  });
+  layers.emplace_back([&] {
+    return lanelet::visualization::speedBumpsAsMarkerArray(sb_reg_elems, cl_speed_bumps);
+  });
+  layers.emplace_back([&] {
+    return lanelet::visualization::crosswalkAreasAsMarkerArray(cw_reg_elems, cl_crosswalks);
+  });
+  layers.emplace_back([&] {
+    return lanelet::visualization::parkingLotsAsMarkerArray(parking_lots, cl_parking_lots);
+  });
+  layers.emplace_back([&] {
+    return lanelet::visualization::parkingSpacesAsMarkerArray(parking_spaces, cl_parking_spaces);
+  });
+  layers.emplace_back([&] {
+    return lanelet::visualization::laneletsBoundaryAsMarkerArray(
+      shoulder_lanelets, cl_shoulder_borders, viz_lanelets_centerline_, "shoulder_");
+  });
+  layers.emplace_back([&] {
+    return lanelet::visualization::laneletsBoundaryAsMarkerArray(
+      road_lanelets, cl_ll_borders, viz_lanelets_centerline_);
+  });
+  layers.emplace_back([&] {
+    return lanelet::visualization::autowareTrafficLightsAsMarkerArray(
+      aw_tl_reg_elems, cl_trafficlights);
+  });
+  layers.emplace_back([&] {
+    return lanelet::visualization::generateTrafficLightRegulatoryElementIdMaker(
+      road_lanelets, cl_trafficlights);
+  });
+  layers.emplace_back([&] {
+    return lanelet::visualization::generateTrafficLightRegulatoryElementIdMaker(
+      crosswalk_lanelets, cl_trafficlights);
+  });
+  layers.emplace_back([&] {
+    return lanelet::visualization::generateTrafficLightIdMaker(aw_tl_reg_elems, cl_trafficlights);
+  });
+  layers.emplace_back([&] {
+    return lanelet::visualization::generateLaneletIdMarker(shoulder_lanelets, cl_lanelet_id);
+  });
+  layers.emplace_back([&] {
+    return lanelet::visualization::generateLaneletIdMarker(road_lanelets, cl_lanelet_id);
+  });
+  layers.emplace_back([&] {
+    return lanelet::visualization::generateLaneletIdMarker(
+      crosswalk_lanelets, cl_lanelet_id, "crosswalk_lanelet_id");
+  });
+  layers.emplace_back([&] {
+    return lanelet::visualization::laneletsAsTriangleMarkerArray(
+      "shoulder_road_lanelets", shoulder_lanelets, cl_shoulder);
+  });
+  layers.emplace_back([&] {
+    return lanelet::visualization::laneletsAsTriangleMarkerArray(
+      "road_lanelets", road_lanelets, cl_road);
+  });
+  layers.emplace_back([&] {
+    return lanelet::visualization::noObstacleSegmentationAreaAsMarkerArray(
+      no_obstacle_segmentation_area, cl_no_obstacle_segmentation_area);
+  });
+  layers.emplace_back([&] {
+    return lanelet::visualization::noObstacleSegmentationAreaForRunOutAsMarkerArray(
+      no_obstacle_segmentation_area_for_run_out, cl_no_obstacle_segmentation_area_for_run_out);
+  });
+  layers.emplace_back([&] {
+    return lanelet::visualization::hatchedRoadMarkingsAreaAsMarkerArray(
+      hatched_road_markings_area, cl_hatched_road_markings_area, cl_hatched_road_markings_line);
+  });
+  layers.emplace_back([&] {
+    return lanelet::visualization::noParkingAreasAsMarkerArray(
+      no_parking_reg_elems, cl_no_parking_areas);
+  });
+  layers.emplace_back([&] {
+    return lanelet::visualization::lineStringsAsMarkerArray(
+      curbstones, "curbstone", cl_curbstones, 0.2);
+  });
+  layers.emplace_back([&] {
+    return lanelet::visualization::intersectionAreaAsMarkerArray(
+      intersection_areas, cl_intersection_area);
+  });
+  layers.emplace_back([&] {
+    return lanelet::visualization::busStopAreasAsMarkerArray(bus_stop_reg_elems, cl_bus_stop_area);
+  });
+  layers.emplace_back([&] {
+    return lanelet::visualization::laneletDirectionAsMarkerArray(
+      bicycle_lane_lanelets, "bicycle_lane_");
+  });
+  layers.emplace_back([&] {
+    return lanelet::visualization::laneletsBoundaryAsMarkerArray(
+      bicycle_lane_lanelets, cl_ll_borders /* use ll_border color */, viz_lanelets_centerline_,
+      "bicycle_lane_");
+  });
+  layers.emplace_back([&] {
+    return lanelet::visualization::generateLaneletIdMarker(
+      bicycle_lane_lanelets, cl_lanelet_id /* use lanelet_id color */);
+  });
+  layers.emplace_back([&] {
+    return lanelet::visualization::laneletsAsTriangleMarkerArray(
+      "bicycle_lane_lanelets", bicycle_lane_lanelets, cl_bicycle_lane);
+  });
+  layers.emplace_back([&] {
+    return lanelet::visualization::lineStringsAsMarkerArray(
+      waypoints, "waypoints", cl_waypoints, 0.02);
+  });
 
+  const auto map_marker_array = build_marker_array(layers);
   pub_marker_->publish(map_marker_array);
 }
 }  // namespace autoware::lanelet2_map_visualizer
@@ -0,0 +1,79 @@
+// Copyright 2025 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "height_raster.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace autoware::map_height_fitter
+{
+
+HeightRaster::HeightRaster(const pcl::PointCloud<pcl::PointXYZ> & cloud, const double resolution)
+: resolution_(resolution)
+{
+  for (const auto & p : cloud.points) {
+    if (!std::isfinite(p.x) || !std::isfinite(p.y) || !std::isfinite(p.z)) {
+      continue;
+    }
+    const auto ix = static_cast<int64_t>(std::floor(p.x / resolution_));
+    const auto iy = static_cast<int64_t>(std::floor(p.y / resolution_));
+    const auto [it, inserted] = min_z_.try_emplace(get_key(ix, iy), p.z);
+    if (!inserted) {
+      it->second = std::min(it->second, p.z);
+    }
+  }
+}
+
+std::optional<double> HeightRaster::get_height(const double x, const double y) const
+{
+  // position relative to the center of the lower left cell of the four
+  const double u = x / resolution_ - 0.5;
+  const double v = y / resolution_ - 0.5;
+  const double u0 = std::floor(u);
+  const double v0 = std::floor(v);
+  const auto ix = static_cast<int64_t>(u0);
+  const auto iy = static_cast<int64_t>(v0);
+
+  const auto z00 = get_cell_height(ix, iy);
+  const auto z10 = get_cell_height(ix + 1, iy);
+  const auto z01 = get_cell_height(ix, iy + 1);
+  const auto z11 = get_cell_height(ix + 1, iy + 1);
+  if (!z00 || !z10 || !z01 || !z11) {
+    return std::nullopt;
+  }
+
+  const double fx = u - u0;
+  const double fy = v - v0;
+  const double z0 = (1.0 - fx) * *z00 + fx * *z10;
+  const double z1 = (1.0 - fx) * *z01 + fx * *z11;
+  return (1.0 - fy) * z0 + fy * z1;
+}
+
+uint64_t HeightRaster::get_key(const int64_t ix, const int64_t iy)
+{
+  return (static_cast<uint64_t>(static_cast<uint32_t>(ix)) << 32) |
+         static_cast<uint64_t>(static_cast<uint32_t>(iy));
+}
+
+std::optional<float> HeightRaster::get_cell_height(const int64_t ix, const int64_t iy) const
+{
+  const auto it = min_z_.find(get_key(ix, iy));
+  if (it == min_z_.end()) {
+    return std::nullopt;
+  }
+  return it->second;
+}
+
+}  // namespace autoware::map_height_fitter
@@ -0,0 +1,49 @@
+// Copyright 2025 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HEIGHT_RASTER_HPP_
+#define HEIGHT_RASTER_HPP_
+
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+
+namespace autoware::map_height_fitter
+{
+/**
+ * Lowest height of the map points in each cell of a 2D grid, built once from the map. Only the
+ * cells with map points are stored.
+ */
+class HeightRaster
+{
+public:
+  HeightRaster(const pcl::PointCloud<pcl::PointXYZ> & cloud, const double resolution);
+
+  /// Height interpolated bilinearly between the centers of the four cells around the position,
+  /// empty if one of them has no map point.
+  [[nodiscard]] std::optional<double> get_height(const double x, const double y) const;
+
+private:
+  [[nodiscard]] static uint64_t get_key(const int64_t ix, const int64_t iy);
+  [[nodiscard]] std::optional<float> get_cell_height(const int64_t ix, const int64_t iy) const;
+
+  double resolution_;
+  std::unordered_map<uint64_t, float> min_z_;
+};
+}  // namespace autoware::map_height_fitter
+
+#endif  // HEIGHT_RASTER_HPP_
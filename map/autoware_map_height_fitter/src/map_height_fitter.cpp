@@ -14,7 +14,10 @@
 
 #include "autoware/map_height_fitter/map_height_fitter.hpp"
 
-#include <autoware_lanelet2_extension/utility/message_conversion.hpp>
+#include "height_raster.hpp"
+
+#include <autoware/lanelet2_utils/map_registry.hpp>
+#include <autoware/lanelet2_utils/shared_memory.hpp>
 #include <autoware_lanelet2_extension/utility/query.hpp>
 
 #include <autoware_map_msgs/msg/lanelet_map_bin.hpp>
@@ -53,10 +56,12 @@ struct MapHeightFitter::Impl
   rclcpp::Node * node_;
 
   std::string fit_target_;
+  double raster_resolution_;
 
   // for fitting by pointcloud_map_loader
   rclcpp::CallbackGroup::SharedPtr group_;
   pcl::PointCloud<pcl::PointXYZ>::Ptr map_cloud_;
+  std::unique_ptr<HeightRaster> height_raster_;  // only for the whole map
   rclcpp::Client<autoware_map_msgs::srv::GetPartialPointCloudMap>::SharedPtr cli_pcd_map_;
   rclcpp::Subscription<sensor_msgs::msg::PointCloud2>::SharedPtr sub_pcd_map_;
   rclcpp::AsyncParametersClient::SharedPtr params_pcd_map_loader_;
@@ -69,6 +74,7 @@ struct MapHeightFitter::Impl
 MapHeightFitter::Impl::Impl(rclcpp::Node * node) : tf2_listener_(tf2_buffer_), node_(node)
 {
   fit_target_ = node->declare_parameter<std::string>("map_height_fitter.target");
+  raster_resolution_ = node->declare_parameter<double>("map_height_fitter.raster_resolution");
   if (fit_target_ == "pointcloud_map") {
     const auto callback =
       [this](const std::shared_future<std::vector<rclcpp::Parameter>> & future) {
@@ -112,7 +118,24 @@ void MapHeightFitter::Impl::on_pcd_map(const sensor_msgs::msg::PointCloud2::Cons
 {
   map_frame_ = msg->header.frame_id;
   map_cloud_ = std::make_shared<pcl::PointCloud<pcl::PointXYZ>>();
-  pcl::fromROSMsg(*msg, *map_cloud_);
+  using autoware::experimental::lanelet2_utils::SharedMemoryRegion;
+  if (SharedMemoryRegion::is_handle(msg->data)) {
+    // the points are in the shared memory of pointcloud_map_loader
+    const auto region = SharedMemoryRegion::open(msg->data);
+    if (!region) {
+      RCLCPP_ERROR(node_->get_logger(), "Shared memory of the pointcloud map is not found");
+      map_cloud_ = nullptr;
+      return;
+    }
+    sensor_msgs::msg::PointCloud2 region_msg = *msg;
+    region_msg.data.assign(region->data(), region->data() + region->size());
+    pcl::fromROSMsg(region_msg, *map_cloud_);
+  } else {
+    pcl::fromROSMsg(*msg, *map_cloud_);
+  }
+  if (0.0 < raster_resolution_) {
+    height_raster_ = std::make_unique<HeightRaster>(*map_cloud_, raster_resolution_);
+  }
 }
 
 bool MapHeightFitter::Impl::get_partial_point_cloud_map(const Point & point)
@@ -169,8 +192,7 @@ bool MapHeightFitter::Impl::get_partial_point_cloud_map(const Point & point)
 void MapHeightFitter::Impl::on_vector_map(
   const autoware_map_msgs::msg::LaneletMapBin::ConstSharedPtr msg)
 {
-  vector_map_ = std::make_shared<lanelet::LaneletMap>();
-  lanelet::utils::conversion::fromBinMsg(*msg, vector_map_);
+  vector_map_ = autoware::experimental::lanelet2_utils::get_shared_lanelet_map(*msg).lanelet_map;
   map_frame_ = msg->header.frame_id;
 }
 
@@ -183,6 +205,13 @@ double MapHeightFitter::Impl::get_ground_height(const Point & point) const
 
   double height = INFINITY;
   if (fit_target_ == "pointcloud_map") {
+    if (height_raster_) {
+      const auto raster_height = height_raster_->get_height(x, y);
+      if (raster_height) {
+        return raster_height.value();
+      }
+    }  // otherwise, search the map points around the point
+
     // find distance d to closest point
     double min_dist2 = INFINITY;
     for (const auto & p : map_cloud_->points) {
@@ -16,6 +16,7 @@
 #define AUTOWARE__MAP_LOADER__LANELET2_MAP_LOADER_NODE_HPP_
 
 #include <autoware/component_interface_specs/map.hpp>
+#include <autoware/node/startup_timeline.hpp>
 #include <autoware_lanelet2_extension/version.hpp>
 #include <rclcpp/rclcpp.hpp>
 
@@ -27,8 +28,15 @@
 #include <memory>
 #include <string>
 
+namespace autoware::experimental::lanelet2_utils
+{
+class SharedMemoryRegion;
+}  // namespace autoware::experimental::lanelet2_utils
+
 namespace autoware::map_loader
 {
+class Lanelet2SelectedMapLoaderModule;
+
 class Lanelet2MapLoaderNode : public rclcpp::Node
 {
 public:
@@ -36,6 +44,7 @@ public:
 
 public:
   explicit Lanelet2MapLoaderNode(const rclcpp::NodeOptions & options);
+  ~Lanelet2MapLoaderNode() override;
 
   static lanelet::LaneletMapPtr load_map(
     const std::string & lanelet2_filename,
@@ -48,9 +57,18 @@ private:
   using MapProjectorInfo = autoware::component_interface_specs::map::MapProjectorInfo;
   using VectorMap = autoware::component_interface_specs::map::VectorMap;
   void on_map_projector_info(const MapProjectorInfo::Message::ConstSharedPtr msg);
+  void check_format_version(
+    const std::string & format_version, const std::string & lanelet2_filename,
+    const bool allow_unsupported_version) const;
+  void publish_map_bin(
+    const autoware_map_msgs::msg::LaneletMapBin & map_bin_msg, lanelet::LaneletMapPtr map);
 
+  // NOTE: the first member, so that the timeline starts before the other members are constructed
+  autoware::node::StartupTimeline startup_timeline_{this};
   rclcpp::Subscription<MapProjectorInfo::Message>::SharedPtr sub_map_projector_info_;
   rclcpp::Publisher<VectorMap::Message>::SharedPtr pub_map_bin_;
+  std::unique_ptr<Lanelet2SelectedMapLoaderModule> selected_map_loader_;
+  std::unique_ptr<autoware::experimental::lanelet2_utils::SharedMemoryRegion> map_region_;
 };
 }  // namespace autoware::map_loader
 
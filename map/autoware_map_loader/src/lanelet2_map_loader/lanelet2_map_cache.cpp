@@ -0,0 +1,150 @@
+// Copyright 2025 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lanelet2_map_cache.hpp"
+
+#include <autoware_lanelet2_extension/version.hpp>
+
+#include <fmt/format.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+namespace autoware::map_loader
+{
+namespace fs = std::filesystem;
+
+namespace
+{
+// changed whenever the layout of the cache file or what the loader publishes changes
+constexpr std::string_view cache_magic = "AWL2MAP1";
+
+uint64_t hash_bytes(const void * data, const size_t size)
+{
+  return std::hash<std::string_view>{}(std::string_view(static_cast<const char *>(data), size));
+}
+
+void write_bytes(std::ofstream & file, const void * data, const uint64_t size)
+{
+  file.write(reinterpret_cast<const char *>(&size), sizeof(size));
+  file.write(static_cast<const char *>(data), static_cast<std::streamsize>(size));
+}
+
+template <class Container>
+bool read_bytes(std::ifstream & file, const uint64_t remaining_size, Container & bytes)
+{
+  uint64_t size = 0;
+  if (!file.read(reinterpret_cast<char *>(&size), sizeof(size)) || size > remaining_size) {
+    return false;
+  }
+  bytes.resize(size);
+  return static_cast<bool>(file.read(reinterpret_cast<char *>(bytes.data()), size));
+}
+}  // namespace
+
+std::string get_lanelet2_map_cache_key(
+  const std::string & lanelet2_filename,
+  const autoware_map_msgs::msg::MapProjectorInfo & projector_info,
+  const double center_line_resolution, const bool use_waypoints)
+{
+  std::ifstream file(lanelet2_filename, std::ios::binary);
+  if (!file) {
+    return "";
+  }
+  const std::string content{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+  if (file.bad()) {
+    return "";
+  }
+  return fmt::format(
+    "{} {} {:016x} {} {} {} {}", cache_magic, content.size(),
+    hash_bytes(content.data(), content.size()), center_line_resolution, use_waypoints,
+    static_cast<uint64_t>(lanelet::autoware::version),
+    autoware_map_msgs::msg::to_yaml(projector_info, true));
+}
+
+std::string get_lanelet2_map_cache_path(
+  const std::string & cache_directory, const std::string & lanelet2_filename,
+  const std::string & key)
+{
+  const std::string file_name = fmt::format(
+    "{}_{:016x}.bin", fs::path(lanelet2_filename).stem().string(), std::hash<std::string>{}(key));
+  return (fs::path(cache_directory) / file_name).string();
+}
+
+std::optional<autoware_map_msgs::msg::LaneletMapBin> read_lanelet2_map_cache(
+  const std::string & cache_path, const std::string & key)
+{
+  std::error_code error_code;
+  const uint64_t file_size = fs::file_size(cache_path, error_code);
+  if (error_code) {
+    return std::nullopt;
+  }
+  std::ifstream file(cache_path, std::ios::binary);
+  std::string magic(cache_magic.size(), '\0');
+  if (
+    !file.read(magic.data(), static_cast<std::streamsize>(magic.size())) || magic != cache_magic) {
+    return std::nullopt;
+  }
+
+  std::string cached_key;
+  autoware_map_msgs::msg::LaneletMapBin map_bin_msg;
+  uint64_t data_hash = 0;
+  if (
+    !read_bytes(file, file_size, cached_key) || cached_key != key ||
+    !read_bytes(file, file_size, map_bin_msg.version_map_format) ||
+    !read_bytes(file, file_size, map_bin_msg.version_map) ||
+    !read_bytes(file, file_size, map_bin_msg.data) ||
+    !file.read(reinterpret_cast<char *>(&data_hash), sizeof(data_hash)) ||
+    file.peek() != std::ifstream::traits_type::eof() ||
+    data_hash != hash_bytes(map_bin_msg.data.data(), map_bin_msg.data.size())) {
+    return std::nullopt;
+  }
+  return map_bin_msg;
+}
+
+bool write_lanelet2_map_cache(
+  const std::string & cache_path, const std::string & key,
+  const autoware_map_msgs::msg::LaneletMapBin & map_bin_msg)
+{
+  // written to a temporary file and renamed, so that a concurrent reader never sees a partial file
+  const std::string temporary_path = cache_path + ".tmp";
+  std::error_code error_code;
+  {
+    std::ofstream file(temporary_path, std::ios::binary | std::ios::trunc);
+    file.write(cache_magic.data(), static_cast<std::streamsize>(cache_magic.size()));
+    write_bytes(file, key.data(), key.size());
+    write_bytes(file, map_bin_msg.version_map_format.data(), map_bin_msg.version_map_format.size());
+    write_bytes(file, map_bin_msg.version_map.data(), map_bin_msg.version_map.size());
+    write_bytes(file, map_bin_msg.data.data(), map_bin_msg.data.size());
+    const uint64_t data_hash = hash_bytes(map_bin_msg.data.data(), map_bin_msg.data.size());
+    file.write(reinterpret_cast<const char *>(&data_hash), sizeof(data_hash));
+    if (!file.flush()) {
+      error_code = std::make_error_code(std::errc::io_error);
+    }
+  }
+  if (!error_code) {
+    fs::rename(temporary_path, cache_path, error_code);
+  }
+  if (error_code) {
+    fs::remove(temporary_path, error_code);
+    return false;
+  }
+  return true;
+}
+}  // namespace autoware::map_loader
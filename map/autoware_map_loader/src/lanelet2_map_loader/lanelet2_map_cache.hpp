@@ -0,0 +1,56 @@
+// Copyright 2025 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LANELET2_MAP_LOADER__LANELET2_MAP_CACHE_HPP_
+#define LANELET2_MAP_LOADER__LANELET2_MAP_CACHE_HPP_
+
+#include <autoware_map_msgs/msg/lanelet_map_bin.hpp>
+#include <autoware_map_msgs/msg/map_projector_info.hpp>
+
+#include <optional>
+#include <string>
+
+namespace autoware::map_loader
+{
+/**
+ * Cache of the published lanelet2 map, i.e. the serialized map after the projection and the
+ * centerline overwrite, so that the next loads of the same file skip the OSM parsing.
+ * - The key holds the content of the file and all the parameters that change the published map,
+ *   a cache file written with another key is never read.
+ * - The cache file starts with the key and ends with a hash of the map data, a truncated or
+ *   corrupted file is ignored.
+ */
+
+/// key of the map of a lanelet2 file, empty if the file cannot be read
+[[nodiscard]] std::string get_lanelet2_map_cache_key(
+  const std::string & lanelet2_filename,
+  const autoware_map_msgs::msg::MapProjectorInfo & projector_info,
+  const double center_line_resolution, const bool use_waypoints);
+
+/// path of the cache file of a key in the cache directory
+[[nodiscard]] std::string get_lanelet2_map_cache_path(
+  const std::string & cache_directory, const std::string & lanelet2_filename,
+  const std::string & key);
+
+/// versions and data of the cached map, empty if the file is missing, invalid or of another key
+[[nodiscard]] std::optional<autoware_map_msgs::msg::LaneletMapBin> read_lanelet2_map_cache(
+  const std::string & cache_path, const std::string & key);
+
+/// write the versions and data of the map, replacing the cache file at once
+bool write_lanelet2_map_cache(
+  const std::string & cache_path, const std::string & key,
+  const autoware_map_msgs::msg::LaneletMapBin & map_bin_msg);
+}  // namespace autoware::map_loader
+
+#endif  // LANELET2_MAP_LOADER__LANELET2_MAP_CACHE_HPP_
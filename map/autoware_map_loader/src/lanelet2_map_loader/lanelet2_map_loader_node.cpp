@@ -34,23 +34,29 @@
 #include "autoware/map_loader/lanelet2_map_loader_node.hpp"
 
 #include "lanelet2_local_projector.hpp"
+#include "lanelet2_map_cache.hpp"
+#include "lanelet2_selected_map_loader_module.hpp"
 
 #include <autoware/geography_utils/lanelet2_projector.hpp>
+#include <autoware/lanelet2_utils/centerline.hpp>
+#include <autoware/lanelet2_utils/shared_memory.hpp>
 #include <autoware_lanelet2_extension/io/autoware_osm_parser.hpp>
 #include <autoware_lanelet2_extension/projection/mgrs_projector.hpp>
 #include <autoware_lanelet2_extension/projection/transverse_mercator_projector.hpp>
 #include <autoware_lanelet2_extension/utility/message_conversion.hpp>
-#include <autoware_lanelet2_extension/utility/utilities.hpp>
 #include <rclcpp/rclcpp.hpp>
 
 #include <lanelet2_core/LaneletMap.h>
 #include <lanelet2_core/geometry/LineString.h>
 #include <lanelet2_io/Io.h>
 #include <lanelet2_projection/UTM.h>
+#include <unistd.h>
 
+#include <filesystem>
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <utility>
 
 namespace autoware::map_loader
 {
@@ -69,15 +75,51 @@ Lanelet2MapLoaderNode::Lanelet2MapLoaderNode(const rclcpp::NodeOptions & options
   declare_parameter<std::string>("lanelet2_map_path");
   declare_parameter<double>("center_line_resolution");
   declare_parameter<bool>("use_waypoints");
+  declare_parameter<std::string>("lanelet2_map_cache_directory");
+  declare_parameter<bool>("enable_selected_load");
+  declare_parameter<double>("selected_load_tile_size");
+  declare_parameter<bool>("use_shared_memory");
 }
 
+Lanelet2MapLoaderNode::~Lanelet2MapLoaderNode() = default;
+
 void Lanelet2MapLoaderNode::on_map_projector_info(
   const MapProjectorInfo::Message::ConstSharedPtr msg)
 {
+  startup_timeline_.mark_phase("wait_map_projector_info");
   const auto allow_unsupported_version = get_parameter("allow_unsupported_version").as_bool();
   const auto lanelet2_filename = get_parameter("lanelet2_map_path").as_string();
   const auto center_line_resolution = get_parameter("center_line_resolution").as_double();
   const auto use_waypoints = get_parameter("use_waypoints").as_bool();
+  const auto cache_directory = get_parameter("lanelet2_map_cache_directory").as_string();
+
+  // the cached map is already projected and has the overwritten centerlines
+  std::string cache_key;
+  std::string cache_path;
+  if (!cache_directory.empty()) {
+    std::error_code error_code;
+    std::filesystem::create_directories(cache_directory, error_code);
+    cache_key = get_lanelet2_map_cache_key(
+      lanelet2_filename, *msg, center_line_resolution, use_waypoints);
+    if (error_code || cache_key.empty()) {
+      RCLCPP_WARN_STREAM(get_logger(), "Lanelet2 map cache disabled: " << cache_directory);
+    } else {
+      cache_path = get_lanelet2_map_cache_path(cache_directory, lanelet2_filename, cache_key);
+    }
+  }
+  if (!cache_path.empty()) {
+    if (auto map_bin_msg = read_lanelet2_map_cache(cache_path, cache_key)) {
+      check_format_version(
+        map_bin_msg->version_map_format, lanelet2_filename, allow_unsupported_version);
+      map_bin_msg->header.stamp = now();
+      map_bin_msg->header.frame_id = "map";
+      startup_timeline_.mark_phase("read_cache");
+      publish_map_bin(*map_bin_msg, nullptr);
+      startup_timeline_.mark_ready();
+      RCLCPP_INFO_STREAM(get_logger(), "Loaded lanelet2_map from the cache: " << cache_path);
+      return;
+    }
+  }
 
   // load map from file
   const auto map = load_map(lanelet2_filename, *msg);
@@ -85,10 +127,40 @@ void Lanelet2MapLoaderNode::on_map_projector_info(
     RCLCPP_ERROR(get_logger(), "Failed to load lanelet2_map. Not published.");
     return;
   }
+  startup_timeline_.mark_phase("load_map");
 
   std::string format_version{"null"}, map_version{""};
   lanelet::io_handlers::AutowareOsmParser::parseVersions(
     lanelet2_filename, &format_version, &map_version);
+  check_format_version(format_version, lanelet2_filename, allow_unsupported_version);
+  startup_timeline_.mark_phase("parse_versions");
+
+  // overwrite centerline
+  if (use_waypoints) {
+    autoware::experimental::lanelet2_utils::overwrite_lanelets_centerline_with_waypoints(
+      map, center_line_resolution, false);
+  } else {
+    autoware::experimental::lanelet2_utils::overwrite_lanelets_centerline(
+      map, center_line_resolution, false);
+  }
+
+  startup_timeline_.mark_phase("overwrite_centerline");
+
+  // create map bin msg
+  const auto map_bin_msg = create_map_bin_msg(map, lanelet2_filename, now());
+  startup_timeline_.mark_phase("create_map_bin");
+  publish_map_bin(map_bin_msg, map);
+  startup_timeline_.mark_ready();
+
+  if (!cache_path.empty() && !write_lanelet2_map_cache(cache_path, cache_key, map_bin_msg)) {
+    RCLCPP_WARN_STREAM(get_logger(), "Lanelet2 map cache write failed: " << cache_path);
+  }
+}
+
+void Lanelet2MapLoaderNode::check_format_version(
+  const std::string & format_version, const std::string & lanelet2_filename,
+  const bool allow_unsupported_version) const
+{
   if (format_version == "null" || format_version.empty() || !isdigit(format_version[0])) {
     RCLCPP_WARN(
       get_logger(),
@@ -114,22 +186,37 @@ void Lanelet2MapLoaderNode::on_map_projector_info(
     }
   }
   RCLCPP_INFO(get_logger(), "Loaded map format_version: %s", format_version.c_str());
+}
 
-  // overwrite centerline
-  if (use_waypoints) {
-    lanelet::utils::overwriteLaneletsCenterlineWithWaypoints(map, center_line_resolution, false);
-  } else {
-    lanelet::utils::overwriteLaneletsCenterline(map, center_line_resolution, false);
-  }
-
-  // create map bin msg
-  const auto map_bin_msg = create_map_bin_msg(map, lanelet2_filename, now());
-
+void Lanelet2MapLoaderNode::publish_map_bin(
+  const LaneletMapBin & map_bin_msg, lanelet::LaneletMapPtr map)
+{
   // create publisher and publish
   pub_map_bin_ =
     create_publisher<VectorMap::Message>(VectorMap::name, rclcpp::QoS{1}.transient_local());
-  pub_map_bin_->publish(map_bin_msg);
+  if (get_parameter("use_shared_memory").as_bool()) {
+    // the subscribers on the host map the data instead of receiving a copy each
+    map_region_ = autoware::experimental::lanelet2_utils::SharedMemoryRegion::create(
+      "/autoware_lanelet2_map_" + std::to_string(getpid()), map_bin_msg.data.data(),
+      map_bin_msg.data.size());
+    LaneletMapBin handle_msg = map_bin_msg;
+    handle_msg.data = map_region_->handle();
+    pub_map_bin_->publish(handle_msg);
+  } else {
+    pub_map_bin_->publish(map_bin_msg);
+  }
   RCLCPP_INFO(get_logger(), "Succeeded to load lanelet2_map. Map is published.");
+
+  if (!get_parameter("enable_selected_load").as_bool()) {
+    return;
+  }
+  // the cached map is only published as binary data
+  if (!map) {
+    map = std::make_shared<lanelet::LaneletMap>();
+    lanelet::utils::conversion::fromBinMsg(map_bin_msg, map);
+  }
+  selected_map_loader_ = std::make_unique<Lanelet2SelectedMapLoaderModule>(
+    this, std::move(map), map_bin_msg, get_parameter("selected_load_tile_size").as_double());
 }
 
 lanelet::LaneletMapPtr Lanelet2MapLoaderNode::load_map(
@@ -0,0 +1,153 @@
+// Copyright 2025 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lanelet2_selected_map_loader_module.hpp"
+
+#include <autoware_lanelet2_extension/utility/message_conversion.hpp>
+
+#include <fmt/format.h>
+#include <lanelet2_core/geometry/Lanelet.h>
+#include <lanelet2_core/primitives/Lanelet.h>
+
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace autoware::map_loader
+{
+namespace
+{
+int64_t get_tile_index(const double coordinate, const double tile_size)
+{
+  return static_cast<int64_t>(std::floor(coordinate / tile_size));
+}
+
+std::string get_tile_id_of_index(const int64_t x_index, const int64_t y_index)
+{
+  return fmt::format("{}_{}", x_index, y_index);
+}
+}  // namespace
+
+Lanelet2SelectedMapLoaderModule::Lanelet2SelectedMapLoaderModule(
+  rclcpp::Node * node, lanelet::LaneletMapPtr lanelet_map,
+  const autoware_map_msgs::msg::LaneletMapBin & map_bin_msg, const double tile_size)
+: logger_(node->get_logger()),
+  clock_(node->get_clock()),
+  lanelet_map_(std::move(lanelet_map)),
+  version_map_format_(map_bin_msg.version_map_format),
+  version_map_(map_bin_msg.version_map)
+{
+  // a lanelet is in all the tiles its bounding box overlaps
+  for (const auto & lanelet : lanelet_map_->laneletLayer) {
+    const auto box = lanelet::geometry::boundingBox2d(lanelet);
+    for (int64_t x_index = get_tile_index(box.min().x(), tile_size);
+         x_index <= get_tile_index(box.max().x(), tile_size); ++x_index) {
+      for (int64_t y_index = get_tile_index(box.min().y(), tile_size);
+           y_index <= get_tile_index(box.max().y(), tile_size); ++y_index) {
+        const auto tile_id = get_tile_id_of_index(x_index, y_index);
+        auto & tile = tiles_[tile_id];
+        if (tile.lanelet_ids.empty()) {
+          tile.metadata.cell_id = tile_id;
+          tile.metadata.min_x = static_cast<double>(x_index) * tile_size;
+          tile.metadata.max_x = static_cast<double>(x_index + 1) * tile_size;
+          tile.metadata.min_y = static_cast<double>(y_index) * tile_size;
+          tile.metadata.max_y = static_cast<double>(y_index + 1) * tile_size;
+        }
+        tile.lanelet_ids.push_back(lanelet.id());
+      }
+    }
+  }
+  RCLCPP_INFO(
+    logger_, "Divided %zu lanelets into %zu tiles of %.1f m", lanelet_map_->laneletLayer.size(),
+    tiles_.size(), tile_size);
+
+  get_selected_lanelet2_map_service_ = node->create_service<GetSelectedLanelet2Map>(
+    "service/get_selected_lanelet2_map",
+    std::bind(
+      &Lanelet2SelectedMapLoaderModule::on_service_get_selected_lanelet2_map, this,
+      std::placeholders::_1, std::placeholders::_2));
+
+  // publish the map metadata
+  rclcpp::QoS durable_qos{1};
+  durable_qos.transient_local();
+  pub_metadata_ =
+    node->create_publisher<LaneletMapMetaData>("output/lanelet2_map_metadata", durable_qos);
+  pub_metadata_->publish(create_metadata());
+}
+
+std::string Lanelet2SelectedMapLoaderModule::get_tile_id(
+  const double x, const double y, const double tile_size)
+{
+  return get_tile_id_of_index(get_tile_index(x, tile_size), get_tile_index(y, tile_size));
+}
+
+Lanelet2SelectedMapLoaderModule::LaneletMapMetaData
+Lanelet2SelectedMapLoaderModule::create_metadata() const
+{
+  LaneletMapMetaData metadata_msg;
+  metadata_msg.header.frame_id = "map";
+  metadata_msg.header.stamp = clock_->now();
+  metadata_msg.metadata_list.reserve(tiles_.size());
+  for (const auto & [tile_id, tile] : tiles_) {
+    metadata_msg.metadata_list.push_back(tile.metadata);
+  }
+  return metadata_msg;
+}
+
+autoware_map_msgs::msg::LaneletMapBin Lanelet2SelectedMapLoaderModule::create_tiles_map_bin_msg(
+  const std::vector<std::string> & tile_ids) const
+{
+  // the lanelets of neighboring tiles overlap, each is added once
+  std::set<lanelet::Id> lanelet_ids;
+  for (const auto & tile_id : tile_ids) {
+    const auto tile = tiles_.find(tile_id);
+
+    // skip if the requested ID is not found
+    if (tile == tiles_.end()) {
+      RCLCPP_WARN(logger_, "ID %s not found", tile_id.c_str());
+      continue;
+    }
+    lanelet_ids.insert(tile->second.lanelet_ids.begin(), tile->second.lanelet_ids.end());
+  }
+
+  lanelet::Lanelets lanelets;
+  lanelets.reserve(lanelet_ids.size());
+  for (const auto id : lanelet_ids) {
+    lanelets.push_back(lanelet_map_->laneletLayer.get(id));
+  }
+
+  // the submap also holds the points, linestrings and regulatory elements of the lanelets
+  const lanelet::LaneletMapPtr tiles_map = lanelet::utils::createSubmap(lanelets)->laneletMap();
+
+  autoware_map_msgs::msg::LaneletMapBin map_bin_msg;
+  map_bin_msg.header.frame_id = "map";
+  map_bin_msg.header.stamp = clock_->now();
+  map_bin_msg.version_map_format = version_map_format_;
+  map_bin_msg.version_map = version_map_;
+  lanelet::utils::conversion::toBinMsg(tiles_map, &map_bin_msg);
+  return map_bin_msg;
+}
+
+void Lanelet2SelectedMapLoaderModule::on_service_get_selected_lanelet2_map(
+  GetSelectedLanelet2Map::Request::SharedPtr req,
+  GetSelectedLanelet2Map::Response::SharedPtr res) const
+{
+  res->lanelet2_cells = create_tiles_map_bin_msg(req->cell_ids);
+  res->header = res->lanelet2_cells.header;
+}
+}  // namespace autoware::map_loader
@@ -0,0 +1,79 @@
+// Copyright 2025 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LANELET2_MAP_LOADER__LANELET2_SELECTED_MAP_LOADER_MODULE_HPP_
+#define LANELET2_MAP_LOADER__LANELET2_SELECTED_MAP_LOADER_MODULE_HPP_
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <autoware_map_msgs/msg/lanelet_map_bin.hpp>
+#include <autoware_map_msgs/msg/lanelet_map_meta_data.hpp>
+#include <autoware_map_msgs/srv/get_selected_lanelet2_map.hpp>
+
+#include <lanelet2_core/LaneletMap.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace autoware::map_loader
+{
+/**
+ * Serves the lanelets of square tiles of the loaded map, so that a client only deserializes the
+ * area it needs instead of the whole map.
+ * - The tile IDs and bounds are published as the metadata.
+ * - A lanelet is in all the tiles its bounding box overlaps, with the primitives it references.
+ */
+class Lanelet2SelectedMapLoaderModule
+{
+  using GetSelectedLanelet2Map = autoware_map_msgs::srv::GetSelectedLanelet2Map;
+  using LaneletMapMetaData = autoware_map_msgs::msg::LaneletMapMetaData;
+
+public:
+  Lanelet2SelectedMapLoaderModule(
+    rclcpp::Node * node, lanelet::LaneletMapPtr lanelet_map,
+    const autoware_map_msgs::msg::LaneletMapBin & map_bin_msg, const double tile_size);
+
+  /// ID of the tile including a point
+  [[nodiscard]] static std::string get_tile_id(
+    const double x, const double y, const double tile_size);
+
+  [[nodiscard]] LaneletMapMetaData create_metadata() const;
+  [[nodiscard]] autoware_map_msgs::msg::LaneletMapBin create_tiles_map_bin_msg(
+    const std::vector<std::string> & tile_ids) const;
+
+private:
+  struct Tile
+  {
+    autoware_map_msgs::msg::LaneletMapCellMetaData metadata;
+    lanelet::Ids lanelet_ids;
+  };
+
+  rclcpp::Logger logger_;
+  rclcpp::Clock::SharedPtr clock_;
+  lanelet::LaneletMapPtr lanelet_map_;
+  std::string version_map_format_;
+  std::string version_map_;
+  std::map<std::string, Tile> tiles_;
+
+  rclcpp::Service<GetSelectedLanelet2Map>::SharedPtr get_selected_lanelet2_map_service_;
+  rclcpp::Publisher<LaneletMapMetaData>::SharedPtr pub_metadata_;
+
+  void on_service_get_selected_lanelet2_map(
+    GetSelectedLanelet2Map::Request::SharedPtr req,
+    GetSelectedLanelet2Map::Response::SharedPtr res) const;
+};
+}  // namespace autoware::map_loader
+
+#endif  // LANELET2_MAP_LOADER__LANELET2_SELECTED_MAP_LOADER_MODULE_HPP_
@@ -14,6 +14,8 @@
 
 #include "differential_map_loader_module.hpp"
 
+#include "pointcloud_map_loader_module.hpp"
+
 #include <map>
 #include <string>
 #include <utility>
@@ -22,11 +24,18 @@
 namespace autoware::map_loader
 {
 DifferentialMapLoaderModule::DifferentialMapLoaderModule(
-  rclcpp::Node * node, std::map<std::string, PCDFileMetadata> pcd_file_metadata_dict)
-: logger_(node->get_logger()), all_pcd_file_metadata_dict_(std::move(pcd_file_metadata_dict))
+  rclcpp::Node * node, std::map<std::string, PCDFileMetadata> pcd_file_metadata_dict,
+  std::shared_ptr<PCDTileLoader> tile_loader, const float leaf_size,
+  const std::string & service_name)
+: logger_(node->get_logger()),
+  tile_loader_(
+    tile_loader ? std::move(tile_loader) : std::make_shared<PCDTileLoader>(logger_, 1, 0, "")),
+  leaf_size_(leaf_size),
+  all_pcd_file_metadata_dict_(std::move(pcd_file_metadata_dict)),
+  metadata_index_(all_pcd_file_metadata_dict_)
 {
   get_differential_pcd_maps_service_ = node->create_service<GetDifferentialPointCloudMap>(
-    "service/get_differential_pcd_map",
+    service_name,
     std::bind(
       &DifferentialMapLoaderModule::on_service_get_differential_point_cloud_map, this,
       std::placeholders::_1, std::placeholders::_2));
@@ -36,32 +45,22 @@ void DifferentialMapLoaderModule::differential_area_load(
   const autoware_map_msgs::msg::AreaInfo & area_info, const std::vector<std::string> & cached_ids,
   const GetDifferentialPointCloudMap::Response::SharedPtr & response) const
 {
-  // iterate over all the available pcd map grids
+  // iterate over the pcd map grids within the queried area
   std::vector<bool> should_remove(static_cast<int>(cached_ids.size()), true);
-  for (const auto & ele : all_pcd_file_metadata_dict_) {
-    std::string path = ele.first;
-    PCDFileMetadata metadata = ele.second;
-
+  std::vector<std::string> paths_to_load;
+  for (const auto & path : metadata_index_.query(area_info)) {
     // assume that the map ID = map path (for now)
     const std::string & map_id = path;
 
-    // skip if the pcd file is not within the queried area
-    if (!is_grid_within_queried_area(area_info, metadata)) continue;
-
     auto id_in_cached_list = std::find(cached_ids.begin(), cached_ids.end(), map_id);
     if (id_in_cached_list != cached_ids.end()) {
       int index = static_cast<int>(id_in_cached_list - cached_ids.begin());
       should_remove[index] = false;
     } else {
-      autoware_map_msgs::msg::PointCloudMapCellWithID pointcloud_map_cell_with_id =
-        load_point_cloud_map_cell_with_id(path, map_id);
-      pointcloud_map_cell_with_id.metadata.min_x = metadata.min.x;
-      pointcloud_map_cell_with_id.metadata.min_y = metadata.min.y;
-      pointcloud_map_cell_with_id.metadata.max_x = metadata.max.x;
-      pointcloud_map_cell_with_id.metadata.max_y = metadata.max.y;
-      response->new_pointcloud_with_ids.push_back(pointcloud_map_cell_with_id);
+      paths_to_load.push_back(path);
     }
   }
+  response->new_pointcloud_with_ids = load_point_cloud_map_cells_with_id(paths_to_load);
 
   for (size_t i = 0; i < cached_ids.size(); ++i) {
     if (should_remove[i]) {
@@ -81,17 +80,33 @@ bool DifferentialMapLoaderModule::on_service_get_differential_point_cloud_map(
   return true;
 }
 
-autoware_map_msgs::msg::PointCloudMapCellWithID
-DifferentialMapLoaderModule::load_point_cloud_map_cell_with_id(
-  const std::string & path, const std::string & map_id) const
+std::vector<autoware_map_msgs::msg::PointCloudMapCellWithID>
+DifferentialMapLoaderModule::load_point_cloud_map_cells_with_id(
+  const std::vector<std::string> & paths) const
 {
-  sensor_msgs::msg::PointCloud2 pcd;
-  if (pcl::io::loadPCDFile(path, pcd) == -1) {
-    RCLCPP_ERROR_STREAM(logger_, "PCD load failed: " << path);
+  // the downsampled tiles are cached apart from the full resolution ones, per leaf size
+  PCDTileLoader::Process process = nullptr;
+  std::string process_id;
+  if (leaf_size_ > 0.0F) {
+    process = [this](sensor_msgs::msg::PointCloud2 & pcd) { pcd = downsample(pcd, leaf_size_); };
+    process_id = "leaf_size_" + std::to_string(leaf_size_);
+  }
+  auto pcds = tile_loader_->load_tiles(paths, process, process_id);
+  std::vector<autoware_map_msgs::msg::PointCloudMapCellWithID> pointcloud_map_cells_with_id(
+    paths.size());
+  for (size_t i = 0; i < paths.size(); ++i) {
+    const std::string & path = paths[i];
+    const PCDFileMetadata & metadata = all_pcd_file_metadata_dict_.at(path);
+
+    // assume that the map ID = map path (for now)
+    auto & pointcloud_map_cell_with_id = pointcloud_map_cells_with_id[i];
+    pointcloud_map_cell_with_id.pointcloud = std::move(pcds[i]);
+    pointcloud_map_cell_with_id.cell_id = path;
+    pointcloud_map_cell_with_id.metadata.min_x = metadata.min.x;
+    pointcloud_map_cell_with_id.metadata.min_y = metadata.min.y;
+    pointcloud_map_cell_with_id.metadata.max_x = metadata.max.x;
+    pointcloud_map_cell_with_id.metadata.max_y = metadata.max.y;
   }
-  autoware_map_msgs::msg::PointCloudMapCellWithID pointcloud_map_cell_with_id;
-  pointcloud_map_cell_with_id.pointcloud = pcd;
-  pointcloud_map_cell_with_id.cell_id = map_id;
-  return pointcloud_map_cell_with_id;
+  return pointcloud_map_cells_with_id;
 }
 }  // namespace autoware::map_loader
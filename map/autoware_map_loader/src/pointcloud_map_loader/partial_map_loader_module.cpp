@@ -14,18 +14,28 @@
 
 #include "partial_map_loader_module.hpp"
 
+#include "pointcloud_map_loader_module.hpp"
+
 #include <map>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace autoware::map_loader
 {
 PartialMapLoaderModule::PartialMapLoaderModule(
-  rclcpp::Node * node, std::map<std::string, PCDFileMetadata> pcd_file_metadata_dict)
-: logger_(node->get_logger()), all_pcd_file_metadata_dict_(std::move(pcd_file_metadata_dict))
+  rclcpp::Node * node, std::map<std::string, PCDFileMetadata> pcd_file_metadata_dict,
+  std::shared_ptr<PCDTileLoader> tile_loader, const float leaf_size,
+  const std::string & service_name)
+: logger_(node->get_logger()),
+  tile_loader_(
+    tile_loader ? std::move(tile_loader) : std::make_shared<PCDTileLoader>(logger_, 1, 0, "")),
+  leaf_size_(leaf_size),
+  all_pcd_file_metadata_dict_(std::move(pcd_file_metadata_dict)),
+  metadata_index_(all_pcd_file_metadata_dict_)
 {
   get_partial_pcd_maps_service_ = node->create_service<GetPartialPointCloudMap>(
-    "service/get_partial_pcd_map",
+    service_name,
     std::bind(
       &PartialMapLoaderModule::on_service_get_partial_point_cloud_map, this, std::placeholders::_1,
       std::placeholders::_2));
@@ -35,26 +45,9 @@ void PartialMapLoaderModule::partial_area_load(
   const autoware_map_msgs::msg::AreaInfo & area,
   const GetPartialPointCloudMap::Response::SharedPtr & response) const
 {
-  // iterate over all the available pcd map grids
-  for (const auto & ele : all_pcd_file_metadata_dict_) {
-    std::string path = ele.first;
-    PCDFileMetadata metadata = ele.second;
-
-    // assume that the map ID = map path (for now)
-    const std::string & map_id = path;
-
-    // skip if the pcd file is not within the queried area
-    if (!is_grid_within_queried_area(area, metadata)) continue;
-
-    autoware_map_msgs::msg::PointCloudMapCellWithID pointcloud_map_cell_with_id =
-      load_point_cloud_map_cell_with_id(path, map_id);
-    pointcloud_map_cell_with_id.metadata.min_x = metadata.min.x;
-    pointcloud_map_cell_with_id.metadata.min_y = metadata.min.y;
-    pointcloud_map_cell_with_id.metadata.max_x = metadata.max.x;
-    pointcloud_map_cell_with_id.metadata.max_y = metadata.max.y;
-
-    response->new_pointcloud_with_ids.push_back(pointcloud_map_cell_with_id);
-  }
+  // the pcd map grids within the queried area
+  const auto paths = metadata_index_.query(area);
+  response->new_pointcloud_with_ids = load_point_cloud_map_cells_with_id(paths);
 }
 
 bool PartialMapLoaderModule::on_service_get_partial_point_cloud_map(
@@ -67,17 +60,33 @@ bool PartialMapLoaderModule::on_service_get_partial_point_cloud_map(
   return true;
 }
 
-autoware_map_msgs::msg::PointCloudMapCellWithID
-PartialMapLoaderModule::load_point_cloud_map_cell_with_id(
-  const std::string & path, const std::string & map_id) const
+std::vector<autoware_map_msgs::msg::PointCloudMapCellWithID>
+PartialMapLoaderModule::load_point_cloud_map_cells_with_id(
+  const std::vector<std::string> & paths) const
 {
-  sensor_msgs::msg::PointCloud2 pcd;
-  if (pcl::io::loadPCDFile(path, pcd) == -1) {
-    RCLCPP_ERROR_STREAM(logger_, "PCD load failed: " << path);
+  // the downsampled tiles are cached apart from the full resolution ones, per leaf size
+  PCDTileLoader::Process process = nullptr;
+  std::string process_id;
+  if (leaf_size_ > 0.0F) {
+    process = [this](sensor_msgs::msg::PointCloud2 & pcd) { pcd = downsample(pcd, leaf_size_); };
+    process_id = "leaf_size_" + std::to_string(leaf_size_);
+  }
+  auto pcds = tile_loader_->load_tiles(paths, process, process_id);
+  std::vector<autoware_map_msgs::msg::PointCloudMapCellWithID> pointcloud_map_cells_with_id(
+    paths.size());
+  for (size_t i = 0; i < paths.size(); ++i) {
+    const std::string & path = paths[i];
+    const PCDFileMetadata & metadata = all_pcd_file_metadata_dict_.at(path);
+
+    // assume that the map ID = map path (for now)
+    auto & pointcloud_map_cell_with_id = pointcloud_map_cells_with_id[i];
+    pointcloud_map_cell_with_id.pointcloud = std::move(pcds[i]);
+    pointcloud_map_cell_with_id.cell_id = path;
+    pointcloud_map_cell_with_id.metadata.min_x = metadata.min.x;
+    pointcloud_map_cell_with_id.metadata.min_y = metadata.min.y;
+    pointcloud_map_cell_with_id.metadata.max_x = metadata.max.x;
+    pointcloud_map_cell_with_id.metadata.max_y = metadata.max.y;
   }
-  autoware_map_msgs::msg::PointCloudMapCellWithID pointcloud_map_cell_with_id;
-  pointcloud_map_cell_with_id.pointcloud = pcd;
-  pointcloud_map_cell_with_id.cell_id = map_id;
-  return pointcloud_map_cell_with_id;
+  return pointcloud_map_cells_with_id;
 }
 }  // namespace autoware::map_loader
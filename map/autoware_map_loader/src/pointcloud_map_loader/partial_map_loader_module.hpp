@@ -15,6 +15,8 @@
 #ifndef POINTCLOUD_MAP_LOADER__PARTIAL_MAP_LOADER_MODULE_HPP_
 #define POINTCLOUD_MAP_LOADER__PARTIAL_MAP_LOADER_MODULE_HPP_
 
+#include "pcd_metadata_index.hpp"
+#include "pcd_tile_loader.hpp"
 #include "utils.hpp"
 
 #include <rclcpp/rclcpp.hpp>
@@ -29,6 +31,7 @@
 #include <pcl_conversions/pcl_conversions.h>
 
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -39,13 +42,20 @@ class PartialMapLoaderModule
   using GetPartialPointCloudMap = autoware_map_msgs::srv::GetPartialPointCloudMap;
 
 public:
+  /// The tiles are downsampled to leaf_size if it is positive, and served at full resolution
+  /// otherwise.
   explicit PartialMapLoaderModule(
-    rclcpp::Node * node, std::map<std::string, PCDFileMetadata> pcd_file_metadata_dict);
+    rclcpp::Node * node, std::map<std::string, PCDFileMetadata> pcd_file_metadata_dict,
+    std::shared_ptr<PCDTileLoader> tile_loader = nullptr, const float leaf_size = 0.0F,
+    const std::string & service_name = "service/get_partial_pcd_map");
 
 private:
   rclcpp::Logger logger_;
+  std::shared_ptr<PCDTileLoader> tile_loader_;
+  float leaf_size_;
 
   std::map<std::string, PCDFileMetadata> all_pcd_file_metadata_dict_;
+  PCDMetadataIndex metadata_index_;
   rclcpp::Service<GetPartialPointCloudMap>::SharedPtr get_partial_pcd_maps_service_;
 
   [[nodiscard]] bool on_service_get_partial_point_cloud_map(
@@ -54,8 +64,8 @@ private:
   void partial_area_load(
     const autoware_map_msgs::msg::AreaInfo & area,
     const GetPartialPointCloudMap::Response::SharedPtr & response) const;
-  [[nodiscard]] autoware_map_msgs::msg::PointCloudMapCellWithID load_point_cloud_map_cell_with_id(
-    const std::string & path, const std::string & map_id) const;
+  [[nodiscard]] std::vector<autoware_map_msgs::msg::PointCloudMapCellWithID>
+  load_point_cloud_map_cells_with_id(const std::vector<std::string> & paths) const;
 };
 }  // namespace autoware::map_loader
 
@@ -0,0 +1,69 @@
+// Copyright 2025 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "pcd_metadata_index.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace autoware::map_loader
+{
+PCDMetadataIndex::PCDMetadataIndex(
+  const std::map<std::string, PCDFileMetadata> & pcd_file_metadata_dict)
+{
+  std::vector<Value> values;
+  paths_.reserve(pcd_file_metadata_dict.size());
+  metadata_.reserve(pcd_file_metadata_dict.size());
+  values.reserve(pcd_file_metadata_dict.size());
+  for (const auto & [path, metadata] : pcd_file_metadata_dict) {
+    values.emplace_back(
+      Box{Point{metadata.min.x, metadata.min.y}, Point{metadata.max.x, metadata.max.y}},
+      paths_.size());
+    paths_.push_back(path);
+    metadata_.push_back(metadata);
+  }
+  // bulk loading packs the tree better than inserting one by one
+  rtree_ = decltype(rtree_)(values.begin(), values.end());
+}
+
+std::vector<std::string> PCDMetadataIndex::query(
+  const autoware_map_msgs::msg::AreaInfo & area) const
+{
+  // a box overlapping the cylinder intersects the square circumscribing its base
+  const Box query_box{
+    Point{area.center_x - area.radius, area.center_y - area.radius},
+    Point{area.center_x + area.radius, area.center_y + area.radius}};
+  std::vector<Value> candidates;
+  rtree_.query(boost::geometry::index::intersects(query_box), std::back_inserter(candidates));
+
+  std::vector<size_t> indices;
+  indices.reserve(candidates.size());
+  for (const auto & [box, index] : candidates) {
+    if (is_grid_within_queried_area(area, metadata_[index])) {
+      indices.push_back(index);
+    }
+  }
+  std::sort(indices.begin(), indices.end());
+
+  std::vector<std::string> paths;
+  paths.reserve(indices.size());
+  for (const auto index : indices) {
+    paths.push_back(paths_[index]);
+  }
+  return paths;
+}
+}  // namespace autoware::map_loader
@@ -0,0 +1,58 @@
+// Copyright 2025 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef POINTCLOUD_MAP_LOADER__PCD_METADATA_INDEX_HPP_
+#define POINTCLOUD_MAP_LOADER__PCD_METADATA_INDEX_HPP_
+
+#include "utils.hpp"
+
+#include <autoware_map_msgs/msg/area_info.hpp>
+
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/index/rtree.hpp>
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace autoware::map_loader
+{
+/**
+ * R-tree over the x-y bounds of the pcd files, so that an area query only tests the files near
+ * the area instead of all of them.
+ * - The query returns the same paths as testing every file with is_grid_within_queried_area.
+ * - The paths are returned in the order of the metadata dictionary.
+ */
+class PCDMetadataIndex
+{
+public:
+  explicit PCDMetadataIndex(const std::map<std::string, PCDFileMetadata> & pcd_file_metadata_dict);
+
+  [[nodiscard]] std::vector<std::string> query(const autoware_map_msgs::msg::AreaInfo & area) const;
+
+private:
+  using Point = boost::geometry::model::d2::point_xy<double>;
+  using Box = boost::geometry::model::box<Point>;
+  using Value = std::pair<Box, size_t>;
+
+  // paths and metadata in the order of the dictionary, the values of the R-tree index them
+  std::vector<std::string> paths_;
+  std::vector<PCDFileMetadata> metadata_;
+  boost::geometry::index::rtree<Value, boost::geometry::index::rstar<16>> rtree_;
+};
+}  // namespace autoware::map_loader
+
+#endif  // POINTCLOUD_MAP_LOADER__PCD_METADATA_INDEX_HPP_
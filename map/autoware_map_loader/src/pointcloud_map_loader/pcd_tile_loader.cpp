@@ -0,0 +1,229 @@
+// Copyright 2025 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "pcd_tile_loader.hpp"
+
+#include <fmt/format.h>
+#include <pcl/io/pcd_io.h>
+#include <pcl_conversions/pcl_conversions.h>
+
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace autoware::map_loader
+{
+namespace fs = std::filesystem;
+
+namespace
+{
+// DATA field of the PCD header, as returned by pcl::PCDReader::readHeader()
+constexpr int pcd_data_type_binary = 1;
+}  // namespace
+
+PCDTileLoader::PCDTileLoader(
+  const rclcpp::Logger & logger, const size_t thread_num, const size_t cache_size,
+  std::string binary_cache_directory, const size_t cache_max_bytes)
+: logger_(logger),
+  thread_num_(thread_num != 0 ? thread_num : std::max(1u, std::thread::hardware_concurrency())),
+  cache_size_(cache_size),
+  binary_cache_directory_(std::move(binary_cache_directory)),
+  cache_max_bytes_(cache_max_bytes)
+{
+  if (!binary_cache_directory_.empty()) {
+    std::error_code error_code;
+    fs::create_directories(binary_cache_directory_, error_code);
+    if (error_code) {
+      RCLCPP_WARN_STREAM(
+        logger_, "Binary PCD cache disabled, cannot create " << binary_cache_directory_ << ": "
+                                                              << error_code.message());
+      binary_cache_directory_.clear();
+    }
+  }
+}
+
+std::vector<PCDTileLoader::Tile> PCDTileLoader::load_tiles(
+  const std::vector<std::string> & paths, const Process & process, const std::string & process_id)
+{
+  std::vector<Tile> tiles(paths.size());
+  std::atomic<size_t> next_index{0};
+  const auto load_next_tiles = [&]() {
+    for (size_t i = next_index++; i < paths.size(); i = next_index++) {
+      if (i % 50 == 0) {
+        RCLCPP_DEBUG_STREAM(
+          logger_, fmt::format("Load {} ({} out of {})", paths[i], i + 1, paths.size()));
+      }
+      if (process && !process_id.empty()) {
+        // the path cannot contain the null character, so the key is distinct from any path
+        const std::string key = process_id + '\0' + paths[i];
+        if (const auto cached_tile = find_cached_tile(key)) {
+          tiles[i] = *cached_tile;
+          continue;
+        }
+        auto tile = std::make_shared<Tile>(load_tile_from_file(paths[i]));
+        if (!tile->data.empty()) {
+          process(*tile);
+        }
+        cache_tile(key, tile);
+        tiles[i] = *tile;
+      } else if (process) {
+        tiles[i] = load_tile_from_file(paths[i]);
+        if (!tiles[i].data.empty()) {
+          process(tiles[i]);
+        }
+      } else {
+        tiles[i] = load_tile(paths[i]);
+      }
+    }
+  };
+
+  // the calling thread is one of the loading threads
+  const size_t thread_num = std::min(thread_num_, paths.size());
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < thread_num; ++i) {
+    threads.emplace_back(load_next_tiles);
+  }
+  load_next_tiles();
+  for (auto & thread : threads) {
+    thread.join();
+  }
+  return tiles;
+}
+
+PCDTileLoader::Tile PCDTileLoader::load_tile(const std::string & path)
+{
+  if (const auto cached_tile = find_cached_tile(path)) {
+    return *cached_tile;
+  }
+
+  auto tile = std::make_shared<Tile>(load_tile_from_file(path));
+  cache_tile(path, tile);
+  return *tile;
+}
+
+PCDTileLoader::CacheStats PCDTileLoader::get_cache_stats()
+{
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  return {cache_list_.size(), cache_bytes_};
+}
+
+PCDTileLoader::TileConstPtr PCDTileLoader::find_cached_tile(const std::string & path)
+{
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  const auto it = cache_map_.find(path);
+  if (it == cache_map_.end()) {
+    return nullptr;
+  }
+  cache_list_.splice(cache_list_.begin(), cache_list_, it->second);
+  return it->second->second;
+}
+
+void PCDTileLoader::cache_tile(const std::string & path, const TileConstPtr & tile)
+{
+  // failed loads are not cached, so that they are retried, nor the tiles larger than the budget
+  if (
+    cache_size_ == 0 || tile->data.empty() ||
+    (cache_max_bytes_ != 0 && tile->data.size() > cache_max_bytes_)) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  if (cache_map_.count(path) != 0) {
+    return;
+  }
+  cache_list_.emplace_front(path, tile);
+  cache_map_[path] = cache_list_.begin();
+  cache_bytes_ += tile->data.size();
+  while (cache_list_.size() > cache_size_ ||
+         (cache_max_bytes_ != 0 && cache_bytes_ > cache_max_bytes_)) {
+    cache_bytes_ -= cache_list_.back().second->data.size();
+    cache_map_.erase(cache_list_.back().first);
+    cache_list_.pop_back();
+  }
+}
+
+PCDTileLoader::Tile PCDTileLoader::load_tile_from_file(const std::string & path) const
+{
+  Tile tile;
+  const std::string binary_cache_path = get_binary_cache_path(path);
+  std::error_code error_code;
+  if (
+    !binary_cache_path.empty() && fs::exists(binary_cache_path, error_code) &&
+    fs::last_write_time(binary_cache_path, error_code) >= fs::last_write_time(path, error_code) &&
+    !error_code) {
+    if (pcl::io::loadPCDFile(binary_cache_path, tile) == 0) {
+      return tile;
+    }
+    RCLCPP_WARN_STREAM(logger_, "Binary PCD cache load failed: " << binary_cache_path);
+  }
+
+  if (pcl::io::loadPCDFile(path, tile) == -1) {
+    RCLCPP_ERROR_STREAM(logger_, "PCD load failed: " << path);
+    return tile;
+  }
+
+  if (binary_cache_path.empty()) {
+    return tile;
+  }
+
+  // Convert the ASCII and compressed files only, the binary ones are read as fast as their copy
+  pcl::PCDReader reader;
+  pcl::PCLPointCloud2 header;
+  Eigen::Vector4f origin;
+  Eigen::Quaternionf orientation;
+  int pcd_version = 0;
+  int data_type = 0;
+  unsigned int data_index = 0;
+  if (
+    reader.readHeader(path, header, origin, orientation, pcd_version, data_type, data_index) != 0 ||
+    data_type == pcd_data_type_binary) {
+    return tile;
+  }
+
+  // written to a file of this thread and renamed, so that a concurrent reader never sees a partial
+  // file
+  pcl::PCLPointCloud2 pcl_tile;
+  pcl_conversions::toPCL(tile, pcl_tile);
+  const std::string temporary_path = fmt::format(
+    "{}.{}.tmp", binary_cache_path, std::hash<std::thread::id>{}(std::this_thread::get_id()));
+  pcl::PCDWriter writer;
+  if (writer.writeBinary(temporary_path, pcl_tile, origin, orientation) == 0) {
+    fs::rename(temporary_path, binary_cache_path, error_code);
+  }
+  if (error_code || fs::exists(temporary_path, error_code)) {
+    RCLCPP_WARN_STREAM(logger_, "Binary PCD cache write failed: " << binary_cache_path);
+    fs::remove(temporary_path, error_code);
+  }
+  return tile;
+}
+
+std::string PCDTileLoader::get_binary_cache_path(const std::string & path) const
+{
+  if (binary_cache_directory_.empty()) {
+    return "";
+  }
+  // the tiles of different directories may have the same name
+  std::error_code error_code;
+  const std::string absolute_path = fs::absolute(path, error_code).string();
+  const std::string file_name = fmt::format(
+    "{}_{:016x}.pcd", fs::path(path).stem().string(), std::hash<std::string>{}(absolute_path));
+  return (fs::path(binary_cache_directory_) / file_name).string();
+}
+}  // namespace autoware::map_loader
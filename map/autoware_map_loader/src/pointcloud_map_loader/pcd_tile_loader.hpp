@@ -0,0 +1,93 @@
+// Copyright 2025 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef POINTCLOUD_MAP_LOADER__PCD_TILE_LOADER_HPP_
+#define POINTCLOUD_MAP_LOADER__PCD_TILE_LOADER_HPP_
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace autoware::map_loader
+{
+/**
+ * Loads the PCD files of the map tiles on a bounded number of threads, shared by the loader
+ * modules of the node.
+ * - The tiles loaded by load_tiles() without a process are kept in an LRU of cache_size tiles, and
+ *   of cache_max_bytes bytes of point data if it is not 0.
+ * - If binary_cache_directory is not empty, ASCII and compressed PCD files are converted once to
+ *   binary PCD files in that directory, which are read instead while newer than their source.
+ */
+class PCDTileLoader
+{
+public:
+  using Tile = sensor_msgs::msg::PointCloud2;
+  using Process = std::function<void(Tile &)>;
+
+  struct CacheStats
+  {
+    size_t tile_num;
+    size_t bytes;
+  };
+
+  /// thread_num of 0 uses the number of hardware threads
+  PCDTileLoader(
+    const rclcpp::Logger & logger, const size_t thread_num, const size_t cache_size,
+    std::string binary_cache_directory, const size_t cache_max_bytes = 0);
+
+  /// Load the tiles in the order of paths. A tile that fails to load is empty.
+  /// If process is given, it runs on each non-empty tile in the loading thread, and the processed
+  /// tiles are only cached if process_id names the process, apart from the unprocessed tiles.
+  [[nodiscard]] std::vector<Tile> load_tiles(
+    const std::vector<std::string> & paths, const Process & process = nullptr,
+    const std::string & process_id = "");
+
+  [[nodiscard]] Tile load_tile(const std::string & path);
+
+  [[nodiscard]] CacheStats get_cache_stats();
+
+private:
+  using TileConstPtr = std::shared_ptr<const Tile>;
+
+  rclcpp::Logger logger_;
+  size_t thread_num_;
+  size_t cache_size_;
+  std::string binary_cache_directory_;
+  size_t cache_max_bytes_;
+
+  // LRU of the tiles, the most recently used first
+  std::mutex cache_mutex_;
+  std::list<std::pair<std::string, TileConstPtr>> cache_list_;
+  std::unordered_map<std::string, std::list<std::pair<std::string, TileConstPtr>>::iterator>
+    cache_map_;
+  size_t cache_bytes_{0};
+
+  [[nodiscard]] TileConstPtr find_cached_tile(const std::string & path);
+  void cache_tile(const std::string & path, const TileConstPtr & tile);
+
+  [[nodiscard]] Tile load_tile_from_file(const std::string & path) const;
+  [[nodiscard]] std::string get_binary_cache_path(const std::string & path) const;
+};
+}  // namespace autoware::map_loader
+
+#endif  // POINTCLOUD_MAP_LOADER__PCD_TILE_LOADER_HPP_
@@ -16,9 +16,12 @@
 
 #include "utils.hpp"
 
-#include <fmt/format.h>
+#include <unistd.h>
 
+#include <algorithm>
+#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace autoware::map_loader
@@ -42,8 +45,11 @@ sensor_msgs::msg::PointCloud2 downsample(
 
 PointcloudMapLoaderModule::PointcloudMapLoaderModule(
   rclcpp::Node * node, const std::vector<std::string> & pcd_paths,
-  const std::string & publisher_name, const bool use_downsample)
-: logger_(node->get_logger())
+  const std::string & publisher_name, const bool use_downsample,
+  std::shared_ptr<PCDTileLoader> tile_loader, const bool use_shared_memory)
+: logger_(node->get_logger()),
+  tile_loader_(
+    tile_loader ? std::move(tile_loader) : std::make_shared<PCDTileLoader>(logger_, 1, 0, ""))
 {
   rclcpp::QoS durable_qos{1};
   durable_qos.transient_local();
@@ -64,30 +70,30 @@ PointcloudMapLoaderModule::PointcloudMapLoaderModule(
   }
 
   pcd.header.frame_id = "map";
+  if (use_shared_memory) {
+    // the subscribers on the host map the points instead of receiving a copy each
+    std::string region_name = "/autoware_" + publisher_name + "_" + std::to_string(getpid());
+    std::replace(region_name.begin() + 1, region_name.end(), '/', '_');
+    pcd_region_ = autoware::experimental::lanelet2_utils::SharedMemoryRegion::create(
+      region_name, pcd.data.data(), pcd.data.size());
+    pcd.data = pcd_region_->handle();
+  }
   pub_pointcloud_map_->publish(pcd);
 }
 
 sensor_msgs::msg::PointCloud2 PointcloudMapLoaderModule::load_pcd_files(
   const std::vector<std::string> & pcd_paths, const boost::optional<float> leaf_size) const
 {
-  sensor_msgs::msg::PointCloud2 whole_pcd;
-  sensor_msgs::msg::PointCloud2 partial_pcd;
-
-  for (size_t i = 0; i < pcd_paths.size(); ++i) {
-    auto & path = pcd_paths[i];
-    if (i % 50 == 0) {
-      RCLCPP_DEBUG_STREAM(
-        logger_, fmt::format("Load {} ({} out of {})", path, i + 1, pcd_paths.size()));
-    }
-
-    if (pcl::io::loadPCDFile(path, partial_pcd) == -1) {
-      RCLCPP_ERROR_STREAM(logger_, "PCD load failed: " << path);
-    }
-
-    if (leaf_size) {
-      partial_pcd = downsample(partial_pcd, leaf_size.get());
-    }
+  // the tiles are downsampled in the loading threads
+  PCDTileLoader::Process process = nullptr;
+  if (leaf_size) {
+    process = [leaf_size](sensor_msgs::msg::PointCloud2 & pcd) {
+      pcd = downsample(pcd, leaf_size.get());
+    };
+  }
 
+  sensor_msgs::msg::PointCloud2 whole_pcd;
+  for (const auto & partial_pcd : tile_loader_->load_tiles(pcd_paths, process)) {
     if (whole_pcd.width == 0) {
       whole_pcd = partial_pcd;
     } else {
@@ -15,6 +15,9 @@
 #ifndef POINTCLOUD_MAP_LOADER__POINTCLOUD_MAP_LOADER_MODULE_HPP_
 #define POINTCLOUD_MAP_LOADER__POINTCLOUD_MAP_LOADER_MODULE_HPP_
 
+#include "pcd_tile_loader.hpp"
+
+#include <autoware/lanelet2_utils/shared_memory.hpp>
 #include <rclcpp/rclcpp.hpp>
 
 #include <sensor_msgs/msg/point_cloud2.hpp>
@@ -25,21 +28,28 @@
 #include <pcl/io/pcd_io.h>
 #include <pcl_conversions/pcl_conversions.h>
 
+#include <memory>
 #include <string>
 #include <vector>
 
 namespace autoware::map_loader
 {
+[[nodiscard]] sensor_msgs::msg::PointCloud2 downsample(
+  const sensor_msgs::msg::PointCloud2 & msg_input, const float leaf_size);
+
 class PointcloudMapLoaderModule
 {
 public:
   explicit PointcloudMapLoaderModule(
     rclcpp::Node * node, const std::vector<std::string> & pcd_paths,
-    const std::string & publisher_name, const bool use_downsample);
+    const std::string & publisher_name, const bool use_downsample,
+    std::shared_ptr<PCDTileLoader> tile_loader = nullptr, const bool use_shared_memory = false);
 
 private:
   rclcpp::Logger logger_;
+  std::shared_ptr<PCDTileLoader> tile_loader_;
   rclcpp::Publisher<sensor_msgs::msg::PointCloud2>::SharedPtr pub_pointcloud_map_;
+  std::unique_ptr<autoware::experimental::lanelet2_utils::SharedMemoryRegion> pcd_region_;
 
   [[nodiscard]] sensor_msgs::msg::PointCloud2 load_pcd_files(
     const std::vector<std::string> & pcd_paths, const boost::optional<float> leaf_size) const;
@@ -19,6 +19,7 @@
 #include <pcl/io/pcd_io.h>
 #include <pcl_conversions/pcl_conversions.h>
 
+#include <algorithm>
 #include <filesystem>
 #include <map>
 #include <memory>
@@ -54,31 +55,64 @@ PointCloudMapLoaderNode::PointCloudMapLoaderNode(const rclcpp::NodeOptions & opt
   bool enable_downsample_whole_load = declare_parameter<bool>("enable_downsampled_whole_load");
   bool enable_partial_load = declare_parameter<bool>("enable_partial_load");
   bool enable_selected_load = declare_parameter<bool>("enable_selected_load");
+  const bool use_shared_memory = declare_parameter<bool>("use_shared_memory");
+
+  // shared by the modules, so that the threads and the cached tiles are bounded for the node
+  tile_loader_ = std::make_shared<PCDTileLoader>(
+    get_logger(), static_cast<size_t>(std::max(0, declare_parameter<int>("pcd_load_thread_num"))),
+    static_cast<size_t>(std::max(0, declare_parameter<int>("pcd_tile_cache_size"))),
+    declare_parameter<std::string>("pcd_binary_cache_directory"),
+    static_cast<size_t>(std::max(0, declare_parameter<int>("pcd_tile_cache_max_memory_mb")))
+      << 20U);
 
   if (enable_whole_load) {
     std::string publisher_name = "output/pointcloud_map";
-    pcd_map_loader_ =
-      std::make_unique<PointcloudMapLoaderModule>(this, pcd_paths, publisher_name, false);
+    pcd_map_loader_ = std::make_unique<PointcloudMapLoaderModule>(
+      this, pcd_paths, publisher_name, false, tile_loader_, use_shared_memory);
+    startup_timeline_.mark_phase("whole_load");
   }
 
   if (enable_downsample_whole_load) {
     std::string publisher_name = "output/debug/downsampled_pointcloud_map";
-    downsampled_pcd_map_loader_ =
-      std::make_unique<PointcloudMapLoaderModule>(this, pcd_paths, publisher_name, true);
+    downsampled_pcd_map_loader_ = std::make_unique<PointcloudMapLoaderModule>(
+      this, pcd_paths, publisher_name, true, tile_loader_, use_shared_memory);
+    startup_timeline_.mark_phase("downsampled_whole_load");
   }
 
   // Parse the metadata file and get the map of (absolute pcd path, pcd file metadata)
   auto pcd_metadata_dict = get_pcd_metadata(pcd_metadata_path, pcd_paths);
+  startup_timeline_.mark_phase("load_metadata");
 
   if (enable_partial_load) {
-    partial_map_loader_ = std::make_unique<PartialMapLoaderModule>(this, pcd_metadata_dict);
+    partial_map_loader_ =
+      std::make_unique<PartialMapLoaderModule>(this, pcd_metadata_dict, tile_loader_);
   }
 
-  differential_map_loader_ = std::make_unique<DifferentialMapLoaderModule>(this, pcd_metadata_dict);
+  differential_map_loader_ =
+    std::make_unique<DifferentialMapLoaderModule>(this, pcd_metadata_dict, tile_loader_);
+
+  // coarser copies of the partial and differential servers, the level i uses the i-th leaf size
+  if (declare_parameter<bool>("enable_lod_load")) {
+    const auto lod_leaf_sizes = declare_parameter<std::vector<double>>("lod_leaf_sizes");
+    for (size_t i = 0; i < lod_leaf_sizes.size(); ++i) {
+      const auto leaf_size = static_cast<float>(lod_leaf_sizes[i]);
+      const std::string suffix = "/lod_" + std::to_string(i + 1);
+      if (enable_partial_load) {
+        lod_partial_map_loaders_.push_back(std::make_unique<PartialMapLoaderModule>(
+          this, pcd_metadata_dict, tile_loader_, leaf_size,
+          "service/get_partial_pcd_map" + suffix));
+      }
+      lod_differential_map_loaders_.push_back(std::make_unique<DifferentialMapLoaderModule>(
+        this, pcd_metadata_dict, tile_loader_, leaf_size,
+        "service/get_differential_pcd_map" + suffix));
+    }
+  }
 
   if (enable_selected_load) {
-    selected_map_loader_ = std::make_unique<SelectedMapLoaderModule>(this, pcd_metadata_dict);
+    selected_map_loader_ =
+      std::make_unique<SelectedMapLoaderModule>(this, pcd_metadata_dict, tile_loader_);
   }
+  startup_timeline_.mark_ready();
 }
 
 std::map<std::string, PCDFileMetadata> PointCloudMapLoaderNode::get_pcd_metadata(
@@ -17,9 +17,11 @@
 
 #include "differential_map_loader_module.hpp"
 #include "partial_map_loader_module.hpp"
+#include "pcd_tile_loader.hpp"
 #include "pointcloud_map_loader_module.hpp"
 #include "selected_map_loader_module.hpp"
 
+#include <autoware/node/startup_timeline.hpp>
 #include <rclcpp/rclcpp.hpp>
 
 #include <pcl/common/common.h>
@@ -41,11 +43,16 @@ public:
   explicit PointCloudMapLoaderNode(const rclcpp::NodeOptions & options);
 
 private:
+  // NOTE: the first member, so that the timeline starts before the other members are constructed
+  autoware::node::StartupTimeline startup_timeline_{this};
+  std::shared_ptr<PCDTileLoader> tile_loader_;
   std::unique_ptr<PointcloudMapLoaderModule> pcd_map_loader_;
   std::unique_ptr<PointcloudMapLoaderModule> downsampled_pcd_map_loader_;
   std::unique_ptr<PartialMapLoaderModule> partial_map_loader_;
   std::unique_ptr<DifferentialMapLoaderModule> differential_map_loader_;
   std::unique_ptr<SelectedMapLoaderModule> selected_map_loader_;
+  std::vector<std::unique_ptr<PartialMapLoaderModule>> lod_partial_map_loaders_;
+  std::vector<std::unique_ptr<DifferentialMapLoaderModule>> lod_differential_map_loaders_;
 
   std::vector<std::string> get_pcd_paths(
     const std::vector<std::string> & pcd_paths_or_directory) const;
@@ -17,6 +17,7 @@
 #include <map>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace autoware::map_loader
 {
@@ -47,8 +48,12 @@ autoware_map_msgs::msg::PointCloudMapMetaData create_metadata(
 }
 
 SelectedMapLoaderModule::SelectedMapLoaderModule(
-  rclcpp::Node * node, std::map<std::string, PCDFileMetadata> pcd_file_metadata_dict)
-: logger_(node->get_logger()), all_pcd_file_metadata_dict_(std::move(pcd_file_metadata_dict))
+  rclcpp::Node * node, std::map<std::string, PCDFileMetadata> pcd_file_metadata_dict,
+  std::shared_ptr<PCDTileLoader> tile_loader)
+: logger_(node->get_logger()),
+  tile_loader_(
+    tile_loader ? std::move(tile_loader) : std::make_shared<PCDTileLoader>(logger_, 1, 0, "")),
+  all_pcd_file_metadata_dict_(std::move(pcd_file_metadata_dict))
 {
   get_selected_pcd_maps_service_ = node->create_service<GetSelectedPointCloudMap>(
     "service/get_selected_pcd_map",
@@ -69,6 +74,7 @@ bool SelectedMapLoaderModule::on_service_get_selected_point_cloud_map(
   GetSelectedPointCloudMap::Response::SharedPtr res) const
 {
   const auto request_ids = req->cell_ids;
+  std::vector<std::string> paths;
   for (const auto & request_id : request_ids) {
     const auto requested_selected_map_iterator = all_pcd_file_metadata_dict_.find(request_id);
 
@@ -78,35 +84,33 @@ bool SelectedMapLoaderModule::on_service_get_selected_point_cloud_map(
       continue;
     }
 
-    const std::string path = requested_selected_map_iterator->first;
-    // assume that the map ID = map path (for now)
-    const std::string & map_id = path;
-    PCDFileMetadata metadata = requested_selected_map_iterator->second;
-
-    autoware_map_msgs::msg::PointCloudMapCellWithID pointcloud_map_cell_with_id =
-      load_point_cloud_map_cell_with_id(path, map_id);
-    pointcloud_map_cell_with_id.metadata.min_x = metadata.min.x;
-    pointcloud_map_cell_with_id.metadata.min_y = metadata.min.y;
-    pointcloud_map_cell_with_id.metadata.max_x = metadata.max.x;
-    pointcloud_map_cell_with_id.metadata.max_y = metadata.max.y;
-
-    res->new_pointcloud_with_ids.push_back(pointcloud_map_cell_with_id);
+    paths.push_back(requested_selected_map_iterator->first);
   }
+  res->new_pointcloud_with_ids = load_point_cloud_map_cells_with_id(paths);
   res->header.frame_id = "map";
   return true;
 }
 
-autoware_map_msgs::msg::PointCloudMapCellWithID
-SelectedMapLoaderModule::load_point_cloud_map_cell_with_id(
-  const std::string & path, const std::string & map_id) const
+std::vector<autoware_map_msgs::msg::PointCloudMapCellWithID>
+SelectedMapLoaderModule::load_point_cloud_map_cells_with_id(
+  const std::vector<std::string> & paths) const
 {
-  sensor_msgs::msg::PointCloud2 pcd;
-  if (pcl::io::loadPCDFile(path, pcd) == -1) {
-    RCLCPP_ERROR_STREAM(logger_, "PCD load failed: " << path);
+  auto pcds = tile_loader_->load_tiles(paths);
+  std::vector<autoware_map_msgs::msg::PointCloudMapCellWithID> pointcloud_map_cells_with_id(
+    paths.size());
+  for (size_t i = 0; i < paths.size(); ++i) {
+    const std::string & path = paths[i];
+    const PCDFileMetadata & metadata = all_pcd_file_metadata_dict_.at(path);
+
+    // assume that the map ID = map path (for now)
+    auto & pointcloud_map_cell_with_id = pointcloud_map_cells_with_id[i];
+    pointcloud_map_cell_with_id.pointcloud = std::move(pcds[i]);
+    pointcloud_map_cell_with_id.cell_id = path;
+    pointcloud_map_cell_with_id.metadata.min_x = metadata.min.x;
+    pointcloud_map_cell_with_id.metadata.min_y = metadata.min.y;
+    pointcloud_map_cell_with_id.metadata.max_x = metadata.max.x;
+    pointcloud_map_cell_with_id.metadata.max_y = metadata.max.y;
   }
-  autoware_map_msgs::msg::PointCloudMapCellWithID pointcloud_map_cell_with_id;
-  pointcloud_map_cell_with_id.pointcloud = pcd;
-  pointcloud_map_cell_with_id.cell_id = map_id;
-  return pointcloud_map_cell_with_id;
+  return pointcloud_map_cells_with_id;
 }
 }  // namespace autoware::map_loader
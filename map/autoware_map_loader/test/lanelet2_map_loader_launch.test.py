@@ -40,6 +40,10 @@ def generate_test_description():
                 "center_line_resolution": 5.0,
                 "use_waypoints": True,
                 "allow_unsupported_version": True,
+                "lanelet2_map_cache_directory": "",
+                "enable_selected_load": False,
+                "selected_load_tile_size": 500.0,
+                "use_shared_memory": False,
             }
         ],
     )
@@ -0,0 +1,123 @@
+// Copyright 2025 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../src/lanelet2_map_loader/lanelet2_map_cache.hpp"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace fs = std::filesystem;
+using autoware::map_loader::get_lanelet2_map_cache_key;
+using autoware::map_loader::get_lanelet2_map_cache_path;
+using autoware::map_loader::read_lanelet2_map_cache;
+using autoware::map_loader::write_lanelet2_map_cache;
+using autoware_map_msgs::msg::LaneletMapBin;
+using autoware_map_msgs::msg::MapProjectorInfo;
+
+class TestLanelet2MapCache : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    directory_ = fs::temp_directory_path() / "test_lanelet2_map_cache";
+    fs::remove_all(directory_);
+    fs::create_directories(directory_);
+
+    map_path_ = (directory_ / "lanelet2_map.osm").string();
+    std::ofstream(map_path_) << "<osm version=\"0.6\"></osm>\n";
+
+    projector_info_.projector_type = MapProjectorInfo::MGRS;
+    projector_info_.vertical_datum = MapProjectorInfo::WGS84;
+    projector_info_.mgrs_grid = "54SUE";
+
+    map_bin_msg_.version_map_format = "1.2.0";
+    map_bin_msg_.version_map = "1.0.0";
+    map_bin_msg_.data = {1, 2, 3, 4, 5, 6, 7, 8};
+  }
+
+  void TearDown() override { fs::remove_all(directory_); }
+
+  fs::path directory_;
+  std::string map_path_;
+  MapProjectorInfo projector_info_;
+  LaneletMapBin map_bin_msg_;
+};
+
+TEST_F(TestLanelet2MapCache, KeyDependsOnMapAndParameters)
+{
+  const auto key = get_lanelet2_map_cache_key(map_path_, projector_info_, 5.0, true);
+  ASSERT_FALSE(key.empty());
+  EXPECT_EQ(get_lanelet2_map_cache_key(map_path_, projector_info_, 5.0, true), key);
+  EXPECT_NE(get_lanelet2_map_cache_key(map_path_, projector_info_, 2.0, true), key);
+  EXPECT_NE(get_lanelet2_map_cache_key(map_path_, projector_info_, 5.0, false), key);
+
+  auto other_projector_info = projector_info_;
+  other_projector_info.mgrs_grid = "54SUF";
+  EXPECT_NE(get_lanelet2_map_cache_key(map_path_, other_projector_info, 5.0, true), key);
+
+  std::ofstream(map_path_) << "<osm version=\"0.6\"><node id=\"1\"/></osm>\n";
+  EXPECT_NE(get_lanelet2_map_cache_key(map_path_, projector_info_, 5.0, true), key);
+
+  EXPECT_TRUE(
+    get_lanelet2_map_cache_key((directory_ / "missing.osm").string(), projector_info_, 5.0, true)
+      .empty());
+}
+
+TEST_F(TestLanelet2MapCache, ReadWrittenMap)
+{
+  const auto key = get_lanelet2_map_cache_key(map_path_, projector_info_, 5.0, true);
+  const auto cache_path = get_lanelet2_map_cache_path(directory_.string(), map_path_, key);
+  EXPECT_FALSE(read_lanelet2_map_cache(cache_path, key).has_value());
+
+  ASSERT_TRUE(write_lanelet2_map_cache(cache_path, key, map_bin_msg_));
+  const auto cached = read_lanelet2_map_cache(cache_path, key);
+  ASSERT_TRUE(cached.has_value());
+  EXPECT_EQ(cached->version_map_format, map_bin_msg_.version_map_format);
+  EXPECT_EQ(cached->version_map, map_bin_msg_.version_map);
+  EXPECT_EQ(cached->data, map_bin_msg_.data);
+}
+
+TEST_F(TestLanelet2MapCache, IgnoreMapOfAnotherKey)
+{
+  const auto key = get_lanelet2_map_cache_key(map_path_, projector_info_, 5.0, true);
+  const auto cache_path = get_lanelet2_map_cache_path(directory_.string(), map_path_, key);
+  ASSERT_TRUE(write_lanelet2_map_cache(cache_path, key, map_bin_msg_));
+
+  const auto other_key = get_lanelet2_map_cache_key(map_path_, projector_info_, 2.0, true);
+  EXPECT_NE(get_lanelet2_map_cache_path(directory_.string(), map_path_, other_key), cache_path);
+  EXPECT_FALSE(read_lanelet2_map_cache(cache_path, other_key).has_value());
+}
+
+TEST_F(TestLanelet2MapCache, IgnoreCorruptedMap)
+{
+  const auto key = get_lanelet2_map_cache_key(map_path_, projector_info_, 5.0, true);
+  const auto cache_path = get_lanelet2_map_cache_path(directory_.string(), map_path_, key);
+  ASSERT_TRUE(write_lanelet2_map_cache(cache_path, key, map_bin_msg_));
+
+  // flip the last byte of the data, before the hash
+  const auto size = fs::file_size(cache_path);
+  {
+    std::fstream file(cache_path, std::ios::binary | std::ios::in | std::ios::out);
+    file.seekp(static_cast<std::streamoff>(size - sizeof(uint64_t) - 1));
+    file.put(static_cast<char>(0xff));
+  }
+  EXPECT_FALSE(read_lanelet2_map_cache(cache_path, key).has_value());
+
+  // truncated file
+  fs::resize_file(cache_path, size / 2);
+  EXPECT_FALSE(read_lanelet2_map_cache(cache_path, key).has_value());
+}
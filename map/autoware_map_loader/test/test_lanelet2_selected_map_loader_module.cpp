@@ -0,0 +1,128 @@
+// Copyright 2025 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../src/lanelet2_map_loader/lanelet2_selected_map_loader_module.hpp"
+
+#include <autoware_lanelet2_extension/utility/message_conversion.hpp>
+#include <rclcpp/rclcpp.hpp>
+
+#include <gtest/gtest.h>
+#include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_core/primitives/Lanelet.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+using autoware::map_loader::Lanelet2SelectedMapLoaderModule;
+using autoware_map_msgs::srv::GetSelectedLanelet2Map;
+
+class TestLanelet2SelectedMapLoaderModule : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    rclcpp::init(0, nullptr);
+    node_ = std::make_shared<rclcpp::Node>("test_lanelet2_selected_map_loader_module");
+
+    // lanelet 1 from x = 0 to 80 in tile 0_0, lanelet 2 from x = 80 to 160 in tiles 0_0 and 1_0
+    const auto create_lanelet = [](const lanelet::Id id, const double min_x, const double max_x) {
+      lanelet::LineString3d left(
+        id * 10 + 1,
+        {lanelet::Point3d(id * 10 + 2, min_x, 4.0, 0.0),
+         lanelet::Point3d(id * 10 + 3, max_x, 4.0, 0.0)});
+      lanelet::LineString3d right(
+        id * 10 + 4,
+        {lanelet::Point3d(id * 10 + 5, min_x, 1.0, 0.0),
+         lanelet::Point3d(id * 10 + 6, max_x, 1.0, 0.0)});
+      return lanelet::Lanelet(id, left, right);
+    };
+    const auto lanelet_map = std::make_shared<lanelet::LaneletMap>();
+    lanelet_map->add(create_lanelet(1, 0.0, 80.0));
+    lanelet_map->add(create_lanelet(2, 80.0, 160.0));
+
+    autoware_map_msgs::msg::LaneletMapBin map_bin_msg;
+    map_bin_msg.version_map_format = "1.2.0";
+    map_bin_msg.version_map = "1.0.0";
+    module_ = std::make_unique<Lanelet2SelectedMapLoaderModule>(
+      node_.get(), lanelet_map, map_bin_msg, 100.0);
+
+    client_ = node_->create_client<GetSelectedLanelet2Map>("service/get_selected_lanelet2_map");
+  }
+
+  void TearDown() override { rclcpp::shutdown(); }
+
+  static lanelet::LaneletMapPtr from_bin_msg(const autoware_map_msgs::msg::LaneletMapBin & msg)
+  {
+    auto lanelet_map = std::make_shared<lanelet::LaneletMap>();
+    lanelet::utils::conversion::fromBinMsg(msg, lanelet_map);
+    return lanelet_map;
+  }
+
+  rclcpp::Node::SharedPtr node_;
+  std::unique_ptr<Lanelet2SelectedMapLoaderModule> module_;
+  rclcpp::Client<GetSelectedLanelet2Map>::SharedPtr client_;
+};
+
+TEST_F(TestLanelet2SelectedMapLoaderModule, TileIdOfPoint)
+{
+  EXPECT_EQ(Lanelet2SelectedMapLoaderModule::get_tile_id(50.0, 50.0, 100.0), "0_0");
+  EXPECT_EQ(Lanelet2SelectedMapLoaderModule::get_tile_id(150.0, 50.0, 100.0), "1_0");
+  EXPECT_EQ(Lanelet2SelectedMapLoaderModule::get_tile_id(-50.0, -150.0, 100.0), "-1_-2");
+}
+
+TEST_F(TestLanelet2SelectedMapLoaderModule, MetadataOfOverlappedTiles)
+{
+  const auto metadata = module_->create_metadata();
+  ASSERT_EQ(metadata.metadata_list.size(), 2U);
+  EXPECT_EQ(metadata.metadata_list[0].cell_id, "0_0");
+  EXPECT_DOUBLE_EQ(metadata.metadata_list[0].min_x, 0.0);
+  EXPECT_DOUBLE_EQ(metadata.metadata_list[0].max_x, 100.0);
+  EXPECT_EQ(metadata.metadata_list[1].cell_id, "1_0");
+  EXPECT_DOUBLE_EQ(metadata.metadata_list[1].min_x, 100.0);
+  EXPECT_DOUBLE_EQ(metadata.metadata_list[1].max_x, 200.0);
+}
+
+TEST_F(TestLanelet2SelectedMapLoaderModule, LaneletsOfRequestedTiles)
+{
+  const auto second_tile_map = from_bin_msg(module_->create_tiles_map_bin_msg({"1_0"}));
+  EXPECT_EQ(second_tile_map->laneletLayer.size(), 1U);
+  EXPECT_TRUE(second_tile_map->laneletLayer.exists(2));
+  EXPECT_EQ(second_tile_map->pointLayer.size(), 4U);
+
+  const auto both_tiles_map =
+    from_bin_msg(module_->create_tiles_map_bin_msg({"0_0", "1_0", "unknown"}));
+  EXPECT_EQ(both_tiles_map->laneletLayer.size(), 2U);
+}
+
+TEST_F(TestLanelet2SelectedMapLoaderModule, ServeRequestedTiles)
+{
+  ASSERT_TRUE(client_->wait_for_service(std::chrono::seconds(3)));
+
+  auto request = std::make_shared<GetSelectedLanelet2Map::Request>();
+  request->cell_ids = {"0_0"};
+  auto result_future = client_->async_send_request(request);
+  ASSERT_EQ(
+    rclcpp::spin_until_future_complete(node_, result_future), rclcpp::FutureReturnCode::SUCCESS);
+
+  const auto result = result_future.get();
+  EXPECT_EQ(result->lanelet2_cells.version_map_format, "1.2.0");
+  EXPECT_EQ(from_bin_msg(result->lanelet2_cells)->laneletLayer.size(), 2U);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
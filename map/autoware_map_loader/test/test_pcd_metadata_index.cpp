@@ -0,0 +1,103 @@
+// Copyright 2025 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../src/pointcloud_map_loader/pcd_metadata_index.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+using autoware::map_loader::is_grid_within_queried_area;
+using autoware::map_loader::PCDFileMetadata;
+using autoware::map_loader::PCDMetadataIndex;
+
+namespace
+{
+// 20 x 20 grids of 20 m
+std::map<std::string, PCDFileMetadata> create_grid_metadata_dict()
+{
+  std::map<std::string, PCDFileMetadata> metadata_dict;
+  for (int x = 0; x < 20; ++x) {
+    for (int y = 0; y < 20; ++y) {
+      PCDFileMetadata metadata;
+      metadata.min = pcl::PointXYZ(x * 20.0f, y * 20.0f, -5.0f);
+      metadata.max = pcl::PointXYZ((x + 1) * 20.0f, (y + 1) * 20.0f, 5.0f);
+      metadata_dict["/map/" + std::to_string(x) + "_" + std::to_string(y) + ".pcd"] = metadata;
+    }
+  }
+  return metadata_dict;
+}
+
+autoware_map_msgs::msg::AreaInfo create_area(
+  const double center_x, const double center_y, const double radius)
+{
+  autoware_map_msgs::msg::AreaInfo area;
+  area.center_x = static_cast<float>(center_x);
+  area.center_y = static_cast<float>(center_y);
+  area.radius = static_cast<float>(radius);
+  return area;
+}
+}  // namespace
+
+TEST(PCDMetadataIndex, SameAsLinearScan)
+{
+  const auto metadata_dict = create_grid_metadata_dict();
+  const PCDMetadataIndex index(metadata_dict);
+
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<double> position_distribution(-50.0, 450.0);
+  std::uniform_real_distribution<double> radius_distribution(0.0, 100.0);
+  for (int i = 0; i < 200; ++i) {
+    const auto area = create_area(
+      position_distribution(engine), position_distribution(engine), radius_distribution(engine));
+
+    std::vector<std::string> expected_paths;
+    for (const auto & [path, metadata] : metadata_dict) {
+      if (is_grid_within_queried_area(area, metadata)) {
+        expected_paths.push_back(path);
+      }
+    }
+    EXPECT_EQ(index.query(area), expected_paths);
+  }
+}
+
+TEST(PCDMetadataIndex, AreaOutsideOfMap)
+{
+  const PCDMetadataIndex index(create_grid_metadata_dict());
+  EXPECT_TRUE(index.query(create_area(-100.0, -100.0, 50.0)).empty());
+}
+
+TEST(PCDMetadataIndex, AreaOnGridCorner)
+{
+  const PCDMetadataIndex index(create_grid_metadata_dict());
+  EXPECT_THAT(
+    index.query(create_area(20.0, 20.0, 1.0)),
+    ::testing::ElementsAre("/map/0_0.pcd", "/map/0_1.pcd", "/map/1_0.pcd", "/map/1_1.pcd"));
+}
+
+TEST(PCDMetadataIndex, EmptyDict)
+{
+  const PCDMetadataIndex index({});
+  EXPECT_TRUE(index.query(create_area(0.0, 0.0, 100.0)).empty());
+}
+
+int main(int argc, char ** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
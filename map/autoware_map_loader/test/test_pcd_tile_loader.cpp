@@ -0,0 +1,199 @@
+// Copyright 2025 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../src/pointcloud_map_loader/pcd_tile_loader.hpp"
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <gtest/gtest.h>
+#include <pcl/io/pcd_io.h>
+#include <pcl/point_types.h>
+#include <pcl_conversions/pcl_conversions.h>
+
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+using autoware::map_loader::PCDTileLoader;
+
+class TestPCDTileLoader : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    directory_ = fs::temp_directory_path() / "test_pcd_tile_loader";
+    fs::remove_all(directory_);
+    fs::create_directories(directory_);
+
+    // Tile i has i + 1 points at x = i
+    for (size_t i = 0; i < 8; ++i) {
+      pcl::PointCloud<pcl::PointXYZ> cloud;
+      for (size_t j = 0; j <= i; ++j) {
+        cloud.push_back(pcl::PointXYZ(static_cast<float>(i), static_cast<float>(j), 0.0f));
+      }
+      paths_.push_back((directory_ / ("tile_" + std::to_string(i) + ".pcd")).string());
+      pcl::io::savePCDFileASCII(paths_.back(), cloud);
+    }
+  }
+
+  void TearDown() override { fs::remove_all(directory_); }
+
+  static void expect_tile(const PCDTileLoader::Tile & tile, const size_t i)
+  {
+    pcl::PointCloud<pcl::PointXYZ> cloud;
+    pcl::fromROSMsg(tile, cloud);
+    ASSERT_EQ(cloud.size(), i + 1);
+    for (const auto & point : cloud) {
+      EXPECT_FLOAT_EQ(point.x, static_cast<float>(i));
+    }
+  }
+
+  rclcpp::Logger logger_ = rclcpp::get_logger("test_pcd_tile_loader");
+  fs::path directory_;
+  std::vector<std::string> paths_;
+};
+
+TEST_F(TestPCDTileLoader, LoadTilesInOrderOfPaths)
+{
+  PCDTileLoader loader(logger_, 4, 0, "");
+  const auto tiles = loader.load_tiles(paths_);
+  ASSERT_EQ(tiles.size(), paths_.size());
+  for (size_t i = 0; i < tiles.size(); ++i) {
+    expect_tile(tiles[i], i);
+  }
+}
+
+TEST_F(TestPCDTileLoader, FailedTileIsEmpty)
+{
+  PCDTileLoader loader(logger_, 2, 4, "");
+  const auto tiles = loader.load_tiles({paths_[0], (directory_ / "missing.pcd").string()});
+  ASSERT_EQ(tiles.size(), 2U);
+  expect_tile(tiles[0], 0);
+  EXPECT_TRUE(tiles[1].data.empty());
+}
+
+TEST_F(TestPCDTileLoader, ProcessEachTile)
+{
+  PCDTileLoader loader(logger_, 3, 0, "");
+  const auto tiles =
+    loader.load_tiles(paths_, [](PCDTileLoader::Tile & tile) { tile.header.frame_id = "map"; });
+  for (const auto & tile : tiles) {
+    EXPECT_EQ(tile.header.frame_id, "map");
+  }
+}
+
+TEST_F(TestPCDTileLoader, CacheNamedProcessApart)
+{
+  PCDTileLoader loader(logger_, 2, 4, "");
+  const auto keep_first_point = [](PCDTileLoader::Tile & tile) {
+    pcl::PointCloud<pcl::PointXYZ> cloud;
+    pcl::fromROSMsg(tile, cloud);
+    cloud.resize(1);
+    pcl::toROSMsg(cloud, tile);
+  };
+  ASSERT_EQ(loader.load_tiles({paths_[1]}, keep_first_point, "first_point").front().width, 1U);
+  expect_tile(loader.load_tile(paths_[1]), 1);
+
+  // both the processed and the unprocessed tiles are served from the cache
+  fs::remove(paths_[1]);
+  EXPECT_EQ(loader.load_tiles({paths_[1]}, keep_first_point, "first_point").front().width, 1U);
+  expect_tile(loader.load_tile(paths_[1]), 1);
+}
+
+TEST_F(TestPCDTileLoader, ServeCachedTiles)
+{
+  PCDTileLoader loader(logger_, 1, 2, "");
+  expect_tile(loader.load_tile(paths_[0]), 0);
+  expect_tile(loader.load_tile(paths_[1]), 1);
+
+  // the cached tiles are served even once their files are removed, the least recent is evicted
+  fs::remove(paths_[0]);
+  fs::remove(paths_[1]);
+  expect_tile(loader.load_tile(paths_[0]), 0);
+  expect_tile(loader.load_tile(paths_[2]), 2);
+  expect_tile(loader.load_tile(paths_[0]), 0);
+  EXPECT_TRUE(loader.load_tile(paths_[1]).data.empty());
+}
+
+TEST_F(TestPCDTileLoader, EvictTilesBeyondMemoryBudget)
+{
+  const size_t bytes_0 = PCDTileLoader(logger_, 1, 0, "").load_tile(paths_[0]).data.size();
+  const size_t bytes_1 = PCDTileLoader(logger_, 1, 0, "").load_tile(paths_[1]).data.size();
+  const size_t bytes_2 = PCDTileLoader(logger_, 1, 0, "").load_tile(paths_[2]).data.size();
+  ASSERT_GT(bytes_2, bytes_1);
+
+  PCDTileLoader loader(logger_, 1, paths_.size(), "", bytes_0 + bytes_1);
+  expect_tile(loader.load_tile(paths_[0]), 0);
+  expect_tile(loader.load_tile(paths_[1]), 1);
+  EXPECT_EQ(loader.get_cache_stats().tile_num, 2U);
+  EXPECT_EQ(loader.get_cache_stats().bytes, bytes_0 + bytes_1);
+
+  // the least recently used tiles are evicted until the new one fits
+  expect_tile(loader.load_tile(paths_[0]), 0);
+  expect_tile(loader.load_tile(paths_[2]), 2);
+  EXPECT_LE(loader.get_cache_stats().bytes, bytes_0 + bytes_1);
+  fs::remove(paths_[1]);
+  EXPECT_TRUE(loader.load_tile(paths_[1]).data.empty());
+
+  // a tile larger than the budget is not cached
+  expect_tile(loader.load_tile(paths_[7]), 7);
+  fs::remove(paths_[7]);
+  EXPECT_TRUE(loader.load_tile(paths_[7]).data.empty());
+}
+
+TEST_F(TestPCDTileLoader, ConvertToBinaryCache)
+{
+  const fs::path cache_directory = directory_ / "binary";
+  {
+    PCDTileLoader loader(logger_, 4, 0, cache_directory.string());
+    const auto tiles = loader.load_tiles(paths_);
+    for (size_t i = 0; i < tiles.size(); ++i) {
+      expect_tile(tiles[i], i);
+    }
+  }
+
+  std::vector<fs::path> cache_paths;
+  for (const auto & entry : fs::directory_iterator(cache_directory)) {
+    cache_paths.push_back(entry.path());
+  }
+  ASSERT_EQ(cache_paths.size(), paths_.size());
+
+  // the binary copies are read while they are newer than their source, marked here by one point
+  for (const auto & cache_path : cache_paths) {
+    pcl::PointCloud<pcl::PointXYZ> marker;
+    marker.push_back(pcl::PointXYZ(0.0f, 0.0f, 0.0f));
+    pcl::io::savePCDFileBinary(cache_path.string(), marker);
+  }
+  PCDTileLoader loader(logger_, 4, 0, cache_directory.string());
+  for (const auto & tile : loader.load_tiles(paths_)) {
+    EXPECT_EQ(tile.width, 1U);
+  }
+
+  // and are converted again once their source is updated
+  for (const auto & path : paths_) {
+    fs::last_write_time(path, fs::last_write_time(cache_paths.front()) + std::chrono::hours(1));
+  }
+  const auto tiles = loader.load_tiles(paths_);
+  for (size_t i = 0; i < tiles.size(); ++i) {
+    expect_tile(tiles[i], i);
+  }
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
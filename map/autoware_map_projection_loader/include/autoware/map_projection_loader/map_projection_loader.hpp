@@ -16,6 +16,7 @@
 #define AUTOWARE__MAP_PROJECTION_LOADER__MAP_PROJECTION_LOADER_HPP_
 
 #include <autoware/component_interface_specs/map.hpp>
+#include <autoware/node/startup_timeline.hpp>
 #include <rclcpp/rclcpp.hpp>
 
 #include <string>
@@ -33,6 +34,7 @@ public:
 
 private:
   using MapProjectorInfo = autoware::component_interface_specs::map::MapProjectorInfo;
+  autoware::node::StartupTimeline startup_timeline_{this};
   rclcpp::Publisher<MapProjectorInfo::Message>::SharedPtr publisher_;
 };
 }  // namespace autoware::map_projection_loader
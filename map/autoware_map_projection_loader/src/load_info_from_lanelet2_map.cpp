@@ -16,46 +16,87 @@
 
 #include <autoware_map_msgs/msg/map_projector_info.hpp>
 
-#include <lanelet2_core/LaneletMap.h>
-#include <lanelet2_core/geometry/LineString.h>
-#include <lanelet2_io/Io.h>
-#include <lanelet2_projection/UTM.h>
+#include <lanelet2_io/Projection.h>
 
-#include <sstream>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <optional>
+#include <stdexcept>
 #include <string>
 
 namespace autoware::map_projection_loader
 {
-autoware_map_msgs::msg::MapProjectorInfo load_info_from_lanelet2_map(const std::string & filename)
+namespace
+{
+// value of an attribute of the content of a tag, e.g. `node id="1" lat="35.0" lon="139.0"/`
+std::optional<std::string> get_attribute(const std::string & tag, const std::string & name)
 {
-  lanelet::ErrorMessages errors{};
-  lanelet::projection::MGRSProjector projector{};
-  const lanelet::LaneletMapPtr map = lanelet::load(filename, projector, &errors);
-  if (!errors.empty()) {
-    std::stringstream ss;
-    ss << "Error occurred while loading lanelet2 map:\n";
-    for (const auto & err : errors) {
-      ss << "- " << err << "\n";
+  for (size_t pos = tag.find(name); pos != std::string::npos; pos = tag.find(name, pos + 1)) {
+    // skip the attributes whose name ends with the name
+    if (pos == 0 || !std::isspace(static_cast<unsigned char>(tag[pos - 1]))) {
+      continue;
+    }
+    size_t i = tag.find_first_not_of(" \t\r\n", pos + name.size());
+    if (i == std::string::npos || tag[i] != '=') {
+      continue;
+    }
+    i = tag.find_first_not_of(" \t\r\n", i + 1);
+    if (i == std::string::npos || (tag[i] != '"' && tag[i] != '\'')) {
+      continue;
     }
-    throw std::runtime_error(ss.str());
+    const size_t end = tag.find(tag[i], i + 1);
+    if (end == std::string::npos) {
+      return std::nullopt;
+    }
+    return tag.substr(i + 1, end - i - 1);
+  }
+  return std::nullopt;
+}
+
+// the same as the OSM parser of lanelet2, which reads a missing or an empty coordinate as zero
+double to_coordinate(const std::optional<std::string> & value)
+{
+  return value ? std::strtod(value->c_str(), nullptr) : 0.0;
+}
+}  // namespace
+
+autoware_map_msgs::msg::MapProjectorInfo load_info_from_lanelet2_map(const std::string & filename)
+{
+  // NOTE: only the node elements are scanned until the first one with a non-zero latitude or
+  // longitude, instead of building the whole map which Lanelet2MapLoaderNode loads again
+  std::ifstream file(filename);
+  if (!file) {
+    throw std::runtime_error("Error occurred while loading lanelet2 map: cannot open " + filename);
   }
 
   // If the lat & lon values in all the points of lanelet2 map are all zeros,
   // it will be interpreted as a local map.
   // If any single point exists with non-zero lat or lon values, it will be interpreted as MGRS.
-  bool is_local = true;
-  for (const auto & point : map->pointLayer) {
-    const auto gps_point = projector.reverse(point);
-    if (gps_point.lat != 0.0 || gps_point.lon != 0.0) {
-      is_local = false;
-      break;
+  std::optional<lanelet::GPSPoint> gps_point;
+  std::string chunk;
+  // each chunk starts with the content of a tag, which ends at the first '>' since '<' and '>' are
+  // escaped in the attribute values
+  while (!gps_point && std::getline(file, chunk, '<')) {
+    if (
+      chunk.size() < 5 || chunk.compare(0, 4, "node") != 0 ||
+      !std::isspace(static_cast<unsigned char>(chunk[4]))) {
+      continue;
+    }
+    const std::string tag = chunk.substr(0, chunk.find('>'));
+    const double lat = to_coordinate(get_attribute(tag, "lat"));
+    const double lon = to_coordinate(get_attribute(tag, "lon"));
+    if (lat != 0.0 || lon != 0.0) {
+      gps_point = lanelet::GPSPoint{lat, lon, 0.0};
     }
   }
 
   autoware_map_msgs::msg::MapProjectorInfo msg;
-  if (is_local) {
+  if (!gps_point) {
     msg.projector_type = autoware_map_msgs::msg::MapProjectorInfo::LOCAL;
   } else {
+    lanelet::projection::MGRSProjector projector{};
+    projector.forward(*gps_point);
     msg.projector_type = autoware_map_msgs::msg::MapProjectorInfo::MGRS;
     msg.mgrs_grid = projector.getProjectedMGRSGrid();
   }
@@ -126,11 +126,13 @@ MapProjectionLoader::MapProjectionLoader(const rclcpp::NodeOptions & options)
 
   const autoware_map_msgs::msg::MapProjectorInfo msg =
     load_map_projector_info(yaml_filename, lanelet2_map_filename);
+  startup_timeline_.mark_phase("load_map_projector_info");
 
   // Publish the message
   publisher_ = this->create_publisher<MapProjectorInfo::Message>(
     MapProjectorInfo::name, autoware::component_interface_specs::get_qos<MapProjectorInfo>());
   publisher_->publish(msg);
+  startup_timeline_.mark_ready();
 }
 }  // namespace autoware::map_projection_loader
 
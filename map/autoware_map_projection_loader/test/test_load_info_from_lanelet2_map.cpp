@@ -21,6 +21,7 @@
 
 #include <fstream>
 #include <iostream>
+#include <stdexcept>
 #include <string>
 
 void save_dummy_mgrs_lanelet2_map(const std::string & mgrs_coord, const std::string & output_path)
@@ -85,6 +86,28 @@ void save_dummy_mgrs_lanelet2_map_with_one_zero_point(const std::string & output
   file.close();
 }
 
+void save_dummy_mgrs_lanelet2_map_with_tags(const std::string & output_path)
+{
+  std::ofstream file(output_path);
+  if (!file) {
+    std::cerr << "Unable to open file.\n";
+    return;
+  }
+
+  // nodes with tags, single quotes and the longitude before the latitude
+  file << "<?xml version=\"1.0\"?>\n";
+  file << "<osm version=\"0.6\" generator=\"lanelet2\">\n";
+  file << "  <node id='1' lon='' lat=''>\n";
+  file << "    <tag k='local_x' v='1.0'/>\n";
+  file << "  </node>\n";
+  file << "  <node id='2' lon='0.00002' lat='0.00001'>\n";
+  file << "    <tag k='local_x' v='2.0'/>\n";
+  file << "  </node>\n";
+  file << "</osm>";
+
+  file.close();
+}
+
 TEST(TestLoadFromLanelet2Map, LoadMGRSGrid)
 {
   // Save dummy lanelet2 map
@@ -130,6 +153,27 @@ TEST(TestLoadFromLanelet2Map, LoadNoLocalGrid)
   EXPECT_EQ(projector_info.projector_type, "MGRS");
 }
 
+TEST(TestLoadFromLanelet2Map, LoadNodesWithTags)
+{
+  // Save dummy lanelet2 map
+  const std::string output_path = "/tmp/test_load_info_from_lanelet2_map.osm";
+  save_dummy_mgrs_lanelet2_map_with_tags(output_path);
+
+  // Test the function
+  const auto projector_info =
+    autoware::map_projection_loader::load_info_from_lanelet2_map(output_path);
+
+  // Check the result
+  EXPECT_EQ(projector_info.projector_type, "MGRS");
+}
+
+TEST(TestLoadFromLanelet2Map, ThrowOnMissingFile)
+{
+  EXPECT_THROW(
+    autoware::map_projection_loader::load_info_from_lanelet2_map("/tmp/not_existing_map.osm"),
+    std::runtime_error);
+}
+
 int main(int argc, char ** argv)
 {
   ::testing::InitGoogleMock(&argc, argv);
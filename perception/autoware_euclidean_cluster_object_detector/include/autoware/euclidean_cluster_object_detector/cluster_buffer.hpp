@@ -0,0 +1,59 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace autoware::euclidean_cluster
+{
+// clusters of one frame in flat storage
+//   the points of cluster i are points[offsets[i]...offsets[i + 1]]. The buffer is owned by the
+//   caller and reused across frames, so that it only allocates while the frames grow.
+struct ClusterBuffer
+{
+  pcl::PointCloud<pcl::PointXYZ>::VectorType points;
+  std::vector<size_t> offsets{0};
+
+  // keep the capacity
+  void clear()
+  {
+    points.clear();
+    offsets.assign(1, 0);
+  }
+
+  // close the cluster of the points added since the previous call
+  void endCluster() { offsets.push_back(points.size()); }
+
+  size_t size() const { return offsets.size() - 1; }
+  bool empty() const { return size() == 0; }
+  size_t clusterSize(size_t cluster_idx) const
+  {
+    return offsets[cluster_idx + 1] - offsets[cluster_idx];
+  }
+  const pcl::PointXYZ * clusterBegin(size_t cluster_idx) const
+  {
+    return points.data() + offsets[cluster_idx];
+  }
+  const pcl::PointXYZ * clusterEnd(size_t cluster_idx) const
+  {
+    return points.data() + offsets[cluster_idx + 1];
+  }
+};
+
+}  // namespace autoware::euclidean_cluster
@@ -0,0 +1,63 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <autoware/euclidean_cluster_object_detector/cluster_buffer.hpp>
+
+#include <autoware_perception_msgs/msg/detected_objects.hpp>
+#include <std_msgs/msg/header.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace autoware::euclidean_cluster
+{
+// shape features of all clusters of a frame, one array per feature
+struct ClusterFeatures
+{
+  // centroid, accumulated in double as getCentroid()
+  std::vector<double> centroid_x;
+  std::vector<double> centroid_y;
+  std::vector<double> centroid_z;
+
+  // axis aligned bounding box, min_z and max_z are the height extents
+  std::vector<float> min_x;
+  std::vector<float> max_x;
+  std::vector<float> min_y;
+  std::vector<float> max_y;
+  std::vector<float> min_z;
+  std::vector<float> max_z;
+
+  // oriented bounding box in the xy plane, along the principal axis of the points
+  std::vector<float> yaw;
+  std::vector<float> obb_center_x;
+  std::vector<float> obb_center_y;
+  std::vector<float> obb_length;
+  std::vector<float> obb_width;
+
+  size_t size() const { return centroid_x.size(); }
+  void resize(size_t cluster_num);
+};
+
+// compute the features of all clusters, the arrays keep their capacity across calls
+void computeClusterFeatures(const ClusterBuffer & clusters, ClusterFeatures & features);
+
+// objects at the cluster centroids, as convertPointCloudClusters2Msg(). With use_bounding_box,
+// the objects are the oriented bounding boxes of the clusters instead.
+void convertClusterFeatures2Msg(
+  const std_msgs::msg::Header & header, const ClusterFeatures & features, bool use_bounding_box,
+  autoware_perception_msgs::msg::DetectedObjects & msg);
+
+}  // namespace autoware::euclidean_cluster
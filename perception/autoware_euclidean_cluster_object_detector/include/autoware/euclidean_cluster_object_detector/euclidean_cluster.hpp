@@ -17,6 +17,7 @@
 #include <autoware/euclidean_cluster_object_detector/euclidean_cluster_interface.hpp>
 #include <autoware/euclidean_cluster_object_detector/utils.hpp>
 
+#include <pcl/PointIndices.h>
 #include <pcl/point_types.h>
 
 #include <vector>
@@ -42,10 +43,22 @@ public:
     autoware_perception_msgs::msg::DetectedObjects & objects,
     std::vector<pcl::PointCloud<pcl::PointXYZ>> & clusters) override;
 
+  bool cluster(
+    const pcl::PointCloud<pcl::PointXYZ>::ConstPtr & pointcloud, ClusterBuffer & clusters) override;
+
+  bool cluster(
+    const sensor_msgs::msg::PointCloud2::ConstSharedPtr & input_msg,
+    autoware_perception_msgs::msg::DetectedObjects & objects, ClusterBuffer & clusters) override;
+
   void setTolerance(float tolerance) { tolerance_ = tolerance; }
 
 private:
+  void extract(const pcl::PointCloud<pcl::PointXYZ>::ConstPtr & pointcloud);
+
   float tolerance_;
+  // reused across frames
+  pcl::PointCloud<pcl::PointXYZ>::Ptr pointcloud_2d_ptr_{new pcl::PointCloud<pcl::PointXYZ>};
+  std::vector<pcl::PointIndices> cluster_indices_;
 };
 
 }  // namespace autoware::euclidean_cluster
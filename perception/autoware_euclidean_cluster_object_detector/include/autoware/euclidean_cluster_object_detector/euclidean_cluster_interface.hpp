@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <autoware/euclidean_cluster_object_detector/cluster_buffer.hpp>
 #include <rclcpp/rclcpp.hpp>
 
 #include <autoware_perception_msgs/msg/detected_objects.hpp>
@@ -53,6 +54,14 @@ public:
     autoware_perception_msgs::msg::DetectedObjects & objects,
     std::vector<pcl::PointCloud<pcl::PointXYZ>> & clusters) = 0;
 
+  // same as the overloads above, with the clusters written into a caller owned buffer
+  virtual bool cluster(
+    const pcl::PointCloud<pcl::PointXYZ>::ConstPtr & pointcloud, ClusterBuffer & clusters) = 0;
+
+  virtual bool cluster(
+    const sensor_msgs::msg::PointCloud2::ConstSharedPtr & input_msg,
+    autoware_perception_msgs::msg::DetectedObjects & objects, ClusterBuffer & clusters) = 0;
+
 protected:
   bool use_height_ = true;
   int min_cluster_size_;
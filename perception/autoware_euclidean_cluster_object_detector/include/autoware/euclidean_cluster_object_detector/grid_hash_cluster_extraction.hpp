@@ -0,0 +1,101 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <pcl/PointIndices.h>
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace autoware::euclidean_cluster
+{
+enum class ClusteringMethod { KdTree, GridHash };
+
+// "kdtree" or "grid_hash", throws std::invalid_argument otherwise
+ClusteringMethod clusteringMethodFromString(const std::string & method);
+
+// Euclidean cluster extraction without a search tree
+//   the points are hashed into cubic cells of the cluster tolerance, so the neighbors of a point
+//   within the tolerance are in the 27 cells around it (9 cells when the height is not used).
+//   Two points closer than the tolerance are merged with a union-find, and the clusters are the
+//   connected components, as with pcl::EuclideanClusterExtraction.
+//   The clusters are sorted by decreasing size, then by their first point index, and the indices
+//   of each cluster are sorted. All buffers keep their capacity across calls.
+//   With several threads, the cells are split into spatial chunks merged in parallel with a lock
+//   free union-find. The root of a set is always its smallest point index, so the output does not
+//   depend on the thread scheduling.
+class GridHashClusterExtraction
+{
+public:
+  void setClusterTolerance(float tolerance) { tolerance_ = tolerance; }
+  void setMinClusterSize(int size) { min_cluster_size_ = size; }
+  void setMaxClusterSize(int size) { max_cluster_size_ = size; }
+  void setUseHeight(bool use_height) { use_height_ = use_height; }
+  void setNumThreads(int num_threads) { num_threads_ = num_threads; }
+
+  void extract(
+    const pcl::PointCloud<pcl::PointXYZ> & pointcloud,
+    std::vector<pcl::PointIndices> & cluster_indices);
+
+private:
+  struct CellKey
+  {
+    int32_t x;
+    int32_t y;
+    int32_t z;
+    bool operator==(const CellKey & other) const
+    {
+      return x == other.x && y == other.y && z == other.z;
+    }
+  };
+
+  void buildCells(const pcl::PointCloud<pcl::PointXYZ> & pointcloud);
+  int findCell(const CellKey & key) const;
+  void mergeCell(size_t cell_idx, const pcl::PointCloud<pcl::PointXYZ> & pointcloud);
+  uint32_t find(uint32_t point_idx);
+  void unite(uint32_t a, uint32_t b);
+
+  float tolerance_{0.7f};
+  int min_cluster_size_{1};
+  int max_cluster_size_{std::numeric_limits<int>::max()};
+  bool use_height_{true};
+  int num_threads_{1};
+
+  // cells, the points of cell i are cell_points_[cell_offsets_[i]...cell_offsets_[i + 1]]
+  std::vector<CellKey> cell_keys_;
+  std::vector<uint32_t> cell_offsets_;
+  std::vector<uint32_t> cell_points_;
+  std::vector<uint32_t> fill_position_;
+  std::vector<int32_t> cell_of_point_;
+  // open addressing table of cell indices, -1 for an empty slot
+  std::vector<int32_t> hash_table_;
+  size_t hash_mask_{0};
+
+  // cells sorted by position, split into the chunks of the threads
+  std::vector<uint32_t> cell_order_;
+
+  // union-find forest, shared by the threads
+  std::unique_ptr<std::atomic<uint32_t>[]> parent_;
+  size_t parent_capacity_{0};
+  std::vector<int32_t> cluster_of_root_;
+};
+
+}  // namespace autoware::euclidean_cluster
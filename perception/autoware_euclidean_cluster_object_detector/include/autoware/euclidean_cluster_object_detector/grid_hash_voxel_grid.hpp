@@ -0,0 +1,67 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace autoware::euclidean_cluster
+{
+// Voxel grid downsampling without sorting
+//   the points are hashed into the voxels with an open addressing table, and each voxel is
+//   replaced by the centroid of its points, as with pcl::VoxelGrid. The non-finite points are
+//   dropped. The centroids are in the order of the first point of their voxel instead of the
+//   order of the voxel indices. All buffers keep their capacity across calls.
+class GridHashVoxelGrid
+{
+public:
+  void setLeafSize(float x, float y, float z);
+
+  void filter(
+    const pcl::PointCloud<pcl::PointXYZ> & input, pcl::PointCloud<pcl::PointXYZ> & output);
+
+private:
+  struct VoxelKey
+  {
+    int32_t x;
+    int32_t y;
+    int32_t z;
+    bool operator==(const VoxelKey & other) const
+    {
+      return x == other.x && y == other.y && z == other.z;
+    }
+  };
+  struct VoxelSum
+  {
+    double x;
+    double y;
+    double z;
+    uint32_t count;
+  };
+
+  float inverse_leaf_x_{1.0f};
+  float inverse_leaf_y_{1.0f};
+  float inverse_leaf_z_{1.0f};
+
+  std::vector<VoxelKey> voxel_keys_;
+  std::vector<VoxelSum> voxel_sums_;
+  // open addressing table of voxel indices, -1 for an empty slot
+  std::vector<int32_t> hash_table_;
+};
+
+}  // namespace autoware::euclidean_cluster
@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <autoware/euclidean_cluster_object_detector/cluster_buffer.hpp>
+
 #include <autoware_perception_msgs/msg/detected_objects.hpp>
 #include <geometry_msgs/msg/pose_stamped.hpp>
 #include <sensor_msgs/msg/point_cloud2.hpp>
@@ -27,12 +29,19 @@
 namespace autoware::euclidean_cluster
 {
 geometry_msgs::msg::Point getCentroid(const sensor_msgs::msg::PointCloud2 & pointcloud);
+geometry_msgs::msg::Point getCentroid(const ClusterBuffer & clusters, size_t cluster_idx);
 void convertPointCloudClusters2Msg(
   const std_msgs::msg::Header & header,
   const std::vector<pcl::PointCloud<pcl::PointXYZ>> & clusters,
   autoware_perception_msgs::msg::DetectedObjects & msg);
+void convertPointCloudClusters2Msg(
+  const std_msgs::msg::Header & header, const ClusterBuffer & clusters,
+  autoware_perception_msgs::msg::DetectedObjects & msg);
 
 void convertClusters2SensorMsg(
   const std_msgs::msg::Header & header, const std::vector<pcl::PointCloud<pcl::PointXYZ>> & input,
   sensor_msgs::msg::PointCloud2 & output);
+void convertClusters2SensorMsg(
+  const std_msgs::msg::Header & header, const ClusterBuffer & input,
+  sensor_msgs::msg::PointCloud2 & output);
 }  // namespace autoware::euclidean_cluster
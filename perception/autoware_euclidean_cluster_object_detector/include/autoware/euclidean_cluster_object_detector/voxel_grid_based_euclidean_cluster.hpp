@@ -13,7 +13,9 @@
 // limitations under the License.
 
 #pragma once
+#include <autoware/euclidean_cluster_object_detector/cluster_features.hpp>
 #include <autoware/euclidean_cluster_object_detector/euclidean_cluster_interface.hpp>
+#include <autoware/euclidean_cluster_object_detector/grid_hash_cluster_extraction.hpp>
 #include <autoware/euclidean_cluster_object_detector/utils.hpp>
 #include <autoware_utils_diagnostics/diagnostics_interface.hpp>
 #include <rclcpp/node.hpp>
@@ -23,6 +25,7 @@
 #include <pcl/filters/voxel_grid.h>
 #include <pcl/point_types.h>
 
+#include <limits>
 #include <vector>
 
 namespace autoware::euclidean_cluster
@@ -45,12 +48,28 @@ public:
     const sensor_msgs::msg::PointCloud2::ConstSharedPtr & input_msg,
     autoware_perception_msgs::msg::DetectedObjects & objects,
     std::vector<pcl::PointCloud<pcl::PointXYZ>> & clusters) override;
+  bool cluster(
+    const pcl::PointCloud<pcl::PointXYZ>::ConstPtr & pointcloud, ClusterBuffer & clusters) override;
+  bool cluster(
+    const sensor_msgs::msg::PointCloud2::ConstSharedPtr & input_msg,
+    autoware_perception_msgs::msg::DetectedObjects & objects, ClusterBuffer & clusters) override;
   void setVoxelLeafSize(float voxel_leaf_size) { voxel_leaf_size_ = voxel_leaf_size; }
   void setTolerance(float tolerance) { tolerance_ = tolerance; }
   void setMinPointsNumberPerVoxel(int min_points_number_per_voxel)
   {
     min_points_number_per_voxel_ = min_points_number_per_voxel;
   }
+  void setClusteringMethod(ClusteringMethod clustering_method)
+  {
+    clustering_method_ = clustering_method;
+  }
+  // output the oriented bounding boxes of the clusters instead of their centroids
+  void setUseBoundingBoxShape(bool use_bounding_box_shape)
+  {
+    use_bounding_box_shape_ = use_bounding_box_shape;
+  }
+  // used by the grid_hash clustering method only
+  void setNumThreads(int num_threads) { grid_hash_extraction_.setNumThreads(num_threads); }
   void setDiagnosticsInterface(autoware_utils_diagnostics::DiagnosticsInterface * diag_ptr)
   {
     diagnostics_interface_ptr_ = diag_ptr;
@@ -61,6 +80,21 @@ private:
   float tolerance_;
   float voxel_leaf_size_;
   int min_points_number_per_voxel_;
+  ClusteringMethod clustering_method_{ClusteringMethod::KdTree};
+  GridHashClusterExtraction grid_hash_extraction_;
+  bool use_bounding_box_shape_{false};
+
+  // reused across frames
+  pcl::PointCloud<pcl::PointXYZ>::Ptr pointcloud_ptr_{new pcl::PointCloud<pcl::PointXYZ>};
+  pcl::PointCloud<pcl::PointXYZ>::Ptr voxel_map_ptr_{new pcl::PointCloud<pcl::PointXYZ>};
+  pcl::PointCloud<pcl::PointXYZ>::Ptr pointcloud_2d_ptr_{new pcl::PointCloud<pcl::PointXYZ>};
+  std::vector<pcl::PointIndices> cluster_indices_;
+  std::vector<int> voxel_cluster_;
+  std::vector<int> point_cluster_;
+  std::vector<size_t> cluster_fill_position_;
+  ClusterBuffer cluster_buffer_;
+  ClusterFeatures features_;
+  static constexpr size_t invalid_position = std::numeric_limits<size_t>::max();
 
   void publishDiagnosticsSummary(
     size_t skipped_cluster_count,
@@ -35,6 +35,10 @@ def launch_setup(context, *args, **kwargs):
     ns = ""
     pkg = "autoware_euclidean_cluster_object_detector"
 
+    # hand the clouds over without copy between the nodes of the same container
+    use_intra_process = IfCondition(LaunchConfiguration("use_intra_process")).evaluate(context)
+    extra_arguments = [{"use_intra_process_comms": use_intra_process}]
+
     low_height_cropbox_filter_component = ComposableNode(
         package="autoware_crop_box_filter",
         namespace=ns,
@@ -45,6 +49,7 @@ def launch_setup(context, *args, **kwargs):
             ("output", "low_height/pointcloud"),
         ],
         parameters=[load_composable_node_param("euclidean_param_path")],
+        extra_arguments=extra_arguments,
     )
 
     use_low_height_euclidean_component = ComposableNode(
@@ -56,6 +61,7 @@ def launch_setup(context, *args, **kwargs):
             ("output", LaunchConfiguration("output_clusters")),
         ],
         parameters=[load_composable_node_param("euclidean_param_path")],
+        extra_arguments=extra_arguments,
     )
 
     disuse_low_height_euclidean_component = ComposableNode(
@@ -67,6 +73,7 @@ def launch_setup(context, *args, **kwargs):
             ("output", LaunchConfiguration("output_clusters")),
         ],
         parameters=[load_composable_node_param("euclidean_param_path")],
+        extra_arguments=extra_arguments,
     )
 
     container = ComposableNodeContainer(
@@ -115,6 +122,7 @@ def generate_launch_description():
             add_launch_arg("use_low_height_cropbox", "false"),
             add_launch_arg("use_pointcloud_container", "false"),
             add_launch_arg("pointcloud_container_name", "pointcloud_container"),
+            add_launch_arg("use_intra_process", "false"),
             add_launch_arg(
                 "euclidean_param_path",
                 [
@@ -33,6 +33,8 @@ def launch_setup(context, *args, **kwargs):
 
     ns = ""
     pkg = "autoware_euclidean_cluster_object_detector"
+    use_intra_process = IfCondition(LaunchConfiguration("use_intra_process")).evaluate(context)
+    extra_arguments = [{"use_intra_process_comms": use_intra_process}]
 
     low_height_cropbox_filter_component = ComposableNode(
         package="autoware_crop_box_filter",
@@ -44,6 +46,7 @@ def launch_setup(context, *args, **kwargs):
             ("output", "low_height/pointcloud"),
         ],
         parameters=[load_composable_node_param("voxel_grid_based_euclidean_param_path")],
+        extra_arguments=extra_arguments,
     )
 
     use_low_height_euclidean_component = ComposableNode(
@@ -56,6 +59,7 @@ def launch_setup(context, *args, **kwargs):
             ("output", LaunchConfiguration("output_clusters")),
         ],
         parameters=[load_composable_node_param("voxel_grid_based_euclidean_param_path")],
+        extra_arguments=extra_arguments,
     )
 
     disuse_low_height_euclidean_component = ComposableNode(
@@ -68,6 +72,7 @@ def launch_setup(context, *args, **kwargs):
             ("output", LaunchConfiguration("output_clusters")),
         ],
         parameters=[load_composable_node_param("voxel_grid_based_euclidean_param_path")],
+        extra_arguments=extra_arguments,
     )
 
     container = ComposableNodeContainer(
@@ -119,6 +124,7 @@ def generate_launch_description():
             add_launch_arg("use_low_height_cropbox", "false"),
             add_launch_arg("use_pointcloud_container", "false"),
             add_launch_arg("pointcloud_container_name", "pointcloud_container"),
+            add_launch_arg("use_intra_process", "false"),
             add_launch_arg(
                 "voxel_grid_based_euclidean_param_path",
                 [
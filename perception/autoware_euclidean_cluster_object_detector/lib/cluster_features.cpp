@@ -0,0 +1,179 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <autoware/euclidean_cluster_object_detector/cluster_features.hpp>
+
+#include <autoware_perception_msgs/msg/object_classification.hpp>
+#include <autoware_perception_msgs/msg/shape.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace autoware::euclidean_cluster
+{
+void ClusterFeatures::resize(size_t cluster_num)
+{
+  centroid_x.resize(cluster_num);
+  centroid_y.resize(cluster_num);
+  centroid_z.resize(cluster_num);
+  min_x.resize(cluster_num);
+  max_x.resize(cluster_num);
+  min_y.resize(cluster_num);
+  max_y.resize(cluster_num);
+  min_z.resize(cluster_num);
+  max_z.resize(cluster_num);
+  yaw.resize(cluster_num);
+  obb_center_x.resize(cluster_num);
+  obb_center_y.resize(cluster_num);
+  obb_length.resize(cluster_num);
+  obb_width.resize(cluster_num);
+}
+
+void computeClusterFeatures(const ClusterBuffer & clusters, ClusterFeatures & features)
+{
+  const size_t cluster_num = clusters.size();
+  features.resize(cluster_num);
+
+  // centroid, axis aligned bounding box and principal axis
+  for (size_t i = 0; i < cluster_num; ++i) {
+    const auto * begin = clusters.clusterBegin(i);
+    const auto * end = clusters.clusterEnd(i);
+    const size_t size = clusters.clusterSize(i);
+    if (size == 0) {
+      features.centroid_x[i] = features.centroid_y[i] = features.centroid_z[i] = 0.0;
+      features.min_x[i] = features.max_x[i] = features.min_y[i] = features.max_y[i] = 0.0f;
+      features.min_z[i] = features.max_z[i] = features.yaw[i] = 0.0f;
+      continue;
+    }
+
+    double sum_x = 0.0;
+    double sum_y = 0.0;
+    double sum_z = 0.0;
+    float min_x = std::numeric_limits<float>::max();
+    float max_x = std::numeric_limits<float>::lowest();
+    float min_y = std::numeric_limits<float>::max();
+    float max_y = std::numeric_limits<float>::lowest();
+    float min_z = std::numeric_limits<float>::max();
+    float max_z = std::numeric_limits<float>::lowest();
+    // second moments around the first point, for the numerical stability
+    const float origin_x = begin->x;
+    const float origin_y = begin->y;
+    double sum_dx = 0.0;
+    double sum_dy = 0.0;
+    double sum_dxx = 0.0;
+    double sum_dxy = 0.0;
+    double sum_dyy = 0.0;
+    for (const auto * point = begin; point != end; ++point) {
+      sum_x += point->x;
+      sum_y += point->y;
+      sum_z += point->z;
+      min_x = std::min(min_x, point->x);
+      max_x = std::max(max_x, point->x);
+      min_y = std::min(min_y, point->y);
+      max_y = std::max(max_y, point->y);
+      min_z = std::min(min_z, point->z);
+      max_z = std::max(max_z, point->z);
+      const double dx = point->x - origin_x;
+      const double dy = point->y - origin_y;
+      sum_dx += dx;
+      sum_dy += dy;
+      sum_dxx += dx * dx;
+      sum_dxy += dx * dy;
+      sum_dyy += dy * dy;
+    }
+
+    features.centroid_x[i] = sum_x / static_cast<float>(size);
+    features.centroid_y[i] = sum_y / static_cast<float>(size);
+    features.centroid_z[i] = sum_z / static_cast<float>(size);
+    features.min_x[i] = min_x;
+    features.max_x[i] = max_x;
+    features.min_y[i] = min_y;
+    features.max_y[i] = max_y;
+    features.min_z[i] = min_z;
+    features.max_z[i] = max_z;
+
+    const double mean_dx = sum_dx / size;
+    const double mean_dy = sum_dy / size;
+    const double cov_xx = sum_dxx / size - mean_dx * mean_dx;
+    const double cov_xy = sum_dxy / size - mean_dx * mean_dy;
+    const double cov_yy = sum_dyy / size - mean_dy * mean_dy;
+    features.yaw[i] = static_cast<float>(0.5 * std::atan2(2.0 * cov_xy, cov_xx - cov_yy));
+  }
+
+  // oriented bounding box along the principal axis, around the centroid
+  for (size_t i = 0; i < cluster_num; ++i) {
+    const float cos_yaw = std::cos(features.yaw[i]);
+    const float sin_yaw = std::sin(features.yaw[i]);
+    const auto center_x = static_cast<float>(features.centroid_x[i]);
+    const auto center_y = static_cast<float>(features.centroid_y[i]);
+    float min_u = 0.0f;
+    float max_u = 0.0f;
+    float min_v = 0.0f;
+    float max_v = 0.0f;
+    for (const auto * point = clusters.clusterBegin(i); point != clusters.clusterEnd(i);
+         ++point) {
+      const float dx = point->x - center_x;
+      const float dy = point->y - center_y;
+      const float u = cos_yaw * dx + sin_yaw * dy;
+      const float v = -sin_yaw * dx + cos_yaw * dy;
+      min_u = std::min(min_u, u);
+      max_u = std::max(max_u, u);
+      min_v = std::min(min_v, v);
+      max_v = std::max(max_v, v);
+    }
+    const float center_u = 0.5f * (min_u + max_u);
+    const float center_v = 0.5f * (min_v + max_v);
+    features.obb_center_x[i] = center_x + cos_yaw * center_u - sin_yaw * center_v;
+    features.obb_center_y[i] = center_y + sin_yaw * center_u + cos_yaw * center_v;
+    features.obb_length[i] = max_u - min_u;
+    features.obb_width[i] = max_v - min_v;
+  }
+}
+
+void convertClusterFeatures2Msg(
+  const std_msgs::msg::Header & header, const ClusterFeatures & features, bool use_bounding_box,
+  autoware_perception_msgs::msg::DetectedObjects & msg)
+{
+  msg.header = header;
+  msg.objects.reserve(msg.objects.size() + features.size());
+  for (size_t i = 0; i < features.size(); ++i) {
+    autoware_perception_msgs::msg::DetectedObject object;
+    auto & pose = object.kinematics.pose_with_covariance.pose;
+    if (use_bounding_box) {
+      pose.position.x = features.obb_center_x[i];
+      pose.position.y = features.obb_center_y[i];
+      pose.position.z = 0.5 * (features.min_z[i] + features.max_z[i]);
+      pose.orientation.z = std::sin(0.5 * features.yaw[i]);
+      pose.orientation.w = std::cos(0.5 * features.yaw[i]);
+      object.kinematics.orientation_availability =
+        autoware_perception_msgs::msg::DetectedObjectKinematics::SIGN_UNKNOWN;
+      object.shape.type = autoware_perception_msgs::msg::Shape::BOUNDING_BOX;
+      object.shape.dimensions.x = features.obb_length[i];
+      object.shape.dimensions.y = features.obb_width[i];
+      object.shape.dimensions.z = features.max_z[i] - features.min_z[i];
+    } else {
+      pose.position.x = features.centroid_x[i];
+      pose.position.y = features.centroid_y[i];
+      pose.position.z = features.centroid_z[i];
+    }
+    autoware_perception_msgs::msg::ObjectClassification classification;
+    classification.label = autoware_perception_msgs::msg::ObjectClassification::UNKNOWN;
+    classification.probability = 1.0f;
+    object.classification.emplace_back(classification);
+    msg.objects.push_back(object);
+  }
+}
+
+}  // namespace autoware::euclidean_cluster
@@ -56,22 +56,20 @@ bool EuclideanCluster::cluster(
   return false;
 }
 
-bool EuclideanCluster::cluster(
-  const pcl::PointCloud<pcl::PointXYZ>::ConstPtr & pointcloud,
-  std::vector<pcl::PointCloud<pcl::PointXYZ>> & clusters)
+void EuclideanCluster::extract(const pcl::PointCloud<pcl::PointXYZ>::ConstPtr & pointcloud)
 {
   // convert 2d pointcloud
-  pcl::PointCloud<pcl::PointXYZ>::ConstPtr pointcloud_ptr(new pcl::PointCloud<pcl::PointXYZ>);
+  pcl::PointCloud<pcl::PointXYZ>::ConstPtr pointcloud_ptr;
   if (!use_height_) {
-    pcl::PointCloud<pcl::PointXYZ>::Ptr pointcloud_2d_ptr(new pcl::PointCloud<pcl::PointXYZ>);
+    pointcloud_2d_ptr_->clear();
     for (const auto & point : pointcloud->points) {
       pcl::PointXYZ point2d;
       point2d.x = point.x;
       point2d.y = point.y;
       point2d.z = 0.0;
-      pointcloud_2d_ptr->push_back(point2d);
+      pointcloud_2d_ptr_->push_back(point2d);
     }
-    pointcloud_ptr = pointcloud_2d_ptr;
+    pointcloud_ptr = pointcloud_2d_ptr_;
   } else {
     pointcloud_ptr = pointcloud;
   }
@@ -81,18 +79,25 @@ bool EuclideanCluster::cluster(
   tree->setInputCloud(pointcloud_ptr);
 
   // clustering
-  std::vector<pcl::PointIndices> cluster_indices;
+  cluster_indices_.clear();
   pcl::EuclideanClusterExtraction<pcl::PointXYZ> pcl_euclidean_cluster;
   pcl_euclidean_cluster.setClusterTolerance(tolerance_);
   pcl_euclidean_cluster.setMinClusterSize(min_cluster_size_);
   pcl_euclidean_cluster.setMaxClusterSize(max_cluster_size_);
   pcl_euclidean_cluster.setSearchMethod(tree);
   pcl_euclidean_cluster.setInputCloud(pointcloud_ptr);
-  pcl_euclidean_cluster.extract(cluster_indices);
+  pcl_euclidean_cluster.extract(cluster_indices_);
+}
+
+bool EuclideanCluster::cluster(
+  const pcl::PointCloud<pcl::PointXYZ>::ConstPtr & pointcloud,
+  std::vector<pcl::PointCloud<pcl::PointXYZ>> & clusters)
+{
+  extract(pointcloud);
 
   // build output
   {
-    for (const auto & cluster : cluster_indices) {
+    for (const auto & cluster : cluster_indices_) {
       pcl::PointCloud<pcl::PointXYZ>::Ptr cloud_cluster(new pcl::PointCloud<pcl::PointXYZ>);
       for (const auto & point_idx : cluster.indices) {
         cloud_cluster->points.push_back(pointcloud->points[point_idx]);
@@ -106,4 +111,30 @@ bool EuclideanCluster::cluster(
   return true;
 }
 
+bool EuclideanCluster::cluster(
+  const pcl::PointCloud<pcl::PointXYZ>::ConstPtr & pointcloud, ClusterBuffer & clusters)
+{
+  extract(pointcloud);
+
+  // build output
+  clusters.clear();
+  for (const auto & cluster : cluster_indices_) {
+    for (const auto & point_idx : cluster.indices) {
+      clusters.points.push_back(pointcloud->points[point_idx]);
+    }
+    clusters.endCluster();
+  }
+  return true;
+}
+
+bool EuclideanCluster::cluster(
+  const sensor_msgs::msg::PointCloud2::ConstSharedPtr & input_msg,
+  autoware_perception_msgs::msg::DetectedObjects & objects, ClusterBuffer & clusters)
+{
+  (void)input_msg;
+  (void)objects;
+  (void)clusters;
+  return false;
+}
+
 }  // namespace autoware::euclidean_cluster
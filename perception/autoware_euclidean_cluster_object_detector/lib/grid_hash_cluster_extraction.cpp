@@ -0,0 +1,262 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <autoware/euclidean_cluster_object_detector/grid_hash_cluster_extraction.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace autoware::euclidean_cluster
+{
+ClusteringMethod clusteringMethodFromString(const std::string & method)
+{
+  if (method == "kdtree") return ClusteringMethod::KdTree;
+  if (method == "grid_hash") return ClusteringMethod::GridHash;
+  throw std::invalid_argument(
+    "Unknown clustering_method " + method + ", expected kdtree or grid_hash");
+}
+
+namespace
+{
+size_t hashCell(int32_t x, int32_t y, int32_t z)
+{
+  const auto hash = static_cast<uint64_t>(static_cast<uint32_t>(x)) * 73856093ULL ^
+                    static_cast<uint64_t>(static_cast<uint32_t>(y)) * 19349669ULL ^
+                    static_cast<uint64_t>(static_cast<uint32_t>(z)) * 83492791ULL;
+  return static_cast<size_t>(hash ^ (hash >> 29));
+}
+}  // namespace
+
+int GridHashClusterExtraction::findCell(const CellKey & key) const
+{
+  for (size_t slot = hashCell(key.x, key.y, key.z) & hash_mask_;; slot = (slot + 1) & hash_mask_) {
+    const int32_t cell_idx = hash_table_[slot];
+    if (cell_idx < 0) return -1;
+    if (cell_keys_[cell_idx] == key) return cell_idx;
+  }
+}
+
+void GridHashClusterExtraction::buildCells(const pcl::PointCloud<pcl::PointXYZ> & pointcloud)
+{
+  const size_t point_num = pointcloud.size();
+
+  // at most one cell per point, the table is kept at most half full
+  size_t table_size = 16;
+  while (table_size < 2 * point_num) table_size *= 2;
+  hash_table_.assign(table_size, -1);
+  hash_mask_ = table_size - 1;
+
+  cell_keys_.clear();
+  cell_offsets_.assign(1, 0);
+  cell_of_point_.resize(point_num);
+
+  // coordinates beyond the range of the cell index are not clustered
+  constexpr float max_cell_coordinate = 1.0e9f;
+  const float inverse_tolerance = 1.0f / tolerance_;
+  for (size_t i = 0; i < point_num; ++i) {
+    const auto & point = pointcloud.points[i];
+    const float cx = std::floor(point.x * inverse_tolerance);
+    const float cy = std::floor(point.y * inverse_tolerance);
+    const float cz = use_height_ ? std::floor(point.z * inverse_tolerance) : 0.0f;
+    if (
+      !(std::abs(cx) < max_cell_coordinate) || !(std::abs(cy) < max_cell_coordinate) ||
+      !(std::abs(cz) < max_cell_coordinate)) {
+      cell_of_point_[i] = -1;
+      continue;
+    }
+    const CellKey key{static_cast<int32_t>(cx), static_cast<int32_t>(cy), static_cast<int32_t>(cz)};
+
+    size_t slot = hashCell(key.x, key.y, key.z) & hash_mask_;
+    while (hash_table_[slot] >= 0 && !(cell_keys_[hash_table_[slot]] == key)) {
+      slot = (slot + 1) & hash_mask_;
+    }
+    if (hash_table_[slot] < 0) {
+      hash_table_[slot] = static_cast<int32_t>(cell_keys_.size());
+      cell_keys_.push_back(key);
+      cell_offsets_.push_back(0);
+    }
+    const int32_t cell_idx = hash_table_[slot];
+    cell_of_point_[i] = cell_idx;
+    ++cell_offsets_[cell_idx + 1];
+  }
+
+  // counting sort of the points by cell, in increasing index order inside each cell
+  std::partial_sum(cell_offsets_.begin(), cell_offsets_.end(), cell_offsets_.begin());
+  cell_points_.resize(cell_offsets_.back());
+  fill_position_.assign(cell_offsets_.begin(), cell_offsets_.end() - 1);
+  for (size_t i = 0; i < point_num; ++i) {
+    if (cell_of_point_[i] >= 0) {
+      cell_points_[fill_position_[cell_of_point_[i]]++] = static_cast<uint32_t>(i);
+    }
+  }
+}
+
+// the parent of a point is never larger than the point itself, and is only replaced by one of its
+// ancestors, so the forest stays valid under concurrent finds and unites with relaxed ordering
+uint32_t GridHashClusterExtraction::find(uint32_t point_idx)
+{
+  // path halving
+  uint32_t parent = parent_[point_idx].load(std::memory_order_relaxed);
+  while (parent != point_idx) {
+    const uint32_t grandparent = parent_[parent].load(std::memory_order_relaxed);
+    if (grandparent != parent) {
+      parent_[point_idx].compare_exchange_weak(parent, grandparent, std::memory_order_relaxed);
+    }
+    point_idx = grandparent;
+    parent = parent_[point_idx].load(std::memory_order_relaxed);
+  }
+  return point_idx;
+}
+
+void GridHashClusterExtraction::unite(uint32_t a, uint32_t b)
+{
+  // the smaller index is the root, so that the roots do not depend on the merge order
+  while (true) {
+    uint32_t root_a = find(a);
+    uint32_t root_b = find(b);
+    if (root_a == root_b) return;
+    if (root_a < root_b) std::swap(root_a, root_b);
+    // link only if root_a is still a root, otherwise another thread merged it in the meantime
+    uint32_t expected = root_a;
+    if (parent_[root_a].compare_exchange_strong(expected, root_b, std::memory_order_relaxed)) {
+      return;
+    }
+    a = root_a;
+    b = root_b;
+  }
+}
+
+void GridHashClusterExtraction::mergeCell(
+  size_t cell_idx, const pcl::PointCloud<pcl::PointXYZ> & pointcloud)
+{
+  const float squared_tolerance = tolerance_ * tolerance_;
+  const auto & points = pointcloud.points;
+  const auto is_close = [&](const uint32_t a, const uint32_t b) {
+    const float dx = points[a].x - points[b].x;
+    const float dy = points[a].y - points[b].y;
+    const float dz = use_height_ ? points[a].z - points[b].z : 0.0f;
+    return dx * dx + dy * dy + dz * dz <= squared_tolerance;
+  };
+
+  const CellKey & key = cell_keys_[cell_idx];
+  const uint32_t begin = cell_offsets_[cell_idx];
+  const uint32_t end = cell_offsets_[cell_idx + 1];
+
+  for (uint32_t i = begin; i < end; ++i) {
+    for (uint32_t j = i + 1; j < end; ++j) {
+      const uint32_t a = cell_points_[i];
+      const uint32_t b = cell_points_[j];
+      if (find(a) != find(b) && is_close(a, b)) unite(a, b);
+    }
+  }
+
+  // each pair of neighboring cells is visited once: the cell itself, then the half of the
+  // neighborhood that is lexicographically after it
+  const int dz_range = use_height_ ? 1 : 0;
+  for (int dx = -1; dx <= 1; ++dx) {
+    for (int dy = -1; dy <= 1; ++dy) {
+      for (int dz = -dz_range; dz <= dz_range; ++dz) {
+        if (dx < 0 || (dx == 0 && (dy < 0 || (dy == 0 && dz <= 0)))) continue;
+        const int neighbor_idx = findCell(CellKey{key.x + dx, key.y + dy, key.z + dz});
+        if (neighbor_idx < 0) continue;
+        const uint32_t neighbor_begin = cell_offsets_[neighbor_idx];
+        const uint32_t neighbor_end = cell_offsets_[neighbor_idx + 1];
+        for (uint32_t i = begin; i < end; ++i) {
+          for (uint32_t j = neighbor_begin; j < neighbor_end; ++j) {
+            const uint32_t a = cell_points_[i];
+            const uint32_t b = cell_points_[j];
+            if (find(a) != find(b) && is_close(a, b)) unite(a, b);
+          }
+        }
+      }
+    }
+  }
+}
+
+void GridHashClusterExtraction::extract(
+  const pcl::PointCloud<pcl::PointXYZ> & pointcloud,
+  std::vector<pcl::PointIndices> & cluster_indices)
+{
+  cluster_indices.clear();
+  buildCells(pointcloud);
+
+  const size_t point_num = pointcloud.size();
+  if (parent_capacity_ < point_num) {
+    parent_capacity_ = std::max(point_num, 2 * parent_capacity_);
+    parent_ = std::make_unique<std::atomic<uint32_t>[]>(parent_capacity_);
+  }
+  for (size_t i = 0; i < point_num; ++i) {
+    parent_[i].store(static_cast<uint32_t>(i), std::memory_order_relaxed);
+  }
+
+  const size_t cell_num = cell_keys_.size();
+  if (num_threads_ <= 1) {
+    for (size_t cell_idx = 0; cell_idx < cell_num; ++cell_idx) {
+      mergeCell(cell_idx, pointcloud);
+    }
+  } else {
+    // spatial chunks of the cells sorted by position, so that the threads mostly merge disjoint
+    // sets and only compete on the chunk boundaries. A few chunks per thread balance the load.
+    cell_order_.resize(cell_num);
+    std::iota(cell_order_.begin(), cell_order_.end(), 0U);
+    std::sort(cell_order_.begin(), cell_order_.end(), [this](const uint32_t a, const uint32_t b) {
+      const CellKey & key_a = cell_keys_[a];
+      const CellKey & key_b = cell_keys_[b];
+      if (key_a.x != key_b.x) return key_a.x < key_b.x;
+      if (key_a.y != key_b.y) return key_a.y < key_b.y;
+      return key_a.z < key_b.z;
+    });
+    constexpr size_t chunks_per_thread = 4;
+    const size_t chunk_num = static_cast<size_t>(num_threads_) * chunks_per_thread;
+    const size_t chunk_size = (cell_num + chunk_num - 1) / chunk_num;
+#pragma omp parallel for schedule(dynamic) num_threads(num_threads_)
+    for (size_t chunk = 0; chunk < chunk_num; ++chunk) {
+      const size_t end = std::min(cell_num, (chunk + 1) * chunk_size);
+      for (size_t pos = chunk * chunk_size; pos < end; ++pos) {
+        mergeCell(cell_order_[pos], pointcloud);
+      }
+    }
+  }
+
+  // the clusters in the order of their first point, with increasing point indices
+  cluster_of_root_.assign(point_num, -1);
+  std::vector<pcl::PointIndices> clusters;
+  for (size_t i = 0; i < point_num; ++i) {
+    if (cell_of_point_[i] < 0) continue;
+    const uint32_t root = find(static_cast<uint32_t>(i));
+    if (cluster_of_root_[root] < 0) {
+      cluster_of_root_[root] = static_cast<int32_t>(clusters.size());
+      clusters.emplace_back();
+    }
+    clusters[cluster_of_root_[root]].indices.push_back(static_cast<int>(i));
+  }
+
+  for (auto & cluster : clusters) {
+    const auto cluster_size = static_cast<int>(cluster.indices.size());
+    if (cluster_size < min_cluster_size_ || cluster_size > max_cluster_size_) continue;
+    cluster_indices.push_back(std::move(cluster));
+  }
+  std::stable_sort(
+    cluster_indices.begin(), cluster_indices.end(),
+    [](const pcl::PointIndices & a, const pcl::PointIndices & b) {
+      return a.indices.size() > b.indices.size();
+    });
+}
+
+}  // namespace autoware::euclidean_cluster
@@ -0,0 +1,115 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <autoware/euclidean_cluster_object_detector/grid_hash_euclidean_cluster.hpp>
+
+#include <utility>
+#include <vector>
+
+namespace autoware::euclidean_cluster
+{
+GridHashEuclideanCluster::GridHashEuclideanCluster()
+{
+}
+
+GridHashEuclideanCluster::GridHashEuclideanCluster(
+  bool use_height, int min_cluster_size, int max_cluster_size)
+: EuclideanClusterInterface(use_height, min_cluster_size, max_cluster_size)
+{
+}
+
+GridHashEuclideanCluster::GridHashEuclideanCluster(
+  bool use_height, int min_cluster_size, int max_cluster_size, float tolerance)
+: EuclideanClusterInterface(use_height, min_cluster_size, max_cluster_size), tolerance_(tolerance)
+{
+}
+
+bool GridHashEuclideanCluster::cluster(
+  const sensor_msgs::msg::PointCloud2::ConstSharedPtr & pointcloud_msg,
+  autoware_perception_msgs::msg::DetectedObjects & clusters)
+{
+  (void)pointcloud_msg;
+  (void)clusters;
+  return false;
+}
+
+bool GridHashEuclideanCluster::cluster(
+  const sensor_msgs::msg::PointCloud2::ConstSharedPtr & input_msg,
+  autoware_perception_msgs::msg::DetectedObjects & objects,
+  std::vector<pcl::PointCloud<pcl::PointXYZ>> & clusters)
+{
+  (void)input_msg;
+  (void)objects;
+  (void)clusters;
+  return false;
+}
+
+void GridHashEuclideanCluster::extract(const pcl::PointCloud<pcl::PointXYZ> & pointcloud)
+{
+  // the height is ignored by the extraction itself, no 2d copy of the pointcloud is needed
+  extraction_.setClusterTolerance(tolerance_);
+  extraction_.setMinClusterSize(min_cluster_size_);
+  extraction_.setMaxClusterSize(max_cluster_size_);
+  extraction_.setUseHeight(use_height_);
+  extraction_.extract(pointcloud, cluster_indices_);
+}
+
+bool GridHashEuclideanCluster::cluster(
+  const pcl::PointCloud<pcl::PointXYZ>::ConstPtr & pointcloud,
+  std::vector<pcl::PointCloud<pcl::PointXYZ>> & clusters)
+{
+  extract(*pointcloud);
+
+  // build output
+  for (const auto & cluster : cluster_indices_) {
+    pcl::PointCloud<pcl::PointXYZ> cloud_cluster;
+    cloud_cluster.points.reserve(cluster.indices.size());
+    for (const auto & point_idx : cluster.indices) {
+      cloud_cluster.points.push_back(pointcloud->points[point_idx]);
+    }
+    cloud_cluster.width = cloud_cluster.points.size();
+    cloud_cluster.height = 1;
+    cloud_cluster.is_dense = false;
+    clusters.push_back(std::move(cloud_cluster));
+  }
+  return true;
+}
+
+bool GridHashEuclideanCluster::cluster(
+  const pcl::PointCloud<pcl::PointXYZ>::ConstPtr & pointcloud, ClusterBuffer & clusters)
+{
+  extract(*pointcloud);
+
+  // build output
+  clusters.clear();
+  for (const auto & cluster : cluster_indices_) {
+    for (const auto & point_idx : cluster.indices) {
+      clusters.points.push_back(pointcloud->points[point_idx]);
+    }
+    clusters.endCluster();
+  }
+  return true;
+}
+
+bool GridHashEuclideanCluster::cluster(
+  const sensor_msgs::msg::PointCloud2::ConstSharedPtr & input_msg,
+  autoware_perception_msgs::msg::DetectedObjects & objects, ClusterBuffer & clusters)
+{
+  (void)input_msg;
+  (void)objects;
+  (void)clusters;
+  return false;
+}
+
+}  // namespace autoware::euclidean_cluster
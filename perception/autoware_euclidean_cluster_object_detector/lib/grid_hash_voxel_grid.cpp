@@ -0,0 +1,98 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <autoware/euclidean_cluster_object_detector/grid_hash_voxel_grid.hpp>
+
+#include <cmath>
+#include <vector>
+
+namespace autoware::euclidean_cluster
+{
+namespace
+{
+size_t hashVoxel(int32_t x, int32_t y, int32_t z)
+{
+  const auto hash = static_cast<uint64_t>(static_cast<uint32_t>(x)) * 73856093ULL ^
+                    static_cast<uint64_t>(static_cast<uint32_t>(y)) * 19349669ULL ^
+                    static_cast<uint64_t>(static_cast<uint32_t>(z)) * 83492791ULL;
+  return static_cast<size_t>(hash ^ (hash >> 29));
+}
+}  // namespace
+
+void GridHashVoxelGrid::setLeafSize(float x, float y, float z)
+{
+  inverse_leaf_x_ = 1.0f / x;
+  inverse_leaf_y_ = 1.0f / y;
+  inverse_leaf_z_ = 1.0f / z;
+}
+
+void GridHashVoxelGrid::filter(
+  const pcl::PointCloud<pcl::PointXYZ> & input, pcl::PointCloud<pcl::PointXYZ> & output)
+{
+  const size_t point_num = input.size();
+
+  // at most one voxel per point, the table is kept at most half full
+  size_t table_size = 16;
+  while (table_size < 2 * point_num) table_size *= 2;
+  hash_table_.assign(table_size, -1);
+  const size_t hash_mask = table_size - 1;
+
+  voxel_keys_.clear();
+  voxel_sums_.clear();
+
+  // coordinates beyond the range of the voxel index are dropped
+  constexpr float max_voxel_coordinate = 1.0e9f;
+  for (const auto & point : input.points) {
+    const float vx = std::floor(point.x * inverse_leaf_x_);
+    const float vy = std::floor(point.y * inverse_leaf_y_);
+    const float vz = std::floor(point.z * inverse_leaf_z_);
+    if (
+      !(std::abs(vx) < max_voxel_coordinate) || !(std::abs(vy) < max_voxel_coordinate) ||
+      !(std::abs(vz) < max_voxel_coordinate)) {
+      continue;
+    }
+    const VoxelKey key{
+      static_cast<int32_t>(vx), static_cast<int32_t>(vy), static_cast<int32_t>(vz)};
+
+    size_t slot = hashVoxel(key.x, key.y, key.z) & hash_mask;
+    while (hash_table_[slot] >= 0 && !(voxel_keys_[hash_table_[slot]] == key)) {
+      slot = (slot + 1) & hash_mask;
+    }
+    if (hash_table_[slot] < 0) {
+      hash_table_[slot] = static_cast<int32_t>(voxel_keys_.size());
+      voxel_keys_.push_back(key);
+      voxel_sums_.push_back(VoxelSum{0.0, 0.0, 0.0, 0});
+    }
+    auto & sum = voxel_sums_[hash_table_[slot]];
+    sum.x += point.x;
+    sum.y += point.y;
+    sum.z += point.z;
+    ++sum.count;
+  }
+
+  output.header = input.header;
+  output.points.resize(voxel_sums_.size());
+  for (size_t i = 0; i < voxel_sums_.size(); ++i) {
+    const auto & sum = voxel_sums_[i];
+    const double inverse_count = 1.0 / static_cast<double>(sum.count);
+    output.points[i] = pcl::PointXYZ(
+      static_cast<float>(sum.x * inverse_count), static_cast<float>(sum.y * inverse_count),
+      static_cast<float>(sum.z * inverse_count));
+  }
+  output.width = static_cast<uint32_t>(output.points.size());
+  output.height = 1;
+  output.is_dense = true;
+}
+
+}  // namespace autoware::euclidean_cluster
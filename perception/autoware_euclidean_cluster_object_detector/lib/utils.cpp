@@ -43,6 +43,25 @@ geometry_msgs::msg::Point getCentroid(const sensor_msgs::msg::PointCloud2 & poin
   return centroid;
 }
 
+geometry_msgs::msg::Point getCentroid(const ClusterBuffer & clusters, size_t cluster_idx)
+{
+  geometry_msgs::msg::Point centroid;
+  centroid.x = 0.0f;
+  centroid.y = 0.0f;
+  centroid.z = 0.0f;
+  for (auto point = clusters.clusterBegin(cluster_idx); point != clusters.clusterEnd(cluster_idx);
+       ++point) {
+    centroid.x += point->x;
+    centroid.y += point->y;
+    centroid.z += point->z;
+  }
+  const size_t size = clusters.clusterSize(cluster_idx);
+  centroid.x = centroid.x / static_cast<float>(size);
+  centroid.y = centroid.y / static_cast<float>(size);
+  centroid.z = centroid.z / static_cast<float>(size);
+  return centroid;
+}
+
 void convertPointCloudClusters2Msg(
   const std_msgs::msg::Header & header,
   const std::vector<pcl::PointCloud<pcl::PointXYZ>> & clusters,
@@ -63,6 +82,23 @@ void convertPointCloudClusters2Msg(
   }
 }
 
+void convertPointCloudClusters2Msg(
+  const std_msgs::msg::Header & header, const ClusterBuffer & clusters,
+  autoware_perception_msgs::msg::DetectedObjects & msg)
+{
+  msg.header = header;
+  msg.objects.reserve(msg.objects.size() + clusters.size());
+  for (size_t i = 0; i < clusters.size(); ++i) {
+    autoware_perception_msgs::msg::DetectedObject object;
+    object.kinematics.pose_with_covariance.pose.position = getCentroid(clusters, i);
+    autoware_perception_msgs::msg::ObjectClassification classification;
+    classification.label = autoware_perception_msgs::msg::ObjectClassification::UNKNOWN;
+    classification.probability = 1.0f;
+    object.classification.emplace_back(classification);
+    msg.objects.push_back(object);
+  }
+}
+
 void convertClusters2SensorMsg(
   const std_msgs::msg::Header & header, const std::vector<pcl::PointCloud<pcl::PointXYZ>> & input,
   sensor_msgs::msg::PointCloud2 & output)
@@ -108,4 +144,44 @@ void convertClusters2SensorMsg(
   output.height = 1;
   output.is_dense = false;
 }
+
+void convertClusters2SensorMsg(
+  const std_msgs::msg::Header & header, const ClusterBuffer & input,
+  sensor_msgs::msg::PointCloud2 & output)
+{
+  output.header = header;
+
+  const size_t pointcloud_size = input.points.size();
+
+  sensor_msgs::PointCloud2Modifier modifier(output);
+  modifier.setPointCloud2Fields(
+    4, "x", 1, sensor_msgs::msg::PointField::FLOAT32, "y", 1, sensor_msgs::msg::PointField::FLOAT32,
+    "z", 1, sensor_msgs::msg::PointField::FLOAT32, "rgb", 1, sensor_msgs::msg::PointField::FLOAT32);
+  modifier.resize(pointcloud_size);
+
+  sensor_msgs::PointCloud2Iterator<float> iter_out_x(output, "x");
+  sensor_msgs::PointCloud2Iterator<float> iter_out_y(output, "y");
+  sensor_msgs::PointCloud2Iterator<float> iter_out_z(output, "z");
+  sensor_msgs::PointCloud2Iterator<uint8_t> iter_out_r(output, "r");
+  sensor_msgs::PointCloud2Iterator<uint8_t> iter_out_g(output, "g");
+  sensor_msgs::PointCloud2Iterator<uint8_t> iter_out_b(output, "b");
+
+  constexpr uint8_t color_data[] = {200, 0,   0, 0,   200, 0,   0, 0,   200,
+                                    200, 200, 0, 200, 0,   200, 0, 200, 200};  // 6 pattern
+  for (size_t i = 0; i < input.size(); ++i) {
+    for (auto point = input.clusterBegin(i); point != input.clusterEnd(i); ++point, ++iter_out_x,
+              ++iter_out_y, ++iter_out_z, ++iter_out_r, ++iter_out_g, ++iter_out_b) {
+      *iter_out_x = point->x;
+      *iter_out_y = point->y;
+      *iter_out_z = point->z;
+      *iter_out_r = color_data[3 * (i % 6) + 0];
+      *iter_out_g = color_data[3 * (i % 6) + 1];
+      *iter_out_b = color_data[3 * (i % 6) + 2];
+    }
+  }
+
+  output.width = pointcloud_size;
+  output.height = 1;
+  output.is_dense = false;
+}
 }  // namespace autoware::euclidean_cluster
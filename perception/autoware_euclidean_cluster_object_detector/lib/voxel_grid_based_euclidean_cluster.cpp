@@ -19,7 +19,7 @@
 #include <pcl/segmentation/extract_clusters.h>
 
 #include <string>
-#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace autoware::euclidean_cluster
@@ -89,71 +89,95 @@ bool VoxelGridBasedEuclideanCluster::cluster(
   return false;
 }
 
+bool VoxelGridBasedEuclideanCluster::cluster(
+  const pcl::PointCloud<pcl::PointXYZ>::ConstPtr & pointcloud, ClusterBuffer & clusters)
+{
+  (void)pointcloud;
+  (void)clusters;
+  return false;
+}
+
 bool VoxelGridBasedEuclideanCluster::cluster(
   const sensor_msgs::msg::PointCloud2::ConstSharedPtr & pointcloud_msg,
   autoware_perception_msgs::msg::DetectedObjects & objects,
   std::vector<pcl::PointCloud<pcl::PointXYZ>> & clusters)
+{
+  if (!cluster(pointcloud_msg, objects, cluster_buffer_)) {
+    return false;
+  }
+  for (size_t i = 0; i < cluster_buffer_.size(); ++i) {
+    pcl::PointCloud<pcl::PointXYZ> cluster_point_cloud;
+    cluster_point_cloud.points.assign(
+      cluster_buffer_.clusterBegin(i), cluster_buffer_.clusterEnd(i));
+    cluster_point_cloud.width = cluster_point_cloud.points.size();
+    cluster_point_cloud.height = 1;
+    clusters.push_back(std::move(cluster_point_cloud));
+  }
+  return true;
+}
+
+bool VoxelGridBasedEuclideanCluster::cluster(
+  const sensor_msgs::msg::PointCloud2::ConstSharedPtr & pointcloud_msg,
+  autoware_perception_msgs::msg::DetectedObjects & objects, ClusterBuffer & clusters)
 {
   // TODO(Saito) implement use_height is false version
 
   // create voxel
-  pcl::PointCloud<pcl::PointXYZ>::Ptr pointcloud(new pcl::PointCloud<pcl::PointXYZ>);
-  int point_step = pointcloud_msg->point_step;
-  pcl::fromROSMsg(*pointcloud_msg, *pointcloud);
-  pcl::PointCloud<pcl::PointXYZ>::Ptr voxel_map_ptr(new pcl::PointCloud<pcl::PointXYZ>);
+  pcl::fromROSMsg(*pointcloud_msg, *pointcloud_ptr_);
   voxel_grid_.setLeafSize(voxel_leaf_size_, voxel_leaf_size_, 100000.0);
   voxel_grid_.setMinimumPointsNumberPerVoxel(min_points_number_per_voxel_);
-  voxel_grid_.setInputCloud(pointcloud);
+  voxel_grid_.setInputCloud(pointcloud_ptr_);
   voxel_grid_.setSaveLeafLayout(true);
-  voxel_grid_.filter(*voxel_map_ptr);
+  voxel_grid_.filter(*voxel_map_ptr_);
 
   // voxel is pressed 2d
-  pcl::PointCloud<pcl::PointXYZ>::Ptr pointcloud_2d_ptr(new pcl::PointCloud<pcl::PointXYZ>);
-  for (const auto & point : voxel_map_ptr->points) {
+  pointcloud_2d_ptr_->clear();
+  for (const auto & point : voxel_map_ptr_->points) {
     pcl::PointXYZ point2d;
     point2d.x = point.x;
     point2d.y = point.y;
     point2d.z = 0.0;
-    pointcloud_2d_ptr->push_back(point2d);
+    pointcloud_2d_ptr_->push_back(point2d);
   }
 
-  // create tree
-  pcl::search::KdTree<pcl::PointXYZ>::Ptr tree(new pcl::search::KdTree<pcl::PointXYZ>);
-  tree->setInputCloud(pointcloud_2d_ptr);
-
   // clustering
-  std::vector<pcl::PointIndices> cluster_indices;
-  pcl::EuclideanClusterExtraction<pcl::PointXYZ> pcl_euclidean_cluster;
-  pcl_euclidean_cluster.setClusterTolerance(tolerance_);
-  pcl_euclidean_cluster.setMinClusterSize(1);
-  pcl_euclidean_cluster.setMaxClusterSize(max_cluster_size_);
-  pcl_euclidean_cluster.setSearchMethod(tree);
-  pcl_euclidean_cluster.setInputCloud(pointcloud_2d_ptr);
-  pcl_euclidean_cluster.extract(cluster_indices);
-
-  // create map to search cluster index from voxel grid index
-  std::unordered_map</* voxel grid index */ int, /* cluster index */ int> map;
-  std::vector<sensor_msgs::msg::PointCloud2> temporary_clusters;  // no check about cluster size
-  std::vector<size_t> clusters_data_size;
-  temporary_clusters.resize(cluster_indices.size());
-  size_t clusters_size = cluster_indices.size();
+  cluster_indices_.clear();
+  if (clustering_method_ == ClusteringMethod::GridHash) {
+    grid_hash_extraction_.setClusterTolerance(tolerance_);
+    grid_hash_extraction_.setMinClusterSize(1);
+    grid_hash_extraction_.setMaxClusterSize(max_cluster_size_);
+    grid_hash_extraction_.setUseHeight(false);
+    grid_hash_extraction_.extract(*pointcloud_2d_ptr_, cluster_indices_);
+  } else {
+    // create tree
+    pcl::search::KdTree<pcl::PointXYZ>::Ptr tree(new pcl::search::KdTree<pcl::PointXYZ>);
+    tree->setInputCloud(pointcloud_2d_ptr_);
+
+    pcl::EuclideanClusterExtraction<pcl::PointXYZ> pcl_euclidean_cluster;
+    pcl_euclidean_cluster.setClusterTolerance(tolerance_);
+    pcl_euclidean_cluster.setMinClusterSize(1);
+    pcl_euclidean_cluster.setMaxClusterSize(max_cluster_size_);
+    pcl_euclidean_cluster.setSearchMethod(tree);
+    pcl_euclidean_cluster.setInputCloud(pointcloud_2d_ptr_);
+    pcl_euclidean_cluster.extract(cluster_indices_);
+  }
+
+  // cluster index of each voxel, -1 for the voxels without cluster
+  const size_t clusters_size = cluster_indices_.size();
+  const int voxel_num = static_cast<int>(voxel_map_ptr_->points.size());
+  voxel_cluster_.assign(voxel_num, -1);
   for (size_t cluster_idx = 0; cluster_idx < clusters_size; ++cluster_idx) {
-    const auto & cluster = cluster_indices.at(cluster_idx);
-    auto & temporary_cluster = temporary_clusters.at(cluster_idx);
-    for (const auto & point_idx : cluster.indices) {
-      map[point_idx] = cluster_idx;
+    for (const auto & point_idx : cluster_indices_[cluster_idx].indices) {
+      voxel_cluster_[point_idx] = static_cast<int>(cluster_idx);
     }
-    temporary_cluster.height = pointcloud_msg->height;
-    temporary_cluster.fields = pointcloud_msg->fields;
-    temporary_cluster.point_step = point_step;
-    temporary_cluster.data.resize(cluster.indices.size() * point_step);
-    clusters_data_size.push_back(0);
   }
 
-  // create vector of point cloud cluster. vector index is voxel grid index.
-  size_t pointcloud_size = pointcloud->points.size();
+  // cluster index of each point, and the number of points of each cluster
+  const size_t pointcloud_size = pointcloud_ptr_->points.size();
+  point_cluster_.resize(pointcloud_size);
+  cluster_fill_position_.assign(clusters_size, 0);
   for (size_t i = 0; i < pointcloud_size; ++i) {
-    const auto & point = pointcloud->points.at(i);
+    const auto & point = pointcloud_ptr_->points[i];
     // Temporarily disable array-bounds warning for this specific PCL function call
     // This is a known issue with PCL 1.14 and GCC 13 due to Eigen alignment
 #pragma GCC diagnostic push
@@ -162,80 +186,48 @@ bool VoxelGridBasedEuclideanCluster::cluster(
     const int index =
       voxel_grid_.getCentroidIndexAt(voxel_grid_.getGridCoordinates(point.x, point.y, point.z));
 #pragma GCC diagnostic pop
-    if (map.find(index) != map.end()) {
-      auto & cluster_data_size = clusters_data_size.at(map[index]);
-      if (
-        cluster_data_size >
-        static_cast<std::size_t>(max_cluster_size_) * static_cast<std::size_t>(point_step)) {
-        continue;
-      }
-      std::memcpy(
-        &temporary_clusters.at(map[index]).data[cluster_data_size],
-        &pointcloud_msg->data[i * point_step], point_step);
-      cluster_data_size += point_step;
-      if (cluster_data_size == temporary_clusters.at(map[index]).data.size()) {
-        temporary_clusters.at(map[index])
-          .data.resize(temporary_clusters.at(map[index]).data.size() * 2);
-      }
+    const int cluster_idx = (0 <= index && index < voxel_num) ? voxel_cluster_[index] : -1;
+    point_cluster_[i] = cluster_idx;
+    if (cluster_idx >= 0) {
+      ++cluster_fill_position_[cluster_idx];
     }
   }
 
-  // build output and check cluster size
-  {
-    size_t skipped_cluster_count = 0;  // Count the skipped clusters
-    size_t temporary_clusters_size = temporary_clusters.size();
-    for (size_t i = 0; i < temporary_clusters_size; ++i) {
-      auto & i_cluster_data_size = clusters_data_size.at(i);
-      int cluster_size = static_cast<int>(i_cluster_data_size / point_step);
-      if (cluster_size < min_cluster_size_) {
-        // Cluster size is below the minimum threshold; skip without messaging.
-        continue;
-      }
-      if (cluster_size > max_cluster_size_) {
-        // Cluster size exceeds the maximum threshold; log a warning.
-        skipped_cluster_count++;
-        continue;
-      }
-      const auto & cluster = temporary_clusters.at(i);
-
-      // Create a temporary cluster with correct size for getting the centroid
-      sensor_msgs::msg::PointCloud2 temp_cluster = cluster;
-      temp_cluster.data.resize(i_cluster_data_size);
-      // temp_cluster.header = pointcloud_msg->header;
-      // temp_cluster.is_bigendian = pointcloud_msg->is_bigendian;
-      // temp_cluster.is_dense = pointcloud_msg->is_dense;
-      // temp_cluster.point_step = point_step;
-      // temp_cluster.row_step = i_cluster_data_size / pointcloud_msg->height;
-      // temp_cluster.width = i_cluster_data_size / point_step / pointcloud_msg->height;
-
-      autoware_perception_msgs::msg::DetectedObject object;
-      object.kinematics.pose_with_covariance.pose.position = getCentroid(temp_cluster);
-
-      autoware_perception_msgs::msg::ObjectClassification classification;
-      classification.label = autoware_perception_msgs::msg::ObjectClassification::UNKNOWN;
-      classification.probability = 1.0f;
-      object.classification.emplace_back(classification);
-
-      objects.objects.push_back(object);
-
-      pcl::PointCloud<pcl::PointXYZ> cluster_point_cloud;
-
-      for (sensor_msgs::PointCloud2ConstIterator<float> iter_x(cluster, "x"), iter_y(cluster, "y"),
-           iter_z(cluster, "z");
-           iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_z) {
-        pcl::PointXYZ point;
-        point.x = *iter_x;
-        point.y = *iter_y;
-        point.z = *iter_z;
-        cluster_point_cloud.push_back(point);
-      }
-      clusters.push_back(cluster_point_cloud);
+  // check cluster size, and place the points of the valid clusters in the flat output
+  clusters.clear();
+  size_t skipped_cluster_count = 0;  // Count the skipped clusters
+  size_t valid_point_num = 0;
+  for (size_t i = 0; i < clusters_size; ++i) {
+    const size_t cluster_size = cluster_fill_position_[i];
+    cluster_fill_position_[i] = invalid_position;
+    if (cluster_size < static_cast<size_t>(min_cluster_size_)) {
+      // Cluster size is below the minimum threshold; skip without messaging.
+      continue;
+    }
+    if (cluster_size > static_cast<size_t>(max_cluster_size_)) {
+      // Cluster size exceeds the maximum threshold; log a warning.
+      skipped_cluster_count++;
+      continue;
+    }
+    cluster_fill_position_[i] = valid_point_num;
+    valid_point_num += cluster_size;
+    clusters.offsets.push_back(valid_point_num);
+  }
+  clusters.points.resize(valid_point_num);
+  for (size_t i = 0; i < pointcloud_size; ++i) {
+    const int cluster_idx = point_cluster_[i];
+    if (cluster_idx < 0 || cluster_fill_position_[cluster_idx] == invalid_position) {
+      continue;
     }
-    objects.header = pointcloud_msg->header;
-    // Publish the diagnostics summary.
-    publishDiagnosticsSummary(skipped_cluster_count, pointcloud_msg);
+    clusters.points[cluster_fill_position_[cluster_idx]++] = pointcloud_ptr_->points[i];
   }
 
+  // build output
+  computeClusterFeatures(clusters, features_);
+  convertClusterFeatures2Msg(pointcloud_msg->header, features_, use_bounding_box_shape_, objects);
+  // Publish the diagnostics summary.
+  publishDiagnosticsSummary(skipped_cluster_count, pointcloud_msg);
+
   return true;
 }
 
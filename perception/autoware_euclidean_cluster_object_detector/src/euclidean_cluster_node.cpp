@@ -17,6 +17,7 @@
 #include <autoware/euclidean_cluster_object_detector/utils.hpp>
 
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace autoware::euclidean_cluster
@@ -28,8 +29,19 @@ EuclideanClusterNode::EuclideanClusterNode(const rclcpp::NodeOptions & options)
   const int min_cluster_size = this->declare_parameter("min_cluster_size", 3);
   const int max_cluster_size = this->declare_parameter("max_cluster_size", 200);
   const float tolerance = this->declare_parameter("tolerance", 1.0);
-  cluster_ =
-    std::make_shared<EuclideanCluster>(use_height, min_cluster_size, max_cluster_size, tolerance);
+  const auto clustering_method = clusteringMethodFromString(
+    this->declare_parameter<std::string>("clustering_method", "kdtree"));
+  const int num_threads = this->declare_parameter("num_threads", 1);
+  use_bounding_box_shape_ = this->declare_parameter("use_bounding_box_shape", false);
+  if (clustering_method == ClusteringMethod::GridHash) {
+    auto grid_hash_cluster = std::make_shared<GridHashEuclideanCluster>(
+      use_height, min_cluster_size, max_cluster_size, tolerance);
+    grid_hash_cluster->setNumThreads(num_threads);
+    cluster_ = grid_hash_cluster;
+  } else {
+    cluster_ =
+      std::make_shared<EuclideanCluster>(use_height, min_cluster_size, max_cluster_size, tolerance);
+  }
 
   using std::placeholders::_1;
   pointcloud_sub_ = this->create_subscription<sensor_msgs::msg::PointCloud2>(
@@ -52,30 +64,30 @@ void EuclideanClusterNode::onPointCloud(
   stop_watch_ptr_->toc("processing_time", true);
 
   // convert ros to pcl
-  pcl::PointCloud<pcl::PointXYZ>::Ptr raw_pointcloud_ptr(new pcl::PointCloud<pcl::PointXYZ>);
-  pcl::fromROSMsg(*input_msg, *raw_pointcloud_ptr);
+  pcl::fromROSMsg(*input_msg, *raw_pointcloud_ptr_);
 
   // clustering
-  std::vector<pcl::PointCloud<pcl::PointXYZ>> clusters;
-  cluster_->cluster(raw_pointcloud_ptr, clusters);
+  cluster_->cluster(raw_pointcloud_ptr_, clusters_);
 
   // build output msg
-  autoware_perception_msgs::msg::DetectedObjects output;
-  convertPointCloudClusters2Msg(input_msg->header, clusters, output);
-  cluster_pub_->publish(output);
+  auto output = std::make_unique<autoware_perception_msgs::msg::DetectedObjects>();
+  computeClusterFeatures(clusters_, features_);
+  convertClusterFeatures2Msg(input_msg->header, features_, use_bounding_box_shape_, *output);
+  const auto output_stamp = output->header.stamp;
+  cluster_pub_->publish(std::move(output));
 
   // build debug msg
   if (debug_pub_->get_subscription_count() >= 1) {
-    sensor_msgs::msg::PointCloud2 debug;
-    convertClusters2SensorMsg(input_msg->header, clusters, debug);
-    debug_pub_->publish(debug);
+    auto debug = std::make_unique<sensor_msgs::msg::PointCloud2>();
+    convertClusters2SensorMsg(input_msg->header, clusters_, *debug);
+    debug_pub_->publish(std::move(debug));
   }
   if (debug_publisher_) {
     const double cyclic_time_ms = stop_watch_ptr_->toc("cyclic_time", true);
     const double processing_time_ms = stop_watch_ptr_->toc("processing_time", true);
     const double pipeline_latency_ms =
       std::chrono::duration<double, std::milli>(
-        std::chrono::nanoseconds((this->get_clock()->now() - output.header.stamp).nanoseconds()))
+        std::chrono::nanoseconds((this->get_clock()->now() - output_stamp).nanoseconds()))
         .count();
     debug_publisher_->publish<autoware_internal_debug_msgs::msg::Float64Stamped>(
       "debug/cyclic_time_ms", cyclic_time_ms);
@@ -14,7 +14,9 @@
 
 #pragma once
 
+#include "autoware/euclidean_cluster_object_detector/cluster_features.hpp"
 #include "autoware/euclidean_cluster_object_detector/euclidean_cluster.hpp"
+#include "autoware/euclidean_cluster_object_detector/grid_hash_euclidean_cluster.hpp"
 
 #include <autoware_utils_debug/debug_publisher.hpp>
 #include <autoware_utils_system/stop_watch.hpp>
@@ -41,7 +43,12 @@ private:
   rclcpp::Publisher<autoware_perception_msgs::msg::DetectedObjects>::SharedPtr cluster_pub_;
   rclcpp::Publisher<sensor_msgs::msg::PointCloud2>::SharedPtr debug_pub_;
 
-  std::shared_ptr<EuclideanCluster> cluster_;
+  std::shared_ptr<EuclideanClusterInterface> cluster_;
+  // reused across callbacks
+  pcl::PointCloud<pcl::PointXYZ>::Ptr raw_pointcloud_ptr_{new pcl::PointCloud<pcl::PointXYZ>};
+  ClusterBuffer clusters_;
+  ClusterFeatures features_;
+  bool use_bounding_box_shape_;
   std::unique_ptr<autoware_utils_system::StopWatch<std::chrono::milliseconds>> stop_watch_ptr_;
   std::unique_ptr<autoware_utils_debug::DebugPublisher> debug_publisher_;
 };
@@ -17,6 +17,7 @@
 #include <autoware/euclidean_cluster_object_detector/utils.hpp>
 
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace autoware::euclidean_cluster
@@ -31,10 +32,17 @@ VoxelGridBasedEuclideanClusterNode::VoxelGridBasedEuclideanClusterNode(
   const float tolerance = this->declare_parameter("tolerance", 1.0);
   const float voxel_leaf_size = this->declare_parameter("voxel_leaf_size", 0.5);
   const int min_points_number_per_voxel = this->declare_parameter("min_points_number_per_voxel", 3);
+  const auto clustering_method = clusteringMethodFromString(
+    this->declare_parameter<std::string>("clustering_method", "kdtree"));
+  const int num_threads = this->declare_parameter("num_threads", 1);
+  const bool use_bounding_box_shape = this->declare_parameter("use_bounding_box_shape", false);
 
   cluster_ = std::make_shared<VoxelGridBasedEuclideanCluster>(
     use_height, min_cluster_size, max_cluster_size, tolerance, voxel_leaf_size,
     min_points_number_per_voxel);
+  cluster_->setClusteringMethod(clustering_method);
+  cluster_->setNumThreads(num_threads);
+  cluster_->setUseBoundingBoxShape(use_bounding_box_shape);
   // Pass the diagnostics interface pointer from the node to the cluster
   diagnostics_interface_ptr_ =
     std::make_unique<autoware_utils_diagnostics::DiagnosticsInterface>(this, "euclidean_cluster");
@@ -67,24 +75,24 @@ void VoxelGridBasedEuclideanClusterNode::onPointCloud(
       this->get_logger(), *this->get_clock(), 1000, "Empty sensor points!");
   }
   // cluster and build output msg
-  autoware_perception_msgs::msg::DetectedObjects output;
+  auto output = std::make_unique<autoware_perception_msgs::msg::DetectedObjects>();
 
-  std::vector<pcl::PointCloud<pcl::PointXYZ>> clusters;
-  cluster_->cluster(input_msg, output, clusters);
-  cluster_pub_->publish(output);
+  cluster_->cluster(input_msg, *output, clusters_);
+  const auto output_stamp = output->header.stamp;
+  cluster_pub_->publish(std::move(output));
 
   // build debug msg
   if (debug_pub_->get_subscription_count() >= 1) {
-    sensor_msgs::msg::PointCloud2 debug;
-    convertClusters2SensorMsg(input_msg->header, clusters, debug);
-    debug_pub_->publish(debug);
+    auto debug = std::make_unique<sensor_msgs::msg::PointCloud2>();
+    convertClusters2SensorMsg(input_msg->header, clusters_, *debug);
+    debug_pub_->publish(std::move(debug));
   }
   if (debug_publisher_) {
     const double processing_time_ms = stop_watch_ptr_->toc("processing_time", true);
     const double cyclic_time_ms = stop_watch_ptr_->toc("cyclic_time", true);
     const double pipeline_latency_ms =
       std::chrono::duration<double, std::milli>(
-        std::chrono::nanoseconds((this->get_clock()->now() - output.header.stamp).nanoseconds()))
+        std::chrono::nanoseconds((this->get_clock()->now() - output_stamp).nanoseconds()))
         .count();
     debug_publisher_->publish<autoware_internal_debug_msgs::msg::Float64Stamped>(
       "debug/cyclic_time_ms", cyclic_time_ms);
@@ -0,0 +1,224 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Time per frame, allocations per frame and points per second of the clustering methods.
+// The synthetic frames are obstacle point clouds of 50k, 150k and 300k points. A recorded frame,
+// typically the output of the ground filter, is benchmarked as well when
+// AUTOWARE_CLUSTER_BENCHMARK_PCD is set.
+
+#include <autoware/euclidean_cluster_object_detector/cluster_features.hpp>
+#include <autoware/euclidean_cluster_object_detector/euclidean_cluster.hpp>
+#include <autoware/euclidean_cluster_object_detector/grid_hash_euclidean_cluster.hpp>
+#include <autoware/euclidean_cluster_object_detector/voxel_grid_based_euclidean_cluster.hpp>
+
+#include <pcl/io/pcd_io.h>
+#include <pcl_conversions/pcl_conversions.h>
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <new>
+#include <random>
+#include <string>
+
+namespace
+{
+std::atomic<std::size_t> allocation_count{0};
+}  // namespace
+
+// count the heap allocations of the whole binary, the counter is read around the measured loop
+void * operator new(std::size_t size)
+{
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  if (void * ptr = std::malloc(size == 0 ? 1 : size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void * ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void * ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+namespace
+{
+using autoware::euclidean_cluster::ClusterBuffer;
+using autoware::euclidean_cluster::ClusterFeatures;
+using autoware::euclidean_cluster::ClusteringMethod;
+using autoware::euclidean_cluster::EuclideanCluster;
+using autoware::euclidean_cluster::GridHashEuclideanCluster;
+using autoware::euclidean_cluster::VoxelGridBasedEuclideanCluster;
+using PointCloud = pcl::PointCloud<pcl::PointXYZ>;
+
+constexpr std::size_t points_per_object = 500;
+constexpr int64_t recorded_frame = 0;
+
+struct Input
+{
+  PointCloud::ConstPtr cloud;
+  sensor_msgs::msg::PointCloud2::ConstSharedPtr msg;
+};
+
+// obstacles of points_per_object points around random centers, some of them touching each other
+PointCloud::Ptr generate_obstacle_cloud(const std::size_t num_points)
+{
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<float> center(-60.0f, 60.0f);
+  std::normal_distribution<float> spread(0.0f, 0.6f);
+
+  PointCloud::Ptr cloud(new PointCloud);
+  cloud->reserve(num_points);
+  for (std::size_t i = 0; i < num_points / points_per_object; ++i) {
+    const float cx = center(engine);
+    const float cy = center(engine);
+    for (std::size_t j = 0; j < points_per_object; ++j) {
+      cloud->push_back(pcl::PointXYZ(
+        cx + spread(engine), cy + spread(engine), 0.5f + 0.5f * spread(engine)));
+    }
+  }
+  cloud->width = cloud->size();
+  cloud->height = 1;
+  return cloud;
+}
+
+PointCloud::Ptr load_recorded_cloud()
+{
+  const char * pcd_path = std::getenv("AUTOWARE_CLUSTER_BENCHMARK_PCD");
+  if (pcd_path == nullptr) {
+    return nullptr;
+  }
+  PointCloud::Ptr cloud(new PointCloud);
+  if (pcl::io::loadPCDFile(std::string(pcd_path), *cloud) != 0) {
+    return nullptr;
+  }
+  return cloud;
+}
+
+// the frames are generated once and shared by all benchmarks of the same size
+const Input & get_input(const int64_t num_points)
+{
+  static std::map<int64_t, Input> inputs;
+  auto & input = inputs[num_points];
+  if (!input.cloud) {
+    PointCloud::Ptr cloud = num_points == recorded_frame
+                              ? load_recorded_cloud()
+                              : generate_obstacle_cloud(static_cast<size_t>(num_points));
+    if (!cloud) {
+      return input;
+    }
+    auto msg = std::make_shared<sensor_msgs::msg::PointCloud2>();
+    pcl::toROSMsg(*cloud, *msg);
+    msg->header.frame_id = "base_link";
+    input.cloud = cloud;
+    input.msg = msg;
+  }
+  return input;
+}
+
+// run one frame per iteration and report the allocations per frame and the points per second
+template <typename ProcessFrame>
+void run_frames(benchmark::State & state, const Input & input, ProcessFrame && process_frame)
+{
+  // warm up the reusable buffers so that the steady state is measured
+  process_frame();
+
+  const std::size_t allocations_before = allocation_count.load(std::memory_order_relaxed);
+  for (auto _ : state) {
+    process_frame();
+  }
+  const std::size_t allocations = allocation_count.load(std::memory_order_relaxed) -
+                                  allocations_before;
+
+  state.SetItemsProcessed(state.iterations() * input.cloud->size());
+  state.counters["allocations"] =
+    benchmark::Counter(static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+}
+
+void euclidean_cluster(benchmark::State & state, const int64_t num_points, const bool features)
+{
+  const auto & input = get_input(num_points);
+  EuclideanCluster cluster(false, 10, 1000, 0.7f);
+  ClusterBuffer clusters;
+  ClusterFeatures cluster_features;
+  run_frames(state, input, [&]() {
+    cluster.cluster(input.cloud, clusters);
+    if (features) {
+      autoware::euclidean_cluster::computeClusterFeatures(clusters, cluster_features);
+    }
+  });
+}
+
+void grid_hash_euclidean_cluster(
+  benchmark::State & state, const int64_t num_points, const int num_threads)
+{
+  const auto & input = get_input(num_points);
+  GridHashEuclideanCluster cluster(false, 10, 1000, 0.7f);
+  cluster.setNumThreads(num_threads);
+  ClusterBuffer clusters;
+  run_frames(state, input, [&]() { cluster.cluster(input.cloud, clusters); });
+}
+
+void voxel_grid_based_euclidean_cluster(
+  benchmark::State & state, const int64_t num_points, const ClusteringMethod method)
+{
+  const auto & input = get_input(num_points);
+  VoxelGridBasedEuclideanCluster cluster(false, 10, 3000, 0.7f, 0.3f, 1);
+  cluster.setClusteringMethod(method);
+  autoware_perception_msgs::msg::DetectedObjects objects;
+  ClusterBuffer clusters;
+  run_frames(state, input, [&]() {
+    objects.objects.clear();
+    cluster.cluster(input.msg, objects, clusters);
+  });
+}
+
+void register_benchmarks(const int64_t num_points)
+{
+  const std::string suffix =
+    num_points == recorded_frame ? "/recorded" : "/" + std::to_string(num_points);
+  const auto add = [&](const std::string & name, auto && function, auto &&... args) {
+    benchmark::RegisterBenchmark((name + suffix).c_str(), function, num_points, args...)
+      ->Unit(benchmark::kMillisecond);
+  };
+
+  add("euclidean_cluster/kdtree", euclidean_cluster, false);
+  add("euclidean_cluster/kdtree_features", euclidean_cluster, true);
+  add("euclidean_cluster/grid_hash", grid_hash_euclidean_cluster, 1);
+  add("euclidean_cluster/grid_hash_4_threads", grid_hash_euclidean_cluster, 4);
+  add("voxel_grid_based/kdtree", voxel_grid_based_euclidean_cluster, ClusteringMethod::KdTree);
+  add(
+    "voxel_grid_based/grid_hash", voxel_grid_based_euclidean_cluster, ClusteringMethod::GridHash);
+}
+
+const bool benchmarks_registered = []() {
+  for (const int64_t num_points : {50000, 150000, 300000}) {
+    register_benchmarks(num_points);
+  }
+  if (get_input(recorded_frame).cloud) {
+    register_benchmarks(recorded_frame);
+  }
+  return true;
+}();
+
+}  // namespace
@@ -0,0 +1,117 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <autoware/euclidean_cluster_object_detector/cluster_features.hpp>
+#include <autoware/euclidean_cluster_object_detector/utils.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+using autoware::euclidean_cluster::ClusterBuffer;
+using autoware::euclidean_cluster::ClusterFeatures;
+
+class ClusterFeaturesTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    // a 4 x 2 rectangle of points rotated by 30 degrees around (10, 5), from z = -1 to z = 1
+    const float yaw = M_PI / 6.0;
+    for (int i = 0; i <= 8; ++i) {
+      for (int j = 0; j <= 4; ++j) {
+        const float u = -2.0f + 0.5f * i;
+        const float v = -1.0f + 0.5f * j;
+        const float z = (i + j) % 2 == 0 ? -1.0f : 1.0f;
+        clusters_.points.push_back(pcl::PointXYZ(
+          10.0f + std::cos(yaw) * u - std::sin(yaw) * v,
+          5.0f + std::sin(yaw) * u + std::cos(yaw) * v, z));
+      }
+    }
+    clusters_.endCluster();
+
+    // a single point
+    clusters_.points.push_back(pcl::PointXYZ(-3.0f, 2.0f, 0.5f));
+    clusters_.endCluster();
+  }
+
+  ClusterBuffer clusters_;
+};
+
+TEST_F(ClusterFeaturesTest, TestFeatures)
+{
+  ClusterFeatures features;
+  autoware::euclidean_cluster::computeClusterFeatures(clusters_, features);
+  ASSERT_EQ(features.size(), 2);
+
+  EXPECT_NEAR(features.centroid_x[0], 10.0, 1e-4);
+  EXPECT_NEAR(features.centroid_y[0], 5.0, 1e-4);
+  EXPECT_FLOAT_EQ(features.min_z[0], -1.0f);
+  EXPECT_FLOAT_EQ(features.max_z[0], 1.0f);
+  EXPECT_NEAR(features.yaw[0], M_PI / 6.0, 1e-4);
+  EXPECT_NEAR(features.obb_center_x[0], 10.0, 1e-4);
+  EXPECT_NEAR(features.obb_center_y[0], 5.0, 1e-4);
+  EXPECT_NEAR(features.obb_length[0], 4.0, 1e-4);
+  EXPECT_NEAR(features.obb_width[0], 2.0, 1e-4);
+
+  // the axis aligned box contains the rotated rectangle
+  EXPECT_NEAR(features.max_x[0] - features.min_x[0], 4.0 * std::cos(M_PI / 6.0) + 1.0, 1e-4);
+  EXPECT_NEAR(features.max_y[0] - features.min_y[0], 4.0 * 0.5 + 2.0 * std::cos(M_PI / 6.0), 1e-4);
+
+  EXPECT_FLOAT_EQ(features.centroid_x[1], -3.0);
+  EXPECT_FLOAT_EQ(features.obb_length[1], 0.0f);
+  EXPECT_FLOAT_EQ(features.obb_width[1], 0.0f);
+}
+
+TEST_F(ClusterFeaturesTest, TestCentroidMsgMatchesPerClusterConversion)
+{
+  std_msgs::msg::Header header;
+  header.frame_id = "base_link";
+
+  ClusterFeatures features;
+  autoware::euclidean_cluster::computeClusterFeatures(clusters_, features);
+  autoware_perception_msgs::msg::DetectedObjects objects;
+  autoware::euclidean_cluster::convertClusterFeatures2Msg(header, features, false, objects);
+
+  autoware_perception_msgs::msg::DetectedObjects expected_objects;
+  autoware::euclidean_cluster::convertPointCloudClusters2Msg(header, clusters_, expected_objects);
+  EXPECT_EQ(objects, expected_objects);
+}
+
+TEST_F(ClusterFeaturesTest, TestBoundingBoxMsg)
+{
+  std_msgs::msg::Header header;
+  ClusterFeatures features;
+  autoware::euclidean_cluster::computeClusterFeatures(clusters_, features);
+  autoware_perception_msgs::msg::DetectedObjects objects;
+  autoware::euclidean_cluster::convertClusterFeatures2Msg(header, features, true, objects);
+  ASSERT_EQ(objects.objects.size(), 2);
+
+  const auto & object = objects.objects[0];
+  EXPECT_EQ(object.shape.type, autoware_perception_msgs::msg::Shape::BOUNDING_BOX);
+  EXPECT_NEAR(object.shape.dimensions.x, 4.0, 1e-4);
+  EXPECT_NEAR(object.shape.dimensions.y, 2.0, 1e-4);
+  EXPECT_NEAR(object.shape.dimensions.z, 2.0, 1e-4);
+  const auto & pose = object.kinematics.pose_with_covariance.pose;
+  EXPECT_NEAR(pose.position.x, 10.0, 1e-4);
+  EXPECT_NEAR(pose.position.z, 0.0, 1e-4);
+  EXPECT_NEAR(2.0 * std::atan2(pose.orientation.z, pose.orientation.w), M_PI / 6.0, 1e-4);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -129,6 +129,28 @@ TEST_F(EuclideanClusterTest, TestClusteringWithMinSizeFilter)
   EXPECT_EQ(clusters.size(), 0);  // No clusters should pass the size filter
 }
 
+TEST_F(EuclideanClusterTest, TestClusteringIntoBuffer)
+{
+  autoware::euclidean_cluster::EuclideanCluster cluster(false, 1, 100, 0.5);
+
+  std::vector<pcl::PointCloud<pcl::PointXYZ>> expected;
+  EXPECT_TRUE(cluster.cluster(test_cloud_, expected));
+
+  // The buffer is overwritten by each call
+  autoware::euclidean_cluster::ClusterBuffer buffer;
+  for (int i = 0; i < 2; ++i) {
+    EXPECT_TRUE(cluster.cluster(test_cloud_, buffer));
+    ASSERT_EQ(buffer.size(), expected.size());
+    for (size_t j = 0; j < buffer.size(); ++j) {
+      ASSERT_EQ(buffer.clusterSize(j), expected[j].size());
+      for (size_t k = 0; k < expected[j].size(); ++k) {
+        EXPECT_EQ(buffer.clusterBegin(j)[k].x, expected[j].points[k].x);
+        EXPECT_EQ(buffer.clusterBegin(j)[k].z, expected[j].points[k].z);
+      }
+    }
+  }
+}
+
 TEST_F(EuclideanClusterTest, TestUnimplementedMethods)
 {
   autoware::euclidean_cluster::EuclideanCluster cluster(true, 1, 100, 0.5);
@@ -145,6 +167,11 @@ TEST_F(EuclideanClusterTest, TestUnimplementedMethods)
   std::vector<pcl::PointCloud<pcl::PointXYZ>> clusters;
   bool result2 = cluster.cluster(cloud_msg, objects, clusters);
   EXPECT_FALSE(result2);  // Should return false as method is not implemented
+
+  // Test unimplemented method 3
+  autoware::euclidean_cluster::ClusterBuffer buffer;
+  bool result3 = cluster.cluster(cloud_msg, objects, buffer);
+  EXPECT_FALSE(result3);  // Should return false as method is not implemented
 }
 
 int main(int argc, char ** argv)
@@ -0,0 +1,177 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <autoware/euclidean_cluster_object_detector/euclidean_cluster.hpp>
+#include <autoware/euclidean_cluster_object_detector/grid_hash_cluster_extraction.hpp>
+#include <autoware/euclidean_cluster_object_detector/grid_hash_euclidean_cluster.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using autoware::euclidean_cluster::EuclideanCluster;
+using autoware::euclidean_cluster::GridHashClusterExtraction;
+using autoware::euclidean_cluster::GridHashEuclideanCluster;
+
+namespace
+{
+// blobs of points around random centers, some of them touching each other
+pcl::PointCloud<pcl::PointXYZ>::Ptr makeBlobs(size_t blob_num, size_t points_per_blob)
+{
+  pcl::PointCloud<pcl::PointXYZ>::Ptr cloud(new pcl::PointCloud<pcl::PointXYZ>);
+  std::mt19937 engine(42);
+  std::uniform_real_distribution<float> center(-20.0f, 20.0f);
+  std::normal_distribution<float> spread(0.0f, 0.4f);
+  for (size_t i = 0; i < blob_num; ++i) {
+    const float cx = center(engine);
+    const float cy = center(engine);
+    const float cz = 0.1f * center(engine);
+    for (size_t j = 0; j < points_per_blob; ++j) {
+      const float x = cx + spread(engine);
+      const float y = cy + spread(engine);
+      const float z = cz + spread(engine);
+      cloud->push_back(pcl::PointXYZ(x, y, z));
+    }
+  }
+  cloud->width = cloud->size();
+  cloud->height = 1;
+  return cloud;
+}
+
+// order independent representation of the clusters
+std::vector<std::vector<float>> sortedClusters(
+  const std::vector<pcl::PointCloud<pcl::PointXYZ>> & clusters)
+{
+  std::vector<std::vector<float>> result;
+  for (const auto & cluster : clusters) {
+    std::vector<float> coordinates;
+    for (const auto & point : cluster.points) {
+      coordinates.push_back(point.x);
+    }
+    std::sort(coordinates.begin(), coordinates.end());
+    result.push_back(coordinates);
+  }
+  std::sort(result.begin(), result.end());
+  return result;
+}
+}  // namespace
+
+TEST(GridHashEuclideanClusterTest, MatchesKdTreeClustering)
+{
+  const auto cloud = makeBlobs(40, 50);
+  for (const bool use_height : {true, false}) {
+    EuclideanCluster kdtree_cluster(use_height, 3, 1000, 0.3);
+    GridHashEuclideanCluster grid_hash_cluster(use_height, 3, 1000, 0.3);
+
+    std::vector<pcl::PointCloud<pcl::PointXYZ>> expected;
+    std::vector<pcl::PointCloud<pcl::PointXYZ>> actual;
+    ASSERT_TRUE(kdtree_cluster.cluster(cloud, expected));
+    ASSERT_TRUE(grid_hash_cluster.cluster(cloud, actual));
+
+    EXPECT_GT(expected.size(), 1U);
+    EXPECT_EQ(sortedClusters(actual), sortedClusters(expected)) << "use_height: " << use_height;
+  }
+}
+
+TEST(GridHashEuclideanClusterTest, ConnectsNeighborsAcrossCells)
+{
+  // a chain with a spacing just below the tolerance, crossing many cell boundaries
+  pcl::PointCloud<pcl::PointXYZ>::Ptr cloud(new pcl::PointCloud<pcl::PointXYZ>);
+  for (int i = 0; i < 20; ++i) {
+    const float t = 0.45f * static_cast<float>(i);
+    cloud->push_back(pcl::PointXYZ(t * 0.6f - 3.0f, -t * 0.8f, 0.01f * static_cast<float>(i)));
+  }
+  // and a point just beyond the tolerance from the end of the chain
+  const auto last = cloud->points.back();
+  cloud->push_back(pcl::PointXYZ(last.x + 0.51f, last.y, last.z));
+
+  GridHashEuclideanCluster cluster(true, 1, 100, 0.5);
+  std::vector<pcl::PointCloud<pcl::PointXYZ>> clusters;
+  ASSERT_TRUE(cluster.cluster(cloud, clusters));
+  ASSERT_EQ(clusters.size(), 2U);
+  EXPECT_EQ(clusters[0].size(), 20U);
+  EXPECT_EQ(clusters[1].size(), 1U);
+}
+
+TEST(GridHashEuclideanClusterTest, DropsClustersOutsideSizeRange)
+{
+  const auto cloud = makeBlobs(1, 30);
+  std::vector<pcl::PointCloud<pcl::PointXYZ>> clusters;
+
+  GridHashEuclideanCluster too_small(true, 31, 100, 1.0);
+  ASSERT_TRUE(too_small.cluster(cloud, clusters));
+  EXPECT_TRUE(clusters.empty());
+
+  GridHashEuclideanCluster too_large(true, 1, 29, 1.0);
+  ASSERT_TRUE(too_large.cluster(cloud, clusters));
+  EXPECT_TRUE(clusters.empty());
+}
+
+TEST(GridHashClusterExtractionTest, IgnoresInvalidPointsAndSortsBySize)
+{
+  pcl::PointCloud<pcl::PointXYZ> cloud;
+  cloud.push_back(pcl::PointXYZ(10.0f, 0.0f, 0.0f));
+  cloud.push_back(pcl::PointXYZ(std::nanf(""), 0.0f, 0.0f));
+  cloud.push_back(pcl::PointXYZ(0.0f, 0.0f, 0.0f));
+  cloud.push_back(pcl::PointXYZ(0.2f, 0.0f, 0.0f));
+
+  GridHashClusterExtraction extraction;
+  extraction.setClusterTolerance(0.5f);
+  std::vector<pcl::PointIndices> cluster_indices;
+  extraction.extract(cloud, cluster_indices);
+
+  ASSERT_EQ(cluster_indices.size(), 2U);
+  EXPECT_EQ(cluster_indices[0].indices, (std::vector<int>{2, 3}));
+  EXPECT_EQ(cluster_indices[1].indices, (std::vector<int>{0}));
+}
+
+TEST(GridHashClusterExtractionTest, ParallelMatchesSerial)
+{
+  const auto cloud = makeBlobs(100, 100);
+  GridHashClusterExtraction serial_extraction;
+  serial_extraction.setClusterTolerance(0.3f);
+  std::vector<pcl::PointIndices> expected;
+  serial_extraction.extract(*cloud, expected);
+
+  GridHashClusterExtraction parallel_extraction;
+  parallel_extraction.setClusterTolerance(0.3f);
+  parallel_extraction.setNumThreads(4);
+  for (int trial = 0; trial < 3; ++trial) {
+    std::vector<pcl::PointIndices> actual;
+    parallel_extraction.extract(*cloud, actual);
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < actual.size(); ++i) {
+      EXPECT_EQ(actual[i].indices, expected[i].indices);
+    }
+  }
+}
+
+TEST(GridHashClusterExtractionTest, ParsesClusteringMethod)
+{
+  using autoware::euclidean_cluster::ClusteringMethod;
+  using autoware::euclidean_cluster::clusteringMethodFromString;
+  EXPECT_EQ(clusteringMethodFromString("kdtree"), ClusteringMethod::KdTree);
+  EXPECT_EQ(clusteringMethodFromString("grid_hash"), ClusteringMethod::GridHash);
+  EXPECT_THROW(clusteringMethodFromString("octree"), std::invalid_argument);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,103 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <autoware/euclidean_cluster_object_detector/grid_hash_voxel_grid.hpp>
+
+#include <gtest/gtest.h>
+#include <pcl/filters/voxel_grid.h>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <random>
+#include <vector>
+
+using autoware::euclidean_cluster::GridHashVoxelGrid;
+
+namespace
+{
+pcl::PointCloud<pcl::PointXYZ> makeRandomCloud(size_t point_num)
+{
+  pcl::PointCloud<pcl::PointXYZ> cloud;
+  std::mt19937 engine(42);
+  std::uniform_real_distribution<float> xy(-30.0f, 30.0f);
+  std::uniform_real_distribution<float> z(-1.0f, 3.0f);
+  for (size_t i = 0; i < point_num; ++i) {
+    cloud.push_back(pcl::PointXYZ(xy(engine), xy(engine), z(engine)));
+  }
+  return cloud;
+}
+
+// order independent representation of the centroids
+std::vector<std::array<float, 3>> sortedPoints(const pcl::PointCloud<pcl::PointXYZ> & cloud)
+{
+  std::vector<std::array<float, 3>> points;
+  for (const auto & point : cloud) {
+    points.push_back({point.x, point.y, point.z});
+  }
+  std::sort(points.begin(), points.end());
+  return points;
+}
+}  // namespace
+
+TEST(GridHashVoxelGridTest, SameCentroidsAsPclVoxelGrid)
+{
+  const auto cloud = makeRandomCloud(20000);
+
+  pcl::PointCloud<pcl::PointXYZ> expected;
+  pcl::VoxelGrid<pcl::PointXYZ> voxel_grid;
+  voxel_grid.setInputCloud(cloud.makeShared());
+  voxel_grid.setLeafSize(0.5f, 0.5f, 100.0f);
+  voxel_grid.filter(expected);
+
+  pcl::PointCloud<pcl::PointXYZ> actual;
+  GridHashVoxelGrid grid_hash_voxel_grid;
+  grid_hash_voxel_grid.setLeafSize(0.5f, 0.5f, 100.0f);
+  grid_hash_voxel_grid.filter(cloud, actual);
+
+  const auto expected_points = sortedPoints(expected);
+  const auto actual_points = sortedPoints(actual);
+  ASSERT_EQ(actual_points.size(), expected_points.size());
+  for (size_t i = 0; i < expected_points.size(); ++i) {
+    for (size_t j = 0; j < 3; ++j) {
+      EXPECT_NEAR(actual_points[i][j], expected_points[i][j], 1e-4f);
+    }
+  }
+  EXPECT_EQ(actual.width, actual.size());
+  EXPECT_EQ(actual.height, 1U);
+}
+
+TEST(GridHashVoxelGridTest, DropNonFinitePoints)
+{
+  pcl::PointCloud<pcl::PointXYZ> cloud;
+  cloud.push_back(pcl::PointXYZ(0.1f, 0.1f, 0.1f));
+  cloud.push_back(pcl::PointXYZ(0.3f, 0.3f, 0.3f));
+  cloud.push_back(pcl::PointXYZ(std::numeric_limits<float>::quiet_NaN(), 0.0f, 0.0f));
+  cloud.push_back(pcl::PointXYZ(1.5f, 0.0f, 0.0f));
+
+  pcl::PointCloud<pcl::PointXYZ> output;
+  GridHashVoxelGrid voxel_grid;
+  voxel_grid.setLeafSize(1.0f, 1.0f, 1.0f);
+  voxel_grid.filter(cloud, output);
+
+  // in the order of the first point of each voxel
+  ASSERT_EQ(output.size(), 2U);
+  EXPECT_FLOAT_EQ(output[0].x, 0.2f);
+  EXPECT_FLOAT_EQ(output[0].z, 0.2f);
+  EXPECT_FLOAT_EQ(output[1].x, 1.5f);
+
+  // the buffers are reused for a smaller cloud
+  voxel_grid.filter(pcl::PointCloud<pcl::PointXYZ>{}, output);
+  EXPECT_TRUE(output.empty());
+}
@@ -203,6 +203,39 @@ TEST_F(UtilsTest, TestConvertClusters2SensorMsg)
   EXPECT_FLOAT_EQ(*iter_z, 12.0f);
 }
 
+TEST_F(UtilsTest, TestConvertClusterBuffer)
+{
+  std_msgs::msg::Header header;
+  header.frame_id = "base_link";
+
+  // Same clusters in flat storage
+  autoware::euclidean_cluster::ClusterBuffer buffer;
+  for (const auto & cluster : clusters_) {
+    buffer.points.insert(buffer.points.end(), cluster.points.begin(), cluster.points.end());
+    buffer.endCluster();
+  }
+  EXPECT_EQ(buffer.size(), 2);
+  EXPECT_EQ(buffer.clusterSize(1), 2);
+
+  autoware_perception_msgs::msg::DetectedObjects expected_objects;
+  autoware_perception_msgs::msg::DetectedObjects objects;
+  autoware::euclidean_cluster::convertPointCloudClusters2Msg(header, clusters_, expected_objects);
+  autoware::euclidean_cluster::convertPointCloudClusters2Msg(header, buffer, objects);
+  EXPECT_EQ(objects, expected_objects);
+
+  sensor_msgs::msg::PointCloud2 expected_output;
+  sensor_msgs::msg::PointCloud2 output;
+  autoware::euclidean_cluster::convertClusters2SensorMsg(header, clusters_, expected_output);
+  autoware::euclidean_cluster::convertClusters2SensorMsg(header, buffer, output);
+  EXPECT_EQ(output, expected_output);
+
+  // The storage is kept when the buffer is cleared
+  const auto capacity = buffer.points.capacity();
+  buffer.clear();
+  EXPECT_TRUE(buffer.empty());
+  EXPECT_EQ(buffer.points.capacity(), capacity);
+}
+
 int main(int argc, char ** argv)
 {
   testing::InitGoogleTest(&argc, argv);
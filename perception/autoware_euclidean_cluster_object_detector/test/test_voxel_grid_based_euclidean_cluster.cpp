@@ -291,6 +291,34 @@ TEST(VoxelGridBasedEuclideanClusterTest, ExceedMaxClusterSize)
   EXPECT_EQ(objects.objects.size(), 0);
 }
 
+// Test the output into a caller owned buffer
+TEST(VoxelGridBasedEuclideanClusterTest, ClusterBuffer)
+{
+  auto cluster = std::make_shared<autoware::euclidean_cluster::VoxelGridBasedEuclideanCluster>(
+    false, 5, 100, 0.5, 0.2, 1);
+  sensor_msgs::msg::PointCloud2::ConstSharedPtr msg =
+    std::make_shared<sensor_msgs::msg::PointCloud2>(generateMultiClusterPointCloud(10, 3));
+
+  autoware_perception_msgs::msg::DetectedObjects expected_objects;
+  std::vector<pcl::PointCloud<pcl::PointXYZ>> expected_clusters;
+  EXPECT_TRUE(cluster->cluster(msg, expected_objects, expected_clusters));
+
+  // The buffer is overwritten by each call
+  autoware::euclidean_cluster::ClusterBuffer buffer;
+  for (int i = 0; i < 2; ++i) {
+    autoware_perception_msgs::msg::DetectedObjects objects;
+    EXPECT_TRUE(cluster->cluster(msg, objects, buffer));
+    EXPECT_EQ(objects, expected_objects);
+    ASSERT_EQ(buffer.size(), expected_clusters.size());
+    for (size_t j = 0; j < buffer.size(); ++j) {
+      EXPECT_EQ(buffer.clusterSize(j), expected_clusters[j].size());
+    }
+  }
+
+  pcl::PointCloud<pcl::PointXYZ>::ConstPtr empty_cloud(new pcl::PointCloud<pcl::PointXYZ>);
+  EXPECT_FALSE(cluster->cluster(empty_cloud, buffer));
+}
+
 int main(int argc, char ** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -54,6 +54,15 @@ public:
     point.z = *reinterpret_cast<const float *>(&input->data[data_index + data_offset_z_]);
   }
 
+  inline void setPoint(
+    sensor_msgs::msg::PointCloud2 & output, const size_t data_index,
+    const pcl::PointXYZ & point) const
+  {
+    *reinterpret_cast<float *>(&output.data[data_index + data_offset_x_]) = point.x;
+    *reinterpret_cast<float *>(&output.data[data_index + data_offset_y_]) = point.y;
+    *reinterpret_cast<float *>(&output.data[data_index + data_offset_z_]) = point.z;
+  }
+
 private:
   // data field offsets
   int data_offset_x_ = 0;
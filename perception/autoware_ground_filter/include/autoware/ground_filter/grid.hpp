@@ -21,6 +21,8 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <limits>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -92,6 +94,51 @@ float pseudoTan(const float theta)
   }
   return std::copysign(M_PI_4f / (M_PI_2f - std::abs(normalized_theta)), normalized_theta);
 }
+
+void pseudoDirection(const float theta, float & x, float & y)
+{
+  // inverse of pseudoArcTan2, unit vector of an angle in the range of [0, 2pi)
+
+  const int zone = std::clamp(static_cast<int>(theta / M_PI_4f), 0, 7);
+  const float ratio = theta / M_PI_4f - static_cast<float>(zone);
+  switch (zone) {
+    case 0:
+      x = 1.0f;
+      y = ratio;
+      break;
+    case 1:
+      x = 1.0f - ratio;
+      y = 1.0f;
+      break;
+    case 2:
+      x = -ratio;
+      y = 1.0f;
+      break;
+    case 3:
+      x = -1.0f;
+      y = 1.0f - ratio;
+      break;
+    case 4:
+      x = -1.0f;
+      y = -ratio;
+      break;
+    case 5:
+      x = ratio - 1.0f;
+      y = -1.0f;
+      break;
+    case 6:
+      x = ratio;
+      y = -1.0f;
+      break;
+    default:
+      x = 1.0f;
+      y = ratio - 1.0f;
+      break;
+  }
+  const float norm_inv = 1.0f / std::sqrt(x * x + y * y);
+  x *= norm_inv;
+  y *= norm_inv;
+}
 }  // namespace
 
 namespace autoware::ground_filter
@@ -105,12 +152,33 @@ struct Point
   float height;
 };
 
+// view of the points of a cell, stored contiguously in the point array of the grid
+class PointList
+{
+public:
+  const Point * begin() const { return begin_; }
+  const Point * end() const { return end_; }
+  size_t size() const { return static_cast<size_t>(end_ - begin_); }
+  bool empty() const { return begin_ == end_; }
+
+  void assign(const Point * begin, const Point * end)
+  {
+    begin_ = begin;
+    end_ = end;
+  }
+  void clear() { begin_ = end_ = nullptr; }
+
+private:
+  const Point * begin_ = nullptr;
+  const Point * end_ = nullptr;
+};
+
 // Concentric Zone Model (CZM) based polar grid
 class Cell
 {
 public:
   // list of point indices
-  std::vector<Point> point_list_;  // point index and distance
+  PointList point_list_;  // point index and distance
 
   // method to check if the cell is empty
   inline bool isEmpty() const { return point_list_.empty(); }
@@ -138,10 +206,17 @@ public:
   float gradient_;
   float intercept_;
 
+  // ground of the previous frame projected to this cell
+  float prior_height_;
+  float prior_radius_;
+  int prior_point_num_ = 0;
+
   // process flags
   bool is_processed_ = false;
   bool is_ground_initialized_ = false;
   bool has_ground_ = false;
+  bool has_prior_ = false;
+  bool is_prior_reused_ = false;
 };
 
 class Grid
@@ -181,6 +256,7 @@ public:
     // initialize and resize cells
     cells_.clear();
     cells_.resize(radial_idx_offsets_.back() + azimuth_grids_per_radial_.back());
+    cell_point_offsets_.assign(cells_.size() + 1, 0);
 
     // set cell geometry
     setCellGeometry();
@@ -189,6 +265,60 @@ public:
     is_initialized_ = true;
   }
 
+  // replace the per-point arc tangent and divisions of getGridIdx by table lookups
+  //   radial: table indexed by the radius at a quarter of the smallest radial grid size. Entries
+  //           whose range crosses a radial boundary hold lut_boundary_ and fall back to the
+  //           exact computation, so the cell of every point is unchanged.
+  //   azimuth: multiplication by the inverse azimuth interval of the ring. Points close to an
+  //            azimuth boundary fall back to the exact division.
+  void buildLookupTable()
+  {
+    std::unique_ptr<ScopedTimeTrack> st_ptr;
+    if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
+
+    float min_radial_size = grid_radial_limit_;
+    for (size_t i = 1; i < grid_radial_boundaries_.size(); ++i) {
+      min_radial_size =
+        std::min(min_radial_size, grid_radial_boundaries_[i] - grid_radial_boundaries_[i - 1]);
+    }
+    const float resolution = min_radial_size * 0.25f;
+    radial_lut_inv_resolution_ = 1.0f / resolution;
+    const auto lut_size =
+      static_cast<size_t>(std::ceil(grid_radial_limit_ * radial_lut_inv_resolution_));
+    const auto bin_of = [this](const float radius) {
+      return static_cast<size_t>(radius * radial_lut_inv_resolution_);
+    };
+    constexpr float infinity = std::numeric_limits<float>::infinity();
+    radial_idx_lut_.resize(lut_size);
+    for (size_t bin = 0; bin < lut_size; ++bin) {
+      // find the smallest and the largest radius that fall into the bin. The radial index is
+      // monotonic, so the bin is uniform when both ends have the same index.
+      float lower = static_cast<float>(bin) * resolution;
+      while (lower > 0.0f && bin_of(std::nextafter(lower, 0.0f)) >= bin) {
+        lower = std::nextafter(lower, 0.0f);
+      }
+      while (bin_of(lower) < bin) {
+        lower = std::nextafter(lower, infinity);
+      }
+      float upper = static_cast<float>(bin + 1) * resolution;
+      while (bin_of(upper) > bin) {
+        upper = std::nextafter(upper, 0.0f);
+      }
+      while (bin_of(std::nextafter(upper, infinity)) <= bin) {
+        upper = std::nextafter(upper, infinity);
+      }
+      const int lower_idx = getRadialIdx(lower);
+      radial_idx_lut_[bin] = lower_idx == getRadialIdx(upper) ? lower_idx : lut_boundary_;
+    }
+
+    azimuth_interval_inv_per_radial_.resize(azimuth_interval_per_radial_.size());
+    for (size_t i = 0; i < azimuth_interval_per_radial_.size(); ++i) {
+      azimuth_interval_inv_per_radial_[i] = 1.0f / azimuth_interval_per_radial_[i];
+    }
+
+    use_lookup_table_ = true;
+  }
+
   // method to add a point to the grid
   void addPoint(const float x, const float y, const float z, const size_t point_idx)
   {
@@ -206,8 +336,72 @@ public:
     }
     const size_t grid_idx_idx = static_cast<size_t>(grid_idx);
 
-    // add the point to the cell
-    cells_[grid_idx_idx].point_list_.emplace_back(Point{point_idx, radius, z});
+    // stage the point, the cell point lists are built by sortPointsByCell()
+    staged_points_.emplace_back(Point{point_idx, radius, z});
+    staged_cell_idx_.push_back(static_cast<uint32_t>(grid_idx_idx));
+    ++cell_point_offsets_[grid_idx_idx + 1];
+  }
+
+  // method to add a ground point of the previous frame to the prior of its cell
+  void addPrior(const float x, const float y, const float z)
+  {
+    const float x_fixed = x - origin_x_;
+    const float y_fixed = y - origin_y_;
+    const float radius = std::sqrt(x_fixed * x_fixed + y_fixed * y_fixed);
+    const float azimuth = pseudoArcTan2(y_fixed, x_fixed);
+
+    const int grid_idx = getGridIdx(radius, azimuth);
+    if (grid_idx < 0) {
+      return;
+    }
+
+    // running average of the projected ground points
+    Cell & cell = cells_[static_cast<size_t>(grid_idx)];
+    if (!cell.has_prior_) {
+      cell.prior_height_ = 0.0f;
+      cell.prior_radius_ = 0.0f;
+      cell.prior_point_num_ = 0;
+      cell.has_prior_ = true;
+    }
+    cell.prior_point_num_ += 1;
+    const float weight = 1.0f / static_cast<float>(cell.prior_point_num_);
+    cell.prior_height_ += (z - cell.prior_height_) * weight;
+    cell.prior_radius_ += (radius - cell.prior_radius_) * weight;
+  }
+
+  // position of the ground estimate of a cell, at the average radius on the cell center azimuth
+  void getGroundPosition(const Cell & cell, float & x, float & y) const
+  {
+    float direction_x = 0.0f;
+    float direction_y = 0.0f;
+    pseudoDirection(cell.center_azimuth_, direction_x, direction_y);
+    x = origin_x_ + cell.avg_radius_ * direction_x;
+    y = origin_y_ + cell.avg_radius_ * direction_y;
+  }
+
+  // counting sort of the staged points by cell
+  //   the points of each cell are stored contiguously in the order they were added, and every
+  //   cell point list views its range. All buffers keep their capacity across frames.
+  void sortPointsByCell()
+  {
+    std::unique_ptr<ScopedTimeTrack> st_ptr;
+    if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
+
+    for (size_t i = 1; i < cell_point_offsets_.size(); ++i) {
+      cell_point_offsets_[i] += cell_point_offsets_[i - 1];
+    }
+
+    points_.resize(staged_points_.size());
+    cell_fill_position_.assign(cell_point_offsets_.begin(), cell_point_offsets_.end() - 1);
+    for (size_t i = 0; i < staged_points_.size(); ++i) {
+      points_[cell_fill_position_[staged_cell_idx_[i]]++] = staged_points_[i];
+    }
+
+    const Point * data = points_.data();
+    for (size_t idx = 0; idx < cells_.size(); ++idx) {
+      cells_[idx].point_list_.assign(
+        data + cell_point_offsets_[idx], data + cell_point_offsets_[idx + 1]);
+    }
   }
 
   size_t getGridSize() const { return cells_.size(); }
@@ -227,14 +421,81 @@ public:
     std::unique_ptr<ScopedTimeTrack> st_ptr;
     if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
 
+    staged_points_.clear();
+    staged_cell_idx_.clear();
+    cell_point_offsets_.assign(cells_.size() + 1, 0);
+
     for (auto & cell : cells_) {
       cell.point_list_.clear();
       cell.is_processed_ = false;
       cell.is_ground_initialized_ = false;
       cell.has_ground_ = false;
+      cell.has_prior_ = false;
+      cell.is_prior_reused_ = false;
+    }
+  }
+
+  // split the cells into azimuth sectors whose radial chains do not cross each other
+  //   the cells of the inner rings, with less than min_sector_num azimuth grids, are shared by all
+  //   sectors. They form the prefix [0, getSharedCellNum()) of the cell indices.
+  //   a cell of the outer rings belongs to the sector of its previous cell, so the scan-grid root
+  //   of a cell is either a shared cell or a cell of the same sector with a smaller index.
+  void setAzimuthSectors(const size_t min_sector_num)
+  {
+    std::unique_ptr<ScopedTimeTrack> st_ptr;
+    if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
+
+    sector_num_ = 0;
+    shared_cell_num_ = cells_.size();
+    sector_offsets_.clear();
+    sector_cell_indices_.clear();
+    if (min_sector_num < 2) {
+      return;
+    }
+
+    // the first ring with enough azimuth grids defines the sectors
+    size_t split_radial_idx = 0;
+    while (split_radial_idx < azimuth_grids_per_radial_.size() &&
+           static_cast<size_t>(azimuth_grids_per_radial_[split_radial_idx]) < min_sector_num) {
+      ++split_radial_idx;
+    }
+    if (split_radial_idx >= azimuth_grids_per_radial_.size()) {
+      return;
+    }
+    sector_num_ = static_cast<size_t>(azimuth_grids_per_radial_[split_radial_idx]);
+    shared_cell_num_ = static_cast<size_t>(radial_idx_offsets_[split_radial_idx]);
+
+    // the previous cell has a smaller index, so its sector is already known
+    std::vector<int> sector_of_cell(cells_.size(), -1);
+    std::vector<size_t> sector_cell_count(sector_num_ + 1, 0);
+    for (size_t idx = shared_cell_num_; idx < cells_.size(); ++idx) {
+      const Cell & cell = cells_[idx];
+      if (cell.radial_idx_ == static_cast<int>(split_radial_idx)) {
+        sector_of_cell[idx] = cell.azimuth_idx_;
+      } else {
+        sector_of_cell[idx] = sector_of_cell[cell.prev_grid_idx_];
+      }
+      ++sector_cell_count[sector_of_cell[idx] + 1];
+    }
+
+    // cells of each sector, in increasing index order
+    sector_offsets_.resize(sector_num_ + 1, 0);
+    for (size_t s = 0; s < sector_num_; ++s) {
+      sector_offsets_[s + 1] = sector_offsets_[s] + sector_cell_count[s + 1];
+    }
+    sector_cell_indices_.resize(sector_offsets_.back());
+    std::vector<size_t> fill_position(sector_offsets_.begin(), sector_offsets_.end() - 1);
+    for (size_t idx = shared_cell_num_; idx < cells_.size(); ++idx) {
+      sector_cell_indices_[fill_position[sector_of_cell[idx]]++] = static_cast<int>(idx);
     }
   }
 
+  size_t getSectorNum() const { return sector_num_; }
+  size_t getSharedCellNum() const { return shared_cell_num_; }
+  size_t getSectorCellBegin(const size_t sector) const { return sector_offsets_[sector]; }
+  size_t getSectorCellEnd(const size_t sector) const { return sector_offsets_[sector + 1]; }
+  int getSectorCellIdx(const size_t pos) const { return sector_cell_indices_[pos]; }
+
   void setGridConnections()
   {
     std::unique_ptr<ScopedTimeTrack> st_ptr;
@@ -264,6 +525,13 @@ private:
   float grid_azimuth_size_ = 0.01f;             // radians
   float grid_linearity_switch_radius_ = 20.0f;  // meters
 
+  // lookup tables
+  static constexpr int lut_boundary_ = -2;
+  bool use_lookup_table_ = false;
+  float radial_lut_inv_resolution_ = 0.0f;
+  std::vector<int> radial_idx_lut_;
+  std::vector<float> azimuth_interval_inv_per_radial_;
+
   // calculated parameters
   float grid_dist_size_rad_ = 0.0f;           // radians
   float grid_dist_size_inv_ = 0.0f;           // inverse of the grid size in meters
@@ -284,6 +552,19 @@ private:
   // list of cells
   std::vector<Cell> cells_;
 
+  // points of all cells, sorted by cell. cell i owns [cell_point_offsets_[i], [i + 1])
+  std::vector<Point> points_;
+  std::vector<size_t> cell_point_offsets_;
+  std::vector<size_t> cell_fill_position_;
+  std::vector<Point> staged_points_;
+  std::vector<uint32_t> staged_cell_idx_;
+
+  // azimuth sectors, cells of sector s are sector_cell_indices_[sector_offsets_[s]...]
+  size_t sector_num_ = 0;
+  size_t shared_cell_num_ = 0;
+  std::vector<size_t> sector_offsets_;
+  std::vector<int> sector_cell_indices_;
+
   // debug information
   std::shared_ptr<autoware_utils_debug::TimeKeeper> time_keeper_;
 
@@ -400,6 +681,36 @@ private:
     return grid_rad_idx;
   }
 
+  int getRadialIdxFromTable(const float & radius) const
+  {
+    if (radius < 0) {
+      return -1;
+    }
+    const auto bin = static_cast<size_t>(radius * radial_lut_inv_resolution_);
+    if (bin >= radial_idx_lut_.size() || radial_idx_lut_[bin] == lut_boundary_) {
+      return getRadialIdx(radius);
+    }
+    return radial_idx_lut_[bin];
+  }
+
+  int getAzimuthGridIdxFromTable(const int & radial_idx, const float & azimuth) const
+  {
+    // the product differs from the quotient by a few ulps, which only matters next to a boundary
+    constexpr float boundary_margin = 1e-3f;
+    const float position = azimuth * azimuth_interval_inv_per_radial_[radial_idx];
+    const float position_floor = std::floor(position);
+    const float fraction = position - position_floor;
+    if (fraction < boundary_margin || fraction > 1.0f - boundary_margin) {
+      return getAzimuthGridIdx(radial_idx, azimuth);
+    }
+    int azimuth_grid_idx = static_cast<int>(position_floor);
+    if (azimuth_grid_idx == azimuth_grids_per_radial_[radial_idx]) {
+      // loop back to the first grid
+      azimuth_grid_idx = 0;
+    }
+    return azimuth_grid_idx;
+  }
+
   int getGridIdx(const int & radial_idx, const int & azimuth_idx) const
   {
     return radial_idx_offsets_[radial_idx] + azimuth_idx;
@@ -410,13 +721,15 @@ private:
   // range limit is horizon angle
   int getGridIdx(const float & radius, const float & azimuth) const
   {
-    const int grid_rad_idx = getRadialIdx(radius);
+    const int grid_rad_idx =
+      use_lookup_table_ ? getRadialIdxFromTable(radius) : getRadialIdx(radius);
     if (grid_rad_idx < 0) {
       return -1;
     }
 
     // azimuth grid id
-    const int grid_az_idx = getAzimuthGridIdx(grid_rad_idx, azimuth);
+    const int grid_az_idx = use_lookup_table_ ? getAzimuthGridIdxFromTable(grid_rad_idx, azimuth)
+                                              : getAzimuthGridIdx(grid_rad_idx, azimuth);
     if (grid_az_idx < 0) {
       return -1;
     }
@@ -21,6 +21,8 @@
 #include <autoware_utils_debug/time_keeper.hpp>
 #include <pcl/impl/point_types.hpp>
 
+#include <Eigen/Core>
+
 #include <sensor_msgs/msg/point_cloud2.hpp>
 
 #include <pcl/PointIndices.h>
@@ -148,6 +150,16 @@ struct GroundFilterParameter
   float virtual_lidar_x;
   float virtual_lidar_y;
   float virtual_lidar_z;
+
+  // number of threads classifying the azimuth sectors in parallel, 1 disables the parallel mode
+  int num_threads;
+
+  // find the cell of each point with lookup tables instead of arc tangents and divisions
+  bool use_cell_lookup_table;
+
+  // reuse the ground of the previous frame in the cells where it agrees with the current frame
+  bool use_temporal_ground_model;
+  float temporal_ground_model_height_tolerance;
 };
 
 class GroundFilter
@@ -165,6 +177,17 @@ public:
       param_.virtual_lidar_x, param_.virtual_lidar_y, param_.virtual_lidar_z);
     grid_ptr_->initialize(
       param_.grid_size_m, param_.radial_divider_angle_rad, param_.grid_mode_switch_radius);
+
+    if (param_.use_cell_lookup_table) {
+      grid_ptr_->buildLookupTable();
+    }
+
+    // a few sectors per thread, so that the dynamic scheduling balances the sparse and the dense
+    // directions
+    constexpr int sectors_per_thread = 4;
+    if (param_.num_threads > 1) {
+      grid_ptr_->setAzimuthSectors(static_cast<size_t>(param_.num_threads * sectors_per_thread));
+    }
   }
   ~GroundFilter() = default;
 
@@ -184,6 +207,22 @@ public:
   }
   void process(const PointCloud2ConstPtr & in_cloud, pcl::PointIndices & out_no_ground_indices);
 
+  // motion of the input frame since the previous process() call, transforming the coordinates of
+  // the previous frame to the current one. Valid for the next process() call only.
+  void setFrameMotion(const Eigen::Matrix4f & previous_to_current)
+  {
+    frame_motion_ = previous_to_current;
+    has_frame_motion_ = true;
+  }
+  // drop the ground of the previous frame, e.g. when the ego motion is unknown
+  void resetGroundModel()
+  {
+    ground_model_.clear();
+    has_frame_motion_ = false;
+  }
+  // number of cells classified from the ground of the previous frame in the last process() call
+  size_t getReusedCellNum() const { return reused_cell_num_; }
+
 private:
   // parameters
   GroundFilterParameter param_;
@@ -195,6 +234,15 @@ private:
   // grid data
   std::unique_ptr<Grid> grid_ptr_;
 
+  // non-ground indices of each azimuth sector in the parallel mode
+  std::vector<pcl::PointIndices> sector_no_ground_indices_;
+
+  // ground estimates of the previous frame, in the input frame of the previous frame
+  std::vector<Eigen::Vector3f> ground_model_;
+  Eigen::Matrix4f frame_motion_ = Eigen::Matrix4f::Identity();
+  bool has_frame_motion_ = false;
+  size_t reused_cell_num_ = 0;
+
   // debug information
   std::shared_ptr<autoware_utils_debug::TimeKeeper> time_keeper_;
 
@@ -203,7 +251,11 @@ private:
     const int check_idx, const int search_cnt, std::vector<int> & idx, size_t count) const;
   void fitLineFromGndGrid(const std::vector<int> & idx, float & a, float & b) const;
 
+  bool fitLineFromPrior(const Cell & cell, const Cell & prev_cell, float & a, float & b) const;
+
   void convert();
+  void projectGroundModel();
+  void storeGroundModel();
   void preprocess();
   void initializeGround(pcl::PointIndices & out_no_ground_indices);
 
@@ -213,6 +265,10 @@ private:
     const Cell & cell, PointsCentroid & ground_bin, pcl::PointIndices & out_no_ground_indices);
   void SegmentBreakCell(
     const Cell & cell, PointsCentroid & ground_bin, pcl::PointIndices & out_no_ground_indices);
+  void finalizeCell(
+    Cell & cell, const Cell & prev_cell, PointsCentroid & ground_bin,
+    pcl::PointIndices & out_no_ground_indices);
+  void classifyCell(Cell & cell, pcl::PointIndices & out_no_ground_indices);
   void classify(pcl::PointIndices & out_no_ground_indices);
 };
 
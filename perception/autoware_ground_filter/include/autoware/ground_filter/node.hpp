@@ -51,6 +51,7 @@
 #endif
 
 // Include tier4 autoware utils
+#include <autoware/point_types/pipeline_latency.hpp>
 #include <autoware_utils_debug/debug_publisher.hpp>
 #include <autoware_utils_debug/published_time_publisher.hpp>
 #include <autoware_utils_system/stop_watch.hpp>
@@ -189,7 +190,8 @@ private:
   void faster_filter(
     const sensor_msgs::msg::PointCloud2::ConstSharedPtr & input,
     [[maybe_unused]] const pcl::IndicesPtr & indices, sensor_msgs::msg::PointCloud2 & output,
-    [[maybe_unused]] const TransformInfo & transform_info);
+    [[maybe_unused]] const TransformInfo & transform_info,
+    const TransformInfo & output_transform_info);
 
   // data accessor
   PclDataAccessor data_accessor_;
@@ -228,11 +230,25 @@ private:
   float grid_mode_switch_radius_;  // non linear grid size switching distance
   uint16_t ground_grid_buffer_size_;
   float virtual_lidar_z_;
+  int num_threads_;
+  bool use_cell_lookup_table_;
+
+  // temporal ground model parameters
+  bool use_temporal_ground_model_;
+  std::string temporal_ground_model_frame_;  // fixed frame giving the motion between the frames
+  float temporal_ground_model_height_tolerance_;
+
+  // pose of the previous input frame in temporal_ground_model_frame_
+  Eigen::Matrix4f previous_input_pose_{Eigen::Matrix4f::Identity()};
+  std::string previous_input_frame_;
+  rclcpp::Time previous_input_stamp_;
+  bool has_previous_input_pose_{false};
 
   // pointcloud parameters
   std::string tf_input_frame_;
   std::string tf_output_frame_;
   std::size_t max_queue_size_;
+  bool process_latest_only_;
   bool use_indices_;
   bool latched_indices_;
   bool approximate_sync_;
@@ -286,11 +302,13 @@ private:
    * and the other removed as indicated in the indices
    * @param in_cloud_ptr Input PointCloud to which the extraction will be performed
    * @param in_indices Indices of the points to be both removed and kept
+   * @param transform_info Transform applied to the coordinates of the kept points
    * @param out_object_cloud Resulting PointCloud with the indices kept
    */
   void extractObjectPoints(
     const sensor_msgs::msg::PointCloud2::ConstSharedPtr & in_cloud_ptr,
-    const pcl::PointIndices & in_indices, sensor_msgs::msg::PointCloud2 & out_object_cloud) const;
+    const pcl::PointIndices & in_indices, const TransformInfo & transform_info,
+    sensor_msgs::msg::PointCloud2 & out_object_cloud) const;
 
   /** \brief Parameter service callback result : needed to be hold */
   rclcpp::Node::OnSetParametersCallbackHandle::SharedPtr set_param_res_;
@@ -318,7 +336,8 @@ private:
   bool calculate_transform_matrix(
     const std::string & target_frame, const sensor_msgs::msg::PointCloud2 & from,
     TransformInfo & transform_info /*output*/);
-  bool convert_output_costly(std::unique_ptr<sensor_msgs::msg::PointCloud2> & output);
+  /** \brief Give the motion of the input frame since the previous cloud to the ground filter */
+  void updateFrameMotion(const sensor_msgs::msg::PointCloud2 & input);
   void faster_input_indices_callback(
     const sensor_msgs::msg::PointCloud2::ConstSharedPtr cloud,
     const pcl_msgs::msg::PointIndices::ConstSharedPtr indices);
@@ -347,6 +366,7 @@ protected:
   std::unique_ptr<autoware_utils_tf::TransformListener> transform_listener_{nullptr};
 
   std::unique_ptr<autoware_utils_debug::PublishedTimePublisher> published_time_publisher_;
+  autoware::point_types::StageLatency stage_latency_;
 
   // To validate if the pointcloud is valid
   inline bool isValid(
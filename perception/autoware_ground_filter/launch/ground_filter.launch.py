@@ -19,6 +19,7 @@ import launch
 from launch.actions import DeclareLaunchArgument
 from launch.actions import GroupAction
 from launch.actions import OpaqueFunction
+from launch.conditions import IfCondition
 from launch.conditions import LaunchConfigurationEquals
 from launch.conditions import LaunchConfigurationNotEquals
 from launch.substitutions import LaunchConfiguration
@@ -42,6 +43,9 @@ def launch_setup(context, *args, **kwargs):
     with open(ground_segmentation_param_path, "r") as f:
         ground_segmentation_param = yaml.safe_load(f)["/**"]["ros__parameters"]
 
+    # hand the clouds over without copy between the nodes of the same container
+    use_intra_process = IfCondition(LaunchConfiguration("use_intra_process")).evaluate(context)
+
     nodes = [
         ComposableNode(
             package="autoware_ground_filter",
@@ -57,6 +61,7 @@ def launch_setup(context, *args, **kwargs):
                 {"output_frame": "base_link"},
                 vehicle_info_param,
             ],
+            extra_arguments=[{"use_intra_process_comms": use_intra_process}],
         ),
     ]
 
@@ -104,6 +109,7 @@ def generate_launch_description():
         [
             vehicle_info_param,
             add_launch_arg("container", ""),
+            add_launch_arg("use_intra_process", "false"),
             add_launch_arg("input/pointcloud", "pointcloud"),
             add_launch_arg("output/pointcloud", "no_ground/pointcloud"),
         ]
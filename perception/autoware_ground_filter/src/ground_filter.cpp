@@ -40,6 +40,48 @@ void GroundFilter::convert()
     data_accessor_.getPoint(in_cloud_, data_index, input_point);
     grid_ptr_->addPoint(input_point.x, input_point.y, input_point.z, data_index);
   }
+  grid_ptr_->sortPointsByCell();
+}
+
+// project the ground estimates of the previous frame to the cells of the current grid
+void GroundFilter::projectGroundModel()
+{
+  std::unique_ptr<ScopedTimeTrack> st_ptr;
+  if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
+
+  // without the motion, the previous ground is not comparable to the current frame
+  if (!has_frame_motion_) {
+    ground_model_.clear();
+    return;
+  }
+  has_frame_motion_ = false;
+
+  const Eigen::Matrix3f rotation = frame_motion_.block<3, 3>(0, 0);
+  const Eigen::Vector3f translation = frame_motion_.block<3, 1>(0, 3);
+  for (const auto & ground_point : ground_model_) {
+    const Eigen::Vector3f point = rotation * ground_point + translation;
+    grid_ptr_->addPrior(point.x(), point.y(), point.z());
+  }
+}
+
+// keep the ground estimates of the current frame for the next one
+void GroundFilter::storeGroundModel()
+{
+  std::unique_ptr<ScopedTimeTrack> st_ptr;
+  if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
+
+  ground_model_.clear();
+  reused_cell_num_ = 0;
+  const auto grid_size = grid_ptr_->getGridSize();
+  for (size_t idx = 0; idx < grid_size; idx++) {
+    const Cell & cell = grid_ptr_->getCell(idx);
+    if (cell.is_prior_reused_) reused_cell_num_++;
+    // only the cells whose ground is measured in this frame
+    if (!cell.is_processed_ || !cell.has_ground_) continue;
+    float x, y;
+    grid_ptr_->getGroundPosition(cell, x, y);
+    ground_model_.emplace_back(x, y, cell.avg_height_);
+  }
 }
 
 // preprocess the grid data, set the grid connections
@@ -126,6 +168,29 @@ void GroundFilter::fitLineFromGndGrid(const std::vector<int> & idx, float & a, f
   }
 }
 
+// line through the ground of the previous cell and the prior of the cell, if the prior of the
+// previous cell agrees with its ground measured in the current frame
+bool GroundFilter::fitLineFromPrior(
+  const Cell & cell, const Cell & prev_cell, float & a, float & b) const
+{
+  if (!cell.has_prior_ || !prev_cell.has_prior_ || !prev_cell.has_ground_) return false;
+  // the previous cell must be the adjacent one, so that the chain is continuous
+  if (cell.radial_idx_ - prev_cell.radial_idx_ != 1) return false;
+  if (
+    std::abs(prev_cell.avg_height_ - prev_cell.prior_height_) >
+    param_.temporal_ground_model_height_tolerance) {
+    return false;
+  }
+  const float delta_radius = cell.prior_radius_ - prev_cell.avg_radius_;
+  if (delta_radius < 0.5f * cell.radial_size_) return false;
+
+  a = std::clamp(
+    (cell.prior_height_ - prev_cell.avg_height_) / delta_radius, -param_.global_slope_max_ratio,
+    param_.global_slope_max_ratio);
+  b = prev_cell.avg_height_ - a * prev_cell.avg_radius_;
+  return true;
+}
+
 // process the grid data to initialize the ground cells prior to the ground segmentation
 void GroundFilter::initializeGround(pcl::PointIndices & out_no_ground_indices)
 {
@@ -353,114 +418,170 @@ void GroundFilter::SegmentBreakCell(
   }
 }
 
-// classify the point cloud into ground and non-ground points
-void GroundFilter::classify(pcl::PointIndices & out_no_ground_indices)
+// recheck the ground points of a classified cell and update its ground information
+void GroundFilter::finalizeCell(
+  Cell & cell, const Cell & prev_cell, PointsCentroid & ground_bin,
+  pcl::PointIndices & out_no_ground_indices)
 {
-  std::unique_ptr<ScopedTimeTrack> st_ptr;
-  if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
+  // recheck ground bin
+  if (
+    param_.use_recheck_ground_cluster && cell.avg_radius_ > param_.grid_mode_switch_radius &&
+    ground_bin.getGroundPointNum() > 0) {
+    // recheck the ground cluster
+    float reference_height = 0;
+    if (param_.use_lowest_point) {
+      reference_height = ground_bin.getMinHeightOnly();
+    } else {
+      ground_bin.processAverage();
+      reference_height = ground_bin.getAverageHeight();
+    }
+    const float threshold = reference_height + param_.non_ground_height_threshold;
+    const std::vector<size_t> & gnd_indices = ground_bin.getIndicesRef();
+    const std::vector<float> & height_list = ground_bin.getHeightListRef();
+    for (size_t j = 0; j < height_list.size(); ++j) {
+      if (height_list.at(j) >= threshold) {
+        // fill the non-ground indices
+        out_no_ground_indices.indices.push_back(gnd_indices.at(j));
+        // mark the point as non-ground
+        ground_bin.is_ground_list.at(j) = false;
+      }
+    }
+  }
 
-  // loop over grid cells
-  const auto grid_size = grid_ptr_->getGridSize();
-  for (size_t idx = 0; idx < grid_size; idx++) {
-    auto & cell = grid_ptr_->getCell(idx);
-    // if the cell is empty, skip
-    if (cell.isEmpty()) continue;
-    if (cell.is_processed_) continue;
+  // finalize current cell, update the cell ground information
+  if (ground_bin.getGroundPointNum() > 0) {
+    ground_bin.processAverage();
+    cell.avg_height_ = ground_bin.getAverageHeight();
+    cell.avg_radius_ = ground_bin.getAverageRadius();
+    cell.max_height_ = ground_bin.getMaxHeight();
+    cell.min_height_ = ground_bin.getMinHeight();
+    cell.has_ground_ = true;
+  } else {
+    // copy previous cell
+    cell.avg_radius_ = prev_cell.avg_radius_;
+    cell.avg_height_ = prev_cell.avg_height_;
+    cell.max_height_ = prev_cell.max_height_;
+    cell.min_height_ = prev_cell.min_height_;
+    cell.has_ground_ = false;
+  }
 
-    // set a cell pointer for the previous cell
-    // check scan root grid
-    if (cell.scan_grid_root_idx_ < 0) continue;
-    const Cell & prev_cell = grid_ptr_->getCell(cell.scan_grid_root_idx_);
-    if (!(prev_cell.is_ground_initialized_)) continue;
-
-    // get current cell gradient and intercept
-    std::vector<int> grid_idcs;
-    {
-      const int search_count = param_.ground_grid_buffer_size;
-      const int check_cell_idx = cell.scan_grid_root_idx_;
-      recursiveSearch(check_cell_idx, search_count, grid_idcs);
+  cell.is_processed_ = true;
+}
+
+// classify the points of a cell, the cells on its radial chain must be classified beforehand
+void GroundFilter::classifyCell(Cell & cell, pcl::PointIndices & out_no_ground_indices)
+{
+  // if the cell is empty, skip
+  if (cell.isEmpty()) return;
+  if (cell.is_processed_) return;
+
+  // set a cell pointer for the previous cell
+  // check scan root grid
+  if (cell.scan_grid_root_idx_ < 0) return;
+  const Cell & prev_cell = grid_ptr_->getCell(cell.scan_grid_root_idx_);
+  if (!(prev_cell.is_ground_initialized_)) return;
+
+  // the ground of the previous frame replaces the search and the line fit where it agrees
+  if (param_.use_temporal_ground_model) {
+    float a, b;
+    if (fitLineFromPrior(cell, prev_cell, a, b)) {
+      cell.gradient_ = a;
+      cell.intercept_ = b;
+      cell.is_prior_reused_ = true;
+      PointsCentroid ground_bin;
+      SegmentContinuousCell(cell, ground_bin, out_no_ground_indices);
+      finalizeCell(cell, prev_cell, ground_bin, out_no_ground_indices);
+      return;
     }
+  }
+
+  // get current cell gradient and intercept
+  std::vector<int> grid_idcs;
+  {
+    const int search_count = param_.ground_grid_buffer_size;
+    const int check_cell_idx = cell.scan_grid_root_idx_;
+    recursiveSearch(check_cell_idx, search_count, grid_idcs);
+  }
 
-    // segment the ground and non-ground points
-    enum SegmentationMode { NONE, CONTINUOUS, DISCONTINUOUS, BREAK };
-    SegmentationMode mode = SegmentationMode::NONE;
-    {
-      const int front_radial_id =
-        grid_ptr_->getCell(grid_idcs.back()).radial_idx_ + grid_idcs.size();
-      const float radial_diff_between_cells = cell.center_radius_ - prev_cell.center_radius_;
-
-      if (radial_diff_between_cells < param_.ground_grid_continual_thresh * cell.radial_size_) {
-        if (cell.radial_idx_ - front_radial_id < param_.ground_grid_continual_thresh) {
-          mode = SegmentationMode::CONTINUOUS;
-        } else {
-          mode = SegmentationMode::DISCONTINUOUS;
-        }
+  // segment the ground and non-ground points
+  enum SegmentationMode { NONE, CONTINUOUS, DISCONTINUOUS, BREAK };
+  SegmentationMode mode = SegmentationMode::NONE;
+  {
+    const int front_radial_id =
+      grid_ptr_->getCell(grid_idcs.back()).radial_idx_ + grid_idcs.size();
+    const float radial_diff_between_cells = cell.center_radius_ - prev_cell.center_radius_;
+
+    if (radial_diff_between_cells < param_.ground_grid_continual_thresh * cell.radial_size_) {
+      if (cell.radial_idx_ - front_radial_id < param_.ground_grid_continual_thresh) {
+        mode = SegmentationMode::CONTINUOUS;
       } else {
-        mode = SegmentationMode::BREAK;
+        mode = SegmentationMode::DISCONTINUOUS;
       }
+    } else {
+      mode = SegmentationMode::BREAK;
     }
+  }
 
-    {
-      PointsCentroid ground_bin;
-      if (mode == SegmentationMode::CONTINUOUS) {
-        // calculate the gradient and intercept by least square method
-        float a, b;
-        fitLineFromGndGrid(grid_idcs, a, b);
-        cell.gradient_ = a;
-        cell.intercept_ = b;
-
-        SegmentContinuousCell(cell, ground_bin, out_no_ground_indices);
-      } else if (mode == SegmentationMode::DISCONTINUOUS) {
-        SegmentDiscontinuousCell(cell, ground_bin, out_no_ground_indices);
-      } else if (mode == SegmentationMode::BREAK) {
-        SegmentBreakCell(cell, ground_bin, out_no_ground_indices);
-      }
+  {
+    PointsCentroid ground_bin;
+    if (mode == SegmentationMode::CONTINUOUS) {
+      // calculate the gradient and intercept by least square method
+      float a, b;
+      fitLineFromGndGrid(grid_idcs, a, b);
+      cell.gradient_ = a;
+      cell.intercept_ = b;
+
+      SegmentContinuousCell(cell, ground_bin, out_no_ground_indices);
+    } else if (mode == SegmentationMode::DISCONTINUOUS) {
+      SegmentDiscontinuousCell(cell, ground_bin, out_no_ground_indices);
+    } else if (mode == SegmentationMode::BREAK) {
+      SegmentBreakCell(cell, ground_bin, out_no_ground_indices);
+    }
 
-      // recheck ground bin
-      if (
-        param_.use_recheck_ground_cluster && cell.avg_radius_ > param_.grid_mode_switch_radius &&
-        ground_bin.getGroundPointNum() > 0) {
-        // recheck the ground cluster
-        float reference_height = 0;
-        if (param_.use_lowest_point) {
-          reference_height = ground_bin.getMinHeightOnly();
-        } else {
-          ground_bin.processAverage();
-          reference_height = ground_bin.getAverageHeight();
-        }
-        const float threshold = reference_height + param_.non_ground_height_threshold;
-        const std::vector<size_t> & gnd_indices = ground_bin.getIndicesRef();
-        const std::vector<float> & height_list = ground_bin.getHeightListRef();
-        for (size_t j = 0; j < height_list.size(); ++j) {
-          if (height_list.at(j) >= threshold) {
-            // fill the non-ground indices
-            out_no_ground_indices.indices.push_back(gnd_indices.at(j));
-            // mark the point as non-ground
-            ground_bin.is_ground_list.at(j) = false;
-          }
-        }
-      }
+    finalizeCell(cell, prev_cell, ground_bin, out_no_ground_indices);
+  }
+}
 
-      // finalize current cell, update the cell ground information
-      if (ground_bin.getGroundPointNum() > 0) {
-        ground_bin.processAverage();
-        cell.avg_height_ = ground_bin.getAverageHeight();
-        cell.avg_radius_ = ground_bin.getAverageRadius();
-        cell.max_height_ = ground_bin.getMaxHeight();
-        cell.min_height_ = ground_bin.getMinHeight();
-        cell.has_ground_ = true;
-      } else {
-        // copy previous cell
-        cell.avg_radius_ = prev_cell.avg_radius_;
-        cell.avg_height_ = prev_cell.avg_height_;
-        cell.max_height_ = prev_cell.max_height_;
-        cell.min_height_ = prev_cell.min_height_;
-        cell.has_ground_ = false;
-      }
+// classify the point cloud into ground and non-ground points
+void GroundFilter::classify(pcl::PointIndices & out_no_ground_indices)
+{
+  std::unique_ptr<ScopedTimeTrack> st_ptr;
+  if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
+
+  const auto grid_size = grid_ptr_->getGridSize();
+  const size_t sector_num = grid_ptr_->getSectorNum();
+  if (param_.num_threads <= 1 || sector_num == 0) {
+    // loop over grid cells
+    for (size_t idx = 0; idx < grid_size; idx++) {
+      classifyCell(grid_ptr_->getCell(idx), out_no_ground_indices);
+    }
+    return;
+  }
 
-      cell.is_processed_ = true;
+  // the cells shared by all sectors are classified first
+  const size_t shared_cell_num = grid_ptr_->getSharedCellNum();
+  for (size_t idx = 0; idx < shared_cell_num; idx++) {
+    classifyCell(grid_ptr_->getCell(idx), out_no_ground_indices);
+  }
+
+  // a sector only reads its own cells and the shared cells, and writes its own output
+  sector_no_ground_indices_.resize(sector_num);
+#pragma omp parallel for schedule(dynamic) num_threads(param_.num_threads)
+  for (size_t sector = 0; sector < sector_num; ++sector) {
+    auto & sector_indices = sector_no_ground_indices_[sector];
+    sector_indices.indices.clear();
+    const size_t end = grid_ptr_->getSectorCellEnd(sector);
+    for (size_t pos = grid_ptr_->getSectorCellBegin(sector); pos < end; ++pos) {
+      classifyCell(grid_ptr_->getCell(grid_ptr_->getSectorCellIdx(pos)), sector_indices);
     }
   }
+
+  // merge in sector order, so the output does not depend on the thread scheduling
+  for (const auto & sector_indices : sector_no_ground_indices_) {
+    out_no_ground_indices.indices.insert(
+      out_no_ground_indices.indices.end(), sector_indices.indices.begin(),
+      sector_indices.indices.end());
+  }
 }
 
 // process the point cloud to segment the ground points
@@ -479,6 +600,11 @@ void GroundFilter::process(
   // reset grid cells
   grid_ptr_->resetCells();
 
+  // 0. project the ground of the previous frame
+  if (param_.use_temporal_ground_model) {
+    projectGroundModel();
+  }
+
   // 1. assign points to grid cells
   convert();
 
@@ -490,6 +616,11 @@ void GroundFilter::process(
 
   // 4. classify point cloud
   classify(out_no_ground_indices);
+
+  // 5. keep the ground for the next frame
+  if (param_.use_temporal_ground_model) {
+    storeGroundModel();
+  }
 }
 
 }  // namespace autoware::ground_filter
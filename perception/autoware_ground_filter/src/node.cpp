@@ -22,7 +22,6 @@
 #include <autoware_utils_math/unit_conversion.hpp>
 #include <autoware_utils_tf/transform_listener.hpp>
 #include <autoware_vehicle_info_utils/vehicle_info_utils.hpp>
-#include <pcl_ros/transforms.hpp>
 #include <rclcpp/rclcpp.hpp>
 
 #include <memory>
@@ -110,6 +109,16 @@ GroundFilterComponent::GroundFilterComponent(const rclcpp::NodeOptions & options
       static_cast<float>(rclcpp::Node::declare_parameter<double>("grid_mode_switch_radius"));
     ground_grid_buffer_size_ = rclcpp::Node::declare_parameter<int>("ground_grid_buffer_size");
     virtual_lidar_z_ = vehicle_info_.vehicle_height_m;
+    num_threads_ = rclcpp::Node::declare_parameter<int>("num_threads");
+    use_cell_lookup_table_ = rclcpp::Node::declare_parameter<bool>("use_cell_lookup_table");
+
+    // temporal ground model parameters
+    use_temporal_ground_model_ =
+      rclcpp::Node::declare_parameter<bool>("use_temporal_ground_model");
+    temporal_ground_model_frame_ =
+      rclcpp::Node::declare_parameter<std::string>("temporal_ground_model_frame");
+    temporal_ground_model_height_tolerance_ = static_cast<float>(
+      rclcpp::Node::declare_parameter<double>("temporal_ground_model_height_tolerance"));
 
     // initialize grid filter
     {
@@ -129,6 +138,10 @@ GroundFilterComponent::GroundFilterComponent(const rclcpp::NodeOptions & options
       param.virtual_lidar_x = vehicle_info_.wheel_base_m / 2.0f + center_pcl_shift_;
       param.virtual_lidar_y = 0.0f;
       param.virtual_lidar_z = virtual_lidar_z_;
+      param.num_threads = num_threads_;
+      param.use_cell_lookup_table = use_cell_lookup_table_;
+      param.use_temporal_ground_model = use_temporal_ground_model_;
+      param.temporal_ground_model_height_tolerance = temporal_ground_model_height_tolerance_;
 
       ground_filter_ptr_ = std::make_unique<GroundFilter>(param);
     }
@@ -164,6 +177,7 @@ GroundFilterComponent::GroundFilterComponent(const rclcpp::NodeOptions & options
   tf_input_frame_ = static_cast<std::string>(declare_parameter("input_frame", ""));
   tf_output_frame_ = static_cast<std::string>(declare_parameter("output_frame", ""));
   max_queue_size_ = static_cast<std::size_t>(declare_parameter("max_queue_size", 5));
+  process_latest_only_ = static_cast<bool>(declare_parameter("process_latest_only", true));
   use_indices_ = static_cast<bool>(declare_parameter("use_indices", false));
   latched_indices_ = static_cast<bool>(declare_parameter("latched_indices", false));
   approximate_sync_ = static_cast<bool>(declare_parameter("approximate_sync", false));
@@ -175,7 +189,8 @@ GroundFilterComponent::GroundFilterComponent(const rclcpp::NodeOptions & options
       << " - approximate_sync : " << (approximate_sync_ ? "true" : "false") << std::endl
       << " - use_indices      : " << (use_indices_ ? "true" : "false") << std::endl
       << " - latched_indices  : " << (latched_indices_ ? "true" : "false") << std::endl
-      << " - max_queue_size   : " << max_queue_size_);
+      << " - max_queue_size   : " << max_queue_size_ << std::endl
+      << " - process_latest_only : " << (process_latest_only_ ? "true" : "false"));
 
   // Set publisher
   {
@@ -226,11 +241,15 @@ void GroundFilterComponent::subscribe()
         std::placeholders::_2));
     }
   } else {
+    // the synchronized inputs above need their queues to match the clouds and the indices
     std::function<void(const sensor_msgs::msg::PointCloud2::ConstSharedPtr msg)> cb = std::bind(
       &GroundFilterComponent::faster_input_indices_callback, this, std::placeholders::_1,
       pcl_msgs::msg::PointIndices::ConstSharedPtr());
     sub_input_ = this->create_subscription<sensor_msgs::msg::PointCloud2>(
-      "input", rclcpp::SensorDataQoS().keep_last(max_queue_size_), cb);
+      "input",
+      rclcpp::SensorDataQoS().keep_last(
+        autoware::point_types::input_queue_depth(process_latest_only_, max_queue_size_)),
+      cb);
   }
 }
 
@@ -259,57 +278,39 @@ bool GroundFilterComponent::calculate_transform_matrix(
   return true;
 }
 
-bool GroundFilterComponent::convert_output_costly(
-  std::unique_ptr<sensor_msgs::msg::PointCloud2> & output)
+void GroundFilterComponent::updateFrameMotion(const sensor_msgs::msg::PointCloud2 & input)
 {
-  // In terms of performance, we should avoid using pcl_ros library function,
-  // but this code path isn't reached in the main use case of Autoware, so it's left as is for now.
-  if (!tf_output_frame_.empty() && output->header.frame_id != tf_output_frame_) {
-    RCLCPP_DEBUG(
-      this->get_logger(), "[convert_output_costly] Transforming output dataset from %s to %s.",
-      output->header.frame_id.c_str(), tf_output_frame_.c_str());
-
-    // Convert the cloud into the different frame
-    auto cloud_transformed = std::make_unique<sensor_msgs::msg::PointCloud2>();
-
-    auto tf_ptr = transform_listener_->get_transform(
-      tf_output_frame_, output->header.frame_id, output->header.stamp,
-      rclcpp::Duration::from_seconds(1.0));
-    if (!tf_ptr) {
-      RCLCPP_ERROR(
-        this->get_logger(),
-        "[convert_output_costly] Error converting output dataset from %s to %s.",
-        output->header.frame_id.c_str(), tf_output_frame_.c_str());
-      return false;
-    }
+  // the previous ground is not used after a gap in the input
+  constexpr double max_frame_interval_sec = 0.5;
 
-    auto eigen_tf = tf2::transformToEigen(*tf_ptr);
-    pcl_ros::transformPointCloud(eigen_tf.matrix().cast<float>(), *output, *cloud_transformed);
-    output = std::move(cloud_transformed);
+  auto tf_ptr = transform_listener_->get_transform(
+    temporal_ground_model_frame_, input.header.frame_id, input.header.stamp,
+    rclcpp::Duration::from_seconds(1.0));
+  if (!tf_ptr) {
+    RCLCPP_WARN_THROTTLE(
+      this->get_logger(), *this->get_clock(), 5000,
+      "[updateFrameMotion] Failed to get the pose of %s in %s, the ground model is reset.",
+      input.header.frame_id.c_str(), temporal_ground_model_frame_.c_str());
+    ground_filter_ptr_->resetGroundModel();
+    has_previous_input_pose_ = false;
+    return;
   }
+  const Eigen::Matrix4f input_pose = tf2::transformToEigen(*tf_ptr).matrix().cast<float>();
+  const rclcpp::Time input_stamp(input.header.stamp);
 
-  // Same as the comment above
-  if (tf_output_frame_.empty() && output->header.frame_id != tf_input_orig_frame_) {
-    // No tf_output_frame given, transform the dataset to its original frame
-    RCLCPP_DEBUG(
-      this->get_logger(), "[convert_output_costly] Transforming output dataset from %s back to %s.",
-      output->header.frame_id.c_str(), tf_input_orig_frame_.c_str());
-
-    auto cloud_transformed = std::make_unique<sensor_msgs::msg::PointCloud2>();
-
-    auto tf_ptr = transform_listener_->get_transform(
-      tf_input_orig_frame_, output->header.frame_id, output->header.stamp,
-      rclcpp::Duration::from_seconds(1.0));
-    if (!tf_ptr) {
-      return false;
-    }
-
-    auto eigen_tf = tf2::transformToEigen(*tf_ptr);
-    pcl_ros::transformPointCloud(eigen_tf.matrix().cast<float>(), *output, *cloud_transformed);
-    output = std::move(cloud_transformed);
+  if (
+    has_previous_input_pose_ && previous_input_frame_ == input.header.frame_id &&
+    input_stamp > previous_input_stamp_ &&
+    (input_stamp - previous_input_stamp_).seconds() < max_frame_interval_sec) {
+    ground_filter_ptr_->setFrameMotion(input_pose.inverse() * previous_input_pose_);
+  } else {
+    ground_filter_ptr_->resetGroundModel();
   }
 
-  return true;
+  previous_input_pose_ = input_pose;
+  previous_input_frame_ = input.header.frame_id;
+  previous_input_stamp_ = input_stamp;
+  has_previous_input_pose_ = true;
 }
 
 void GroundFilterComponent::faster_input_indices_callback(
@@ -368,6 +369,7 @@ void GroundFilterComponent::faster_input_indices_callback(
       cloud->width * cloud->height, cloud->header.frame_id.c_str());
   }
 
+  stage_latency_.enter(cloud->header.stamp, this->get_clock()->now().nanoseconds());
   tf_input_orig_frame_ = cloud->header.frame_id;
 
   // For performance reason, defer the transform computation.
@@ -375,6 +377,17 @@ void GroundFilterComponent::faster_input_indices_callback(
   TransformInfo transform_info;
   if (!calculate_transform_matrix(tf_input_frame_, *cloud, transform_info)) return;
 
+  // The input is processed in its own frame, the output transform is applied while the
+  // non-ground points are copied.
+  TransformInfo output_transform_info;
+  if (!calculate_transform_matrix(tf_output_frame_, *cloud, output_transform_info)) {
+    RCLCPP_ERROR(
+      this->get_logger(),
+      "[input_indices_callback] Error converting output dataset from %s to %s.",
+      cloud->header.frame_id.c_str(), tf_output_frame_.c_str());
+    return;
+  }
+
   // Need setInputCloud() here because we have to extract x/y/z
   pcl::IndicesPtr vindices;
   if (indices) {
@@ -384,11 +397,14 @@ void GroundFilterComponent::faster_input_indices_callback(
   auto output = std::make_unique<PointCloud2>();
 
   // TODO(sykwer): Change to `filter()` call after when the filter nodes conform to new API.
-  faster_filter(cloud, vindices, *output, transform_info);
-
-  if (!convert_output_costly(output)) return;
+  faster_filter(cloud, vindices, *output, transform_info, output_transform_info);
 
   output->header.stamp = cloud->header.stamp;
+  if (debug_publisher_ptr_) {
+    stage_latency_.exit();
+    debug_publisher_ptr_->publish<autoware_internal_debug_msgs::msg::Float64Stamped>(
+      "debug/pipeline_latency_ms", stage_latency_.end_to_end_latency_ms());
+  }
   pub_output_->publish(std::move(output));
   published_time_publisher_->publish_if_subscribed(pub_output_, cloud->header.stamp);
 }
@@ -581,7 +597,8 @@ void GroundFilterComponent::classifyPointCloud(
 
 void GroundFilterComponent::extractObjectPoints(
   const sensor_msgs::msg::PointCloud2::ConstSharedPtr & in_cloud_ptr,
-  const pcl::PointIndices & in_indices, sensor_msgs::msg::PointCloud2 & out_object_cloud) const
+  const pcl::PointIndices & in_indices, const TransformInfo & transform_info,
+  sensor_msgs::msg::PointCloud2 & out_object_cloud) const
 {
   std::unique_ptr<autoware_utils_debug::ScopedTimeTrack> st_ptr;
   if (time_keeper_)
@@ -589,10 +606,30 @@ void GroundFilterComponent::extractObjectPoints(
 
   size_t output_data_size = 0;
 
+  if (!transform_info.need_transform) {
+    for (const auto & idx : in_indices.indices) {
+      std::memcpy(
+        &out_object_cloud.data[output_data_size], &in_cloud_ptr->data[idx],
+        in_cloud_ptr->point_step * sizeof(uint8_t));
+      output_data_size += in_cloud_ptr->point_step;
+    }
+    return;
+  }
+
+  // copy the point and overwrite its coordinates, the other fields are kept as they are
+  const Eigen::Matrix3f rotation = transform_info.eigen_transform.block<3, 3>(0, 0);
+  const Eigen::Vector3f translation = transform_info.eigen_transform.block<3, 1>(0, 3);
   for (const auto & idx : in_indices.indices) {
     std::memcpy(
       &out_object_cloud.data[output_data_size], &in_cloud_ptr->data[idx],
       in_cloud_ptr->point_step * sizeof(uint8_t));
+    pcl::PointXYZ point;
+    data_accessor_.getPoint(in_cloud_ptr, idx, point);
+    const Eigen::Vector3f transformed =
+      rotation * Eigen::Vector3f(point.x, point.y, point.z) + translation;
+    data_accessor_.setPoint(
+      out_object_cloud, output_data_size,
+      pcl::PointXYZ(transformed.x(), transformed.y(), transformed.z()));
     output_data_size += in_cloud_ptr->point_step;
   }
 }
@@ -600,7 +637,8 @@ void GroundFilterComponent::extractObjectPoints(
 void GroundFilterComponent::faster_filter(
   const sensor_msgs::msg::PointCloud2::ConstSharedPtr & input,
   [[maybe_unused]] const pcl::IndicesPtr & indices, sensor_msgs::msg::PointCloud2 & output,
-  [[maybe_unused]] const TransformInfo & transform_info)
+  [[maybe_unused]] const TransformInfo & transform_info,
+  const TransformInfo & output_transform_info)
 {
   std::unique_ptr<autoware_utils_debug::ScopedTimeTrack> st_ptr;
   if (time_keeper_)
@@ -618,6 +656,7 @@ void GroundFilterComponent::faster_filter(
   pcl::PointIndices no_ground_indices;
 
   if (elevation_grid_mode_) {
+    if (use_temporal_ground_model_) updateFrameMotion(*input);
     ground_filter_ptr_->process(input, no_ground_indices);
   } else {
     std::vector<PointCloudVector> radial_ordered_points;
@@ -633,8 +672,11 @@ void GroundFilterComponent::faster_filter(
   output.is_bigendian = input->is_bigendian;
   output.point_step = input->point_step;
   output.header = input->header;
+  if (output_transform_info.need_transform) {
+    output.header.frame_id = tf_output_frame_;
+  }
 
-  extractObjectPoints(input, no_ground_indices, output);
+  extractObjectPoints(input, no_ground_indices, output_transform_info, output);
   if (debug_publisher_ptr_ && stop_watch_ptr_) {
     const double cyclic_time_ms = stop_watch_ptr_->toc("cyclic_time", true);
     const double processing_time_ms = stop_watch_ptr_->toc("processing_time", true);
@@ -642,6 +684,10 @@ void GroundFilterComponent::faster_filter(
       "debug/cyclic_time_ms", cyclic_time_ms);
     debug_publisher_ptr_->publish<autoware_internal_debug_msgs::msg::Float64Stamped>(
       "debug/processing_time_ms", processing_time_ms);
+    if (elevation_grid_mode_ && use_temporal_ground_model_) {
+      debug_publisher_ptr_->publish<autoware_internal_debug_msgs::msg::Float64Stamped>(
+        "debug/reused_cell_num", static_cast<double>(ground_filter_ptr_->getReusedCellNum()));
+    }
   }
 }
 
@@ -17,17 +17,17 @@
 #include "detected_to_predicted_objects_converter.hpp"
 
 #include <boost/uuid/uuid.hpp>
-#include <boost/uuid/uuid_generators.hpp>
-#include <boost/uuid/uuid_io.hpp>
 
 #include <algorithm>
 #include <memory>
+#include <utility>
 
 namespace autoware::perception_objects_converter
 {
 DetectedToPredictedObjectsConverter::DetectedToPredictedObjectsConverter(
   const rclcpp::NodeOptions & options)
-: rclcpp::Node("detected_to_predicted_objects_converter", options)
+: rclcpp::Node("detected_to_predicted_objects_converter", options),
+  use_intra_process_(options.use_intra_process_comms())
 {
   detected_objects_sub_ = create_subscription<autoware_perception_msgs::msg::DetectedObjects>(
     "input/detected_objects", rclcpp::QoS{10},
@@ -40,10 +40,9 @@ DetectedToPredictedObjectsConverter::DetectedToPredictedObjectsConverter(
 }
 
 // Convert Boost UUID to unique_identifier_msgs::msg::UUID
-unique_identifier_msgs::msg::UUID generateUUIDMsg()
+unique_identifier_msgs::msg::UUID DetectedToPredictedObjectsConverter::generate_uuid_msg()
 {
-  boost::uuids::random_generator gen;
-  boost::uuids::uuid uuid = gen();
+  const boost::uuids::uuid uuid = uuid_generator_();
 
   unique_identifier_msgs::msg::UUID uuid_msg;
   std::copy(uuid.begin(), uuid.end(), uuid_msg.uuid.begin());
@@ -52,46 +51,57 @@ unique_identifier_msgs::msg::UUID generateUUIDMsg()
 }
 
 void DetectedToPredictedObjectsConverter::detected_objects_callback(
-  const autoware_perception_msgs::msg::DetectedObjects::SharedPtr detected_objects_msg)
+  autoware_perception_msgs::msg::DetectedObjects::UniquePtr detected_objects_msg)
 {
-  auto predicted_objects_msg = std::make_unique<autoware_perception_msgs::msg::PredictedObjects>();
+  // NOTE: the input message is owned by this callback, so its variable-size fields are moved
+  auto & predicted_objects_msg = predicted_objects_buffer_;
+  predicted_objects_msg.objects.reserve(prev_objects_size_);
 
   // Copy header
-  predicted_objects_msg->header = detected_objects_msg->header;
+  predicted_objects_msg.header = detected_objects_msg->header;
 
   // Convert each detected object to predicted object
-  for (const auto & detected_object : detected_objects_msg->objects) {
-    autoware_perception_msgs::msg::PredictedObject predicted_object;
+  predicted_objects_msg.objects.resize(detected_objects_msg->objects.size());
+  for (size_t i = 0; i < detected_objects_msg->objects.size(); ++i) {
+    auto & detected_object = detected_objects_msg->objects[i];
+    auto & predicted_object = predicted_objects_msg.objects[i];
 
     // Generate UUID for the object using Boost
-    predicted_object.object_id = generateUUIDMsg();
+    predicted_object.object_id = generate_uuid_msg();
 
-    // Copy fields from detected object
+    // Move fields from detected object
     predicted_object.existence_probability = detected_object.existence_probability;
-    predicted_object.classification = detected_object.classification;
-    predicted_object.shape = detected_object.shape;
+    predicted_object.classification = std::move(detected_object.classification);
+    predicted_object.shape = std::move(detected_object.shape);
 
     // Convert kinematics
-    autoware_perception_msgs::msg::PredictedObjectKinematics predicted_kinematics;
+    auto & predicted_kinematics = predicted_object.kinematics;
     predicted_kinematics.initial_pose_with_covariance =
       detected_object.kinematics.pose_with_covariance;
-
-    if (detected_object.kinematics.has_twist) {
-      predicted_kinematics.initial_twist_with_covariance =
-        detected_object.kinematics.twist_with_covariance;
-    }
+    predicted_kinematics.initial_twist_with_covariance =
+      detected_object.kinematics.has_twist
+        ? detected_object.kinematics.twist_with_covariance
+        : geometry_msgs::msg::TwistWithCovariance{};
 
     // Note: Acceleration and predicted paths would typically be empty or set to default values
     // as they are not available in the DetectedObject message
-
-    predicted_object.kinematics = predicted_kinematics;
-
-    // Add to objects array
-    predicted_objects_msg->objects.push_back(predicted_object);
+    predicted_kinematics.initial_acceleration_with_covariance =
+      geometry_msgs::msg::AccelWithCovariance{};
+    predicted_kinematics.predicted_paths.clear();
   }
+  prev_objects_size_ = predicted_objects_msg.objects.size();
 
   // Publish the converted message
-  predicted_objects_pub_->publish(*predicted_objects_msg);
+  if (use_intra_process_) {
+    // hand the buffer over to the subscribers in the same process, a const reference would be
+    // copied for them
+    predicted_objects_pub_->publish(
+      std::make_unique<autoware_perception_msgs::msg::PredictedObjects>(
+        std::move(predicted_objects_buffer_)));
+    predicted_objects_buffer_ = autoware_perception_msgs::msg::PredictedObjects{};
+  } else {
+    predicted_objects_pub_->publish(predicted_objects_buffer_);
+  }
 }
 }  // namespace autoware::perception_objects_converter
 
@@ -23,6 +23,8 @@
 #include <autoware_perception_msgs/msg/predicted_objects.hpp>
 #include <unique_identifier_msgs/msg/uuid.hpp>
 
+#include <boost/uuid/random_generator.hpp>
+
 #include <string>
 
 namespace autoware::perception_objects_converter
@@ -34,12 +36,22 @@ public:
 
 private:
   void detected_objects_callback(
-    const autoware_perception_msgs::msg::DetectedObjects::SharedPtr detected_objects_msg);
+    autoware_perception_msgs::msg::DetectedObjects::UniquePtr detected_objects_msg);
+
+  unique_identifier_msgs::msg::UUID generate_uuid_msg();
 
   rclcpp::Subscription<autoware_perception_msgs::msg::DetectedObjects>::SharedPtr
     detected_objects_sub_;
   rclcpp::Publisher<autoware_perception_msgs::msg::PredictedObjects>::SharedPtr
     predicted_objects_pub_;
+
+  // seeded once, since seeding it for every object reads the system entropy source
+  boost::uuids::random_generator uuid_generator_;
+
+  // reused across callbacks to keep the capacity of the objects and their fields
+  autoware_perception_msgs::msg::PredictedObjects predicted_objects_buffer_;
+  size_t prev_objects_size_{0};
+  bool use_intra_process_{false};
 };
 }  // namespace autoware::perception_objects_converter
 
@@ -39,6 +39,8 @@
 #include <lanelet2_core/geometry/Lanelet.h>
 
 #include <limits>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 namespace autoware::mission_planner::lanelet2
@@ -87,6 +89,14 @@ void DefaultPlanner::initialize_common(rclcpp::Node * node)
   param_.consider_no_drivable_lanes = node_->declare_parameter<bool>("consider_no_drivable_lanes");
   param_.check_footprint_inside_lanes =
     node_->declare_parameter<bool>("check_footprint_inside_lanes");
+  param_.route_search_algorithm = node_->declare_parameter<std::string>("route_search_algorithm");
+  if (param_.route_search_algorithm == "dijkstra") {
+    route_handler_.setRouteSearchAlgorithm(route_handler::RouteSearchAlgorithm::DIJKSTRA);
+  } else if (param_.route_search_algorithm == "astar") {
+    route_handler_.setRouteSearchAlgorithm(route_handler::RouteSearchAlgorithm::ASTAR);
+  } else {
+    throw std::invalid_argument("unknown route_search_algorithm: " + param_.route_search_algorithm);
+  }
 }
 
 void DefaultPlanner::initialize(rclcpp::Node * node)
@@ -111,6 +121,7 @@ bool DefaultPlanner::ready() const
 void DefaultPlanner::map_callback(const LaneletMapBin::ConstSharedPtr msg)
 {
   route_handler_.setMap(*msg);
+  lane_polygons_near_goal_.clear();
   is_graph_ready_ = true;
 }
 
@@ -190,6 +201,25 @@ visualization_msgs::msg::MarkerArray DefaultPlanner::visualize_debug_footprint(
 bool DefaultPlanner::check_goal_footprint_inside_lanes(
   const lanelet::ConstLanelets & lanelets_near_goal,
   const autoware_utils::Polygon2d & goal_footprint) const
+{
+  return boost::geometry::covered_by(goal_footprint, create_lane_polygon(lanelets_near_goal));
+}
+
+std::vector<bool> DefaultPlanner::check_goal_footprints_inside_lanes(
+  const lanelet::ConstLanelets & lanelets_near_goal,
+  const std::vector<autoware_utils::Polygon2d> & goal_footprints) const
+{
+  const auto lane_polygon = create_lane_polygon(lanelets_near_goal);
+  std::vector<bool> is_inside_lanes;
+  is_inside_lanes.reserve(goal_footprints.size());
+  for (const auto & goal_footprint : goal_footprints) {
+    is_inside_lanes.push_back(boost::geometry::covered_by(goal_footprint, lane_polygon));
+  }
+  return is_inside_lanes;
+}
+
+lanelet::BasicPolygon2d DefaultPlanner::create_lane_polygon(
+  const lanelet::ConstLanelets & lanelets_near_goal) const
 {
   lanelet::Points3d left_bound_points;
   lanelet::Points3d right_bound_points;
@@ -223,8 +253,31 @@ bool DefaultPlanner::check_goal_footprint_inside_lanes(
       .polygon2d()
       .basicPolygon();
   boost::geometry::correct(lane_polygon);
+  return lane_polygon;
+}
+
+const lanelet::BasicPolygon2d & DefaultPlanner::get_lane_polygon_near_goal(
+  const lanelet::ConstLanelet & closest_lanelet_to_goal)
+{
+  if (const auto it = lane_polygons_near_goal_.find(closest_lanelet_to_goal.id());
+      it != lane_polygons_near_goal_.end()) {
+    return it->second;
+  }
+
+  // If the goal is at the very beginning or the end of closest_lanelet_to_goal, base link to rear
+  // part of ego footprint will be outside of it. To tolerate it, add previous and next lanelets
+  lanelet::ConstLanelets lanelets_near_goal{closest_lanelet_to_goal};
+  const auto previous_lanelets = get_lanelets_to(
+    closest_lanelet_to_goal, vehicle_info_.max_longitudinal_offset_m, true, route_handler_);
+  lanelets_near_goal.insert(
+    lanelets_near_goal.begin(), previous_lanelets.begin(), previous_lanelets.end());
+  const auto next_lanelets = get_lanelets_to(
+    closest_lanelet_to_goal, vehicle_info_.max_longitudinal_offset_m, false, route_handler_);
+  lanelets_near_goal.insert(lanelets_near_goal.end(), next_lanelets.begin(), next_lanelets.end());
 
-  return boost::geometry::covered_by(goal_footprint, lane_polygon);
+  return lane_polygons_near_goal_
+    .emplace(closest_lanelet_to_goal.id(), create_lane_polygon(lanelets_near_goal))
+    .first->second;
 }
 
 bool DefaultPlanner::is_goal_valid(const geometry_msgs::msg::Pose & goal)
@@ -270,27 +323,19 @@ bool DefaultPlanner::is_goal_valid(const geometry_msgs::msg::Pose & goal)
     if (!closest_road_lanelet_found) return false;
   }
 
-  // If the goal is at the very beginning or the end of closest_lanelet_to_goal, base link to rear
-  // part of ego footprint will be outside of it. To tolerate it, add previous and next lanelets
-  lanelet::ConstLanelets lanelets_near_goal{closest_lanelet_to_goal};
-  const auto previous_lanelets = get_lanelets_to(
-    closest_lanelet_to_goal, vehicle_info_.max_longitudinal_offset_m, true, route_handler_);
-  lanelets_near_goal.insert(
-    lanelets_near_goal.begin(), previous_lanelets.begin(), previous_lanelets.end());
-  const auto next_lanelets = get_lanelets_to(
-    closest_lanelet_to_goal, vehicle_info_.max_longitudinal_offset_m, false, route_handler_);
-  lanelets_near_goal.insert(lanelets_near_goal.end(), next_lanelets.begin(), next_lanelets.end());
-
   const auto local_vehicle_footprint = vehicle_info_.createFootprint();
   autoware_utils::LinearRing2d goal_footprint =
     autoware_utils::transform_vector(local_vehicle_footprint, autoware_utils::pose2transform(goal));
-  pub_goal_footprint_marker_->publish(visualize_debug_footprint(goal_footprint));
+  if (pub_goal_footprint_marker_->get_subscription_count() > 0) {
+    pub_goal_footprint_marker_->publish(visualize_debug_footprint(goal_footprint));
+  }
   const auto polygon_footprint = convert_linear_ring_to_polygon(goal_footprint);
 
   // check if goal footprint exceeds lane when the goal isn't in parking_lot
   if (
     param_.check_footprint_inside_lanes &&
-    !check_goal_footprint_inside_lanes(lanelets_near_goal, polygon_footprint) &&
+    !boost::geometry::covered_by(
+      polygon_footprint, get_lane_polygon_near_goal(closest_lanelet_to_goal)) &&
     !is_in_parking_lot(
       lanelet::utils::query::getAllParkingLots(route_handler_.getLaneletMapPtr()),
       lanelet::utils::conversion::toLaneletPoint(goal.position))) {
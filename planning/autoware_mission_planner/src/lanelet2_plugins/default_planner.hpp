@@ -28,6 +28,8 @@
 #include <lanelet2_routing/RoutingGraph.h>
 #include <lanelet2_traffic_rules/TrafficRulesFactory.h>
 
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace autoware::mission_planner::lanelet2
@@ -38,6 +40,7 @@ struct DefaultPlannerParameters
   bool enable_correct_goal_pose;
   bool consider_no_drivable_lanes;
   bool check_footprint_inside_lanes;
+  std::string route_search_algorithm;
 };
 
 class DefaultPlanner : public mission_planner::PlannerPlugin
@@ -85,6 +88,30 @@ protected:
     const lanelet::ConstLanelets & lanelets_near_goal,
     const autoware_utils::Polygon2d & goal_footprint) const;
 
+  /**
+   * @brief same as check_goal_footprint_inside_lanes for each of goal_footprints, with the lane
+   * polygon built once
+   */
+  [[nodiscard]] std::vector<bool> check_goal_footprints_inside_lanes(
+    const lanelet::ConstLanelets & lanelets_near_goal,
+    const std::vector<autoware_utils::Polygon2d> & goal_footprints) const;
+
+  /**
+   * @brief polygon of the lanelets near the goal, whose left and right bounds are extended to the
+   * shoulder lanelets if any
+   */
+  [[nodiscard]] lanelet::BasicPolygon2d create_lane_polygon(
+    const lanelet::ConstLanelets & lanelets_near_goal) const;
+
+  /**
+   * @brief lane polygon of the lanelets near the goal on closest_lanelet_to_goal, i.e. itself and
+   * its previous and next lanelets within the vehicle longitudinal offset, cached per lanelet until
+   * the map changes
+   */
+  const lanelet::BasicPolygon2d & get_lane_polygon_near_goal(
+    const lanelet::ConstLanelet & closest_lanelet_to_goal);
+  std::unordered_map<lanelet::Id, lanelet::BasicPolygon2d> lane_polygons_near_goal_;
+
   /**
    * @brief return true if (1)the goal is in parking area or (2)the goal is on the lanes and the
    * footprint around the goal does not overlap the lanes
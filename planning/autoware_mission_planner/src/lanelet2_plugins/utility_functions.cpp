@@ -137,7 +137,10 @@ geometry_msgs::msg::Pose get_closest_centerline_pose(
     return point;
   }
 
+  // The refined centerline is set to a copy of the lanelet, since the map is shared
   const auto refined_center_line = lanelet::utils::generateFineCenterline(closest_lanelet, 1.0);
+  closest_lanelet = lanelet::Lanelet(
+    closest_lanelet.id(), closest_lanelet.leftBound(), closest_lanelet.rightBound());
   closest_lanelet.setCenterline(refined_center_line);
 
   const double lane_yaw = lanelet::utils::getLaneletAngle(closest_lanelet, point.position);
@@ -16,10 +16,12 @@
 
 #include "service_utils.hpp"
 
+#include <autoware/lanelet2_utils/map_registry.hpp>
 #include <autoware_lanelet2_extension/utility/message_conversion.hpp>
 #include <autoware_lanelet2_extension/utility/query.hpp>
 #include <autoware_lanelet2_extension/utility/route_checker.hpp>
 #include <autoware_lanelet2_extension/utility/utilities.hpp>
+#include <autoware_utils_geometry/geometry.hpp>
 
 #include <autoware_map_msgs/msg/lanelet_map_bin.hpp>
 #include <tf2_geometry_msgs/tf2_geometry_msgs.hpp>
@@ -27,7 +29,10 @@
 #include <lanelet2_core/geometry/LineString.h>
 
 #include <algorithm>
+#include <functional>
+#include <iterator>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -52,6 +57,7 @@ MissionPlanner::MissionPlanner(const rclcpp::NodeOptions & options)
   reroute_time_threshold_ = declare_parameter<double>("reroute_time_threshold");
   minimum_reroute_length_ = declare_parameter<double>("minimum_reroute_length");
   allow_reroute_in_autonomous_mode_ = declare_parameter<bool>("allow_reroute_in_autonomous_mode");
+  reuse_route_prefix_on_reroute_ = declare_parameter<bool>("reuse_route_prefix_on_reroute");
 
   planner_ =
     plugin_loader_.createSharedInstance("autoware::mission_planner::lanelet2::DefaultPlanner");
@@ -86,6 +92,7 @@ MissionPlanner::MissionPlanner(const rclcpp::NodeOptions & options)
   const auto period = rclcpp::Rate(10).period();
   data_check_timer_ = create_wall_timer(period, [this] { check_initialization(); });
   is_mission_planner_ready_ = false;
+  marker_timer_ = create_wall_timer(period, [this] { publish_route_marker(); });
 
   logger_configure_ = std::make_unique<autoware_utils_logging::LoggerLevelConfigure>(this);
   pub_processing_time_ = this->create_publisher<autoware_internal_debug_msgs::msg::Float64Stamped>(
@@ -136,6 +143,15 @@ void MissionPlanner::check_initialization()
   data_check_timer_ = nullptr;
 }
 
+void MissionPlanner::publish_route_marker()
+{
+  if (!is_route_marker_outdated_ || !current_route_ || pub_marker_->get_subscription_count() == 0) {
+    return;
+  }
+  pub_marker_->publish(planner_->visualize(*current_route_));
+  is_route_marker_outdated_ = false;
+}
+
 void MissionPlanner::on_odometry(const Odometry::ConstSharedPtr msg)
 {
   odometry_ = msg;
@@ -159,8 +175,8 @@ void MissionPlanner::on_operation_mode_state(const OperationModeState::ConstShar
 void MissionPlanner::on_map(const LaneletMapBin::ConstSharedPtr msg)
 {
   map_ptr_ = msg;
-  lanelet_map_ptr_ = std::make_shared<lanelet::LaneletMap>();
-  lanelet::utils::conversion::fromBinMsg(*map_ptr_, lanelet_map_ptr_);
+  lanelet_map_ptr_ =
+    autoware::experimental::lanelet2_utils::get_shared_lanelet_map(*map_ptr_).lanelet_map;
 }
 
 Pose MissionPlanner::transform_pose(const Pose & pose, const Header & header)
@@ -276,7 +292,16 @@ void MissionPlanner::on_set_waypoint_route(
                           : false;
 
   change_state(is_reroute ? RouteState::REROUTING : RouteState::ROUTING);
-  const auto route = create_route(*req);
+  const auto route = std::invoke([&]() {
+    if (is_reroute && reuse_route_prefix_on_reroute_) {
+      if (const auto spliced_route = create_spliced_route(*req)) {
+        return *spliced_route;
+      }
+      cancel_route();
+      RCLCPP_INFO(get_logger(), "Failed to splice the reroute, plan the whole route instead.");
+    }
+    return create_route(*req);
+  });
 
   if (route.segments.empty()) {
     cancel_route();
@@ -323,7 +348,7 @@ void MissionPlanner::change_route(const LaneletRoute & route)
   arrival_checker_.set_goal(goal);
 
   pub_route_->publish(route);
-  pub_marker_->publish(planner_->visualize(route));
+  is_route_marker_outdated_ = true;
 }
 
 void MissionPlanner::cancel_route()
@@ -391,6 +416,82 @@ LaneletRoute MissionPlanner::create_route(
   return route;
 }
 
+std::optional<LaneletRoute> MissionPlanner::create_spliced_route(
+  const SetWaypointRoute::Request & req)
+{
+  if (!current_route_ || current_route_->segments.empty() || !lanelet_map_ptr_ || !odometry_) {
+    return std::nullopt;
+  }
+  const auto & ego_pose = odometry_->pose.pose;
+  const auto & segments = current_route_->segments;
+  const auto get_lanelet = [&](const lanelet::Id id) {
+    return lanelet_map_ptr_->laneletLayer.get(id);
+  };
+  const auto get_preferred_lanelet = [&](const LaneletSegment & segment) {
+    return get_lanelet(segment.preferred_primitive.id);
+  };
+
+  // the section of ego in the current route
+  const auto ego_segment = std::find_if(segments.begin(), segments.end(), [&](const auto & s) {
+    return std::any_of(s.primitives.begin(), s.primitives.end(), [&](const auto & primitive) {
+      return lanelet::utils::isInLanelet(ego_pose, get_lanelet(primitive.id));
+    });
+  });
+  if (ego_segment == segments.end()) {
+    return std::nullopt;
+  }
+
+  // keep the sections which ego reaches within the safety length, like check_reroute_safety,
+  // and splice the new route on the middle of the preferred lanelet of the next section
+  const double splice_length = std::max(
+    odometry_->twist.twist.linear.x * reroute_time_threshold_, minimum_reroute_length_);
+  const auto ego_lanelet = get_preferred_lanelet(*ego_segment);
+  const auto ego_arc_coordinates = lanelet::utils::getArcCoordinates({ego_lanelet}, ego_pose);
+  double accumulated_length =
+    lanelet::utils::getLaneletLength2d(ego_lanelet) - ego_arc_coordinates.length;
+  auto splice_segment = std::next(ego_segment);
+  for (; splice_segment != segments.end() && accumulated_length <= splice_length;
+       ++splice_segment) {
+    const auto lanelet = get_preferred_lanelet(*splice_segment);
+    accumulated_length += lanelet::utils::getLaneletLength2d(lanelet);
+  }
+  // the last section has the goal, which is not kept
+  if (splice_segment == segments.end() || std::next(splice_segment) == segments.end()) {
+    return std::nullopt;
+  }
+
+  const auto splice_lanelet = get_preferred_lanelet(*splice_segment);
+  const auto splice_centerline = lanelet::utils::to2D(splice_lanelet.centerline());
+  const auto splice_point = lanelet::geometry::interpolatedPointAtDistance(
+    splice_centerline, lanelet::geometry::length(splice_centerline) / 2.0);
+  Pose splice_pose;
+  splice_pose.position.x = splice_point.x();
+  splice_pose.position.y = splice_point.y();
+  splice_pose.position.z = splice_lanelet.centerline().front().z();
+  splice_pose.orientation = autoware_utils_geometry::create_quaternion_from_yaw(
+    lanelet::utils::getLaneletAngle(splice_lanelet, splice_pose.position));
+
+  auto route = create_route(
+    req.header, req.waypoints, splice_pose, req.goal_pose, req.uuid, req.allow_modification);
+  if (route.segments.empty()) {
+    return std::nullopt;
+  }
+  const auto & first_primitives = route.segments.front().primitives;
+  const bool is_spliced_on_route = std::any_of(
+    first_primitives.begin(), first_primitives.end(),
+    [&](const auto & primitive) { return primitive.id == splice_lanelet.id(); });
+  if (!is_spliced_on_route) {
+    return std::nullopt;
+  }
+
+  route.segments.insert(route.segments.begin(), ego_segment, splice_segment);
+  if (route_handler::RouteHandler::isRouteLooped(route.segments)) {
+    return std::nullopt;
+  }
+  route.start_pose = ego_pose;
+  return route;
+}
+
 bool MissionPlanner::check_reroute_safety(
   const LaneletRoute & original_route, const LaneletRoute & target_route)
 {
@@ -37,6 +37,7 @@
 #include <tf2_ros/transform_listener.h>
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -124,11 +125,17 @@ private:
   LaneletRoute create_route(
     const Header & header, const std::vector<Pose> & waypoints, const Pose & start_pose,
     const Pose & goal_pose, const UUID & uuid, const bool allow_goal_modification);
+  std::optional<LaneletRoute> create_spliced_route(const SetWaypointRoute::Request & req);
 
   void publish_pose_log(const Pose & pose, const std::string & pose_type);
 
   rclcpp::TimerBase::SharedPtr data_check_timer_;
   void check_initialization();
+
+  // the route marker is built off the route setting, when the route changed and it is subscribed
+  rclcpp::TimerBase::SharedPtr marker_timer_;
+  bool is_route_marker_outdated_{false};
+  void publish_route_marker();
   bool is_mission_planner_ready_;
 
   double reroute_time_threshold_;
@@ -136,6 +143,8 @@ private:
   // flag to allow reroute in autonomous driving mode.
   // if false, reroute fails. if true, only safe reroute is allowed.
   bool allow_reroute_in_autonomous_mode_;
+  // if true, reroute keeps the current route within the safety length and plans the rest only
+  bool reuse_route_prefix_on_reroute_;
   bool check_reroute_safety(const LaneletRoute & original_route, const LaneletRoute & target_route);
 
   std::unique_ptr<autoware_utils_logging::LoggerLevelConfigure> logger_configure_;
@@ -0,0 +1,267 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Scaling of the map load, the routing graph build, the route planning and the topology queries
+// with the size of synthesized maps: grid cities of N x N blocks and highways of N segments of
+// 100 m. The maps are written as OSM files and loaded like Lanelet2MapLoaderNode does with the
+// local projector, and the route is planned across the whole map.
+
+#include "../src/lanelet2_plugins/default_planner.hpp"
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <autoware/lanelet2_utils/centerline.hpp>
+#include <autoware/lanelet2_utils/topology.hpp>
+#include <autoware/map_loader/lanelet2_map_loader_node.hpp>
+#include <autoware/route_handler/route_handler.hpp>
+#include <autoware_test_utils/autoware_test_utils.hpp>
+#include <autoware_test_utils/synthetic_lanelet_map.hpp>
+
+#include <autoware_map_msgs/msg/map_projector_info.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+using autoware::map_loader::Lanelet2MapLoaderNode;
+using autoware::mission_planner::lanelet2::DefaultPlanner;
+using autoware::route_handler::RouteHandler;
+using autoware_map_msgs::msg::LaneletMapBin;
+using autoware_map_msgs::msg::MapProjectorInfo;
+using geometry_msgs::msg::Pose;
+
+constexpr double block_length = 100.0;
+constexpr double segment_length = 100.0;
+constexpr size_t highway_lane_num = 3;
+constexpr double center_line_resolution = 5.0;
+
+enum class MapType { GRID, HIGHWAY };
+
+struct Fixture
+{
+  std::string map_path;
+  LaneletMapBin::ConstSharedPtr map_bin_msg;
+  std::shared_ptr<RouteHandler> route_handler;
+  std::shared_ptr<rclcpp::Node> node;
+  std::shared_ptr<DefaultPlanner> planner;
+  Pose start_pose;
+  Pose goal_pose;
+};
+
+MapProjectorInfo local_projector_info()
+{
+  MapProjectorInfo projector_info;
+  projector_info.projector_type = MapProjectorInfo::LOCAL;
+  return projector_info;
+}
+
+// the same steps as Lanelet2MapLoaderNode for a map without custom centerlines
+LaneletMapBin load_map_bin_msg(const std::string & map_path)
+{
+  const auto map = Lanelet2MapLoaderNode::load_map(map_path, local_projector_info());
+  autoware::experimental::lanelet2_utils::overwrite_lanelets_centerline(
+    map, center_line_resolution, false);
+  return Lanelet2MapLoaderNode::create_map_bin_msg(map, map_path, rclcpp::Time{});
+}
+
+const Fixture & get_fixture(const MapType map_type, const size_t size)
+{
+  static std::map<std::pair<MapType, size_t>, Fixture> fixtures;
+  const auto key = std::make_pair(map_type, size);
+  if (const auto it = fixtures.find(key); it != fixtures.end()) {
+    return it->second;
+  }
+
+  Fixture f;
+  const auto params = autoware::test_utils::SyntheticLaneletMapParameters{};
+  const double w = params.lane_width;
+  const std::string name =
+    (map_type == MapType::GRID ? "grid_" : "highway_") + std::to_string(size);
+  f.map_path = (std::filesystem::temp_directory_path() / ("benchmark_" + name + ".osm")).string();
+  if (map_type == MapType::GRID) {
+    autoware::test_utils::write_lanelet_map(
+      *autoware::test_utils::make_grid_city_lanelet_map(size, block_length, params), f.map_path);
+    // from the south west corner to the north east one, on the eastbound lanes
+    const auto n = static_cast<double>(size);
+    f.start_pose = autoware::test_utils::createPose(4.0 * w, -w / 2.0, 0.0, 0.0, 0.0, 0.0);
+    f.goal_pose = autoware::test_utils::createPose(
+      (n - 0.5) * block_length, n * block_length - w / 2.0, 0.0, 0.0, 0.0, 0.0);
+  } else {
+    autoware::test_utils::write_lanelet_map(
+      *autoware::test_utils::make_highway_lanelet_map(
+        size, highway_lane_num, segment_length, params),
+      f.map_path);
+    // from the rightmost lane of the first segment to the leftmost lane of the last one
+    f.start_pose = autoware::test_utils::createPose(10.0, w / 2.0, 0.0, 0.0, 0.0, 0.0);
+    f.goal_pose = autoware::test_utils::createPose(
+      static_cast<double>(size) * segment_length - 10.0,
+      (static_cast<double>(highway_lane_num) - 0.5) * w, 0.0, 0.0, 0.0, 0.0);
+  }
+  f.map_bin_msg = std::make_shared<LaneletMapBin>(load_map_bin_msg(f.map_path));
+  f.route_handler = std::make_shared<RouteHandler>(*f.map_bin_msg);
+
+  const auto autoware_test_utils_dir =
+    ament_index_cpp::get_package_share_directory("autoware_test_utils");
+  const auto mission_planner_dir =
+    ament_index_cpp::get_package_share_directory("autoware_mission_planner");
+  const auto node_options = rclcpp::NodeOptions{}.arguments(
+    {"--ros-args", "--params-file",
+     autoware_test_utils_dir + "/config/test_vehicle_info.param.yaml", "--params-file",
+     mission_planner_dir + "/config/mission_planner.param.yaml"});
+  f.node = std::make_shared<rclcpp::Node>("benchmark_" + name, node_options);
+  f.planner = std::make_shared<DefaultPlanner>();
+  f.planner->initialize(f.node.get(), f.map_bin_msg);
+  return fixtures.emplace(key, std::move(f)).first->second;
+}
+
+void set_counters(benchmark::State & state, const Fixture & f)
+{
+  state.counters["lanelets"] =
+    static_cast<double>(f.route_handler->getLaneletMapPtr()->laneletLayer.size());
+}
+
+void load_map(benchmark::State & state, const MapType map_type)
+{
+  const auto & f = get_fixture(map_type, static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(load_map_bin_msg(f.map_path));
+  }
+  set_counters(state, f);
+}
+
+void build_routing_graph(benchmark::State & state, const MapType map_type)
+{
+  const auto & f = get_fixture(map_type, static_cast<size_t>(state.range(0)));
+  RouteHandler route_handler;
+  for (auto _ : state) {
+    route_handler.setMap(*f.map_bin_msg);
+    benchmark::DoNotOptimize(route_handler.getRoutingGraphPtr());
+  }
+  set_counters(state, f);
+}
+
+void plan_route(benchmark::State & state, const MapType map_type)
+{
+  const auto & f = get_fixture(map_type, static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    const auto route = f.planner->plan({f.start_pose, f.goal_pose});
+    if (route.segments.empty()) {
+      state.SkipWithError("failed to plan the route");
+      break;
+    }
+    benchmark::DoNotOptimize(route);
+  }
+  set_counters(state, f);
+}
+
+// the topology queries of all the lanelets of the map, per lanelet
+void query_topology(benchmark::State & state, const MapType map_type)
+{
+  const auto & f = get_fixture(map_type, static_cast<size_t>(state.range(0)));
+  const auto routing_graph = f.route_handler->getRoutingGraphPtr();
+  const lanelet::ConstLanelets lanelets(
+    f.route_handler->getLaneletMapPtr()->laneletLayer.begin(),
+    f.route_handler->getLaneletMapPtr()->laneletLayer.end());
+  for (auto _ : state) {
+    for (const auto & lanelet : lanelets) {
+      benchmark::DoNotOptimize(
+        autoware::experimental::lanelet2_utils::following_lanelets(lanelet, routing_graph));
+      benchmark::DoNotOptimize(
+        autoware::experimental::lanelet2_utils::previous_lanelets(lanelet, routing_graph));
+      benchmark::DoNotOptimize(
+        autoware::experimental::lanelet2_utils::left_lanelet(lanelet, routing_graph));
+      benchmark::DoNotOptimize(
+        autoware::experimental::lanelet2_utils::right_lanelet(lanelet, routing_graph));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(lanelets.size()));
+  set_counters(state, f);
+}
+
+// grid cities of N x N blocks
+void grid_sizes(benchmark::internal::Benchmark * bench)
+{
+  for (const int block_num : {5, 10, 20, 40}) {
+    bench->Arg(block_num);
+  }
+  bench->Unit(benchmark::kMillisecond);
+}
+
+// highways of N segments of 100 m
+void highway_lengths(benchmark::internal::Benchmark * bench)
+{
+  for (const int segment_num : {10, 100, 1000}) {
+    bench->Arg(segment_num);
+  }
+  bench->Unit(benchmark::kMillisecond);
+}
+
+void BM_LoadGridMap(benchmark::State & state)
+{
+  load_map(state, MapType::GRID);
+}
+void BM_LoadHighwayMap(benchmark::State & state)
+{
+  load_map(state, MapType::HIGHWAY);
+}
+void BM_BuildGridRoutingGraph(benchmark::State & state)
+{
+  build_routing_graph(state, MapType::GRID);
+}
+void BM_BuildHighwayRoutingGraph(benchmark::State & state)
+{
+  build_routing_graph(state, MapType::HIGHWAY);
+}
+void BM_PlanGridRoute(benchmark::State & state)
+{
+  plan_route(state, MapType::GRID);
+}
+void BM_PlanHighwayRoute(benchmark::State & state)
+{
+  plan_route(state, MapType::HIGHWAY);
+}
+void BM_QueryGridTopology(benchmark::State & state)
+{
+  query_topology(state, MapType::GRID);
+}
+void BM_QueryHighwayTopology(benchmark::State & state)
+{
+  query_topology(state, MapType::HIGHWAY);
+}
+}  // namespace
+
+BENCHMARK(BM_LoadGridMap)->Apply(grid_sizes);
+BENCHMARK(BM_BuildGridRoutingGraph)->Apply(grid_sizes);
+BENCHMARK(BM_PlanGridRoute)->Apply(grid_sizes);
+BENCHMARK(BM_QueryGridTopology)->Apply(grid_sizes);
+BENCHMARK(BM_LoadHighwayMap)->Apply(highway_lengths);
+BENCHMARK(BM_BuildHighwayRoutingGraph)->Apply(highway_lengths);
+BENCHMARK(BM_PlanHighwayRoute)->Apply(highway_lengths);
+BENCHMARK(BM_QueryHighwayTopology)->Apply(highway_lengths);
+
+int main(int argc, char ** argv)
+{
+  rclcpp::init(argc, argv);
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  rclcpp::shutdown();
+  return 0;
+}
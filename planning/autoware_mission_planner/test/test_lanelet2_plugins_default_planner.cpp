@@ -51,6 +51,12 @@ struct DefaultPlanner : public autoware::mission_planner::lanelet2::DefaultPlann
   {
     return check_goal_footprint_inside_lanes(lanelets_near_goal, goal_footprint);
   }
+  [[nodiscard]] std::vector<bool> check_goals_inside_lanes(
+    const lanelet::ConstLanelets & lanelets_near_goal,
+    const std::vector<autoware_utils::Polygon2d> & goal_footprints) const
+  {
+    return check_goal_footprints_inside_lanes(lanelets_near_goal, goal_footprints);
+  }
   bool is_goal_valid_wrapper(const geometry_msgs::msg::Pose & goal) { return is_goal_valid(goal); }
 
   lanelet::ConstLanelets get_lanelets_from_ids(const std::vector<lanelet::Id> & ids)
@@ -195,6 +201,38 @@ TEST_F(DefaultPlannerTest, checkGoalInsideLane)
   EXPECT_FALSE(planner_.check_goal_inside_lanes({goal_lanelet, next_lanelet}, goal_footprint));
 }
 
+TEST_F(DefaultPlannerTest, checkGoalsInsideLane)
+{
+  planner_.set_default_test_map();
+  lanelet::LineString3d left_bound;
+  lanelet::LineString3d right_bound;
+  left_bound.push_back(lanelet::Point3d{lanelet::InvalId, -1, -1});
+  left_bound.push_back(lanelet::Point3d{lanelet::InvalId, 1, -1});
+  right_bound.push_back(lanelet::Point3d{lanelet::InvalId, -1, 1});
+  right_bound.push_back(lanelet::Point3d{lanelet::InvalId, 1, 1});
+  const lanelet::ConstLanelets lanelets{
+    lanelet::ConstLanelet{lanelet::InvalId, left_bound, right_bound}};
+
+  // footprints of 1 m square shifted along x, the last two are out of the lane
+  std::vector<autoware_utils::Polygon2d> goal_footprints;
+  for (const double x : {-1.0, -0.5, 0.0, 0.5, 1.0}) {
+    autoware_utils::Polygon2d goal_footprint;
+    goal_footprint.outer().emplace_back(x, -0.5);
+    goal_footprint.outer().emplace_back(x, 0.5);
+    goal_footprint.outer().emplace_back(x + 1.0, 0.5);
+    goal_footprint.outer().emplace_back(x + 1.0, -0.5);
+    goal_footprint.outer().emplace_back(x, -0.5);
+    goal_footprints.push_back(goal_footprint);
+  }
+
+  const auto is_inside_lanes = planner_.check_goals_inside_lanes(lanelets, goal_footprints);
+  ASSERT_EQ(is_inside_lanes.size(), goal_footprints.size());
+  for (size_t i = 0; i < goal_footprints.size(); ++i) {
+    EXPECT_EQ(is_inside_lanes[i], planner_.check_goal_inside_lanes(lanelets, goal_footprints[i]));
+    EXPECT_EQ(is_inside_lanes[i], i < 3);
+  }
+}
+
 TEST_F(DefaultPlannerTest, isValidGoal)
 {
   planner_.set_default_test_map();
@@ -25,7 +25,9 @@
 #include <std_msgs/msg/color_rgba.hpp>
 #include <visualization_msgs/msg/marker_array.hpp>
 
+#include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace autoware::objects_of_interest_marker_interface
@@ -61,7 +63,8 @@ public:
     const std_msgs::msg::ColorRGBA & color);
 
   /**
-   * @brief Publish interest objects marker
+   * @brief Publish interest objects marker, and delete the markers of the objects which are not
+   * inserted anymore. The inserted object data is cleared even if the markers are not published.
    */
   void publishMarkerArray();
 
@@ -71,6 +74,12 @@ public:
    */
   void setHeightOffset(const double offset);
 
+  /**
+   * @brief Set minimum period between two publications of markers
+   * @param period Minimum period [s], markers are published on every call if it is 0
+   */
+  void setPublishPeriod(const double period);
+
   /**
    * @brief Get color data from color name
    * @param color_name Color name
@@ -90,10 +99,18 @@ public:
 
 private:
   rclcpp::Publisher<visualization_msgs::msg::MarkerArray>::SharedPtr pub_marker_;
+  rclcpp::Clock::SharedPtr clock_;
 
   double height_offset_{0.5};
+  double publish_period_{0.0};
+  std::optional<rclcpp::Time> last_publish_time_{};
   std::vector<ObjectMarkerData> obj_marker_data_array_;
 
+  // reused between the publications to keep its allocated memory
+  visualization_msgs::msg::MarkerArray marker_array_;
+  // namespaces and ids of the markers published last time
+  std::vector<std::pair<std::string, int32_t>> published_marker_ids_;
+
   std::string name_;
   std::string topic_namespace_ = "/planning/debug/objects_of_interest";
 };
@@ -14,7 +14,9 @@
 
 #include "autoware/objects_of_interest_marker_interface/objects_of_interest_marker_interface.hpp"
 
+#include <iterator>
 #include <string>
+#include <utility>
 
 namespace autoware::objects_of_interest_marker_interface
 {
@@ -26,7 +28,7 @@ using visualization_msgs::msg::MarkerArray;
 
 ObjectsOfInterestMarkerInterface::ObjectsOfInterestMarkerInterface(
   rclcpp::Node * node, const std::string & name)
-: name_{name}
+: clock_{node->get_clock()}, name_{name}
 {
   // Publisher
   pub_marker_ = node->create_publisher<MarkerArray>(topic_namespace_ + "/" + name, 1);
@@ -51,18 +53,46 @@ void ObjectsOfInterestMarkerInterface::insertObjectDataWithCustomColor(
 
 void ObjectsOfInterestMarkerInterface::publishMarkerArray()
 {
-  if (pub_marker_->get_subscription_count() == 0) {
+  const auto now = clock_->now();
+  const bool is_throttled =
+    last_publish_time_ && (now - *last_publish_time_).seconds() < publish_period_;
+  if (pub_marker_->get_subscription_count() == 0 || is_throttled) {
+    obj_marker_data_array_.clear();
     return;
   }
-  MarkerArray marker_array;
+  last_publish_time_ = now;
+
+  marker_array_.markers.clear();
   for (size_t i = 0; i < obj_marker_data_array_.size(); ++i) {
-    const auto data = obj_marker_data_array_.at(i);
-    const MarkerArray target_marker =
-      marker_utils::createTargetMarker(i, data, getName(), getHeightOffset());
-    marker_array.markers.insert(
-      marker_array.markers.end(), target_marker.markers.begin(), target_marker.markers.end());
+    MarkerArray target_marker = marker_utils::createTargetMarker(
+      i, obj_marker_data_array_.at(i), getName(), getHeightOffset());
+    marker_array_.markers.insert(
+      marker_array_.markers.end(), std::make_move_iterator(target_marker.markers.begin()),
+      std::make_move_iterator(target_marker.markers.end()));
+  }
+
+  // delete only the markers of the objects which were published last time and are not anymore
+  const auto object_num = static_cast<int32_t>(obj_marker_data_array_.size());
+  for (const auto & [ns, id] : published_marker_ids_) {
+    if (id < object_num) {
+      continue;
+    }
+    Marker marker;
+    marker.header.frame_id = "map";
+    marker.header.stamp = now;
+    marker.ns = ns;
+    marker.id = id;
+    marker.action = Marker::DELETE;
+    marker_array_.markers.push_back(marker);
+  }
+  published_marker_ids_.clear();
+  for (const auto & marker : marker_array_.markers) {
+    if (marker.action == Marker::ADD) {
+      published_marker_ids_.emplace_back(marker.ns, marker.id);
+    }
   }
-  pub_marker_->publish(marker_array);
+
+  pub_marker_->publish(marker_array_);
   obj_marker_data_array_.clear();
 }
 
@@ -71,6 +101,11 @@ void ObjectsOfInterestMarkerInterface::setHeightOffset(const double offset)
   height_offset_ = offset;
 }
 
+void ObjectsOfInterestMarkerInterface::setPublishPeriod(const double period)
+{
+  publish_period_ = period;
+}
+
 ColorRGBA ObjectsOfInterestMarkerInterface::getColor(
   const ColorName & color_name, const float alpha)
 {
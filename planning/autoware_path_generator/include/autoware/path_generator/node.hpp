@@ -33,6 +33,8 @@
 #include <nav_msgs/msg/odometry.hpp>
 
 #include <memory>
+#include <optional>
+#include <vector>
 
 namespace autoware::path_generator
 {
@@ -91,6 +93,20 @@ private:
 
   std::optional<lanelet::ConstLanelet> current_lanelet_{std::nullopt};
 
+  // NOTE: The centerline trajectory of a lanelet sequence does not depend on the ego pose, so that
+  // it is reused while the sequence does not change and only cropped by the ego pose every cycle.
+  // This is cleared when a new map or route is set.
+  struct CenterlineTrajectory
+  {
+    lanelet::Ids lanelet_ids;
+    double connection_gradient_from_centerline;
+    lanelet::ConstLanelets extended_lanelets;
+    double extended_arc_length;
+    std::vector<PathPointWithLaneId> path_points;
+    Trajectory trajectory;
+  };
+  mutable std::optional<CenterlineTrajectory> centerline_trajectory_cache_{std::nullopt};
+
   mutable std::shared_ptr<autoware_utils_debug::TimeKeeper> time_keeper_{nullptr};
 
   autoware_utils_system::StopWatch<std::chrono::milliseconds> stop_watch_;
@@ -107,6 +123,9 @@ private:
     const lanelet::LaneletSequence & lanelet_sequence, const double s_start, const double s_end,
     const Params & params) const;
 
+  const CenterlineTrajectory * get_centerline_trajectory(
+    const lanelet::LaneletSequence & lanelet_sequence, const Params & params) const;
+
   bool update_current_lanelet(const geometry_msgs::msg::Pose & current_pose, const Params & params);
 
   void publishStopWatchTime();
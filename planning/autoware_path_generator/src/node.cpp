@@ -16,6 +16,7 @@
 
 #include "autoware/path_generator/utils.hpp"
 
+#include <autoware/lanelet2_utils/map_registry.hpp>
 #include <autoware/motion_utils/resample/resample.hpp>
 #include <autoware/motion_utils/trajectory/trajectory.hpp>
 #include <autoware/trajectory/utils/pretty_build.hpp>
@@ -70,7 +71,8 @@ PathGenerator::PathGenerator(const rclcpp::NodeOptions & node_options)
 
   timer_ = rclcpp::create_timer(
     this, get_clock(), rclcpp::Rate(params.planning_hz).period(),
-    std::bind(&PathGenerator::run, this));
+    std::bind(&PathGenerator::run, this),
+    create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive));
 }
 
 void PathGenerator::run()
@@ -139,10 +141,12 @@ PathGenerator::InputData PathGenerator::take_data()
 void PathGenerator::set_planner_data(const InputData & input_data)
 {
   if (input_data.lanelet_map_bin_ptr) {
-    planner_data_.lanelet_map_ptr = std::make_shared<lanelet::LaneletMap>();
-    lanelet::utils::conversion::fromBinMsg(
-      *input_data.lanelet_map_bin_ptr, planner_data_.lanelet_map_ptr,
-      &planner_data_.traffic_rules_ptr, &planner_data_.routing_graph_ptr);
+    centerline_trajectory_cache_ = std::nullopt;
+    const auto shared_map = autoware::experimental::lanelet2_utils::get_shared_lanelet_map(
+      *input_data.lanelet_map_bin_ptr);
+    planner_data_.lanelet_map_ptr = shared_map.lanelet_map;
+    planner_data_.traffic_rules_ptr = shared_map.traffic_rules;
+    planner_data_.routing_graph_ptr = shared_map.routing_graph;
   }
 
   if (input_data.route_ptr) {
@@ -152,6 +156,8 @@ void PathGenerator::set_planner_data(const InputData & input_data)
 
 void PathGenerator::set_route(const LaneletRoute::ConstSharedPtr & route_ptr)
 {
+  centerline_trajectory_cache_ = std::nullopt;
+
   planner_data_.route_frame_id = route_ptr->header.frame_id;
   planner_data_.goal_pose = route_ptr->goal_pose;
 
@@ -348,6 +354,78 @@ std::optional<PathWithLaneId> PathGenerator::generate_path(
     return std::nullopt;
   }
 
+  const auto centerline_trajectory = get_centerline_trajectory(lanelet_sequence, params);
+  if (!centerline_trajectory) {
+    return std::nullopt;
+  }
+  const auto & extended_arc_length = centerline_trajectory->extended_arc_length;
+  const lanelet::LaneletSequence extended_lanelet_sequence(
+    centerline_trajectory->extended_lanelets);
+  std::optional<Trajectory> trajectory = centerline_trajectory->trajectory;
+
+  const auto s_path_start = utils::get_arc_length_on_path(
+    extended_lanelet_sequence, centerline_trajectory->path_points, extended_arc_length + s_start);
+  const auto s_path_end = utils::get_arc_length_on_path(
+    extended_lanelet_sequence, centerline_trajectory->path_points, extended_arc_length + s_end);
+
+  // Refine the trajectory by cropping
+  if (trajectory->length() - s_path_end > 0) {
+    trajectory->crop(0., s_path_end);
+  }
+
+  trajectory = utils::connect_path_to_goal_inside_lanelets(
+    *trajectory, extended_lanelet_sequence.lanelets(), planner_data_.goal_pose,
+    planner_data_.preferred_lanelets.back().id(), params.goal_connection.connection_section_length,
+    params.goal_connection.pre_goal_offset);
+
+  if (!trajectory) {
+    RCLCPP_ERROR(get_logger(), "Failed to connect trajectory to goal");
+    return std::nullopt;
+  }
+
+  if (trajectory->length() - s_path_start > 0) {
+    trajectory->crop(s_path_start, trajectory->length() - s_path_start);
+  }
+
+  // Compose the polished path
+  PathWithLaneId finalized_path_with_lane_id{};
+  finalized_path_with_lane_id.points = trajectory->restore();
+
+  if (finalized_path_with_lane_id.points.empty()) {
+    RCLCPP_ERROR(get_logger(), "Finalized path points are empty after cropping");
+    return std::nullopt;
+  }
+
+  // Set header which is needed to engage
+  finalized_path_with_lane_id.header.frame_id = planner_data_.route_frame_id;
+  finalized_path_with_lane_id.header.stamp = now();
+
+  const auto [left_bound, right_bound] = utils::get_path_bounds(
+    extended_lanelet_sequence,
+    std::max(0., extended_arc_length + s_start - vehicle_info_.max_longitudinal_offset_m),
+    extended_arc_length + s_end + vehicle_info_.max_longitudinal_offset_m);
+  finalized_path_with_lane_id.left_bound = left_bound;
+  finalized_path_with_lane_id.right_bound = right_bound;
+
+  return finalized_path_with_lane_id;
+}
+
+const PathGenerator::CenterlineTrajectory * PathGenerator::get_centerline_trajectory(
+  const lanelet::LaneletSequence & lanelet_sequence, const Params & params) const
+{
+  lanelet::Ids lanelet_ids;
+  lanelet_ids.reserve(lanelet_sequence.size());
+  for (const auto & lanelet : lanelet_sequence) {
+    lanelet_ids.push_back(lanelet.id());
+  }
+  if (
+    centerline_trajectory_cache_ && centerline_trajectory_cache_->lanelet_ids == lanelet_ids &&
+    centerline_trajectory_cache_->connection_gradient_from_centerline ==
+      params.waypoint.connection_gradient_from_centerline) {
+    return &*centerline_trajectory_cache_;
+  }
+  centerline_trajectory_cache_ = std::nullopt;
+
   std::vector<PathPointWithLaneId> path_points_with_lane_id{};
 
   const auto waypoint_groups = utils::get_waypoint_groups(
@@ -435,63 +513,26 @@ std::optional<PathWithLaneId> PathGenerator::generate_path(
 
   if (path_points_with_lane_id.empty()) {
     RCLCPP_ERROR(get_logger(), "No path points generated from lanelet sequence");
-    return std::nullopt;
+    return nullptr;
   }
 
   auto trajectory = autoware::experimental::trajectory::pretty_build(path_points_with_lane_id);
   if (!trajectory) {
     RCLCPP_ERROR(get_logger(), "Failed to build trajectory from path points");
-    return std::nullopt;
+    return nullptr;
   }
 
   // Attach orientation for all the points
   trajectory->align_orientation_with_trajectory_direction();
 
-  const auto s_path_start = utils::get_arc_length_on_path(
-    extended_lanelet_sequence, path_points_with_lane_id, extended_arc_length + s_start);
-  const auto s_path_end = utils::get_arc_length_on_path(
-    extended_lanelet_sequence, path_points_with_lane_id, extended_arc_length + s_end);
-
-  // Refine the trajectory by cropping
-  if (trajectory->length() - s_path_end > 0) {
-    trajectory->crop(0., s_path_end);
-  }
-
-  trajectory = utils::connect_path_to_goal_inside_lanelets(
-    *trajectory, extended_lanelet_sequence.lanelets(), planner_data_.goal_pose,
-    planner_data_.preferred_lanelets.back().id(), params.goal_connection.connection_section_length,
-    params.goal_connection.pre_goal_offset);
-
-  if (!trajectory) {
-    RCLCPP_ERROR(get_logger(), "Failed to connect trajectory to goal");
-    return std::nullopt;
-  }
-
-  if (trajectory->length() - s_path_start > 0) {
-    trajectory->crop(s_path_start, trajectory->length() - s_path_start);
-  }
-
-  // Compose the polished path
-  PathWithLaneId finalized_path_with_lane_id{};
-  finalized_path_with_lane_id.points = trajectory->restore();
-
-  if (finalized_path_with_lane_id.points.empty()) {
-    RCLCPP_ERROR(get_logger(), "Finalized path points are empty after cropping");
-    return std::nullopt;
-  }
-
-  // Set header which is needed to engage
-  finalized_path_with_lane_id.header.frame_id = planner_data_.route_frame_id;
-  finalized_path_with_lane_id.header.stamp = now();
-
-  const auto [left_bound, right_bound] = utils::get_path_bounds(
-    extended_lanelet_sequence,
-    std::max(0., extended_arc_length + s_start - vehicle_info_.max_longitudinal_offset_m),
-    extended_arc_length + s_end + vehicle_info_.max_longitudinal_offset_m);
-  finalized_path_with_lane_id.left_bound = left_bound;
-  finalized_path_with_lane_id.right_bound = right_bound;
-
-  return finalized_path_with_lane_id;
+  centerline_trajectory_cache_ = CenterlineTrajectory{
+    std::move(lanelet_ids),
+    params.waypoint.connection_gradient_from_centerline,
+    extended_lanelet_sequence.lanelets(),
+    extended_arc_length,
+    std::move(path_points_with_lane_id),
+    std::move(*trajectory)};
+  return &*centerline_trajectory_cache_;
 }
 
 bool PathGenerator::update_current_lanelet(
@@ -14,7 +14,7 @@
 
 #include "autoware/path_generator/utils.hpp"
 
-#include "autoware/trajectory/interpolator/linear.hpp"
+#include "autoware/trajectory/detail/helpers.hpp"
 #include "autoware/trajectory/utils/closest.hpp"
 #include "autoware/trajectory/utils/crop.hpp"
 #include "autoware/trajectory/utils/find_intervals.hpp"
@@ -24,6 +24,7 @@
 #include <autoware/motion_utils/trajectory/trajectory.hpp>
 #include <autoware/trajectory/forward.hpp>
 #include <autoware/trajectory/path_point_with_lane_id.hpp>
+#include <autoware/trajectory/threshold.hpp>
 #include <autoware/trajectory/utils/pretty_build.hpp>
 #include <autoware_lanelet2_extension/utility/message_conversion.hpp>
 #include <autoware_lanelet2_extension/utility/utilities.hpp>
@@ -32,10 +33,15 @@
 
 #include <autoware_internal_planning_msgs/msg/path_point_with_lane_id.hpp>
 
+#include <Eigen/Core>
+
 #include <lanelet2_core/Forward.h>
 #include <lanelet2_core/geometry/Lanelet.h>
 
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
 #include <limits>
 #include <optional>
 #include <set>
@@ -61,28 +67,205 @@ bool exists(const std::vector<T> & vec, const T & item)
   return std::find(vec.begin(), vec.end(), item) != vec.end();
 }
 
-template <typename const_iterator>
-std::vector<geometry_msgs::msg::Point> to_geometry_msgs_points(
-  const const_iterator begin, const const_iterator end)
+Eigen::Vector3d to_vector3d(const geometry_msgs::msg::Point & point)
 {
-  std::vector<geometry_msgs::msg::Point> geometry_msgs_points{};
-  geometry_msgs_points.reserve(std::distance(begin, end));
-  std::transform(begin, end, std::back_inserter(geometry_msgs_points), [](const auto & point) {
-    return lanelet::utils::conversion::toGeomMsgPt(point);
-  });
-  return geometry_msgs_points;
+  return {point.x, point.y, point.z};
 }
 
-lanelet::BasicPoints3d to_lanelet_points(
-  const std::vector<geometry_msgs::msg::Point> & geometry_msgs_points)
+template <typename LaneletPointT>
+Eigen::Vector3d to_vector3d(const LaneletPointT & point)
 {
-  lanelet::BasicPoints3d lanelet_points{};
-  lanelet_points.reserve(geometry_msgs_points.size());
-  std::transform(
-    geometry_msgs_points.begin(), geometry_msgs_points.end(), std::back_inserter(lanelet_points),
-    [](const auto & point) { return lanelet::utils::conversion::toLaneletPoint(point); });
-  return lanelet_points;
+  return to_vector3d(lanelet::utils::conversion::toGeomMsgPt(point));
+}
+
+geometry_msgs::msg::Point to_geometry_msgs_point(const Eigen::Vector3d & point)
+{
+  geometry_msgs::msg::Point geometry_msgs_point;
+  geometry_msgs_point.x = point.x();
+  geometry_msgs_point.y = point.y();
+  geometry_msgs_point.z = point.z();
+  return geometry_msgs_point;
 }
+
+lanelet::BasicPoint2d to_lanelet_point2d(const Eigen::Vector3d & point)
+{
+  return point.head<2>();
+}
+
+/**
+ * @brief crop the line string between the iterators in the same way as the linear trajectory of
+ * crop_line_string, reading each point once into a contiguous buffer and converting the cropped
+ * points directly into the output type
+ */
+template <typename OutputLineString, typename const_iterator, typename ToOutputPoint>
+OutputLineString crop_line_string_impl(
+  const const_iterator begin, const const_iterator end, const double s_start, const double s_end,
+  const ToOutputPoint & to_output_point)
+{
+  std::vector<Eigen::Vector3d> points{};
+  points.reserve(std::distance(begin, end));
+  std::transform(begin, end, std::back_inserter(points), [](const auto & point) {
+    return to_vector3d(point);
+  });
+
+  const auto to_output_points = [&](const std::vector<Eigen::Vector3d> & input) {
+    OutputLineString output_points{};
+    output_points.reserve(input.size());
+    std::transform(input.begin(), input.end(), std::back_inserter(output_points), to_output_point);
+    return output_points;
+  };
+
+  if (s_start < 0.) {
+    RCLCPP_WARN(
+      rclcpp::get_logger("path_generator").get_child("utils").get_child("crop_line_string"),
+      "Start of crop range is negative, returning input as is");
+    return to_output_points(points);
+  }
+
+  if (s_start > s_end) {
+    RCLCPP_WARN(
+      rclcpp::get_logger("path_generator").get_child("utils").get_child("crop_line_string"),
+      "Start of crop range is larger than end, returning input as is");
+    return to_output_points(points);
+  }
+
+  if (points.size() < 2) {
+    return OutputLineString{};
+  }
+
+  // same bases and crop range as Trajectory<geometry_msgs::msg::Point>
+  std::vector<double> bases{0.};
+  bases.reserve(points.size());
+  for (size_t i = 1; i < points.size(); ++i) {
+    bases.push_back(
+      bases.back() + std::max(
+                       (points.at(i) - points.at(i - 1)).norm(),
+                       autoware::experimental::trajectory::k_points_minimum_dist_threshold));
+  }
+  const auto crop_start = std::clamp(s_start, 0., bases.back());
+  const auto crop_end = std::clamp(crop_start + (s_end - s_start), crop_start, bases.back());
+
+  // same as Trajectory::restore with the linear interpolation
+  const auto compute_points = [&](const std::vector<double> & ss, std::vector<double> * sanitized) {
+    std::vector<Eigen::Vector3d> cropped_points{};
+    cropped_points.reserve(ss.size());
+    size_t idx = 0;
+    for (const auto s : ss) {
+      const auto s_clamp = std::clamp(s, crop_start, crop_end);
+      while (idx + 2 < bases.size() && bases.at(idx + 1) <= s_clamp) {
+        ++idx;
+      }
+      const auto ratio = (s_clamp - bases.at(idx)) / (bases.at(idx + 1) - bases.at(idx));
+      const Eigen::Vector3d point = points.at(idx) + ratio * (points.at(idx + 1) - points.at(idx));
+      if (
+        cropped_points.empty() ||
+        (point - cropped_points.back()).norm() >=
+          autoware::experimental::trajectory::k_points_minimum_dist_threshold) {
+        cropped_points.push_back(point);
+        if (sanitized) {
+          sanitized->push_back(s);
+        }
+      }
+    }
+    return cropped_points;
+  };
+
+  constexpr size_t min_points = 4;
+  std::vector<double> sanitized_bases{};
+  const auto cropped_points = compute_points(
+    autoware::experimental::trajectory::detail::fill_bases(
+      autoware::experimental::trajectory::detail::crop_bases(bases, crop_start, crop_end),
+      min_points),
+    &sanitized_bases);
+  // NOTE: a single point cannot be filled, which would divide by zero in fill_bases
+  if (cropped_points.size() >= min_points || sanitized_bases.size() < 2) {
+    return to_output_points(cropped_points);
+  }
+  return to_output_points(compute_points(
+    autoware::experimental::trajectory::detail::fill_bases(sanitized_bases, min_points), nullptr));
+}
+
+/**
+ * @brief uniform grid of the segments of a line string, to find the segments which may intersect
+ * with a segment without testing all of them
+ */
+class SegmentGrid
+{
+public:
+  explicit SegmentGrid(const lanelet::BasicLineString2d & line_string)
+  {
+    auto length = 0.;
+    for (size_t i = 0; i + 1 < line_string.size(); ++i) {
+      length += (line_string.at(i + 1) - line_string.at(i)).norm();
+    }
+    // the mean segment length keeps the number of the segments per cell small
+    cell_size_ = std::max(length / static_cast<double>(line_string.size() - 1), 1e-3);
+
+    segment_cells_.reserve(line_string.size() - 1);
+    for (size_t i = 0; i + 1 < line_string.size(); ++i) {
+      const auto & cell_range = segment_cells_.emplace_back(
+        get_cell_range(line_string.at(i), line_string.at(i + 1)));
+      for (auto x = cell_range.min_x; x <= cell_range.max_x; ++x) {
+        for (auto y = cell_range.min_y; y <= cell_range.max_y; ++y) {
+          cells_[get_key(x, y)].push_back(i);
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief get the segments after the given one sharing a cell with it, in ascending order
+   */
+  std::vector<size_t> get_subsequent_candidates(const size_t segment_index) const
+  {
+    std::vector<size_t> candidates;
+    const auto & cell_range = segment_cells_.at(segment_index);
+    for (auto x = cell_range.min_x; x <= cell_range.max_x; ++x) {
+      for (auto y = cell_range.min_y; y <= cell_range.max_y; ++y) {
+        const auto cell = cells_.find(get_key(x, y));
+        if (cell == cells_.end()) {
+          continue;
+        }
+        std::copy_if(
+          cell->second.begin(), cell->second.end(), std::back_inserter(candidates),
+          [&](const size_t i) { return i > segment_index; });
+      }
+    }
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+    return candidates;
+  }
+
+private:
+  struct CellRange
+  {
+    int64_t min_x;
+    int64_t min_y;
+    int64_t max_x;
+    int64_t max_y;
+  };
+
+  CellRange get_cell_range(
+    const lanelet::BasicPoint2d & first, const lanelet::BasicPoint2d & second) const
+  {
+    const auto to_cell = [&](const double v) {
+      return static_cast<int64_t>(std::floor(v / cell_size_));
+    };
+    return {
+      to_cell(std::min(first.x(), second.x())), to_cell(std::min(first.y(), second.y())),
+      to_cell(std::max(first.x(), second.x())), to_cell(std::max(first.y(), second.y()))};
+  }
+
+  static uint64_t get_key(const int64_t x, const int64_t y)
+  {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) |
+           static_cast<uint64_t>(static_cast<uint32_t>(y));
+  }
+
+  double cell_size_;
+  std::vector<CellRange> segment_cells_;
+  std::unordered_map<uint64_t, std::vector<size_t>> cells_;
+};
 }  // namespace
 
 std::optional<lanelet::ConstLanelets> get_lanelets_within_route_up_to(
@@ -244,18 +427,18 @@ std::optional<double> get_first_intersection_arc_length(
   const auto s_start_on_bounds = get_arc_length_on_bounds(lanelet_sequence, s_start);
   const auto s_end_on_bounds = get_arc_length_on_bounds(lanelet_sequence, s_end);
 
-  const auto cropped_centerline = lanelet::utils::to2D(to_lanelet_points(crop_line_string(
-    to_geometry_msgs_points(
-      lanelet_sequence.centerline2d().begin(), lanelet_sequence.centerline2d().end()),
-    s_start, s_end)));
-  const auto cropped_left_bound = lanelet::utils::to2D(to_lanelet_points(crop_line_string(
-    to_geometry_msgs_points(
-      lanelet_sequence.leftBound2d().begin(), lanelet_sequence.leftBound2d().end()),
-    s_start_on_bounds.left, s_end_on_bounds.left)));
-  const auto cropped_right_bound = lanelet::utils::to2D(to_lanelet_points(crop_line_string(
-    to_geometry_msgs_points(
-      lanelet_sequence.rightBound2d().begin(), lanelet_sequence.rightBound2d().end()),
-    s_start_on_bounds.right, s_end_on_bounds.right)));
+  // the compound line strings are built once and iterated through the same instance
+  const auto centerline = lanelet_sequence.centerline2d();
+  const auto left_bound = lanelet_sequence.leftBound2d();
+  const auto right_bound = lanelet_sequence.rightBound2d();
+  const auto cropped_centerline = crop_line_string_impl<lanelet::BasicLineString2d>(
+    centerline.begin(), centerline.end(), s_start, s_end, to_lanelet_point2d);
+  const auto cropped_left_bound = crop_line_string_impl<lanelet::BasicLineString2d>(
+    left_bound.begin(), left_bound.end(), s_start_on_bounds.left, s_end_on_bounds.left,
+    to_lanelet_point2d);
+  const auto cropped_right_bound = crop_line_string_impl<lanelet::BasicLineString2d>(
+    right_bound.begin(), right_bound.end(), s_start_on_bounds.right, s_end_on_bounds.right,
+    to_lanelet_point2d);
 
   if (cropped_centerline.empty() || cropped_left_bound.empty() || cropped_right_bound.empty()) {
     return std::nullopt;
@@ -396,6 +579,8 @@ std::optional<double> get_first_self_intersection_arc_length(
     return std::nullopt;
   }
 
+  const SegmentGrid segment_grid(line_string);
+
   std::optional<size_t> first_self_intersection_index = std::nullopt;
   std::optional<double> intersection_arc_length_on_latter_segment = std::nullopt;
   double s = 0.;
@@ -410,8 +595,9 @@ std::optional<double> get_first_self_intersection_arc_length(
     const auto current_segment = lanelet::BasicSegment2d{line_string.at(i), line_string.at(i + 1)};
     s += lanelet::geometry::length(current_segment);
 
+    // the segments which do not share a cell with the current one cannot intersect with it
     lanelet::BasicPoints2d self_intersections{};
-    for (size_t j = i + 1; j < line_string.size() - 1; ++j) {
+    for (const auto j : segment_grid.get_subsequent_candidates(i)) {
       const auto segment = lanelet::BasicSegment2d{line_string.at(j), line_string.at(j + 1)};
       if (
         segment.first == current_segment.second || segment.second == current_segment.first ||
@@ -504,45 +690,22 @@ PathRange<std::vector<geometry_msgs::msg::Point>> get_path_bounds(
   const auto [s_left_start, s_right_start] = get_arc_length_on_bounds(lanelet_sequence, s_start);
   const auto [s_left_end, s_right_end] = get_arc_length_on_bounds(lanelet_sequence, s_end);
 
+  const auto left_bound = lanelet_sequence.leftBound();
+  const auto right_bound = lanelet_sequence.rightBound();
   return {
-    crop_line_string(
-      to_geometry_msgs_points(
-        lanelet_sequence.leftBound().begin(), lanelet_sequence.leftBound().end()),
-      s_left_start, s_left_end),
-    crop_line_string(
-      to_geometry_msgs_points(
-        lanelet_sequence.rightBound().begin(), lanelet_sequence.rightBound().end()),
-      s_right_start, s_right_end)};
+    crop_line_string_impl<std::vector<geometry_msgs::msg::Point>>(
+      left_bound.begin(), left_bound.end(), s_left_start, s_left_end, to_geometry_msgs_point),
+    crop_line_string_impl<std::vector<geometry_msgs::msg::Point>>(
+      right_bound.begin(), right_bound.end(), s_right_start, s_right_end,
+      to_geometry_msgs_point)};
 }
 
 std::vector<geometry_msgs::msg::Point> crop_line_string(
   const std::vector<geometry_msgs::msg::Point> & line_string, const double s_start,
   const double s_end)
 {
-  if (s_start < 0.) {
-    RCLCPP_WARN(
-      rclcpp::get_logger("path_generator").get_child("utils").get_child(__func__),
-      "Start of crop range is negative, returning input as is");
-    return line_string;
-  }
-
-  if (s_start > s_end) {
-    RCLCPP_WARN(
-      rclcpp::get_logger("path_generator").get_child("utils").get_child(__func__),
-      "Start of crop range is larger than end, returning input as is");
-    return line_string;
-  }
-
-  auto trajectory =
-    autoware::experimental::trajectory::Trajectory<geometry_msgs::msg::Point>::Builder()
-      .set_xy_interpolator<autoware::experimental::trajectory::interpolator::Linear>()
-      .build(line_string);
-  if (!trajectory) {
-    return {};
-  }
-
-  trajectory->crop(s_start, s_end - s_start);
-  return trajectory->restore();
+  return crop_line_string_impl<std::vector<geometry_msgs::msg::Point>>(
+    line_string.begin(), line_string.end(), s_start, s_end, to_geometry_msgs_point);
 }
 
 PathRange<double> get_arc_length_on_bounds(
@@ -0,0 +1,160 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Time per planning cycle of the path generator on a synthesized highway of 1000 segments of
+// 100 m and 3 lanes, with routes of increasing length. The ego pose advances by 1 m per cycle
+// along the first 100 m of the route, so that the path is the same for all the route lengths.
+
+#include "autoware/path_generator/node.hpp"
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <autoware_test_utils/autoware_test_utils.hpp>
+#include <autoware_test_utils/synthetic_lanelet_map.hpp>
+
+#include <benchmark/benchmark.h>
+#include <lanelet2_core/LaneletMap.h>
+
+#include <cmath>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+using autoware::path_generator::LaneletMapBin;
+using autoware::path_generator::LaneletRoute;
+using autoware::path_generator::PathGenerator;
+using geometry_msgs::msg::Pose;
+
+constexpr size_t segment_num = 1000;
+constexpr size_t lane_num = 3;
+constexpr double segment_length = 100.0;
+
+struct Fixture
+{
+  std::shared_ptr<PathGenerator> path_generator;
+  ::path_generator::Params params;
+  LaneletMapBin::ConstSharedPtr map_bin_msg;
+  // IDs of the lanes of each segment, from the rightmost one
+  std::vector<std::vector<lanelet::Id>> segment_lane_ids;
+  double lane_width{0.0};
+};
+
+Fixture & get_fixture()
+{
+  static Fixture fixture = [] {
+    Fixture f;
+    const auto map_params = autoware::test_utils::SyntheticLaneletMapParameters{};
+    f.lane_width = map_params.lane_width;
+    const auto map_path =
+      (std::filesystem::temp_directory_path() / "benchmark_path_generator_highway.osm").string();
+    autoware::test_utils::write_lanelet_map(
+      *autoware::test_utils::make_highway_lanelet_map(
+        segment_num, lane_num, segment_length, map_params),
+      map_path);
+    f.map_bin_msg =
+      std::make_shared<LaneletMapBin>(autoware::test_utils::make_map_bin_msg(map_path, 5.0));
+
+    // the front of the right bound of a lane is at (segment_index * segment_length,
+    // lane_index * lane_width)
+    const auto map = autoware::test_utils::loadMap(map_path);
+    f.segment_lane_ids.assign(segment_num, std::vector<lanelet::Id>(lane_num));
+    for (const auto & lanelet : map->laneletLayer) {
+      const auto & front = lanelet.rightBound().front();
+      const auto segment_index = static_cast<size_t>(std::round(front.x() / segment_length));
+      const auto lane_index = static_cast<size_t>(std::round(front.y() / f.lane_width));
+      f.segment_lane_ids.at(segment_index).at(lane_index) = lanelet.id();
+    }
+
+    const auto autoware_test_utils_dir =
+      ament_index_cpp::get_package_share_directory("autoware_test_utils");
+    const auto path_generator_dir =
+      ament_index_cpp::get_package_share_directory("autoware_path_generator");
+    const auto node_options = rclcpp::NodeOptions{}.arguments(
+      {"--ros-args", "--params-file",
+       autoware_test_utils_dir + "/config/test_vehicle_info.param.yaml", "--params-file",
+       autoware_test_utils_dir + "/config/test_nearest_search.param.yaml", "--params-file",
+       path_generator_dir + "/config/path_generator.param.yaml"});
+    f.path_generator = std::make_shared<PathGenerator>(node_options);
+    f.params =
+      ::path_generator::ParamListener(f.path_generator->get_node_parameters_interface())
+        .get_params();
+    return f;
+  }();
+  return fixture;
+}
+
+// route along the rightmost lane of the first route_segment_num segments
+LaneletRoute::ConstSharedPtr make_route(const Fixture & f, const size_t route_segment_num)
+{
+  auto route = std::make_shared<LaneletRoute>();
+  route->header.frame_id = "map";
+  route->start_pose =
+    autoware::test_utils::createPose(10.0, f.lane_width / 2.0, 0.0, 0.0, 0.0, 0.0);
+  route->goal_pose = autoware::test_utils::createPose(
+    static_cast<double>(route_segment_num) * segment_length - 10.0, f.lane_width / 2.0, 0.0, 0.0,
+    0.0, 0.0);
+  for (size_t i = 0; i < route_segment_num; ++i) {
+    autoware_planning_msgs::msg::LaneletSegment segment;
+    segment.preferred_primitive.id = f.segment_lane_ids.at(i).front();
+    for (const auto id : f.segment_lane_ids.at(i)) {
+      autoware_planning_msgs::msg::LaneletPrimitive primitive;
+      primitive.id = id;
+      primitive.primitive_type = "lane";
+      segment.primitives.push_back(primitive);
+    }
+    route->segments.push_back(segment);
+  }
+  return route;
+}
+
+void BM_GeneratePath(benchmark::State & state)
+{
+  auto & f = get_fixture();
+  f.path_generator->set_planner_data(
+    {make_route(f, static_cast<size_t>(state.range(0))), f.map_bin_msg, nullptr});
+
+  std::vector<Pose> poses;
+  for (int i = 0; i < 100; ++i) {
+    poses.push_back(
+      autoware::test_utils::createPose(10.0 + i, f.lane_width / 2.0, 0.0, 0.0, 0.0, 0.0));
+  }
+  size_t i = 0;
+  for (auto _ : state) {
+    const auto path = f.path_generator->generate_path(poses[i++ % poses.size()], f.params);
+    if (!path) {
+      state.SkipWithError("failed to generate the path");
+      break;
+    }
+    benchmark::DoNotOptimize(path);
+  }
+}
+}  // namespace
+
+BENCHMARK(BM_GeneratePath)
+  ->Arg(10)
+  ->Arg(100)
+  ->Arg(static_cast<int64_t>(segment_num))
+  ->Unit(benchmark::kMicrosecond);
+
+int main(int argc, char ** argv)
+{
+  rclcpp::init(argc, argv);
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  rclcpp::shutdown();
+  return 0;
+}
@@ -0,0 +1,65 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Drives the path generator at 10 Hz on the route of the sample map of autoware_test_utils and
+// reports the latency, the CPU time and the allocations of its callbacks per planning cycle.
+
+#include "autoware/path_generator/node.hpp"
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <autoware/planning_test_manager/autoware_planning_performance_test_manager.hpp>
+#include <autoware_test_utils/autoware_test_utils.hpp>
+
+#include <autoware_internal_planning_msgs/msg/path_with_lane_id.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+using autoware::planning_test_manager::PlanningPerformanceTestManager;
+
+TEST(PlanningModulePerformanceTest, PathGenerator)
+{
+  rclcpp::init(0, nullptr);
+
+  const auto autoware_test_utils_dir =
+    ament_index_cpp::get_package_share_directory("autoware_test_utils");
+  const auto path_generator_dir =
+    ament_index_cpp::get_package_share_directory("autoware_path_generator");
+  auto node_options = rclcpp::NodeOptions{};
+  autoware::test_utils::updateNodeOptions(
+    node_options, {autoware_test_utils_dir + "/config/test_vehicle_info.param.yaml",
+                   autoware_test_utils_dir + "/config/test_nearest_search.param.yaml",
+                   path_generator_dir + "/config/path_generator.param.yaml"});
+  const auto test_target_node =
+    std::make_shared<autoware::path_generator::PathGenerator>(node_options);
+
+  const auto route = autoware::test_utils::makeBehaviorNormalRoute();
+  PlanningPerformanceTestManager test_manager;
+  test_manager.publishInput(
+    test_target_node, "path_generator/input/vector_map", autoware::test_utils::makeMapBinMsg());
+  test_manager.publishInput(test_target_node, "path_generator/input/route", route);
+  test_manager.publishCyclicInput(
+    "path_generator/input/odometry",
+    autoware::test_utils::makeOdometry().set__pose(
+      geometry_msgs::msg::PoseWithCovariance{}.set__pose(route.start_pose)));
+  test_manager.subscribeOutput<autoware_internal_planning_msgs::msg::PathWithLaneId>(
+    "path_generator/output/path");
+
+  const auto report = test_manager.run(test_target_node, 100);
+  PlanningPerformanceTestManager::printReport(report);
+  EXPECT_GT(report.output_num, 0U);
+
+  rclcpp::shutdown();
+}
@@ -16,6 +16,8 @@
 
 #include <lanelet2_core/geometry/Lanelet.h>
 
+#include <cmath>
+
 namespace
 {
 std::vector<autoware_internal_planning_msgs::msg::PathPointWithLaneId> create_path_points(
@@ -157,6 +159,20 @@ TEST_F(UtilsTest, getFirstSelfIntersectionArcLength)
     ASSERT_TRUE(result);
     ASSERT_NEAR(*result, 7.0, epsilon);
   }
+
+  {  // long line string turning back across itself
+    lanelet::BasicLineString2d line_string;
+    for (int i = 0; i < 100; ++i) {
+      line_string.emplace_back(static_cast<double>(i), 0.0);
+    }
+    line_string.emplace_back(99.0, 10.0);
+    line_string.emplace_back(50.0, -5.0);
+
+    const auto result = utils::get_first_self_intersection_arc_length(line_string);
+
+    ASSERT_TRUE(result);
+    ASSERT_NEAR(*result, 109.0 + std::hypot(99.0 - 66.0 - 1.0 / 3.0, 10.0), epsilon);
+  }
 }
 
 TEST_F(UtilsTest, GetArcLengthOnPath)
@@ -16,6 +16,8 @@
 #define AUTOWARE__PLANNING_FACTOR_INTERFACE__PLANNING_FACTOR_INTERFACE_HPP_
 
 #include <autoware/motion_utils/trajectory/trajectory.hpp>
+#include <autoware/trajectory/forward.hpp>
+#include <autoware_utils_geometry/geometry.hpp>
 #include <rclcpp/rclcpp.hpp>
 
 #include <autoware_internal_planning_msgs/msg/control_point.hpp>
@@ -116,6 +118,69 @@ public:
       detail);
   }
 
+  /**
+   * @brief factor setter for single control point given by its arc length on the trajectory.
+   * @details unlike the overload taking the path points, the ego and the control point are not
+   * projected on the path again, so that the modules which already computed them report the factor
+   * in O(1), e.g. with the ego arc length computed once per cycle.
+   *
+   * @param trajectory of the path.
+   * @param ego arc length on the trajectory.
+   * @param control point arc length on the trajectory. (e.g. stop or slow down point)
+   * @param behavior of this planning factor.
+   * @param safety factor.
+   * @param driving direction.
+   * @param target velocity of the control point.
+   * @param shift length of the control point.
+   * @param detail information.
+   */
+  template <class PointType>
+  void add(
+    const autoware::experimental::trajectory::Trajectory<PointType> & trajectory,
+    const double ego_s, const double control_point_s, const uint16_t behavior,
+    const SafetyFactorArray & safety_factors, const bool is_driving_forward = true,
+    const double velocity = 0.0, const double shift_length = 0.0, const std::string & detail = "")
+  {
+    add(
+      control_point_s - ego_s,
+      autoware_utils_geometry::get_pose(trajectory.compute(control_point_s)), behavior,
+      safety_factors, is_driving_forward, velocity, shift_length, detail);
+  }
+
+  /**
+   * @brief factor setter for two control points (section) given by their arc length on the
+   * trajectory.
+   *
+   * @param trajectory of the path.
+   * @param ego arc length on the trajectory.
+   * @param control section start arc length on the trajectory.
+   * @param control section end arc length on the trajectory.
+   * @param behavior of this planning factor.
+   * @param safety factor.
+   * @param driving direction.
+   * @param target velocity of the 1st control point.
+   * @param target velocity of the 2nd control point.
+   * @param shift length of the 1st control point.
+   * @param shift length of the 2nd control point.
+   * @param detail information.
+   */
+  template <class PointType>
+  void add(
+    const autoware::experimental::trajectory::Trajectory<PointType> & trajectory,
+    const double ego_s, const double start_s, const double end_s, const uint16_t behavior,
+    const SafetyFactorArray & safety_factors, const bool is_driving_forward = true,
+    const double start_velocity = 0.0, const double end_velocity = 0.0,
+    const double start_shift_length = 0.0, const double end_shift_length = 0.0,
+    const std::string & detail = "")
+  {
+    add(
+      start_s - ego_s, end_s - ego_s,
+      autoware_utils_geometry::get_pose(trajectory.compute(start_s)),
+      autoware_utils_geometry::get_pose(trajectory.compute(end_s)), behavior, safety_factors,
+      is_driving_forward, start_velocity, end_velocity, start_shift_length, end_shift_length,
+      detail);
+  }
+
   /**
    * @brief factor setter for single control point.
    *
@@ -272,6 +337,38 @@ extern template void PlanningFactorInterface::add<autoware_planning_msgs::msg::T
   const Pose &, const uint16_t behavior, const SafetyFactorArray &, const bool, const double,
   const double, const double, const double, const std::string &);
 
+extern template void
+PlanningFactorInterface::add<autoware_internal_planning_msgs::msg::PathPointWithLaneId>(
+  const autoware::experimental::trajectory::Trajectory<
+    autoware_internal_planning_msgs::msg::PathPointWithLaneId> &,
+  const double, const double, const uint16_t behavior, const SafetyFactorArray &, const bool,
+  const double, const double, const std::string &);
+extern template void PlanningFactorInterface::add<autoware_planning_msgs::msg::PathPoint>(
+  const autoware::experimental::trajectory::Trajectory<autoware_planning_msgs::msg::PathPoint> &,
+  const double, const double, const uint16_t behavior, const SafetyFactorArray &, const bool,
+  const double, const double, const std::string &);
+extern template void PlanningFactorInterface::add<autoware_planning_msgs::msg::TrajectoryPoint>(
+  const autoware::experimental::trajectory::Trajectory<
+    autoware_planning_msgs::msg::TrajectoryPoint> &,
+  const double, const double, const uint16_t behavior, const SafetyFactorArray &, const bool,
+  const double, const double, const std::string &);
+
+extern template void
+PlanningFactorInterface::add<autoware_internal_planning_msgs::msg::PathPointWithLaneId>(
+  const autoware::experimental::trajectory::Trajectory<
+    autoware_internal_planning_msgs::msg::PathPointWithLaneId> &,
+  const double, const double, const double, const uint16_t behavior, const SafetyFactorArray &,
+  const bool, const double, const double, const double, const double, const std::string &);
+extern template void PlanningFactorInterface::add<autoware_planning_msgs::msg::PathPoint>(
+  const autoware::experimental::trajectory::Trajectory<autoware_planning_msgs::msg::PathPoint> &,
+  const double, const double, const double, const uint16_t behavior, const SafetyFactorArray &,
+  const bool, const double, const double, const double, const double, const std::string &);
+extern template void PlanningFactorInterface::add<autoware_planning_msgs::msg::TrajectoryPoint>(
+  const autoware::experimental::trajectory::Trajectory<
+    autoware_planning_msgs::msg::TrajectoryPoint> &,
+  const double, const double, const double, const uint16_t behavior, const SafetyFactorArray &,
+  const bool, const double, const double, const double, const double, const std::string &);
+
 }  // namespace autoware::planning_factor_interface
 
 #endif  // AUTOWARE__PLANNING_FACTOR_INTERFACE__PLANNING_FACTOR_INTERFACE_HPP_
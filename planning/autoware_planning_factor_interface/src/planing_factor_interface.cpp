@@ -13,6 +13,9 @@
 // limitations under the License.
 
 #include <autoware/planning_factor_interface/planning_factor_interface.hpp>
+#include <autoware/trajectory/path_point.hpp>
+#include <autoware/trajectory/path_point_with_lane_id.hpp>
+#include <autoware/trajectory/trajectory_point.hpp>
 
 #include <string>
 #include <vector>
@@ -46,4 +49,36 @@ template void PlanningFactorInterface::add<autoware_planning_msgs::msg::Trajecto
   const std::vector<autoware_planning_msgs::msg::TrajectoryPoint> &, const Pose &, const Pose &,
   const Pose &, const uint16_t behavior, const SafetyFactorArray &, const bool, const double,
   const double, const double, const double, const std::string &);
+
+template void
+PlanningFactorInterface::add<autoware_internal_planning_msgs::msg::PathPointWithLaneId>(
+  const autoware::experimental::trajectory::Trajectory<
+    autoware_internal_planning_msgs::msg::PathPointWithLaneId> &,
+  const double, const double, const uint16_t behavior, const SafetyFactorArray &, const bool,
+  const double, const double, const std::string &);
+template void PlanningFactorInterface::add<autoware_planning_msgs::msg::PathPoint>(
+  const autoware::experimental::trajectory::Trajectory<autoware_planning_msgs::msg::PathPoint> &,
+  const double, const double, const uint16_t behavior, const SafetyFactorArray &, const bool,
+  const double, const double, const std::string &);
+template void PlanningFactorInterface::add<autoware_planning_msgs::msg::TrajectoryPoint>(
+  const autoware::experimental::trajectory::Trajectory<
+    autoware_planning_msgs::msg::TrajectoryPoint> &,
+  const double, const double, const uint16_t behavior, const SafetyFactorArray &, const bool,
+  const double, const double, const std::string &);
+
+template void
+PlanningFactorInterface::add<autoware_internal_planning_msgs::msg::PathPointWithLaneId>(
+  const autoware::experimental::trajectory::Trajectory<
+    autoware_internal_planning_msgs::msg::PathPointWithLaneId> &,
+  const double, const double, const double, const uint16_t behavior, const SafetyFactorArray &,
+  const bool, const double, const double, const double, const double, const std::string &);
+template void PlanningFactorInterface::add<autoware_planning_msgs::msg::PathPoint>(
+  const autoware::experimental::trajectory::Trajectory<autoware_planning_msgs::msg::PathPoint> &,
+  const double, const double, const double, const uint16_t behavior, const SafetyFactorArray &,
+  const bool, const double, const double, const double, const double, const std::string &);
+template void PlanningFactorInterface::add<autoware_planning_msgs::msg::TrajectoryPoint>(
+  const autoware::experimental::trajectory::Trajectory<
+    autoware_planning_msgs::msg::TrajectoryPoint> &,
+  const double, const double, const double, const uint16_t behavior, const SafetyFactorArray &,
+  const bool, const double, const double, const double, const double, const std::string &);
 }  // namespace autoware::planning_factor_interface
@@ -12,11 +12,11 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-#include <autoware/motion_utils/trajectory/conversion.hpp>
 #include <autoware/planning_topic_converter/path_to_trajectory.hpp>
 #include <autoware_utils_geometry/geometry.hpp>
 
-#include <vector>
+#include <memory>
+#include <utility>
 
 namespace autoware::planning_topic_converter
 {
@@ -31,16 +31,6 @@ TrajectoryPoint convertToTrajectoryPoint(const PathPoint & point)
   traj_point.heading_rate_rps = point.heading_rate_rps;
   return traj_point;
 }
-
-std::vector<TrajectoryPoint> convertToTrajectoryPoints(const std::vector<PathPoint> & points)
-{
-  std::vector<TrajectoryPoint> traj_points;
-  for (const auto & point : points) {
-    const auto traj_point = convertToTrajectoryPoint(point);
-    traj_points.push_back(traj_point);
-  }
-  return traj_points;
-}
 }  // namespace
 
 PathToTrajectory::PathToTrajectory(const rclcpp::NodeOptions & options)
@@ -50,9 +40,15 @@ PathToTrajectory::PathToTrajectory(const rclcpp::NodeOptions & options)
 
 void PathToTrajectory::process(const Path::ConstSharedPtr msg)
 {
-  const auto trajectory_points = convertToTrajectoryPoints(msg->points);
-  const auto output = autoware::motion_utils::convertToTrajectory(trajectory_points, msg->header);
-  pub_->publish(output);
+  // the points are converted into the message itself, which is moved to the publisher so that it
+  // is not copied again for the intra-process subscribers
+  auto output = std::make_unique<Trajectory>();
+  output->header = msg->header;
+  output->points.reserve(msg->points.size());
+  for (const auto & point : msg->points) {
+    output->points.push_back(convertToTrajectoryPoint(point));
+  }
+  pub_->publish(std::move(output));
 }
 
 }  // namespace autoware::planning_topic_converter
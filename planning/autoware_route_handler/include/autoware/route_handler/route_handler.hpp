@@ -15,6 +15,8 @@
 #ifndef AUTOWARE__ROUTE_HANDLER__ROUTE_HANDLER_HPP_
 #define AUTOWARE__ROUTE_HANDLER__ROUTE_HANDLER_HPP_
 
+#include <autoware/lanelet2_utils/geometry.hpp>
+#include <autoware/lanelet2_utils/kind.hpp>
 #include <autoware_utils_geometry/boost_geometry.hpp>
 #include <rclcpp/logger.hpp>
 
@@ -37,9 +39,14 @@
 #include <lanelet2_routing/RoutingCost.h>
 #include <lanelet2_traffic_rules/TrafficRules.h>
 
+#include <cstdint>
 #include <limits>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -54,12 +61,11 @@ using geometry_msgs::msg::PoseStamped;
 using std_msgs::msg::Header;
 using unique_identifier_msgs::msg::UUID;
 using RouteSections = std::vector<autoware_planning_msgs::msg::LaneletSegment>;
-using RouteRtreeNode = std::pair<autoware_utils_geometry::Box2d, size_t>;
-using RouteRtree = boost::geometry::index::rtree<RouteRtreeNode, boost::geometry::index::rstar<16>>;
 
 enum class Direction { NONE, LEFT, RIGHT };
 enum class PullOverDirection { NONE, LEFT, RIGHT };
 enum class PullOutDirection { NONE, LEFT, RIGHT };
+enum class RouteSearchAlgorithm { DIJKSTRA, ASTAR };
 
 struct ReferencePoint
 {
@@ -75,6 +81,117 @@ struct PiecewiseWaypoints
 };
 using Waypoints = std::vector<PiecewiseWaypoints>;
 
+/**
+ * @brief reference points of the whole center line path of a lanelet sequence, with the waypoints
+ * merged, from which getCenterLinePath slices the requested range.
+ */
+struct CenterLineReferencePath
+{
+  struct Point
+  {
+    geometry_msgs::msg::Point point;
+    size_t lanelet_idx;  //!< @brief index of the lanelet in the lanelet sequence
+    double s;            //!< @brief 2D arc length from the start of the sequence
+    double distance;     //!< @brief 2D distance to the next point in the same lanelet
+  };
+  std::vector<Point> points;
+  std::vector<float> speed_limits;  //!< @brief of the lanelets in the lanelet sequence
+};
+
+/**
+ * @brief CenterLineReferencePath of the lanelet sequences, keyed by the IDs of the lanelets.
+ * @note the cache must be discarded when the map is changed, and it is discarded with the route so
+ * that the number of the sequences stays small.
+ */
+class CenterLineReferencePathCache
+{
+public:
+  /**
+   * @brief get the cached path of the lanelet sequence, or nullptr if it is not cached.
+   * @note thread-safe.
+   */
+  std::shared_ptr<const CenterLineReferencePath> find(const lanelet::Ids & lanelet_ids) const;
+
+  /**
+   * @brief cache the path of the lanelet sequence. All the paths are discarded when the number of
+   * the sequences exceeds the limit.
+   * @note thread-safe.
+   */
+  void insert(
+    const lanelet::Ids & lanelet_ids, const std::shared_ptr<const CenterLineReferencePath> & path);
+
+private:
+  static constexpr size_t max_size_{64};
+  mutable std::mutex mutex_;
+  std::map<lanelet::Ids, std::shared_ptr<const CenterLineReferencePath>> paths_;
+};
+
+/**
+ * @brief the lanelets around a route: the route lanelets, the lanelets adjacent to them and the
+ * lanelets conflicting with them, with their own spatial index and a dense index for their IDs.
+ * @details built once per route, so that the queries of each planning cycle touch a working set
+ * of the size of the route instead of the map. The lanelets are ordered by their role, the route
+ * lanelets first.
+ */
+class RouteLaneletSubset
+{
+public:
+  enum class Role : uint8_t {
+    ROUTE,        //!< @brief route lanelet
+    ADJACENT,     //!< @brief following, previous, or sharing a bound with a route lanelet
+    CONFLICTING,  //!< @brief crossing a route lanelet in one of the routing graphs
+  };
+  using RtreeNode = std::pair<autoware_utils_geometry::Box2d, size_t>;
+  using Rtree = boost::geometry::index::rtree<RtreeNode, boost::geometry::index::rstar<16>>;
+
+  RouteLaneletSubset() = default;
+
+  /**
+   * @param route_lanelets the route lanelets
+   * @param lanelet_map the map of the route lanelets, to find the lanelets sharing their bounds
+   * @param routing_graph the vehicle routing graph of the map
+   * @param overall_graphs the routing graphs of all the participants, e.g. to find the crosswalks
+   * crossing the route, or nullptr
+   */
+  RouteLaneletSubset(
+    const lanelet::ConstLanelets & route_lanelets, const lanelet::LaneletMap & lanelet_map,
+    const lanelet::routing::RoutingGraph & routing_graph,
+    const lanelet::routing::RoutingGraphContainer * overall_graphs);
+
+  size_t size() const { return lanelets_.size(); }
+  bool empty() const { return lanelets_.empty(); }
+  size_t route_lanelet_num() const { return route_lanelet_num_; }
+
+  /// @brief the dense index of the lanelet, or nullopt if it is not around the route
+  std::optional<size_t> find(const lanelet::Id id) const;
+  bool contains(const lanelet::Id id) const { return index_.count(id) > 0; }
+  bool is_route_lanelet(const lanelet::Id id) const;
+
+  const lanelet::ConstLanelets & lanelets() const { return lanelets_; }
+  const lanelet::ConstLanelet & lanelet(const size_t index) const { return lanelets_[index]; }
+  const lanelet::BasicPolygon2d & polygon(const size_t index) const { return polygons_[index]; }
+  Role role(const size_t index) const;
+
+  /// @brief the bounding boxes of the lanelets, whose values are the dense indices
+  const Rtree & rtree() const { return rtree_; }
+
+  /// @brief the indices of the lanelets whose bounding box intersects the box
+  std::vector<size_t> search(const autoware_utils_geometry::Box2d & box) const;
+
+  /// @brief the lanelets containing the point, in the order of the indices
+  lanelet::ConstLanelets lanelets_at(const lanelet::BasicPoint2d & point) const;
+
+private:
+  void add(const lanelet::ConstLanelet & lanelet);
+
+  lanelet::ConstLanelets lanelets_;
+  std::vector<lanelet::BasicPolygon2d> polygons_;  //!< @brief of lanelets_
+  std::unordered_map<lanelet::Id, size_t> index_;
+  Rtree rtree_;
+  size_t route_lanelet_num_{0};
+  size_t adjacent_lanelet_end_{0};  //!< @brief end of the adjacent lanelets in lanelets_
+};
+
 class RouteHandler
 {
 public:
@@ -86,6 +203,7 @@ public:
   void setRoute(const LaneletRoute & route_msg);
   void setRouteLanelets(const lanelet::ConstLanelets & path_lanelets);
   void clearRoute();
+  void setRouteSearchAlgorithm(const RouteSearchAlgorithm algorithm);
 
   // const methods
 
@@ -102,6 +220,13 @@ public:
   lanelet::traffic_rules::TrafficRulesPtr getTrafficRulesPtr() const;
   std::shared_ptr<const lanelet::routing::RoutingGraphContainer> getOverallGraphPtr() const;
   lanelet::LaneletMapPtr getLaneletMapPtr() const;
+
+  /**
+   * @brief the lanelets around the route, to query them without touching the whole map.
+   * @note never nullptr, and empty without a route. It is shared by the copies of the handler
+   * with the same route.
+   */
+  std::shared_ptr<const RouteLaneletSubset> getRouteLaneletSubset() const;
   static bool isNoDrivableLane(const lanelet::ConstLanelet & llt);
 
   // for routing
@@ -297,6 +422,7 @@ public:
     const double forward_distance = std::numeric_limits<double>::max()) const;
   bool isShoulderLanelet(const lanelet::ConstLanelet & lanelet) const;
   bool isRouteLanelet(const lanelet::ConstLanelet & lanelet) const;
+  bool isRouteLanelet(const lanelet::Id lanelet_id) const;
   bool isRoadLanelet(const lanelet::ConstLanelet & lanelet) const;
   lanelet::ConstLanelets getPreferredLanelets() const;
 
@@ -353,9 +479,36 @@ private:
   lanelet::routing::RoutingGraphPtr routing_graph_ptr_;
   lanelet::traffic_rules::TrafficRulesPtr traffic_rules_ptr_;
   std::shared_ptr<const lanelet::routing::RoutingGraphContainer> overall_graphs_ptr_;
+  std::shared_ptr<const autoware::experimental::lanelet2_utils::LaneletKindTable>
+    lanelet_kind_table_ptr_;
   lanelet::LaneletMapPtr lanelet_map_ptr_;
   lanelet::ConstLanelets route_lanelets_;
-  RouteRtree route_lanelets_rtree_;
+  //! @brief of route_lanelets_, shared by the copies of the handler with the same route
+  std::shared_ptr<const RouteLaneletSubset> route_lanelet_subset_{
+    std::make_shared<const RouteLaneletSubset>()};
+
+  /// @brief relations of a lanelet, queried from the routing graph and the map once per route
+  struct LaneletTopology
+  {
+    lanelet::ConstLanelets following;
+    lanelet::ConstLanelets previous;
+    std::optional<lanelet::ConstLanelet> right;  //!< @brief routable, or else adjacent
+    std::optional<lanelet::ConstLanelet> left;   //!< @brief routable, or else adjacent
+    lanelet::Lanelets right_opposite;
+    lanelet::Lanelets left_opposite;
+  };
+  //! @brief of the route and the adjacent lanelets of route_lanelet_subset_, by their index in it
+  std::vector<LaneletTopology> route_topologies_;
+
+  //! @brief of the lanelets of the map, shared by the copies of the handler with the same map
+  std::shared_ptr<autoware::experimental::lanelet2_utils::CenterlineArcLengthCache>
+    centerline_arc_length_cache_{
+      std::make_shared<autoware::experimental::lanelet2_utils::CenterlineArcLengthCache>()};
+
+  //! @brief of the center line paths, shared by the copies of the handler with the same route
+  std::shared_ptr<CenterLineReferencePathCache> center_line_reference_path_cache_{
+    std::make_shared<CenterLineReferencePathCache>()};
+
   lanelet::ConstLanelets preferred_lanelets_;
   lanelet::ConstLanelets start_lanelets_;
   lanelet::ConstLanelets goal_lanelets_;
@@ -366,17 +519,26 @@ private:
   bool is_map_msg_ready_{false};
   bool is_handler_ready_{false};
 
+  // search between the checkpoints, A* finds a path as short as Dijkstra's on the same edges
+  RouteSearchAlgorithm route_search_algorithm_{RouteSearchAlgorithm::DIJKSTRA};
+
   // save original(not modified) route start pose for start planer execution
   Pose original_start_pose_;
   Pose original_goal_pose_;
 
   // non-const methods
   void setLaneletsFromRouteMsg();
+  void buildRouteLaneletsIndex();
+  void buildRouteTopologies();
 
   // const methods
   // for routing
   lanelet::ConstLanelets getMainLanelets(const lanelet::ConstLanelets & path_lanelets) const;
 
+  // for path
+  std::shared_ptr<const CenterLineReferencePath> getCenterLineReferencePath(
+    const lanelet::ConstLanelets & lanelet_sequence) const;
+
   // for lanelet
   lanelet::ConstLanelets getRouteLanelets() const;
   lanelet::ConstLanelets getLaneletSequenceUpTo(
@@ -398,6 +560,12 @@ private:
   lanelet::ConstLanelets getPreviousLaneletSequence(
     const lanelet::ConstLanelets & lanelet_sequence) const;
   lanelet::ConstLanelets getNeighborsWithinRoute(const lanelet::ConstLanelet & lanelet) const;
+  /// @brief cached relations of the lanelet, or nullptr if it is not around the route
+  const LaneletTopology * findRouteTopology(const lanelet::ConstLanelet & lanelet) const;
+  std::optional<lanelet::ConstLanelet> getRoutableOrAdjacentRightLanelet(
+    const lanelet::ConstLanelet & lanelet) const;
+  std::optional<lanelet::ConstLanelet> getRoutableOrAdjacentLeftLanelet(
+    const lanelet::ConstLanelet & lanelet) const;
 
   // for path
 
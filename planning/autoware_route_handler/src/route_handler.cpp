@@ -15,6 +15,8 @@
 #include "autoware/route_handler/route_handler.hpp"
 
 #include <autoware/lanelet2_utils/kind.hpp>
+#include <autoware/lanelet2_utils/map_registry.hpp>
+#include <autoware/lanelet2_utils/route_search.hpp>
 #include <autoware_lanelet2_extension/io/autoware_osm_parser.hpp>
 #include <autoware_lanelet2_extension/utility/message_conversion.hpp>
 #include <autoware_lanelet2_extension/utility/query.hpp>
@@ -30,6 +32,7 @@
 #include <autoware_planning_msgs/msg/lanelet_primitive.hpp>
 #include <autoware_planning_msgs/msg/path.hpp>
 
+#include <boost/geometry/algorithms/covered_by.hpp>
 #include <boost/geometry/algorithms/detail/comparable_distance/interface.hpp>
 #include <boost/geometry/algorithms/detail/envelope/interface.hpp>
 #include <boost/geometry/index/distance_predicates.hpp>
@@ -209,6 +212,110 @@ std::string convertLaneletsIdToString(const lanelet::ConstLanelets & lanelets)
 }
 }  // namespace
 
+RouteLaneletSubset::RouteLaneletSubset(
+  const lanelet::ConstLanelets & route_lanelets, const lanelet::LaneletMap & lanelet_map,
+  const lanelet::routing::RoutingGraph & routing_graph,
+  const lanelet::routing::RoutingGraphContainer * overall_graphs)
+{
+  std::for_each(route_lanelets.begin(), route_lanelets.end(), [&](const auto & l) { add(l); });
+  route_lanelet_num_ = lanelets_.size();
+
+  const auto add_lanelets = [&](const lanelet::ConstLanelets & lanelets) {
+    std::for_each(lanelets.begin(), lanelets.end(), [&](const auto & l) { add(l); });
+  };
+  for (size_t i = 0; i < route_lanelet_num_; ++i) {
+    // a copy, since adding the lanelets reallocates lanelets_
+    const auto lanelet = lanelets_[i];
+    add_lanelets(routing_graph.following(lanelet));
+    add_lanelets(routing_graph.previous(lanelet));
+    // the lanes next to it, the opposite lanes and the shoulders, routable or not
+    add_lanelets(lanelet_map.laneletLayer.findUsages(lanelet.leftBound()));
+    add_lanelets(lanelet_map.laneletLayer.findUsages(lanelet.rightBound()));
+  }
+  adjacent_lanelet_end_ = lanelets_.size();
+
+  for (size_t i = 0; i < route_lanelet_num_; ++i) {
+    const auto lanelet = lanelets_[i];
+    for (const auto & conflicting : routing_graph.conflicting(lanelet)) {
+      if (conflicting.isLanelet()) {
+        add(*conflicting.lanelet());
+      }
+    }
+    if (overall_graphs) {
+      for (const auto & conflicting_in_graph : overall_graphs->conflictingInGraphs(lanelet)) {
+        add_lanelets(conflicting_in_graph.second);
+      }
+    }
+  }
+
+  std::vector<RtreeNode> rtree_nodes;
+  rtree_nodes.reserve(lanelets_.size());
+  for (size_t i = 0; i < lanelets_.size(); ++i) {
+    rtree_nodes.emplace_back(
+      boost::geometry::return_envelope<autoware_utils_geometry::Box2d>(polygons_[i]), i);
+  }
+  rtree_ = Rtree(rtree_nodes);
+}
+
+void RouteLaneletSubset::add(const lanelet::ConstLanelet & lanelet)
+{
+  if (!index_.emplace(lanelet.id(), lanelets_.size()).second) {
+    return;
+  }
+  // the inverted lanelets are stored as they are in the map
+  const auto llt = lanelet.inverted() ? lanelet.invert() : lanelet;
+  lanelets_.push_back(llt);
+  // the polygons are kept since building one from the bounds of a lanelet allocates
+  polygons_.push_back(llt.polygon2d().basicPolygon());
+}
+
+std::optional<size_t> RouteLaneletSubset::find(const lanelet::Id id) const
+{
+  const auto it = index_.find(id);
+  if (it == index_.end()) {
+    return std::nullopt;
+  }
+  return it->second;
+}
+
+bool RouteLaneletSubset::is_route_lanelet(const lanelet::Id id) const
+{
+  const auto index = find(id);
+  return index && *index < route_lanelet_num_;
+}
+
+RouteLaneletSubset::Role RouteLaneletSubset::role(const size_t index) const
+{
+  if (index < route_lanelet_num_) {
+    return Role::ROUTE;
+  }
+  return index < adjacent_lanelet_end_ ? Role::ADJACENT : Role::CONFLICTING;
+}
+
+std::vector<size_t> RouteLaneletSubset::search(const autoware_utils_geometry::Box2d & box) const
+{
+  std::vector<size_t> indices;
+  for (auto it = rtree_.qbegin(boost::geometry::index::intersects(box)); it != rtree_.qend();
+       ++it) {
+    indices.push_back(it->second);
+  }
+  std::sort(indices.begin(), indices.end());
+  return indices;
+}
+
+lanelet::ConstLanelets RouteLaneletSubset::lanelets_at(const lanelet::BasicPoint2d & point) const
+{
+  lanelet::ConstLanelets lanelets;
+  const autoware_utils_geometry::Point2d p{point.x(), point.y()};
+  for (const auto index : search(autoware_utils_geometry::Box2d{p, p})) {
+    // "search" is an approximation with the bounding boxes
+    if (boost::geometry::covered_by(point, polygons_[index])) {
+      lanelets.push_back(lanelets_[index]);
+    }
+  }
+  return lanelets;
+}
+
 RouteHandler::RouteHandler(const LaneletMapBin & map_msg)
 {
   setMap(map_msg);
@@ -217,9 +324,14 @@ RouteHandler::RouteHandler(const LaneletMapBin & map_msg)
 
 void RouteHandler::setMap(const LaneletMapBin & map_msg)
 {
-  lanelet_map_ptr_ = std::make_shared<lanelet::LaneletMap>();
-  lanelet::utils::conversion::fromBinMsg(
-    map_msg, lanelet_map_ptr_, &traffic_rules_ptr_, &routing_graph_ptr_);
+  // The map is shared with the other components of the process which receive the same map
+  const auto shared_map = autoware::experimental::lanelet2_utils::get_shared_lanelet_map(map_msg);
+  lanelet_map_ptr_ = shared_map.lanelet_map;
+  traffic_rules_ptr_ = shared_map.traffic_rules;
+  routing_graph_ptr_ = shared_map.routing_graph;
+  centerline_arc_length_cache_ =
+    std::make_shared<autoware::experimental::lanelet2_utils::CenterlineArcLengthCache>();
+  center_line_reference_path_cache_ = std::make_shared<CenterLineReferencePathCache>();
   const auto map_major_version_opt =
     lanelet::io_handlers::parseMajorVersion(map_msg.version_map_format);
   if (!map_major_version_opt) {
@@ -231,17 +343,10 @@ void RouteHandler::setMap(const LaneletMapBin & map_msg)
       map_msg.version_map_format.c_str(), static_cast<int>(lanelet::autoware::version));
   }
 
-  const auto traffic_rules = lanelet::traffic_rules::TrafficRulesFactory::create(
-    lanelet::Locations::Germany, lanelet::Participants::Vehicle);
-  const auto pedestrian_rules = lanelet::traffic_rules::TrafficRulesFactory::create(
-    lanelet::Locations::Germany, lanelet::Participants::Pedestrian);
-  const lanelet::routing::RoutingGraphConstPtr vehicle_graph =
-    lanelet::routing::RoutingGraph::build(*lanelet_map_ptr_, *traffic_rules);
-  const lanelet::routing::RoutingGraphConstPtr pedestrian_graph =
-    lanelet::routing::RoutingGraph::build(*lanelet_map_ptr_, *pedestrian_rules);
-  const lanelet::routing::RoutingGraphContainer overall_graphs({vehicle_graph, pedestrian_graph});
-  overall_graphs_ptr_ =
-    std::make_shared<const lanelet::routing::RoutingGraphContainer>(overall_graphs);
+  // The vehicle graph of the container is routing_graph_ptr_, and the graphs are shared too
+  overall_graphs_ptr_ = autoware::experimental::lanelet2_utils::get_shared_overall_graphs(map_msg);
+  lanelet_kind_table_ptr_ =
+    autoware::experimental::lanelet2_utils::get_shared_lanelet_kind_table(map_msg);
   lanelet::ConstLanelets all_lanelets = lanelet::utils::query::laneletLayer(lanelet_map_ptr_);
 
   is_map_msg_ready_ = true;
@@ -274,6 +379,7 @@ void RouteHandler::setRoute(const LaneletRoute & route_msg)
     }
     route_ptr_ = std::make_shared<LaneletRoute>(route_msg);
     is_handler_ready_ = false;
+    center_line_reference_path_cache_ = std::make_shared<CenterLineReferencePathCache>();
     setLaneletsFromRouteMsg();
   } else {
     RCLCPP_ERROR(
@@ -381,24 +487,63 @@ void RouteHandler::setRouteLanelets(const lanelet::ConstLanelets & path_lanelets
 
   route_lanelets_.clear();
   route_lanelets_.reserve(route_lanelets_id.size());
-  std::vector<RouteRtreeNode> rtree_nodes;
-  rtree_nodes.reserve(route_lanelets_id.size());
-  size_t i = 0;
   for (const auto & id : route_lanelets_id) {
     route_lanelets_.push_back(lanelet_map_ptr_->laneletLayer.get(id));
-    rtree_nodes.emplace_back(
-      boost::geometry::return_envelope<autoware_utils_geometry::Box2d>(
-        route_lanelets_.back().polygon2d().basicPolygon()),
-      i++);
   }
-  route_lanelets_rtree_ = RouteRtree(rtree_nodes);
+  buildRouteLaneletsIndex();
   is_handler_ready_ = true;
 }
 
+void RouteHandler::buildRouteLaneletsIndex()
+{
+  if (route_lanelets_.empty()) {
+    route_lanelet_subset_ = std::make_shared<const RouteLaneletSubset>();
+  } else {
+    route_lanelet_subset_ = std::make_shared<const RouteLaneletSubset>(
+      route_lanelets_, *lanelet_map_ptr_, *routing_graph_ptr_, overall_graphs_ptr_.get());
+  }
+
+  buildRouteTopologies();
+}
+
+void RouteHandler::buildRouteTopologies()
+{
+  // the planners repeatedly walk the route and the lanes next to it, so the relations of those
+  // lanelets are queried once here instead of from the routing graph on every call. They are
+  // indexed like the route and the adjacent lanelets of the subset, which come first in it.
+  route_topologies_.clear();
+  const auto & subset = *route_lanelet_subset_;
+  route_topologies_.reserve(subset.size());
+  for (size_t i = 0;
+       i < subset.size() && subset.role(i) != RouteLaneletSubset::Role::CONFLICTING; ++i) {
+    const auto & lanelet = subset.lanelet(i);
+    LaneletTopology topology;
+    topology.following = routing_graph_ptr_->following(lanelet);
+    topology.previous = routing_graph_ptr_->previous(lanelet);
+    topology.right = getRoutableOrAdjacentRightLanelet(lanelet);
+    topology.left = getRoutableOrAdjacentLeftLanelet(lanelet);
+    topology.right_opposite = getRightOppositeLanelets(lanelet);
+    topology.left_opposite = getLeftOppositeLanelets(lanelet);
+    route_topologies_.push_back(std::move(topology));
+  }
+}
+
+const RouteHandler::LaneletTopology * RouteHandler::findRouteTopology(
+  const lanelet::ConstLanelet & lanelet) const
+{
+  // the relations of an inverted lanelet are not the ones of the lanelet
+  if (lanelet.inverted()) {
+    return nullptr;
+  }
+  // the topologies are being built when the index is not below their number
+  const auto index = route_lanelet_subset_->find(lanelet.id());
+  return index && *index < route_topologies_.size() ? &route_topologies_[*index] : nullptr;
+}
+
 void RouteHandler::clearRoute()
 {
   route_lanelets_.clear();
-  route_lanelets_rtree_.clear();
+  buildRouteLaneletsIndex();
   preferred_lanelets_.clear();
   start_lanelets_.clear();
   goal_lanelets_.clear();
@@ -406,13 +551,18 @@ void RouteHandler::clearRoute()
   is_handler_ready_ = false;
 }
 
+void RouteHandler::setRouteSearchAlgorithm(const RouteSearchAlgorithm algorithm)
+{
+  route_search_algorithm_ = algorithm;
+}
+
 void RouteHandler::setLaneletsFromRouteMsg()
 {
   if (!route_ptr_ || !is_map_msg_ready_) {
     return;
   }
   route_lanelets_.clear();
-  route_lanelets_rtree_.clear();
+  buildRouteLaneletsIndex();
   preferred_lanelets_.clear();
   const bool is_route_valid = lanelet::utils::route::isRouteValid(*route_ptr_, lanelet_map_ptr_);
   if (!is_route_valid) {
@@ -424,25 +574,18 @@ void RouteHandler::setLaneletsFromRouteMsg()
     primitive_size += route_section.primitives.size();
   }
   route_lanelets_.reserve(primitive_size);
-  std::vector<RouteRtreeNode> rtree_nodes;
-  rtree_nodes.reserve(primitive_size);
-  size_t i = 0;
 
   for (const auto & route_section : route_ptr_->segments) {
     for (const auto & primitive : route_section.primitives) {
       const auto id = primitive.id;
       const auto & llt = lanelet_map_ptr_->laneletLayer.get(id);
       route_lanelets_.push_back(llt);
-      rtree_nodes.emplace_back(
-        boost::geometry::return_envelope<autoware_utils_geometry::Box2d>(
-          llt.polygon2d().basicPolygon()),
-        i++);
       if (id == route_section.preferred_primitive.id) {
         preferred_lanelets_.push_back(llt);
       }
     }
   }
-  route_lanelets_rtree_ = RouteRtree(rtree_nodes);
+  buildRouteLaneletsIndex();
   goal_lanelets_.clear();
   start_lanelets_.clear();
   if (!route_ptr_->segments.empty()) {
@@ -565,13 +708,11 @@ lanelet::Id RouteHandler::getGoalLaneId() const
 bool RouteHandler::getGoalLanelet(lanelet::ConstLanelet * goal_lanelet) const
 {
   const lanelet::Id goal_lane_id = getGoalLaneId();
-  for (const auto & llt : route_lanelets_) {
-    if (llt.id() == goal_lane_id) {
-      *goal_lanelet = llt;
-      return true;
-    }
+  if (!isRouteLanelet(goal_lane_id)) {
+    return false;
   }
-  return false;
+  *goal_lanelet = lanelet_map_ptr_->laneletLayer.get(goal_lane_id);
+  return true;
 }
 
 bool RouteHandler::isInGoalRouteSection(const lanelet::ConstLanelet & lanelet) const
@@ -613,7 +754,7 @@ lanelet::ConstLanelets RouteHandler::getLaneletSequenceAfter(
   const lanelet::ConstLanelet & lanelet, const double min_length) const
 {
   lanelet::ConstLanelets lanelet_sequence_forward;
-  if (!exists(route_lanelets_, lanelet)) {
+  if (!isRouteLanelet(lanelet)) {
     return lanelet_sequence_forward;
   }
 
@@ -641,7 +782,7 @@ lanelet::ConstLanelets RouteHandler::getLaneletSequenceUpTo(
   const lanelet::ConstLanelet & lanelet, const double min_length) const
 {
   lanelet::ConstLanelets lanelet_sequence_backward;
-  if (!exists(route_lanelets_, lanelet)) {
+  if (!isRouteLanelet(lanelet)) {
     return lanelet_sequence_backward;
   }
 
@@ -702,7 +843,7 @@ lanelet::ConstLanelets RouteHandler::getLaneletSequence(
   }
 
   lanelet::ConstLanelets lanelet_sequence;
-  if (!exists(route_lanelets_, lanelet)) {
+  if (!isRouteLanelet(lanelet)) {
     return lanelet_sequence;
   }
 
@@ -735,7 +876,7 @@ lanelet::ConstLanelets RouteHandler::getLaneletSequence(
   const lanelet::ConstLanelet & lanelet, const Pose & current_pose, const double backward_distance,
   const double forward_distance) const
 {
-  if (!exists(route_lanelets_, lanelet)) {
+  if (!isRouteLanelet(lanelet)) {
     return {};
   }
 
@@ -1002,25 +1143,30 @@ bool RouteHandler::getClosestLaneletWithinRoute(
     return false;
   }
   const auto search_point = lanelet::BasicPoint2d(search_pose.position.x, search_pose.position.y);
-  const auto query_nearest = boost::geometry::index::nearest(search_point, route_lanelets_.size());
+  const auto & subset = *route_lanelet_subset_;
+  const auto query_nearest =
+    boost::geometry::index::nearest(search_point, subset.route_lanelet_num()) &&
+    boost::geometry::index::satisfies([&](const RouteLaneletSubset::RtreeNode & node) {
+      return node.second < subset.route_lanelet_num();
+    });
   auto min_dist_to_route_lanelet = std::numeric_limits<double>::max();
   size_t nearest_id = 0;
   // search starting from the nearest bounding box
-  for (auto query_it = route_lanelets_rtree_.qbegin(query_nearest);
-       query_it != route_lanelets_rtree_.qend(); ++query_it) {
+  for (auto query_it = subset.rtree().qbegin(query_nearest); query_it != subset.rtree().qend();
+       ++query_it) {
     const auto dist_to_bbox = boost::geometry::comparable_distance(search_point, query_it->first);
     // stop when the distance to the bounding box is larger than the min distance found so far
     if (dist_to_bbox > min_dist_to_route_lanelet) {
       break;
     }
-    const auto dist = boost::geometry::comparable_distance(
-      search_point, route_lanelets_[query_it->second].polygon2d().basicPolygon());
+    const auto dist =
+      boost::geometry::comparable_distance(search_point, subset.polygon(query_it->second));
     if (dist < min_dist_to_route_lanelet) {
       min_dist_to_route_lanelet = dist;
       nearest_id = query_it->second;
     }
   }
-  *closest_lanelet = route_lanelets_[nearest_id];
+  *closest_lanelet = subset.lanelet(nearest_id);
   return true;
 }
 
@@ -1040,21 +1186,26 @@ bool RouteHandler::getClosestLaneletWithConstrainsWithinRoute(
   }
   const auto pose_yaw = tf2::getYaw(search_pose.orientation);
   const auto search_point = lanelet::BasicPoint2d(search_pose.position.x, search_pose.position.y);
-  const auto query_nearest = boost::geometry::index::nearest(search_point, route_lanelets_.size());
+  const auto & subset = *route_lanelet_subset_;
+  const auto query_nearest =
+    boost::geometry::index::nearest(search_point, subset.route_lanelet_num()) &&
+    boost::geometry::index::satisfies([&](const RouteLaneletSubset::RtreeNode & node) {
+      return node.second < subset.route_lanelet_num();
+    });
   auto min_dist_to_route_lanelet = std::numeric_limits<double>::max();
   auto min_angle_diff_to_route_lanelet = std::numeric_limits<double>::max();
   size_t nearest_id = 0;
   // search starting from the nearest bounding box
-  for (auto query_it = route_lanelets_rtree_.qbegin(query_nearest);
-       query_it != route_lanelets_rtree_.qend(); ++query_it) {
+  for (auto query_it = subset.rtree().qbegin(query_nearest); query_it != subset.rtree().qend();
+       ++query_it) {
     const auto dist_to_bbox = boost::geometry::comparable_distance(search_point, query_it->first);
     // stop when the distance to the bounding box is larger than the min distance found so far
     if (dist_to_bbox > min_dist_to_route_lanelet || dist_to_bbox > dist_threshold) {
       break;
     }
-    const auto & lanelet = route_lanelets_[query_it->second];
+    const auto & lanelet = subset.lanelet(query_it->second);
     const auto dist =
-      boost::geometry::comparable_distance(search_point, lanelet.polygon2d().basicPolygon());
+      boost::geometry::comparable_distance(search_point, subset.polygon(query_it->second));
     const double lanelet_angle = lanelet::utils::getLaneletAngle(lanelet, search_pose.position);
     const double angle_diff =
       std::abs(autoware_utils_geometry::normalize_radian(lanelet_angle - pose_yaw));
@@ -1072,7 +1223,7 @@ bool RouteHandler::getClosestLaneletWithConstrainsWithinRoute(
   if (min_dist_to_route_lanelet > dist_threshold) {
     return false;
   }
-  *closest_lanelet = route_lanelets_[nearest_id];
+  *closest_lanelet = subset.lanelet(nearest_id);
   return true;
 }
 
@@ -1109,10 +1260,10 @@ bool RouteHandler::getNextLaneletsWithinRoute(
 
   const auto start_lane_id = route_ptr_->segments.front().preferred_primitive.id;
 
-  const auto following_lanelets = routing_graph_ptr_->following(lanelet);
+  const auto following_lanelets = getNextLanelets(lanelet);
   next_lanelets->clear();
   for (const auto & llt : following_lanelets) {
-    if (start_lane_id != llt.id() && exists(route_lanelets_, llt)) {
+    if (start_lane_id != llt.id() && isRouteLanelet(llt)) {
       next_lanelets->push_back(llt);
     }
   }
@@ -1132,6 +1283,9 @@ bool RouteHandler::getNextLaneletWithinRoute(
 
 lanelet::ConstLanelets RouteHandler::getNextLanelets(const lanelet::ConstLanelet & lanelet) const
 {
+  if (const auto * topology = findRouteTopology(lanelet)) {
+    return topology->following;
+  }
   return routing_graph_ptr_->following(lanelet);
 }
 
@@ -1141,10 +1295,10 @@ bool RouteHandler::getPreviousLaneletsWithinRoute(
   if (exists(start_lanelets_, lanelet)) {
     return false;
   }
-  const auto candidate_lanelets = routing_graph_ptr_->previous(lanelet);
+  const auto candidate_lanelets = getPreviousLanelets(lanelet);
   prev_lanelets->clear();
   for (const auto & llt : candidate_lanelets) {
-    if (exists(route_lanelets_, llt)) {
+    if (isRouteLanelet(llt)) {
       prev_lanelets->push_back(llt);
     }
   }
@@ -1154,6 +1308,9 @@ bool RouteHandler::getPreviousLaneletsWithinRoute(
 lanelet::ConstLanelets RouteHandler::getPreviousLanelets(
   const lanelet::ConstLanelet & lanelet) const
 {
+  if (const auto * topology = findRouteTopology(lanelet)) {
+    return topology->previous;
+  }
   return routing_graph_ptr_->previous(lanelet);
 }
 
@@ -1175,16 +1332,9 @@ std::optional<lanelet::ConstLanelet> RouteHandler::getRightLanelet(
     if (right_shoulder_lanelet) return *right_shoulder_lanelet;
   }
 
-  // routable lane
-  const auto & right_lane = routing_graph_ptr_->right(lanelet);
+  const auto right_lane = getRoutableOrAdjacentRightLanelet(lanelet);
   if (right_lane) {
-    return *right_lane;
-  }
-
-  // non-routable lane (e.g. lane change infeasible)
-  const auto & adjacent_right_lane = routing_graph_ptr_->adjacentRight(lanelet);
-  if (adjacent_right_lane) {
-    return *adjacent_right_lane;
+    return right_lane;
   }
 
   // same root right lanelet
@@ -1241,16 +1391,9 @@ std::optional<lanelet::ConstLanelet> RouteHandler::getLeftLanelet(
     if (left_shoulder_lanelet) return *left_shoulder_lanelet;
   }
 
-  // routable lane
-  const auto & left_lane = routing_graph_ptr_->left(lanelet);
+  const auto left_lane = getRoutableOrAdjacentLeftLanelet(lanelet);
   if (left_lane) {
-    return *left_lane;
-  }
-
-  // non-routable lane (e.g. lane change infeasible)
-  const auto & adjacent_left_lane = routing_graph_ptr_->adjacentLeft(lanelet);
-  if (adjacent_left_lane) {
-    return *adjacent_left_lane;
+    return left_lane;
   }
 
   // same root right lanelet
@@ -1292,6 +1435,10 @@ std::optional<lanelet::ConstLanelet> RouteHandler::getLeftLanelet(
 lanelet::Lanelets RouteHandler::getRightOppositeLanelets(
   const lanelet::ConstLanelet & lanelet) const
 {
+  if (const auto * topology = findRouteTopology(lanelet)) {
+    return topology->right_opposite;
+  }
+
   const auto opposite_candidate_lanelets =
     lanelet_map_ptr_->laneletLayer.findUsages(lanelet.rightBound().invert());
 
@@ -1395,6 +1542,10 @@ lanelet::ConstLanelets RouteHandler::getAllRightSharedLinestringLanelets(
 
 lanelet::Lanelets RouteHandler::getLeftOppositeLanelets(const lanelet::ConstLanelet & lanelet) const
 {
+  if (const auto * topology = findRouteTopology(lanelet)) {
+    return topology->left_opposite;
+  }
+
   const auto opposite_candidate_lanelets =
     lanelet_map_ptr_->laneletLayer.findUsages(lanelet.leftBound().invert());
 
@@ -1410,6 +1561,48 @@ lanelet::Lanelets RouteHandler::getLeftOppositeLanelets(const lanelet::ConstLane
   return opposite_lanelets;
 }
 
+std::optional<lanelet::ConstLanelet> RouteHandler::getRoutableOrAdjacentRightLanelet(
+  const lanelet::ConstLanelet & lanelet) const
+{
+  if (const auto * topology = findRouteTopology(lanelet)) {
+    return topology->right;
+  }
+
+  // routable lane
+  const auto & right_lane = routing_graph_ptr_->right(lanelet);
+  if (right_lane) {
+    return *right_lane;
+  }
+
+  // non-routable lane (e.g. lane change infeasible)
+  const auto & adjacent_right_lane = routing_graph_ptr_->adjacentRight(lanelet);
+  if (adjacent_right_lane) {
+    return *adjacent_right_lane;
+  }
+  return std::nullopt;
+}
+
+std::optional<lanelet::ConstLanelet> RouteHandler::getRoutableOrAdjacentLeftLanelet(
+  const lanelet::ConstLanelet & lanelet) const
+{
+  if (const auto * topology = findRouteTopology(lanelet)) {
+    return topology->left;
+  }
+
+  // routable lane
+  const auto & left_lane = routing_graph_ptr_->left(lanelet);
+  if (left_lane) {
+    return *left_lane;
+  }
+
+  // non-routable lane (e.g. lane change infeasible)
+  const auto & adjacent_left_lane = routing_graph_ptr_->adjacentLeft(lanelet);
+  if (adjacent_left_lane) {
+    return *adjacent_left_lane;
+  }
+  return std::nullopt;
+}
+
 lanelet::ConstLanelet RouteHandler::getMostRightLanelet(
   const lanelet::ConstLanelet & lanelet, const bool enable_same_root,
   const bool get_shoulder_lane) const
@@ -1625,12 +1818,36 @@ std::vector<double> RouteHandler::getLateralIntervalsToPreferredLane(
   return {};
 }
 
-PathWithLaneId RouteHandler::getCenterLinePath(
-  const lanelet::ConstLanelets & lanelet_sequence, const double s_start, const double s_end,
-  bool use_exact) const
+std::shared_ptr<const CenterLineReferencePath> CenterLineReferencePathCache::find(
+  const lanelet::Ids & lanelet_ids) const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto it = paths_.find(lanelet_ids);
+  return it != paths_.end() ? it->second : nullptr;
+}
+
+void CenterLineReferencePathCache::insert(
+  const lanelet::Ids & lanelet_ids, const std::shared_ptr<const CenterLineReferencePath> & path)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (paths_.size() >= max_size_) {
+    paths_.clear();
+  }
+  paths_.emplace(lanelet_ids, path);
+}
+
+std::shared_ptr<const CenterLineReferencePath> RouteHandler::getCenterLineReferencePath(
+  const lanelet::ConstLanelets & lanelet_sequence) const
 {
-  using lanelet::utils::to2D;
-  using lanelet::utils::conversion::toLaneletPoint;
+  lanelet::Ids lanelet_ids;
+  lanelet_ids.reserve(lanelet_sequence.size());
+  for (const auto & lanelet : lanelet_sequence) {
+    lanelet_ids.push_back(lanelet.id());
+  }
+  const auto cache = center_line_reference_path_cache_;
+  if (auto cached_path = cache->find(lanelet_ids)) {
+    return cached_path;
+  }
 
   // 1. calculate reference points by lanelets' centerline
   // NOTE: This vector aligns the vector lanelet_sequence.
@@ -1712,22 +1929,13 @@ PathWithLaneId RouteHandler::getCenterLinePath(
     }
   }
 
-  PathWithLaneId reference_path{};
-  const auto add_path_point =
-    [&](const auto & point, const auto & lanelet, const auto & speed_limit) {
-      PathPointWithLaneId p{};
-      p.point.pose.position = point;
-      p.lane_ids.push_back(lanelet.id());
-      p.point.longitudinal_velocity_mps = speed_limit;
-      reference_path.points.push_back(p);
-    };
-
-  // 4. convert to PathPointsWithLaneIds with cropping
+  // 4. flatten the reference points with their arc lengths
+  auto reference_path = std::make_shared<CenterLineReferencePath>();
+  reference_path->speed_limits.reserve(lanelet_sequence.size());
   double s = 0.0;
   for (size_t lanelet_idx = 0; lanelet_idx < lanelet_sequence.size(); ++lanelet_idx) {
-    const auto & lanelet = lanelet_sequence.at(lanelet_idx);
-    const float speed_limit =
-      static_cast<float>(traffic_rules_ptr_->speedLimit(lanelet).speedLimit.value());
+    reference_path->speed_limits.push_back(static_cast<float>(
+      traffic_rules_ptr_->speedLimit(lanelet_sequence.at(lanelet_idx)).speedLimit.value()));
 
     const auto & piecewise_ref_points = piecewise_ref_points_vec.at(lanelet_idx);
     for (size_t ref_point_idx = 0; ref_point_idx < piecewise_ref_points.size(); ++ref_point_idx) {
@@ -1738,23 +1946,65 @@ PathWithLaneId RouteHandler::getCenterLinePath(
 
       const double distance =
         autoware_utils_geometry::calc_distance2d(ref_point.point, next_ref_point.point);
-
-      if (s < s_start && s + distance > s_start) {
-        const auto p =
-          use_exact ? getGeometryPointFrom2DArcLength(lanelet_sequence, s_start) : ref_point.point;
-        add_path_point(p, lanelet, speed_limit);
-      }
-      if (s >= s_start && s <= s_end) {
-        add_path_point(ref_point.point, lanelet, speed_limit);
-      }
-      if (s < s_end && s + distance > s_end) {
-        const auto p =
-          use_exact ? getGeometryPointFrom2DArcLength(lanelet_sequence, s_end) : ref_point.point;
-        add_path_point(p, lanelet, speed_limit);
-      }
+      reference_path->points.push_back({ref_point.point, lanelet_idx, s, distance});
       s += distance;
     }
   }
+
+  cache->insert(lanelet_ids, reference_path);
+  return reference_path;
+}
+
+PathWithLaneId RouteHandler::getCenterLinePath(
+  const lanelet::ConstLanelets & lanelet_sequence, const double s_start, const double s_end,
+  bool use_exact) const
+{
+  // 1. get the reference points of the whole lanelet sequence, which are cached
+  const auto center_line_reference_path = getCenterLineReferencePath(lanelet_sequence);
+  const auto & ref_points = center_line_reference_path->points;
+
+  PathWithLaneId reference_path{};
+  const auto add_path_point =
+    [&](const auto & point, const auto & lanelet, const auto & speed_limit) {
+      PathPointWithLaneId p{};
+      p.point.pose.position = point;
+      p.lane_ids.push_back(lanelet.id());
+      p.point.longitudinal_velocity_mps = speed_limit;
+      reference_path.points.push_back(p);
+    };
+
+  // 2. convert to PathPointsWithLaneIds with cropping
+  // NOTE: the points which end before s_start and the ones which start after s_end add nothing,
+  // so that only the slice between them is visited.
+  const auto first_in_range = std::min(
+    std::partition_point(
+      ref_points.begin(), ref_points.end(),
+      [&](const auto & ref_point) { return ref_point.s + ref_point.distance <= s_start; }),
+    std::partition_point(ref_points.begin(), ref_points.end(), [&](const auto & ref_point) {
+      return ref_point.s < s_start;
+    }));
+  for (auto it = first_in_range; it != ref_points.end() && it->s <= std::max(s_start, s_end);
+       ++it) {
+    const auto & ref_point = *it;
+    const auto & lanelet = lanelet_sequence.at(ref_point.lanelet_idx);
+    const float speed_limit = center_line_reference_path->speed_limits.at(ref_point.lanelet_idx);
+    const double s = ref_point.s;
+    const double distance = ref_point.distance;
+
+    if (s < s_start && s + distance > s_start) {
+      const auto p =
+        use_exact ? getGeometryPointFrom2DArcLength(lanelet_sequence, s_start) : ref_point.point;
+      add_path_point(p, lanelet, speed_limit);
+    }
+    if (s >= s_start && s <= s_end) {
+      add_path_point(ref_point.point, lanelet, speed_limit);
+    }
+    if (s < s_end && s + distance > s_end) {
+      const auto p =
+        use_exact ? getGeometryPointFrom2DArcLength(lanelet_sequence, s_end) : ref_point.point;
+      add_path_point(p, lanelet, speed_limit);
+    }
+  }
   reference_path = removeOverlappingPoints(reference_path);
 
   // append a point only when having one point so that yaw calculation would work
@@ -1943,19 +2193,35 @@ lanelet::LaneletMapPtr RouteHandler::getLaneletMapPtr() const
   return lanelet_map_ptr_;
 }
 
+std::shared_ptr<const RouteLaneletSubset> RouteHandler::getRouteLaneletSubset() const
+{
+  return route_lanelet_subset_;
+}
+
 bool RouteHandler::isShoulderLanelet(const lanelet::ConstLanelet & lanelet) const
 {
+  if (lanelet_kind_table_ptr_) {
+    return lanelet_kind_table_ptr_->is_shoulder_lane(lanelet);
+  }
   return lanelet.hasAttribute(lanelet::AttributeName::Subtype) &&
          lanelet.attribute(lanelet::AttributeName::Subtype) == "road_shoulder";
 }
 
 bool RouteHandler::isRouteLanelet(const lanelet::ConstLanelet & lanelet) const
 {
-  return lanelet::utils::contains(route_lanelets_, lanelet);
+  return isRouteLanelet(lanelet.id());
+}
+
+bool RouteHandler::isRouteLanelet(const lanelet::Id lanelet_id) const
+{
+  return route_lanelet_subset_->is_route_lanelet(lanelet_id);
 }
 
 bool RouteHandler::isRoadLanelet(const lanelet::ConstLanelet & lanelet) const
 {
+  if (lanelet_kind_table_ptr_) {
+    return lanelet_kind_table_ptr_->is_road_lane(lanelet);
+  }
   return lanelet.hasAttribute(lanelet::AttributeName::Subtype) &&
          lanelet.attribute(lanelet::AttributeName::Subtype) == lanelet::AttributeValueString::Road;
 }
@@ -1999,7 +2265,7 @@ lanelet::ConstLanelets RouteHandler::getNeighborsWithinRoute(
     lanelet::utils::query::getAllNeighbors(routing_graph_ptr_, lanelet);
   lanelet::ConstLanelets neighbors_within_route;
   for (const auto & llt : neighbor_lanelets) {
-    if (exists(route_lanelets_, llt)) {
+    if (isRouteLanelet(llt)) {
       neighbors_within_route.push_back(llt);
     }
   }
@@ -2094,7 +2360,6 @@ bool RouteHandler::planPathLaneletsBetweenCheckpoints(
     }
   }
 
-  lanelet::Optional<lanelet::routing::Route> optional_route;
   lanelet::routing::LaneletPath shortest_path;
   bool is_route_found = false;
 
@@ -2111,8 +2376,26 @@ bool RouteHandler::planPathLaneletsBetweenCheckpoints(
 
     bool is_proper_angle = angle_diff <= std::abs(yaw_threshold);
 
-    optional_route = routing_graph_ptr_->getRoute(st_llt, goal_lanelet, 0);
-    if (!optional_route || !is_proper_angle) {
+    // the search is skipped for the start lanelet of an improper angle, which is not used anyway
+    std::optional<lanelet::routing::LaneletPath> candidate_path;
+    double candidate_path_length = 0.0;
+    if (is_proper_angle) {
+      if (route_search_algorithm_ == RouteSearchAlgorithm::ASTAR) {
+        candidate_path = autoware::experimental::lanelet2_utils::find_shortest_path_astar(
+          st_llt, goal_lanelet, routing_graph_ptr_, *traffic_rules_ptr_);
+        if (candidate_path) {
+          candidate_path_length = lanelet::utils::getLaneletLength2d(
+            lanelet::ConstLanelets(candidate_path->begin(), candidate_path->end()));
+        }
+      } else {
+        const auto optional_route = routing_graph_ptr_->getRoute(st_llt, goal_lanelet, 0);
+        if (optional_route) {
+          candidate_path = optional_route->shortestPath();
+          candidate_path_length = optional_route->length2d();
+        }
+      }
+    }
+    if (!candidate_path || !is_proper_angle) {
       RCLCPP_DEBUG_STREAM(
         logger_, "Failed to find a proper route!"
                    << std::endl
@@ -2126,19 +2409,18 @@ bool RouteHandler::planPathLaneletsBetweenCheckpoints(
     lanelet::ConstLanelet preferred_lane{};
     if (getClosestPreferredLaneletWithinRoute(start_checkpoint, &preferred_lane)) {
       if (st_llt.id() == preferred_lane.id()) {
-        shortest_path = optional_route->shortestPath();
+        shortest_path = *candidate_path;
         start_lanelet = st_llt;
         break;
       }
     }
-    const double optional_route_length = optional_route->length2d();
-    const double optional_route_cost = optional_route_length + angle_diff_weight * angle_diff;
+    const double optional_route_cost = candidate_path_length + angle_diff_weight * angle_diff;
     RCLCPP_DEBUG(
       logger_, "Lanelet ID %ld: Route length = %.1f, Angle Diff = %.4f rad, Route cost = %.2f",
-      st_llt.id(), optional_route_length, angle_diff, optional_route_cost);
+      st_llt.id(), candidate_path_length, angle_diff, optional_route_cost);
     if (optional_route_cost < min_route_cost) {
       min_route_cost = optional_route_cost;
-      shortest_path = optional_route->shortestPath();
+      shortest_path = *candidate_path;
       start_lanelet = st_llt;
     }
   }
@@ -2241,24 +2523,30 @@ std::optional<lanelet::routing::LaneletPath> RouteHandler::findDrivableLanePath(
 Pose RouteHandler::get_pose_from_2d_arc_length(
   const lanelet::ConstLanelets & lanelet_sequence, const double s) const
 {
+  // the arc lengths of the centerlines are computed once per lanelet, so that only the segment
+  // including s is searched in each lanelet
   double accumulated_distance2d = 0;
   for (const auto & llt : lanelet_sequence) {
-    const auto & centerline = llt.centerline();
-    for (auto it = centerline.begin(); std::next(it) != centerline.end(); ++it) {
-      const auto pt = *it;
-      const auto next_pt = *std::next(it);
-      const double distance2d = lanelet::geometry::distance2d(to2D(pt), to2D(next_pt));
-      if (accumulated_distance2d + distance2d > s) {
-        const double ratio = (s - accumulated_distance2d) / distance2d;
-        const auto interpolated_pt = pt.basicPoint() * (1 - ratio) + next_pt.basicPoint() * ratio;
-        const auto yaw = std::atan2(next_pt.y() - pt.y(), next_pt.x() - pt.x());
-        Pose pose;
-        pose.position = create_point(interpolated_pt.x(), interpolated_pt.y(), interpolated_pt.z());
-        pose.orientation = create_quaternion_from_yaw(yaw);
-        return pose;
-      }
-      accumulated_distance2d += distance2d;
+    const auto & arc_length = centerline_arc_length_cache_->get(llt);
+    const auto & arc_lengths = arc_length.arc_lengths_2d;
+    const auto segment = autoware::experimental::lanelet2_utils::find_segment_by_arc_length(
+      arc_lengths, s - accumulated_distance2d);
+    if (!segment) {
+      accumulated_distance2d += arc_lengths.empty() ? 0.0 : arc_lengths.back();
+      continue;
     }
+    const size_t i = *segment;
+    const double distance2d = arc_lengths[i + 1] - arc_lengths[i];
+    const double ratio = (s - accumulated_distance2d - arc_lengths[i]) / distance2d;
+    const double x = arc_length.x[i] * (1 - ratio) + arc_length.x[i + 1] * ratio;
+    const double y = arc_length.y[i] * (1 - ratio) + arc_length.y[i + 1] * ratio;
+    const double z = arc_length.z[i] * (1 - ratio) + arc_length.z[i + 1] * ratio;
+    const auto yaw =
+      std::atan2(arc_length.y[i + 1] - arc_length.y[i], arc_length.x[i + 1] - arc_length.x[i]);
+    Pose pose;
+    pose.position = create_point(x, y, z);
+    pose.orientation = create_quaternion_from_yaw(yaw);
+    return pose;
   }
   return Pose{};
 }
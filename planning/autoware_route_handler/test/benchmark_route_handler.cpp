@@ -0,0 +1,197 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Time per query of the closest route lanelet and of the lanelets at a pose, with the indexed
+// queries of RouteHandler and the linear scans over the route lanelets they replace.
+// The queries are spread along the lane change test route of the 2 km test map.
+// Time per route planning between the start and goal of the same route, with the Dijkstra and
+// A* searches.
+
+#include <autoware/route_handler/route_handler.hpp>
+#include <autoware_lanelet2_extension/utility/query.hpp>
+#include <autoware_test_utils/autoware_test_utils.hpp>
+#include <autoware_test_utils/mock_data_parser.hpp>
+
+#include <lanelet2_core/geometry/Lanelet.h>
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+using autoware::route_handler::RouteHandler;
+using autoware::route_handler::RouteSearchAlgorithm;
+using autoware_planning_msgs::msg::LaneletRoute;
+using geometry_msgs::msg::Pose;
+
+constexpr double dist_threshold = 3.0;
+constexpr double yaw_threshold = 1.045;
+
+struct Fixture
+{
+  std::shared_ptr<RouteHandler> route_handler;
+  lanelet::ConstLanelets route_lanelets;
+  std::vector<Pose> poses;
+  Pose start_pose;
+  Pose goal_pose;
+};
+
+const Fixture & get_fixture()
+{
+  static const Fixture fixture = [] {
+    Fixture f;
+    const auto map_bin_msg = autoware::test_utils::make_map_bin_msg(
+      autoware::test_utils::get_absolute_path_to_lanelet_map("autoware_test_utils", "2km_test.osm"),
+      5.0);
+    f.route_handler = std::make_shared<RouteHandler>(map_bin_msg);
+    const auto route = autoware::test_utils::parse<std::optional<LaneletRoute>>(
+      autoware::test_utils::get_absolute_path_to_route(
+        "autoware_route_handler", "lane_change_test_route.yaml"));
+    if (!route) {
+      throw std::runtime_error("failed to parse the benchmark route");
+    }
+    f.route_handler->setRoute(*route);
+    f.start_pose = route->start_pose;
+    f.goal_pose = route->goal_pose;
+
+    lanelet::Ids route_lanelet_ids;
+    for (const auto & segment : route->segments) {
+      for (const auto & primitive : segment.primitives) {
+        route_lanelet_ids.push_back(primitive.id);
+      }
+    }
+    f.route_lanelets = f.route_handler->getLaneletsFromIds(route_lanelet_ids);
+
+    // poses on the lanes of the route, heading along the route
+    std::mt19937 engine(0);
+    std::uniform_real_distribution<double> x_distribution(-50.0, 1950.0);
+    std::uniform_real_distribution<double> y_distribution(0.0, 7.0);
+    for (int i = 0; i < 1000; ++i) {
+      f.poses.push_back(autoware::test_utils::createPose(
+        x_distribution(engine), y_distribution(engine), 0.0, 0.0, 0.0, 0.0));
+    }
+    return f;
+  }();
+  return fixture;
+}
+
+void BM_ClosestLaneletWithinRoute(benchmark::State & state)
+{
+  const auto & f = get_fixture();
+  size_t i = 0;
+  for (auto _ : state) {
+    lanelet::ConstLanelet closest_lanelet;
+    const auto & pose = f.poses[i++ % f.poses.size()];
+    benchmark::DoNotOptimize(f.route_handler->getClosestLaneletWithinRoute(pose, &closest_lanelet));
+  }
+}
+
+void BM_ClosestLaneletLinearScan(benchmark::State & state)
+{
+  const auto & f = get_fixture();
+  size_t i = 0;
+  for (auto _ : state) {
+    lanelet::ConstLanelet closest_lanelet;
+    benchmark::DoNotOptimize(lanelet::utils::query::getClosestLanelet(
+      f.route_lanelets, f.poses[i++ % f.poses.size()], &closest_lanelet));
+  }
+}
+
+void BM_ClosestLaneletWithConstrainsWithinRoute(benchmark::State & state)
+{
+  const auto & f = get_fixture();
+  size_t i = 0;
+  for (auto _ : state) {
+    lanelet::ConstLanelet closest_lanelet;
+    benchmark::DoNotOptimize(f.route_handler->getClosestLaneletWithConstrainsWithinRoute(
+      f.poses[i++ % f.poses.size()], &closest_lanelet, dist_threshold, yaw_threshold));
+  }
+}
+
+void BM_ClosestLaneletWithConstrainsLinearScan(benchmark::State & state)
+{
+  const auto & f = get_fixture();
+  size_t i = 0;
+  for (auto _ : state) {
+    lanelet::ConstLanelet closest_lanelet;
+    benchmark::DoNotOptimize(lanelet::utils::query::getClosestLaneletWithConstrains(
+      f.route_lanelets, f.poses[i++ % f.poses.size()], &closest_lanelet, dist_threshold,
+      yaw_threshold));
+  }
+}
+
+void BM_RoadLaneletsAtPose(benchmark::State & state)
+{
+  const auto & f = get_fixture();
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(f.route_handler->getRoadLaneletsAtPose(f.poses[i++ % f.poses.size()]));
+  }
+}
+
+void BM_RoadLaneletsAtPoseLinearScan(benchmark::State & state)
+{
+  const auto & f = get_fixture();
+  size_t i = 0;
+  for (auto _ : state) {
+    const auto & pose = f.poses[i++ % f.poses.size()];
+    const lanelet::BasicPoint2d p{pose.position.x, pose.position.y};
+    lanelet::ConstLanelets lanelets_at_pose;
+    for (const auto & lanelet : f.route_lanelets) {
+      if (lanelet::geometry::inside(lanelet, p) && f.route_handler->isRoadLanelet(lanelet)) {
+        lanelets_at_pose.push_back(lanelet);
+      }
+    }
+    benchmark::DoNotOptimize(lanelets_at_pose);
+  }
+}
+
+void plan_path_lanelets(benchmark::State & state, const RouteSearchAlgorithm algorithm)
+{
+  const auto & f = get_fixture();
+  f.route_handler->setRouteSearchAlgorithm(algorithm);
+  for (auto _ : state) {
+    lanelet::ConstLanelets path_lanelets;
+    benchmark::DoNotOptimize(f.route_handler->planPathLaneletsBetweenCheckpoints(
+      f.start_pose, f.goal_pose, &path_lanelets));
+  }
+  f.route_handler->setRouteSearchAlgorithm(RouteSearchAlgorithm::DIJKSTRA);
+}
+
+void BM_PlanPathLaneletsDijkstra(benchmark::State & state)
+{
+  plan_path_lanelets(state, RouteSearchAlgorithm::DIJKSTRA);
+}
+
+void BM_PlanPathLaneletsAStar(benchmark::State & state)
+{
+  plan_path_lanelets(state, RouteSearchAlgorithm::ASTAR);
+}
+}  // namespace
+
+BENCHMARK(BM_ClosestLaneletWithinRoute);
+BENCHMARK(BM_ClosestLaneletLinearScan);
+BENCHMARK(BM_ClosestLaneletWithConstrainsWithinRoute);
+BENCHMARK(BM_ClosestLaneletWithConstrainsLinearScan);
+BENCHMARK(BM_RoadLaneletsAtPose);
+BENCHMARK(BM_RoadLaneletsAtPoseLinearScan);
+BENCHMARK(BM_PlanPathLaneletsDijkstra);
+BENCHMARK(BM_PlanPathLaneletsAStar);
+
+BENCHMARK_MAIN();
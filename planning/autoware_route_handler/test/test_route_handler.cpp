@@ -18,6 +18,12 @@
 #include <rclcpp/rclcpp.hpp>
 
 #include <gtest/gtest.h>
+#include <lanelet2_core/geometry/LineString.h>
+
+#include <algorithm>
+#include <optional>
+#include <tuple>
+#include <vector>
 
 namespace autoware::route_handler::test
 {
@@ -46,6 +52,15 @@ TEST_F(TestRouteHandler, getGoalLaneId)
   ASSERT_EQ(goal_lane.id(), 5088);
 }
 
+TEST_F(TestRouteHandler, isRouteLaneletFromId)
+{
+  EXPECT_TRUE(route_handler_->isRouteLanelet(5088));
+  EXPECT_FALSE(route_handler_->isRouteLanelet(lanelet::InvalId));
+
+  route_handler_->clearRoute();
+  EXPECT_FALSE(route_handler_->isRouteLanelet(5088));
+}
+
 TEST_F(TestRouteHandler, getLaneletSequenceWhenOverlappingRoute)
 {
   set_route_handler("overlap_map.osm");
@@ -222,6 +237,25 @@ TEST_F(TestRouteHandler, testGetCenterLinePath)
     ASSERT_EQ(center_line_path.points.back().lane_ids.at(0), 4785);
   }
 }
+
+TEST_F(TestRouteHandler, testGetCenterLinePathFromCache)
+{
+  const auto current_lanes = route_handler_->getLaneletsFromIds({4424, 4780, 4785});
+
+  // the later paths are sliced from the reference points cached by the first one
+  const auto center_line_path = route_handler_->getCenterLinePath(current_lanes, 14.5, 60.5);
+  const auto full_path = route_handler_->getCenterLinePath(current_lanes, 0.0, 75.0);
+  const auto cached_center_line_path =
+    route_handler_->getCenterLinePath(current_lanes, 14.5, 60.5);
+
+  ASSERT_EQ(full_path.points.size(), 76);
+  ASSERT_EQ(center_line_path.points.size(), 48);
+  ASSERT_EQ(cached_center_line_path.points.size(), center_line_path.points.size());
+  for (size_t i = 0; i < center_line_path.points.size(); ++i) {
+    EXPECT_EQ(cached_center_line_path.points.at(i), center_line_path.points.at(i));
+  }
+}
+
 TEST_F(TestRouteHandler, DISABLED_testGetCenterLinePathWhenLanesIsNotConnected)
 {
   // broken current lanes. 4424 and 4785 are not connected directly.
@@ -313,4 +347,104 @@ TEST_F(TestRouteHandler, testGetShoulderLaneletsAtPose)
   shoulder_lanelets = route_handler_->getShoulderLaneletsAtPose(pose);
   ASSERT_TRUE(shoulder_lanelets.empty());
 }
+
+TEST_F(TestRouteHandler, cachedRouteTopologyIsSameAsRoutingGraph)
+{
+  const auto get_topology_ids = [&](const lanelet::ConstLanelet & lanelet) {
+    const auto to_ids = [](const auto & lanelets) {
+      std::vector<lanelet::Id> ids;
+      for (const auto & llt : lanelets) {
+        ids.push_back(llt.id());
+      }
+      return ids;
+    };
+    const auto to_id = [](const std::optional<lanelet::ConstLanelet> & llt) {
+      return llt ? llt->id() : lanelet::InvalId;
+    };
+    return std::make_tuple(
+      to_ids(route_handler_->getNextLanelets(lanelet)),
+      to_ids(route_handler_->getPreviousLanelets(lanelet)),
+      to_id(route_handler_->getRightLanelet(lanelet)),
+      to_id(route_handler_->getLeftLanelet(lanelet)),
+      to_ids(route_handler_->getRightOppositeLanelets(lanelet)),
+      to_ids(route_handler_->getLeftOppositeLanelets(lanelet)));
+  };
+
+  // the relations of the lanelets around the route are cached, the others are not
+  const lanelet::ConstLanelets lanelets(
+    route_handler_->getLaneletMapPtr()->laneletLayer.begin(),
+    route_handler_->getLaneletMapPtr()->laneletLayer.end());
+  std::vector<decltype(get_topology_ids(lanelets.front()))> cached_topologies;
+  for (const auto & lanelet : lanelets) {
+    cached_topologies.push_back(get_topology_ids(lanelet));
+  }
+
+  route_handler_->clearRoute();
+  for (size_t i = 0; i < lanelets.size(); ++i) {
+    EXPECT_EQ(cached_topologies.at(i), get_topology_ids(lanelets.at(i)))
+      << "lanelet " << lanelets.at(i).id();
+  }
+}
+TEST_F(TestRouteHandler, routeLaneletSubsetHoldsTheLaneletsAroundTheRoute)
+{
+  const auto subset = route_handler_->getRouteLaneletSubset();
+  ASSERT_FALSE(subset->empty());
+
+  const auto routing_graph = route_handler_->getRoutingGraphPtr();
+  for (size_t i = 0; i < subset->size(); ++i) {
+    const auto & lanelet = subset->lanelet(i);
+    EXPECT_EQ(subset->find(lanelet.id()), i);
+    EXPECT_EQ(
+      subset->role(i) == RouteLaneletSubset::Role::ROUTE,
+      route_handler_->isRouteLanelet(lanelet));
+    if (subset->role(i) != RouteLaneletSubset::Role::ROUTE) {
+      continue;
+    }
+    for (const auto & next : routing_graph->following(lanelet)) {
+      EXPECT_TRUE(subset->contains(next.id())) << "lanelet " << next.id();
+    }
+    for (const auto & previous : routing_graph->previous(lanelet)) {
+      EXPECT_TRUE(subset->contains(previous.id())) << "lanelet " << previous.id();
+    }
+
+    // a point of the center line is found in the lanelet by the spatial index
+    const auto & center = lanelet.centerline2d()[lanelet.centerline2d().size() / 2];
+    const auto lanelets_at_center = subset->lanelets_at(center.basicPoint());
+    EXPECT_TRUE(std::any_of(
+      lanelets_at_center.begin(), lanelets_at_center.end(),
+      [&](const auto & llt) { return llt.id() == lanelet.id(); }))
+      << "lanelet " << lanelet.id();
+  }
+  EXPECT_FALSE(subset->find(lanelet::InvalId));
+
+  route_handler_->clearRoute();
+  EXPECT_TRUE(route_handler_->getRouteLaneletSubset()->empty());
+}
+
+TEST_F(TestRouteHandler, getPoseFrom2dArcLength)
+{
+  const auto lanelets = route_handler_->getLaneletsFromIds({4424, 4775});
+  const auto first_centerline = lanelets.front().centerline();
+  const double first_length =
+    lanelet::geometry::length(lanelet::ConstLineString2d(first_centerline));
+
+  const auto start_pose = route_handler_->get_pose_from_2d_arc_length(lanelets, 0.0);
+  EXPECT_NEAR(start_pose.position.x, first_centerline.front().x(), 1e-6);
+  EXPECT_NEAR(start_pose.position.y, first_centerline.front().y(), 1e-6);
+
+  // the arc length of the second lanelet starts at the length of the first one
+  const auto second_pose =
+    route_handler_->get_pose_from_2d_arc_length(lanelets, first_length + 1e-6);
+  const auto second_centerline = lanelets.back().centerline();
+  EXPECT_NEAR(second_pose.position.x, second_centerline.front().x(), 1e-3);
+  EXPECT_NEAR(second_pose.position.y, second_centerline.front().y(), 1e-3);
+
+  // out of the sequence, the same result for a cached lanelet
+  for (int i = 0; i < 2; ++i) {
+    const auto out_of_range_pose = route_handler_->get_pose_from_2d_arc_length(lanelets, 1e6);
+    EXPECT_DOUBLE_EQ(out_of_range_pose.position.x, 0.0);
+    EXPECT_DOUBLE_EQ(out_of_range_pose.position.y, 0.0);
+  }
+}
+
 }  // namespace autoware::route_handler::test
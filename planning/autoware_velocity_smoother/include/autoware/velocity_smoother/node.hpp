@@ -29,6 +29,7 @@
 #include "tf2/utils.hpp"
 #include "tf2_ros/transform_listener.h"
 
+#include <autoware/node/realtime_configurator.hpp>
 #include <autoware_utils_debug/published_time_publisher.hpp>
 #include <autoware_utils_debug/time_keeper.hpp>
 #include <autoware_utils_diagnostics/diagnostics_interface.hpp>
@@ -49,6 +50,8 @@
 
 #include <iostream>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <tuple>
 #include <utility>
@@ -85,6 +88,7 @@ public:
   explicit VelocitySmootherNode(const rclcpp::NodeOptions & node_options);
 
 private:
+  autoware::node::RealtimeConfigurator realtime_configurator_{this};
   rclcpp::Publisher<Trajectory>::SharedPtr pub_trajectory_;
   rclcpp::Publisher<MarkerArray>::SharedPtr pub_virtual_wall_;
   rclcpp::Subscription<Trajectory>::SharedPtr sub_current_trajectory_;
@@ -109,12 +113,13 @@ private:
   double base_link2front_;                        // base_link to front
 
   TrajectoryPoints prev_output_;  // previously published trajectory
+  Trajectory publishing_trajectory_;  // output message kept to reuse the capacity of its points
 
   // previous trajectory point closest to ego vehicle
   boost::optional<TrajectoryPoint> prev_closest_point_{};
   boost::optional<TrajectoryPoint> current_closest_point_from_prev_output_{};
 
-  bool is_reverse_;
+  bool is_reverse_{false};
 
   // check if the vehicle is under control of the planning module
   OperationModeState operation_mode_;
@@ -159,6 +164,12 @@ private:
     AlgorithmType algorithm_type;  // Option : JerkFiltered, Linf, L2
 
     bool plan_from_ego_speed_on_manual_mode = true;
+
+    bool enable_fallback_jerk_filter;  // use the jerk filter if the optimization fails or overruns
+    double optimization_time_budget;   // the next optimization is skipped above this time [ms]
+
+    bool enable_reuse_on_unchanged_input;  // reuse the previous output if the input is unchanged
+    int max_reuse_count;                   // the velocity is smoothed again after this many reuses
   } node_param_{};
 
   struct AccelerationRequest
@@ -179,6 +190,22 @@ private:
 
   std::shared_ptr<SmootherBase> smoother_;
 
+  // number of cycles the velocity was smoothed by each tier, reported in the diagnostics
+  struct SmootherTierCount
+  {
+    size_t optimization{0};
+    size_t jerk_filter_on_failure{0};
+    size_t jerk_filter_on_overrun{0};
+  };
+  mutable SmootherTierCount smoother_tier_count_{};
+  mutable bool is_optimization_overrun_{false};
+
+  // hashes of the input points, to detect an input unchanged ahead of ego
+  std::vector<size_t> prev_input_point_hashes_;
+  ExternalVelocityLimit prev_external_velocity_limit_;
+  bool is_input_unchanged_{false};
+  mutable int reuse_count_{0};
+
   bool publish_debug_trajs_;  // publish planned trajectories
 
   double over_stop_velocity_warn_thr_;  // threshold to publish over velocity warn
@@ -195,10 +222,14 @@ private:
   // topic callback
   void onCurrentTrajectory(const Trajectory::ConstSharedPtr msg);
 
+  // NOTE: the trajectory callback is in its own callback group, so the parameters can be updated
+  // in parallel on a multi-threaded executor.
+  std::mutex mutex_;
+
   void calcExternalVelocityLimit();
 
   // publish methods
-  void publishTrajectory(const TrajectoryPoints & traj) const;
+  void publishTrajectory(const TrajectoryPoints & traj);
 
   void publishStopDistance(const TrajectoryPoints & trajectory) const;
 
@@ -216,19 +247,31 @@ private:
 
   TrajectoryPoints calcTrajectoryVelocity(const TrajectoryPoints & traj_input) const;
 
+  bool isInputUnchanged(
+    const TrajectoryPoints & input, const std::vector<size_t> & point_hashes) const;
+
+  std::optional<TrajectoryPoints> reusePrevOutput(
+    const TrajectoryPoints & input, const size_t input_closest) const;
+
   bool smoothVelocity(
     const TrajectoryPoints & input, const size_t input_closest,
     TrajectoryPoints & traj_smoothed) const;
 
+  void applySmoother(
+    const Motion & initial_motion, const TrajectoryPoints & input, TrajectoryPoints & output,
+    std::vector<TrajectoryPoints> & debug_trajectories) const;
+
   std::pair<Motion, InitializeType> calcInitialMotion(
     const TrajectoryPoints & input_traj, const size_t input_closest) const;
 
-  void applyExternalVelocityLimit(TrajectoryPoints & traj) const;
+  // return the closest index to ego of the trajectory after the insertion of the limit point
+  size_t applyExternalVelocityLimit(const size_t traj_closest, TrajectoryPoints & traj) const;
 
   void insertBehindVelocity(
     const size_t output_closest, const InitializeType type, TrajectoryPoints & output) const;
 
-  void applyStopApproachingVelocity(TrajectoryPoints & traj) const;
+  void applyStopApproachingVelocity(
+    const std::vector<double> & arclength, TrajectoryPoints & traj) const;
 
   void overwriteStopPoint(const TrajectoryPoints & input, TrajectoryPoints & output) const;
 
@@ -36,6 +36,7 @@ struct ResampleParam
   double dense_min_interval_distance;   // minimum points-interval length for dense sampling [m]
   double sparse_resample_dt;            // resample time interval for sparse sampling [s]
   double sparse_min_interval_distance;  // minimum points-interval length for sparse sampling [m]
+  int fixed_resample_num{0};            // fixed number of points ahead of ego (0: disabled)
 };
 
 TrajectoryPoints resampleTrajectory(
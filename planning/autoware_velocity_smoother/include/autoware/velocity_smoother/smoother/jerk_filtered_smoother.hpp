@@ -63,16 +63,6 @@ private:
   Param smoother_param_;
   std::shared_ptr<autoware::qp_interface::QPInterface> qp_interface_;
   rclcpp::Logger logger_{rclcpp::get_logger("smoother").get_child("jerk_filtered_smoother")};
-
-  TrajectoryPoints forwardJerkFilter(
-    const double v0, const double a0, const double a_max, const double a_stop, const double j_max,
-    const TrajectoryPoints & input) const;
-  TrajectoryPoints backwardJerkFilter(
-    const double v0, const double a0, const double a_min, const double a_stop, const double j_min,
-    const TrajectoryPoints & input) const;
-  TrajectoryPoints mergeFilteredTrajectory(
-    const double v0, const double a0, const double a_min, const double j_min,
-    const TrajectoryPoints & forward_filtered, const TrajectoryPoints & backward_filtered) const;
 };
 }  // namespace autoware::velocity_smoother
 
@@ -58,6 +58,11 @@ public:
 private:
   Param smoother_param_;
   autoware::osqp_interface::OSQPInterface qp_solver_;
+  // the workspace of qp_solver_ is kept while the padded problem size is unchanged
+  unsigned int qp_size_{0};
+  bool is_qp_initialized_{false};
+  TrajectoryPoints prev_input_;
+  std::vector<double> prev_solution_;
   rclcpp::Logger logger_{rclcpp::get_logger("smoother").get_child("l2_pseudo_jerk_smoother")};
 };
 }  // namespace autoware::velocity_smoother
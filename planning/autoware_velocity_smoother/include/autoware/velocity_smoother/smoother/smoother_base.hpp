@@ -80,6 +80,11 @@ public:
     const TrajectoryPoints & input, const bool use_resampling = true,
     const double input_points_interval = 1.0) const;
 
+  // Forward and backward jerk filters with the base limits, without optimization.
+  // Used as a cheap fallback when the optimization fails or runs out of time.
+  TrajectoryPoints applyJerkFilter(
+    const double v0, const double a0, const TrajectoryPoints & input) const;
+
   double getMaxAccel() const;
   double getMinDecel() const;
   double getMaxJerk() const;
@@ -112,16 +117,26 @@ public:
 
   double computeVelocityLimitFromLateralAcc(
     const double local_curvature,
-    const std::vector<std::pair<double, double>> lateral_acceleration_velocity_square_ratio_limits)
+    const std::vector<std::pair<double, double>> & lateral_acc_velocity_square_ratio_limits)
     const;
 
   double computeVelocityLimitFromSteerRate(
     const double local_steer_rate_velocity_ratio,
-    const std::vector<std::pair<double, double>> steer_rate_velocity_ratio_limits) const;
+    const std::vector<std::pair<double, double>> & steer_rate_velocity_ratio_limits) const;
 
 protected:
   BaseParam base_param_;
   mutable std::shared_ptr<autoware_utils_debug::TimeKeeper> time_keeper_{nullptr};
+
+  TrajectoryPoints forwardJerkFilter(
+    const double v0, const double a0, const double a_max, const double a_stop, const double j_max,
+    const TrajectoryPoints & input) const;
+  TrajectoryPoints backwardJerkFilter(
+    const double v0, const double a0, const double a_min, const double a_stop, const double j_min,
+    const TrajectoryPoints & input) const;
+  TrajectoryPoints mergeFilteredTrajectory(
+    const double v0, const double a0, const double a_min, const double j_min,
+    const TrajectoryPoints & forward_filtered, const TrajectoryPoints & backward_filtered) const;
 };
 }  // namespace autoware::velocity_smoother
 
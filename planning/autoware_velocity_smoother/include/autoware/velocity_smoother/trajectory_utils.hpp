@@ -43,6 +43,10 @@ std::vector<double> calcTrajectoryIntervalDistance(const TrajectoryPoints & traj
 std::vector<double> calcTrajectoryCurvatureFrom3Points(
   const TrajectoryPoints & trajectory, size_t idx_dist);
 
+// Same as above, from contiguous x and y coordinates of the points
+std::vector<double> calcTrajectoryCurvatureFrom3Points(
+  const std::vector<double> & xs, const std::vector<double> & ys, size_t idx_dist);
+
 void applyMaximumVelocityLimit(
   const size_t from, const size_t to, const double max_vel, TrajectoryPoints & trajectory);
 
@@ -66,6 +70,14 @@ std::vector<double> calcVelocityProfileWithConstantJerkAndAccelerationLimit(
 
 double calcStopDistance(const TrajectoryPoints & trajectory, const size_t closest);
 
+/// Shift the per-point optimization variables solved on the previous trajectory to the points of
+/// the trajectory, by the travel distance of its front point along the previous trajectory.
+/// The variables are `block_num` blocks of `block_size` values, one per point. The values of the
+/// points beyond the trajectory and of the variables after the blocks are kept.
+std::vector<double> shiftOptimizationVariables(
+  const TrajectoryPoints & prev_trajectory, const TrajectoryPoints & trajectory,
+  const std::vector<double> & prev_variables, const size_t block_size, const size_t block_num);
+
 }  // namespace autoware::velocity_smoother::trajectory_utils
 
 #endif  // AUTOWARE__VELOCITY_SMOOTHER__TRAJECTORY_UTILS_HPP_
@@ -26,6 +26,7 @@
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <tuple>
 #include <utility>
@@ -34,6 +35,31 @@
 // clang-format on
 namespace autoware::velocity_smoother
 {
+namespace
+{
+size_t calcPointHash(const TrajectoryPoint & point)
+{
+  size_t seed = std::hash<double>{}(point.pose.position.x);
+  const auto combine = [&seed](const size_t hash) {
+    seed ^= hash + 0x9e3779b97f4a7c15 + (seed << 6) + (seed >> 2);
+  };
+  combine(std::hash<double>{}(point.pose.position.y));
+  combine(std::hash<float>{}(point.longitudinal_velocity_mps));
+  return seed;
+}
+
+rclcpp::SubscriptionOptions create_subscription_options(rclcpp::Node * node_ptr)
+{
+  rclcpp::CallbackGroup::SharedPtr callback_group =
+    node_ptr->create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+
+  auto sub_opt = rclcpp::SubscriptionOptions();
+  sub_opt.callback_group = callback_group;
+
+  return sub_opt;
+}
+}  // namespace
+
 VelocitySmootherNode::VelocitySmootherNode(const rclcpp::NodeOptions & node_options)
 : Node("velocity_smoother", node_options),
   diagnostics_interface_(std::make_unique<DiagnosticsInterface>(this, "velocity_smoother"))
@@ -63,7 +89,8 @@ VelocitySmootherNode::VelocitySmootherNode(const rclcpp::NodeOptions & node_opti
     "~/output/current_velocity_limit_mps", rclcpp::QoS{1}.transient_local());
   pub_dist_to_stopline_ = create_publisher<Float32Stamped>("~/distance_to_stopline", 1);
   sub_current_trajectory_ = create_subscription<Trajectory>(
-    "~/input/trajectory", 1, std::bind(&VelocitySmootherNode::onCurrentTrajectory, this, _1));
+    "~/input/trajectory", 1, std::bind(&VelocitySmootherNode::onCurrentTrajectory, this, _1),
+    create_subscription_options(this));
 
   // parameter update
   set_param_res_ =
@@ -153,6 +180,8 @@ bool get_param_general(
 rcl_interfaces::msg::SetParametersResult VelocitySmootherNode::onParameter(
   const std::vector<rclcpp::Parameter> & parameters)
 {
+  std::lock_guard<std::mutex> lock(mutex_);
+
   auto update_param = [&](const std::string & name, double & v) {
     auto it = std::find_if(
       parameters.cbegin(), parameters.cend(),
@@ -196,6 +225,10 @@ rcl_interfaces::msg::SetParametersResult VelocitySmootherNode::onParameter(
     update_param("ego_nearest_dist_threshold", p.ego_nearest_dist_threshold);
     update_param("ego_nearest_yaw_threshold", p.ego_nearest_yaw_threshold);
     update_param_bool("plan_from_ego_speed_on_manual_mode", p.plan_from_ego_speed_on_manual_mode);
+    update_param_bool("enable_fallback_jerk_filter", p.enable_fallback_jerk_filter);
+    update_param("optimization_time_budget", p.optimization_time_budget);
+    update_param_bool("enable_reuse_on_unchanged_input", p.enable_reuse_on_unchanged_input);
+    get_param_general(parameters, "max_reuse_count", p.max_reuse_count);
   }
 
   {
@@ -215,6 +248,7 @@ rcl_interfaces::msg::SetParametersResult VelocitySmootherNode::onParameter(
     update_param("min_interval_distance", p.resample_param.dense_min_interval_distance);
     update_param("sparse_resample_dt", p.resample_param.sparse_resample_dt);
     update_param("sparse_min_interval_distance", p.resample_param.sparse_min_interval_distance);
+    get_param_general(parameters, "fixed_resample_num", p.resample_param.fixed_resample_num);
     update_param("resample_ds", p.sample_ds);
     update_param("curvature_threshold", p.curvature_threshold);
     get_param_general(parameters, "velocity_thresholds", p.velocity_thresholds);
@@ -316,15 +350,22 @@ void VelocitySmootherNode::initCommonParam()
 
   p.plan_from_ego_speed_on_manual_mode =
     declare_parameter<bool>("plan_from_ego_speed_on_manual_mode");
+
+  p.enable_fallback_jerk_filter = declare_parameter<bool>("enable_fallback_jerk_filter");
+  p.optimization_time_budget = declare_parameter<double>("optimization_time_budget");
+
+  p.enable_reuse_on_unchanged_input = declare_parameter<bool>("enable_reuse_on_unchanged_input");
+  p.max_reuse_count = declare_parameter<int>("max_reuse_count");
 }
 
-void VelocitySmootherNode::publishTrajectory(const TrajectoryPoints & trajectory) const
+void VelocitySmootherNode::publishTrajectory(const TrajectoryPoints & trajectory)
 {
-  Trajectory publishing_trajectory = autoware::motion_utils::convertToTrajectory(trajectory);
-  publishing_trajectory.header = base_traj_raw_ptr_->header;
-  pub_trajectory_->publish(publishing_trajectory);
+  // the points are copied into the kept message, which reuses its capacity across the cycles
+  publishing_trajectory_.points.assign(trajectory.begin(), trajectory.end());
+  publishing_trajectory_.header = base_traj_raw_ptr_->header;
+  pub_trajectory_->publish(publishing_trajectory_);
   published_time_publisher_->publish_if_subscribed(
-    pub_trajectory_, publishing_trajectory.header.stamp);
+    pub_trajectory_, publishing_trajectory_.header.stamp);
 }
 
 void VelocitySmootherNode::calcExternalVelocityLimit()
@@ -451,6 +492,7 @@ bool VelocitySmootherNode::checkData() const
 
 void VelocitySmootherNode::onCurrentTrajectory(const Trajectory::ConstSharedPtr msg)
 {
+  std::lock_guard<std::mutex> lock(mutex_);
   autoware_utils_debug::ScopedTimeTrack st(__func__, *time_keeper_);
 
   RCLCPP_DEBUG(get_logger(), "========================= run start =========================");
@@ -497,11 +539,21 @@ void VelocitySmootherNode::onCurrentTrajectory(const Trajectory::ConstSharedPtr
 
   // For negative velocity handling, multiple -1 to velocity if it is for reverse.
   // NOTE: this process must be in the beginning of the process
+  const bool was_reverse = is_reverse_;
   is_reverse_ = isReverse(input_points);
   if (is_reverse_) {
     flipVelocity(input_points);
   }
 
+  // detect the input unchanged from the previous cycle ahead of ego
+  std::vector<size_t> input_point_hashes(input_points.size());
+  std::transform(
+    input_points.begin(), input_points.end(), input_point_hashes.begin(), calcPointHash);
+  is_input_unchanged_ =
+    was_reverse == is_reverse_ && isInputUnchanged(input_points, input_point_hashes);
+  prev_input_point_hashes_ = std::move(input_point_hashes);
+  prev_external_velocity_limit_ = external_velocity_limit_;
+
   const auto output = calcTrajectoryVelocity(input_points);
   if (output.empty()) {
     RCLCPP_WARN(get_logger(), "Output Point is empty");
@@ -587,13 +639,14 @@ TrajectoryPoints VelocitySmootherNode::calcTrajectoryVelocity(
   }
 
   // Apply external velocity limit
-  applyExternalVelocityLimit(traj_extracted);
-
-  // Change trajectory velocity to zero when current_velocity == 0 & stop_dist is close
-  const size_t traj_extracted_closest = findNearestIndexFromEgo(traj_extracted);
+  // NOTE: the closest index and the arc length are computed once here and shared by the following
+  // steps, which only change the velocity except for the insertion of the external limit point.
+  const size_t traj_extracted_closest =
+    applyExternalVelocityLimit(findNearestIndexFromEgo(traj_extracted), traj_extracted);
+  const auto traj_extracted_arclength = trajectory_utils::calcArclengthArray(traj_extracted);
 
   // Apply velocity to approach stop point
-  applyStopApproachingVelocity(traj_extracted);
+  applyStopApproachingVelocity(traj_extracted_arclength, traj_extracted);
 
   // Debug
   if (publish_debug_trajs_) {
@@ -602,6 +655,13 @@ TrajectoryPoints VelocitySmootherNode::calcTrajectoryVelocity(
     pub_trajectory_vel_lim_->publish(toTrajectoryMsg(traj_extracted));
   }
 
+  // Reuse the previous output instead of smoothing velocity when the input is unchanged
+  const auto reused_output = reusePrevOutput(traj_extracted, traj_extracted_closest);
+  diagnostics_interface_->add_key_value("is_previous_output_reused", reused_output.has_value());
+  if (reused_output) {
+    return *reused_output;
+  }
+
   // Smoothing velocity
   if (!smoothVelocity(traj_extracted, traj_extracted_closest, output)) {
     return prev_output_;
@@ -610,6 +670,65 @@ TrajectoryPoints VelocitySmootherNode::calcTrajectoryVelocity(
   return output;
 }
 
+bool VelocitySmootherNode::isInputUnchanged(
+  const TrajectoryPoints & input, const std::vector<size_t> & point_hashes) const
+{
+  const auto & prev_limit = prev_external_velocity_limit_;
+  const auto & limit = external_velocity_limit_;
+  if (
+    prev_limit.velocity != limit.velocity ||
+    prev_limit.acceleration_request.request != limit.acceleration_request.request ||
+    prev_limit.acceleration_request.max_acceleration !=
+      limit.acceleration_request.max_acceleration ||
+    prev_limit.acceleration_request.max_jerk != limit.acceleration_request.max_jerk) {
+    return false;
+  }
+
+  // the points from ego to the end must be the last points of the previous input, so that a
+  // trajectory trimmed behind ego is still detected as unchanged
+  const size_t input_closest = findNearestIndexFromEgo(input);
+  const size_t ahead_size = point_hashes.size() - input_closest;
+  if (prev_input_point_hashes_.size() < ahead_size) {
+    return false;
+  }
+  return std::equal(
+    point_hashes.begin() + input_closest, point_hashes.end(),
+    prev_input_point_hashes_.end() - ahead_size);
+}
+
+std::optional<TrajectoryPoints> VelocitySmootherNode::reusePrevOutput(
+  const TrajectoryPoints & input, const size_t input_closest) const
+{
+  autoware_utils_debug::ScopedTimeTrack st(__func__, *time_keeper_);
+
+  if (
+    !node_param_.enable_reuse_on_unchanged_input || !is_input_unchanged_ ||
+    prev_output_.empty() || reuse_count_ >= node_param_.max_reuse_count) {
+    reuse_count_ = 0;
+    return std::nullopt;
+  }
+
+  // the previous output follows ego only when it is the initial state of the smoothing
+  const auto [initial_motion, type] = calcInitialMotion(input, input_closest);
+  if (type != InitializeType::NORMAL) {
+    reuse_count_ = 0;
+    return std::nullopt;
+  }
+
+  // the previous output moved along by the travel distance of ego
+  const size_t prev_output_closest = findNearestIndexFromEgo(prev_output_);
+  auto output = trajectory_utils::extractPathAroundIndex(
+    prev_output_, prev_output_closest, node_param_.extract_ahead_dist,
+    node_param_.extract_behind_dist);
+  if (output.size() < 2) {
+    reuse_count_ = 0;
+    return std::nullopt;
+  }
+
+  ++reuse_count_;
+  return output;
+}
+
 bool VelocitySmootherNode::smoothVelocity(
   const TrajectoryPoints & input, const size_t input_closest,
   TrajectoryPoints & traj_smoothed) const
@@ -673,11 +792,7 @@ bool VelocitySmootherNode::smoothVelocity(
   smoother_->setMaxJerk(smoother_max_jerk);
 
   std::vector<TrajectoryPoints> debug_trajectories;
-  if (!smoother_->apply(
-        initial_motion.vel, initial_motion.acc, clipped, traj_smoothed, debug_trajectories,
-        publish_debug_trajs_)) {
-    RCLCPP_WARN(get_logger(), "Fail to solve optimization.");
-  }
+  applySmoother(initial_motion, clipped, traj_smoothed, debug_trajectories);
 
   // Set 0 velocity after input-stop-point
   overwriteStopPoint(clipped, traj_smoothed);
@@ -794,6 +909,52 @@ void VelocitySmootherNode::publishStopDistance(const TrajectoryPoints & trajecto
   pub_dist_to_stopline_->publish(dist_to_stopline);
 }
 
+void VelocitySmootherNode::applySmoother(
+  const Motion & initial_motion, const TrajectoryPoints & input, TrajectoryPoints & output,
+  std::vector<TrajectoryPoints> & debug_trajectories) const
+{
+  autoware_utils_debug::ScopedTimeTrack st(__func__, *time_keeper_);
+
+  // The optimization of the cycle after an overrun is replaced by the jerk filter, and retried in
+  // the following cycle.
+  const bool is_optimization_skipped =
+    node_param_.enable_fallback_jerk_filter && is_optimization_overrun_;
+  bool is_solved = false;
+  if (is_optimization_skipped) {
+    is_optimization_overrun_ = false;
+  } else {
+    autoware_utils_system::StopWatch<std::chrono::milliseconds> optimization_stop_watch;
+    is_solved = smoother_->apply(
+      initial_motion.vel, initial_motion.acc, input, output, debug_trajectories,
+      publish_debug_trajs_);
+    if (!is_solved) {
+      RCLCPP_WARN(get_logger(), "Fail to solve optimization.");
+    }
+    const double optimization_time = optimization_stop_watch.toc();
+    is_optimization_overrun_ = optimization_time > node_param_.optimization_time_budget;
+    diagnostics_interface_->add_key_value("optimization_time_ms", optimization_time);
+  }
+
+  const bool use_jerk_filter = node_param_.enable_fallback_jerk_filter && !is_solved;
+  if (use_jerk_filter) {
+    output = smoother_->applyJerkFilter(initial_motion.vel, initial_motion.acc, input);
+    if (is_optimization_skipped) {
+      ++smoother_tier_count_.jerk_filter_on_overrun;
+    } else {
+      ++smoother_tier_count_.jerk_filter_on_failure;
+    }
+  } else {
+    ++smoother_tier_count_.optimization;
+  }
+
+  diagnostics_interface_->add_key_value("is_fallback_jerk_filter_used", use_jerk_filter);
+  diagnostics_interface_->add_key_value("optimization_count", smoother_tier_count_.optimization);
+  diagnostics_interface_->add_key_value(
+    "jerk_filter_on_failure_count", smoother_tier_count_.jerk_filter_on_failure);
+  diagnostics_interface_->add_key_value(
+    "jerk_filter_on_overrun_count", smoother_tier_count_.jerk_filter_on_overrun);
+}
+
 std::pair<Motion, VelocitySmootherNode::InitializeType> VelocitySmootherNode::calcInitialMotion(
   const TrajectoryPoints & input_traj, const size_t input_closest) const
 {
@@ -927,12 +1088,13 @@ void VelocitySmootherNode::overwriteStopPoint(
     "The velocity on the stop point is larger than 0.", is_stop_velocity_exceeded);
 }
 
-void VelocitySmootherNode::applyExternalVelocityLimit(TrajectoryPoints & traj) const
+size_t VelocitySmootherNode::applyExternalVelocityLimit(
+  const size_t traj_closest, TrajectoryPoints & traj) const
 {
   autoware_utils_debug::ScopedTimeTrack st(__func__, *time_keeper_);
 
   if (traj.size() < 1) {
-    return;
+    return traj_closest;
   }
 
   trajectory_utils::applyMaximumVelocityLimit(
@@ -940,16 +1102,36 @@ void VelocitySmootherNode::applyExternalVelocityLimit(TrajectoryPoints & traj) c
 
   // insert the point at the distance of external velocity limit
   const auto & current_pose = current_odometry_ptr_->pose.pose;
-  const size_t closest_seg_idx =
-    autoware::motion_utils::findFirstNearestSegmentIndexWithSoftConstraints(
-      traj, current_pose, node_param_.ego_nearest_dist_threshold,
-      node_param_.ego_nearest_yaw_threshold);
+  const size_t closest_seg_idx = [&]() -> size_t {
+    // same as findFirstNearestSegmentIndexWithSoftConstraints from the given closest index
+    if (traj.size() < 2 || traj_closest == 0) {
+      return 0;
+    }
+    if (traj_closest == traj.size() - 1) {
+      return traj.size() - 2;
+    }
+    const double signed_length = autoware::motion_utils::calcLongitudinalOffsetToSegment(
+      traj, traj_closest, current_pose.position);
+    return signed_length <= 0 ? traj_closest - 1 : traj_closest;
+  }();
+  const size_t prev_traj_size = traj.size();
   const auto inserted_index =
     autoware::motion_utils::insertTargetPoint(closest_seg_idx, external_velocity_limit_.dist, traj);
   if (!inserted_index) {
     traj.back().longitudinal_velocity_mps = std::min(
       traj.back().longitudinal_velocity_mps, static_cast<float>(external_velocity_limit_.velocity));
-    return;
+    return traj_closest;
+  }
+
+  // the closest index is shifted by the inserted point, which can be the closest only when it is
+  // inserted on the segment of ego
+  size_t output_closest = traj_closest;
+  if (traj.size() != prev_traj_size) {
+    if (*inserted_index == closest_seg_idx + 1) {
+      output_closest = findNearestIndexFromEgo(traj);
+    } else if (*inserted_index <= traj_closest) {
+      ++output_closest;
+    }
   }
 
   // apply external velocity limit from the inserted point
@@ -966,9 +1148,12 @@ void VelocitySmootherNode::applyExternalVelocityLimit(TrajectoryPoints & traj) c
 
   RCLCPP_DEBUG(
     get_logger(), "externalVelocityLimit : limit_vel = %.3f", external_velocity_limit_.velocity);
+
+  return output_closest;
 }
 
-void VelocitySmootherNode::applyStopApproachingVelocity(TrajectoryPoints & traj) const
+void VelocitySmootherNode::applyStopApproachingVelocity(
+  const std::vector<double> & arclength, TrajectoryPoints & traj) const
 {
   autoware_utils_debug::ScopedTimeTrack st(__func__, *time_keeper_);
 
@@ -976,10 +1161,8 @@ void VelocitySmootherNode::applyStopApproachingVelocity(TrajectoryPoints & traj)
   if (!stop_idx) {
     return;  // no stop point.
   }
-  double distance_sum = 0.0;
   for (size_t i = *stop_idx - 1; i < traj.size(); --i) {  // search backward
-    distance_sum += autoware_utils_geometry::calc_distance2d(traj.at(i), traj.at(i + 1));
-    if (distance_sum > node_param_.stopping_distance) {
+    if (arclength.at(*stop_idx) - arclength.at(i) > node_param_.stopping_distance) {
       break;
     }
     if (traj.at(i).longitudinal_velocity_mps > node_param_.stopping_velocity) {
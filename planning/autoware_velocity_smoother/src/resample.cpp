@@ -22,12 +22,82 @@
 #include <autoware_utils_geometry/geometry.hpp>
 
 #include <algorithm>
+#include <cmath>
+#include <optional>
 #include <vector>
 
 namespace autoware::velocity_smoother
 {
 namespace resampling
 {
+namespace
+{
+/**
+ * Arc lengths of a constant number of points ahead of ego, up to the horizon length.
+ * The first points follow the dense time intervals and the remaining points are evenly spread to
+ * the end of the horizon. The point nearest to the stop point is moved onto it instead of being
+ * added, so that the number of points does not change.
+ */
+std::vector<double> calcFixedNumAheadArclength(
+  const size_t num, const double horizon_length, const double dense_ds, const double dense_num,
+  const std::optional<double> & dist_to_stop_point)
+{
+  std::vector<double> arclength;
+  arclength.reserve(num);
+  const size_t fixed_dense_num = std::min(static_cast<size_t>(std::max(dense_num, 0.0)), num);
+  const double dense_length = static_cast<double>(fixed_dense_num) * dense_ds;
+  if (dense_length >= horizon_length || fixed_dense_num == num) {
+    const double ds = std::min(dense_ds, horizon_length / static_cast<double>(num));
+    for (size_t i = 1; i <= num; ++i) {
+      arclength.push_back(static_cast<double>(i) * ds);
+    }
+  } else {
+    for (size_t i = 1; i <= fixed_dense_num; ++i) {
+      arclength.push_back(static_cast<double>(i) * dense_ds);
+    }
+    const size_t sparse_num = num - fixed_dense_num;
+    const double sparse_ds = (horizon_length - dense_length) / static_cast<double>(sparse_num);
+    for (size_t i = 1; i <= sparse_num; ++i) {
+      arclength.push_back(dense_length + static_cast<double>(i) * sparse_ds);
+    }
+  }
+
+  if (dist_to_stop_point && 0.0 < *dist_to_stop_point && *dist_to_stop_point < horizon_length) {
+    const auto nearest_itr = std::min_element(
+      arclength.begin(), arclength.end(), [&](const double lhs, const double rhs) {
+        return std::abs(lhs - *dist_to_stop_point) < std::abs(rhs - *dist_to_stop_point);
+      });
+    *nearest_itr = *dist_to_stop_point;
+  }
+  return arclength;
+}
+
+TrajectoryPoints resampleAtArclength(
+  const TrajectoryPoints & input, const std::vector<double> & out_arclength,
+  const double trajectory_length, const bool is_endpoint_included, const bool use_zoh_for_v)
+{
+  if (input.size() < 2 || out_arclength.size() < 2 || trajectory_length < out_arclength.back()) {
+    return input;
+  }
+
+  const auto output_traj = autoware::motion_utils::resampleTrajectory(
+    autoware::motion_utils::convertToTrajectory(input), out_arclength, false, true, use_zoh_for_v);
+  auto output = autoware::motion_utils::convertToTrajectoryPointArray(output_traj);
+
+  // add end point directly to consider the endpoint velocity.
+  if (is_endpoint_included) {
+    constexpr double ep_dist = 1.0E-3;
+    if (autoware_utils_geometry::calc_distance2d(output.back(), input.back()) < ep_dist) {
+      output.back() = input.back();
+    } else {
+      output.push_back(input.back());
+    }
+  }
+
+  return output;
+}
+}  // namespace
+
 TrajectoryPoints resampleTrajectory(
   const TrajectoryPoints & input, const double v_current,
   const geometry_msgs::msg::Pose & current_pose, const double nearest_dist_threshold,
@@ -68,6 +138,26 @@ TrajectoryPoints resampleTrajectory(
   }
 
   // Step2. Resample behind trajectory
+  if (param.fixed_resample_num > 0) {
+    // constant number of points with variable intervals, to keep the optimization size
+    const double remaining_length = trajectory_length - front_arclength_value;
+    const double horizon_length = std::min(
+      std::max(Nt * ds_nominal, param.min_trajectory_length), param.max_trajectory_length);
+    const double ahead_length = std::min(horizon_length, remaining_length);
+    if (ahead_length < 1e-3) {
+      return input;
+    }
+    const bool is_endpoint_included = remaining_length <= horizon_length;
+    const auto ahead_arclength = calcFixedNumAheadArclength(
+      static_cast<size_t>(param.fixed_resample_num), ahead_length, ds_nominal, Nt,
+      dist_to_closest_stop_point);
+    for (const double s : ahead_arclength) {
+      out_arclength.push_back(std::min(s + front_arclength_value, trajectory_length));
+    }
+    return resampleAtArclength(
+      input, out_arclength, trajectory_length, is_endpoint_included, use_zoh_for_v);
+  }
+
   double dist_i = 0.0;
   bool is_zero_point_included = false;
   bool is_endpoint_included = false;
@@ -129,25 +219,8 @@ TrajectoryPoints resampleTrajectory(
     out_arclength.push_back(dist_i + front_arclength_value);
   }
 
-  if (input.size() < 2 || out_arclength.size() < 2 || trajectory_length < out_arclength.back()) {
-    return input;
-  }
-
-  const auto output_traj = autoware::motion_utils::resampleTrajectory(
-    autoware::motion_utils::convertToTrajectory(input), out_arclength, false, true, use_zoh_for_v);
-  auto output = autoware::motion_utils::convertToTrajectoryPointArray(output_traj);
-
-  // add end point directly to consider the endpoint velocity.
-  if (is_endpoint_included) {
-    constexpr double ep_dist = 1.0E-3;
-    if (autoware_utils_geometry::calc_distance2d(output.back(), input.back()) < ep_dist) {
-      output.back() = input.back();
-    } else {
-      output.push_back(input.back());
-    }
-  }
-
-  return output;
+  return resampleAtArclength(
+    input, out_arclength, trajectory_length, is_endpoint_included, use_zoh_for_v);
 }
 
 TrajectoryPoints resampleTrajectory(
@@ -252,25 +325,8 @@ TrajectoryPoints resampleTrajectory(
     out_arclength.push_back(dist_i + front_arclength_value);
   }
 
-  if (input.size() < 2 || out_arclength.size() < 2 || trajectory_length < out_arclength.back()) {
-    return input;
-  }
-
-  const auto output_traj = autoware::motion_utils::resampleTrajectory(
-    autoware::motion_utils::convertToTrajectory(input), out_arclength, false, true, use_zoh_for_v);
-  auto output = autoware::motion_utils::convertToTrajectoryPointArray(output_traj);
-
-  // add end point directly to consider the endpoint velocity.
-  if (is_endpoint_included) {
-    constexpr double ep_dist = 1.0E-3;
-    if (autoware_utils_geometry::calc_distance2d(output.back(), input.back()) < ep_dist) {
-      output.back() = input.back();
-    } else {
-      output.push_back(input.back());
-    }
-  }
-
-  return output;
+  return resampleAtArclength(
+    input, out_arclength, trajectory_length, is_endpoint_included, use_zoh_for_v);
 }
 
 }  // namespace resampling
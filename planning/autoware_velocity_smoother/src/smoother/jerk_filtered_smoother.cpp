@@ -14,10 +14,14 @@
 
 #include "autoware/velocity_smoother/smoother/jerk_filtered_smoother.hpp"
 
+#include "autoware/qp_interface/osqp_csc_matrix_conv.hpp"
+#include "autoware/qp_interface/osqp_interface.hpp"
 #include "autoware/qp_interface/proxqp_interface.hpp"
+#include "autoware/qp_interface/qp_problem_recorder.hpp"
 #include "autoware/velocity_smoother/trajectory_utils.hpp"
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 #include <algorithm>
 #include <chrono>
@@ -26,6 +30,8 @@
 #include <limits>
 #include <memory>
 #include <numeric>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 #define VERBOSE_TRAJECTORY_VELOCITY false
@@ -43,8 +49,23 @@ JerkFilteredSmoother::JerkFilteredSmoother(
   p.over_j_weight = node.declare_parameter<double>("over_j_weight");
   p.jerk_filter_ds = node.declare_parameter<double>("jerk_filter_ds");
 
-  qp_interface_ =
-    std::make_shared<autoware::qp_interface::ProxQPInterface>(false, 20000, 1.0e-8, 1.0e-6, false);
+  const auto qp_solver_type = node.declare_parameter<std::string>("qp_solver_type");
+  if (qp_solver_type == "proxqp") {
+    qp_interface_ = std::make_shared<autoware::qp_interface::ProxQPInterface>(
+      false, 20000, 1.0e-8, 1.0e-6, false);
+  } else if (qp_solver_type == "osqp") {
+    qp_interface_ = std::make_shared<autoware::qp_interface::OSQPInterface>(
+      false, 20000, 1.0e-8, 1.0e-6, true, false);
+  } else {
+    throw std::domain_error("[JerkFilteredSmoother] invalid qp_solver_type: " + qp_solver_type);
+  }
+
+  // NOTE: the problems are recorded only if a file is given, to replay them offline.
+  const auto qp_problem_record_file = node.declare_parameter<std::string>("qp_problem_record_file");
+  if (!qp_problem_record_file.empty()) {
+    qp_interface_->setProblemRecorder(
+      std::make_shared<autoware::qp_interface::QPProblemRecorder>(qp_problem_record_file));
+  }
 }
 
 void JerkFilteredSmoother::setParam(const Param & smoother_param)
@@ -187,13 +208,15 @@ bool JerkFilteredSmoother::apply(
   const uint32_t l_variables = 5 * N;
   const uint32_t l_constraints = 4 * N + 1;
 
-  // the matrix size depends on constraint numbers.
-  Eigen::MatrixXd A = Eigen::MatrixXd::Zero(l_constraints, l_variables);
+  // P and A are assembled from triplets with a fixed sparsity pattern, without dense matrices.
+  std::vector<Eigen::Triplet<double>> A_triplets;
+  A_triplets.reserve(10 * N);
 
   std::vector<double> lower_bound(l_constraints, 0.0);
   std::vector<double> upper_bound(l_constraints, 0.0);
 
-  Eigen::MatrixXd P = Eigen::MatrixXd::Zero(l_variables, l_variables);
+  std::vector<Eigen::Triplet<double>> P_triplets;
+  P_triplets.reserve(7 * N);
   std::vector<double> q(l_variables, 0.0);
 
   /**************************************************************/
@@ -208,10 +231,11 @@ bool JerkFilteredSmoother::apply(
     const double ref_vel = 0.5 * (v_max_arr.at(i) + v_max_arr.at(i + 1));
     const double interval_dist = std::max(interval_dist_arr.at(i), 0.0001);
     const double w_x_ds_inv = (1.0 / interval_dist) * ref_vel;
-    P(IDX_A0 + i, IDX_A0 + i) += smooth_weight * w_x_ds_inv * w_x_ds_inv * interval_dist;
-    P(IDX_A0 + i, IDX_A0 + i + 1) -= smooth_weight * w_x_ds_inv * w_x_ds_inv * interval_dist;
-    P(IDX_A0 + i + 1, IDX_A0 + i) -= smooth_weight * w_x_ds_inv * w_x_ds_inv * interval_dist;
-    P(IDX_A0 + i + 1, IDX_A0 + i + 1) += smooth_weight * w_x_ds_inv * w_x_ds_inv * interval_dist;
+    const double jerk_weight = smooth_weight * w_x_ds_inv * w_x_ds_inv * interval_dist;
+    P_triplets.emplace_back(IDX_A0 + i, IDX_A0 + i, jerk_weight);
+    P_triplets.emplace_back(IDX_A0 + i, IDX_A0 + i + 1, -jerk_weight);
+    P_triplets.emplace_back(IDX_A0 + i + 1, IDX_A0 + i, -jerk_weight);
+    P_triplets.emplace_back(IDX_A0 + i + 1, IDX_A0 + i + 1, jerk_weight);
   }
 
   // |v_max_i^2 - b_i|/v_max^2 -> minimize (-bi) * ds / v_max^2
@@ -224,9 +248,9 @@ bool JerkFilteredSmoother::apply(
       }
       q.at(IDX_B0 + i) += v_weight_term;
     }
-    P(IDX_DELTA0 + i, IDX_DELTA0 + i) += over_v_weight;  // over velocity cost
-    P(IDX_SIGMA0 + i, IDX_SIGMA0 + i) += over_a_weight;  // over acceleration cost
-    P(IDX_GAMMA0 + i, IDX_GAMMA0 + i) += over_j_weight;  // over jerk cost
+    P_triplets.emplace_back(IDX_DELTA0 + i, IDX_DELTA0 + i, over_v_weight);  // over velocity cost
+    P_triplets.emplace_back(IDX_SIGMA0 + i, IDX_SIGMA0 + i, over_a_weight);  // over accel cost
+    P_triplets.emplace_back(IDX_GAMMA0 + i, IDX_GAMMA0 + i, over_j_weight);  // over jerk cost
   }
 
   /**************************************************************/
@@ -247,16 +271,16 @@ bool JerkFilteredSmoother::apply(
 
   // Soft Constraint Velocity Limit: 0 < b - delta < v_max^2
   for (size_t i = 0; i < N; ++i, ++constr_idx) {
-    A(constr_idx, IDX_B0 + i) = 1.0;       // b_i
-    A(constr_idx, IDX_DELTA0 + i) = -1.0;  // -delta_i
+    A_triplets.emplace_back(constr_idx, IDX_B0 + i, 1.0);       // b_i
+    A_triplets.emplace_back(constr_idx, IDX_DELTA0 + i, -1.0);  // -delta_i
     upper_bound[constr_idx] = v_max_arr.at(i) * v_max_arr.at(i);
     lower_bound[constr_idx] = 0.0;
   }
 
   // Soft Constraint Acceleration Limit: a_min < a - sigma < a_max
   for (size_t i = 0; i < N; ++i, ++constr_idx) {
-    A(constr_idx, IDX_A0 + i) = 1.0;       // a_i
-    A(constr_idx, IDX_SIGMA0 + i) = -1.0;  // -sigma_i
+    A_triplets.emplace_back(constr_idx, IDX_A0 + i, 1.0);       // a_i
+    A_triplets.emplace_back(constr_idx, IDX_SIGMA0 + i, -1.0);  // -sigma_i
 
     constexpr double stop_vel = 1e-3;
     if (v_max_arr.at(i) < stop_vel) {
@@ -274,40 +298,45 @@ bool JerkFilteredSmoother::apply(
   for (size_t i = 0; i < N - 1; ++i, ++constr_idx) {
     const double ref_vel = 0.5 * (v_max_arr.at(i) + v_max_arr.at(i + 1));
     const double ds = interval_dist_arr.at(i);
-    A(constr_idx, IDX_A0 + i) = -ref_vel;     // -a[i] * ref_vel
-    A(constr_idx, IDX_A0 + i + 1) = ref_vel;  //  a[i+1] * ref_vel
-    A(constr_idx, IDX_GAMMA0 + i) = -ds;      // -gamma[i] * ds
+    A_triplets.emplace_back(constr_idx, IDX_A0 + i, -ref_vel);     // -a[i] * ref_vel
+    A_triplets.emplace_back(constr_idx, IDX_A0 + i + 1, ref_vel);  //  a[i+1] * ref_vel
+    A_triplets.emplace_back(constr_idx, IDX_GAMMA0 + i, -ds);      // -gamma[i] * ds
     upper_bound[constr_idx] = j_max * ds;     //  jerk_max * ds
     lower_bound[constr_idx] = j_min * ds;     //  jerk_min * ds
   }
 
   // b' = 2a ... (b(i+1) - b(i)) / ds = 2a(i)
   for (size_t i = 0; i < N - 1; ++i, ++constr_idx) {
-    A(constr_idx, IDX_B0 + i) = -1.0;                            // b(i)
-    A(constr_idx, IDX_B0 + i + 1) = 1.0;                         // b(i+1)
-    A(constr_idx, IDX_A0 + i) = -2.0 * interval_dist_arr.at(i);  // a(i) * ds
+    A_triplets.emplace_back(constr_idx, IDX_B0 + i, -1.0);                            // b(i)
+    A_triplets.emplace_back(constr_idx, IDX_B0 + i + 1, 1.0);                         // b(i+1)
+    A_triplets.emplace_back(constr_idx, IDX_A0 + i, -2.0 * interval_dist_arr.at(i));  // a(i) * ds
     upper_bound[constr_idx] = 0.0;
     lower_bound[constr_idx] = 0.0;
   }
 
   // initial condition
   {
-    A(constr_idx, IDX_B0) = 1.0;  // b0
+    A_triplets.emplace_back(constr_idx, IDX_B0, 1.0);  // b0
     upper_bound[constr_idx] = v0 * v0;
     lower_bound[constr_idx] = v0 * v0;
     ++constr_idx;
 
-    A(constr_idx, IDX_A0) = 1.0;  // a0
+    A_triplets.emplace_back(constr_idx, IDX_A0, 1.0);  // a0
     upper_bound[constr_idx] = a0;
     lower_bound[constr_idx] = a0;
     ++constr_idx;
   }
+
+  // the duplicated entries of P are summed up
+  const auto P_csc = autoware::qp_interface::calCSCMatrixTrapezoidal(l_variables, P_triplets);
+  const auto A_csc = autoware::qp_interface::calCSCMatrix(l_constraints, l_variables, A_triplets);
   time_keeper_->end_track("initOptimization");
 
   // execute optimization
   time_keeper_->start_track("optimize");
-  const auto optval = qp_interface_->optimize(P, A, q, lower_bound, upper_bound);
+  const auto optval = qp_interface_->optimize(P_csc, A_csc, q, lower_bound, upper_bound);
   time_keeper_->end_track("optimize");
+  RCLCPP_DEBUG(logger_, "qp solver time = %f [ms]", qp_interface_->getRunTime() * 1.0e3);
   if (!qp_interface_->isSolved()) {
     RCLCPP_WARN(logger_, "optimization failed : %s", qp_interface_->getStatus().c_str());
     return false;
@@ -356,130 +385,6 @@ bool JerkFilteredSmoother::apply(
   return true;
 }
 
-TrajectoryPoints JerkFilteredSmoother::forwardJerkFilter(
-  const double v0, const double a0, const double a_max, const double a_start, const double j_max,
-  const TrajectoryPoints & input) const
-{
-  autoware_utils_debug::ScopedTimeTrack st(__func__, *time_keeper_);
-
-  auto applyLimits = [&input, &a_start](double & v, double & a, size_t i) {
-    double v_lim = input.at(i).longitudinal_velocity_mps;
-    static constexpr double ep = 1.0e-5;
-    if (v > v_lim + ep) {
-      v = v_lim;
-      a = 0.0;
-
-      if (v_lim < 1e-3 && i < input.size() - 1) {
-        double next_v_lim = input.at(i + 1).longitudinal_velocity_mps;
-        if (next_v_lim >= 1e-3) {
-          a = a_start;  // start from stop velocity
-        }
-      }
-    }
-
-    if (v < 0.0) {
-      v = a = 0.0;
-    }
-  };
-
-  auto output = input;
-
-  double current_vel = v0;
-  double current_acc = a0;
-  applyLimits(current_vel, current_acc, 0);
-
-  output.front().longitudinal_velocity_mps = current_vel;
-  output.front().acceleration_mps2 = current_acc;
-  for (size_t i = 1; i < input.size(); ++i) {
-    const double ds = autoware_utils_geometry::calc_distance2d(input.at(i), input.at(i - 1));
-    const double max_dt = std::pow(6.0 * ds / j_max, 1.0 / 3.0);  // assuming v0 = a0 = 0.
-    const double dt = std::min(ds / std::max(current_vel, 1.0e-6), max_dt);
-
-    if (current_acc + j_max * dt >= a_max) {
-      const double tmp_jerk = std::min((a_max - current_acc) / dt, j_max);
-      current_vel = current_vel + current_acc * dt + 0.5 * tmp_jerk * dt * dt;
-      current_acc = a_max;
-    } else {
-      current_vel = current_vel + current_acc * dt + 0.5 * j_max * dt * dt;
-      current_acc = current_acc + j_max * dt;
-    }
-    applyLimits(current_vel, current_acc, i);
-    output.at(i).longitudinal_velocity_mps = current_vel;
-    output.at(i).acceleration_mps2 = current_acc;
-  }
-  return output;
-}
-
-TrajectoryPoints JerkFilteredSmoother::backwardJerkFilter(
-  const double v0, const double a0, const double a_min, const double a_stop, const double j_min,
-  const TrajectoryPoints & input) const
-{
-  autoware_utils_debug::ScopedTimeTrack st(__func__, *time_keeper_);
-
-  auto input_rev = input;
-  std::reverse(input_rev.begin(), input_rev.end());
-  auto filtered = forwardJerkFilter(
-    v0, std::fabs(a0), std::fabs(a_min), std::fabs(a_stop), std::fabs(j_min), input_rev);
-  std::reverse(filtered.begin(), filtered.end());
-  for (size_t i = 0; i < filtered.size(); ++i) {
-    filtered.at(i).acceleration_mps2 *= -1.0;  // Deceleration
-  }
-  return filtered;
-}
-
-TrajectoryPoints JerkFilteredSmoother::mergeFilteredTrajectory(
-  const double v0, const double a0, const double a_min, const double j_min,
-  const TrajectoryPoints & forward_filtered, const TrajectoryPoints & backward_filtered) const
-{
-  autoware_utils_debug::ScopedTimeTrack st(__func__, *time_keeper_);
-
-  TrajectoryPoints merged;
-  merged = forward_filtered;
-
-  auto getVx = [](const TrajectoryPoints & trajectory, int i) {
-    return trajectory.at(i).longitudinal_velocity_mps;
-  };
-
-  size_t i = 0;
-
-  if (getVx(backward_filtered, 0) < v0) {
-    double current_vel = v0;
-    double current_acc = a0;
-    while (getVx(backward_filtered, i) < current_vel && i < merged.size() - 1) {
-      merged.at(i).longitudinal_velocity_mps = current_vel;
-      merged.at(i).acceleration_mps2 = current_acc;
-
-      const double ds = autoware_utils_geometry::calc_distance2d(
-        forward_filtered.at(i + 1), forward_filtered.at(i));
-      const double max_dt =
-        std::pow(6.0 * ds / std::fabs(j_min), 1.0 / 3.0);  // assuming v0 = a0 = 0.
-      const double dt = std::min(ds / std::max(current_vel, 1.0e-6), max_dt);
-
-      if (current_acc + j_min * dt < a_min) {
-        const double tmp_jerk = std::max((a_min - current_acc) / dt, j_min);
-        current_vel = current_vel + current_acc * dt + 0.5 * tmp_jerk * dt * dt;
-        current_acc = std::max(current_acc + tmp_jerk * dt, a_min);
-      } else {
-        current_vel = current_vel + current_acc * dt + 0.5 * j_min * dt * dt;
-        current_acc = current_acc + j_min * dt;
-      }
-
-      if (current_vel > getVx(forward_filtered, i)) {
-        current_vel = getVx(forward_filtered, i);
-      }
-      ++i;
-    }
-  }
-
-  // take smaller velocity point
-  for (; i < merged.size(); ++i) {
-    merged.at(i) = (getVx(forward_filtered, i) < getVx(backward_filtered, i))
-                     ? forward_filtered.at(i)
-                     : backward_filtered.at(i);
-  }
-  return merged;
-}
-
 TrajectoryPoints JerkFilteredSmoother::resampleTrajectory(
   const TrajectoryPoints & input, [[maybe_unused]] const double v0,
   const geometry_msgs::msg::Pose & current_pose, const double nearest_dist_threshold,
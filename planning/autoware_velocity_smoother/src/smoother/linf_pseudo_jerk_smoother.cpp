@@ -14,9 +14,11 @@
 
 #include "autoware/velocity_smoother/smoother/linf_pseudo_jerk_smoother.hpp"
 
+#include "autoware/osqp_interface/csc_matrix_conv.hpp"
 #include "autoware/velocity_smoother/trajectory_utils.hpp"
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 #include <algorithm>
 #include <chrono>
@@ -26,6 +28,13 @@
 
 namespace autoware::velocity_smoother
 {
+namespace
+{
+// the problem size is padded to a multiple of this resolution, so that the solver workspace is
+// kept while the trajectory size slightly changes
+constexpr size_t qp_size_resolution = 10;
+}  // namespace
+
 LinfPseudoJerkSmoother::LinfPseudoJerkSmoother(
   rclcpp::Node & node, const std::shared_ptr<autoware_utils_debug::TimeKeeper> time_keeper)
 : SmootherBase(node, time_keeper)
@@ -71,16 +80,26 @@ bool LinfPseudoJerkSmoother::apply(
     return false;
   }
 
-  const size_t N{input.size()};
+  const size_t input_size{input.size()};
 
-  if (N < 2) {
+  if (input_size < 2) {
     return false;
   }
 
+  // The padded points are decoupled from the trajectory and their variables are fixed to zero.
+  // The problem size is kept unless the trajectory outgrows it or gets much shorter.
+  if (qp_size_ < input_size || qp_size_ >= input_size + 2 * qp_size_resolution) {
+    qp_size_ = (input_size + qp_size_resolution - 1) / qp_size_resolution * qp_size_resolution;
+    is_qp_initialized_ = false;
+  }
+  const size_t N{qp_size_};
+  const auto is_padded = [&](const size_t i) { return i >= input_size; };
+
   std::vector<double> interval_dist_arr = trajectory_utils::calcTrajectoryIntervalDistance(input);
+  interval_dist_arr.resize(N - 1, 0.0);
 
   std::vector<double> v_max(N, 0.0);
-  for (size_t i = 0; i < N; ++i) {
+  for (size_t i = 0; i < input_size; ++i) {
     v_max.at(i) = input.at(i).longitudinal_velocity_mps;
   }
 
@@ -93,13 +112,15 @@ bool LinfPseudoJerkSmoother::apply(
   const size_t l_variables{4 * N + 1};
   const size_t l_constraints{3 * N + 1 + 2 * (N - 1)};
 
-  Eigen::MatrixXd A = Eigen::MatrixXd::Zero(
-    l_constraints, l_variables);  // the matrix size depends on constraint numbers.
+  // P and A are assembled from triplets with a fixed sparsity pattern, without dense matrices.
+  std::vector<Eigen::Triplet<double>> A_triplets;
+  A_triplets.reserve(13 * N);
 
   std::vector<double> lower_bound(l_constraints, 0.0);
   std::vector<double> upper_bound(l_constraints, 0.0);
 
-  Eigen::MatrixXd P = Eigen::MatrixXd::Zero(l_variables, l_variables);
+  std::vector<Eigen::Triplet<double>> P_triplets;
+  P_triplets.reserve(2 * N);
   std::vector<double> q(l_variables, 0.0);
 
   const double a_max{base_param_.max_accel};
@@ -110,15 +131,15 @@ bool LinfPseudoJerkSmoother::apply(
 
   // design objective function
   for (unsigned int i = 0; i < N; ++i) {  // bi
-    q[i] = -1.0;                          // |v_max^2 - b| -> minimize (-bi)
+    q[i] = is_padded(i) ? 0.0 : -1.0;     // |v_max^2 - b| -> minimize (-bi)
   }
 
   for (unsigned int i = 2 * N; i < 3 * N; ++i) {  // over velocity cost
-    P(i, i) += over_v_weight;
+    P_triplets.emplace_back(i, i, over_v_weight);
   }
 
   for (unsigned int i = 3 * N; i < 4 * N; ++i) {  // over acceleration cost
-    P(i, i) += over_a_weight;
+    P_triplets.emplace_back(i, i, over_a_weight);
   }
 
   // pseudo jerk (Linf): minimize psi, subject to |a'|*curr_v < psi
@@ -134,8 +155,8 @@ bool LinfPseudoJerkSmoother::apply(
   */
   for (unsigned int i = 0; i < N; ++i) {
     const int j = 2 * N + i;
-    A(i, i) = 1.0;   // b_i
-    A(i, j) = -1.0;  // -delta_i
+    A_triplets.emplace_back(i, i, 1.0);   // b_i
+    A_triplets.emplace_back(i, j, -1.0);  // -delta_i
     upper_bound[i] = v_max[i] * v_max[i];
     lower_bound[i] = 0.0;
   }
@@ -143,8 +164,8 @@ bool LinfPseudoJerkSmoother::apply(
   // a_min < a - sigma < a_max
   for (unsigned int i = N; i < 2 * N; ++i) {
     const int j = 2 * N + i;
-    A(i, i) = 1.0;   // a_i
-    A(i, j) = -1.0;  // -sigma_i
+    A_triplets.emplace_back(i, i, 1.0);   // a_i
+    A_triplets.emplace_back(i, j, -1.0);  // -sigma_i
     if (i != N && v_max[i - N] < std::numeric_limits<double>::epsilon()) {
       upper_bound[i] = 0.0;
       lower_bound[i] = 0.0;
@@ -157,10 +178,10 @@ bool LinfPseudoJerkSmoother::apply(
   // b' = 2a
   for (unsigned int i = 2 * N; i < 3 * N - 1; ++i) {
     const unsigned int j = i - 2 * N;
-    const double ds_inv = 1.0 / std::max(interval_dist_arr.at(j), 0.0001);
-    A(i, j) = -ds_inv;
-    A(i, j + 1) = ds_inv;
-    A(i, j + N) = -2.0;
+    const double ds_inv = is_padded(j + 1) ? 0.0 : 1.0 / std::max(interval_dist_arr.at(j), 0.0001);
+    A_triplets.emplace_back(i, j, -ds_inv);
+    A_triplets.emplace_back(i, j + 1, ds_inv);
+    A_triplets.emplace_back(i, j + N, is_padded(j + 1) ? 0.0 : -2.0);
     upper_bound[i] = 0.0;
     lower_bound[i] = 0.0;
   }
@@ -169,11 +190,11 @@ bool LinfPseudoJerkSmoother::apply(
   const double v0 = initial_vel;
   {
     const unsigned int i = 3 * N - 1;
-    A(i, 0) = 1.0;  // b0
+    A_triplets.emplace_back(i, 0, 1.0);  // b0
     upper_bound[i] = v0 * v0;
     lower_bound[i] = v0 * v0;
 
-    A(i + 1, N) = 1.0;  // a0
+    A_triplets.emplace_back(i + 1, N, 1.0);  // a0
     upper_bound[i + 1] = initial_acc;
     lower_bound[i + 1] = initial_acc;
   }
@@ -183,28 +204,48 @@ bool LinfPseudoJerkSmoother::apply(
     const unsigned int ia = i - (3 * N + 1) + N;
     const unsigned int ip = 4 * N;
     const unsigned int j = i - (3 * N + 1);
-    const double ds_inv = 1.0 / std::max(interval_dist_arr.at(j), 0.0001);
+    const double ds_inv = is_padded(j + 1) ? 0.0 : 1.0 / std::max(interval_dist_arr.at(j), 0.0001);
 
-    A(i, ia) = -ds_inv;
-    A(i, ia + 1) = ds_inv;
-    A(i, ip) = -1;
+    A_triplets.emplace_back(i, ia, -ds_inv);
+    A_triplets.emplace_back(i, ia + 1, ds_inv);
+    A_triplets.emplace_back(i, ip, -1);
     lower_bound[i] = -OSQP_INFTY;
     upper_bound[i] = 0;
 
-    A(i + N - 1, ia) = ds_inv;
-    A(i + N - 1, ia + 1) = -ds_inv;
-    A(i + N - 1, ip) = -1;
+    A_triplets.emplace_back(i + N - 1, ia, ds_inv);
+    A_triplets.emplace_back(i + N - 1, ia + 1, -ds_inv);
+    A_triplets.emplace_back(i + N - 1, ip, -1);
     lower_bound[i + N - 1] = -OSQP_INFTY;
     upper_bound[i + N - 1] = 0;
   }
 
+  Eigen::SparseMatrix<double> P(l_variables, l_variables);
+  P.setFromTriplets(P_triplets.begin(), P_triplets.end());
+  Eigen::SparseMatrix<double> A(l_constraints, l_variables);
+  A.setFromTriplets(A_triplets.begin(), A_triplets.end());
+
   const auto tf1 = std::chrono::system_clock::now();
   const double dt_ms1 =
     std::chrono::duration_cast<std::chrono::nanoseconds>(tf1 - ts).count() * 1.0e-6;
 
   // execute optimization
   const auto ts2 = std::chrono::system_clock::now();
-  const auto result = qp_solver_.optimize(P, A, q, lower_bound, upper_bound);
+  // the workspace is set up again only when the problem size changes, otherwise only the values
+  // are updated and the solver is warm started from the previous solution shifted by ego travel
+  const auto P_csc = autoware::osqp_interface::calCSCMatrixTrapezoidal(P);
+  const auto A_csc = autoware::osqp_interface::calCSCMatrix(A);
+  if (is_qp_initialized_) {
+    qp_solver_.updateCscP(P_csc);
+    qp_solver_.updateCscA(A_csc);
+    qp_solver_.updateQ(q);
+    qp_solver_.updateBounds(lower_bound, upper_bound);
+    qp_solver_.setPrimalVariables(
+      trajectory_utils::shiftOptimizationVariables(prev_input_, input, prev_solution_, N, 4));
+  } else {
+    is_qp_initialized_ =
+      qp_solver_.initializeProblem(P_csc, A_csc, q, lower_bound, upper_bound) == 0;
+  }
+  const auto result = qp_solver_.optimize();
 
   // [b0, b1, ..., bN, |  a0, a1, ..., aN, |
   //  delta0, delta1, ..., deltaN, | sigma0, sigma1, ..., sigmaN]
@@ -212,22 +253,26 @@ bool LinfPseudoJerkSmoother::apply(
   const int status_val = result.solution_status;
   if (status_val != 1) {
     RCLCPP_WARN(logger_, "optimization failed : %s", qp_solver_.getStatusMessage().c_str());
+    is_qp_initialized_ = false;
     return false;
   }
   const auto has_nan =
     std::any_of(optval.begin(), optval.end(), [](const auto v) { return std::isnan(v); });
   if (has_nan) {
     RCLCPP_WARN(logger_, "optimization failed: result contains NaN values");
+    is_qp_initialized_ = false;
     return false;
   }
+  prev_input_ = input;
+  prev_solution_ = optval;
 
   /* get velocity & acceleration */
-  for (unsigned int i = 0; i < N; ++i) {
+  for (unsigned int i = 0; i < input_size; ++i) {
     double v = optval.at(i);
     output.at(i).longitudinal_velocity_mps = std::sqrt(std::max(v, 0.0));
     output.at(i).acceleration_mps2 = optval.at(i + N);
   }
-  for (unsigned int i = N; i < output.size(); ++i) {
+  for (unsigned int i = input_size; i < output.size(); ++i) {
     output.at(i).longitudinal_velocity_mps = 0.0;
     output.at(i).acceleration_mps2 = 0.0;
   }
@@ -15,7 +15,6 @@
 #include "autoware/velocity_smoother/smoother/smoother_base.hpp"
 
 #include "autoware/motion_utils/resample/resample.hpp"
-#include "autoware/motion_utils/trajectory/conversion.hpp"
 #include "autoware/motion_utils/trajectory/trajectory.hpp"
 #include "autoware/velocity_smoother/resample.hpp"
 #include "autoware/velocity_smoother/trajectory_utils.hpp"
@@ -39,29 +38,40 @@ TrajectoryPoints applyPreProcess(
   const TrajectoryPoints & input, const double interval, const bool use_resampling)
 {
   using autoware::motion_utils::calcArcLength;
-  using autoware::motion_utils::convertToTrajectory;
-  using autoware::motion_utils::convertToTrajectoryPointArray;
   using autoware::motion_utils::resampleTrajectory;
 
   if (!use_resampling) {
     return input;
   }
 
-  TrajectoryPoints output;
-  std::vector<double> arc_length;
-
   // since the resampling takes a long time, omit the resampling when it is not requested
   const auto traj_length = calcArcLength(input);
+  std::vector<double> arc_length;
+  arc_length.reserve(static_cast<size_t>(std::ceil(traj_length / interval)));
   for (double s = 0; s < traj_length; s += interval) {
     arc_length.push_back(s);
   }
 
-  const auto points = resampleTrajectory(convertToTrajectory(input), arc_length);
-  output = convertToTrajectoryPointArray(points);
+  // the points are moved in and out of the message instead of being converted one by one
+  autoware_planning_msgs::msg::Trajectory input_traj;
+  input_traj.points = input;
+  auto output = std::move(resampleTrajectory(input_traj, arc_length).points);
   output.back() = input.back();  // keep the final speed.
 
   return output;
 }
+
+/// x and y coordinates of the trajectory points as contiguous arrays
+std::pair<std::vector<double>, std::vector<double>> getPointsXY(const TrajectoryPoints & points)
+{
+  std::vector<double> xs(points.size());
+  std::vector<double> ys(points.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    xs[i] = points[i].pose.position.x;
+    ys[i] = points[i].pose.position.y;
+  }
+  return {std::move(xs), std::move(ys)};
+}
 }  // namespace
 
 SmootherBase::SmootherBase(
@@ -97,6 +107,7 @@ SmootherBase::SmootherBase(
   p.resample_param.sparse_resample_dt = node.declare_parameter<double>("sparse_resample_dt");
   p.resample_param.sparse_min_interval_distance =
     node.declare_parameter<double>("sparse_min_interval_distance");
+  p.resample_param.fixed_resample_num = node.declare_parameter<int>("fixed_resample_num");
 }
 
 void SmootherBase::setWheelBase(const double wheel_base)
@@ -239,7 +250,7 @@ std::vector<std::pair<double, double>> SmootherBase::computeSteerRateVelocityRat
 
 double SmootherBase::computeVelocityLimitFromLateralAcc(
   const double local_curvature,
-  const std::vector<std::pair<double, double>> lateral_acceleration_velocity_square_ratio_limits)
+  const std::vector<std::pair<double, double>> & lateral_acceleration_velocity_square_ratio_limits)
   const
 {
   auto compute_velocity = [](double acc, double curvature) {
@@ -253,7 +264,7 @@ double SmootherBase::computeVelocityLimitFromLateralAcc(
 
 double SmootherBase::computeVelocityLimitFromSteerRate(
   const double local_steer_rate_velocity_ratio,
-  const std::vector<std::pair<double, double>> steer_rate_velocity_ratio_limits) const
+  const std::vector<std::pair<double, double>> & steer_rate_velocity_ratio_limits) const
 {
   auto compute_velocity = [](double rate_deg, double ratio) {
     return autoware_utils_math::deg2rad(rate_deg) / ratio;
@@ -276,29 +287,19 @@ TrajectoryPoints SmootherBase::applyLateralAccelerationFilter(
   }
 
   // Interpolate with constant interval distance for lateral acceleration calculation.
-  TrajectoryPoints output;
   const double points_interval =
     use_resampling ? base_param_.sample_ds : input_points_interval;  // [m]
-  // since the resampling takes a long time, omit the resampling when it is not requested
-  if (use_resampling) {
-    std::vector<double> out_arclength;
-    const auto traj_length = autoware::motion_utils::calcArcLength(input);
-    for (double s = 0; s < traj_length; s += points_interval) {
-      out_arclength.push_back(s);
-    }
-    const auto output_traj = autoware::motion_utils::resampleTrajectory(
-      autoware::motion_utils::convertToTrajectory(input), out_arclength);
-    output = autoware::motion_utils::convertToTrajectoryPointArray(output_traj);
-    output.back() = input.back();  // keep the final speed.
-  } else {
-    output = input;
-  }
+  auto output = applyPreProcess(input, points_interval, use_resampling);
 
   const size_t idx_dist = static_cast<size_t>(
     std::max(static_cast<int>((base_param_.curvature_calculation_distance) / points_interval), 1));
 
   // Calculate curvature assuming the trajectory points interval is constant
-  const auto curvature_v = trajectory_utils::calcTrajectoryCurvatureFrom3Points(output, idx_dist);
+  const auto [xs, ys] = getPointsXY(output);
+  auto abs_curvature_v = trajectory_utils::calcTrajectoryCurvatureFrom3Points(xs, ys, idx_dist);
+  for (auto & curvature : abs_curvature_v) {
+    curvature = std::fabs(curvature);
+  }
 
   //  Decrease speed according to lateral G
   const size_t before_decel_index =
@@ -315,24 +316,36 @@ TrajectoryPoints SmootherBase::applyLateralAccelerationFilter(
   const auto lateral_acceleration_velocity_square_ratio_limits =
     computeLateralAccelerationVelocitySquareRatioLimits();
 
+  // The max curvature in [i - after_decel_index, i + before_decel_index] is kept at the front of a
+  // queue of indices with decreasing curvatures, so that each point is visited once.
+  std::vector<size_t> window;
+  window.reserve(output.size());
+  size_t window_front = 0;
+  size_t next_idx = 0;
   for (size_t i = 0; i < output.size(); ++i) {
-    double curvature = 0.0;
-    const size_t start = i > after_decel_index ? i - after_decel_index : 0;
     const size_t end = std::min(output.size(), i + before_decel_index + 1);
-    for (size_t j = start; j < end; ++j) {
-      if (j >= curvature_v.size()) return output;
-      curvature = std::max(curvature, std::fabs(curvature_v.at(j)));
+    for (; next_idx < end; ++next_idx) {
+      while (window.size() > window_front &&
+             abs_curvature_v[window.back()] <= abs_curvature_v[next_idx]) {
+        window.pop_back();
+      }
+      window.push_back(next_idx);
+    }
+    const size_t start = i > after_decel_index ? i - after_decel_index : 0;
+    while (window[window_front] < start) {
+      ++window_front;
     }
+    const double curvature = abs_curvature_v[window[window_front]];
+
     double v_curvature_max = computeVelocityLimitFromLateralAcc(
       curvature, lateral_acceleration_velocity_square_ratio_limits);
     v_curvature_max = std::max(v_curvature_max, base_param_.min_curve_velocity);
 
     if (enable_smooth_limit) {
-      if (i >= latacc_min_vel_arr.size()) return output;
-      v_curvature_max = std::max(v_curvature_max, latacc_min_vel_arr.at(i));
+      v_curvature_max = std::max(v_curvature_max, latacc_min_vel_arr[i]);
     }
-    if (output.at(i).longitudinal_velocity_mps > v_curvature_max) {
-      output.at(i).longitudinal_velocity_mps = v_curvature_max;
+    if (output[i].longitudinal_velocity_mps > v_curvature_max) {
+      output[i].longitudinal_velocity_mps = v_curvature_max;
     }
   }
   return output;
@@ -358,54 +371,58 @@ TrajectoryPoints SmootherBase::applySteeringRateLimit(
   const size_t idx_dist = static_cast<size_t>(
     std::max(static_cast<int>((base_param_.curvature_calculation_distance) / points_interval), 1));
 
-  // Step1. Calculate curvature assuming the trajectory points interval is constant.
-  const auto curvature_v = trajectory_utils::calcTrajectoryCurvatureFrom3Points(output, idx_dist);
-
-  // Step2. Calculate steer rate for each trajectory point.
-  std::vector<double> steer_rate_velocity_ratio_arr(output.size());
-  for (size_t i = 0; i < output.size() - 1; i++) {
-    // steer
-    auto & steer_front = output.at(i + 1).front_wheel_angle_rad;
-    auto & steer_back = output.at(i).front_wheel_angle_rad;
-
-    // calculate the just 2 steering angle
-    steer_front = std::atan(base_param_.wheel_base * curvature_v.at(i + 1));
-    steer_back = std::atan(base_param_.wheel_base * curvature_v.at(i));
-
-    const auto steering_diff = std::fabs(steer_front - steer_back);
-
-    steer_rate_velocity_ratio_arr.at(i) =
-      steering_diff / (points_interval + std::numeric_limits<double>::epsilon());
+  if (output.size() < 2) {
+    return output;
   }
 
-  steer_rate_velocity_ratio_arr.back() = steer_rate_velocity_ratio_arr.at((output.size() - 2));
+  // Step1. Calculate curvature assuming the trajectory points interval is constant.
+  const auto [xs, ys] = getPointsXY(output);
+  const auto curvature_v = trajectory_utils::calcTrajectoryCurvatureFrom3Points(xs, ys, idx_dist);
 
-  // Step3. Remove noise by mean filter.
-  for (size_t i = 1; i < steer_rate_velocity_ratio_arr.size() - 1; i++) {
-    steer_rate_velocity_ratio_arr.at(i) =
-      (steer_rate_velocity_ratio_arr.at(i - 1) + steer_rate_velocity_ratio_arr.at(i) +
-       steer_rate_velocity_ratio_arr.at(i + 1)) /
-      3.0;
+  // Step2. Calculate the steering angle of each trajectory point.
+  std::vector<decltype(TrajectoryPoint::front_wheel_angle_rad)> steer_v(output.size());
+  for (size_t i = 0; i < output.size(); ++i) {
+    steer_v[i] = std::atan(base_param_.wheel_base * curvature_v[i]);
+    output[i].front_wheel_angle_rad = steer_v[i];
   }
 
-  // Step4. Limit velocity by steer rate.
+  // steer rate of the segment from each point, the last point taking the one of the last segment
+  const size_t last_segment_idx = output.size() - 2;
+  const auto calc_steer_rate_velocity_ratio = [&](const size_t i) {
+    const size_t segment_idx = std::min(i, last_segment_idx);
+    const auto steering_diff = std::fabs(steer_v[segment_idx + 1] - steer_v[segment_idx]);
+    return steering_diff / (points_interval + std::numeric_limits<double>::epsilon());
+  };
+
+  // Step3. Remove noise by mean filter, and limit velocity by steer rate in the same pass.
+  // The mean filter is recursive: the ratio of a point is averaged with the filtered ratio of the
+  // previous point.
+  double steer_rate_velocity_ratio = calc_steer_rate_velocity_ratio(0);
+  double next_steer_rate_velocity_ratio = calc_steer_rate_velocity_ratio(1);
   for (size_t i = 0; i < output.size() - 1; i++) {
-    if (fabs(curvature_v.at(i)) < base_param_.curvature_threshold) {
+    if (i > 0) {
+      const double current_ratio = next_steer_rate_velocity_ratio;
+      next_steer_rate_velocity_ratio = calc_steer_rate_velocity_ratio(i + 1);
+      steer_rate_velocity_ratio =
+        (steer_rate_velocity_ratio + current_ratio + next_steer_rate_velocity_ratio) / 3.0;
+    }
+
+    if (fabs(curvature_v[i]) < base_param_.curvature_threshold) {
       continue;
     }
 
     const auto mean_vel =
-      (output.at(i).longitudinal_velocity_mps + output.at(i + 1).longitudinal_velocity_mps) / 2.0;
+      (output[i].longitudinal_velocity_mps + output[i + 1].longitudinal_velocity_mps) / 2.0;
 
     const auto local_velocity_limit = computeVelocityLimitFromSteerRate(
-      steer_rate_velocity_ratio_arr.at(i), steer_rate_velocity_ratio_limits);
+      steer_rate_velocity_ratio, steer_rate_velocity_ratio_limits);
 
     if (mean_vel < local_velocity_limit) {
       continue;
     }
 
     for (size_t k = 0; k < 2; k++) {
-      auto & velocity = output.at(i + k).longitudinal_velocity_mps;
+      auto & velocity = output[i + k].longitudinal_velocity_mps;
       const float target_velocity = std::max(
         base_param_.min_curve_velocity,
         std::min(local_velocity_limit, velocity * (local_velocity_limit / mean_vel)));
@@ -416,4 +433,148 @@ TrajectoryPoints SmootherBase::applySteeringRateLimit(
   return output;
 }
 
+TrajectoryPoints SmootherBase::applyJerkFilter(
+  const double v0, const double a0, const TrajectoryPoints & input) const
+{
+  autoware_utils_debug::ScopedTimeTrack st(__func__, *time_keeper_);
+
+  if (input.empty()) {
+    return input;
+  }
+
+  const double a_min = base_param_.min_decel;
+  const double a_stop_decel = base_param_.stop_decel;
+  const auto forward_filtered = forwardJerkFilter(
+    v0, std::max(a0, a_min), base_param_.max_accel, 0.0, base_param_.max_jerk, input);
+  const auto backward_filtered = backwardJerkFilter(
+    input.back().longitudinal_velocity_mps, a_stop_decel, a_min, a_stop_decel,
+    base_param_.min_jerk, input);
+  return mergeFilteredTrajectory(
+    v0, a0, a_min, base_param_.min_jerk, forward_filtered, backward_filtered);
+}
+
+TrajectoryPoints SmootherBase::forwardJerkFilter(
+  const double v0, const double a0, const double a_max, const double a_start, const double j_max,
+  const TrajectoryPoints & input) const
+{
+  autoware_utils_debug::ScopedTimeTrack st(__func__, *time_keeper_);
+
+  auto applyLimits = [&input, &a_start](double & v, double & a, size_t i) {
+    double v_lim = input.at(i).longitudinal_velocity_mps;
+    static constexpr double ep = 1.0e-5;
+    if (v > v_lim + ep) {
+      v = v_lim;
+      a = 0.0;
+
+      if (v_lim < 1e-3 && i < input.size() - 1) {
+        double next_v_lim = input.at(i + 1).longitudinal_velocity_mps;
+        if (next_v_lim >= 1e-3) {
+          a = a_start;  // start from stop velocity
+        }
+      }
+    }
+
+    if (v < 0.0) {
+      v = a = 0.0;
+    }
+  };
+
+  auto output = input;
+
+  double current_vel = v0;
+  double current_acc = a0;
+  applyLimits(current_vel, current_acc, 0);
+
+  output.front().longitudinal_velocity_mps = current_vel;
+  output.front().acceleration_mps2 = current_acc;
+  for (size_t i = 1; i < input.size(); ++i) {
+    const double ds = autoware_utils_geometry::calc_distance2d(input.at(i), input.at(i - 1));
+    const double max_dt = std::pow(6.0 * ds / j_max, 1.0 / 3.0);  // assuming v0 = a0 = 0.
+    const double dt = std::min(ds / std::max(current_vel, 1.0e-6), max_dt);
+
+    if (current_acc + j_max * dt >= a_max) {
+      const double tmp_jerk = std::min((a_max - current_acc) / dt, j_max);
+      current_vel = current_vel + current_acc * dt + 0.5 * tmp_jerk * dt * dt;
+      current_acc = a_max;
+    } else {
+      current_vel = current_vel + current_acc * dt + 0.5 * j_max * dt * dt;
+      current_acc = current_acc + j_max * dt;
+    }
+    applyLimits(current_vel, current_acc, i);
+    output.at(i).longitudinal_velocity_mps = current_vel;
+    output.at(i).acceleration_mps2 = current_acc;
+  }
+  return output;
+}
+
+TrajectoryPoints SmootherBase::backwardJerkFilter(
+  const double v0, const double a0, const double a_min, const double a_stop, const double j_min,
+  const TrajectoryPoints & input) const
+{
+  autoware_utils_debug::ScopedTimeTrack st(__func__, *time_keeper_);
+
+  auto input_rev = input;
+  std::reverse(input_rev.begin(), input_rev.end());
+  auto filtered = forwardJerkFilter(
+    v0, std::fabs(a0), std::fabs(a_min), std::fabs(a_stop), std::fabs(j_min), input_rev);
+  std::reverse(filtered.begin(), filtered.end());
+  for (size_t i = 0; i < filtered.size(); ++i) {
+    filtered.at(i).acceleration_mps2 *= -1.0;  // Deceleration
+  }
+  return filtered;
+}
+
+TrajectoryPoints SmootherBase::mergeFilteredTrajectory(
+  const double v0, const double a0, const double a_min, const double j_min,
+  const TrajectoryPoints & forward_filtered, const TrajectoryPoints & backward_filtered) const
+{
+  autoware_utils_debug::ScopedTimeTrack st(__func__, *time_keeper_);
+
+  TrajectoryPoints merged;
+  merged = forward_filtered;
+
+  auto getVx = [](const TrajectoryPoints & trajectory, int i) {
+    return trajectory.at(i).longitudinal_velocity_mps;
+  };
+
+  size_t i = 0;
+
+  if (getVx(backward_filtered, 0) < v0) {
+    double current_vel = v0;
+    double current_acc = a0;
+    while (getVx(backward_filtered, i) < current_vel && i < merged.size() - 1) {
+      merged.at(i).longitudinal_velocity_mps = current_vel;
+      merged.at(i).acceleration_mps2 = current_acc;
+
+      const double ds = autoware_utils_geometry::calc_distance2d(
+        forward_filtered.at(i + 1), forward_filtered.at(i));
+      const double max_dt =
+        std::pow(6.0 * ds / std::fabs(j_min), 1.0 / 3.0);  // assuming v0 = a0 = 0.
+      const double dt = std::min(ds / std::max(current_vel, 1.0e-6), max_dt);
+
+      if (current_acc + j_min * dt < a_min) {
+        const double tmp_jerk = std::max((a_min - current_acc) / dt, j_min);
+        current_vel = current_vel + current_acc * dt + 0.5 * tmp_jerk * dt * dt;
+        current_acc = std::max(current_acc + tmp_jerk * dt, a_min);
+      } else {
+        current_vel = current_vel + current_acc * dt + 0.5 * j_min * dt * dt;
+        current_acc = current_acc + j_min * dt;
+      }
+
+      if (current_vel > getVx(forward_filtered, i)) {
+        current_vel = getVx(forward_filtered, i);
+      }
+      ++i;
+    }
+  }
+
+  // take smaller velocity point
+  for (; i < merged.size(); ++i) {
+    merged.at(i) = (getVx(forward_filtered, i) < getVx(backward_filtered, i))
+                     ? forward_filtered.at(i)
+                     : backward_filtered.at(i);
+  }
+  return merged;
+}
+
 }  // namespace autoware::velocity_smoother
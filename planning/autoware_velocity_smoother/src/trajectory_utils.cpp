@@ -20,6 +20,7 @@
 #include <autoware_utils_geometry/geometry.hpp>
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <map>
 #include <tuple>
@@ -151,10 +152,8 @@ std::vector<double> calcArclengthArray(const TrajectoryPoints & trajectory)
   double dist = 0.0;
   arclength.front() = dist;
   for (unsigned int i = 1; i < trajectory.size(); ++i) {
-    const TrajectoryPoint tp = trajectory.at(i);
-    const TrajectoryPoint tp_prev = trajectory.at(i - 1);
-    dist += autoware_utils_geometry::calc_distance2d(tp.pose, tp_prev.pose);
-    arclength.at(i) = dist;
+    dist += autoware_utils_geometry::calc_distance2d(trajectory[i].pose, trajectory[i - 1].pose);
+    arclength[i] = dist;
   }
   return arclength;
 }
@@ -174,48 +173,56 @@ std::vector<double> calcTrajectoryIntervalDistance(const TrajectoryPoints & traj
 std::vector<double> calcTrajectoryCurvatureFrom3Points(
   const TrajectoryPoints & trajectory, size_t idx_dist)
 {
-  using autoware_utils_geometry::calc_curvature;
-  using autoware_utils_geometry::get_point;
+  std::vector<double> xs(trajectory.size());
+  std::vector<double> ys(trajectory.size());
+  for (size_t i = 0; i < trajectory.size(); ++i) {
+    xs[i] = trajectory[i].pose.position.x;
+    ys[i] = trajectory[i].pose.position.y;
+  }
+  return calcTrajectoryCurvatureFrom3Points(xs, ys, idx_dist);
+}
 
-  if (trajectory.size() < 3) {
-    const std::vector<double> k_arr(trajectory.size(), 0.0);
+std::vector<double> calcTrajectoryCurvatureFrom3Points(
+  const std::vector<double> & xs, const std::vector<double> & ys, size_t idx_dist)
+{
+  const size_t size = std::min(xs.size(), ys.size());
+  if (size < 3) {
+    const std::vector<double> k_arr(size, 0.0);
     return k_arr;
   }
 
   // if the idx size is not enough, change the idx_dist
-  const auto max_idx_dist = static_cast<size_t>(std::floor((trajectory.size() - 1) / 2.0));
+  const auto max_idx_dist = static_cast<size_t>(std::floor((size - 1) / 2.0));
   idx_dist = std::max(1ul, std::min(idx_dist, max_idx_dist));
 
   if (idx_dist < 1) {
     throw std::logic_error("idx_dist less than 1 is not expected");
   }
 
-  // calculate curvature by circle fitting from three points
-  std::vector<double> k_arr(trajectory.size(), 0.0);
-
-  for (size_t i = 1; i + 1 < trajectory.size(); i++) {
-    double curvature = 0.0;
-    const auto p0 = get_point(trajectory.at(i - std::min(idx_dist, i)));
-    const auto p1 = get_point(trajectory.at(i));
-    const auto p2 = get_point(trajectory.at(i + std::min(idx_dist, trajectory.size() - 1 - i)));
-    try {
-      curvature = calc_curvature(p0, p1, p2);
-    } catch (std::exception const & e) {
-      // ...code that handles the error...
+  // calculate curvature by circle fitting from three points (Menger curvature)
+  std::vector<double> k_arr(size, 0.0);
+
+  for (size_t i = 1; i + 1 < size; i++) {
+    const size_t i0 = i - std::min(idx_dist, i);
+    const size_t i2 = i + std::min(idx_dist, size - 1 - i);
+    const double dx01 = xs[i] - xs[i0];
+    const double dy01 = ys[i] - ys[i0];
+    const double dx02 = xs[i2] - xs[i0];
+    const double dy02 = ys[i2] - ys[i0];
+    const double denominator = std::hypot(dx01, dy01) * std::hypot(xs[i2] - xs[i], ys[i2] - ys[i]) *
+                               std::hypot(dx02, dy02);
+    if (std::fabs(denominator) < 1e-10) {
       RCLCPP_WARN(
-        rclcpp::get_logger("autoware_velocity_smoother").get_child("trajectory_utils"), "%s",
-        e.what());
-      if (i > 1) {
-        curvature = k_arr.at(i - 1);  // previous curvature
-      } else {
-        curvature = 0.0;
-      }
+        rclcpp::get_logger("autoware_velocity_smoother").get_child("trajectory_utils"),
+        "points are too close for curvature calculation.");
+      k_arr[i] = i > 1 ? k_arr[i - 1] : 0.0;  // previous curvature
+      continue;
     }
-    k_arr.at(i) = curvature;
+    k_arr[i] = 2.0 * (dx01 * dy02 - dy01 * dx02) / denominator;
   }
   // copy curvatures for the last and first points;
   k_arr.at(0) = k_arr.at(1);
-  k_arr.back() = k_arr.at((trajectory.size() - 2));
+  k_arr.back() = k_arr.at((size - 2));
 
   return k_arr;
 }
@@ -472,5 +479,43 @@ double calcStopDistance(const TrajectoryPoints & trajectory, const size_t closes
   return stop_dist;
 }
 
+std::vector<double> shiftOptimizationVariables(
+  const TrajectoryPoints & prev_trajectory, const TrajectoryPoints & trajectory,
+  const std::vector<double> & prev_variables, const size_t block_size, const size_t block_num)
+{
+  std::vector<double> variables = prev_variables;
+  if (
+    prev_trajectory.empty() || trajectory.empty() ||
+    prev_variables.size() < block_size * block_num) {
+    return variables;
+  }
+
+  const double travel_dist = autoware::motion_utils::calcSignedArcLength(
+    prev_trajectory, 0, trajectory.front().pose.position);
+  const auto prev_arclength = calcArclengthArray(prev_trajectory);
+  const auto arclength = calcArclengthArray(trajectory);
+  const size_t prev_size = std::min(prev_trajectory.size(), block_size);
+  const size_t size = std::min(trajectory.size(), block_size);
+  const auto prev_arclength_end = prev_arclength.begin() + static_cast<std::ptrdiff_t>(prev_size);
+
+  for (size_t i = 0; i < size; ++i) {
+    const double s =
+      std::clamp(arclength.at(i) + travel_dist, 0.0, prev_arclength.at(prev_size - 1));
+    const size_t next_idx = std::min(
+      static_cast<size_t>(
+        std::upper_bound(prev_arclength.begin(), prev_arclength_end, s) - prev_arclength.begin()),
+      prev_size - 1);
+    const size_t idx = next_idx == 0 ? 0 : next_idx - 1;
+    const double ds = prev_arclength.at(next_idx) - prev_arclength.at(idx);
+    const double ratio = ds < 1e-6 ? 0.0 : (s - prev_arclength.at(idx)) / ds;
+    for (size_t k = 0; k < block_num; ++k) {
+      variables.at(k * block_size + i) = autoware::interpolation::lerp(
+        prev_variables.at(k * block_size + idx), prev_variables.at(k * block_size + next_idx),
+        ratio);
+    }
+  }
+  return variables;
+}
+
 }  // namespace trajectory_utils
 }  // namespace autoware::velocity_smoother
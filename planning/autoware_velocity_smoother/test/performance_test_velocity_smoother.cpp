@@ -0,0 +1,77 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Drives the velocity smoother at 10 Hz with a 200 m trajectory and reports the latency, the CPU
+// time and the allocations of its callbacks per planning cycle.
+
+#include "autoware/velocity_smoother/node.hpp"
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <autoware/planning_test_manager/autoware_planning_performance_test_manager.hpp>
+#include <autoware_test_utils/autoware_test_utils.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+using autoware::planning_test_manager::PlanningPerformanceTestManager;
+using autoware::velocity_smoother::VelocitySmootherNode;
+
+TEST(PlanningModulePerformanceTest, VelocitySmoother)
+{
+  rclcpp::init(0, nullptr);
+
+  for (const std::string algorithm_type : {"JerkFiltered", "Analytical"}) {
+    auto node_options = rclcpp::NodeOptions{};
+    node_options.append_parameter_override("algorithm_type", algorithm_type);
+    node_options.append_parameter_override("publish_debug_trajs", false);
+    const auto autoware_test_utils_dir =
+      ament_index_cpp::get_package_share_directory("autoware_test_utils");
+    const auto velocity_smoother_dir =
+      ament_index_cpp::get_package_share_directory("autoware_velocity_smoother");
+    autoware::test_utils::updateNodeOptions(
+      node_options, {autoware_test_utils_dir + "/config/test_common.param.yaml",
+                     autoware_test_utils_dir + "/config/test_nearest_search.param.yaml",
+                     autoware_test_utils_dir + "/config/test_vehicle_info.param.yaml",
+                     velocity_smoother_dir + "/config/default_velocity_smoother.param.yaml",
+                     velocity_smoother_dir + "/config/default_common.param.yaml",
+                     velocity_smoother_dir + "/config/" + algorithm_type + ".param.yaml"});
+    const auto test_target_node = std::make_shared<VelocitySmootherNode>(node_options);
+
+    PlanningPerformanceTestManager test_manager;
+    test_manager.publishInput(
+      test_target_node, "velocity_smoother/input/external_velocity_limit_mps",
+      autoware_internal_planning_msgs::msg::VelocityLimit{});
+    test_manager.publishInput(
+      test_target_node, "velocity_smoother/input/operation_mode_state",
+      autoware_adapi_v1_msgs::msg::OperationModeState{});
+    test_manager.publishCyclicInput(
+      "/localization/kinematic_state", autoware::test_utils::makeOdometry());
+    test_manager.publishCyclicInput(
+      "velocity_smoother/input/acceleration", geometry_msgs::msg::AccelWithCovarianceStamped{});
+    test_manager.publishCyclicInput(
+      "velocity_smoother/input/trajectory",
+      autoware::test_utils::generateTrajectory<autoware_planning_msgs::msg::Trajectory>(
+        200, 1.0, 10.0));
+    test_manager.subscribeOutput<autoware_planning_msgs::msg::Trajectory>(
+      "velocity_smoother/output/trajectory");
+
+    const auto report = test_manager.run(test_target_node, 100);
+    PlanningPerformanceTestManager::printReport(report);
+    EXPECT_GT(report.output_num, 0U);
+  }
+
+  rclcpp::shutdown();
+}
@@ -212,6 +212,28 @@ TEST_F(TestSmootherBase, ComputeVelocityLimitFromSteerRate)
   EXPECT_NEAR(velocity_limit, 25.0, 1e-10);
 }
 
+TEST_F(TestSmootherBase, ApplyJerkFilter)
+{
+  autoware::velocity_smoother::TrajectoryPoints input(50);
+  for (size_t i = 0; i < input.size(); ++i) {
+    input.at(i).pose.position.x = static_cast<double>(i);
+    input.at(i).pose.orientation.w = 1.0;
+    input.at(i).longitudinal_velocity_mps = i + 1 < input.size() ? 10.0 : 0.0;
+  }
+
+  const auto output = smoother_base->applyJerkFilter(2.0, 0.0, input);
+  ASSERT_EQ(output.size(), input.size());
+  EXPECT_NEAR(output.front().longitudinal_velocity_mps, 2.0, 1e-6);
+  EXPECT_NEAR(output.back().longitudinal_velocity_mps, 0.0, 1e-6);
+  for (size_t i = 0; i < output.size(); ++i) {
+    EXPECT_LE(output.at(i).longitudinal_velocity_mps, input.at(i).longitudinal_velocity_mps + 1e-6);
+    EXPECT_LE(output.at(i).acceleration_mps2, 1.0 + 1e-6);
+    EXPECT_GE(output.at(i).acceleration_mps2, -1.0 - 1e-6);
+  }
+
+  EXPECT_TRUE(smoother_base->applyJerkFilter(2.0, 0.0, {}).empty());
+}
+
 int main(int argc, char ** argv)
 {
   testing::InitGoogleTest(&argc, argv);
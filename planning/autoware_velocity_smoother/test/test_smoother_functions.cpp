@@ -12,10 +12,13 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include "autoware/velocity_smoother/resample.hpp"
 #include "autoware/velocity_smoother/trajectory_utils.hpp"
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
 #include <vector>
 
 using autoware::velocity_smoother::trajectory_utils::TrajectoryPoints;
@@ -61,3 +64,115 @@ TEST(TestTrajectoryUtils, CalcTrajectoryCurvatureFrom3Points)
     }
   }
 }
+
+TEST(TestTrajectoryUtils, CalcTrajectoryCurvatureFrom3PointsOfCircle)
+{
+  // points every 0.1 rad on a circle of radius 20 m, turning left
+  constexpr double radius = 20.0;
+  std::vector<double> xs;
+  std::vector<double> ys;
+  for (size_t i = 0; i < 30; ++i) {
+    xs.push_back(radius * std::sin(0.1 * static_cast<double>(i)));
+    ys.push_back(radius * (1.0 - std::cos(0.1 * static_cast<double>(i))));
+  }
+  const auto curvatures =
+    autoware::velocity_smoother::trajectory_utils::calcTrajectoryCurvatureFrom3Points(xs, ys, 2);
+  ASSERT_EQ(curvatures.size(), xs.size());
+  for (const double curvature : curvatures) {
+    EXPECT_NEAR(curvature, 1.0 / radius, 1e-6);
+  }
+
+  // coincident points take the previous curvature
+  xs.assign(5, 0.0);
+  ys.assign(5, 0.0);
+  for (const double curvature :
+       autoware::velocity_smoother::trajectory_utils::calcTrajectoryCurvatureFrom3Points(
+         xs, ys, 1)) {
+    EXPECT_DOUBLE_EQ(curvature, 0.0);
+  }
+}
+
+TEST(TestTrajectoryUtils, ShiftOptimizationVariables)
+{
+  using autoware::velocity_smoother::trajectory_utils::shiftOptimizationVariables;
+
+  const auto prev_trajectory = genStraightTrajectory(5);
+  // two blocks of 6 values, the last point of each block being padded, and a last variable
+  const std::vector<double> prev_variables{0.0, 10.0, 20.0, 30.0, 40.0, 99.0, 1.0,
+                                           2.0, 3.0,  4.0,  5.0,  99.0, 7.0};
+
+  auto trajectory = genStraightTrajectory(3);
+  for (auto & p : trajectory) {
+    p.pose.position.x += 1.5;
+  }
+  const auto variables =
+    shiftOptimizationVariables(prev_trajectory, trajectory, prev_variables, 6, 2);
+  const std::vector<double> expected{15.0, 25.0, 35.0, 30.0, 40.0, 99.0, 2.5,
+                                     3.5,  4.5,  4.0,  5.0,  99.0, 7.0};
+  ASSERT_EQ(variables.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_NEAR(variables.at(i), expected.at(i), 1e-6) << "i = " << i;
+  }
+
+  // the points beyond the previous trajectory take its last values
+  for (auto & p : trajectory) {
+    p.pose.position.x += 2.0;
+  }
+  const auto clamped_variables =
+    shiftOptimizationVariables(prev_trajectory, trajectory, prev_variables, 6, 2);
+  EXPECT_NEAR(clamped_variables.at(0), 35.0, 1e-6);
+  EXPECT_NEAR(clamped_variables.at(1), 40.0, 1e-6);
+  EXPECT_NEAR(clamped_variables.at(2), 40.0, 1e-6);
+}
+
+TEST(TestResampling, FixedNumberOfAheadPoints)
+{
+  using autoware::velocity_smoother::resampling::resampleTrajectory;
+
+  autoware::velocity_smoother::resampling::ResampleParam param;
+  param.max_trajectory_length = 200.0;
+  param.min_trajectory_length = 150.0;
+  param.resample_time = 2.0;
+  param.dense_resample_dt = 0.2;
+  param.dense_min_interval_distance = 0.1;
+  param.sparse_resample_dt = 0.5;
+  param.sparse_min_interval_distance = 4.0;
+  param.fixed_resample_num = 50;
+
+  auto trajectory = genStraightTrajectory(300);
+  for (auto & p : trajectory) {
+    p.longitudinal_velocity_mps = 10.0;
+  }
+  geometry_msgs::msg::Pose current_pose;
+  current_pose.position.x = 5.03;
+  current_pose.orientation.w = 1.0;
+
+  const auto count_ahead_points = [&](const TrajectoryPoints & points) {
+    return std::count_if(points.begin(), points.end(), [&](const TrajectoryPoint & p) {
+      return p.pose.position.x > current_pose.position.x + 1e-3;
+    });
+  };
+
+  // the number of points ahead of ego does not depend on the velocity
+  for (const double v_current : {0.0, 3.0, 10.0, 20.0}) {
+    const auto output = resampleTrajectory(trajectory, v_current, current_pose, 3.0, 1.0, param);
+    EXPECT_EQ(count_ahead_points(output), 50) << "v_current = " << v_current;
+    EXPECT_NEAR(output.back().pose.position.x, 5.03 + 150.0, 1e-3) << "v_current = " << v_current;
+  }
+
+  // a stop point replaces its nearest point
+  for (size_t i = 40; i < trajectory.size(); ++i) {
+    trajectory.at(i).longitudinal_velocity_mps = 0.0;
+  }
+  const auto output = resampleTrajectory(trajectory, 10.0, current_pose, 3.0, 1.0, param);
+  EXPECT_EQ(count_ahead_points(output), 50);
+  EXPECT_TRUE(std::any_of(output.begin(), output.end(), [](const TrajectoryPoint & p) {
+    return std::abs(p.pose.position.x - 40.0) < 1e-3;
+  }));
+
+  // the end point is kept when the trajectory is shorter than the horizon
+  const auto short_output =
+    resampleTrajectory(genStraightTrajectory(60), 10.0, current_pose, 3.0, 1.0, param);
+  EXPECT_EQ(count_ahead_points(short_output), 50);
+  EXPECT_NEAR(short_output.back().pose.position.x, 59.0, 1e-3);
+}
@@ -57,6 +57,10 @@ private:
   pluginlib::ClassLoader<PluginInterface> plugin_loader_;
   std::vector<std::shared_ptr<PluginInterface>> scene_manager_plugins_;
   RequiredSubscriptionInfo required_subscriptions_;
+
+  // lane IDs on the forward path in the previous cycle, and the map they belong to
+  std::vector<int64_t> prev_lane_ids_on_path_;
+  lanelet::LaneletMapConstPtr prev_lanelet_map_;
 };
 }  // namespace autoware::behavior_velocity_planner
 
@@ -24,12 +24,14 @@
 #include <tf2_eigen/tf2_eigen.hpp>
 
 #include <diagnostic_msgs/msg/diagnostic_status.hpp>
+#include <sensor_msgs/point_cloud2_iterator.hpp>
 #include <visualization_msgs/msg/marker_array.hpp>
 
 #include <lanelet2_routing/Route.h>
 #include <pcl/common/transforms.h>
 #include <pcl_conversions/pcl_conversions.h>
 
+#include <algorithm>
 #include <functional>
 #include <memory>
 #include <string>
@@ -49,6 +51,19 @@ autoware_planning_msgs::msg::Path to_path(
   }
   return path;
 }
+
+rclcpp::CallbackGroup::SharedPtr create_mutually_exclusive_callback_group(rclcpp::Node * node_ptr)
+{
+  return node_ptr->create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+}
+
+rclcpp::SubscriptionOptions create_subscription_options(rclcpp::Node * node_ptr)
+{
+  auto sub_opt = rclcpp::SubscriptionOptions();
+  sub_opt.callback_group = create_mutually_exclusive_callback_group(node_ptr);
+
+  return sub_opt;
+}
 }  // namespace
 
 BehaviorVelocityPlannerNode::BehaviorVelocityPlannerNode(const rclcpp::NodeOptions & node_options)
@@ -63,13 +78,18 @@ BehaviorVelocityPlannerNode::BehaviorVelocityPlannerNode(const rclcpp::NodeOptio
   // Trigger Subscriber
   trigger_sub_path_with_lane_id_ =
     this->create_subscription<autoware_internal_planning_msgs::msg::PathWithLaneId>(
-      "~/input/path_with_lane_id", 1, std::bind(&BehaviorVelocityPlannerNode::onTrigger, this, _1));
+      "~/input/path_with_lane_id", 1, std::bind(&BehaviorVelocityPlannerNode::onTrigger, this, _1),
+      create_subscription_options(this));
 
+  // NOTE: the plugin services have their own callback group and are serialized by mutex_.
+  const auto service_callback_group = create_mutually_exclusive_callback_group(this);
   srv_load_plugin_ = create_service<LoadPlugin>(
-    "~/service/load_plugin", std::bind(&BehaviorVelocityPlannerNode::onLoadPlugin, this, _1, _2));
+    "~/service/load_plugin", std::bind(&BehaviorVelocityPlannerNode::onLoadPlugin, this, _1, _2),
+    rmw_qos_profile_services_default, service_callback_group);
   srv_unload_plugin_ = create_service<UnloadPlugin>(
     "~/service/unload_plugin",
-    std::bind(&BehaviorVelocityPlannerNode::onUnloadPlugin, this, _1, _2));
+    std::bind(&BehaviorVelocityPlannerNode::onUnloadPlugin, this, _1, _2),
+    rmw_qos_profile_services_default, service_callback_group);
 
   // set velocity smoother param
   onParam();
@@ -142,15 +162,39 @@ void BehaviorVelocityPlannerNode::processNoGroundPointCloud(
     return;
   }
 
-  pcl::PointCloud<pcl::PointXYZ> pc;
-  pcl::fromROSMsg(*msg, pc);
-
   Eigen::Affine3f affine = tf2::transformToEigen(transform.transform).cast<float>();
   pcl::PointCloud<pcl::PointXYZ>::Ptr pc_transformed(new pcl::PointCloud<pcl::PointXYZ>);
-  if (!pc.empty()) {
-    autoware_utils_pcl::transform_pointcloud(pc, *pc_transformed, affine);
+
+  const auto is_float32_field = [&](const char * name) {
+    return std::any_of(msg->fields.begin(), msg->fields.end(), [&](const auto & field) {
+      return field.name == name && field.datatype == sensor_msgs::msg::PointField::FLOAT32;
+    });
+  };
+  if (!is_float32_field("x") || !is_float32_field("y") || !is_float32_field("z")) {
+    pcl::PointCloud<pcl::PointXYZ> pc;
+    pcl::fromROSMsg(*msg, pc);
+    if (!pc.empty()) {
+      autoware_utils_pcl::transform_pointcloud(pc, *pc_transformed, affine);
+    }
+    planner_data_.no_ground_pointcloud = pc_transformed;
+    return;
   }
 
+  // the points are transformed while they are read from the message, without an intermediate
+  // pointcloud in the sensor frame
+  pcl_conversions::toPCL(msg->header, pc_transformed->header);
+  pc_transformed->points.reserve(static_cast<size_t>(msg->width) * msg->height);
+  sensor_msgs::PointCloud2ConstIterator<float> iter_x(*msg, "x");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_y(*msg, "y");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_z(*msg, "z");
+  for (; iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_z) {
+    const Eigen::Vector3f p = affine * Eigen::Vector3f(*iter_x, *iter_y, *iter_z);
+    pc_transformed->points.emplace_back(p.x(), p.y(), p.z());
+  }
+  pc_transformed->width = static_cast<uint32_t>(pc_transformed->points.size());
+  pc_transformed->height = 1;
+  pc_transformed->is_dense = msg->is_dense;
+
   planner_data_.no_ground_pointcloud = pc_transformed;
 }
 
@@ -167,22 +211,7 @@ void BehaviorVelocityPlannerNode::processOdometry(const nav_msgs::msg::Odometry:
   planner_data_.current_velocity = current_velocity;
 
   // Add velocity to buffer
-  planner_data_.velocity_buffer.push_front(*current_velocity);
-  const rclcpp::Time now = this->now();
-  while (!planner_data_.velocity_buffer.empty()) {
-    // Check oldest data time
-    const auto & s = planner_data_.velocity_buffer.back().header.stamp;
-    const auto time_diff =
-      now >= s ? now - s : rclcpp::Duration(0, 0);  // Note: negative time throws an exception.
-
-    // Finish when oldest data is newer than threshold
-    if (time_diff.seconds() <= PlannerData::velocity_buffer_time_sec) {
-      break;
-    }
-
-    // Remove old data
-    planner_data_.velocity_buffer.pop_back();
-  }
+  planner_data_.addVelocityToBuffer(*current_velocity);
 }
 
 void BehaviorVelocityPlannerNode::processTrafficSignals(
@@ -323,6 +352,8 @@ void BehaviorVelocityPlannerNode::onTrigger(
     return;
   }
 
+  planner_data_.updateLanesOnPath(*input_path_msg);
+
   const autoware_planning_msgs::msg::Path output_path_msg =
     generatePath(input_path_msg, planner_data_);
 
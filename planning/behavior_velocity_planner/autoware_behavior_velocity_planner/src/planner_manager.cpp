@@ -22,6 +22,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 namespace autoware::behavior_velocity_planner
 {
@@ -84,8 +85,22 @@ BehaviorVelocityPlannerManager::planPathVelocity(
 {
   autoware_internal_planning_msgs::msg::PathWithLaneId output_path_msg = input_path_msg;
 
+  // the lane IDs on the forward path are computed once for all the plugins
+  const auto lanelet_map = planner_data->route_handler_->getLaneletMapPtr();
+  if (lanelet_map != prev_lanelet_map_) {
+    prev_lane_ids_on_path_.clear();
+    prev_lanelet_map_ = lanelet_map;
+  }
+  const auto lane_ids_on_path_diff = planning_utils::calcLaneIdsOnPathDiff(
+    prev_lane_ids_on_path_,
+    planner_data->lanes_on_path
+      ? planner_data->lanes_on_path->forward_lane_ids
+      : planning_utils::getLaneIdsOnPath(
+          input_path_msg, lanelet_map, planner_data->current_odometry->pose));
+  prev_lane_ids_on_path_ = lane_ids_on_path_diff.lane_ids;
+
   for (const auto & plugin : scene_manager_plugins_) {
-    plugin->updateSceneModuleInstances(planner_data, input_path_msg);
+    plugin->updateSceneModuleInstances(planner_data, input_path_msg, lane_ids_on_path_diff);
     plugin->plan(&output_path_msg);
   }
 
@@ -0,0 +1,56 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Drives the behavior velocity planner at 10 Hz with the path of the sample map of
+// autoware_test_utils and reports the latency, the CPU time and the allocations of its callbacks
+// per planning cycle.
+
+#include "autoware/behavior_velocity_planner/test_utils.hpp"
+
+#include <autoware/planning_test_manager/autoware_planning_performance_test_manager.hpp>
+#include <autoware_test_utils/autoware_test_utils.hpp>
+
+#include <autoware_planning_msgs/msg/path.hpp>
+
+#include <gtest/gtest.h>
+
+namespace autoware::behavior_velocity_planner
+{
+using autoware::planning_test_manager::PlanningPerformanceTestManager;
+
+TEST(PlanningModulePerformanceTest, BehaviorVelocityPlanner)
+{
+  rclcpp::init(0, nullptr);
+  const auto test_target_node = generateNode({});
+
+  // the inputs which are not stamped at every cycle are published by the interface test manager
+  const auto interface_test_manager = generateTestManager();
+  publishMandatoryTopics(interface_test_manager, test_target_node);
+
+  PlanningPerformanceTestManager test_manager;
+  test_manager.publishCyclicInput(
+    "behavior_velocity_planner_node/input/vehicle_odometry", autoware::test_utils::makeOdometry());
+  test_manager.publishCyclicInput(
+    "behavior_velocity_planner_node/input/path_with_lane_id",
+    autoware::test_utils::loadPathWithLaneIdInYaml());
+  test_manager.subscribeOutput<autoware_planning_msgs::msg::Path>(
+    "behavior_velocity_planner_node/output/path");
+
+  const auto report = test_manager.run(test_target_node, 100);
+  PlanningPerformanceTestManager::printReport(report);
+  EXPECT_GT(report.output_num, 0U);
+
+  rclcpp::shutdown();
+}
+}  // namespace autoware::behavior_velocity_planner
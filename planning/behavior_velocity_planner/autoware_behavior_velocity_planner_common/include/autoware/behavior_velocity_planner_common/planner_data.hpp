@@ -16,6 +16,7 @@
 #define AUTOWARE__BEHAVIOR_VELOCITY_PLANNER_COMMON__PLANNER_DATA_HPP_
 
 #include "autoware/behavior_velocity_planner_common/utilization/util.hpp"
+#include "autoware/motion_utils/vehicle/vehicle_state_checker.hpp"
 #include "autoware/route_handler/route_handler.hpp"
 #include "autoware/velocity_smoother/smoother/smoother_base.hpp"
 #include "autoware_vehicle_info_utils/vehicle_info_utils.hpp"
@@ -34,13 +35,31 @@
 #include <pcl/point_cloud.h>
 #include <pcl/point_types.h>
 
-#include <deque>
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <optional>
+#include <vector>
 
 namespace autoware::behavior_velocity_planner
 {
+/**
+ * @brief Lanes derived from the input path, computed once per path for all the modules.
+ */
+struct LanesOnPath
+{
+  std::vector<int64_t> lane_ids;                 ///< Unique lane IDs in the order of the path.
+  std::vector<int64_t> forward_lane_ids;         ///< Lane IDs from the lane nearest to the ego.
+  std::vector<int64_t> sorted_forward_lane_ids;  ///< forward_lane_ids in ascending order.
+  lanelet::ConstLanelets forward_lanelets;       ///< Lanelets of forward_lane_ids.
+
+  bool isOnForwardPath(const int64_t lane_id) const
+  {
+    return std::binary_search(
+      sorted_forward_lane_ids.begin(), sorted_forward_lane_ids.end(), lane_id);
+  }
+};
+
 struct PlannerData
 {
   explicit PlannerData(rclcpp::Node & node);
@@ -51,7 +70,7 @@ struct PlannerData
   geometry_msgs::msg::TwistStamped::ConstSharedPtr current_velocity;
   geometry_msgs::msg::AccelWithCovarianceStamped::ConstSharedPtr current_acceleration;
   static constexpr double velocity_buffer_time_sec = 10.0;
-  std::deque<geometry_msgs::msg::TwistStamped> velocity_buffer;
+  autoware::motion_utils::VehicleStopHistory velocity_stop_history{velocity_buffer_time_sec};
   autoware_perception_msgs::msg::PredictedObjects::ConstSharedPtr predicted_objects;
   pcl::PointCloud<pcl::PointXYZ>::ConstPtr no_ground_pointcloud;
 
@@ -78,6 +97,21 @@ struct PlannerData
   double system_delay;
   double delay_response_time;
 
+  // shared between the copies of the planner data, since it only changes with the input path
+  std::shared_ptr<const LanesOnPath> lanes_on_path;
+
+  /**
+   * @brief compute the lanes on the input path, requires route_handler_ and current_odometry
+   * @param path Input path of the cycle
+   */
+  void updateLanesOnPath(const PathWithLaneId & path);
+
+  /**
+   * @brief add the velocity to velocity_stop_history, which keeps velocity_buffer_time_sec
+   * @param velocity velocity newer than the previous ones
+   */
+  void addVelocityToBuffer(const geometry_msgs::msg::TwistStamped & velocity);
+
   bool isVehicleStopped(const double stop_duration = 0.0) const;
 
   std::optional<TrafficSignalStamped> getTrafficSignal(
@@ -16,6 +16,7 @@
 #define AUTOWARE__BEHAVIOR_VELOCITY_PLANNER_COMMON__PLUGIN_INTERFACE_HPP_
 
 #include <autoware/behavior_velocity_planner_common/planner_data.hpp>
+#include <autoware/behavior_velocity_planner_common/utilization/util.hpp>
 #include <rclcpp/rclcpp.hpp>
 
 #include <autoware_internal_planning_msgs/msg/path_with_lane_id.hpp>
@@ -35,6 +36,14 @@ public:
   virtual void updateSceneModuleInstances(
     const std::shared_ptr<const PlannerData> & planner_data,
     const autoware_internal_planning_msgs::msg::PathWithLaneId & path) = 0;
+  // the lane IDs on the forward path are computed once for all the plugins in a cycle
+  virtual void updateSceneModuleInstances(
+    const std::shared_ptr<const PlannerData> & planner_data,
+    const autoware_internal_planning_msgs::msg::PathWithLaneId & path,
+    [[maybe_unused]] const planning_utils::LaneIdsOnPathDiff & lane_ids_on_path_diff)
+  {
+    updateSceneModuleInstances(planner_data, path);
+  }
   virtual const char * getModuleName() = 0;
 };
 
@@ -42,6 +42,13 @@ public:
   {
     scene_manager_->updateSceneModuleInstances(planner_data, path);
   }
+  void updateSceneModuleInstances(
+    const std::shared_ptr<const PlannerData> & planner_data,
+    const autoware_internal_planning_msgs::msg::PathWithLaneId & path,
+    const planning_utils::LaneIdsOnPathDiff & lane_ids_on_path_diff) override
+  {
+    scene_manager_->updateSceneModuleInstances(planner_data, path, lane_ids_on_path_diff);
+  }
   const char * getModuleName() override { return scene_manager_->getModuleName(); }
 
 private:
@@ -16,7 +16,9 @@
 #define AUTOWARE__BEHAVIOR_VELOCITY_PLANNER_COMMON__SCENE_MODULE_INTERFACE_HPP_
 
 #include <autoware/behavior_velocity_planner_common/planner_data.hpp>
+#include <autoware/behavior_velocity_planner_common/utilization/path_edit_buffer.hpp>
 #include <autoware/behavior_velocity_planner_common/utilization/util.hpp>
+#include <autoware/motion_utils/marker/marker_publish_gate.hpp>
 #include <autoware/motion_utils/marker/virtual_wall_marker_creator.hpp>
 #include <autoware/motion_utils/trajectory/trajectory.hpp>
 #include <autoware/objects_of_interest_marker_interface/objects_of_interest_marker_interface.hpp>
@@ -32,6 +34,8 @@
 #include <autoware_planning_msgs/msg/path.hpp>
 #include <unique_identifier_msgs/msg/uuid.hpp>
 
+#include <algorithm>
+#include <future>
 #include <iomanip>
 #include <memory>
 #include <optional>
@@ -73,6 +77,17 @@ struct ObjectOfInterest
   }
 };
 
+/**
+ * @brief velocity limit planned by a scene module on a read-only path. The velocity is limited
+ * from the pose to the end of the path, and a limit of 0 inserts a stop point.
+ */
+struct PathVelocityLimit
+{
+  geometry_msgs::msg::Pose pose;  ///< Pose on the path where the limit starts.
+  double velocity;                ///< Maximum velocity after the pose [m/s].
+  std::string detail;             ///< Detail of the planning factor, none is added if empty.
+};
+
 class SceneModuleInterface
 {
 public:
@@ -85,6 +100,18 @@ public:
 
   virtual bool modifyPathVelocity(PathWithLaneId * path) = 0;
 
+  /**
+   * @brief plan the velocity limits on a read-only path instead of modifying it, so that the
+   * modules can be evaluated in parallel and their limits merged afterwards.
+   * @note the implementation must not modify any data shared with the other modules.
+   * @return the velocity limits, or std::nullopt if the module only supports modifyPathVelocity
+   */
+  virtual std::optional<std::vector<PathVelocityLimit>> planPathVelocityLimits(
+    [[maybe_unused]] const PathWithLaneId & path)
+  {
+    return std::nullopt;
+  }
+
   virtual visualization_msgs::msg::MarkerArray createDebugMarkerArray() = 0;
   virtual std::vector<autoware::motion_utils::VirtualWall> createVirtualWalls() = 0;
 
@@ -162,6 +189,9 @@ public:
       std::make_shared<planning_factor_interface::PlanningFactorInterface>(
         &node, module_name, enable_console_output, throttle_duration_ms);
 
+    is_parallel_evaluation_enabled_ =
+      get_or_declare_parameter<bool>(node, "enable_parallel_scene_module_evaluation");
+
     processing_time_publisher_ = std::make_shared<DebugPublisher>(&node, "~/debug");
 
     pub_processing_time_detail_ = node.create_publisher<autoware_utils_debug::ProcessingTimeDetail>(
@@ -179,6 +209,23 @@ public:
     const autoware_internal_planning_msgs::msg::PathWithLaneId & path)
   {
     planner_data_ = planner_data;
+    lane_ids_on_path_diff_ = std::nullopt;
+
+    launchNewModules(path);
+    deleteExpiredModules(path);
+  }
+
+  /**
+   * @brief update the scene modules with the change of the lane IDs on the forward path, so that
+   * the managers can skip or limit the search of the modules to launch and to delete
+   */
+  void updateSceneModuleInstances(
+    const std::shared_ptr<const PlannerData> & planner_data,
+    const autoware_internal_planning_msgs::msg::PathWithLaneId & path,
+    const planning_utils::LaneIdsOnPathDiff & lane_ids_on_path_diff)
+  {
+    planner_data_ = planner_data;
+    lane_ids_on_path_diff_ = lane_ids_on_path_diff;
 
     launchNewModules(path);
     deleteExpiredModules(path);
@@ -200,32 +247,114 @@ protected:
     stop_watch.tic("Total");
     visualization_msgs::msg::MarkerArray debug_marker_array;
 
-    for (const auto & scene_module : scene_modules_) {
-      scene_module->setPlannerData(planner_data_);
-      scene_module->modifyPathVelocity(path);
+    // the debug markers and the virtual walls are only created when they are subscribed
+    const auto now = clock_->now();
+    const bool is_debug_marker_required = debug_marker_gate_.is_open(pub_debug_, now);
+    const bool is_virtual_wall_required = virtual_wall_gate_.is_open(pub_virtual_wall_, now);
 
-      // The velocity factor must be called after modifyPathVelocity.
+    if (is_parallel_evaluation_enabled_) {
+      modifyPathVelocityInParallel(path);
+    } else {
+      for (const auto & scene_module : scene_modules_) {
+        scene_module->setPlannerData(planner_data_);
+        scene_module->modifyPathVelocity(path);
+      }
+    }
 
-      for (const auto & marker : scene_module->createDebugMarkerArray().markers) {
-        debug_marker_array.markers.push_back(marker);
+    // The velocity factor must be called after modifyPathVelocity.
+    for (const auto & scene_module : scene_modules_) {
+      if (is_debug_marker_required) {
+        for (const auto & marker : scene_module->createDebugMarkerArray().markers) {
+          debug_marker_array.markers.push_back(marker);
+        }
       }
 
-      virtual_wall_marker_creator_.add_virtual_walls(scene_module->createVirtualWalls());
+      if (is_virtual_wall_required) {
+        virtual_wall_marker_creator_.add_virtual_walls(scene_module->createVirtualWalls());
+      }
     }
 
     planning_factor_interface_->publish();
-    pub_debug_->publish(debug_marker_array);
-    if (is_publish_debug_path_) {
+    if (is_debug_marker_required) {
+      pub_debug_->publish(debug_marker_array);
+    }
+    if (is_publish_debug_path_ && debug_path_gate_.is_open(pub_debug_path_, now)) {
       autoware_internal_planning_msgs::msg::PathWithLaneId debug_path;
       debug_path.header = path->header;
       debug_path.points = path->points;
       pub_debug_path_->publish(debug_path);
     }
-    pub_virtual_wall_->publish(virtual_wall_marker_creator_.create_markers(clock_->now()));
+    if (is_virtual_wall_required) {
+      pub_virtual_wall_->publish(virtual_wall_marker_creator_.create_markers(clock_->now()));
+    }
     processing_time_publisher_->publish<Float64Stamped>(
       std::string(getModuleName()) + "/processing_time_ms", stop_watch.toc("Total"));
   }
 
+  /**
+   * @brief evaluate the scene modules in parallel on a snapshot of the path, and insert their
+   * velocity limits into the path in the order of the module IDs. The modules which do not support
+   * planPathVelocityLimits modify the merged path afterwards, one after another.
+   */
+  void modifyPathVelocityInParallel(autoware_internal_planning_msgs::msg::PathWithLaneId * path)
+  {
+    std::vector<std::shared_ptr<T>> scene_modules(scene_modules_.begin(), scene_modules_.end());
+    std::sort(scene_modules.begin(), scene_modules.end(), [](const auto & a, const auto & b) {
+      return a->getModuleId() < b->getModuleId();
+    });
+
+    const auto path_snapshot = *path;
+    std::vector<std::future<std::optional<std::vector<PathVelocityLimit>>>> results;
+    results.reserve(scene_modules.size());
+    for (const auto & scene_module : scene_modules) {
+      scene_module->setPlannerData(planner_data_);
+      results.push_back(std::async(std::launch::async, [&scene_module, &path_snapshot]() {
+        return scene_module->planPathVelocityLimits(path_snapshot);
+      }));
+    }
+
+    std::vector<PathVelocityLimit> velocity_limits;
+    std::vector<std::shared_ptr<T>> sequential_scene_modules;
+    for (size_t i = 0; i < scene_modules.size(); ++i) {
+      const auto result = results.at(i).get();
+      if (!result) {
+        sequential_scene_modules.push_back(scene_modules.at(i));
+        continue;
+      }
+      velocity_limits.insert(velocity_limits.end(), result->begin(), result->end());
+    }
+
+    // the velocity is limited to the minimum of the limits, whatever the order of the insertion
+    planning_utils::PathEditBuffer path_edit_buffer;
+    for (const auto & velocity_limit : velocity_limits) {
+      path_edit_buffer.addVelocityLimit(velocity_limit.pose.position, velocity_limit.velocity);
+    }
+    const auto inserted_poses = path_edit_buffer.apply(*path);
+    std::vector<std::pair<geometry_msgs::msg::Pose, PathVelocityLimit>> inserted_limits;
+    for (size_t i = 0; i < velocity_limits.size(); ++i) {
+      if (inserted_poses.at(i)) {
+        inserted_limits.emplace_back(*inserted_poses.at(i), velocity_limits.at(i));
+      }
+    }
+
+    for (const auto & scene_module : sequential_scene_modules) {
+      scene_module->modifyPathVelocity(path);
+    }
+
+    for (const auto & [pose, velocity_limit] : inserted_limits) {
+      if (velocity_limit.detail.empty()) {
+        continue;
+      }
+      const auto behavior = velocity_limit.velocity > 0.0
+                              ? autoware_internal_planning_msgs::msg::PlanningFactor::SLOW_DOWN
+                              : autoware_internal_planning_msgs::msg::PlanningFactor::STOP;
+      planning_factor_interface_->add(
+        path->points, planner_data_->current_odometry->pose, pose, behavior,
+        autoware_internal_planning_msgs::msg::SafetyFactorArray{}, true /*is_driving_forward*/,
+        velocity_limit.velocity, 0.0 /*shift distance*/, velocity_limit.detail);
+    }
+  }
+
   virtual void launchNewModules(
     const autoware_internal_planning_msgs::msg::PathWithLaneId & path) = 0;
 
@@ -280,17 +409,23 @@ protected:
   std::set<int64_t> registered_module_id_set_;
 
   std::shared_ptr<const PlannerData> planner_data_;
+  // lane IDs on the forward path and their change in this cycle, std::nullopt if unknown
+  std::optional<planning_utils::LaneIdsOnPathDiff> lane_ids_on_path_diff_;
   autoware::motion_utils::VirtualWallMarkerCreator virtual_wall_marker_creator_;
 
   rclcpp::Node & node_;
   rclcpp::Clock::SharedPtr clock_;
   // Debug
   bool is_publish_debug_path_ = {false};  // note : this is very heavy debug topic option
+  bool is_parallel_evaluation_enabled_ = {false};
   rclcpp::Logger logger_;
   rclcpp::Publisher<visualization_msgs::msg::MarkerArray>::SharedPtr pub_virtual_wall_;
   rclcpp::Publisher<visualization_msgs::msg::MarkerArray>::SharedPtr pub_debug_;
   rclcpp::Publisher<autoware_internal_planning_msgs::msg::PathWithLaneId>::SharedPtr
     pub_debug_path_;
+  autoware::motion_utils::MarkerPublishGate debug_marker_gate_;
+  autoware::motion_utils::MarkerPublishGate virtual_wall_gate_;
+  autoware::motion_utils::MarkerPublishGate debug_path_gate_;
 
   std::shared_ptr<DebugPublisher> processing_time_publisher_;
 
@@ -375,6 +510,10 @@ extern template size_t SceneModuleManagerInterface<SceneModuleInterface>::findEg
 extern template void SceneModuleManagerInterface<SceneModuleInterface>::updateSceneModuleInstances(
   const std::shared_ptr<const PlannerData> & planner_data,
   const autoware_internal_planning_msgs::msg::PathWithLaneId & path);
+extern template void SceneModuleManagerInterface<SceneModuleInterface>::updateSceneModuleInstances(
+  const std::shared_ptr<const PlannerData> & planner_data,
+  const autoware_internal_planning_msgs::msg::PathWithLaneId & path,
+  const planning_utils::LaneIdsOnPathDiff & lane_ids_on_path_diff);
 extern template void SceneModuleManagerInterface<SceneModuleInterface>::modifyPathVelocity(
   autoware_internal_planning_msgs::msg::PathWithLaneId * path);
 extern template void SceneModuleManagerInterface<SceneModuleInterface>::deleteExpiredModules(
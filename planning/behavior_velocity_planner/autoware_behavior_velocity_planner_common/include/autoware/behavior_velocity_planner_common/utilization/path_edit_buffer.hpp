@@ -0,0 +1,76 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__BEHAVIOR_VELOCITY_PLANNER_COMMON__UTILIZATION__PATH_EDIT_BUFFER_HPP_
+#define AUTOWARE__BEHAVIOR_VELOCITY_PLANNER_COMMON__UTILIZATION__PATH_EDIT_BUFFER_HPP_
+
+#include <autoware_internal_planning_msgs/msg/path_with_lane_id.hpp>
+#include <geometry_msgs/msg/point.hpp>
+#include <geometry_msgs/msg/pose.hpp>
+
+#include <optional>
+#include <vector>
+
+namespace autoware::behavior_velocity_planner::planning_utils
+{
+/**
+ * @brief collect the stop and decel points of a cycle and insert them into the path at once.
+ * The result is the same as calling insertDecelPoint for each point in the order of the arc
+ * length, but the points of the path are copied only once whatever the number of the insertions.
+ */
+class PathEditBuffer
+{
+public:
+  explicit PathEditBuffer(const double overlap_threshold = 5e-2)
+  : overlap_threshold_(overlap_threshold)
+  {
+  }
+
+  /**
+   * @brief reserve the insertion of a point from which the velocity is limited
+   * @return the index of the insertion in the result of apply
+   */
+  size_t addVelocityLimit(const geometry_msgs::msg::Point & point, const double velocity);
+
+  size_t addStopPoint(const geometry_msgs::msg::Point & point)
+  {
+    return addVelocityLimit(point, 0.0);
+  }
+
+  /**
+   * @brief insert the reserved points into the path in one pass, and limit the velocity of the
+   * path from each of them to the end
+   * @return the inserted poses in the order of the reservations, std::nullopt for the points which
+   * could not be inserted
+   */
+  std::vector<std::optional<geometry_msgs::msg::Pose>> apply(
+    autoware_internal_planning_msgs::msg::PathWithLaneId & path) const;
+
+  bool empty() const { return edits_.empty(); }
+  size_t size() const { return edits_.size(); }
+  void clear() { edits_.clear(); }
+
+private:
+  struct Edit
+  {
+    geometry_msgs::msg::Point point;
+    double velocity;
+  };
+
+  double overlap_threshold_;
+  std::vector<Edit> edits_;
+};
+}  // namespace autoware::behavior_velocity_planner::planning_utils
+
+#endif  // AUTOWARE__BEHAVIOR_VELOCITY_PLANNER_COMMON__UTILIZATION__PATH_EDIT_BUFFER_HPP_
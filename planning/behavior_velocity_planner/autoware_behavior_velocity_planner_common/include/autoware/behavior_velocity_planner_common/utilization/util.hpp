@@ -62,6 +62,18 @@ struct TrafficSignalStamped
   autoware_perception_msgs::msg::TrafficLightGroup signal;  ///< Traffic light group.
 };
 
+/**
+ * @brief Represents the lane IDs on the forward path and their change from the previous cycle.
+ */
+struct LaneIdsOnPathDiff
+{
+  std::vector<int64_t> lane_ids;          ///< Lane IDs on the forward path, in the path order.
+  std::vector<int64_t> entered_lane_ids;  ///< Lane IDs newly on the forward path.
+  std::vector<int64_t> left_lane_ids;     ///< Lane IDs not on the forward path anymore.
+
+  bool isChanged() const { return !entered_lane_ids.empty() || !left_lane_ids.empty(); }
+};
+
 using Pose = geometry_msgs::msg::Pose;
 using Point2d = autoware_utils_geometry::Point2d;
 using LineString2d = autoware_utils_geometry::LineString2d;
@@ -156,29 +168,33 @@ std::vector<int64_t> getSortedLaneIdsFromPath(const PathWithLaneId & path);
 std::vector<int64_t> getSubsequentLaneIdsSetOnPath(
   const PathWithLaneId & path, int64_t base_lane_id);
 
-template <class T>
-std::unordered_map<typename std::shared_ptr<const T>, lanelet::ConstLanelet> getRegElemMapOnPath(
+/**
+ * @brief Get the lane IDs on the path from the lane nearest to the current pose
+ * @param path Path with lane IDs
+ * @param lanelet_map Lanelet map
+ * @param current_pose Current pose of the ego vehicle
+ * @return Lane IDs in the order of the path, all the lane IDs of the path if no lane is near
+ */
+std::vector<int64_t> getLaneIdsOnPath(
   const PathWithLaneId & path, const lanelet::LaneletMapPtr lanelet_map,
-  const geometry_msgs::msg::Pose & current_pose)
+  const geometry_msgs::msg::Pose & current_pose);
+
+/**
+ * @brief Calculate the change of the lane IDs on the forward path from the previous cycle
+ * @param previous_lane_ids Lane IDs on the forward path in the previous cycle
+ * @param lane_ids Lane IDs on the forward path in the current cycle
+ * @return The lane IDs with the ones which entered and left the forward path
+ */
+LaneIdsOnPathDiff calcLaneIdsOnPathDiff(
+  const std::vector<int64_t> & previous_lane_ids, const std::vector<int64_t> & lane_ids);
+
+template <class T>
+std::unordered_map<typename std::shared_ptr<const T>, lanelet::ConstLanelet> getRegElemMapOnLanes(
+  const std::vector<int64_t> & lane_ids, const lanelet::LaneletMapPtr lanelet_map)
 {
   std::unordered_map<typename std::shared_ptr<const T>, lanelet::ConstLanelet> reg_elem_map_on_path;
 
-  // Add current lane id
-  const auto nearest_lane_id = getNearestLaneId(path, lanelet_map, current_pose);
-
-  std::vector<int64_t> unique_lane_ids;
-  if (nearest_lane_id) {
-    // Add subsequent lane_ids from nearest lane_id
-    unique_lane_ids =
-      autoware::behavior_velocity_planner::planning_utils::getSubsequentLaneIdsSetOnPath(
-        path, *nearest_lane_id);
-  } else {
-    // Add all lane_ids in path
-    unique_lane_ids =
-      autoware::behavior_velocity_planner::planning_utils::getSortedLaneIdsFromPath(path);
-  }
-
-  for (const auto lane_id : unique_lane_ids) {
+  for (const auto lane_id : lane_ids) {
     const auto ll = lanelet_map->laneletLayer.get(lane_id);
 
     for (const auto & reg_elem : ll.regulatoryElementsAs<const T>()) {
@@ -189,6 +205,14 @@ std::unordered_map<typename std::shared_ptr<const T>, lanelet::ConstLanelet> get
   return reg_elem_map_on_path;
 }
 
+template <class T>
+std::unordered_map<typename std::shared_ptr<const T>, lanelet::ConstLanelet> getRegElemMapOnPath(
+  const PathWithLaneId & path, const lanelet::LaneletMapPtr lanelet_map,
+  const geometry_msgs::msg::Pose & current_pose)
+{
+  return getRegElemMapOnLanes<T>(getLaneIdsOnPath(path, lanelet_map, current_pose), lanelet_map);
+}
+
 template <class T>
 std::set<int64_t> getRegElemIdSetOnPath(
   const PathWithLaneId & path, const lanelet::LaneletMapPtr lanelet_map,
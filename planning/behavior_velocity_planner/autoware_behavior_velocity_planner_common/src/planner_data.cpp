@@ -16,6 +16,9 @@
 
 #include "autoware_vehicle_info_utils/vehicle_info_utils.hpp"
 
+#include <algorithm>
+#include <memory>
+#include <utility>
 #include <vector>
 
 namespace autoware::behavior_velocity_planner
@@ -30,33 +33,47 @@ PlannerData::PlannerData(rclcpp::Node & node)
   delay_response_time = node.declare_parameter<double>("delay_response_time");
 }
 
-bool PlannerData::isVehicleStopped(const double stop_duration) const
+void PlannerData::updateLanesOnPath(const PathWithLaneId & path)
 {
-  if (velocity_buffer.empty()) {
-    return false;
-  }
+  const auto lanelet_map = route_handler_->getLaneletMapPtr();
 
-  const auto now = clock_->now();
-  std::vector<double> vs;
-  for (const auto & velocity : velocity_buffer) {
-    vs.push_back(velocity.twist.linear.x);
-
-    const auto & s = velocity.header.stamp;
-    const auto time_diff =
-      now >= s ? now - s : rclcpp::Duration(0, 0);  // Note: negative time throws an exception.
-    if (time_diff.seconds() >= stop_duration) {
-      break;
-    }
+  auto lanes = std::make_shared<LanesOnPath>();
+  lanes->lane_ids = planning_utils::getSortedLaneIdsFromPath(path);
+  lanes->forward_lane_ids =
+    planning_utils::getLaneIdsOnPath(path, lanelet_map, current_odometry->pose);
+  lanes->sorted_forward_lane_ids = lanes->forward_lane_ids;
+  std::sort(lanes->sorted_forward_lane_ids.begin(), lanes->sorted_forward_lane_ids.end());
+  lanes->forward_lanelets.reserve(lanes->forward_lane_ids.size());
+  for (const auto lane_id : lanes->forward_lane_ids) {
+    lanes->forward_lanelets.push_back(lanelet_map->laneletLayer.get(lane_id));
   }
+  lanes_on_path = std::move(lanes);
+}
 
+void PlannerData::addVelocityToBuffer(const geometry_msgs::msg::TwistStamped & velocity)
+{
   constexpr double stop_velocity = 1e-3;
-  for (const auto & v : vs) {
-    if (v >= stop_velocity) {
-      return false;
-    }
+  velocity_stop_history.addStopState(
+    rclcpp::Time(velocity.header.stamp), velocity.twist.linear.x < stop_velocity, clock_->now());
+}
+
+bool PlannerData::isVehicleStopped(const double stop_duration) const
+{
+  // NOTE: the vehicle is stopped when all the velocities within the stop duration and the newest
+  // velocity before it are stopped, or when all the velocities of the buffer are stopped.
+  const auto stop_start_stamp = velocity_stop_history.getStopStartStamp();
+  if (!stop_start_stamp) {
+    return false;
+  }
+  if (*stop_start_stamp == *velocity_stop_history.getOldestStamp()) {
+    return true;
   }
 
-  return true;
+  const auto now = clock_->now();
+  const auto time_diff = now >= *stop_start_stamp
+                           ? now - *stop_start_stamp
+                           : rclcpp::Duration(0, 0);  // Note: negative time throws an exception.
+  return time_diff.seconds() >= stop_duration;
 }
 
 std::optional<TrafficSignalStamped> PlannerData::getTrafficSignal(
@@ -116,6 +116,10 @@ template size_t SceneModuleManagerInterface<SceneModuleInterface>::findEgoSegmen
 template void SceneModuleManagerInterface<SceneModuleInterface>::updateSceneModuleInstances(
   const std::shared_ptr<const PlannerData> & planner_data,
   const autoware_internal_planning_msgs::msg::PathWithLaneId & path);
+template void SceneModuleManagerInterface<SceneModuleInterface>::updateSceneModuleInstances(
+  const std::shared_ptr<const PlannerData> & planner_data,
+  const autoware_internal_planning_msgs::msg::PathWithLaneId & path,
+  const planning_utils::LaneIdsOnPathDiff & lane_ids_on_path_diff);
 template void SceneModuleManagerInterface<SceneModuleInterface>::modifyPathVelocity(
   autoware_internal_planning_msgs::msg::PathWithLaneId * path);
 template void SceneModuleManagerInterface<SceneModuleInterface>::deleteExpiredModules(
@@ -0,0 +1,161 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/behavior_velocity_planner_common/utilization/path_edit_buffer.hpp"
+
+#include "autoware/behavior_velocity_planner_common/utilization/util.hpp"
+#include "autoware/motion_utils/trajectory/trajectory.hpp"
+
+#include <autoware_utils_geometry/geometry.hpp>
+
+#include <algorithm>
+#include <exception>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace autoware::behavior_velocity_planner::planning_utils
+{
+namespace
+{
+struct Placement
+{
+  size_t edit_idx;
+  size_t seg_idx;
+  double offset;
+};
+
+geometry_msgs::msg::Quaternion calcDirection(
+  const geometry_msgs::msg::Point & from, const geometry_msgs::msg::Point & to)
+{
+  const auto pitch = autoware_utils_geometry::calc_elevation_angle(from, to);
+  const auto yaw = autoware_utils_geometry::calc_azimuth_angle(from, to);
+  return autoware_utils_geometry::create_quaternion_from_rpy(0.0, pitch, yaw);
+}
+}  // namespace
+
+size_t PathEditBuffer::addVelocityLimit(
+  const geometry_msgs::msg::Point & point, const double velocity)
+{
+  edits_.push_back({point, velocity});
+  return edits_.size() - 1;
+}
+
+std::vector<std::optional<geometry_msgs::msg::Pose>> PathEditBuffer::apply(
+  autoware_internal_planning_msgs::msg::PathWithLaneId & path) const
+{
+  std::vector<std::optional<geometry_msgs::msg::Pose>> inserted_poses(edits_.size());
+  if (edits_.empty() || path.points.size() < 2) {
+    return inserted_poses;
+  }
+
+  // NOTE: the one pass insertion assumes the forward path, the others are left to insertDecelPoint
+  const auto is_driving_forward = autoware::motion_utils::isDrivingForward(path.points);
+  if (!is_driving_forward || !is_driving_forward.value()) {
+    for (size_t i = 0; i < edits_.size(); ++i) {
+      inserted_poses.at(i) = insertDecelPoint(
+        edits_.at(i).point, path, static_cast<float>(edits_.at(i).velocity));
+    }
+    return inserted_poses;
+  }
+
+  const auto & points = path.points;
+  std::vector<Placement> placements;
+  placements.reserve(edits_.size());
+  for (size_t i = 0; i < edits_.size(); ++i) {
+    const auto & p_target = edits_.at(i).point;
+    const size_t seg_idx = autoware::motion_utils::findNearestSegmentIndex(points, p_target);
+    try {
+      autoware::motion_utils::validateNonSharpAngle(
+        autoware_utils_geometry::get_point(points.at(seg_idx)), p_target,
+        autoware_utils_geometry::get_point(points.at(seg_idx + 1)));
+    } catch (const std::exception &) {
+      continue;
+    }
+    placements.push_back(
+      {i, seg_idx,
+       autoware::motion_utils::calcLongitudinalOffsetToSegment(points, seg_idx, p_target)});
+  }
+  std::stable_sort(placements.begin(), placements.end(), [](const auto & a, const auto & b) {
+    return a.seg_idx != b.seg_idx ? a.seg_idx < b.seg_idx : a.offset < b.offset;
+  });
+
+  std::vector<autoware_internal_planning_msgs::msg::PathPointWithLaneId> output;
+  output.reserve(points.size() + placements.size());
+  std::vector<size_t> output_indices(edits_.size(), std::numeric_limits<size_t>::max());
+  std::vector<size_t> overlaps_with_next_point;
+  auto placement_itr = placements.begin();
+  for (size_t i = 0; i < points.size(); ++i) {
+    output.push_back(points.at(i));
+    for (const auto edit_idx : overlaps_with_next_point) {
+      output_indices.at(edit_idx) = output.size() - 1;
+    }
+    overlaps_with_next_point.clear();
+    if (i + 1 == points.size()) {
+      break;
+    }
+
+    const auto p_back = autoware_utils_geometry::get_point(points.at(i + 1));
+    for (; placement_itr != placements.end() && placement_itr->seg_idx == i; ++placement_itr) {
+      const auto & p_target = edits_.at(placement_itr->edit_idx).point;
+      const auto & p_last = output.back().point.pose.position;
+      if (autoware_utils_geometry::calc_distance2d(p_target, p_last) < overlap_threshold_) {
+        output_indices.at(placement_itr->edit_idx) = output.size() - 1;
+        continue;
+      }
+      if (autoware_utils_geometry::calc_distance2d(p_target, p_back) < overlap_threshold_) {
+        overlaps_with_next_point.push_back(placement_itr->edit_idx);
+        continue;
+      }
+
+      // same as insertTargetPoint, the last point is directed to the inserted one
+      output.back().point.pose.orientation = calcDirection(p_last, p_target);
+      auto p_insert = points.at(i);
+      geometry_msgs::msg::Pose target_pose;
+      target_pose.position = p_target;
+      target_pose.orientation = calcDirection(p_target, p_back);
+      autoware_utils_geometry::set_pose(target_pose, p_insert);
+      output.push_back(p_insert);
+      output_indices.at(placement_itr->edit_idx) = output.size() - 1;
+    }
+  }
+
+  // limit the velocity from each inserted point to the end with the running minimum
+  std::vector<std::pair<size_t, double>> velocity_limits;
+  for (size_t i = 0; i < edits_.size(); ++i) {
+    if (output_indices.at(i) < output.size()) {
+      velocity_limits.emplace_back(output_indices.at(i), edits_.at(i).velocity);
+    }
+  }
+  std::sort(velocity_limits.begin(), velocity_limits.end());
+  auto velocity_limit = std::numeric_limits<float>::max();
+  auto velocity_limit_itr = velocity_limits.begin();
+  for (size_t i = 0; i < output.size(); ++i) {
+    for (; velocity_limit_itr != velocity_limits.end() && velocity_limit_itr->first <= i;
+         ++velocity_limit_itr) {
+      velocity_limit = std::min(velocity_limit, static_cast<float>(velocity_limit_itr->second));
+    }
+    auto & velocity = output.at(i).point.longitudinal_velocity_mps;
+    velocity = std::min(velocity, velocity_limit);
+  }
+
+  for (size_t i = 0; i < edits_.size(); ++i) {
+    if (output_indices.at(i) < output.size()) {
+      inserted_poses.at(i) = autoware_utils_geometry::get_pose(output.at(output_indices.at(i)));
+    }
+  }
+  path.points = std::move(output);
+  return inserted_poses;
+}
+}  // namespace autoware::behavior_velocity_planner::planning_utils
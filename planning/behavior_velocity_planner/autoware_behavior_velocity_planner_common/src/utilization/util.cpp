@@ -34,6 +34,7 @@
 #include <algorithm>
 #include <cmath>
 #include <iostream>
+#include <iterator>
 #include <limits>
 #include <memory>
 #include <set>
@@ -641,6 +642,7 @@ std::optional<int64_t> getNearestLaneId(
 {
   lanelet::ConstLanelets lanes;
   const auto lane_ids = getSortedLaneIdsFromPath(path);
+  lanes.reserve(lane_ids.size());
   for (const auto & lane_id : lane_ids) {
     lanes.push_back(lanelet_map->laneletLayer.get(lane_id));
   }
@@ -652,23 +654,44 @@ std::optional<int64_t> getNearestLaneId(
   return std::nullopt;
 }
 
-std::vector<lanelet::ConstLanelet> getLaneletsOnPath(
+std::vector<int64_t> getLaneIdsOnPath(
   const PathWithLaneId & path, const lanelet::LaneletMapPtr lanelet_map,
   const geometry_msgs::msg::Pose & current_pose)
 {
   const auto nearest_lane_id = getNearestLaneId(path, lanelet_map, current_pose);
 
-  std::vector<int64_t> unique_lane_ids;
   if (nearest_lane_id) {
     // Add subsequent lane_ids from nearest lane_id
-    unique_lane_ids =
-      autoware::behavior_velocity_planner::planning_utils::getSubsequentLaneIdsSetOnPath(
-        path, *nearest_lane_id);
-  } else {
-    // Add all lane_ids in path
-    unique_lane_ids =
-      autoware::behavior_velocity_planner::planning_utils::getSortedLaneIdsFromPath(path);
+    return getSubsequentLaneIdsSetOnPath(path, *nearest_lane_id);
   }
+  // Add all lane_ids in path
+  return getSortedLaneIdsFromPath(path);
+}
+
+LaneIdsOnPathDiff calcLaneIdsOnPathDiff(
+  const std::vector<int64_t> & previous_lane_ids, const std::vector<int64_t> & lane_ids)
+{
+  LaneIdsOnPathDiff diff;
+  diff.lane_ids = lane_ids;
+
+  auto sorted_previous_lane_ids = previous_lane_ids;
+  auto sorted_lane_ids = lane_ids;
+  std::sort(sorted_previous_lane_ids.begin(), sorted_previous_lane_ids.end());
+  std::sort(sorted_lane_ids.begin(), sorted_lane_ids.end());
+  std::set_difference(
+    sorted_lane_ids.begin(), sorted_lane_ids.end(), sorted_previous_lane_ids.begin(),
+    sorted_previous_lane_ids.end(), std::back_inserter(diff.entered_lane_ids));
+  std::set_difference(
+    sorted_previous_lane_ids.begin(), sorted_previous_lane_ids.end(), sorted_lane_ids.begin(),
+    sorted_lane_ids.end(), std::back_inserter(diff.left_lane_ids));
+  return diff;
+}
+
+std::vector<lanelet::ConstLanelet> getLaneletsOnPath(
+  const PathWithLaneId & path, const lanelet::LaneletMapPtr lanelet_map,
+  const geometry_msgs::msg::Pose & current_pose)
+{
+  const auto unique_lane_ids = getLaneIdsOnPath(path, lanelet_map, current_pose);
 
   std::vector<lanelet::ConstLanelet> lanelets;
   lanelets.reserve(unique_lane_ids.size());
@@ -683,24 +706,31 @@ std::set<int64_t> getLaneIdSetOnPath(
   const PathWithLaneId & path, const lanelet::LaneletMapPtr lanelet_map,
   const geometry_msgs::msg::Pose & current_pose)
 {
-  std::set<int64_t> lane_id_set;
+  std::vector<int64_t> lane_ids;
   for (const auto & lane : getLaneletsOnPath(path, lanelet_map, current_pose)) {
-    lane_id_set.insert(lane.id());
+    lane_ids.push_back(lane.id());
   }
 
-  return lane_id_set;
+  // sorting the flat vector first lets the set be built in linear time
+  std::sort(lane_ids.begin(), lane_ids.end());
+  return std::set<int64_t>(lane_ids.begin(), lane_ids.end());
 }
 
 std::vector<int64_t> getSortedLaneIdsFromPath(const PathWithLaneId & path)
 {
+  // the IDs are in the order of appearance, and consecutive points mostly have the same ones
   std::vector<int64_t> sorted_lane_ids;
   for (const auto & path_points : path.points) {
-    for (const auto lane_id : path_points.lane_ids)
+    for (const auto lane_id : path_points.lane_ids) {
+      if (!sorted_lane_ids.empty() && sorted_lane_ids.back() == lane_id) {
+        continue;
+      }
       if (
         std::find(sorted_lane_ids.begin(), sorted_lane_ids.end(), lane_id) ==
         sorted_lane_ids.end()) {
         sorted_lane_ids.emplace_back(lane_id);
       }
+    }
   }
   return sorted_lane_ids;
 }
@@ -820,6 +850,7 @@ lanelet::ConstLanelets getConstLaneletsFromIds(
   const lanelet::LaneletMapConstPtr & map, const std::set<lanelet::Id> & ids)
 {
   lanelet::ConstLanelets ret{};
+  ret.reserve(ids.size());
   for (const auto & id : ids) {
     const auto ll = map->laneletLayer.get(id);
     ret.push_back(ll);
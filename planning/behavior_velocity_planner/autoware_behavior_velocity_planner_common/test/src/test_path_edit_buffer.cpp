@@ -0,0 +1,103 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/behavior_velocity_planner_common/utilization/path_edit_buffer.hpp"
+#include "autoware/behavior_velocity_planner_common/utilization/util.hpp"
+#include "utils.hpp"
+
+#include <autoware_internal_planning_msgs/msg/path_with_lane_id.hpp>
+#include <geometry_msgs/msg/point.hpp>
+
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <vector>
+
+using autoware::behavior_velocity_planner::planning_utils::insertDecelPoint;
+using autoware::behavior_velocity_planner::planning_utils::PathEditBuffer;
+
+namespace
+{
+geometry_msgs::msg::Point createPoint(const double x, const double y)
+{
+  geometry_msgs::msg::Point point;
+  point.x = x;
+  point.y = y;
+  return point;
+}
+}  // namespace
+
+TEST(PathEditBufferTest, sameAsInsertDecelPoint)
+{
+  auto path = test::generatePath(0.0, 0.0, 10.0, 0.0, 10);
+  for (auto & point : path.points) {
+    point.point.longitudinal_velocity_mps = 10.0;
+  }
+
+  // the points in the same segment, overlapping with the path point and the stop point, in the
+  // order of the arc length
+  const std::vector<std::pair<geometry_msgs::msg::Point, double>> velocity_limits = {
+    {createPoint(2.5, 0.0), 5.0},
+    {createPoint(2.6, 0.1), 3.0},
+    {createPoint(40.0 / 9.0 + 0.01, 0.0), 4.0},
+    {createPoint(5.0, 0.0), 0.0}};
+
+  auto expected_path = path;
+  std::vector<std::optional<geometry_msgs::msg::Pose>> expected_poses;
+  for (const auto & [point, velocity] : velocity_limits) {
+    expected_poses.push_back(insertDecelPoint(point, expected_path, static_cast<float>(velocity)));
+  }
+
+  // the order of the additions does not matter
+  PathEditBuffer buffer;
+  for (auto itr = velocity_limits.rbegin(); itr != velocity_limits.rend(); ++itr) {
+    buffer.addVelocityLimit(itr->first, itr->second);
+  }
+  const auto inserted_poses = buffer.apply(path);
+
+  ASSERT_EQ(inserted_poses.size(), velocity_limits.size());
+  for (size_t i = 0; i < velocity_limits.size(); ++i) {
+    const auto & inserted_pose = inserted_poses.at(velocity_limits.size() - 1 - i);
+    ASSERT_TRUE(expected_poses.at(i).has_value());
+    ASSERT_TRUE(inserted_pose.has_value());
+    EXPECT_DOUBLE_EQ(inserted_pose->position.x, expected_poses.at(i)->position.x);
+    EXPECT_DOUBLE_EQ(inserted_pose->position.y, expected_poses.at(i)->position.y);
+  }
+
+  ASSERT_EQ(path.points.size(), expected_path.points.size());
+  for (size_t i = 0; i < path.points.size(); ++i) {
+    const auto & point = path.points.at(i).point;
+    const auto & expected_point = expected_path.points.at(i).point;
+    EXPECT_DOUBLE_EQ(point.pose.position.x, expected_point.pose.position.x);
+    EXPECT_DOUBLE_EQ(point.pose.position.y, expected_point.pose.position.y);
+    EXPECT_NEAR(point.pose.orientation.z, expected_point.pose.orientation.z, 1e-6);
+    EXPECT_FLOAT_EQ(point.longitudinal_velocity_mps, expected_point.longitudinal_velocity_mps);
+  }
+}
+
+TEST(PathEditBufferTest, emptyBuffer)
+{
+  auto path = test::generatePath(0.0, 0.0, 10.0, 0.0, 10);
+  const auto original_path = path;
+
+  PathEditBuffer buffer;
+  EXPECT_TRUE(buffer.empty());
+  EXPECT_TRUE(buffer.apply(path).empty());
+  EXPECT_EQ(path.points.size(), original_path.points.size());
+
+  buffer.addStopPoint(createPoint(5.0, 0.0));
+  EXPECT_EQ(buffer.size(), 1U);
+  buffer.clear();
+  EXPECT_TRUE(buffer.empty());
+}
@@ -24,6 +24,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 using namespace autoware::behavior_velocity_planner;                  // NOLINT
 using namespace autoware::behavior_velocity_planner::planning_utils;  // NOLINT
 using autoware_planning_msgs::msg::PathPoint;
@@ -436,3 +438,30 @@ TEST(PlanningUtilsTest, getConstLaneletsFromIds)
 
   EXPECT_EQ(lanelets.size(), 3);
 }
+
+TEST(PlanningUtilsTest, getSortedLaneIdsFromPath)
+{
+  autoware_internal_planning_msgs::msg::PathWithLaneId path;
+  for (const auto & lane_ids : std::vector<std::vector<int64_t>>{
+         {10}, {10}, {10, 20}, {20}, {30}, {20, 30}, {10}, {40}}) {
+    autoware_internal_planning_msgs::msg::PathPointWithLaneId point;
+    point.lane_ids = lane_ids;
+    path.points.push_back(point);
+  }
+
+  // the IDs are unique, in the order of their first appearance on the path
+  EXPECT_EQ(getSortedLaneIdsFromPath(path), (std::vector<int64_t>{10, 20, 30, 40}));
+}
+
+TEST(PlanningUtilsTest, calcLaneIdsOnPathDiff)
+{
+  const auto diff = calcLaneIdsOnPathDiff({10, 20, 30}, {30, 20, 40, 50});
+  EXPECT_EQ(diff.lane_ids, (std::vector<int64_t>{30, 20, 40, 50}));
+  EXPECT_EQ(diff.entered_lane_ids, (std::vector<int64_t>{40, 50}));
+  EXPECT_EQ(diff.left_lane_ids, (std::vector<int64_t>{10}));
+  EXPECT_TRUE(diff.isChanged());
+
+  // the order of the lane IDs does not matter
+  EXPECT_FALSE(calcLaneIdsOnPathDiff({10, 20}, {20, 10}).isChanged());
+  EXPECT_EQ(calcLaneIdsOnPathDiff({}, {10}).entered_lane_ids, (std::vector<int64_t>{10}));
+}
@@ -45,9 +45,19 @@ std::vector<StopLineWithLaneId> StopLineModuleManager::getStopLinesWithLaneIdOnP
 {
   std::vector<StopLineWithLaneId> stop_lines_with_lane_id;
 
+  // the lane IDs on the forward path are given by the planner manager if available
+  std::vector<int64_t> lane_ids;
+  if (lane_ids_on_path_diff_) {
+    lane_ids = lane_ids_on_path_diff_->lane_ids;
+  } else if (planner_data_->lanes_on_path) {
+    lane_ids = planner_data_->lanes_on_path->forward_lane_ids;
+  } else {
+    lane_ids =
+      planning_utils::getLaneIdsOnPath(path, lanelet_map, planner_data_->current_odometry->pose);
+  }
+
   for (const auto & [traffic_sign_reg_elem, lanelet] :
-       planning_utils::getRegElemMapOnPath<TrafficSign>(
-         path, lanelet_map, planner_data_->current_odometry->pose)) {
+       planning_utils::getRegElemMapOnLanes<TrafficSign>(lane_ids, lanelet_map)) {
     if (traffic_sign_reg_elem->type() != "stop_sign") {
       continue;
     }
@@ -76,6 +86,11 @@ std::set<lanelet::Id> StopLineModuleManager::getStopLineIdSetOnPath(
 void StopLineModuleManager::launchNewModules(
   const autoware_internal_planning_msgs::msg::PathWithLaneId & path)
 {
+  // the stop lines on the path do not change while the lanes on the forward path do not
+  if (lane_ids_on_path_diff_ && !lane_ids_on_path_diff_->isChanged()) {
+    return;
+  }
+
   for (const auto & [stop_line, linked_lane_id] :
        getStopLinesWithLaneIdOnPath(path, planner_data_->route_handler_->getLaneletMapPtr())) {
     const auto module_id = stop_line.id();
@@ -97,6 +112,10 @@ std::function<bool(const std::shared_ptr<SceneModuleInterface> &)>
 StopLineModuleManager::getModuleExpiredFunction(
   const autoware_internal_planning_msgs::msg::PathWithLaneId & path)
 {
+  if (lane_ids_on_path_diff_ && !lane_ids_on_path_diff_->isChanged()) {
+    return [](const std::shared_ptr<SceneModuleInterface> &) { return false; };
+  }
+
   const auto stop_line_id_set =
     getStopLineIdSetOnPath(path, planner_data_->route_handler_->getLaneletMapPtr());
 
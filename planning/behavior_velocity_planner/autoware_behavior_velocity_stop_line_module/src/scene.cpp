@@ -14,6 +14,7 @@
 
 #include "scene.hpp"
 
+#include "autoware/behavior_velocity_planner_common/utilization/path_edit_buffer.hpp"
 #include "autoware/behavior_velocity_planner_common/utilization/util.hpp"
 #include "autoware/trajectory/utils/closest.hpp"
 #include "autoware/trajectory/utils/crossed.hpp"
@@ -26,24 +27,25 @@
 #include <lanelet2_core/Forward.h>
 #include <lanelet2_core/primitives/Lanelet.h>
 
+#include <algorithm>
 #include <cstdarg>
 #include <memory>
 #include <optional>
-#include <set>
 #include <utility>
+#include <vector>
 
 namespace autoware::behavior_velocity_planner
 {
 
-bool hasIntersection(const std::set<lanelet::Id> & a, const std::set<lanelet::Id> & b)
+namespace
 {
-  for (const auto & id : a) {
-    if (b.find(id) != b.end()) {
-      return true;
-    }
-  }
-  return false;
+bool hasIntersection(const std::vector<int64_t> & lane_ids, const lanelet::Ids & sorted_ids)
+{
+  return std::any_of(lane_ids.begin(), lane_ids.end(), [&](const int64_t id) {
+    return std::binary_search(sorted_ids.begin(), sorted_ids.end(), id);
+  });
 }
+}  // namespace
 
 StopLineModule::StopLineModule(
   const int64_t module_id,                                                //
@@ -74,38 +76,74 @@ bool StopLineModule::modifyPathVelocity(PathWithLaneId * path)
     return true;
   }
 
-  auto [ego_s, stop_point] =
-    getEgoAndStopPoint(*trajectory, *path, planner_data_->current_odometry->pose, state_);
+  const auto [ego_s, stop_point] = planStopPoint(*trajectory, *path);
 
   if (!stop_point) {
-    if (state_ == State::APPROACH) {
-      logWarnThrottle(
-        5000, "No stop point found | ego_s: %.2f | trajectory_length: %.2f", ego_s,
-        trajectory->length());
-    }
     return true;
   }
 
-  trajectory->longitudinal_velocity_mps().range(*stop_point, trajectory->length()).set(0.0);
+  // NOTE: the stop point is inserted into the path in place rather than restoring all the points
+  // from the trajectory
+  planning_utils::PathEditBuffer path_edit_buffer;
+  path_edit_buffer.addStopPoint(trajectory->compute(*stop_point).point.pose.position);
+  const auto stop_pose = path_edit_buffer.apply(*path).front();
 
-  path->points = trajectory->restore();
+  if (!stop_pose) {
+    return true;
+  }
 
-  // TODO(soblin): PlanningFactorInterface use trajectory class
+  // the inserted stop point does not change the arc length coordinates of the trajectory
   planning_factor_interface_->add(
-    path->points, planner_data_->current_odometry->pose,
-    trajectory->compute(*stop_point).point.pose,
-    autoware_internal_planning_msgs::msg::PlanningFactor::STOP,
+    *trajectory, ego_s, *stop_point, autoware_internal_planning_msgs::msg::PlanningFactor::STOP,
     autoware_internal_planning_msgs::msg::SafetyFactorArray{}, true /*is_driving_forward*/, 0.0,
     0.0 /*shift distance*/, "stopline");
 
+  return true;
+}
+
+std::optional<std::vector<PathVelocityLimit>> StopLineModule::planPathVelocityLimits(
+  const PathWithLaneId & path)
+{
+  const auto trajectory = Trajectory::Builder{}.build(path.points);
+
+  if (!trajectory) {
+    logWarnThrottle(5000, "Failed to build trajectory from path points");
+    return std::vector<PathVelocityLimit>{};
+  }
+
+  const auto stop_point = planStopPoint(*trajectory, path).second;
+
+  if (!stop_point) {
+    return std::vector<PathVelocityLimit>{};
+  }
+
+  return std::vector<PathVelocityLimit>{
+    {trajectory->compute(*stop_point).point.pose, 0.0, "stopline"}};
+}
+
+std::pair<double, std::optional<double>> StopLineModule::planStopPoint(
+  const Trajectory & trajectory, const PathWithLaneId & path)
+{
+  auto [ego_s, stop_point] =
+    getEgoAndStopPoint(trajectory, path, planner_data_->current_odometry->pose, state_);
+
+  if (!stop_point) {
+    if (state_ == State::APPROACH) {
+      logWarnThrottle(
+        5000, "No stop point found | ego_s: %.2f | trajectory_length: %.2f", ego_s,
+        trajectory.length());
+    }
+    return {ego_s, std::nullopt};
+  }
+
   updateStateAndStoppedTime(
     &state_, &stopped_time_, clock_->now(), *stop_point - ego_s, planner_data_->isVehicleStopped());
 
-  geometry_msgs::msg::Pose stop_pose = trajectory->compute(*stop_point).point.pose;
+  geometry_msgs::msg::Pose stop_pose = trajectory.compute(*stop_point).point.pose;
 
   updateDebugData(&debug_data_, stop_pose, state_);
 
-  return true;
+  return {ego_s, stop_point};
 }
 
 std::pair<double, std::optional<double>> StopLineModule::getEgoAndStopPoint(
@@ -118,26 +156,15 @@ std::pair<double, std::optional<double>> StopLineModule::getEgoAndStopPoint(
   switch (state) {
     case State::APPROACH: {
       const double base_link2front = planner_data_->vehicle_info_.max_longitudinal_offset_m;
-      const LineString2d stop_line = planning_utils::extendSegmentToBounds(
-        lanelet::utils::to2D(stop_line_).basicLineString(), path.left_bound, path.right_bound);
-
-      lanelet::Ids connected_lanelet_ids;
-
-      if (planner_data_->route_handler_) {
-        connected_lanelet_ids = planning_utils::collectConnectedLaneIds(
-          linked_lanelet_id_, planner_data_->route_handler_);
-      } else {
-        connected_lanelet_ids = {linked_lanelet_id_};
-      }
+      const auto & stop_line = getExtendedStopLine(path);
+      const auto & connected_lanelet_ids = getConnectedLaneIds();
 
       // Calculate intersection with stop line
       const auto trajectory_stop_line_intersection =
         autoware::experimental::trajectory::crossed_with_constraint(
           trajectory, stop_line,
           [&](const autoware_internal_planning_msgs::msg::PathPointWithLaneId & point) {
-            return hasIntersection(
-              {connected_lanelet_ids.begin(), connected_lanelet_ids.end()},
-              {point.lane_ids.begin(), point.lane_ids.end()});
+            return hasIntersection(point.lane_ids, connected_lanelet_ids);
           });
 
       // If no collision found, do nothing
@@ -169,6 +196,34 @@ std::pair<double, std::optional<double>> StopLineModule::getEgoAndStopPoint(
   return {ego_s, stop_point_s};
 }
 
+const LineString2d & StopLineModule::getExtendedStopLine(const PathWithLaneId & path) const
+{
+  if (
+    !extended_stop_line_ || path.left_bound != extended_stop_line_left_bound_ ||
+    path.right_bound != extended_stop_line_right_bound_) {
+    extended_stop_line_ = planning_utils::extendSegmentToBounds(
+      lanelet::utils::to2D(stop_line_).basicLineString(), path.left_bound, path.right_bound);
+    extended_stop_line_left_bound_ = path.left_bound;
+    extended_stop_line_right_bound_ = path.right_bound;
+  }
+  return *extended_stop_line_;
+}
+
+const lanelet::Ids & StopLineModule::getConnectedLaneIds() const
+{
+  const auto & route_handler = planner_data_->route_handler_;
+  if (!connected_lane_ids_ || connected_lane_ids_route_handler_.lock() != route_handler) {
+    auto lane_ids = route_handler
+                      ? planning_utils::collectConnectedLaneIds(linked_lanelet_id_, route_handler)
+                      : lanelet::Ids{linked_lanelet_id_};
+    std::sort(lane_ids.begin(), lane_ids.end());
+    lane_ids.erase(std::unique(lane_ids.begin(), lane_ids.end()), lane_ids.end());
+    connected_lane_ids_ = std::move(lane_ids);
+    connected_lane_ids_route_handler_ = route_handler;
+  }
+  return *connected_lane_ids_;
+}
+
 void StopLineModule::updateStateAndStoppedTime(
   State * state, std::optional<rclcpp::Time> * stopped_time, const rclcpp::Time & now,
   const double & distance_to_stop_point, const bool & is_vehicle_stopped) const
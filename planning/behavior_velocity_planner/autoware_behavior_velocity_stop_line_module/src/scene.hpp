@@ -83,6 +83,9 @@ public:
 
   bool modifyPathVelocity(PathWithLaneId * path) override;
 
+  std::optional<std::vector<PathVelocityLimit>> planPathVelocityLimits(
+    const PathWithLaneId & path) override;
+
   /**
    * @brief Calculate ego position and stop point.
    * @param trajectory Current trajectory.
@@ -119,12 +122,43 @@ public:
   std::vector<int64_t> getLineIds() const override { return {stop_line_.id()}; }
 
 private:
+  /**
+   * @brief Plan the stop point on the trajectory and update the state and the debug data.
+   * @param trajectory Trajectory of the path.
+   * @param path Current path.
+   * @return Ego position and stop point on the trajectory, if any.
+   */
+  std::pair<double, std::optional<double>> planStopPoint(
+    const Trajectory & trajectory, const PathWithLaneId & path);
+
+  /**
+   * @brief Get the stop line extended to the bounds of the path, which is recomputed only when the
+   * bounds change.
+   * @param path Current path.
+   * @return Extended stop line.
+   */
+  const LineString2d & getExtendedStopLine(const PathWithLaneId & path) const;
+
+  /**
+   * @brief Get the sorted IDs of the linked lanelet and of its previous and following lanelets,
+   * which are collected again only when the route handler changes.
+   * @return Sorted lanelet IDs.
+   */
+  const lanelet::Ids & getConnectedLaneIds() const;
+
   const lanelet::ConstLineString3d stop_line_;  ///< Stop line geometry.
   const lanelet::Id linked_lanelet_id_;         ///< ID of the linked lanelet.
   const PlannerParam planner_param_;            ///< Parameters for the planner.
   State state_;                                 ///< Current state of the module.
   std::optional<rclcpp::Time> stopped_time_;    ///< Time when the vehicle stopped.
   DebugData debug_data_;                        ///< Debug information.
+
+  // caches of getExtendedStopLine() and getConnectedLaneIds()
+  mutable std::optional<LineString2d> extended_stop_line_;
+  mutable std::vector<geometry_msgs::msg::Point> extended_stop_line_left_bound_;
+  mutable std::vector<geometry_msgs::msg::Point> extended_stop_line_right_bound_;
+  mutable std::optional<lanelet::Ids> connected_lane_ids_;
+  mutable std::weak_ptr<route_handler::RouteHandler> connected_lane_ids_route_handler_;
 };
 }  // namespace autoware::behavior_velocity_planner
 
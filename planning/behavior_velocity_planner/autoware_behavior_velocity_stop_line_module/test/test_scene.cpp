@@ -25,6 +25,7 @@
 #include <memory>
 #include <optional>
 #include <tuple>
+#include <vector>
 
 using autoware::behavior_velocity_planner::StopLineModule;
 
@@ -166,3 +167,68 @@ TEST_F(StopLineModuleTest, TestUpdateStateAndStoppedTime)
   EXPECT_EQ(state, StopLineModule::State::START);
   EXPECT_FALSE(stopped_time.has_value());
 }
+
+TEST_F(StopLineModuleTest, TestPlanPathVelocityLimits)
+{
+  auto odometry = std::make_shared<geometry_msgs::msg::PoseStamped>();
+  odometry->pose.position = make_geom_point(2.0, 0.0);
+  planner_data_->current_odometry = odometry;
+
+  const auto velocity_limits = module_->planPathVelocityLimits(path_);
+
+  ASSERT_TRUE(velocity_limits.has_value());
+  ASSERT_EQ(velocity_limits->size(), 1U);
+  EXPECT_NEAR(velocity_limits->front().pose.position.x, 7.0 - 0.5 - 1.0, 1e-6);
+  EXPECT_DOUBLE_EQ(velocity_limits->front().velocity, 0.0);
+  EXPECT_EQ(velocity_limits->front().detail, "stopline");
+}
+
+TEST_F(StopLineModuleTest, TestGetEgoAndStopPointWithChangedBounds)
+{
+  geometry_msgs::msg::Pose ego_pose;
+  ego_pose.position.x = 5.0;
+
+  // the stop line is extended to the bounds of the first path
+  EXPECT_TRUE(
+    module_->getEgoAndStopPoint(trajectory_, path_, ego_pose, StopLineModule::State::APPROACH)
+      .second.has_value());
+
+  // the path moves out of the original stop line, which is extended again to the wider bounds
+  auto path = path_;
+  for (auto & point : path.points) {
+    point.point.pose.position.y = 2.0;
+  }
+  path.left_bound = {make_geom_point(0.0, 3.0), make_geom_point(10.0, 3.0)};
+  path.right_bound = {make_geom_point(0.0, -3.0), make_geom_point(10.0, -3.0)};
+  const auto trajectory = *StopLineModule::Trajectory::Builder{}.build(path.points);
+  ego_pose.position.y = 2.0;
+
+  const auto [ego_s, stop_point_s] =
+    module_->getEgoAndStopPoint(trajectory, path, ego_pose, StopLineModule::State::APPROACH);
+  ASSERT_TRUE(stop_point_s.has_value());
+  EXPECT_DOUBLE_EQ(stop_point_s.value(), 7.0 - 0.5 - 1.0);
+}
+
+TEST_F(StopLineModuleTest, TestGetEgoAndStopPointWithOtherLaneIds)
+{
+  geometry_msgs::msg::Pose ego_pose;
+  ego_pose.position.x = 5.0;
+
+  // the crossing is ignored on the points which are not on the linked lanelet
+  auto path = path_;
+  for (auto & point : path.points) {
+    point.lane_ids = {100};
+  }
+  auto trajectory = *StopLineModule::Trajectory::Builder{}.build(path.points);
+  EXPECT_FALSE(
+    module_->getEgoAndStopPoint(trajectory, path, ego_pose, StopLineModule::State::APPROACH)
+      .second.has_value());
+
+  for (auto & point : path.points) {
+    point.lane_ids = {100, 0};
+  }
+  trajectory = *StopLineModule::Trajectory::Builder{}.build(path.points);
+  EXPECT_TRUE(
+    module_->getEgoAndStopPoint(trajectory, path, ego_pose, StopLineModule::State::APPROACH)
+      .second.has_value());
+}
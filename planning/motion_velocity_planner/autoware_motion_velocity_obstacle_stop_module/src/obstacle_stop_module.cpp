@@ -57,6 +57,36 @@ double calc_minimum_distance_to_stop(
   return -std::pow(initial_vel, 2) / 2.0 / min_acc;
 }
 
+// maximum distance between the corresponding vertices of the polygons, infinite when the vertices
+// do not correspond
+double calc_max_vertex_displacement(const Polygon2d & prev_poly, const Polygon2d & poly)
+{
+  const auto & prev_ring = prev_poly.outer();
+  const auto & ring = poly.outer();
+  if (prev_ring.size() != ring.size() || !prev_poly.inners().empty() || !poly.inners().empty()) {
+    return std::numeric_limits<double>::infinity();
+  }
+  double max_displacement = 0.0;
+  for (size_t i = 0; i < ring.size(); ++i) {
+    max_displacement = std::max(max_displacement, boost::geometry::distance(prev_ring[i], ring[i]));
+  }
+  return max_displacement;
+}
+
+double calc_max_vertex_displacement(
+  const std::vector<Polygon2d> & prev_polys, const std::vector<Polygon2d> & polys)
+{
+  if (prev_polys.size() != polys.size()) {
+    return std::numeric_limits<double>::infinity();
+  }
+  double max_displacement = 0.0;
+  for (size_t i = 0; i < polys.size(); ++i) {
+    max_displacement =
+      std::max(max_displacement, calc_max_vertex_displacement(prev_polys[i], polys[i]));
+  }
+  return max_displacement;
+}
+
 double calc_estimation_time(
   const PredictedObject & predicted_object, const ObstacleFilteringParam & obstacle_filtering_param)
 {
@@ -126,17 +156,14 @@ std::vector<PredictedPath> resample_highest_confidence_predicted_paths(
     }
   }
 
-  // Resample each selected path
-  std::vector<PredictedPath> resampled_paths;
-  for (const auto & path : selected_paths) {
-    if (path.path.size() < 2) {
-      continue;
-    }
-    resampled_paths.push_back(
-      autoware::object_recognition_utils::resamplePredictedPath(path, time_interval, time_horizon));
-  }
-
-  return resampled_paths;
+  // Resample the selected paths at once
+  selected_paths.erase(
+    std::remove_if(
+      selected_paths.begin(), selected_paths.end(),
+      [](const PredictedPath & path) { return path.path.size() < 2; }),
+    selected_paths.end());
+  return autoware::object_recognition_utils::resamplePredictedPaths(
+    selected_paths, time_interval, time_horizon);
 }
 
 double calc_dist_to_bumper(const bool is_driving_forward, const VehicleInfo & vehicle_info)
@@ -274,8 +301,7 @@ VelocityPlanningResult ObstacleStopModule::plan(
   stop_planning_debug_info_.set(
     StopPlanningDebugInfo::TYPE::EGO_ACCELERATION,
     planner_data->current_acceleration.accel.accel.linear.x);
-  trajectory_polygon_for_inside_map_.clear();
-  decimated_traj_polys_ = std::nullopt;
+  decimated_traj_polys_ = nullptr;
 
   // 2. pre-process
   const auto decimated_traj_points = utils::decimate_trajectory_points_from_ego(
@@ -286,7 +312,7 @@ VelocityPlanningResult ObstacleStopModule::plan(
 
   // 3. filter obstacles of predicted objects
   auto stop_obstacles_for_predicted_object = filter_stop_obstacle_for_predicted_object(
-    planner_data->current_odometry, planner_data->ego_nearest_dist_threshold,
+    planner_data, planner_data->current_odometry, planner_data->ego_nearest_dist_threshold,
     planner_data->ego_nearest_yaw_threshold,
     rclcpp::Time(planner_data->predicted_objects_header.stamp), raw_trajectory_points,
     decimated_traj_points, planner_data->objects, planner_data->vehicle_info_, dist_to_bumper,
@@ -294,7 +320,7 @@ VelocityPlanningResult ObstacleStopModule::plan(
 
   // 4. filter obstacles of point cloud
   auto stop_obstacles_for_point_cloud = filter_stop_obstacle_for_point_cloud(
-    planner_data->current_odometry, raw_trajectory_points, decimated_traj_points,
+    planner_data, planner_data->current_odometry, raw_trajectory_points, decimated_traj_points,
     planner_data->no_ground_pointcloud, planner_data->vehicle_info_, dist_to_bumper,
     planner_data->trajectory_polygon_collision_check,
     planner_data->find_index(raw_trajectory_points, planner_data->current_odometry.pose.pose));
@@ -308,8 +334,8 @@ VelocityPlanningResult ObstacleStopModule::plan(
   const auto stop_point =
     plan_stop(planner_data, raw_trajectory_points, stop_obstacles, dist_to_bumper);
 
-  // 7. publish messages for debugging
-  publish_debug_info();
+  // 7. publish messages for debugging, without the markers when the processing is reduced
+  publish_debug_info(!planner_data->is_processing_reduced);
 
   // 8. generate VelocityPlanningResult
   VelocityPlanningResult result;
@@ -327,7 +353,7 @@ std::vector<geometry_msgs::msg::Point> ObstacleStopModule::convert_point_cloud_t
 {
   autoware_utils_debug::ScopedTimeTrack st(__func__, *time_keeper_);
 
-  if (pointcloud.pointcloud.empty()) {
+  if (pointcloud.empty()) {
     return {};
   }
 
@@ -343,6 +369,7 @@ std::vector<geometry_msgs::msg::Point> ObstacleStopModule::convert_point_cloud_t
     extended_traj_points_from_ego, vehicle_info);  // extend trajectory points here
   const std::vector<pcl::PointIndices> clusters =
     pointcloud.get_cluster_indices(extended_traj_points_from_ego, vehicle_info);
+  const polygon_utils::ConvexPolygonsDistance decimated_traj_polys_distance(decimated_traj_polys);
 
   // 2. convert clusters to obstacles
   for (const auto & cluster_indices : clusters) {
@@ -370,8 +397,8 @@ std::vector<geometry_msgs::msg::Point> ObstacleStopModule::convert_point_cloud_t
       }
 
       // 2. precise filtering
-      const double precise_min_lat_dist_to_traj_poly =
-        utils::get_dist_to_traj_poly(obstacle_point, decimated_traj_polys);
+      const double precise_min_lat_dist_to_traj_poly = decimated_traj_polys_distance.distance(
+        autoware_utils_geometry::Point2d(obstacle_point.x, obstacle_point.y));
 
       if (precise_min_lat_dist_to_traj_poly >= obstacle_filtering_param_.max_lat_margin) {
         continue;
@@ -431,6 +458,7 @@ StopObstacle ObstacleStopModule::create_stop_obstacle_for_point_cloud(
 }
 
 std::vector<StopObstacle> ObstacleStopModule::filter_stop_obstacle_for_predicted_object(
+  const std::shared_ptr<const PlannerData> planner_data,
   const Odometry & odometry, const double ego_nearest_dist_threshold,
   const double ego_nearest_yaw_threshold, const rclcpp::Time & predicted_objects_stamp,
   const std::vector<TrajectoryPoint> & traj_points,
@@ -443,6 +471,18 @@ std::vector<StopObstacle> ObstacleStopModule::filter_stop_obstacle_for_predicted
 
   const auto & current_pose = odometry.pose.pose;
 
+  // the distances and velocities of the rough filtering of all the objects at once
+  PlannerData::calculate_objects_relations_to_trajectory(
+    objects, traj_points, current_pose.position);
+
+  // Moving the vertices of two polygons by at most d changes their distance by at most d, so the
+  // distance of the previous cycle minus the displacements of the object and trajectory polygons
+  // is a lower bound of the current distance. The obstacles whose lower bound is already too large
+  // are ignored without computing the polygon distance.
+  std::unordered_map<std::string, DistToTrajPolyHistory> dist_to_traj_polys;
+  std::optional<double> traj_polys_displacement;
+  const std::vector<Polygon2d> * current_decimated_traj_polys = nullptr;
+
   std::vector<StopObstacle> stop_obstacles;
   for (const auto & object : objects) {
     autoware_utils_debug::ScopedTimeTrack st_for_each_object("for_each_object", *time_keeper_);
@@ -476,29 +516,73 @@ std::vector<StopObstacle> ObstacleStopModule::filter_stop_obstacle_for_predicted
     }
 
     // 2. precise filtering
-    const auto & decimated_traj_polys = [&]() {
+    const auto & decimated_traj_polys = [&]() -> const std::vector<Polygon2d> & {
       autoware_utils_debug::ScopedTimeTrack st_get_decimated_traj_polys(
         "get_decimated_traj_polys", *time_keeper_);
       return get_decimated_traj_polys(
-        traj_points, current_pose, vehicle_info, ego_nearest_dist_threshold,
+        planner_data, traj_points, current_pose, ego_nearest_dist_threshold,
         ego_nearest_yaw_threshold, trajectory_polygon_collision_check);
     }();
+    if (!traj_polys_displacement) {
+      traj_polys_displacement =
+        calc_max_vertex_displacement(prev_decimated_traj_polys_, decimated_traj_polys);
+      current_decimated_traj_polys = &decimated_traj_polys;
+    }
+
+    // 2.1. skip the obstacle still too far from the trajectory since the previous cycle
+    const auto obj_uuid_str =
+      autoware_utils_uuid::to_hex_string(object->predicted_object.object_id);
+    const auto obj_poly = autoware_utils_geometry::to_polygon2d(
+      object->predicted_object.kinematics.initial_pose_with_covariance.pose,
+      object->predicted_object.shape);
+    if (const auto prev_dist = prev_dist_to_traj_polys_.find(obj_uuid_str);
+        prev_dist != prev_dist_to_traj_polys_.end()) {
+      const double min_dist_from_obj_to_traj_poly =
+        prev_dist->second.min_dist_to_traj_poly - *traj_polys_displacement -
+        calc_max_vertex_displacement(prev_dist->second.obj_poly, obj_poly);
+      // the lateral distance filtering of pick_stop_obstacle_from_predicted_object on the bound
+      if (
+        std::max(get_max_lat_margin(obj_label), 1e-3) <=
+        min_dist_from_obj_to_traj_poly -
+          std::max(
+            object->get_lat_vel_relative_to_traj(traj_points) *
+              calc_estimation_time(object->predicted_object, obstacle_filtering_param_),
+            0.0)) {
+        dist_to_traj_polys.emplace(
+          obj_uuid_str, DistToTrajPolyHistory{obj_poly, min_dist_from_obj_to_traj_poly});
+        RCLCPP_DEBUG(
+          logger_,
+          "[Stop] Ignore obstacle (%s) since the lateral distance to the trajectory is too large.",
+          obj_uuid_str.substr(0, 4).c_str());
+        continue;
+      }
+    }
+
     const double dist_from_obj_to_traj_poly = [&]() {
       autoware_utils_debug::ScopedTimeTrack st_get_dist_to_traj_poly(
         "get_dist_to_traj_poly", *time_keeper_);
       return object->get_dist_to_traj_poly(decimated_traj_polys);
     }();
+    dist_to_traj_polys.emplace(
+      obj_uuid_str, DistToTrajPolyHistory{obj_poly, dist_from_obj_to_traj_poly});
 
-    // 2.1. pick target object
+    // 2.2. pick target object
     const auto current_step_stop_obstacle = pick_stop_obstacle_from_predicted_object(
-      odometry, traj_points, decimated_traj_points, object, predicted_objects_stamp,
-      dist_from_obj_to_traj_poly, vehicle_info, dist_to_bumper, trajectory_polygon_collision_check);
+      planner_data, odometry, traj_points, decimated_traj_points, object, predicted_objects_stamp,
+      dist_from_obj_to_traj_poly, dist_to_bumper, trajectory_polygon_collision_check);
     if (current_step_stop_obstacle) {
       stop_obstacles.push_back(*current_step_stop_obstacle);
       continue;
     }
   }
 
+  prev_dist_to_traj_polys_ = std::move(dist_to_traj_polys);
+  if (current_decimated_traj_polys) {
+    prev_decimated_traj_polys_ = *current_decimated_traj_polys;
+  } else {
+    prev_decimated_traj_polys_.clear();
+  }
+
   // Check target obstacles' consistency
   check_consistency(predicted_objects_stamp, objects, stop_obstacles);
 
@@ -511,6 +595,7 @@ std::vector<StopObstacle> ObstacleStopModule::filter_stop_obstacle_for_predicted
 }
 
 std::vector<StopObstacle> ObstacleStopModule::filter_stop_obstacle_for_point_cloud(
+  const std::shared_ptr<const PlannerData> planner_data,
   const Odometry & odometry, const std::vector<TrajectoryPoint> & traj_points,
   const std::vector<TrajectoryPoint> & decimated_traj_points,
   const PlannerData::Pointcloud & point_cloud, const VehicleInfo & vehicle_info,
@@ -526,8 +611,8 @@ std::vector<StopObstacle> ObstacleStopModule::filter_stop_obstacle_for_point_clo
   const auto & tp = trajectory_polygon_collision_check;
 
   // calculated decimated trajectory points and trajectory polygon
-  const auto decimated_traj_polys = polygon_utils::create_one_step_polygons(
-    decimated_traj_points, vehicle_info, odometry.pose.pose, 0.0,
+  const auto & decimated_traj_polys = get_trajectory_polygon(
+    planner_data, decimated_traj_points, odometry.pose.pose, 0.0,
     tp.enable_to_consider_current_pose, tp.time_to_convergence, tp.decimate_trajectory_step_length);
 
   const std::vector<geometry_msgs::msg::Point> stop_points = convert_point_cloud_to_stop_points(
@@ -535,7 +620,7 @@ std::vector<StopObstacle> ObstacleStopModule::filter_stop_obstacle_for_point_clo
 
   debug_data_ptr_->decimated_traj_polys = decimated_traj_polys;
 
-  const auto & stop_obstacle_stamp = rclcpp::Time(point_cloud.pointcloud.header.stamp);
+  const auto & stop_obstacle_stamp = rclcpp::Time(point_cloud.header().stamp);
 
   // determine ego's behavior from stop
   std::vector<StopObstacle> stop_obstacles;
@@ -597,11 +682,11 @@ std::vector<StopObstacle> ObstacleStopModule::filter_stop_obstacle_for_point_clo
 }
 
 std::optional<StopObstacle> ObstacleStopModule::pick_stop_obstacle_from_predicted_object(
+  const std::shared_ptr<const PlannerData> planner_data,
   const Odometry & odometry, const std::vector<TrajectoryPoint> & traj_points,
   const std::vector<TrajectoryPoint> & decimated_traj_points,
   const std::shared_ptr<PlannerData::Object> object, const rclcpp::Time & predicted_objects_stamp,
-  const double dist_from_obj_poly_to_traj_poly, const VehicleInfo & vehicle_info,
-  const double dist_to_bumper,
+  const double dist_from_obj_poly_to_traj_poly, const double dist_to_bumper,
   const TrajectoryPolygonCollisionCheck & trajectory_polygon_collision_check) const
 {
   autoware_utils_debug::ScopedTimeTrack st(__func__, *time_keeper_);
@@ -640,8 +725,8 @@ std::optional<StopObstacle> ObstacleStopModule::pick_stop_obstacle_from_predicte
   // 4.1 generate polygon to be checked
   // calculate collision points with trajectory with lateral stop margin
   const auto & p = trajectory_polygon_collision_check;
-  const auto decimated_traj_polys_with_lat_margin = get_trajectory_polygon(
-    decimated_traj_points, vehicle_info, odometry.pose.pose, max_lat_margin,
+  const auto & decimated_traj_polys_with_lat_margin = get_trajectory_polygon(
+    planner_data, decimated_traj_points, odometry.pose.pose, max_lat_margin,
     p.enable_to_consider_current_pose, p.time_to_convergence, p.decimate_trajectory_step_length);
   debug_data_ptr_->decimated_traj_polys = decimated_traj_polys_with_lat_margin;
 
@@ -1110,11 +1195,8 @@ void ObstacleStopModule::set_stop_planning_debug_info(
   stop_planning_debug_info_.set(StopPlanningDebugInfo::TYPE::STOP_TARGET_ACCELERATION, 0.0);
 }
 
-void ObstacleStopModule::publish_debug_info()
+MarkerArray ObstacleStopModule::create_debug_marker_array() const
 {
-  autoware_utils_debug::ScopedTimeTrack st(__func__, *time_keeper_);
-
-  // 1. debug marker
   MarkerArray debug_marker;
 
   // 1.1. obstacles
@@ -1161,10 +1243,24 @@ void ObstacleStopModule::publish_debug_info()
   }
   debug_marker.markers.push_back(decimated_traj_polys_marker);
 
-  debug_publisher_->publish(debug_marker);
+  return debug_marker;
+}
+
+void ObstacleStopModule::publish_debug_info(const bool publish_debug_marker)
+{
+  autoware_utils_debug::ScopedTimeTrack st(__func__, *time_keeper_);
+
+  const auto now = clock_->now();
+
+  // 1. debug marker
+  if (publish_debug_marker && debug_marker_gate.is_open(debug_publisher_, now)) {
+    debug_publisher_->publish(create_debug_marker_array());
+  }
 
   // 2. virtual wall
-  virtual_wall_publisher_->publish(debug_data_ptr_->stop_wall_marker);
+  if (virtual_wall_gate.is_open(virtual_wall_publisher_, now)) {
+    virtual_wall_publisher_->publish(debug_data_ptr_->stop_wall_marker);
+  }
 
   // 3. stop planning info
   const auto stop_debug_msg = stop_planning_debug_info_.convert_to_message(clock_->now());
@@ -1209,19 +1305,18 @@ double ObstacleStopModule::calc_collision_time_margin(
   return 0.0;  // Ego and obstacle will collide.
 }
 
-std::vector<Polygon2d> ObstacleStopModule::get_trajectory_polygon(
-  const std::vector<TrajectoryPoint> & decimated_traj_points, const VehicleInfo & vehicle_info,
+const std::vector<Polygon2d> & ObstacleStopModule::get_trajectory_polygon(
+  const std::shared_ptr<const PlannerData> planner_data,
+  const std::vector<TrajectoryPoint> & decimated_traj_points,
   const geometry_msgs::msg::Pose & current_ego_pose, const double lat_margin,
   const bool enable_to_consider_current_pose, const double time_to_convergence,
   const double decimate_trajectory_step_length) const
 {
-  if (trajectory_polygon_for_inside_map_.count(lat_margin) == 0) {
-    const auto traj_polys = polygon_utils::create_one_step_polygons(
-      decimated_traj_points, vehicle_info, current_ego_pose, lat_margin,
-      enable_to_consider_current_pose, time_to_convergence, decimate_trajectory_step_length);
-    trajectory_polygon_for_inside_map_.emplace(lat_margin, traj_polys);
-  }
-  return trajectory_polygon_for_inside_map_.at(lat_margin);
+  return planner_data
+    ->get_trajectory_polygons(
+      decimated_traj_points, current_ego_pose, lat_margin, enable_to_consider_current_pose,
+      time_to_convergence, decimate_trajectory_step_length)
+    .polygons();
 }
 
 void ObstacleStopModule::check_consistency(
@@ -1376,9 +1471,9 @@ double ObstacleStopModule::get_max_lat_margin(const uint8_t obj_label) const
   return obstacle_filtering_param_.max_lat_margin;
 }
 
-std::vector<Polygon2d> ObstacleStopModule::get_decimated_traj_polys(
+const std::vector<Polygon2d> & ObstacleStopModule::get_decimated_traj_polys(
+  const std::shared_ptr<const PlannerData> planner_data,
   const std::vector<TrajectoryPoint> & traj_points, const geometry_msgs::msg::Pose & current_pose,
-  const autoware::vehicle_info_utils::VehicleInfo & vehicle_info,
   const double ego_nearest_dist_threshold, const double ego_nearest_yaw_threshold,
   const TrajectoryPolygonCollisionCheck & trajectory_polygon_collision_check) const
 {
@@ -1387,8 +1482,8 @@ std::vector<Polygon2d> ObstacleStopModule::get_decimated_traj_polys(
     const auto decimated_traj_points = utils::decimate_trajectory_points_from_ego(
       traj_points, current_pose, ego_nearest_dist_threshold, ego_nearest_yaw_threshold,
       p.decimate_trajectory_step_length, p.goal_extended_trajectory_length);
-    decimated_traj_polys_ = polygon_utils::create_one_step_polygons(
-      decimated_traj_points, vehicle_info, current_pose, 0.0, p.enable_to_consider_current_pose,
+    decimated_traj_polys_ = &get_trajectory_polygon(
+      planner_data, decimated_traj_points, current_pose, 0.0, p.enable_to_consider_current_pose,
       p.time_to_convergence, p.decimate_trajectory_step_length);
   }
   return *decimated_traj_polys_;
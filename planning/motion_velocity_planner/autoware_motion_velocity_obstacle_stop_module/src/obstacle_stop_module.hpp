@@ -105,14 +105,24 @@ private:
   // PointCloud-based stop obstacle history
   std::vector<StopObstacle> stop_pointcloud_obstacle_history_;
 
+  // lower bounds of the distances from the predicted objects to the trajectory polygons of the
+  // previous cycle, indexed by the object UUID
+  struct DistToTrajPolyHistory
+  {
+    Polygon2d obj_poly;
+    double min_dist_to_traj_poly;
+  };
+  std::unordered_map<std::string, DistToTrajPolyHistory> prev_dist_to_traj_polys_;
+  std::vector<Polygon2d> prev_decimated_traj_polys_;
+
   // previous trajectory and distance to stop
   // NOTE: Previous trajectory is memorized to deal with nearest index search for overlapping or
   // crossing lanes.
   std::optional<std::pair<std::vector<TrajectoryPoint>, double>> prev_stop_distance_info_{
     std::nullopt};
   autoware_utils_system::StopWatch<std::chrono::milliseconds> stop_watch_{};
-  mutable std::unordered_map<double, std::vector<Polygon2d>> trajectory_polygon_for_inside_map_{};
-  mutable std::optional<std::vector<Polygon2d>> decimated_traj_polys_{std::nullopt};
+  // polygons shared through the planner data during the planning cycle
+  mutable const std::vector<Polygon2d> * decimated_traj_polys_{nullptr};
   mutable std::shared_ptr<autoware_utils_debug::TimeKeeper> time_keeper_{};
 
   std::vector<geometry_msgs::msg::Point> convert_point_cloud_to_stop_points(
@@ -120,13 +130,15 @@ private:
     const std::vector<Polygon2d> & decimated_traj_polys, const VehicleInfo & vehicle_info,
     const TrajectoryPolygonCollisionCheck & trajectory_polygon_collision_check, size_t ego_idx);
 
-  std::vector<Polygon2d> get_trajectory_polygon(
-    const std::vector<TrajectoryPoint> & decimated_traj_points, const VehicleInfo & vehicle_info,
+  const std::vector<Polygon2d> & get_trajectory_polygon(
+    const std::shared_ptr<const PlannerData> planner_data,
+    const std::vector<TrajectoryPoint> & decimated_traj_points,
     const geometry_msgs::msg::Pose & current_ego_pose, const double lat_margin,
     const bool enable_to_consider_current_pose, const double time_to_convergence,
     const double decimate_trajectory_step_length) const;
 
   std::vector<StopObstacle> filter_stop_obstacle_for_predicted_object(
+    const std::shared_ptr<const PlannerData> planner_data,
     const Odometry & odometry, const double ego_nearest_dist_threshold,
     const double ego_nearest_yaw_threshold, const rclcpp::Time & predicted_objects_stamp,
     const std::vector<TrajectoryPoint> & traj_points,
@@ -136,6 +148,7 @@ private:
     const TrajectoryPolygonCollisionCheck & trajectory_polygon_collision_check);
 
   std::vector<StopObstacle> filter_stop_obstacle_for_point_cloud(
+    const std::shared_ptr<const PlannerData> planner_data,
     const Odometry & odometry, const std::vector<TrajectoryPoint> & traj_points,
     const std::vector<TrajectoryPoint> & decimated_traj_points,
     const PlannerData::Pointcloud & point_cloud, const VehicleInfo & vehicle_info,
@@ -167,14 +180,15 @@ private:
   void set_stop_planning_debug_info(
     const std::optional<StopObstacle> & determined_stop_obstacle,
     const std::optional<double> & determined_desired_stop_margin) const;
-  void publish_debug_info();
+  MarkerArray create_debug_marker_array() const;
+  void publish_debug_info(const bool publish_debug_marker);
 
   std::optional<StopObstacle> pick_stop_obstacle_from_predicted_object(
+    const std::shared_ptr<const PlannerData> planner_data,
     const Odometry & odometry, const std::vector<TrajectoryPoint> & traj_points,
     const std::vector<TrajectoryPoint> & decimated_traj_points,
     const std::shared_ptr<PlannerData::Object> object, const rclcpp::Time & predicted_objects_stamp,
-    const double dist_from_obj_poly_to_traj_poly, const VehicleInfo & vehicle_info,
-    const double dist_to_bumper,
+    const double dist_from_obj_poly_to_traj_poly, const double dist_to_bumper,
     const TrajectoryPolygonCollisionCheck & trajectory_polygon_collision_check) const;
   bool is_obstacle_velocity_requiring_fixed_stop(
     const std::shared_ptr<PlannerData::Object> object,
@@ -204,9 +218,9 @@ private:
   std::vector<StopObstacle> get_closest_stop_obstacles(
     const std::vector<StopObstacle> & stop_obstacles);
   double get_max_lat_margin(const uint8_t obj_label) const;
-  std::vector<Polygon2d> get_decimated_traj_polys(
+  const std::vector<Polygon2d> & get_decimated_traj_polys(
+    const std::shared_ptr<const PlannerData> planner_data,
     const std::vector<TrajectoryPoint> & traj_points, const geometry_msgs::msg::Pose & current_pose,
-    const autoware::vehicle_info_utils::VehicleInfo & vehicle_info,
     const double ego_nearest_dist_threshold, const double ego_nearest_yaw_threshold,
     const TrajectoryPolygonCollisionCheck & trajectory_polygon_collision_check) const;
 
@@ -19,7 +19,6 @@
 #include <autoware/velocity_smoother/smoother/analytical_jerk_constrained_smoother/analytical_jerk_constrained_smoother.hpp>
 #include <autoware/velocity_smoother/trajectory_utils.hpp>
 #include <autoware_utils_geometry/geometry.hpp>
-#include <autoware_utils_pcl/transforms.hpp>
 #include <autoware_utils_rclcpp/parameter.hpp>
 #include <autoware_utils_system/stop_watch.hpp>
 #include <tf2/time.hpp>
@@ -31,6 +30,7 @@
 #include <pcl/common/transforms.h>
 #include <pcl_conversions/pcl_conversions.h>
 
+#include <algorithm>
 #include <chrono>
 #include <functional>
 #include <map>
@@ -95,6 +95,20 @@ MotionVelocityPlannerNode::MotionVelocityPlannerNode(const rclcpp::NodeOptions &
 
   // Parameters
   smooth_velocity_before_planning_ = declare_parameter<bool>("smooth_velocity_before_planning");
+  planner_manager_.set_parallel_plugin_execution(
+    declare_parameter<bool>("enable_parallel_plugin_execution"));
+  time_budget_param_.enable = declare_parameter<bool>("time_budget.enable");
+  time_budget_param_.cycle_time_budget =
+    declare_parameter<double>("time_budget.cycle_time_budget");
+  time_budget_param_.degradation_ratio =
+    declare_parameter<double>("time_budget.degradation_ratio");
+  time_budget_param_.degradation_hold_time =
+    declare_parameter<double>("time_budget.degradation_hold_time");
+  time_budget_param_.max_objects = declare_parameter<int64_t>("time_budget.max_objects");
+  time_budget_param_.pointcloud_voxel_grid_scale =
+    declare_parameter<double>("time_budget.pointcloud_voxel_grid_scale");
+  time_budget_diagnostics_ =
+    std::make_unique<autoware_utils_diagnostics::DiagnosticsInterface>(this, "time_budget");
 
   // set velocity smoother param
   set_velocity_smoother_params();
@@ -152,11 +166,14 @@ bool MotionVelocityPlannerNode::update_planner_data(
   };
 
   const auto required_subscriptions = planner_manager_.getRequiredSubscriptions();
+  planner_data_->clear_trajectory_polygons();
 
   autoware_utils_system::StopWatch<std::chrono::milliseconds> sw;
   const auto ego_state_ptr = sub_vehicle_odometry_.take_data();
-  if (check_with_log(ego_state_ptr, "Waiting for current odometry"))
+  if (check_with_log(ego_state_ptr, "Waiting for current odometry")) {
     planner_data_->current_odometry = *ego_state_ptr;
+    trajectory_latency_publisher_.add_input(ego_state_ptr->header.stamp);
+  }
   processing_times["update_planner_data.odom"] = sw.toc(true);
 
   const auto ego_accel_ptr = sub_acceleration_.take_data();
@@ -167,26 +184,38 @@ bool MotionVelocityPlannerNode::update_planner_data(
   const auto predicted_objects_ptr = sub_predicted_objects_.take_data();
   if (check_with_log(
         predicted_objects_ptr, "Waiting for predicted objects",
-        required_subscriptions.predicted_objects))
+        required_subscriptions.predicted_objects)) {
     planner_data_->process_predicted_objects(*predicted_objects_ptr);
+    trajectory_latency_publisher_.add_input(predicted_objects_ptr->header.stamp);
+  }
+  if (planner_data_->is_processing_reduced) {
+    keep_nearest_objects(static_cast<size_t>(std::max<int64_t>(time_budget_param_.max_objects, 0)));
+  }
   processing_times["update_planner_data.pred_obj"] = sw.toc(true);
 
   const auto no_ground_pointcloud_ptr = sub_no_ground_pointcloud_.take_data();
   if (check_with_log(
         no_ground_pointcloud_ptr, "Waiting for pointcloud",
         required_subscriptions.no_ground_pointcloud)) {
-    auto no_ground_pointcloud = process_no_ground_pointcloud(no_ground_pointcloud_ptr);
-    processing_times["update_planner_data.pcl.process_no_ground_pointcloud"] = sw.toc(true);
-    if (no_ground_pointcloud) {
-      planner_data_->no_ground_pointcloud.set_pointcloud(std::move(*no_ground_pointcloud));
+    trajectory_latency_publisher_.add_input(no_ground_pointcloud_ptr->header.stamp);
+    const auto transform_to_map = lookup_no_ground_pointcloud_transform(no_ground_pointcloud_ptr);
+    if (transform_to_map) {
+      // the points are decoded and transformed only when a module uses them
+      planner_data_->no_ground_pointcloud.set_pointcloud(
+        no_ground_pointcloud_ptr, *transform_to_map);
     }
+    planner_data_->no_ground_pointcloud.set_voxel_grid_scale(
+      planner_data_->is_processing_reduced ? time_budget_param_.pointcloud_voxel_grid_scale : 1.0);
+    processing_times["update_planner_data.pcl.process_no_ground_pointcloud"] = sw.toc(true);
   }
 
   const auto occupancy_grid_ptr = sub_occupancy_grid_.take_data();
   if (check_with_log(
         occupancy_grid_ptr, "Waiting for the occupancy grid",
-        required_subscriptions.occupancy_grid_map))
-    planner_data_->occupancy_grid = *occupancy_grid_ptr;
+        required_subscriptions.occupancy_grid_map)) {
+    planner_data_->occupancy_grid.set_occupancy_grid(occupancy_grid_ptr);
+    trajectory_latency_publisher_.add_input(occupancy_grid_ptr->header.stamp);
+  }
   processing_times["update_planner_data.occ_grid"] = sw.toc(true);
 
   // here we use bitwise operator to not short-circuit the logging messages
@@ -213,8 +242,57 @@ bool MotionVelocityPlannerNode::update_planner_data(
   return is_ready;
 }
 
-std::optional<pcl::PointCloud<pcl::PointXYZ>>
-MotionVelocityPlannerNode::process_no_ground_pointcloud(
+void MotionVelocityPlannerNode::keep_nearest_objects(const size_t max_objects)
+{
+  auto & objects = planner_data_->objects;
+  if (objects.size() <= max_objects) {
+    return;
+  }
+  const auto & ego_position = planner_data_->current_odometry.pose.pose.position;
+  const auto calc_squared_distance_to_ego = [&](const auto & object) {
+    return autoware_utils_geometry::calc_squared_distance2d(
+      ego_position, object->predicted_object.kinematics.initial_pose_with_covariance.pose.position);
+  };
+  std::stable_sort(objects.begin(), objects.end(), [&](const auto & o1, const auto & o2) {
+    return calc_squared_distance_to_ego(o1) < calc_squared_distance_to_ego(o2);
+  });
+  objects.resize(max_objects);
+}
+
+bool MotionVelocityPlannerNode::is_processing_reduced(const rclcpp::Time & now) const
+{
+  return time_budget_param_.enable && last_time_budget_exceeded_time_ &&
+         (now - *last_time_budget_exceeded_time_).seconds() <
+           time_budget_param_.degradation_hold_time;
+}
+
+void MotionVelocityPlannerNode::update_time_budget(
+  const rclcpp::Time & now, const double processing_time)
+{
+  if (!time_budget_param_.enable) {
+    return;
+  }
+  const double degradation_threshold =
+    time_budget_param_.cycle_time_budget * time_budget_param_.degradation_ratio;
+  if (processing_time > degradation_threshold) {
+    last_time_budget_exceeded_time_ = now;
+  }
+
+  time_budget_diagnostics_->clear();
+  time_budget_diagnostics_->add_key_value("processing_time_ms", processing_time);
+  time_budget_diagnostics_->add_key_value("degradation_threshold_ms", degradation_threshold);
+  time_budget_diagnostics_->add_key_value(
+    "is_processing_reduced", planner_data_->is_processing_reduced);
+  time_budget_diagnostics_->add_key_value("objects_size", planner_data_->objects.size());
+  if (planner_data_->is_processing_reduced) {
+    time_budget_diagnostics_->update_level_and_message(
+      diagnostic_msgs::msg::DiagnosticStatus::WARN,
+      "The processing is reduced to meet the time budget");
+  }
+  time_budget_diagnostics_->publish(now);
+}
+
+std::optional<Eigen::Affine3f> MotionVelocityPlannerNode::lookup_no_ground_pointcloud_transform(
   const sensor_msgs::msg::PointCloud2::ConstSharedPtr msg)
 {
   geometry_msgs::msg::TransformStamped transform;
@@ -233,13 +311,7 @@ MotionVelocityPlannerNode::process_no_ground_pointcloud(
     return std::nullopt;
   }
 
-  pcl::PointCloud<pcl::PointXYZ> pc;
-  pcl::fromROSMsg(*msg, pc);
-
-  Eigen::Affine3f affine = tf2::transformToEigen(transform.transform).cast<float>();
-  pcl::PointCloud<pcl::PointXYZ>::Ptr pc_transformed(new pcl::PointCloud<pcl::PointXYZ>);
-  if (!pc.empty()) autoware_utils_pcl::transform_pointcloud(pc, *pc_transformed, affine);
-  return *pc_transformed;
+  return tf2::transformToEigen(transform.transform).cast<float>();
 }
 
 void MotionVelocityPlannerNode::set_velocity_smoother_params()
@@ -300,7 +372,12 @@ void MotionVelocityPlannerNode::on_trajectory(
   autoware_utils_system::StopWatch<std::chrono::milliseconds> stop_watch;
   std::map<std::string, double> processing_times;
   stop_watch.tic("Total");
+  // the age of the inputs is measured from here, the trajectory keeps the input header
+  trajectory_latency_publisher_.begin();
+  trajectory_latency_publisher_.add_input(input_trajectory_msg->header.stamp);
 
+  // the previous cycles decide whether this one is reduced, before the data is updated
+  planner_data_->is_processing_reduced = is_processing_reduced(get_clock()->now());
   if (!update_planner_data(processing_times, input_trajectory_msg->points)) {
     return;
   }
@@ -317,23 +394,28 @@ void MotionVelocityPlannerNode::on_trajectory(
     processing_times["make_RouteHandler"] = stop_watch.toc(true);
   }
 
-  autoware::motion_velocity_planner::TrajectoryPoints input_trajectory_points{
-    input_trajectory_msg->points.begin(), input_trajectory_msg->points.end()};
-  auto output_trajectory_msg = generate_trajectory(input_trajectory_points, processing_times);
-  output_trajectory_msg.header = input_trajectory_msg->header;
+  input_trajectory_points_.assign(
+    input_trajectory_msg->points.begin(), input_trajectory_msg->points.end());
+  generate_trajectory(input_trajectory_points_, processing_times, output_trajectory_msg_);
+  output_trajectory_msg_.header = input_trajectory_msg->header;
   processing_times["generate_trajectory"] = stop_watch.toc(true);
 
   lk.unlock();
 
-  trajectory_pub_->publish(output_trajectory_msg);
+  // NOTE: the output message is only rebuilt by the next call of this callback
+  trajectory_pub_->publish(output_trajectory_msg_);
   published_time_publisher_.publish_if_subscribed(
-    trajectory_pub_, output_trajectory_msg.header.stamp);
+    trajectory_pub_, output_trajectory_msg_.header.stamp);
+  trajectory_latency_publisher_.publish();
   processing_times["Total"] = stop_watch.toc("Total");
   processing_diag_publisher_.publish(processing_times);
   autoware_internal_debug_msgs::msg::Float64Stamped processing_time_msg;
   processing_time_msg.stamp = get_clock()->now();
   processing_time_msg.data = processing_times["Total"];
   processing_time_publisher_->publish(processing_time_msg);
+
+  lk.lock();
+  update_time_budget(get_clock()->now(), processing_times["Total"]);
 }
 
 void MotionVelocityPlannerNode::insert_stop(
@@ -410,25 +492,28 @@ autoware::motion_velocity_planner::TrajectoryPoints MotionVelocityPlannerNode::s
   return traj_smoothed;
 }
 
-autoware_planning_msgs::msg::Trajectory MotionVelocityPlannerNode::generate_trajectory(
+void MotionVelocityPlannerNode::generate_trajectory(
   const autoware::motion_velocity_planner::TrajectoryPoints & input_trajectory_points,
-  std::map<std::string, double> & processing_times)
+  std::map<std::string, double> & processing_times,
+  autoware_planning_msgs::msg::Trajectory & output_trajectory_msg)
 {
   autoware_utils_system::StopWatch<std::chrono::milliseconds> stop_watch;
-  autoware_planning_msgs::msg::Trajectory output_trajectory_msg;
-  output_trajectory_msg.points = {input_trajectory_points.begin(), input_trajectory_points.end()};
+  output_trajectory_msg.points.assign(
+    input_trajectory_points.begin(), input_trajectory_points.end());
 
   stop_watch.tic("smooth");
-  const auto smoothed_trajectory_points = [&]() {
-    if (smooth_velocity_before_planning_) {
-      return smooth_trajectory(input_trajectory_points, planner_data_);
-    }
-    return input_trajectory_points;
-  }();
+  // the input points are used as they are without smoothing, instead of being copied
+  std::optional<TrajectoryPoints> smoothed_points;
+  if (smooth_velocity_before_planning_) {
+    smoothed_points = smooth_trajectory(input_trajectory_points, planner_data_);
+  }
+  const auto & smoothed_trajectory_points =
+    smoothed_points ? *smoothed_points : input_trajectory_points;
   processing_times["velocity_smoothing"] = stop_watch.toc("smooth");
 
   stop_watch.tic("resample");
-  TrajectoryPoints resampled_smoothed_trajectory_points;
+  auto & resampled_smoothed_trajectory_points = resampled_trajectory_points_;
+  resampled_smoothed_trajectory_points.clear();
   // skip points that are too close together to make computation easier
   if (!smoothed_trajectory_points.empty()) {
     resampled_smoothed_trajectory_points.push_back(smoothed_trajectory_points.front());
@@ -449,7 +534,8 @@ autoware_planning_msgs::msg::Trajectory MotionVelocityPlannerNode::generate_traj
   processing_times["calculate_time_from_start"] = stop_watch.toc("calculate_time_from_start");
   stop_watch.tic("plan_velocities");
   const auto planning_results = planner_manager_.plan_velocities(
-    input_trajectory_points, resampled_smoothed_trajectory_points, planner_data_);
+    input_trajectory_points, resampled_smoothed_trajectory_points, planner_data_,
+    processing_times);
   processing_times["plan_velocities"] = stop_watch.toc("plan_velocities");
 
   for (const auto & planning_result : planning_results) {
@@ -464,8 +550,6 @@ autoware_planning_msgs::msg::Trajectory MotionVelocityPlannerNode::generate_traj
       clear_velocity_limit_pub_->publish(*planning_result.velocity_limit_clear_command);
     }
   }
-
-  return output_trajectory_msg;
 }
 
 rcl_interfaces::msg::SetParametersResult MotionVelocityPlannerNode::on_set_param(
@@ -479,6 +563,20 @@ rcl_interfaces::msg::SetParametersResult MotionVelocityPlannerNode::on_set_param
   }
 
   update_param(parameters, "smooth_velocity_before_planning", smooth_velocity_before_planning_);
+  {
+    std::unique_lock<std::mutex> lk(mutex_);  // for time_budget_param_
+    update_param(parameters, "time_budget.enable", time_budget_param_.enable);
+    update_param(
+      parameters, "time_budget.cycle_time_budget", time_budget_param_.cycle_time_budget);
+    update_param(
+      parameters, "time_budget.degradation_ratio", time_budget_param_.degradation_ratio);
+    update_param(
+      parameters, "time_budget.degradation_hold_time", time_budget_param_.degradation_hold_time);
+    update_param(parameters, "time_budget.max_objects", time_budget_param_.max_objects);
+    update_param(
+      parameters, "time_budget.pointcloud_voxel_grid_scale",
+      time_budget_param_.pointcloud_voxel_grid_scale);
+  }
   update_param(parameters, "ego_nearest_dist_threshold", planner_data_->ego_nearest_dist_threshold);
   update_param(parameters, "ego_nearest_yaw_threshold", planner_data_->ego_nearest_yaw_threshold);
   update_param(
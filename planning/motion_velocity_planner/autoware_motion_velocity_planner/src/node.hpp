@@ -18,7 +18,11 @@
 #include "planner_manager.hpp"
 
 #include <autoware/motion_velocity_planner_common/planner_data.hpp>
+#include <autoware/node/latest_value_subscription.hpp>
+#include <autoware/node/output_latency_publisher.hpp>
+#include <autoware/node/realtime_configurator.hpp>
 #include <autoware_utils_debug/published_time_publisher.hpp>
+#include <autoware_utils_diagnostics/diagnostics_interface.hpp>
 #include <autoware_utils_logging/logger_level_configure.hpp>
 #include <autoware_utils_rclcpp/polling_subscriber.hpp>
 #include <rclcpp/rclcpp.hpp>
@@ -43,6 +47,7 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -68,19 +73,18 @@ private:
 
   // subscriber
   rclcpp::Subscription<autoware_planning_msgs::msg::Trajectory>::SharedPtr sub_trajectory_;
-  autoware_utils_rclcpp::InterProcessPollingSubscriber<
-    autoware_perception_msgs::msg::PredictedObjects>
+  // the large inputs are kept as received and shared with the planner data without a copy
+  autoware::node::LatestValueSubscription<autoware_perception_msgs::msg::PredictedObjects>
     sub_predicted_objects_{this, "~/input/dynamic_objects"};
-  autoware_utils_rclcpp::InterProcessPollingSubscriber<sensor_msgs::msg::PointCloud2>
-    sub_no_ground_pointcloud_{
-      this, "~/input/no_ground_pointcloud", autoware_utils_rclcpp::single_depth_sensor_qos()};
+  autoware::node::LatestValueSubscription<sensor_msgs::msg::PointCloud2> sub_no_ground_pointcloud_{
+    this, "~/input/no_ground_pointcloud", autoware_utils_rclcpp::single_depth_sensor_qos()};
   autoware_utils_rclcpp::InterProcessPollingSubscriber<nav_msgs::msg::Odometry>
     sub_vehicle_odometry_{this, "~/input/vehicle_odometry"};
   autoware_utils_rclcpp::InterProcessPollingSubscriber<
     geometry_msgs::msg::AccelWithCovarianceStamped>
     sub_acceleration_{this, "~/input/accel"};
-  autoware_utils_rclcpp::InterProcessPollingSubscriber<nav_msgs::msg::OccupancyGrid>
-    sub_occupancy_grid_{this, "~/input/occupancy_grid"};
+  autoware::node::LatestValueSubscription<nav_msgs::msg::OccupancyGrid> sub_occupancy_grid_{
+    this, "~/input/occupancy_grid"};
   autoware_utils_rclcpp::InterProcessPollingSubscriber<
     autoware_perception_msgs::msg::TrafficLightGroupArray>
     sub_traffic_signals_{this, "~/input/traffic_signals"};
@@ -88,7 +92,7 @@ private:
 
   void on_trajectory(
     const autoware_planning_msgs::msg::Trajectory::ConstSharedPtr input_trajectory_msg);
-  std::optional<pcl::PointCloud<pcl::PointXYZ>> process_no_ground_pointcloud(
+  std::optional<Eigen::Affine3f> lookup_no_ground_pointcloud_transform(
     const sensor_msgs::msg::PointCloud2::ConstSharedPtr msg);
   void on_lanelet_map(const autoware_map_msgs::msg::LaneletMapBin::ConstSharedPtr msg);
   void process_traffic_signals(
@@ -104,6 +108,8 @@ private:
   rclcpp::Publisher<autoware_internal_debug_msgs::msg::Float64Stamped>::SharedPtr
     processing_time_publisher_;
   autoware_utils_debug::PublishedTimePublisher published_time_publisher_{this};
+  autoware::node::OutputLatencyPublisher trajectory_latency_publisher_{this, "trajectory"};
+  autoware::node::RealtimeConfigurator realtime_configurator_{this};
 
   //  parameters
   rclcpp::node_interfaces::OnSetParametersCallbackHandle::SharedPtr set_param_callback_;
@@ -111,6 +117,26 @@ private:
   /// @brief set parameters of the velocity smoother
   void set_velocity_smoother_params();
 
+  // reduction of the processing when the planning cycles overrun their time budget
+  struct TimeBudgetParam
+  {
+    bool enable{};
+    double cycle_time_budget{};      // [ms]
+    double degradation_ratio{};      // [-]
+    double degradation_hold_time{};  // [s]
+    int64_t max_objects{};
+    double pointcloud_voxel_grid_scale{};
+  };
+  TimeBudgetParam time_budget_param_{};
+  std::optional<rclcpp::Time> last_time_budget_exceeded_time_{std::nullopt};
+  std::unique_ptr<autoware_utils_diagnostics::DiagnosticsInterface> time_budget_diagnostics_;
+  /// @brief whether the processing of the current cycle is reduced to meet the time budget
+  bool is_processing_reduced(const rclcpp::Time & now) const;
+  /// @brief record the processing time of a cycle and publish the diagnostic of the time budget
+  void update_time_budget(const rclcpp::Time & now, const double processing_time);
+  /// @brief keep only the predicted objects nearest to ego
+  void keep_nearest_objects(const size_t max_objects);
+
   // members
   std::shared_ptr<PlannerData> planner_data_;
   MotionVelocityPlannerManager planner_manager_;
@@ -145,9 +171,16 @@ private:
   autoware::motion_velocity_planner::TrajectoryPoints smooth_trajectory(
     const autoware::motion_velocity_planner::TrajectoryPoints & trajectory_points,
     const std::shared_ptr<autoware::motion_velocity_planner::PlannerData> & planner_data) const;
-  autoware_planning_msgs::msg::Trajectory generate_trajectory(
+  void generate_trajectory(
     const autoware::motion_velocity_planner::TrajectoryPoints & input_trajectory_points,
-    std::map<std::string, double> & processing_times);
+    std::map<std::string, double> & processing_times,
+    autoware_planning_msgs::msg::Trajectory & output_trajectory_msg);
+
+  // NOTE: the output message and the point buffers are rebuilt in place every cycle, so that their
+  // capacity is reused instead of allocating the points again
+  autoware_planning_msgs::msg::Trajectory output_trajectory_msg_;
+  autoware::motion_velocity_planner::TrajectoryPoints input_trajectory_points_;
+  autoware::motion_velocity_planner::TrajectoryPoints resampled_trajectory_points_;
 
   std::unique_ptr<autoware_utils_logging::LoggerLevelConfigure> logger_configure_;
 };
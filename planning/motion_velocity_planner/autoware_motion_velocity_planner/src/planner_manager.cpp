@@ -14,8 +14,13 @@
 
 #include "planner_manager.hpp"
 
+#include <autoware_utils_system/stop_watch.hpp>
+
 #include <boost/format.hpp>
 
+#include <chrono>
+#include <future>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -78,15 +83,39 @@ void MotionVelocityPlannerManager::update_module_parameters(
 std::vector<VelocityPlanningResult> MotionVelocityPlannerManager::plan_velocities(
   const std::vector<autoware_planning_msgs::msg::TrajectoryPoint> & raw_trajectory_points,
   const std::vector<autoware_planning_msgs::msg::TrajectoryPoint> & smoothed_trajectory_points,
-  const std::shared_ptr<const PlannerData> planner_data)
+  const std::shared_ptr<const PlannerData> planner_data,
+  std::map<std::string, double> & processing_times)
 {
-  std::vector<VelocityPlanningResult> results;
-  for (auto & plugin : loaded_plugins_) {
-    VelocityPlanningResult res =
-      plugin->plan(raw_trajectory_points, smoothed_trajectory_points, planner_data);
-    results.push_back(res);
+  std::vector<VelocityPlanningResult> results(loaded_plugins_.size());
+  std::vector<double> plugin_processing_times(loaded_plugins_.size());
+  const auto plan = [&](const size_t i) {
+    autoware_utils_system::StopWatch<std::chrono::milliseconds> stop_watch;
+    results[i] =
+      loaded_plugins_[i]->plan(raw_trajectory_points, smoothed_trajectory_points, planner_data);
+    plugin_processing_times[i] = stop_watch.toc();
+  };
+
+  if (enable_parallel_plugin_execution_ && loaded_plugins_.size() > 1) {
+    // the plugins only read the planner data, the first one runs on the calling thread
+    std::vector<std::future<void>> futures;
+    futures.reserve(loaded_plugins_.size() - 1);
+    for (size_t i = 1; i < loaded_plugins_.size(); ++i) {
+      futures.push_back(std::async(std::launch::async, plan, i));
+    }
+    plan(0);
+    for (auto & future : futures) {
+      future.get();
+    }
+  } else {
+    for (size_t i = 0; i < loaded_plugins_.size(); ++i) {
+      plan(i);
+    }
+  }
 
-    plugin->publish_planning_factor();
+  for (size_t i = 0; i < loaded_plugins_.size(); ++i) {
+    loaded_plugins_[i]->publish_planning_factor();
+    processing_times["plan_velocities." + loaded_plugins_[i]->get_module_name()] =
+      plugin_processing_times[i];
   }
   return results;
 }
@@ -30,6 +30,7 @@
 #include <lanelet2_traffic_rules/TrafficRulesFactory.h>
 #include <tf2_ros/transform_listener.h>
 
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -43,10 +44,18 @@ public:
   void load_module_plugin(rclcpp::Node & node, const std::string & name);
   void unload_module_plugin(rclcpp::Node & node, const std::string & name);
   void update_module_parameters(const std::vector<rclcpp::Parameter> & parameters);
+  /// @brief plan with each plugin, concurrently if enabled
+  /// @details the results are in the order of the loaded plugins and the planning time of each
+  /// plugin is added to processing_times
   std::vector<VelocityPlanningResult> plan_velocities(
     const std::vector<autoware_planning_msgs::msg::TrajectoryPoint> & raw_trajectory_points,
     const std::vector<autoware_planning_msgs::msg::TrajectoryPoint> & smoothed_trajectory_points,
-    const std::shared_ptr<const PlannerData> planner_data);
+    const std::shared_ptr<const PlannerData> planner_data,
+    std::map<std::string, double> & processing_times);
+  void set_parallel_plugin_execution(const bool enable)
+  {
+    enable_parallel_plugin_execution_ = enable;
+  }
 
   RequiredSubscriptionInfo getRequiredSubscriptions() const { return required_subscriptions_; }
 
@@ -54,6 +63,7 @@ private:
   pluginlib::ClassLoader<PluginModuleInterface> plugin_loader_;
   std::vector<std::shared_ptr<PluginModuleInterface>> loaded_plugins_;
   RequiredSubscriptionInfo required_subscriptions_;
+  bool enable_parallel_plugin_execution_{false};
 };
 }  // namespace autoware::motion_velocity_planner
 
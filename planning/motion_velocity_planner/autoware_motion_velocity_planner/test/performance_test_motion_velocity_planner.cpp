@@ -0,0 +1,148 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Drives the motion velocity planner at 10 Hz with the path of the sample map of
+// autoware_test_utils and reports the latency, the CPU time and the allocations of its callbacks
+// per planning cycle.
+// The stress test drives it with a trajectory of 5 km, 500 objects and a point cloud of 100000
+// points at 20 Hz, and checks that the latency stays bounded and that the inputs do not queue up.
+// NOTE: the module packages depend on this package, so no module is launched and only the update
+// of the planner data, the velocity smoothing and the publication are measured.
+
+#include "../src/node.hpp"
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <autoware/motion_utils/trajectory/conversion.hpp>
+#include <autoware/planning_test_manager/autoware_planning_performance_test_manager.hpp>
+#include <autoware_test_utils/autoware_test_utils.hpp>
+#include <autoware_test_utils/synthetic_inputs.hpp>
+
+#include <autoware_perception_msgs/msg/predicted_objects.hpp>
+#include <autoware_perception_msgs/msg/traffic_light_group_array.hpp>
+#include <autoware_planning_msgs/msg/trajectory.hpp>
+#include <geometry_msgs/msg/accel_with_covariance_stamped.hpp>
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace autoware::motion_velocity_planner
+{
+using autoware::planning_test_manager::PlanningPerformanceTestManager;
+using autoware::planning_test_manager::StressLimits;
+
+using autoware_perception_msgs::msg::PredictedObjects;
+using autoware_planning_msgs::msg::Trajectory;
+using sensor_msgs::msg::PointCloud2;
+
+std::shared_ptr<MotionVelocityPlannerNode> make_node()
+{
+  const auto autoware_test_utils_dir =
+    ament_index_cpp::get_package_share_directory("autoware_test_utils");
+  const auto velocity_smoother_dir =
+    ament_index_cpp::get_package_share_directory("autoware_velocity_smoother");
+  const auto motion_velocity_planner_dir =
+    ament_index_cpp::get_package_share_directory("autoware_motion_velocity_planner");
+  auto node_options = rclcpp::NodeOptions{};
+  node_options.parameter_overrides(
+    {rclcpp::Parameter("launch_modules", std::vector<std::string>{})});
+  autoware::test_utils::updateNodeOptions(
+    node_options,
+    {autoware_test_utils_dir + "/config/test_common.param.yaml",
+     autoware_test_utils_dir + "/config/test_nearest_search.param.yaml",
+     autoware_test_utils_dir + "/config/test_vehicle_info.param.yaml",
+     velocity_smoother_dir + "/config/default_velocity_smoother.param.yaml",
+     velocity_smoother_dir + "/config/Analytical.param.yaml",
+     motion_velocity_planner_dir + "/config/motion_velocity_planner.param.yaml"});
+  return std::make_shared<MotionVelocityPlannerNode>(node_options);
+}
+
+// the pointcloud is published at each cycle if pointcloud_rate is zero
+void publish_inputs(
+  PlanningPerformanceTestManager & test_manager,
+  const std::shared_ptr<MotionVelocityPlannerNode> & test_target_node,
+  const Trajectory & trajectory, const PredictedObjects & objects, const PointCloud2 & pointcloud,
+  const double pointcloud_rate)
+{
+  auto odometry = autoware::test_utils::makeOdometry();
+  odometry.pose.pose = trajectory.points.front().pose;
+
+  test_manager.publishInput(
+    test_target_node, "/tf", autoware::test_utils::makeTFMsg(test_target_node, "base_link", "map"));
+  test_manager.publishInput(
+    test_target_node, "motion_velocity_planner/input/vector_map",
+    autoware::test_utils::makeMapBinMsg());
+  test_manager.publishCyclicInput("motion_velocity_planner/input/vehicle_odometry", odometry);
+  test_manager.publishCyclicInput(
+    "motion_velocity_planner/input/accel", geometry_msgs::msg::AccelWithCovarianceStamped{});
+  test_manager.publishCyclicInput("motion_velocity_planner/input/dynamic_objects", objects);
+  test_manager.publishCyclicInput(
+    "motion_velocity_planner/input/no_ground_pointcloud", pointcloud, pointcloud_rate);
+  test_manager.publishCyclicInput(
+    "motion_velocity_planner/input/occupancy_grid", autoware::test_utils::makeCostMapMsg());
+  test_manager.publishCyclicInput(
+    "motion_velocity_planner/input/traffic_signals",
+    autoware_perception_msgs::msg::TrafficLightGroupArray{});
+  test_manager.publishCyclicInput("motion_velocity_planner/input/trajectory", trajectory);
+  test_manager.subscribeOutput<Trajectory>("motion_velocity_planner/output/trajectory");
+}
+
+TEST(PlanningModulePerformanceTest, MotionVelocityPlanner)
+{
+  rclcpp::init(0, nullptr);
+
+  const auto test_target_node = make_node();
+  const auto path = autoware::test_utils::loadPathWithLaneIdInYaml();
+
+  PlanningPerformanceTestManager test_manager;
+  publish_inputs(
+    test_manager, test_target_node,
+    autoware::motion_utils::convertToTrajectory(
+      autoware::motion_utils::convertToTrajectoryPoints(path), path.header),
+    PredictedObjects{}.set__header(std_msgs::msg::Header{}.set__frame_id("map")),
+    PointCloud2{}.set__header(std_msgs::msg::Header{}.set__frame_id("base_link")), 0.0);
+
+  const auto report = test_manager.run(test_target_node, 100);
+  PlanningPerformanceTestManager::printReport(report);
+  EXPECT_GT(report.output_num, 0U);
+
+  rclcpp::shutdown();
+}
+
+TEST(PlanningModulePerformanceTest, MotionVelocityPlannerStress)
+{
+  rclcpp::init(0, nullptr);
+
+  const auto test_target_node = make_node();
+  auto trajectory = autoware::test_utils::generateTrajectory<Trajectory>(5000, 1.0, 10.0);
+  trajectory.header.frame_id = "map";
+
+  PlanningPerformanceTestManager test_manager;
+  publish_inputs(
+    test_manager, test_target_node, trajectory, autoware::test_utils::make_dense_objects(500),
+    autoware::test_utils::make_pointcloud(100000), 20.0);
+
+  const auto report = test_manager.run(test_target_node, 100);
+  PlanningPerformanceTestManager::printReport(report);
+  for (const auto & violation :
+       PlanningPerformanceTestManager::checkStressLimits(report, StressLimits{})) {
+    ADD_FAILURE() << violation;
+  }
+
+  rclcpp::shutdown();
+}
+}  // namespace autoware::motion_velocity_planner
@@ -15,6 +15,8 @@
 #ifndef AUTOWARE__MOTION_VELOCITY_PLANNER_COMMON__PLANNER_DATA_HPP_
 #define AUTOWARE__MOTION_VELOCITY_PLANNER_COMMON__PLANNER_DATA_HPP_
 
+#include <autoware/euclidean_cluster_object_detector/grid_hash_cluster_extraction.hpp>
+#include <autoware/euclidean_cluster_object_detector/grid_hash_voxel_grid.hpp>
 #include <autoware/motion_utils/distance/distance.hpp>
 #include <autoware/motion_utils/trajectory/trajectory.hpp>
 #include <autoware/motion_velocity_planner_common/collision_checker.hpp>
@@ -35,6 +37,7 @@
 #include <sensor_msgs/msg/point_cloud2.hpp>
 #include <std_msgs/msg/header.hpp>
 
+#include <Eigen/Geometry>
 #include <lanelet2_core/Forward.h>
 #include <pcl/common/transforms.h>
 #include <pcl/filters/voxel_grid.h>
@@ -47,8 +50,10 @@
 #include <tf2_ros/buffer.h>
 #include <tf2_ros/transform_listener.h>
 
+#include <cstdint>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <utility>
 #include <vector>
@@ -125,7 +130,13 @@ public:
       const rclcpp::Time & specified_time, const rclcpp::Time & predicted_object_stamp) const;
 
   private:
-    void calc_vel_relative_to_traj(const std::vector<TrajectoryPoint> & traj_points) const;
+    friend struct PlannerData;
+
+    void calc_vel_relative_to_traj(const TrajectoryPoint & nearest_traj_point) const;
+    /// @brief cache the values computed for all the objects, keeping the ones already cached
+    void set_relations_to_trajectory(
+      const TrajectoryPoint & nearest_traj_point, const double dist_to_traj_lateral_value,
+      const double dist_from_ego_longitudinal_value) const;
 
     mutable std::optional<double> dist_to_traj_poly{std::nullopt};
     mutable std::optional<double> dist_to_traj_lateral{std::nullopt};
@@ -133,6 +144,9 @@ public:
     mutable std::optional<double> lon_vel_relative_to_traj{std::nullopt};
     mutable std::optional<double> lat_vel_relative_to_traj{std::nullopt};
     mutable std::optional<geometry_msgs::msg::Pose> predicted_pose;
+
+    // the plugins may run concurrently and share the cached values
+    mutable std::mutex cache_mutex_;
   };
 
   class Pointcloud
@@ -149,12 +163,35 @@ public:
     }
     void set_pointcloud(pcl::PointCloud<pcl::PointXYZ> && arg_pointcloud)
     {
-      pointcloud = arg_pointcloud;
+      pointcloud_ = std::move(arg_pointcloud);
+      pointcloud_msg_.reset();
       filtered_pointcloud_ptr.reset();
       cluster_indices.reset();
     }
 
-    pcl::PointCloud<pcl::PointXYZ> pointcloud;
+    /**
+     * @brief keep the message and its transform to the map frame without decoding it
+     * @details only the points near the trajectory are decoded and transformed when the filtered
+     * pointcloud is first requested. The message is decoded at once if its x, y and z fields are
+     * not float32.
+     */
+    void set_pointcloud(
+      const sensor_msgs::msg::PointCloud2::ConstSharedPtr & msg,
+      const Eigen::Affine3f & transform_to_map);
+
+    /// @brief scale the voxel grid leaf size of the parameters, to filter fewer points
+    void set_voxel_grid_scale(const double voxel_grid_scale)
+    {
+      if (voxel_grid_scale != voxel_grid_scale_) {
+        voxel_grid_scale_ = voxel_grid_scale;
+        filtered_pointcloud_ptr.reset();
+        cluster_indices.reset();
+      }
+    }
+
+    [[nodiscard]] bool empty() const;
+    /// @brief header of the received pointcloud
+    [[nodiscard]] const pcl::PCLHeader & header() const { return pointcloud_.header; }
 
     const pcl::PointCloud<pcl::PointXYZ>::Ptr get_filtered_pointcloud_ptr(
       const autoware::motion_velocity_planner::TrajectoryPoints & trajectory_points,
@@ -166,15 +203,27 @@ public:
   private:
     mutable std::optional<pcl::PointCloud<pcl::PointXYZ>::Ptr> filtered_pointcloud_ptr;
     mutable std::optional<std::vector<pcl::PointIndices>> cluster_indices;
+    // the plugins may run concurrently and share the cached values, held by pointer to stay movable
+    std::unique_ptr<std::mutex> cache_mutex_{std::make_unique<std::mutex>()};
 
     PointcloudObstacleFilteringParam pointcloud_obstacle_filtering_param_;
     double mask_lat_margin_{};
+    double voxel_grid_scale_{1.0};
+
+    // points in the map frame, or only the header when the message is kept undecoded
+    pcl::PointCloud<pcl::PointXYZ> pointcloud_;
+    sensor_msgs::msg::PointCloud2::ConstSharedPtr pointcloud_msg_;
+    Eigen::Affine3f transform_to_map_{Eigen::Affine3f::Identity()};
+
+    // working buffers kept across the planning cycles
+    mutable std::shared_ptr<pcl::PointCloud<pcl::PointXYZ>> near_trajectory_pointcloud_ptr_;
+    mutable std::shared_ptr<euclidean_cluster::GridHashVoxelGrid> voxel_grid_;
+    mutable std::shared_ptr<euclidean_cluster::GridHashClusterExtraction> cluster_extraction_;
 
     void search_pointcloud_near_trajectory(
       const std::vector<TrajectoryPoint> & trajectory,
       const autoware::vehicle_info_utils::VehicleInfo & vehicle_info,
-      const pcl::PointCloud<pcl::PointXYZ>::Ptr & input_points_ptr,
-      pcl::PointCloud<pcl::PointXYZ>::Ptr & output_points_ptr) const;
+      pcl::PointCloud<pcl::PointXYZ> & output_points) const;
 
     std::pair<pcl::PointCloud<pcl::PointXYZ>::Ptr, std::vector<pcl::PointIndices>>
     filter_and_cluster_point_clouds(
@@ -182,16 +231,85 @@ public:
       const autoware::vehicle_info_utils::VehicleInfo & vehicle_info) const;
   };
 
+  /// @brief received occupancy grid, with the counts of cells precomputed for the box queries
+  class OccupancyGrid
+  {
+  public:
+    /// @brief keep the message without copying it
+    void set_occupancy_grid(const nav_msgs::msg::OccupancyGrid::ConstSharedPtr & msg);
+
+    /// @brief received message, nullptr until one is received
+    [[nodiscard]] const nav_msgs::msg::OccupancyGrid::ConstSharedPtr & msg() const { return msg_; }
+
+    /**
+     * @brief number of cells of value at least min_value in the cells of indices [min_x, max_x] x
+     * [min_y, max_y], clamped to the grid
+     * @details the counts of all the cells "below" each cell are computed on the first query of a
+     * min_value for the current message, a query then takes a constant time
+     */
+    [[nodiscard]] size_t count_cells(
+      const int64_t min_x, const int64_t min_y, const int64_t max_x, const int64_t max_y,
+      const int8_t min_value) const;
+
+    /// @brief number of cells of value at least min_value in the cells covering the bounding box of
+    /// the polygon in the grid frame, which includes the cells of the polygon
+    [[nodiscard]] size_t count_cells_in_bounding_box(
+      const autoware_utils_geometry::Polygon2d & polygon, const int8_t min_value) const;
+
+  private:
+    nav_msgs::msg::OccupancyGrid::ConstSharedPtr msg_;
+    // the plugins may run concurrently and share the cached values, held by pointer to stay movable
+    std::unique_ptr<std::mutex> cache_mutex_{std::make_unique<std::mutex>()};
+    // the value at (x, y) is the count of the cells of indices below x and y, (width + 1) per row
+    mutable std::map<int8_t, std::vector<uint32_t>> integral_images_;
+
+    const std::vector<uint32_t> & get_integral_image(const int8_t min_value) const;
+  };
+
+  /// @brief footprints of a decimated trajectory, shared by the modules during a planning cycle
+  class TrajectoryPolygons
+  {
+  public:
+    explicit TrajectoryPolygons(std::vector<autoware_utils_geometry::Polygon2d> polygons)
+    : polygons_(std::move(polygons))
+    {
+    }
+
+    [[nodiscard]] const std::vector<autoware_utils_geometry::Polygon2d> & polygons() const
+    {
+      return polygons_;
+    }
+    /// @brief collision checker with the envelopes of the polygons, built at the first call
+    [[nodiscard]] const CollisionChecker & collision_checker() const;
+
+  private:
+    std::vector<autoware_utils_geometry::Polygon2d> polygons_;
+    mutable std::once_flag collision_checker_flag_;
+    mutable std::unique_ptr<CollisionChecker> collision_checker_;
+  };
+
   void process_predicted_objects(
     const autoware_perception_msgs::msg::PredictedObjects & predicted_objects);
 
+  /**
+   * @brief compute the relations of all the objects to a trajectory in one pass
+   * @details the lateral distance, the longitudinal distance from ego and the relative velocities
+   * are cached in the objects with the values their getters compute. The trajectory points are
+   * laid out as arrays once and each object only searches its nearest point, instead of each getter
+   * copying the trajectory to remove its overlapping points. Nothing is computed for a trajectory
+   * with overlapping points, the getters then compute the values.
+   */
+  static void calculate_objects_relations_to_trajectory(
+    const std::vector<std::shared_ptr<Object>> & objects,
+    const std::vector<TrajectoryPoint> & traj_points, const geometry_msgs::msg::Point & ego_pos);
+
   // msgs from callbacks that are used for data-ready
   nav_msgs::msg::Odometry current_odometry;
   geometry_msgs::msg::AccelWithCovarianceStamped current_acceleration;
   std_msgs::msg::Header predicted_objects_header;
   std::vector<std::shared_ptr<Object>> objects;
   Pointcloud no_ground_pointcloud;
-  nav_msgs::msg::OccupancyGrid occupancy_grid;
+  OccupancyGrid occupancy_grid;
   std::shared_ptr<route_handler::RouteHandler> route_handler;
 
   // nearest search
@@ -215,6 +333,9 @@ public:
   autoware::vehicle_info_utils::VehicleInfo vehicle_info_;
 
   bool is_driving_forward{true};
+  // set when the previous planning cycles ran close to their time budget, the modules then skip
+  // their optional processing like the debug markers
+  bool is_processing_reduced{false};
 
   /**
    *@fn
@@ -250,6 +371,34 @@ public:
     return autoware::motion_utils::findFirstNearestSegmentIndexWithSoftConstraints(
       traj_points, pose, ego_nearest_dist_threshold, ego_nearest_yaw_threshold);
   }
+
+  /// @brief polygons of polygon_utils::create_one_step_polygons for the ego vehicle
+  /// @details the polygons are built once per planning cycle for the same arguments and the
+  /// returned reference is valid until clear_trajectory_polygons is called
+  [[nodiscard]] const TrajectoryPolygons & get_trajectory_polygons(
+    const std::vector<TrajectoryPoint> & decimated_traj_points,
+    const geometry_msgs::msg::Pose & current_ego_pose, const double lat_margin,
+    const bool enable_to_consider_current_pose, const double time_to_convergence,
+    const double decimate_trajectory_step_length) const;
+
+  /// @brief forget the trajectory polygons of the previous planning cycle
+  void clear_trajectory_polygons() { trajectory_polygons_cache_.clear(); }
+
+private:
+  struct TrajectoryPolygonsKey
+  {
+    std::vector<TrajectoryPoint> decimated_traj_points;
+    geometry_msgs::msg::Pose current_ego_pose;
+    double lat_margin{};
+    bool enable_to_consider_current_pose{};
+    double time_to_convergence{};
+    double decimate_trajectory_step_length{};
+  };
+
+  mutable std::vector<std::pair<TrajectoryPolygonsKey, std::unique_ptr<TrajectoryPolygons>>>
+    trajectory_polygons_cache_;
+  // the plugins may run concurrently, held by pointer to stay movable
+  std::unique_ptr<std::mutex> trajectory_polygons_mutex_{std::make_unique<std::mutex>()};
 };
 struct RequiredSubscriptionInfo
 {
@@ -18,6 +18,7 @@
 #include "planner_data.hpp"
 #include "velocity_planning_result.hpp"
 
+#include <autoware/motion_utils/marker/marker_publish_gate.hpp>
 #include <autoware/planning_factor_interface/planning_factor_interface.hpp>
 #include <autoware_utils_debug/processing_time_publisher.hpp>
 #include <autoware_utils_debug/published_time_publisher.hpp>
@@ -56,6 +57,9 @@ public:
   rclcpp::Publisher<autoware_internal_debug_msgs::msg::Float64Stamped>::SharedPtr
     processing_time_publisher_;
   autoware::motion_utils::VirtualWallMarkerCreator virtual_wall_marker_creator{};
+  // the debug markers and the virtual walls are only created when they are subscribed
+  autoware::motion_utils::MarkerPublishGate debug_marker_gate{};
+  autoware::motion_utils::MarkerPublishGate virtual_wall_gate{};
 
 protected:
   std::unique_ptr<autoware::planning_factor_interface::PlanningFactorInterface>
@@ -25,6 +25,7 @@
 #include "autoware_planning_msgs/msg/trajectory.hpp"
 
 #include <boost/geometry.hpp>
+#include <boost/geometry/index/rtree.hpp>
 
 #include <pcl/point_cloud.h>
 #include <pcl/point_types.h>
@@ -72,6 +73,55 @@ std::vector<Polygon2d> create_one_step_polygons(
   const geometry_msgs::msg::Pose & current_ego_pose, const double lat_margin,
   const bool enable_to_consider_current_pose, const double time_to_convergence,
   const double decimate_trajectory_step_length);
+
+/// @brief footprints indexed by an rtree, to test many points against all of them
+/// @details each point is tested against the bounding box of all the footprints, then against the
+/// footprints whose bounding box contains it
+class FootprintsIndex
+{
+public:
+  explicit FootprintsIndex(const std::vector<Polygon2d> & footprints);
+
+  /// @brief whether the point is within at least one of the footprints
+  [[nodiscard]] bool within(const Point2d & p) const;
+
+private:
+  using RtreeNode = std::pair<autoware_utils_geometry::Box2d, size_t>;
+
+  const std::vector<Polygon2d> & footprints_;
+  autoware_utils_geometry::Box2d footprints_box_;
+  boost::geometry::index::rtree<RtreeNode, boost::geometry::index::rstar<16>> rtree_;
+};
+
+/// @brief distances from points to convex polygons, with the edges of the polygons laid out as
+/// arrays
+/// @details a point inside a polygon is at the distance 0 of it, otherwise at the distance of its
+/// nearest edge, as boost::geometry::distance. The polygons whose bounding box is farther than the
+/// nearest polygon found are skipped.
+class ConvexPolygonsDistance
+{
+public:
+  explicit ConvexPolygonsDistance(const std::vector<Polygon2d> & convex_polygons);
+
+  /// @brief minimum distance from the point to the polygons, infinity without polygons
+  [[nodiscard]] double distance(const Point2d & p) const;
+
+private:
+  // the edges of the polygon i are the edges edge_begins_[i] to edge_begins_[i + 1] excluded
+  std::vector<double> edge_x_;
+  std::vector<double> edge_y_;
+  std::vector<double> edge_dx_;
+  std::vector<double> edge_dy_;
+  std::vector<double> edge_inverse_squared_length_;
+  std::vector<size_t> edge_begins_;
+  std::vector<autoware_utils_geometry::Box2d> boxes_;
+  // a degenerate polygon has no inside
+  std::vector<bool> has_area_;
+};
+
+/// @brief indices of the points within at least one of the footprints, in increasing order
+std::vector<size_t> get_indices_of_points_within_footprints(
+  const pcl::PointCloud<pcl::PointXYZ> & points, const std::vector<Polygon2d> & footprints);
 }  // namespace polygon_utils
 }  // namespace autoware::motion_velocity_planner
 
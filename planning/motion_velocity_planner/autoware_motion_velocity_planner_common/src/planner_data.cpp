@@ -14,6 +14,7 @@
 
 #include "autoware/motion_velocity_planner_common/planner_data.hpp"
 
+#include "autoware/motion_velocity_planner_common/polygon_utils.hpp"
 #include "autoware/object_recognition_utils/predicted_path_utils.hpp"
 #include "autoware_lanelet2_extension/utility/query.hpp"
 
@@ -27,9 +28,12 @@
 #include <lanelet2_core/geometry/LineString.h>
 
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <limits>
 #include <memory>
-#include <unordered_set>
+#include <mutex>
 #include <utility>
 #include <vector>
 
@@ -134,6 +138,7 @@ std::optional<double> PlannerData::calculate_min_deceleration_distance(
 double PlannerData::Object::get_dist_to_traj_poly(
   const std::vector<autoware_utils_geometry::Polygon2d> & decimated_traj_polys) const
 {
+  std::lock_guard<std::mutex> lock(cache_mutex_);
   if (!dist_to_traj_poly) {
     const auto & obj_pose = predicted_object.kinematics.initial_pose_with_covariance.pose;
     const auto obj_poly = autoware_utils_geometry::to_polygon2d(obj_pose, predicted_object.shape);
@@ -149,6 +154,7 @@ double PlannerData::Object::get_dist_to_traj_poly(
 double PlannerData::Object::get_dist_to_traj_lateral(
   const std::vector<TrajectoryPoint> & traj_points) const
 {
+  std::lock_guard<std::mutex> lock(cache_mutex_);
   if (!dist_to_traj_lateral) {
     const auto & obj_pos = predicted_object.kinematics.initial_pose_with_covariance.pose.position;
     dist_to_traj_lateral = autoware::motion_utils::calcLateralOffset(traj_points, obj_pos);
@@ -159,6 +165,7 @@ double PlannerData::Object::get_dist_to_traj_lateral(
 double PlannerData::Object::get_dist_from_ego_longitudinal(
   const std::vector<TrajectoryPoint> & traj_points, const geometry_msgs::msg::Point & ego_pos) const
 {
+  std::lock_guard<std::mutex> lock(cache_mutex_);
   if (!dist_from_ego_longitudinal) {
     const auto & obj_pos = predicted_object.kinematics.initial_pose_with_covariance.pose.position;
     dist_from_ego_longitudinal =
@@ -170,8 +177,10 @@ double PlannerData::Object::get_dist_from_ego_longitudinal(
 double PlannerData::Object::get_lon_vel_relative_to_traj(
   const std::vector<TrajectoryPoint> & traj_points) const
 {
+  std::lock_guard<std::mutex> lock(cache_mutex_);
   if (!lon_vel_relative_to_traj) {
-    calc_vel_relative_to_traj(traj_points);
+    calc_vel_relative_to_traj(traj_points.at(autoware::motion_utils::findNearestIndex(
+      traj_points, predicted_object.kinematics.initial_pose_with_covariance.pose.position)));
   }
   return *lon_vel_relative_to_traj;
 }
@@ -179,22 +188,20 @@ double PlannerData::Object::get_lon_vel_relative_to_traj(
 double PlannerData::Object::get_lat_vel_relative_to_traj(
   const std::vector<TrajectoryPoint> & traj_points) const
 {
+  std::lock_guard<std::mutex> lock(cache_mutex_);
   if (!lat_vel_relative_to_traj) {
-    calc_vel_relative_to_traj(traj_points);
+    calc_vel_relative_to_traj(traj_points.at(autoware::motion_utils::findNearestIndex(
+      traj_points, predicted_object.kinematics.initial_pose_with_covariance.pose.position)));
   }
   return *lat_vel_relative_to_traj;
 }
 
 void PlannerData::Object::calc_vel_relative_to_traj(
-  const std::vector<TrajectoryPoint> & traj_points) const
+  const TrajectoryPoint & nearest_traj_point) const
 {
   const auto & obj_pose = predicted_object.kinematics.initial_pose_with_covariance.pose;
   const auto & obj_twist = predicted_object.kinematics.initial_twist_with_covariance.twist;
 
-  const size_t object_idx =
-    autoware::motion_utils::findNearestIndex(traj_points, obj_pose.position);
-  const auto & nearest_traj_point = traj_points.at(object_idx);
-
   const double traj_yaw = tf2::getYaw(nearest_traj_point.pose.orientation);
   const double obj_yaw = tf2::getYaw(obj_pose.orientation);
   const Eigen::Rotation2Dd R_ego_to_obstacle(
@@ -218,9 +225,26 @@ void PlannerData::Object::calc_vel_relative_to_traj(
   lat_vel_relative_to_traj = sign * projected_velocity[1];
 }
 
+void PlannerData::Object::set_relations_to_trajectory(
+  const TrajectoryPoint & nearest_traj_point, const double dist_to_traj_lateral_value,
+  const double dist_from_ego_longitudinal_value) const
+{
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  if (!dist_to_traj_lateral) {
+    dist_to_traj_lateral = dist_to_traj_lateral_value;
+  }
+  if (!dist_from_ego_longitudinal) {
+    dist_from_ego_longitudinal = dist_from_ego_longitudinal_value;
+  }
+  if (!lon_vel_relative_to_traj) {
+    calc_vel_relative_to_traj(nearest_traj_point);
+  }
+}
+
 geometry_msgs::msg::Pose PlannerData::Object::get_predicted_current_pose(
   const rclcpp::Time & current_stamp, const rclcpp::Time & predicted_objects_stamp) const
 {
+  std::lock_guard<std::mutex> lock(cache_mutex_);
   if (!predicted_pose) {
     predicted_pose = calc_predicted_pose(current_stamp, predicted_objects_stamp);
   }
@@ -241,6 +265,123 @@ geometry_msgs::msg::Pose PlannerData::Object::calc_predicted_pose(
   return *predicted_pose_opt;
 }
 
+void PlannerData::calculate_objects_relations_to_trajectory(
+  const std::vector<std::shared_ptr<Object>> & objects,
+  const std::vector<TrajectoryPoint> & traj_points, const geometry_msgs::msg::Point & ego_pos)
+{
+  if (
+    objects.empty() || traj_points.size() < 2 ||
+    autoware::motion_utils::removeOverlapPoints(traj_points).size() != traj_points.size()) {
+    return;
+  }
+
+  // the same computations as motion_utils on a trajectory without overlapping points
+  const size_t n = traj_points.size();
+  std::vector<double> traj_x(n);
+  std::vector<double> traj_y(n);
+  for (size_t i = 0; i < n; ++i) {
+    traj_x[i] = traj_points[i].pose.position.x;
+    traj_y[i] = traj_points[i].pose.position.y;
+  }
+  const auto find_nearest_index = [&](const double x, const double y) {
+    double min_dist = std::numeric_limits<double>::max();
+    size_t min_idx = 0;
+    for (size_t i = 0; i < n; ++i) {
+      const double dx = traj_x[i] - x;
+      const double dy = traj_y[i] - y;
+      const double dist = dx * dx + dy * dy;
+      if (dist < min_dist) {
+        min_dist = dist;
+        min_idx = i;
+      }
+    }
+    return min_idx;
+  };
+  const auto calc_longitudinal_offset_to_segment =
+    [&](const size_t seg_idx, const double x, const double y) {
+      const double segment_x = traj_x[seg_idx + 1] - traj_x[seg_idx];
+      const double segment_y = traj_y[seg_idx + 1] - traj_y[seg_idx];
+      return (segment_x * (x - traj_x[seg_idx]) + segment_y * (y - traj_y[seg_idx])) /
+             std::sqrt(segment_x * segment_x + segment_y * segment_y);
+    };
+  const auto find_nearest_segment_index =
+    [&](const size_t nearest_idx, const double x, const double y) {
+      if (nearest_idx == 0) {
+        return size_t{0};
+      }
+      if (nearest_idx == n - 1) {
+        return n - 2;
+      }
+      return calc_longitudinal_offset_to_segment(nearest_idx, x, y) <= 0 ? nearest_idx - 1
+                                                                         : nearest_idx;
+    };
+  const auto calc_lateral_offset = [&](const size_t seg_idx, const double x, const double y) {
+    const double segment_x = traj_x[seg_idx + 1] - traj_x[seg_idx];
+    const double segment_y = traj_y[seg_idx + 1] - traj_y[seg_idx];
+    return (segment_x * (y - traj_y[seg_idx]) - segment_y * (x - traj_x[seg_idx])) /
+           std::sqrt(segment_x * segment_x + segment_y * segment_y);
+  };
+
+  const size_t ego_seg_idx =
+    find_nearest_segment_index(find_nearest_index(ego_pos.x, ego_pos.y), ego_pos.x, ego_pos.y);
+  const double ego_offset = calc_longitudinal_offset_to_segment(ego_seg_idx, ego_pos.x, ego_pos.y);
+  for (const auto & object : objects) {
+    const auto & obj_pos =
+      object->predicted_object.kinematics.initial_pose_with_covariance.pose.position;
+    const size_t nearest_idx = find_nearest_index(obj_pos.x, obj_pos.y);
+    const size_t seg_idx = find_nearest_segment_index(nearest_idx, obj_pos.x, obj_pos.y);
+    const double dist_from_ego_longitudinal =
+      autoware::motion_utils::calcSignedArcLength(traj_points, ego_seg_idx, seg_idx) - ego_offset +
+      calc_longitudinal_offset_to_segment(seg_idx, obj_pos.x, obj_pos.y);
+    object->set_relations_to_trajectory(
+      traj_points[nearest_idx], calc_lateral_offset(seg_idx, obj_pos.x, obj_pos.y),
+      dist_from_ego_longitudinal);
+  }
+}
+
+const CollisionChecker & PlannerData::TrajectoryPolygons::collision_checker() const
+{
+  std::call_once(collision_checker_flag_, [&]() {
+    collision_checker_ = std::make_unique<CollisionChecker>(
+      autoware_utils_geometry::MultiPolygon2d(polygons_.begin(), polygons_.end()));
+  });
+  return *collision_checker_;
+}
+
+const PlannerData::TrajectoryPolygons & PlannerData::get_trajectory_polygons(
+  const std::vector<TrajectoryPoint> & decimated_traj_points,
+  const geometry_msgs::msg::Pose & current_ego_pose, const double lat_margin,
+  const bool enable_to_consider_current_pose, const double time_to_convergence,
+  const double decimate_trajectory_step_length) const
+{
+  std::lock_guard<std::mutex> lock(*trajectory_polygons_mutex_);
+  for (const auto & [key, trajectory_polygons] : trajectory_polygons_cache_) {
+    if (
+      key.lat_margin == lat_margin &&
+      key.enable_to_consider_current_pose == enable_to_consider_current_pose &&
+      key.time_to_convergence == time_to_convergence &&
+      key.decimate_trajectory_step_length == decimate_trajectory_step_length &&
+      key.current_ego_pose == current_ego_pose &&
+      key.decimated_traj_points == decimated_traj_points) {
+      return *trajectory_polygons;
+    }
+  }
+
+  TrajectoryPolygonsKey key;
+  key.decimated_traj_points = decimated_traj_points;
+  key.current_ego_pose = current_ego_pose;
+  key.lat_margin = lat_margin;
+  key.enable_to_consider_current_pose = enable_to_consider_current_pose;
+  key.time_to_convergence = time_to_convergence;
+  key.decimate_trajectory_step_length = decimate_trajectory_step_length;
+  auto trajectory_polygons =
+    std::make_unique<TrajectoryPolygons>(polygon_utils::create_one_step_polygons(
+      decimated_traj_points, vehicle_info_, current_ego_pose, lat_margin,
+      enable_to_consider_current_pose, time_to_convergence, decimate_trajectory_step_length));
+  trajectory_polygons_cache_.emplace_back(std::move(key), std::move(trajectory_polygons));
+  return *trajectory_polygons_cache_.back().second;
+}
+
 void PlannerData::process_predicted_objects(
   const autoware_perception_msgs::msg::PredictedObjects & predicted_objects)
 {
@@ -291,10 +432,134 @@ std::vector<StopPoint> PlannerData::calculate_map_stop_points(
   return stop_points;
 }
 
+void PlannerData::Pointcloud::set_pointcloud(
+  const sensor_msgs::msg::PointCloud2::ConstSharedPtr & msg,
+  const Eigen::Affine3f & transform_to_map)
+{
+  const auto is_float32_field = [&](const char * name) {
+    return std::any_of(msg->fields.begin(), msg->fields.end(), [&](const auto & field) {
+      return field.name == name && field.datatype == sensor_msgs::msg::PointField::FLOAT32;
+    });
+  };
+  filtered_pointcloud_ptr.reset();
+  cluster_indices.reset();
+
+  if (!is_float32_field("x") || !is_float32_field("y") || !is_float32_field("z")) {
+    pcl::PointCloud<pcl::PointXYZ> pc;
+    pcl::fromROSMsg(*msg, pc);
+    pointcloud_.clear();
+    if (!pc.empty()) pcl::transformPointCloud(pc, pointcloud_, transform_to_map);
+    pointcloud_.header = pc.header;
+    pointcloud_msg_.reset();
+    return;
+  }
+
+  pointcloud_.clear();
+  pcl_conversions::toPCL(msg->header, pointcloud_.header);
+  pointcloud_msg_ = msg;
+  transform_to_map_ = transform_to_map;
+}
+
+void PlannerData::OccupancyGrid::set_occupancy_grid(
+  const nav_msgs::msg::OccupancyGrid::ConstSharedPtr & msg)
+{
+  std::lock_guard<std::mutex> lock(*cache_mutex_);
+  msg_ = msg;
+  integral_images_.clear();
+}
+
+const std::vector<uint32_t> & PlannerData::OccupancyGrid::get_integral_image(
+  const int8_t min_value) const
+{
+  auto & integral_image = integral_images_[min_value];
+  if (!integral_image.empty()) {
+    return integral_image;
+  }
+  const size_t width = msg_->info.width;
+  const size_t height = msg_->info.height;
+  integral_image.resize((width + 1) * (height + 1), 0U);
+  for (size_t y = 0; y < height; ++y) {
+    uint32_t row_count = 0U;
+    for (size_t x = 0; x < width; ++x) {
+      row_count += msg_->data[y * width + x] >= min_value ? 1U : 0U;
+      integral_image[(y + 1) * (width + 1) + x + 1] =
+        integral_image[y * (width + 1) + x + 1] + row_count;
+    }
+  }
+  return integral_image;
+}
+
+size_t PlannerData::OccupancyGrid::count_cells(
+  const int64_t min_x, const int64_t min_y, const int64_t max_x, const int64_t max_y,
+  const int8_t min_value) const
+{
+  std::lock_guard<std::mutex> lock(*cache_mutex_);
+  if (!msg_ || msg_->data.size() != static_cast<size_t>(msg_->info.width) * msg_->info.height) {
+    return 0UL;
+  }
+  const auto width = static_cast<int64_t>(msg_->info.width);
+  const auto height = static_cast<int64_t>(msg_->info.height);
+  const int64_t begin_x = std::max<int64_t>(min_x, 0);
+  const int64_t begin_y = std::max<int64_t>(min_y, 0);
+  const int64_t end_x = std::min<int64_t>(max_x + 1, width);
+  const int64_t end_y = std::min<int64_t>(max_y + 1, height);
+  if (end_x <= begin_x || end_y <= begin_y) {
+    return 0UL;
+  }
+  const auto & integral_image = get_integral_image(min_value);
+  const auto at = [&](const int64_t x, const int64_t y) {
+    return static_cast<int64_t>(integral_image[static_cast<size_t>(y * (width + 1) + x)]);
+  };
+  return static_cast<size_t>(
+    at(end_x, end_y) - at(begin_x, end_y) - at(end_x, begin_y) + at(begin_x, begin_y));
+}
+
+size_t PlannerData::OccupancyGrid::count_cells_in_bounding_box(
+  const autoware_utils_geometry::Polygon2d & polygon, const int8_t min_value) const
+{
+  if (!msg_ || polygon.outer().empty() || msg_->info.resolution <= 0.0F) {
+    return 0UL;
+  }
+  const auto & origin = msg_->info.origin;
+  const double yaw = tf2::getYaw(origin.orientation);
+  const double cos_yaw = std::cos(yaw);
+  const double sin_yaw = std::sin(yaw);
+  double min_x = std::numeric_limits<double>::max();
+  double min_y = std::numeric_limits<double>::max();
+  double max_x = std::numeric_limits<double>::lowest();
+  double max_y = std::numeric_limits<double>::lowest();
+  for (const auto & p : polygon.outer()) {
+    const double dx = p.x() - origin.position.x;
+    const double dy = p.y() - origin.position.y;
+    const double grid_x = cos_yaw * dx + sin_yaw * dy;
+    const double grid_y = -sin_yaw * dx + cos_yaw * dy;
+    min_x = std::min(min_x, grid_x);
+    min_y = std::min(min_y, grid_y);
+    max_x = std::max(max_x, grid_x);
+    max_y = std::max(max_y, grid_y);
+  }
+  // the indices are clamped to one cell around the grid before the conversion to integers
+  const double resolution = msg_->info.resolution;
+  const double max_index = std::max(msg_->info.width, msg_->info.height);
+  const auto to_index = [&](const double coordinate) {
+    return static_cast<int64_t>(std::clamp(std::floor(coordinate / resolution), -1.0, max_index));
+  };
+  return count_cells(to_index(min_x), to_index(min_y), to_index(max_x), to_index(max_y), min_value);
+}
+
+bool PlannerData::Pointcloud::empty() const
+{
+  if (pointcloud_msg_) {
+    return pointcloud_msg_->width * pointcloud_msg_->height == 0;
+  }
+  return pointcloud_.empty();
+}
+
 const pcl::PointCloud<pcl::PointXYZ>::Ptr PlannerData::Pointcloud::get_filtered_pointcloud_ptr(
   const autoware::motion_velocity_planner::TrajectoryPoints & trajectory_points,
   const autoware::vehicle_info_utils::VehicleInfo & vehicle_info) const
 {
+  std::lock_guard<std::mutex> lock(*cache_mutex_);
   if (!filtered_pointcloud_ptr) {
     auto pair = filter_and_cluster_point_clouds(trajectory_points, vehicle_info);
     filtered_pointcloud_ptr = pair.first;
@@ -307,6 +572,7 @@ const std::vector<pcl::PointIndices> PlannerData::Pointcloud::get_cluster_indice
   const autoware::motion_velocity_planner::TrajectoryPoints & trajectory_points,
   const autoware::vehicle_info_utils::VehicleInfo & vehicle_info) const
 {
+  std::lock_guard<std::mutex> lock(*cache_mutex_);
   if (!cluster_indices) {
     auto pair = filter_and_cluster_point_clouds(trajectory_points, vehicle_info);
     filtered_pointcloud_ptr = pair.first;
@@ -318,67 +584,73 @@ const std::vector<pcl::PointIndices> PlannerData::Pointcloud::get_cluster_indice
 void PlannerData::Pointcloud::search_pointcloud_near_trajectory(
   const std::vector<TrajectoryPoint> & trajectory,
   const autoware::vehicle_info_utils::VehicleInfo & vehicle_info,
-  const pcl::PointCloud<pcl::PointXYZ>::Ptr & input_points_ptr,
-  pcl::PointCloud<pcl::PointXYZ>::Ptr & output_points_ptr) const
+  pcl::PointCloud<pcl::PointXYZ> & output_points) const
 {
-  const double front_length = vehicle_info.max_longitudinal_offset_m;
-  const double rear_length = vehicle_info.rear_overhang_m;
-  const double vehicle_width = vehicle_info.vehicle_width_m;
-
-  output_points_ptr->header = input_points_ptr->header;
+  output_points.header = pointcloud_.header;
 
   // Build footprints from trajectory
+  const auto footprint = vehicle_info.createRectangleFootprintTemplate(mask_lat_margin_);
   std::vector<Polygon2d> footprints;
   footprints.reserve(trajectory.size());
 
   std::transform(
     trajectory.begin(), trajectory.end(), std::back_inserter(footprints),
     [&](const TrajectoryPoint & trajectory_point) {
-      return autoware_utils_geometry::to_footprint(
-        trajectory_point.pose, front_length, rear_length, vehicle_width + mask_lat_margin_ * 2.0);
+      return footprint.transformToPolygon(trajectory_point.pose);
     });
 
-  // Define types for Boost.Geometry
-  namespace bg = boost::geometry;
-  namespace bgi = boost::geometry::index;
-  using BoostPoint2D = bg::model::point<double, 2, bg::cs::cartesian>;
-  using BoostValue = std::pair<BoostPoint2D, size_t>;  // point + index
-
-  // Build R-tree from input points
-  std::vector<BoostValue> rtree_data;
-  rtree_data.reserve(input_points_ptr->points.size());
-
-  {
+  output_points.points.clear();
+  if (!pointcloud_msg_) {
+    // the points are streamed once through the indexed footprints
+    const auto indices =
+      polygon_utils::get_indices_of_points_within_footprints(pointcloud_, footprints);
+    output_points.points.resize(indices.size());
     std::transform(
-      input_points_ptr->points.begin(), input_points_ptr->points.end(),
-      std::back_inserter(rtree_data), [i = 0](const pcl::PointXYZ & pt) mutable {
-        return std::make_pair(BoostPoint2D(pt.x, pt.y), i++);
-      });
-  }
-
-  bgi::rtree<BoostValue, bgi::quadratic<16>> rtree(rtree_data.begin(), rtree_data.end());
-
-  std::unordered_set<size_t> selected_indices;
-
-  std::for_each(footprints.begin(), footprints.end(), [&](const Polygon2d & footprint) {
-    bg::model::box<BoostPoint2D> bbox;
-    bg::envelope(footprint, bbox);
-
-    std::vector<BoostValue> result_s;
-    rtree.query(bgi::intersects(bbox), std::back_inserter(result_s));
-
-    for (const auto & val : result_s) {
-      const BoostPoint2D & pt = val.first;
-      if (bg::within(pt, footprint)) {
-        selected_indices.insert(val.second);
+      indices.begin(), indices.end(), output_points.points.begin(),
+      [&](const size_t idx) { return pointcloud_.points[idx]; });
+  } else {
+    // only x and y of the message points are transformed for the footprint test, and only the
+    // points passing it are completed and copied
+    const auto & msg = *pointcloud_msg_;
+    const auto get_offset = [&](const char * name) {
+      return std::find_if(msg.fields.begin(), msg.fields.end(), [&](const auto & field) {
+        return field.name == name;
+      })->offset;
+    };
+    const uint32_t x_offset = get_offset("x");
+    const uint32_t y_offset = get_offset("y");
+    const uint32_t z_offset = get_offset("z");
+    const Eigen::Matrix3f rotation = transform_to_map_.linear();
+    const Eigen::Vector3f translation = transform_to_map_.translation();
+
+    const polygon_utils::FootprintsIndex footprints_index(footprints);
+    for (uint32_t row = 0; row < msg.height; ++row) {
+      const uint8_t * point_data = msg.data.data() + static_cast<size_t>(row) * msg.row_step;
+      for (uint32_t col = 0; col < msg.width; ++col, point_data += msg.point_step) {
+        float x{};
+        float y{};
+        float z{};
+        std::memcpy(&x, point_data + x_offset, sizeof(float));
+        std::memcpy(&y, point_data + y_offset, sizeof(float));
+        std::memcpy(&z, point_data + z_offset, sizeof(float));
+        if (!std::isfinite(x) || !std::isfinite(y) || !std::isfinite(z)) {
+          continue;
+        }
+        const float map_x =
+          rotation(0, 0) * x + rotation(0, 1) * y + rotation(0, 2) * z + translation.x();
+        const float map_y =
+          rotation(1, 0) * x + rotation(1, 1) * y + rotation(1, 2) * z + translation.y();
+        if (!footprints_index.within(polygon_utils::Point2d{map_x, map_y})) {
+          continue;
+        }
+        const float map_z =
+          rotation(2, 0) * x + rotation(2, 1) * y + rotation(2, 2) * z + translation.z();
+        output_points.points.emplace_back(map_x, map_y, map_z);
       }
     }
-  });
-
-  output_points_ptr->points.reserve(selected_indices.size());
-  std::transform(
-    selected_indices.begin(), selected_indices.end(), std::back_inserter(output_points_ptr->points),
-    [&](const size_t idx) { return input_points_ptr->points[idx]; });
+  }
+  output_points.width = static_cast<uint32_t>(output_points.points.size());
+  output_points.height = 1;
 }
 
 std::pair<pcl::PointCloud<pcl::PointXYZ>::Ptr, std::vector<pcl::PointIndices>>
@@ -386,40 +658,42 @@ PlannerData::Pointcloud::filter_and_cluster_point_clouds(
   const autoware::motion_velocity_planner::TrajectoryPoints & trajectory_points,
   const autoware::vehicle_info_utils::VehicleInfo & vehicle_info) const
 {
-  if (pointcloud.empty()) {
+  if (empty()) {
     return {};
   }
 
-  // 1. transform pointcloud
-  pcl::PointCloud<pcl::PointXYZ>::Ptr pointcloud_ptr =
-    std::make_shared<pcl::PointCloud<pcl::PointXYZ>>(pointcloud);
+  if (!near_trajectory_pointcloud_ptr_) {
+    near_trajectory_pointcloud_ptr_ = std::make_shared<pcl::PointCloud<pcl::PointXYZ>>();
+    voxel_grid_ = std::make_shared<euclidean_cluster::GridHashVoxelGrid>();
+    cluster_extraction_ = std::make_shared<euclidean_cluster::GridHashClusterExtraction>();
+    cluster_extraction_->setUseHeight(true);
+    cluster_extraction_->setNumThreads(1);
+  }
 
-  // 2. filter-out points far-away from trajectory
-  pcl::PointCloud<pcl::PointXYZ>::Ptr far_away_pointcloud_ptr(new pcl::PointCloud<pcl::PointXYZ>);
+  // 1. filter-out points far-away from trajectory
   search_pointcloud_near_trajectory(
-    trajectory_points, vehicle_info, pointcloud_ptr, far_away_pointcloud_ptr);
+    trajectory_points, vehicle_info, *near_trajectory_pointcloud_ptr_);
 
-  // 3. downsample & cluster pointcloud
+  // 2. downsample & cluster pointcloud
+  // the grid hash voxel grid and extraction give the same voxels and clusters as pcl::VoxelGrid
+  // and pcl::EuclideanClusterExtraction, without sorting the voxels nor building a search tree
   pcl::PointCloud<pcl::PointXYZ>::Ptr filtered_points_ptr(new pcl::PointCloud<pcl::PointXYZ>);
-  pcl::VoxelGrid<pcl::PointXYZ> filter;
-
-  filter.setInputCloud(far_away_pointcloud_ptr);
-  filter.setLeafSize(
-    pointcloud_obstacle_filtering_param_.pointcloud_voxel_grid_x,
-    pointcloud_obstacle_filtering_param_.pointcloud_voxel_grid_y,
-    pointcloud_obstacle_filtering_param_.pointcloud_voxel_grid_z);
-  filter.filter(*filtered_points_ptr);
+  const auto & p = pointcloud_obstacle_filtering_param_;
+  voxel_grid_->setLeafSize(
+    static_cast<float>(p.pointcloud_voxel_grid_x * voxel_grid_scale_),
+    static_cast<float>(p.pointcloud_voxel_grid_y * voxel_grid_scale_),
+    static_cast<float>(p.pointcloud_voxel_grid_z * voxel_grid_scale_));
+  voxel_grid_->filter(*near_trajectory_pointcloud_ptr_, *filtered_points_ptr);
 
-  pcl::search::KdTree<pcl::PointXYZ>::Ptr tree(new pcl::search::KdTree<pcl::PointXYZ>);
-  tree->setInputCloud(filtered_points_ptr);
   std::vector<pcl::PointIndices> clusters;
-  pcl::EuclideanClusterExtraction<pcl::PointXYZ> ec;
-  ec.setClusterTolerance(pointcloud_obstacle_filtering_param_.pointcloud_cluster_tolerance);
-  ec.setMinClusterSize(pointcloud_obstacle_filtering_param_.pointcloud_min_cluster_size);
-  ec.setMaxClusterSize(pointcloud_obstacle_filtering_param_.pointcloud_max_cluster_size);
-  ec.setSearchMethod(tree);
-  ec.setInputCloud(filtered_points_ptr);
-  ec.extract(clusters);
+  cluster_extraction_->setClusterTolerance(
+    static_cast<float>(pointcloud_obstacle_filtering_param_.pointcloud_cluster_tolerance));
+  cluster_extraction_->setMinClusterSize(
+    static_cast<int>(pointcloud_obstacle_filtering_param_.pointcloud_min_cluster_size));
+  cluster_extraction_->setMaxClusterSize(static_cast<int>(std::min<size_t>(
+    pointcloud_obstacle_filtering_param_.pointcloud_max_cluster_size,
+    std::numeric_limits<int>::max())));
+  cluster_extraction_->extract(*filtered_points_ptr, clusters);
 
   return std::make_pair(filtered_points_ptr, clusters);
 }
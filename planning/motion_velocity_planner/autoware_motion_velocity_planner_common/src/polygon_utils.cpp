@@ -20,6 +20,7 @@
 #include <autoware_utils_geometry/geometry.hpp>
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <utility>
 #include <vector>
@@ -173,9 +174,15 @@ std::vector<Polygon2d> create_one_step_polygons(
   const double decimate_trajectory_step_length)
 {
   const double front_length = vehicle_info.max_longitudinal_offset_m;
-  const double rear_length = vehicle_info.rear_overhang_m;
   const double vehicle_width = vehicle_info.vehicle_width_m;
 
+  // the footprints relative to base_link are calculated once and placed at each pose
+  const auto footprint = vehicle_info.createRectangleFootprintTemplate(lat_margin);
+  auto first_local_footprint = vehicle_info.createRectangleFootprintTemplate().getLocalFootprint();
+  first_local_footprint.emplace_back(front_length, vehicle_width * 0.5 + lat_margin);
+  first_local_footprint.emplace_back(front_length, -vehicle_width * 0.5 - lat_margin);
+  const autoware::vehicle_info_utils::FootprintTemplate first_footprint(first_local_footprint);
+
   const size_t nearest_idx =
     autoware::motion_utils::findNearestSegmentIndex(traj_points, current_ego_pose.position);
   const auto nearest_pose = traj_points.at(nearest_idx).pose;
@@ -212,27 +219,9 @@ std::vector<Polygon2d> create_one_step_polygons(
     Polygon2d idx_poly{};
     for (const auto & pose : current_poses) {
       if (i == 0 && traj_points.at(i).longitudinal_velocity_mps > 1e-3) {
-        boost::geometry::append(
-          idx_poly,
-          autoware_utils_geometry::to_footprint(pose, front_length, rear_length, vehicle_width)
-            .outer());
-        boost::geometry::append(
-          idx_poly, autoware_utils_geometry::from_msg(
-                      autoware_utils_geometry::calc_offset_pose(
-                        pose, front_length, vehicle_width * 0.5 + lat_margin, 0.0)
-                        .position)
-                      .to_2d());
-        boost::geometry::append(
-          idx_poly, autoware_utils_geometry::from_msg(
-                      autoware_utils_geometry::calc_offset_pose(
-                        pose, front_length, -vehicle_width * 0.5 - lat_margin, 0.0)
-                        .position)
-                      .to_2d());
+        boost::geometry::append(idx_poly, first_footprint.transform(pose));
       } else {
-        boost::geometry::append(
-          idx_poly, autoware_utils_geometry::to_footprint(
-                      pose, front_length, rear_length, vehicle_width + lat_margin * 2.0)
-                      .outer());
+        boost::geometry::append(idx_poly, footprint.transform(pose));
       }
     }
 
@@ -246,4 +235,123 @@ std::vector<Polygon2d> create_one_step_polygons(
   }
   return output_polygons;
 }
+
+FootprintsIndex::FootprintsIndex(const std::vector<Polygon2d> & footprints)
+: footprints_(footprints)
+{
+  // the footprints are much fewer than the points, so they are indexed instead of the points
+  std::vector<RtreeNode> nodes;
+  nodes.reserve(footprints.size());
+  bg::assign_inverse(footprints_box_);
+  for (size_t i = 0; i < footprints.size(); ++i) {
+    const auto footprint_box = bg::return_envelope<autoware_utils_geometry::Box2d>(footprints[i]);
+    bg::expand(footprints_box_, footprint_box);
+    nodes.emplace_back(footprint_box, i);
+  }
+  rtree_ = decltype(rtree_)(nodes.begin(), nodes.end());
+}
+
+bool FootprintsIndex::within(const Point2d & p) const
+{
+  namespace bgi = boost::geometry::index;
+
+  if (footprints_.empty()) {
+    return false;
+  }
+  const auto & min_corner = footprints_box_.min_corner();
+  const auto & max_corner = footprints_box_.max_corner();
+  if (
+    p.x() < min_corner.x() || max_corner.x() < p.x() || p.y() < min_corner.y() ||
+    max_corner.y() < p.y()) {
+    return false;
+  }
+  for (auto it = rtree_.qbegin(bgi::intersects(p)); it != rtree_.qend(); ++it) {
+    if (bg::within(p, footprints_[it->second])) {
+      return true;
+    }
+  }
+  return false;
+}
+
+ConvexPolygonsDistance::ConvexPolygonsDistance(const std::vector<Polygon2d> & convex_polygons)
+{
+  edge_begins_.push_back(0);
+  for (const auto & polygon : convex_polygons) {
+    const auto & ring = polygon.outer();
+    if (ring.empty()) {
+      continue;
+    }
+    // the closing edge is added when the ring is open
+    const size_t nb_edges = bg::equals(ring.front(), ring.back()) ? ring.size() - 1 : ring.size();
+    for (size_t i = 0; i < std::max<size_t>(nb_edges, 1); ++i) {
+      const auto & p1 = ring[i];
+      const auto & p2 = ring[(i + 1) % ring.size()];
+      const double dx = p2.x() - p1.x();
+      const double dy = p2.y() - p1.y();
+      const double squared_length = dx * dx + dy * dy;
+      edge_x_.push_back(p1.x());
+      edge_y_.push_back(p1.y());
+      edge_dx_.push_back(dx);
+      edge_dy_.push_back(dy);
+      edge_inverse_squared_length_.push_back(squared_length > 0.0 ? 1.0 / squared_length : 0.0);
+    }
+    edge_begins_.push_back(edge_x_.size());
+    boxes_.push_back(bg::return_envelope<autoware_utils_geometry::Box2d>(polygon));
+    has_area_.push_back(bg::area(polygon) != 0.0);
+  }
+}
+
+double ConvexPolygonsDistance::distance(const Point2d & p) const
+{
+  const double px = p.x();
+  const double py = p.y();
+  double min_distance = std::numeric_limits<double>::infinity();
+  for (size_t i = 0; i < boxes_.size(); ++i) {
+    const auto & box = boxes_[i];
+    const double box_dx = std::max({box.min_corner().x() - px, 0.0, px - box.max_corner().x()});
+    const double box_dy = std::max({box.min_corner().y() - py, 0.0, py - box.max_corner().y()});
+    if (min_distance * min_distance <= box_dx * box_dx + box_dy * box_dy) {
+      continue;
+    }
+
+    // the point is inside the convex polygon when it is on the same side of all the edges
+    bool is_left_of_an_edge = false;
+    bool is_right_of_an_edge = false;
+    double min_squared_distance = std::numeric_limits<double>::infinity();
+    for (size_t e = edge_begins_[i]; e < edge_begins_[i + 1]; ++e) {
+      const double to_px = px - edge_x_[e];
+      const double to_py = py - edge_y_[e];
+      const double cross = edge_dx_[e] * to_py - edge_dy_[e] * to_px;
+      is_left_of_an_edge |= cross > 0.0;
+      is_right_of_an_edge |= cross < 0.0;
+      const double ratio = std::clamp(
+        (to_px * edge_dx_[e] + to_py * edge_dy_[e]) * edge_inverse_squared_length_[e], 0.0, 1.0);
+      const double diff_x = to_px - ratio * edge_dx_[e];
+      const double diff_y = to_py - ratio * edge_dy_[e];
+      min_squared_distance = std::min(min_squared_distance, diff_x * diff_x + diff_y * diff_y);
+    }
+    if (has_area_[i] && !(is_left_of_an_edge && is_right_of_an_edge)) {
+      return 0.0;
+    }
+    min_distance = std::min(min_distance, std::sqrt(min_squared_distance));
+  }
+  return min_distance;
+}
+
+std::vector<size_t> get_indices_of_points_within_footprints(
+  const pcl::PointCloud<pcl::PointXYZ> & points, const std::vector<Polygon2d> & footprints)
+{
+  std::vector<size_t> indices;
+  if (footprints.empty()) {
+    return indices;
+  }
+
+  const FootprintsIndex footprints_index(footprints);
+  for (size_t i = 0; i < points.size(); ++i) {
+    if (footprints_index.within(Point2d{points[i].x, points[i].y})) {
+      indices.push_back(i);
+    }
+  }
+  return indices;
+}
 }  // namespace autoware::motion_velocity_planner::polygon_utils
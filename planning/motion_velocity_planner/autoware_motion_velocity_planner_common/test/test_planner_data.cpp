@@ -0,0 +1,214 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/motion_velocity_planner_common/planner_data.hpp"
+
+#include <gtest/gtest.h>
+#include <pcl/common/transforms.h>
+#include <pcl_conversions/pcl_conversions.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+using autoware::motion_velocity_planner::PlannerData;
+using autoware::motion_velocity_planner::PointcloudObstacleFilteringParam;
+using autoware::motion_velocity_planner::TrajectoryPoints;
+
+namespace
+{
+PlannerData::Pointcloud create_pointcloud_data()
+{
+  PointcloudObstacleFilteringParam param;
+  param.pointcloud_voxel_grid_x = 0.05;
+  param.pointcloud_voxel_grid_y = 0.05;
+  param.pointcloud_voxel_grid_z = 0.05;
+  param.pointcloud_cluster_tolerance = 1.0;
+  param.pointcloud_min_cluster_size = 1;
+  param.pointcloud_max_cluster_size = 100000;
+  return PlannerData::Pointcloud(param, 0.5);
+}
+
+// straight trajectory along the x axis of the map frame, every 1 m
+TrajectoryPoints create_trajectory()
+{
+  TrajectoryPoints trajectory(30);
+  for (size_t i = 0; i < trajectory.size(); ++i) {
+    trajectory[i].pose.position.x = static_cast<double>(i);
+    trajectory[i].pose.orientation.w = 1.0;
+  }
+  return trajectory;
+}
+
+pcl::PointCloud<pcl::PointXYZ> create_random_points(const size_t nb_points)
+{
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<float> distribution(-20.0F, 20.0F);
+  pcl::PointCloud<pcl::PointXYZ> points;
+  for (size_t i = 0; i < nb_points; ++i) {
+    points.push_back(
+      pcl::PointXYZ(distribution(engine), distribution(engine), 0.1F * distribution(engine)));
+  }
+  return points;
+}
+}  // namespace
+
+TEST(TestPlannerDataPointcloud, SameFilteredPointsFromMessage)
+{
+  autoware::vehicle_info_utils::VehicleInfo vehicle_info;
+  vehicle_info.max_longitudinal_offset_m = 4.0;
+  vehicle_info.rear_overhang_m = 1.0;
+  vehicle_info.vehicle_width_m = 2.0;
+  const auto trajectory = create_trajectory();
+
+  // the sensor frame is rotated and shifted from the map frame
+  Eigen::Affine3f transform_to_map = Eigen::Affine3f::Identity();
+  transform_to_map.translate(Eigen::Vector3f(10.0F, -2.0F, 1.5F));
+  transform_to_map.rotate(Eigen::AngleAxisf(0.3F, Eigen::Vector3f::UnitZ()));
+  const auto sensor_points = create_random_points(10000);
+  auto msg = std::make_shared<sensor_msgs::msg::PointCloud2>();
+  pcl::toROSMsg(sensor_points, *msg);
+
+  auto decoded = create_pointcloud_data();
+  pcl::PointCloud<pcl::PointXYZ> map_points;
+  pcl::transformPointCloud(sensor_points, map_points, transform_to_map);
+  decoded.set_pointcloud(std::move(map_points));
+  auto lazy = create_pointcloud_data();
+  lazy.set_pointcloud(msg, transform_to_map);
+  EXPECT_FALSE(lazy.empty());
+
+  const auto expected = decoded.get_filtered_pointcloud_ptr(trajectory, vehicle_info);
+  const auto actual = lazy.get_filtered_pointcloud_ptr(trajectory, vehicle_info);
+  ASSERT_FALSE(expected->empty());
+  ASSERT_EQ(expected->size(), actual->size());
+  for (size_t i = 0; i < expected->size(); ++i) {
+    EXPECT_NEAR(expected->points[i].x, actual->points[i].x, 1e-4);
+    EXPECT_NEAR(expected->points[i].y, actual->points[i].y, 1e-4);
+    EXPECT_NEAR(expected->points[i].z, actual->points[i].z, 1e-4);
+  }
+  EXPECT_EQ(
+    decoded.get_cluster_indices(trajectory, vehicle_info).size(),
+    lazy.get_cluster_indices(trajectory, vehicle_info).size());
+}
+
+TEST(TestPlannerDataPointcloud, EmptyMessage)
+{
+  auto pointcloud = create_pointcloud_data();
+  auto msg = std::make_shared<sensor_msgs::msg::PointCloud2>();
+  pcl::toROSMsg(pcl::PointCloud<pcl::PointXYZ>{}, *msg);
+  pointcloud.set_pointcloud(msg, Eigen::Affine3f::Identity());
+  EXPECT_TRUE(pointcloud.empty());
+}
+
+TEST(TestPlannerDataObject, SameRelationsToTrajectoryInBatch)
+{
+  // curved trajectory so that the nearest segments differ from the nearest points
+  TrajectoryPoints trajectory(50);
+  for (size_t i = 0; i < trajectory.size(); ++i) {
+    const double angle = 0.02 * static_cast<double>(i);
+    trajectory[i].pose.position.x = 50.0 * std::sin(angle);
+    trajectory[i].pose.position.y = 50.0 * (1.0 - std::cos(angle));
+    trajectory[i].pose.orientation.z = std::sin(angle / 2.0);
+    trajectory[i].pose.orientation.w = std::cos(angle / 2.0);
+  }
+  geometry_msgs::msg::Point ego_pos;
+  ego_pos.x = 3.2;
+  ego_pos.y = -0.4;
+
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<double> distribution(-10.0, 60.0);
+  std::vector<std::shared_ptr<PlannerData::Object>> batch_objects;
+  std::vector<std::shared_ptr<PlannerData::Object>> objects;
+  for (size_t i = 0; i < 100; ++i) {
+    autoware_perception_msgs::msg::PredictedObject predicted_object;
+    auto & kinematics = predicted_object.kinematics;
+    kinematics.initial_pose_with_covariance.pose.position.x = distribution(engine);
+    kinematics.initial_pose_with_covariance.pose.position.y = distribution(engine);
+    kinematics.initial_pose_with_covariance.pose.orientation.w = 1.0;
+    kinematics.initial_twist_with_covariance.twist.linear.x = 0.1 * distribution(engine);
+    kinematics.initial_twist_with_covariance.twist.linear.y = 0.1 * distribution(engine);
+    batch_objects.push_back(std::make_shared<PlannerData::Object>(predicted_object));
+    objects.push_back(std::make_shared<PlannerData::Object>(predicted_object));
+  }
+
+  PlannerData::calculate_objects_relations_to_trajectory(batch_objects, trajectory, ego_pos);
+  for (size_t i = 0; i < objects.size(); ++i) {
+    EXPECT_NEAR(
+      batch_objects[i]->get_dist_to_traj_lateral(trajectory),
+      objects[i]->get_dist_to_traj_lateral(trajectory), 1e-6);
+    EXPECT_NEAR(
+      batch_objects[i]->get_dist_from_ego_longitudinal(trajectory, ego_pos),
+      objects[i]->get_dist_from_ego_longitudinal(trajectory, ego_pos), 1e-6);
+    EXPECT_NEAR(
+      batch_objects[i]->get_lon_vel_relative_to_traj(trajectory),
+      objects[i]->get_lon_vel_relative_to_traj(trajectory), 1e-6);
+    EXPECT_NEAR(
+      batch_objects[i]->get_lat_vel_relative_to_traj(trajectory),
+      objects[i]->get_lat_vel_relative_to_traj(trajectory), 1e-6);
+  }
+}
+
+TEST(TestPlannerDataOccupancyGrid, SameCountsAsCellScan)
+{
+  auto msg = std::make_shared<nav_msgs::msg::OccupancyGrid>();
+  msg->info.width = 40;
+  msg->info.height = 30;
+  msg->info.resolution = 0.5F;
+  msg->info.origin.position.x = -5.0;
+  msg->info.origin.position.y = 2.0;
+  msg->info.origin.orientation.w = 1.0;
+  std::mt19937 engine(0);
+  std::uniform_int_distribution<int> distribution(-1, 100);
+  for (size_t i = 0; i < msg->info.width * msg->info.height; ++i) {
+    msg->data.push_back(static_cast<int8_t>(distribution(engine)));
+  }
+  PlannerData::OccupancyGrid occupancy_grid;
+  EXPECT_EQ(occupancy_grid.count_cells(0, 0, 10, 10, 0), 0U);
+  occupancy_grid.set_occupancy_grid(msg);
+
+  const int64_t width = msg->info.width;
+  const int64_t height = msg->info.height;
+  const auto count_by_scan =
+    [&](const int64_t min_x, const int64_t min_y, const int64_t max_x, const int64_t max_y,
+        const int8_t min_value) {
+      size_t count = 0;
+      for (int64_t y = std::max<int64_t>(min_y, 0); y <= std::min(max_y, height - 1); ++y) {
+        for (int64_t x = std::max<int64_t>(min_x, 0); x <= std::min(max_x, width - 1); ++x) {
+          count += msg->data[y * width + x] >= min_value ? 1 : 0;
+        }
+      }
+      return count;
+    };
+  for (const int8_t min_value : {-1, 50, 100}) {
+    EXPECT_EQ(
+      occupancy_grid.count_cells(0, 0, 39, 29, min_value), count_by_scan(0, 0, 39, 29, min_value));
+    EXPECT_EQ(
+      occupancy_grid.count_cells(3, 4, 17, 25, min_value), count_by_scan(3, 4, 17, 25, min_value));
+    EXPECT_EQ(
+      occupancy_grid.count_cells(-10, -10, 100, 5, min_value),
+      count_by_scan(-10, -10, 100, 5, min_value));
+    EXPECT_EQ(occupancy_grid.count_cells(50, 0, 60, 29, min_value), 0U);
+  }
+
+  // the footprint from (-3.8, 4.2) to (0.1, 6.9) covers the cells 2 to 10 and 4 to 9
+  const auto footprint = autoware_utils_geometry::to_footprint(
+    autoware_utils_geometry::calc_offset_pose(geometry_msgs::msg::Pose{}, -1.0, 5.55, 0.0), 1.1,
+    2.8, 2.7);
+  EXPECT_EQ(
+    occupancy_grid.count_cells_in_bounding_box(footprint, 50), count_by_scan(2, 4, 10, 9, 50));
+}
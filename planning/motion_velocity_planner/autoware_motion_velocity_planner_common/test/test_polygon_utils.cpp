@@ -0,0 +1,217 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/motion_velocity_planner_common/polygon_utils.hpp"
+
+#include <autoware_utils_geometry/boost_polygon_utils.hpp>
+#include <autoware_utils_geometry/geometry.hpp>
+
+#include <boost/geometry/index/rtree.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+using autoware::motion_velocity_planner::polygon_utils::ConvexPolygonsDistance;
+using autoware::motion_velocity_planner::polygon_utils::get_indices_of_points_within_footprints;
+using autoware_utils_geometry::Point2d;
+using autoware_utils_geometry::Polygon2d;
+
+namespace
+{
+// footprints of 4.5 m x 2.5 m along a curve, every 0.5 m
+std::vector<Polygon2d> create_footprints(const size_t nb_footprints)
+{
+  std::vector<Polygon2d> footprints;
+  for (size_t i = 0; i < nb_footprints; ++i) {
+    const double s = 0.5 * static_cast<double>(i);
+    const auto pose = autoware_utils_geometry::calc_offset_pose(
+      geometry_msgs::msg::Pose{}, s, 0.01 * s * s, 0.0, 0.0);
+    footprints.push_back(autoware_utils_geometry::to_footprint(pose, 3.5, 1.0, 2.5));
+  }
+  return footprints;
+}
+
+pcl::PointCloud<pcl::PointXYZ> create_random_points(const size_t nb_points)
+{
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<float> x_distribution(-20.0F, 120.0F);
+  std::uniform_real_distribution<float> y_distribution(-20.0F, 60.0F);
+  pcl::PointCloud<pcl::PointXYZ> points;
+  for (size_t i = 0; i < nb_points; ++i) {
+    points.push_back(pcl::PointXYZ(x_distribution(engine), y_distribution(engine), 0.0F));
+  }
+  return points;
+}
+
+// convex hulls of the consecutive footprints, as the trajectory polygons
+std::vector<Polygon2d> create_convex_polygons(const size_t nb_polygons)
+{
+  const auto footprints = create_footprints(nb_polygons + 1);
+  std::vector<Polygon2d> polygons;
+  for (size_t i = 0; i < nb_polygons; ++i) {
+    Polygon2d footprints_points;
+    boost::geometry::append(footprints_points, footprints[i].outer());
+    boost::geometry::append(footprints_points, footprints[i + 1].outer());
+    Polygon2d hull;
+    boost::geometry::convex_hull(footprints_points, hull);
+    boost::geometry::correct(hull);
+    polygons.push_back(hull);
+  }
+  return polygons;
+}
+
+double calc_boost_geometry_distance(const Point2d & p, const std::vector<Polygon2d> & polygons)
+{
+  double min_distance = std::numeric_limits<double>::infinity();
+  for (const auto & polygon : polygons) {
+    min_distance = std::min(min_distance, boost::geometry::distance(polygon, p));
+  }
+  return min_distance;
+}
+
+// indices selected by an rtree of the points queried with each footprint
+std::vector<size_t> get_indices_with_rtree_of_points(
+  const pcl::PointCloud<pcl::PointXYZ> & points, const std::vector<Polygon2d> & footprints)
+{
+  namespace bg = boost::geometry;
+  namespace bgi = boost::geometry::index;
+  using Value = std::pair<Point2d, size_t>;
+
+  std::vector<Value> values;
+  values.reserve(points.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    values.emplace_back(Point2d{points[i].x, points[i].y}, i);
+  }
+  const bgi::rtree<Value, bgi::quadratic<16>> rtree(values.begin(), values.end());
+
+  std::vector<size_t> indices;
+  for (const auto & footprint : footprints) {
+    std::vector<Value> candidates;
+    rtree.query(
+      bgi::intersects(bg::return_envelope<autoware_utils_geometry::Box2d>(footprint)),
+      std::back_inserter(candidates));
+    for (const auto & [point, index] : candidates) {
+      if (bg::within(point, footprint)) {
+        indices.push_back(index);
+      }
+    }
+  }
+  std::sort(indices.begin(), indices.end());
+  indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+  return indices;
+}
+}  // namespace
+
+TEST(TestPolygonUtils, PointsWithinFootprints)
+{
+  const auto footprints = create_footprints(200);
+  const auto points = create_random_points(10000);
+
+  const auto indices = get_indices_of_points_within_footprints(points, footprints);
+  EXPECT_FALSE(indices.empty());
+  EXPECT_TRUE(std::is_sorted(indices.begin(), indices.end()));
+  EXPECT_EQ(indices, get_indices_with_rtree_of_points(points, footprints));
+}
+
+TEST(TestPolygonUtils, PointsWithinNoFootprint)
+{
+  EXPECT_TRUE(get_indices_of_points_within_footprints(create_random_points(100), {}).empty());
+}
+
+TEST(TestPolygonUtils, DISABLED_BenchmarkPointsWithinFootprints)
+{
+  const auto footprints = create_footprints(200);
+  const auto points = create_random_points(100000);
+
+  const auto footprints_start = std::chrono::system_clock::now();
+  const auto indices = get_indices_of_points_within_footprints(points, footprints);
+  const auto footprints_end = std::chrono::system_clock::now();
+  const auto points_start = std::chrono::system_clock::now();
+  const auto rtree_indices = get_indices_with_rtree_of_points(points, footprints);
+  const auto points_end = std::chrono::system_clock::now();
+  EXPECT_EQ(indices, rtree_indices);
+
+  std::printf(
+    "%zu points, %zu footprints, %zu points within\n", points.size(), footprints.size(),
+    indices.size());
+  std::printf(
+    "%30s%10ld ns\n", "rtree of the footprints : ",
+    std::chrono::duration_cast<std::chrono::nanoseconds>(footprints_end - footprints_start)
+      .count());
+  std::printf(
+    "%30s%10ld ns\n", "rtree of the points : ",
+    std::chrono::duration_cast<std::chrono::nanoseconds>(points_end - points_start).count());
+}
+
+TEST(TestPolygonUtils, ConvexPolygonsDistance)
+{
+  const auto polygons = create_convex_polygons(200);
+  const auto points = create_random_points(10000);
+
+  const ConvexPolygonsDistance polygons_distance(polygons);
+  size_t nb_inside_points = 0;
+  for (const auto & point : points) {
+    const Point2d p{point.x, point.y};
+    const double distance = polygons_distance.distance(p);
+    EXPECT_NEAR(distance, calc_boost_geometry_distance(p, polygons), 1e-6);
+    nb_inside_points += distance == 0.0 ? 1 : 0;
+  }
+  EXPECT_GT(nb_inside_points, 0U);
+}
+
+TEST(TestPolygonUtils, ConvexPolygonsDistanceWithoutPolygon)
+{
+  EXPECT_EQ(
+    ConvexPolygonsDistance({}).distance(Point2d{0.0, 0.0}),
+    std::numeric_limits<double>::infinity());
+}
+
+TEST(TestPolygonUtils, DISABLED_BenchmarkConvexPolygonsDistance)
+{
+  const auto polygons = create_convex_polygons(200);
+  const auto points = create_random_points(100000);
+
+  const auto kernel_start = std::chrono::system_clock::now();
+  const ConvexPolygonsDistance polygons_distance(polygons);
+  std::vector<double> distances;
+  for (const auto & point : points) {
+    distances.push_back(polygons_distance.distance(Point2d{point.x, point.y}));
+  }
+  const auto kernel_end = std::chrono::system_clock::now();
+  const auto boost_start = std::chrono::system_clock::now();
+  std::vector<double> boost_distances;
+  for (const auto & point : points) {
+    boost_distances.push_back(calc_boost_geometry_distance(Point2d{point.x, point.y}, polygons));
+  }
+  const auto boost_end = std::chrono::system_clock::now();
+  for (size_t i = 0; i < points.size(); ++i) {
+    EXPECT_NEAR(distances[i], boost_distances[i], 1e-6);
+  }
+
+  std::printf("%zu points, %zu convex polygons\n", points.size(), polygons.size());
+  std::printf(
+    "%30s%10ld ns\n", "convex polygons distance : ",
+    std::chrono::duration_cast<std::chrono::nanoseconds>(kernel_end - kernel_start).count());
+  std::printf(
+    "%30s%10ld ns\n", "boost::geometry::distance : ",
+    std::chrono::duration_cast<std::chrono::nanoseconds>(boost_end - boost_start).count());
+}
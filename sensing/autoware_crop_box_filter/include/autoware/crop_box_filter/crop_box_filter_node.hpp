@@ -17,6 +17,10 @@
 #ifndef AUTOWARE__CROP_BOX_FILTER__CROP_BOX_FILTER_NODE_HPP_
 #define AUTOWARE__CROP_BOX_FILTER__CROP_BOX_FILTER_NODE_HPP_
 
+#include "autoware/crop_box_filter/crop_regions.hpp"
+
+#include <autoware/point_types/layout.hpp>
+#include <autoware/point_types/pipeline_latency.hpp>
 #include <autoware/point_types/types.hpp>
 #include <autoware_utils_debug/debug_publisher.hpp>
 #include <autoware_utils_debug/published_time_publisher.hpp>
@@ -66,9 +70,21 @@ private:
   /** \brief The maximum queue size (default: 3). */
   size_t max_queue_size_ = 3;
 
+  /** \brief Keep only the newest input cloud while a callback is running. */
+  bool process_latest_only_ = true;
+
   /** \brief Internal mutex. */
   std::mutex mutex_;
 
+  /** \brief Borrow the output message from the middleware when the RMW supports loans. */
+  bool use_loaned_message_ = false;
+
+  /** \brief Output buffer reused across callbacks when the output is not loaned. */
+  PointCloud2 output_buffer_;
+
+  /** \brief Publish the output buffer without copy to the nodes of the same container. */
+  bool use_intra_process_ = false;
+
   bool need_preprocess_transform_ = false;
   bool need_postprocess_transform_ = false;
 
@@ -86,6 +102,13 @@ private:
     bool negative{false};
   } param_;
 
+  /** \brief Boxes and prisms declared in additional_regions. They are static after startup. */
+  CropRegions additional_regions_;
+
+  /** \brief All regions tested for each point: the box of param_ followed by
+   * additional_regions_. */
+  CropRegions regions_;
+
   /** \brief Parameter service callback result : needed to be hold */
   OnSetParametersCallbackHandle::SharedPtr set_param_res_;
 
@@ -101,31 +124,29 @@ private:
   std::unique_ptr<autoware_utils_system::StopWatch<std::chrono::milliseconds>> stop_watch_ptr_;
   std::unique_ptr<autoware_utils_debug::DebugPublisher> debug_publisher_;
   std::unique_ptr<autoware_utils_debug::PublishedTimePublisher> published_time_publisher_;
+  autoware::point_types::StageLatency stage_latency_;
 
   // function declaration *************************************
 
   void publish_crop_box_polygon();
 
+  /** \brief Declare the parameters of each region listed in additional_regions */
+  void declare_additional_regions();
+
+  /** \brief Rebuild regions_ from param_ and additional_regions_ */
+  void update_regions();
+
   void pointcloud_callback(const PointCloud2ConstPtr cloud);
 
   /** \brief Parameter service callback */
   rcl_interfaces::msg::SetParametersResult param_callback(const std::vector<rclcpp::Parameter> & p);
 
-  /** \brief Return whether the input PointCloud2 data has the same layout than PointXYZI. That is
-   * to say whether you can memcpy from the PointCloud2 data buffer to a PointXYZI */
-  bool is_data_layout_compatible_with_point_xyzi(const PointCloud2 & input);
-
-  /** \brief Return whether the input PointCloud2 data has the same layout than PointXYZIRC. That is
-   * to say whether you can memcpy from the PointCloud2 data buffer to a PointXYZIRC */
-  bool is_data_layout_compatible_with_point_xyzirc(const PointCloud2 & input);
-
-  /** \brief Return whether the input PointCloud2 data has the same layout than PointXYZIRADRT. That
-   * is to say whether you can memcpy from the PointCloud2 data buffer to a PointXYZIRADRT */
-  bool is_data_layout_compatible_with_point_xyziradrt(const PointCloud2 & input);
-
-  /** \brief Return whether the input PointCloud2 data has the same layout than PointXYZIRCAEDT.
-   * That is to say whether you can memcpy from the PointCloud2 data buffer to a PointXYZIRCAEDT */
-  bool is_data_layout_compatible_with_point_xyzircaedt(const PointCloud2 & input);
+  /** \brief Filter the points of a cloud of the given layout into output, return the size of
+   * the output data. The layout is a PointLayout when the point step and offsets are known at
+   * compile time. */
+  template <typename LayoutT>
+  size_t filter_points(
+    const PointCloud2 & cloud, const LayoutT & layout, PointCloud2 & output, int & skipped_count);
 
   bool is_valid(const PointCloud2ConstPtr & cloud);
 
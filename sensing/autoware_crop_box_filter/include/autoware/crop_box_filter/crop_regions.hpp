@@ -0,0 +1,93 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__CROP_BOX_FILTER__CROP_REGIONS_HPP_
+#define AUTOWARE__CROP_BOX_FILTER__CROP_REGIONS_HPP_
+
+#include <Eigen/Core>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace autoware::crop_box_filter
+{
+
+/** \brief A set of crop regions evaluated together for each point.
+ *
+ * Every region is a vertical prism: a convex polygon in the xy plane that is extruded from min_z
+ * to max_z. An axis-aligned box is stored as a prism with four edges. The polygon is stored as
+ * half-planes a * x + b * y < c, so testing a point is the same arithmetic for every region and
+ * does not branch on the region type.
+ *
+ * A point is kept when it passes every region: it must be inside the regions with negative ==
+ * false and outside the regions with negative == true. This is the same result as chaining one
+ * filter per region.
+ */
+class CropRegions
+{
+public:
+  void clear();
+
+  /** \brief Add the box min < p < max. */
+  void add_box(
+    float min_x, float max_x, float min_y, float max_y, float min_z, float max_z, bool negative);
+
+  /** \brief Add the prism over a convex polygon given in either winding order. Throws
+   * std::invalid_argument when the polygon has less than three vertices or is not convex. */
+  void add_prism(
+    const std::vector<Eigen::Vector2f> & polygon, float min_z, float max_z, bool negative);
+
+  /** \brief Append all regions of another set after the regions of this one. */
+  void append(const CropRegions & other);
+
+  size_t size() const { return regions_.size(); }
+  bool empty() const { return regions_.empty(); }
+
+  /** \brief Return whether the point passes all regions. */
+  bool is_kept(float x, float y, float z) const
+  {
+    bool kept = true;
+    for (const auto & region : regions_) {
+      bool inside = (z > region.min_z) & (z < region.max_z);
+      for (uint32_t i = region.plane_begin; i < region.plane_end; ++i) {
+        inside &= a_[i] * x + b_[i] * y < c_[i];
+      }
+      kept &= inside != region.negative;
+    }
+    return kept;
+  }
+
+private:
+  struct Region
+  {
+    uint32_t plane_begin;
+    uint32_t plane_end;
+    float min_z;
+    float max_z;
+    bool negative;
+  };
+
+  void add_half_plane(float a, float b, float c);
+
+  // half-planes of all regions in structure-of-arrays form
+  std::vector<float> a_;
+  std::vector<float> b_;
+  std::vector<float> c_;
+  std::vector<Region> regions_;
+};
+
+}  // namespace autoware::crop_box_filter
+
+#endif  // AUTOWARE__CROP_BOX_FILTER__CROP_REGIONS_HPP_
@@ -19,12 +19,28 @@
 #include <tf2_eigen/tf2_eigen.hpp>
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 
 namespace autoware::crop_box_filter
 {
+namespace
+{
+using autoware::point_types::PointXYZIRC;
+using autoware::point_types::PointXYZIRCAEDT;
+
+// point step and field offsets of a layout only known at runtime
+struct RuntimeLayout
+{
+  uint32_t point_step;
+  uint32_t x_offset;
+  uint32_t y_offset;
+  uint32_t z_offset;
+};
+}  // namespace
+
 CropBoxFilter::CropBoxFilter(const rclcpp::NodeOptions & node_options)
 : rclcpp::Node("crop_box_filter", node_options)
 {
@@ -42,6 +58,9 @@ CropBoxFilter::CropBoxFilter(const rclcpp::NodeOptions & node_options)
   }
 
   max_queue_size_ = static_cast<int64_t>(declare_parameter("max_queue_size", 5));
+  process_latest_only_ = declare_parameter<bool>("process_latest_only", true);
+  use_loaned_message_ = declare_parameter<bool>("use_loaned_message", false);
+  use_intra_process_ = this->get_node_options().use_intra_process_comms();
 
   // get transform info for pointcloud
   {
@@ -100,6 +119,8 @@ CropBoxFilter::CropBoxFilter(const rclcpp::NodeOptions & node_options)
     if (tf_input_frame_.empty()) {
       throw std::invalid_argument("Crop box requires non-empty input_frame");
     }
+    declare_additional_regions();
+    update_regions();
   }
   // set output pointcloud publisher
   {
@@ -127,33 +148,41 @@ CropBoxFilter::CropBoxFilter(const rclcpp::NodeOptions & node_options)
   // set input pointcloud callback
   {
     sub_input_ = this->create_subscription<PointCloud2>(
-      "input", rclcpp::SensorDataQoS().keep_last(max_queue_size_),
+      "input",
+      rclcpp::SensorDataQoS().keep_last(
+        autoware::point_types::input_queue_depth(process_latest_only_, max_queue_size_)),
       std::bind(&CropBoxFilter::pointcloud_callback, this, std::placeholders::_1));
   }
 
+  if (use_loaned_message_ && !pub_output_->can_loan_messages()) {
+    RCLCPP_WARN(
+      this->get_logger(),
+      "use_loaned_message is set but the RMW cannot loan PointCloud2 messages. The output "
+      "buffer is reused across callbacks instead.");
+  }
+
   RCLCPP_DEBUG(this->get_logger(), "[Filter Constructor] successfully created.");
 }
 
-void CropBoxFilter::filter_pointcloud(const PointCloud2ConstPtr & cloud, PointCloud2 & output)
+template <typename LayoutT>
+size_t CropBoxFilter::filter_points(
+  const PointCloud2 & cloud, const LayoutT & layout, PointCloud2 & output, int & skipped_count)
 {
-  int x_offset = cloud->fields[pcl::getFieldIndex(*cloud, "x")].offset;
-  int y_offset = cloud->fields[pcl::getFieldIndex(*cloud, "y")].offset;
-  int z_offset = cloud->fields[pcl::getFieldIndex(*cloud, "z")].offset;
-
-  output.data.resize(cloud->data.size());
+  const size_t point_step = layout.point_step;
+  const size_t x_offset = layout.x_offset;
+  const size_t y_offset = layout.y_offset;
+  const size_t z_offset = layout.z_offset;
   size_t output_size = 0;
 
-  int skipped_count = 0;
-
   // pointcloud processing loop
-  for (size_t global_offset = 0; global_offset + cloud->point_step <= cloud->data.size();
-       global_offset += cloud->point_step) {
+  for (size_t global_offset = 0; global_offset + point_step <= cloud.data.size();
+       global_offset += point_step) {
     // extract point data from point cloud data buffer
     Eigen::Vector4f point;
 
-    std::memcpy(&point[0], &cloud->data[global_offset + x_offset], sizeof(float));
-    std::memcpy(&point[1], &cloud->data[global_offset + y_offset], sizeof(float));
-    std::memcpy(&point[2], &cloud->data[global_offset + z_offset], sizeof(float));
+    std::memcpy(&point[0], &cloud.data[global_offset + x_offset], sizeof(float));
+    std::memcpy(&point[1], &cloud.data[global_offset + y_offset], sizeof(float));
+    std::memcpy(&point[2], &cloud.data[global_offset + z_offset], sizeof(float));
     point[3] = 1;
 
     if (!std::isfinite(point[0]) || !std::isfinite(point[1]) || !std::isfinite(point[2])) {
@@ -169,22 +198,18 @@ void CropBoxFilter::filter_pointcloud(const PointCloud2ConstPtr & cloud, PointCl
       point_preprocessed = eigen_transform_preprocess_ * point;
     }
 
-    bool point_is_inside =
-      point_preprocessed[2] > param_.min_z && point_preprocessed[2] < param_.max_z &&
-      point_preprocessed[1] > param_.min_y && point_preprocessed[1] < param_.max_y &&
-      point_preprocessed[0] > param_.min_x && point_preprocessed[0] < param_.max_x;
-    if ((!param_.negative && point_is_inside) || (param_.negative && !point_is_inside)) {
+    if (regions_.is_kept(point_preprocessed[0], point_preprocessed[1], point_preprocessed[2])) {
       // apply post-transform if needed
       if (need_postprocess_transform_) {
         Eigen::Vector4f point_postprocessed = eigen_transform_postprocess_ * point_preprocessed;
 
-        memcpy(&output.data[output_size], &cloud->data[global_offset], cloud->point_step);
+        memcpy(&output.data[output_size], &cloud.data[global_offset], point_step);
 
         std::memcpy(&output.data[output_size + x_offset], &point_postprocessed[0], sizeof(float));
         std::memcpy(&output.data[output_size + y_offset], &point_postprocessed[1], sizeof(float));
         std::memcpy(&output.data[output_size + z_offset], &point_postprocessed[2], sizeof(float));
       } else {
-        memcpy(&output.data[output_size], &cloud->data[global_offset], cloud->point_step);
+        memcpy(&output.data[output_size], &cloud.data[global_offset], point_step);
 
         if (need_preprocess_transform_) {
           std::memcpy(&output.data[output_size + x_offset], &point_preprocessed[0], sizeof(float));
@@ -192,9 +217,38 @@ void CropBoxFilter::filter_pointcloud(const PointCloud2ConstPtr & cloud, PointCl
           std::memcpy(&output.data[output_size + z_offset], &point_preprocessed[2], sizeof(float));
         }
       }
-      output_size += cloud->point_step;
+      output_size += point_step;
     }
   }
+  return output_size;
+}
+
+void CropBoxFilter::filter_pointcloud(const PointCloud2ConstPtr & cloud, PointCloud2 & output)
+{
+  using autoware::point_types::PointLayout;
+
+  output.data.resize(cloud->data.size());
+  size_t output_size = 0;
+
+  int skipped_count = 0;
+
+  // The known layouts have their point step and offsets fixed at compile time, so that the loop
+  // is specialized for them. Other point steps, like padded points, use the offsets of the fields.
+  if (
+    cloud->point_step == PointLayout<PointXYZIRCAEDT>::point_step &&
+    autoware::point_types::is_data_layout_compatible<PointXYZIRCAEDT>(*cloud)) {
+    output_size = filter_points(*cloud, PointLayout<PointXYZIRCAEDT>{}, output, skipped_count);
+  } else if (
+    cloud->point_step == PointLayout<PointXYZIRC>::point_step &&
+    autoware::point_types::is_data_layout_compatible<PointXYZIRC>(*cloud)) {
+    output_size = filter_points(*cloud, PointLayout<PointXYZIRC>{}, output, skipped_count);
+  } else {
+    const RuntimeLayout layout{
+      cloud->point_step, cloud->fields[pcl::getFieldIndex(*cloud, "x")].offset,
+      cloud->fields[pcl::getFieldIndex(*cloud, "y")].offset,
+      cloud->fields[pcl::getFieldIndex(*cloud, "z")].offset};
+    output_size = filter_points(*cloud, layout, output, skipped_count);
+  }
 
   if (skipped_count > 0) {
     RCLCPP_WARN_THROTTLE(
@@ -234,12 +288,18 @@ void CropBoxFilter::pointcloud_callback(const PointCloud2ConstPtr cloud)
   // pointcloud check finished
 
   // pointcloud processing
-  auto output = PointCloud2();
-
   std::scoped_lock lock(mutex_);
   stop_watch_ptr_->toc("processing_time", true);
+  stage_latency_.enter(cloud->header.stamp, this->get_clock()->now().nanoseconds());
 
   // filtering
+  // A loaned message is written in place in the middleware memory. Otherwise the output buffer
+  // keeps its capacity across callbacks, so steady-state frames do not reallocate it.
+  std::optional<rclcpp::LoanedMessage<PointCloud2>> loaned_output;
+  if (use_loaned_message_ && pub_output_->can_loan_messages()) {
+    loaned_output.emplace(pub_output_->borrow_loaned_message());
+  }
+  PointCloud2 & output = loaned_output ? loaned_output->get() : output_buffer_;
   filter_pointcloud(cloud, output);
 
   // publish polygon if subscribers exist
@@ -256,17 +316,21 @@ void CropBoxFilter::pointcloud_callback(const PointCloud2ConstPtr cloud)
     debug_publisher_->publish<autoware_internal_debug_msgs::msg::Float64Stamped>(
       "debug/processing_time_ms", processing_time_ms);
 
-    auto pipeline_latency_ms =
-      std::chrono::duration<double, std::milli>(
-        std::chrono::nanoseconds((this->get_clock()->now() - cloud->header.stamp).nanoseconds()))
-        .count();
-
+    stage_latency_.exit();
     debug_publisher_->publish<autoware_internal_debug_msgs::msg::Float64Stamped>(
-      "debug/pipeline_latency_ms", pipeline_latency_ms);
+      "debug/pipeline_latency_ms", stage_latency_.end_to_end_latency_ms());
   }
 
   // publish result pointcloud
-  pub_output_->publish(std::move(output));
+  if (loaned_output) {
+    pub_output_->publish(std::move(*loaned_output));
+  } else if (use_intra_process_) {
+    // hand the buffer over to the subscribers in the same process, a const reference would be
+    // copied for them
+    pub_output_->publish(std::make_unique<PointCloud2>(std::move(output_buffer_)));
+  } else {
+    pub_output_->publish(output_buffer_);
+  }
   published_time_publisher_->publish_if_subscribed(pub_output_, cloud->header.stamp);
 }
 
@@ -321,6 +385,53 @@ void CropBoxFilter::publish_crop_box_polygon()
   crop_box_polygon_pub_->publish(polygon_msg);
 }
 
+void CropBoxFilter::declare_additional_regions()
+{
+  const auto region_names =
+    declare_parameter<std::vector<std::string>>("additional_regions", std::vector<std::string>{});
+
+  for (const auto & name : region_names) {
+    const auto type = declare_parameter<std::string>(name + ".type");
+    const bool negative = declare_parameter<bool>(name + ".negative");
+    const auto min_z = static_cast<float>(declare_parameter<double>(name + ".min_z"));
+    const auto max_z = static_cast<float>(declare_parameter<double>(name + ".max_z"));
+
+    if (type == "box") {
+      const auto min_x = static_cast<float>(declare_parameter<double>(name + ".min_x"));
+      const auto max_x = static_cast<float>(declare_parameter<double>(name + ".max_x"));
+      const auto min_y = static_cast<float>(declare_parameter<double>(name + ".min_y"));
+      const auto max_y = static_cast<float>(declare_parameter<double>(name + ".max_y"));
+      additional_regions_.add_box(min_x, max_x, min_y, max_y, min_z, max_z, negative);
+    } else if (type == "prism") {
+      // polygon is given as [x0, y0, x1, y1, ...]
+      const auto coordinates = declare_parameter<std::vector<double>>(name + ".polygon");
+      if (coordinates.size() % 2 != 0) {
+        throw std::invalid_argument(
+          "Crop region " + name + " requires an even number of polygon coordinates");
+      }
+      std::vector<Eigen::Vector2f> polygon;
+      polygon.reserve(coordinates.size() / 2);
+      for (size_t i = 0; i + 1 < coordinates.size(); i += 2) {
+        polygon.emplace_back(
+          static_cast<float>(coordinates[i]), static_cast<float>(coordinates[i + 1]));
+      }
+      additional_regions_.add_prism(polygon, min_z, max_z, negative);
+    } else {
+      throw std::invalid_argument(
+        "Crop region " + name + " has unknown type " + type + ", expected box or prism");
+    }
+  }
+}
+
+void CropBoxFilter::update_regions()
+{
+  regions_.clear();
+  regions_.add_box(
+    param_.min_x, param_.max_x, param_.min_y, param_.max_y, param_.min_z, param_.max_z,
+    param_.negative);
+  regions_.append(additional_regions_);
+}
+
 // update parameters dynamicly
 rcl_interfaces::msg::SetParametersResult CropBoxFilter::param_callback(
   const std::vector<rclcpp::Parameter> & p)
@@ -339,6 +450,7 @@ rcl_interfaces::msg::SetParametersResult CropBoxFilter::param_callback(
     get_param(p, "negative", new_param.negative) ? new_param.negative : param_.negative;
 
   param_ = new_param;
+  update_regions();
 
   rcl_interfaces::msg::SetParametersResult result;
   result.successful = true;
@@ -347,214 +459,25 @@ rcl_interfaces::msg::SetParametersResult CropBoxFilter::param_callback(
   return result;
 }
 
-bool CropBoxFilter::is_data_layout_compatible_with_point_xyzi(const PointCloud2 & input)
-{
-  using PointIndex = autoware::point_types::PointXYZIIndex;
-  using autoware::point_types::PointXYZI;
-  if (input.fields.size() < 4) {
-    return false;
-  }
-  bool same_layout = true;
-  const auto & field_x = input.fields.at(static_cast<size_t>(PointIndex::X));
-  same_layout &= field_x.name == "x";
-  same_layout &= field_x.offset == offsetof(PointXYZI, x);
-  same_layout &= field_x.datatype == sensor_msgs::msg::PointField::FLOAT32;
-  same_layout &= field_x.count == 1;
-  const auto & field_y = input.fields.at(static_cast<size_t>(PointIndex::Y));
-  same_layout &= field_y.name == "y";
-  same_layout &= field_y.offset == offsetof(PointXYZI, y);
-  same_layout &= field_y.datatype == sensor_msgs::msg::PointField::FLOAT32;
-  same_layout &= field_y.count == 1;
-  const auto & field_z = input.fields.at(static_cast<size_t>(PointIndex::Z));
-  same_layout &= field_z.name == "z";
-  same_layout &= field_z.offset == offsetof(PointXYZI, z);
-  same_layout &= field_z.datatype == sensor_msgs::msg::PointField::FLOAT32;
-  same_layout &= field_z.count == 1;
-  const auto & field_intensity = input.fields.at(static_cast<size_t>(PointIndex::Intensity));
-  same_layout &= field_intensity.name == "intensity";
-  same_layout &= field_intensity.offset == offsetof(PointXYZI, intensity);
-  same_layout &= field_intensity.datatype == sensor_msgs::msg::PointField::FLOAT32;
-  same_layout &= field_intensity.count == 1;
-  return same_layout;
-}
-
-bool CropBoxFilter::is_data_layout_compatible_with_point_xyzirc(const PointCloud2 & input)
-{
-  using PointIndex = autoware::point_types::PointXYZIRCIndex;
-  using autoware::point_types::PointXYZIRC;
-  if (input.fields.size() < 6) {
-    return false;
-  }
-  bool same_layout = true;
-  const auto & field_x = input.fields.at(static_cast<size_t>(PointIndex::X));
-  same_layout &= field_x.name == "x";
-  same_layout &= field_x.offset == offsetof(PointXYZIRC, x);
-  same_layout &= field_x.datatype == sensor_msgs::msg::PointField::FLOAT32;
-  same_layout &= field_x.count == 1;
-  const auto & field_y = input.fields.at(static_cast<size_t>(PointIndex::Y));
-  same_layout &= field_y.name == "y";
-  same_layout &= field_y.offset == offsetof(PointXYZIRC, y);
-  same_layout &= field_y.datatype == sensor_msgs::msg::PointField::FLOAT32;
-  same_layout &= field_y.count == 1;
-  const auto & field_z = input.fields.at(static_cast<size_t>(PointIndex::Z));
-  same_layout &= field_z.name == "z";
-  same_layout &= field_z.offset == offsetof(PointXYZIRC, z);
-  same_layout &= field_z.datatype == sensor_msgs::msg::PointField::FLOAT32;
-  same_layout &= field_z.count == 1;
-  const auto & field_intensity = input.fields.at(static_cast<size_t>(PointIndex::Intensity));
-  same_layout &= field_intensity.name == "intensity";
-  same_layout &= field_intensity.offset == offsetof(PointXYZIRC, intensity);
-  same_layout &= field_intensity.datatype == sensor_msgs::msg::PointField::UINT8;
-  same_layout &= field_intensity.count == 1;
-  const auto & field_return_type = input.fields.at(static_cast<size_t>(PointIndex::ReturnType));
-  same_layout &= field_return_type.name == "return_type";
-  same_layout &= field_return_type.offset == offsetof(PointXYZIRC, return_type);
-  same_layout &= field_return_type.datatype == sensor_msgs::msg::PointField::UINT8;
-  same_layout &= field_return_type.count == 1;
-  const auto & field_ring = input.fields.at(static_cast<size_t>(PointIndex::Channel));
-  same_layout &= field_ring.name == "channel";
-  same_layout &= field_ring.offset == offsetof(PointXYZIRC, channel);
-  same_layout &= field_ring.datatype == sensor_msgs::msg::PointField::UINT16;
-  same_layout &= field_ring.count == 1;
-
-  return same_layout;
-}
-
-bool CropBoxFilter::is_data_layout_compatible_with_point_xyziradrt(const PointCloud2 & input)
-{
-  using PointIndex = autoware::point_types::PointXYZIRADRTIndex;
-  using autoware::point_types::PointXYZIRADRT;
-  if (input.fields.size() < 9) {
-    return false;
-  }
-  bool same_layout = true;
-  const auto & field_x = input.fields.at(static_cast<size_t>(PointIndex::X));
-  same_layout &= field_x.name == "x";
-  same_layout &= field_x.offset == offsetof(PointXYZIRADRT, x);
-  same_layout &= field_x.datatype == sensor_msgs::msg::PointField::FLOAT32;
-  same_layout &= field_x.count == 1;
-  const auto & field_y = input.fields.at(static_cast<size_t>(PointIndex::Y));
-  same_layout &= field_y.name == "y";
-  same_layout &= field_y.offset == offsetof(PointXYZIRADRT, y);
-  same_layout &= field_y.datatype == sensor_msgs::msg::PointField::FLOAT32;
-  same_layout &= field_y.count == 1;
-  const auto & field_z = input.fields.at(static_cast<size_t>(PointIndex::Z));
-  same_layout &= field_z.name == "z";
-  same_layout &= field_z.offset == offsetof(PointXYZIRADRT, z);
-  same_layout &= field_z.datatype == sensor_msgs::msg::PointField::FLOAT32;
-  same_layout &= field_z.count == 1;
-  const auto & field_intensity = input.fields.at(static_cast<size_t>(PointIndex::Intensity));
-  same_layout &= field_intensity.name == "intensity";
-  same_layout &= field_intensity.offset == offsetof(PointXYZIRADRT, intensity);
-  same_layout &= field_intensity.datatype == sensor_msgs::msg::PointField::FLOAT32;
-  same_layout &= field_intensity.count == 1;
-  const auto & field_ring = input.fields.at(static_cast<size_t>(PointIndex::Ring));
-  same_layout &= field_ring.name == "ring";
-  same_layout &= field_ring.offset == offsetof(PointXYZIRADRT, ring);
-  same_layout &= field_ring.datatype == sensor_msgs::msg::PointField::UINT16;
-  same_layout &= field_ring.count == 1;
-  const auto & field_azimuth = input.fields.at(static_cast<size_t>(PointIndex::Azimuth));
-  same_layout &= field_azimuth.name == "azimuth";
-  same_layout &= field_azimuth.offset == offsetof(PointXYZIRADRT, azimuth);
-  same_layout &= field_azimuth.datatype == sensor_msgs::msg::PointField::FLOAT32;
-  same_layout &= field_azimuth.count == 1;
-  const auto & field_distance = input.fields.at(static_cast<size_t>(PointIndex::Distance));
-  same_layout &= field_distance.name == "distance";
-  same_layout &= field_distance.offset == offsetof(PointXYZIRADRT, distance);
-  same_layout &= field_distance.datatype == sensor_msgs::msg::PointField::FLOAT32;
-  same_layout &= field_distance.count == 1;
-  const auto & field_return_type = input.fields.at(static_cast<size_t>(PointIndex::ReturnType));
-  same_layout &= field_return_type.name == "return_type";
-  same_layout &= field_return_type.offset == offsetof(PointXYZIRADRT, return_type);
-  same_layout &= field_return_type.datatype == sensor_msgs::msg::PointField::UINT8;
-  same_layout &= field_return_type.count == 1;
-  const auto & field_time_stamp = input.fields.at(static_cast<size_t>(PointIndex::TimeStamp));
-  same_layout &= field_time_stamp.name == "time_stamp";
-  same_layout &= field_time_stamp.offset == offsetof(PointXYZIRADRT, time_stamp);
-  same_layout &= field_time_stamp.datatype == sensor_msgs::msg::PointField::FLOAT64;
-  same_layout &= field_time_stamp.count == 1;
-  return same_layout;
-}
-
-bool CropBoxFilter::is_data_layout_compatible_with_point_xyzircaedt(const PointCloud2 & input)
-{
-  using PointIndex = autoware::point_types::PointXYZIRCAEDTIndex;
-  using autoware::point_types::PointXYZIRCAEDT;
-  if (input.fields.size() != 10) {
-    return false;
-  }
-  bool same_layout = true;
-  const auto & field_x = input.fields.at(static_cast<size_t>(PointIndex::X));
-  same_layout &= field_x.name == "x";
-  same_layout &= field_x.offset == offsetof(PointXYZIRCAEDT, x);
-  same_layout &= field_x.datatype == sensor_msgs::msg::PointField::FLOAT32;
-  same_layout &= field_x.count == 1;
-  const auto & field_y = input.fields.at(static_cast<size_t>(PointIndex::Y));
-  same_layout &= field_y.name == "y";
-  same_layout &= field_y.offset == offsetof(PointXYZIRCAEDT, y);
-  same_layout &= field_y.datatype == sensor_msgs::msg::PointField::FLOAT32;
-  same_layout &= field_y.count == 1;
-  const auto & field_z = input.fields.at(static_cast<size_t>(PointIndex::Z));
-  same_layout &= field_z.name == "z";
-  same_layout &= field_z.offset == offsetof(PointXYZIRCAEDT, z);
-  same_layout &= field_z.datatype == sensor_msgs::msg::PointField::FLOAT32;
-  same_layout &= field_z.count == 1;
-  const auto & field_intensity = input.fields.at(static_cast<size_t>(PointIndex::Intensity));
-  same_layout &= field_intensity.name == "intensity";
-  same_layout &= field_intensity.offset == offsetof(PointXYZIRCAEDT, intensity);
-  same_layout &= field_intensity.datatype == sensor_msgs::msg::PointField::UINT8;
-  same_layout &= field_intensity.count == 1;
-  const auto & field_return_type = input.fields.at(static_cast<size_t>(PointIndex::ReturnType));
-  same_layout &= field_return_type.name == "return_type";
-  same_layout &= field_return_type.offset == offsetof(PointXYZIRCAEDT, return_type);
-  same_layout &= field_return_type.datatype == sensor_msgs::msg::PointField::UINT8;
-  same_layout &= field_return_type.count == 1;
-  const auto & field_ring = input.fields.at(static_cast<size_t>(PointIndex::Channel));
-  same_layout &= field_ring.name == "channel";
-  same_layout &= field_ring.offset == offsetof(PointXYZIRCAEDT, channel);
-  same_layout &= field_ring.datatype == sensor_msgs::msg::PointField::UINT16;
-  same_layout &= field_ring.count == 1;
-  const auto & field_azimuth = input.fields.at(static_cast<size_t>(PointIndex::Azimuth));
-  same_layout &= field_azimuth.name == "azimuth";
-  same_layout &= field_azimuth.offset == offsetof(PointXYZIRCAEDT, azimuth);
-  same_layout &= field_azimuth.datatype == sensor_msgs::msg::PointField::FLOAT32;
-  same_layout &= field_azimuth.count == 1;
-  const auto & field_elevation = input.fields.at(static_cast<size_t>(PointIndex::Elevation));
-  same_layout &= field_elevation.name == "elevation";
-  same_layout &= field_elevation.offset == offsetof(PointXYZIRCAEDT, elevation);
-  same_layout &= field_elevation.datatype == sensor_msgs::msg::PointField::FLOAT32;
-  same_layout &= field_elevation.count == 1;
-  const auto & field_distance = input.fields.at(static_cast<size_t>(PointIndex::Distance));
-  same_layout &= field_distance.name == "distance";
-  same_layout &= field_distance.offset == offsetof(PointXYZIRCAEDT, distance);
-  same_layout &= field_distance.datatype == sensor_msgs::msg::PointField::FLOAT32;
-  same_layout &= field_distance.count == 1;
-  const auto & field_time_stamp = input.fields.at(static_cast<size_t>(PointIndex::TimeStamp));
-  same_layout &= field_time_stamp.name == "time_stamp";
-  same_layout &= field_time_stamp.offset == offsetof(PointXYZIRCAEDT, time_stamp);
-  same_layout &= field_time_stamp.datatype == sensor_msgs::msg::PointField::UINT32;
-  same_layout &= field_time_stamp.count == 1;
-  return same_layout;
-}
-
 bool CropBoxFilter::is_valid(const PointCloud2ConstPtr & cloud)
 {
   // firstly check the fields of the point cloud
+  using autoware::point_types::is_data_layout_compatible;
   if (
-    !is_data_layout_compatible_with_point_xyzircaedt(*cloud) &&
-    !is_data_layout_compatible_with_point_xyzirc(*cloud)) {
+    !is_data_layout_compatible<PointXYZIRCAEDT>(*cloud) &&
+    !is_data_layout_compatible<PointXYZIRC>(*cloud)) {
     RCLCPP_ERROR(
       get_logger(),
       "The pointcloud layout is not compatible with PointXYZIRCAEDT or PointXYZIRC. Aborting");
 
-    if (is_data_layout_compatible_with_point_xyziradrt(*cloud)) {
+    if (is_data_layout_compatible<autoware::point_types::PointXYZIRADRT>(*cloud)) {
       RCLCPP_ERROR(
         get_logger(),
         "The pointcloud layout is compatible with PointXYZIRADRT. You may be using legacy "
         "code/data");
     }
 
-    if (is_data_layout_compatible_with_point_xyzi(*cloud)) {
+    if (is_data_layout_compatible<autoware::point_types::PointXYZI>(*cloud)) {
       RCLCPP_ERROR(
         get_logger(),
         "The pointcloud layout is compatible with PointXYZI. You may be using legacy "
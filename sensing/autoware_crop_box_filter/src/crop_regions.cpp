@@ -0,0 +1,117 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/crop_box_filter/crop_regions.hpp"
+
+#include <stdexcept>
+#include <vector>
+
+namespace autoware::crop_box_filter
+{
+
+void CropRegions::clear()
+{
+  a_.clear();
+  b_.clear();
+  c_.clear();
+  regions_.clear();
+}
+
+void CropRegions::add_half_plane(float a, float b, float c)
+{
+  a_.push_back(a);
+  b_.push_back(b);
+  c_.push_back(c);
+}
+
+void CropRegions::add_box(
+  float min_x, float max_x, float min_y, float max_y, float min_z, float max_z, bool negative)
+{
+  Region region{};
+  region.plane_begin = static_cast<uint32_t>(a_.size());
+  // x < max_x, -x < -min_x, y < max_y, -y < -min_y. The zero coefficients keep the comparisons
+  // exact, so the result is the same as comparing the coordinates directly.
+  add_half_plane(1.0f, 0.0f, max_x);
+  add_half_plane(-1.0f, 0.0f, -min_x);
+  add_half_plane(0.0f, 1.0f, max_y);
+  add_half_plane(0.0f, -1.0f, -min_y);
+  region.plane_end = static_cast<uint32_t>(a_.size());
+  region.min_z = min_z;
+  region.max_z = max_z;
+  region.negative = negative;
+  regions_.push_back(region);
+}
+
+void CropRegions::add_prism(
+  const std::vector<Eigen::Vector2f> & polygon, float min_z, float max_z, bool negative)
+{
+  const size_t n = polygon.size();
+  if (n < 3) {
+    throw std::invalid_argument("Crop prism requires a polygon with at least 3 vertices");
+  }
+
+  // the sign of the area gives the winding order
+  double area = 0.0;
+  for (size_t i = 0; i < n; ++i) {
+    const auto & p = polygon[i];
+    const auto & q = polygon[(i + 1) % n];
+    area += static_cast<double>(p.x()) * q.y() - static_cast<double>(q.x()) * p.y();
+  }
+  if (area == 0.0) {
+    throw std::invalid_argument("Crop prism polygon has zero area");
+  }
+  const float orientation = area > 0.0 ? 1.0f : -1.0f;
+
+  for (size_t i = 0; i < n; ++i) {
+    const Eigen::Vector2f edge = polygon[(i + 1) % n] - polygon[i];
+    const Eigen::Vector2f next_edge = polygon[(i + 2) % n] - polygon[(i + 1) % n];
+    if (edge.squaredNorm() == 0.0f) {
+      throw std::invalid_argument("Crop prism polygon has duplicated vertices");
+    }
+    const float turn = edge.x() * next_edge.y() - edge.y() * next_edge.x();
+    if (turn * orientation < 0.0f) {
+      throw std::invalid_argument("Crop prism polygon must be convex");
+    }
+  }
+
+  Region region{};
+  region.plane_begin = static_cast<uint32_t>(a_.size());
+  for (size_t i = 0; i < n; ++i) {
+    // inside is on the left of each edge for a counter-clockwise polygon:
+    // edge.x * (y - v.y) - edge.y * (x - v.x) > 0
+    const Eigen::Vector2f & v = polygon[i];
+    const Eigen::Vector2f edge = (polygon[(i + 1) % n] - v) * orientation;
+    add_half_plane(edge.y(), -edge.x(), edge.y() * v.x() - edge.x() * v.y());
+  }
+  region.plane_end = static_cast<uint32_t>(a_.size());
+  region.min_z = min_z;
+  region.max_z = max_z;
+  region.negative = negative;
+  regions_.push_back(region);
+}
+
+void CropRegions::append(const CropRegions & other)
+{
+  const auto offset = static_cast<uint32_t>(a_.size());
+  a_.insert(a_.end(), other.a_.begin(), other.a_.end());
+  b_.insert(b_.end(), other.b_.begin(), other.b_.end());
+  c_.insert(c_.end(), other.c_.begin(), other.c_.end());
+  for (auto region : other.regions_) {
+    region.plane_begin += offset;
+    region.plane_end += offset;
+    regions_.push_back(region);
+  }
+}
+
+}  // namespace autoware::crop_box_filter
@@ -18,12 +18,15 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <cstring>
 #include <memory>
+#include <string>
+#include <thread>
+#include <vector>
 
 TEST(CropBoxFilterTest, checkOutputPointcloud)
 {
-  rclcpp::init(0, nullptr);
-
   // prepare parameters for the node
   const double min_x = -5.0;
   const double max_x = 5.0;
@@ -99,8 +102,216 @@ TEST(CropBoxFilterTest, checkOutputPointcloud)
   }
 }
 
+TEST(CropBoxFilterTest, checkPointXYZIRCLayout)
+{
+  using autoware::point_types::PointLayout;
+  using autoware::point_types::PointXYZIRC;
+
+  rclcpp::NodeOptions node_options;
+  node_options.parameter_overrides({
+    {"min_x", -5.0},
+    {"min_y", -5.0},
+    {"min_z", -5.0},
+    {"max_x", 5.0},
+    {"max_y", 5.0},
+    {"max_z", 5.0},
+    {"negative", false},
+    {"input_pointcloud_frame", "base_link"},
+    {"input_frame", "base_link"},
+    {"output_frame", "base_link"},
+  });
+  autoware::crop_box_filter::CropBoxFilter node(node_options);
+
+  // the points at x = 0, 2, 4 are inside the box
+  std::vector<PointXYZIRC> points;
+  for (int i = 0; i < 5; ++i) {
+    PointXYZIRC point;
+    point.x = 2.0F * static_cast<float>(i);
+    point.intensity = static_cast<std::uint8_t>(10 * i);
+    point.channel = static_cast<std::uint16_t>(i);
+    points.push_back(point);
+  }
+
+  auto pointcloud = std::make_shared<sensor_msgs::msg::PointCloud2>();
+  pointcloud->header.frame_id = "base_link";
+  for (const auto & field_layout : PointLayout<PointXYZIRC>::fields) {
+    sensor_msgs::msg::PointField field;
+    field.name = field_layout.name;
+    field.offset = field_layout.offset;
+    field.datatype = field_layout.datatype;
+    field.count = 1;
+    pointcloud->fields.push_back(field);
+  }
+  pointcloud->height = 1;
+  pointcloud->width = points.size();
+  pointcloud->point_step = sizeof(PointXYZIRC);
+  pointcloud->row_step = pointcloud->width * pointcloud->point_step;
+  pointcloud->data.resize(pointcloud->row_step);
+  std::memcpy(pointcloud->data.data(), points.data(), pointcloud->data.size());
+
+  auto output = sensor_msgs::msg::PointCloud2();
+  node.filter_pointcloud(pointcloud, output);
+
+  const autoware::point_types::PointCloud2View<PointXYZIRC> view(output);
+  ASSERT_TRUE(view.valid());
+  ASSERT_EQ(view.size(), 3U);
+  for (size_t i = 0; i < view.size(); ++i) {
+    EXPECT_EQ(view.point(i), points[i]);
+  }
+}
+
+TEST(CropBoxFilterTest, checkAdditionalRegions)
+{
+  // keep the 10 m box, remove the ego box and keep only the triangle in front of the vehicle
+  rclcpp::NodeOptions node_options;
+  node_options.parameter_overrides({
+    {"min_x", -10.0},
+    {"max_x", 10.0},
+    {"min_y", -10.0},
+    {"max_y", 10.0},
+    {"min_z", -10.0},
+    {"max_z", 10.0},
+    {"negative", false},
+    {"input_pointcloud_frame", "base_link"},
+    {"input_frame", "base_link"},
+    {"output_frame", "base_link"},
+    {"additional_regions", std::vector<std::string>{"ego", "front"}},
+    {"ego.type", "box"},
+    {"ego.negative", true},
+    {"ego.min_x", -1.0},
+    {"ego.max_x", 3.0},
+    {"ego.min_y", -1.0},
+    {"ego.max_y", 1.0},
+    {"ego.min_z", -1.0},
+    {"ego.max_z", 2.0},
+    {"front.type", "prism"},
+    {"front.negative", false},
+    {"front.polygon", std::vector<double>{0.0, 0.0, 9.0, -9.0, 9.0, 9.0}},
+    {"front.min_z", -1.0},
+    {"front.max_z", 5.0},
+  });
+  autoware::crop_box_filter::CropBoxFilter node(node_options);
+
+  pcl::PointCloud<pcl::PointXYZ> input_pointcloud;
+  input_pointcloud.push_back(pcl::PointXYZ(5.0, 0.0, 0.0));    // kept
+  input_pointcloud.push_back(pcl::PointXYZ(8.0, -6.0, 1.0));   // kept
+  input_pointcloud.push_back(pcl::PointXYZ(1.0, 0.0, 0.0));    // inside the ego box
+  input_pointcloud.push_back(pcl::PointXYZ(4.0, 6.0, 0.0));    // outside the triangle
+  input_pointcloud.push_back(pcl::PointXYZ(-5.0, 0.0, 0.0));   // outside the triangle
+  input_pointcloud.push_back(pcl::PointXYZ(5.0, 0.0, 6.0));    // above the prism
+  input_pointcloud.push_back(pcl::PointXYZ(12.0, 0.0, 0.0));   // outside the 10 m box
+
+  sensor_msgs::msg::PointCloud2 pointcloud;
+  pcl::toROSMsg(input_pointcloud, pointcloud);
+  pointcloud.header.frame_id = "base_link";
+  const sensor_msgs::msg::PointCloud2::ConstSharedPtr pointcloud_msg =
+    std::make_shared<sensor_msgs::msg::PointCloud2>(pointcloud);
+
+  auto output = sensor_msgs::msg::PointCloud2();
+  node.filter_pointcloud(pointcloud_msg, output);
+
+  pcl::PointCloud<pcl::PointXYZ> cloud;
+  pcl::fromROSMsg(output, cloud);
+  ASSERT_EQ(cloud.size(), 2u);
+  EXPECT_FLOAT_EQ(cloud.points[0].x, 5.0);
+  EXPECT_FLOAT_EQ(cloud.points[1].x, 8.0);
+  EXPECT_FLOAT_EQ(cloud.points[1].y, -6.0);
+}
+
+TEST(CropBoxFilterTest, rejectNonConvexPrism)
+{
+  rclcpp::NodeOptions node_options;
+  node_options.parameter_overrides({
+    {"min_x", -5.0},
+    {"max_x", 5.0},
+    {"min_y", -5.0},
+    {"max_y", 5.0},
+    {"min_z", -5.0},
+    {"max_z", 5.0},
+    {"negative", true},
+    {"additional_regions", std::vector<std::string>{"concave"}},
+    {"concave.type", "prism"},
+    {"concave.negative", false},
+    {"concave.polygon", std::vector<double>{0.0, 0.0, 4.0, 0.0, 1.0, 1.0, 0.0, 4.0}},
+    {"concave.min_z", -1.0},
+    {"concave.max_z", 1.0},
+  });
+  EXPECT_THROW(
+    autoware::crop_box_filter::CropBoxFilter node(node_options), std::invalid_argument);
+}
+
+TEST(CropBoxFilterTest, checkIntraProcessZeroCopy)
+{
+  using sensor_msgs::msg::PointCloud2;
+
+  rclcpp::NodeOptions node_options;
+  node_options.use_intra_process_comms(true);
+  node_options.parameter_overrides({
+    {"min_x", -5.0},
+    {"max_x", 5.0},
+    {"min_y", -5.0},
+    {"max_y", 5.0},
+    {"min_z", -5.0},
+    {"max_z", 5.0},
+    {"negative", false},
+    {"input_pointcloud_frame", "base_link"},
+    {"input_frame", "base_link"},
+    {"output_frame", "base_link"},
+  });
+  const auto filter_node = std::make_shared<autoware::crop_box_filter::CropBoxFilter>(node_options);
+  const auto test_node = std::make_shared<rclcpp::Node>(
+    "crop_box_filter_zero_copy_test", rclcpp::NodeOptions().use_intra_process_comms(true));
+
+  // the subscriptions keep the received messages, so that their buffers are not reused
+  PointCloud2::ConstSharedPtr input_received;
+  std::vector<PointCloud2::ConstSharedPtr> outputs_received;
+  const auto input_sub = test_node->create_subscription<PointCloud2>(
+    "input", rclcpp::SensorDataQoS(),
+    [&](const PointCloud2::ConstSharedPtr msg) { input_received = msg; });
+  const auto output_sub_1 = test_node->create_subscription<PointCloud2>(
+    "output", rclcpp::SensorDataQoS(),
+    [&](const PointCloud2::ConstSharedPtr msg) { outputs_received.push_back(msg); });
+  const auto output_sub_2 = test_node->create_subscription<PointCloud2>(
+    "output", rclcpp::SensorDataQoS(),
+    [&](const PointCloud2::ConstSharedPtr msg) { outputs_received.push_back(msg); });
+  const auto pub = test_node->create_publisher<PointCloud2>("input", rclcpp::SensorDataQoS());
+
+  pcl::PointCloud<pcl::PointXYZ> input_pointcloud;
+  input_pointcloud.push_back(pcl::PointXYZ(0.5, 0.5, 0.1));
+  input_pointcloud.push_back(pcl::PointXYZ(9.5, 9.5, 9.1));
+  auto pointcloud = std::make_unique<PointCloud2>();
+  pcl::toROSMsg(input_pointcloud, *pointcloud);
+  pointcloud->header.frame_id = "base_link";
+  pointcloud->header.stamp = test_node->now();
+  const auto * input_data = pointcloud->data.data();
+  pub->publish(std::move(pointcloud));
+
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(filter_node);
+  executor.add_node(test_node);
+  const auto start = std::chrono::steady_clock::now();
+  while (outputs_received.size() < 2 &&
+         std::chrono::steady_clock::now() - start < std::chrono::seconds(5)) {
+    executor.spin_some();
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  // the input is shared by the filter and the test subscription as it was published
+  ASSERT_NE(input_received, nullptr);
+  EXPECT_EQ(input_received->data.data(), input_data);
+
+  // both the subscriptions see the one output cloud published by the filter
+  ASSERT_EQ(outputs_received.size(), 2u);
+  EXPECT_EQ(outputs_received[0].get(), outputs_received[1].get());
+  EXPECT_EQ(outputs_received[0]->data.data(), outputs_received[1]->data.data());
+  EXPECT_EQ(outputs_received[0]->width, 1u);
+}
+
 int main(int argc, char ** argv)
 {
   testing::InitGoogleTest(&argc, argv);
-  return RUN_ALL_TESTS();
+  rclcpp::init(argc, argv);
+  const int result = RUN_ALL_TESTS();
+  rclcpp::shutdown();
+  return result;
 }
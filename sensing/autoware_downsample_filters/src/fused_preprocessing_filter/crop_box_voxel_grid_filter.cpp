@@ -0,0 +1,193 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "crop_box_voxel_grid_filter.hpp"
+
+#include <pcl_conversions/pcl_conversions.h>
+
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace autoware::downsample_filters
+{
+namespace
+{
+bool is_voxel_range_valid(
+  const Eigen::Vector3f & min_point, const Eigen::Vector3f & max_point,
+  const Eigen::Vector3f & inverse_voxel_size)
+{
+  return (static_cast<std::int64_t>((max_point[0] - min_point[0]) * inverse_voxel_size[0]) + 1) *
+           (static_cast<std::int64_t>((max_point[1] - min_point[1]) * inverse_voxel_size[1]) + 1) *
+           (static_cast<std::int64_t>((max_point[2] - min_point[2]) * inverse_voxel_size[2]) + 1) <=
+         static_cast<std::int64_t>(std::numeric_limits<std::int32_t>::max());
+}
+
+Eigen::Vector3i to_voxel(const Eigen::Vector3f & point, const Eigen::Vector3f & inverse_voxel_size)
+{
+  return Eigen::Vector3i(
+    static_cast<int>(std::floor(point[0] * inverse_voxel_size[0])),
+    static_cast<int>(std::floor(point[1] * inverse_voxel_size[1])),
+    static_cast<int>(std::floor(point[2] * inverse_voxel_size[2])));
+}
+}  // namespace
+
+void CropBoxVoxelGridFilter::set_voxel_size(
+  float voxel_size_x, float voxel_size_y, float voxel_size_z)
+{
+  inverse_voxel_size_ =
+    Eigen::Array3f::Ones() / Eigen::Array3f(voxel_size_x, voxel_size_y, voxel_size_z);
+}
+
+bool CropBoxVoxelGridFilter::load_point(
+  const uint8_t * point_data, const FieldOffsets & offsets,
+  const TransformInfo & preprocess_transform, Eigen::Vector4f & point)
+{
+  std::memcpy(&point[0], point_data + offsets.x, sizeof(float));
+  std::memcpy(&point[1], point_data + offsets.y, sizeof(float));
+  std::memcpy(&point[2], point_data + offsets.z, sizeof(float));
+  point[3] = 1.0f;
+  if (!std::isfinite(point[0]) || !std::isfinite(point[1]) || !std::isfinite(point[2])) {
+    return false;
+  }
+  if (preprocess_transform.need_transform) {
+    point = preprocess_transform.eigen_transform * point;
+  }
+  return true;
+}
+
+bool CropBoxVoxelGridFilter::is_kept(const Eigen::Vector4f & point) const
+{
+  const bool point_is_inside =
+    point[2] > crop_box_.min_point[2] && point[2] < crop_box_.max_point[2] &&
+    point[1] > crop_box_.min_point[1] && point[1] < crop_box_.max_point[1] &&
+    point[0] > crop_box_.min_point[0] && point[0] < crop_box_.max_point[0];
+  return point_is_inside != crop_box_.negative;
+}
+
+bool CropBoxVoxelGridFilter::get_min_max_voxel(
+  const PointCloud2 & input, const FieldOffsets & offsets,
+  const TransformInfo & preprocess_transform, Eigen::Vector3i & min_voxel,
+  Eigen::Vector3i & max_voxel) const
+{
+  if (
+    !crop_box_.negative &&
+    is_voxel_range_valid(crop_box_.min_point, crop_box_.max_point, inverse_voxel_size_)) {
+    min_voxel = to_voxel(crop_box_.min_point, inverse_voxel_size_);
+    max_voxel = to_voxel(crop_box_.max_point, inverse_voxel_size_);
+    return true;
+  }
+
+  Eigen::Vector3f min_point = Eigen::Vector3f::Constant(FLT_MAX);
+  Eigen::Vector3f max_point = Eigen::Vector3f::Constant(-FLT_MAX);
+  bool has_kept_point = false;
+  Eigen::Vector4f point;
+  for (size_t global_offset = 0; global_offset + input.point_step <= input.data.size();
+       global_offset += input.point_step) {
+    if (
+      load_point(&input.data[global_offset], offsets, preprocess_transform, point) &&
+      is_kept(point)) {
+      min_point = min_point.cwiseMin(point.head<3>());
+      max_point = max_point.cwiseMax(point.head<3>());
+      has_kept_point = true;
+    }
+  }
+  if (!has_kept_point) {
+    min_point.setZero();
+    max_point.setZero();
+  }
+
+  if (!is_voxel_range_valid(min_point, max_point, inverse_voxel_size_)) {
+    return false;
+  }
+  min_voxel = to_voxel(min_point, inverse_voxel_size_);
+  max_voxel = to_voxel(max_point, inverse_voxel_size_);
+  return true;
+}
+
+bool CropBoxVoxelGridFilter::filter(
+  const PointCloud2 & input, PointCloud2 & output, const TransformInfo & preprocess_transform,
+  const TransformInfo & postprocess_transform, const rclcpp::Logger & logger)
+{
+  FieldOffsets offsets{};
+  offsets.x = input.fields[pcl::getFieldIndex(input, "x")].offset;
+  offsets.y = input.fields[pcl::getFieldIndex(input, "y")].offset;
+  offsets.z = input.fields[pcl::getFieldIndex(input, "z")].offset;
+  const int intensity_index = pcl::getFieldIndex(input, "intensity");
+  offsets.intensity = intensity_index >= 0 ? input.fields[intensity_index].offset : -1;
+
+  Eigen::Vector3i min_voxel, max_voxel;
+  if (!get_min_max_voxel(input, offsets, preprocess_transform, min_voxel, max_voxel)) {
+    RCLCPP_ERROR(
+      logger,
+      "Voxel size is too small for the input dataset. "
+      "Integer indices would overflow.");
+    return false;
+  }
+
+  // Compute the number of divisions needed along all axis
+  const Eigen::Vector3i div_b = max_voxel - min_voxel + Eigen::Vector3i::Ones();
+  // Set up the division multiplier
+  const Eigen::Vector3i div_b_mul(1, div_b[0], div_b[0] * div_b[1]);
+
+  // Crop, transform and accumulate in a single pass over the input buffer
+  voxel_table_.clear();
+  Eigen::Vector4f point;
+  for (size_t global_offset = 0; global_offset + input.point_step <= input.data.size();
+       global_offset += input.point_step) {
+    const uint8_t * point_data = &input.data[global_offset];
+    if (!load_point(point_data, offsets, preprocess_transform, point) || !is_kept(point)) {
+      continue;
+    }
+    const Eigen::Vector3i ijk = to_voxel(point.head<3>(), inverse_voxel_size_) - min_voxel;
+    const uint32_t voxel_id = ijk[0] * div_b_mul[0] + ijk[1] * div_b_mul[1] + ijk[2] * div_b_mul[2];
+    const float intensity =
+      offsets.intensity >= 0 ? static_cast<float>(point_data[offsets.intensity]) : 0.0f;
+    voxel_table_.add_point(voxel_id, point[0], point[1], point[2], intensity);
+  }
+
+  // Initialize the output
+  const auto & centroids = voxel_table_.centroids();
+  output.header = input.header;
+  output.height = 1;
+  output.width = centroids.size();
+  output.fields = input.fields;
+  output.is_bigendian = input.is_bigendian;
+  output.point_step = input.point_step;
+  output.row_step = output.width * output.point_step;
+  output.is_dense = true;  // we filter out invalid points
+  output.data.assign(output.row_step, 0);
+
+  // Copy the centroids to the output
+  size_t output_data_size = 0;
+  for (const auto & voxel_centroid : centroids) {
+    Eigen::Vector4f centroid = voxel_centroid.calc_centroid();
+    const float intensity = centroid[3];
+    if (postprocess_transform.need_transform) {
+      centroid[3] = 1.0f;
+      centroid = postprocess_transform.eigen_transform * centroid;
+    }
+    std::memcpy(&output.data[output_data_size + offsets.x], &centroid[0], sizeof(float));
+    std::memcpy(&output.data[output_data_size + offsets.y], &centroid[1], sizeof(float));
+    std::memcpy(&output.data[output_data_size + offsets.z], &centroid[2], sizeof(float));
+    if (offsets.intensity >= 0) {
+      output.data[output_data_size + offsets.intensity] = static_cast<uint8_t>(intensity);
+    }
+    output_data_size += output.point_step;
+  }
+  return true;
+}
+
+}  // namespace autoware::downsample_filters
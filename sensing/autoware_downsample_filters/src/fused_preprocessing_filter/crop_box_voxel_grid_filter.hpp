@@ -0,0 +1,86 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef FUSED_PREPROCESSING_FILTER__CROP_BOX_VOXEL_GRID_FILTER_HPP_
+#define FUSED_PREPROCESSING_FILTER__CROP_BOX_VOXEL_GRID_FILTER_HPP_
+
+#include "../voxel_grid_downsample_filter/transform_info.hpp"
+#include "../voxel_grid_downsample_filter/voxel_centroid_accumulator.hpp"
+
+#include <Eigen/Core>
+#include <rclcpp/rclcpp.hpp>
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+namespace autoware::downsample_filters
+{
+
+/** \brief Crop, transform and voxelize a PointCloud2 while walking the input buffer once.
+ *
+ * Every point is moved into the filtering frame with the preprocess transform, tested against
+ * the crop box and accumulated into its voxel. The centroids are moved into the output frame with
+ * the postprocess transform. No intermediate cloud is serialized. */
+class CropBoxVoxelGridFilter
+{
+  using PointCloud2 = sensor_msgs::msg::PointCloud2;
+
+public:
+  struct CropBox
+  {
+    Eigen::Vector3f min_point{Eigen::Vector3f::Zero()};
+    Eigen::Vector3f max_point{Eigen::Vector3f::Zero()};
+    /** \brief keep the points outside of the box instead of the ones inside */
+    bool negative{false};
+  };
+
+  void set_voxel_size(float voxel_size_x, float voxel_size_y, float voxel_size_z);
+  void set_crop_box(const CropBox & crop_box) { crop_box_ = crop_box; }
+
+  /** \brief Return false and leave output untouched when the voxel grid of the kept points would
+   * overflow the voxel index. */
+  bool filter(
+    const PointCloud2 & input, PointCloud2 & output, const TransformInfo & preprocess_transform,
+    const TransformInfo & postprocess_transform, const rclcpp::Logger & logger);
+
+private:
+  struct FieldOffsets
+  {
+    int x;
+    int y;
+    int z;
+    int intensity;
+  };
+
+  Eigen::Vector3f inverse_voxel_size_{Eigen::Vector3f::Ones()};
+  CropBox crop_box_;
+  OpenAddressingVoxelTable voxel_table_;
+
+  /** \brief Read a point and move it into the filtering frame. Return false for non-finite. */
+  static bool load_point(
+    const uint8_t * point_data, const FieldOffsets & offsets,
+    const TransformInfo & preprocess_transform, Eigen::Vector4f & point);
+
+  bool is_kept(const Eigen::Vector4f & point) const;
+
+  /** \brief The voxel range is given by the box itself unless the crop is negative, in which case
+   * the kept points are scanned for their bounds. */
+  bool get_min_max_voxel(
+    const PointCloud2 & input, const FieldOffsets & offsets,
+    const TransformInfo & preprocess_transform, Eigen::Vector3i & min_voxel,
+    Eigen::Vector3i & max_voxel) const;
+};
+
+}  // namespace autoware::downsample_filters
+
+#endif  // FUSED_PREPROCESSING_FILTER__CROP_BOX_VOXEL_GRID_FILTER_HPP_
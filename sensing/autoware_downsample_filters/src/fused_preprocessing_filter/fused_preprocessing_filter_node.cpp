@@ -0,0 +1,179 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "fused_preprocessing_filter_node.hpp"
+
+#include "../voxel_grid_downsample_filter/memory.hpp"
+
+#include <tf2_eigen/tf2_eigen.hpp>
+
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace autoware::downsample_filters
+{
+FusedPreprocessingFilter::FusedPreprocessingFilter(const rclcpp::NodeOptions & options)
+: rclcpp::Node("fused_preprocessing_filter", options),
+  tf_input_frame_(declare_parameter<std::string>("input_frame")),
+  tf_output_frame_(declare_parameter<std::string>("output_frame")),
+  max_queue_size_(static_cast<std::size_t>(declare_parameter<int64_t>("max_queue_size"))),
+  process_latest_only_(declare_parameter<bool>("process_latest_only"))
+{
+  if (tf_input_frame_.empty()) {
+    throw std::invalid_argument("Fused preprocessing filter requires non-empty input_frame");
+  }
+
+  filter_.set_voxel_size(
+    static_cast<float>(declare_parameter<double>("voxel_size_x")),
+    static_cast<float>(declare_parameter<double>("voxel_size_y")),
+    static_cast<float>(declare_parameter<double>("voxel_size_z")));
+
+  CropBoxVoxelGridFilter::CropBox crop_box;
+  crop_box.min_point = Eigen::Vector3f(
+    static_cast<float>(declare_parameter<double>("min_x")),
+    static_cast<float>(declare_parameter<double>("min_y")),
+    static_cast<float>(declare_parameter<double>("min_z")));
+  crop_box.max_point = Eigen::Vector3f(
+    static_cast<float>(declare_parameter<double>("max_x")),
+    static_cast<float>(declare_parameter<double>("max_y")),
+    static_cast<float>(declare_parameter<double>("max_z")));
+  crop_box.negative = declare_parameter<bool>("negative");
+  filter_.set_crop_box(crop_box);
+
+  // initialize debug tool
+  {
+    using autoware_utils_debug::DebugPublisher;
+    using autoware_utils_system::StopWatch;
+    stop_watch_ptr_ = std::make_unique<StopWatch<std::chrono::milliseconds>>();
+    debug_publisher_ = std::make_unique<DebugPublisher>(this, this->get_name());
+    stop_watch_ptr_->tic("processing_time");
+
+    published_time_publisher_ =
+      std::make_unique<autoware_utils_debug::PublishedTimePublisher>(this);
+  }
+
+  // Set publishers
+  {
+    rclcpp::PublisherOptions pub_options;
+    pub_options.qos_overriding_options = rclcpp::QosOverridingOptions::with_default_policies();
+    pub_output_ = this->create_publisher<PointCloud2>(
+      "output", rclcpp::SensorDataQoS().keep_last(max_queue_size_), pub_options);
+  }
+
+  // Set subscribers
+  {
+    sub_input_ = create_subscription<PointCloud2>(
+      "input",
+      rclcpp::SensorDataQoS().keep_last(
+        autoware::point_types::input_queue_depth(process_latest_only_, max_queue_size_)),
+      std::bind(&FusedPreprocessingFilter::input_callback, this, std::placeholders::_1));
+    transform_listener_ = std::make_unique<autoware_utils_tf::TransformListener>(this);
+  }
+
+  RCLCPP_DEBUG(this->get_logger(), "[Filter Constructor] successfully created.");
+}
+
+void FusedPreprocessingFilter::input_callback(const PointCloud2ConstPtr cloud)
+{
+  if (!is_valid(cloud)) {
+    RCLCPP_ERROR(this->get_logger(), "[input_callback] Invalid input!");
+    return;
+  }
+  stage_latency_.enter(cloud->header.stamp, this->get_clock()->now().nanoseconds());
+
+  const std::string & output_frame =
+    tf_output_frame_.empty() ? cloud->header.frame_id : tf_output_frame_;
+
+  // Both transforms are applied per point inside the filter instead of transforming the cloud
+  TransformInfo preprocess_transform;
+  TransformInfo postprocess_transform;
+  if (
+    !calculate_transform_matrix(
+      tf_input_frame_, cloud->header.frame_id, cloud->header.stamp, preprocess_transform) ||
+    !calculate_transform_matrix(
+      output_frame, tf_input_frame_, cloud->header.stamp, postprocess_transform)) {
+    return;
+  }
+
+  auto output = std::make_unique<PointCloud2>();
+
+  std::scoped_lock lock(mutex_);
+  stop_watch_ptr_->toc("processing_time", true);
+  if (!filter_.filter(
+        *cloud, *output, preprocess_transform, postprocess_transform, this->get_logger())) {
+    return;
+  }
+  output->header.frame_id = output_frame;
+  debug_publisher_->publish<autoware_internal_debug_msgs::msg::Float64Stamped>(
+    "debug/processing_time_ms", stop_watch_ptr_->toc("processing_time", true));
+  stage_latency_.exit();
+  debug_publisher_->publish<autoware_internal_debug_msgs::msg::Float64Stamped>(
+    "debug/pipeline_latency_ms", stage_latency_.end_to_end_latency_ms());
+
+  pub_output_->publish(std::move(output));
+  published_time_publisher_->publish_if_subscribed(pub_output_, cloud->header.stamp);
+}
+
+bool FusedPreprocessingFilter::is_valid(const PointCloud2ConstPtr & cloud)
+{
+  if (cloud->width * cloud->height * cloud->point_step != cloud->data.size()) {
+    RCLCPP_WARN(
+      this->get_logger(),
+      "Invalid PointCloud (data = %zu, width = %d, height = %d, step = %d) with stamp %f, "
+      "and frame %s received!",
+      cloud->data.size(), cloud->width, cloud->height, cloud->point_step,
+      rclcpp::Time(cloud->header.stamp).seconds(), cloud->header.frame_id.c_str());
+    return false;
+  }
+
+  if (
+    !utils::is_data_layout_compatible_with_point_xyzircaedt(*cloud) &&
+    !utils::is_data_layout_compatible_with_point_xyzirc(*cloud)) {
+    RCLCPP_ERROR(
+      get_logger(),
+      "The pointcloud layout is not compatible with PointXYZIRCAEDT or PointXYZIRC. Aborting");
+    return false;
+  }
+
+  return true;
+}
+
+bool FusedPreprocessingFilter::calculate_transform_matrix(
+  const std::string & target_frame, const std::string & source_frame, const rclcpp::Time & stamp,
+  TransformInfo & transform_info)
+{
+  transform_info.need_transform = false;
+
+  if (source_frame == target_frame) return true;
+
+  auto tf_ptr = transform_listener_->get_transform(
+    target_frame, source_frame, stamp, rclcpp::Duration::from_seconds(1.0));
+
+  if (!tf_ptr) {
+    RCLCPP_ERROR(
+      this->get_logger(), "[calculate_transform_matrix] Cannot get transform from %s to %s.",
+      source_frame.c_str(), target_frame.c_str());
+    return false;
+  }
+
+  auto eigen_tf = tf2::transformToEigen(*tf_ptr);
+  transform_info.eigen_transform = eigen_tf.matrix().cast<float>();
+  transform_info.need_transform = true;
+  return true;
+}
+}  // namespace autoware::downsample_filters
+
+#include <rclcpp_components/register_node_macro.hpp>
+RCLCPP_COMPONENTS_REGISTER_NODE(autoware::downsample_filters::FusedPreprocessingFilter)
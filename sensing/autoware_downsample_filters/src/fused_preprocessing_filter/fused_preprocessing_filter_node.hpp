@@ -0,0 +1,90 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef FUSED_PREPROCESSING_FILTER__FUSED_PREPROCESSING_FILTER_NODE_HPP_
+#define FUSED_PREPROCESSING_FILTER__FUSED_PREPROCESSING_FILTER_NODE_HPP_
+
+#include "../voxel_grid_downsample_filter/transform_info.hpp"
+#include "crop_box_voxel_grid_filter.hpp"
+
+#include <autoware/point_types/pipeline_latency.hpp>
+#include <autoware_utils_debug/debug_publisher.hpp>
+#include <autoware_utils_debug/published_time_publisher.hpp>
+#include <autoware_utils_system/stop_watch.hpp>
+#include <autoware_utils_tf/transform_listener.hpp>
+#include <rclcpp/rclcpp.hpp>
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace autoware::downsample_filters
+{
+/** \brief Crop box, frame transform and voxel grid downsampling in one component, so that the
+ * sensing path does not serialize an intermediate cloud between the stages. */
+class FusedPreprocessingFilter : public rclcpp::Node
+{
+public:
+  using PointCloud2 = sensor_msgs::msg::PointCloud2;
+  using PointCloud2ConstPtr = sensor_msgs::msg::PointCloud2::ConstSharedPtr;
+
+  explicit FusedPreprocessingFilter(const rclcpp::NodeOptions & options);
+
+private:
+  /** \brief The input PointCloud2 subscriber. */
+  rclcpp::Subscription<PointCloud2>::SharedPtr sub_input_;
+
+  /** \brief The output PointCloud2 publisher. */
+  rclcpp::Publisher<PointCloud2>::SharedPtr pub_output_;
+
+  /** \brief transform listener */
+  std::unique_ptr<autoware_utils_tf::TransformListener> transform_listener_{nullptr};
+
+  /** \brief processing time publisher. **/
+  std::unique_ptr<autoware_utils_system::StopWatch<std::chrono::milliseconds>> stop_watch_ptr_;
+  std::unique_ptr<autoware_utils_debug::DebugPublisher> debug_publisher_;
+  std::unique_ptr<autoware_utils_debug::PublishedTimePublisher> published_time_publisher_;
+  autoware::point_types::StageLatency stage_latency_;
+
+  /** \brief The fused crop box and voxel grid filter, kept to reuse its buffers */
+  CropBoxVoxelGridFilter filter_;
+
+  /** \brief The TF frame in which the crop box and the voxel grid are defined. */
+  std::string tf_input_frame_;
+  /** \brief The output TF frame. The original frame of the input is used if empty. */
+  std::string tf_output_frame_;
+  /** \brief Internal mutex. */
+  std::mutex mutex_;
+  /** \brief The maximum queue size (default: 3). */
+  size_t max_queue_size_ = 3;
+  /** \brief Keep only the newest input cloud while a callback is running. */
+  bool process_latest_only_ = true;
+
+  /** \brief PointCloud2 data callback. */
+  void input_callback(const PointCloud2ConstPtr cloud);
+
+  /** \brief check if point cloud is valid */
+  bool is_valid(const PointCloud2ConstPtr & cloud);
+
+  /** \brief calculate the transform matrix from source_frame to target_frame at stamp */
+  /** \return true if transform matrix is calculated, false otherwise */
+  bool calculate_transform_matrix(
+    const std::string & target_frame, const std::string & source_frame,
+    const rclcpp::Time & stamp, TransformInfo & transform_info /*output*/);
+};
+}  // namespace autoware::downsample_filters
+
+#endif  // FUSED_PREPROCESSING_FILTER__FUSED_PREPROCESSING_FILTER_NODE_HPP_
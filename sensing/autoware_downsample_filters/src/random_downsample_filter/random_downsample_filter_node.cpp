@@ -31,8 +31,15 @@ RandomDownsampleFilter::RandomDownsampleFilter(const rclcpp::NodeOptions & optio
   tf_input_frame_(declare_parameter<std::string>("input_frame")),
   tf_output_frame_(declare_parameter<std::string>("output_frame")),
   sample_num_(static_cast<size_t>(declare_parameter<int64_t>("sample_num"))),
-  max_queue_size_(static_cast<size_t>(declare_parameter<int64_t>("max_queue_size")))
+  max_queue_size_(static_cast<size_t>(declare_parameter<int64_t>("max_queue_size"))),
+  process_latest_only_(declare_parameter<bool>("process_latest_only")),
+  sampling_method_(sampling_method_from_string(declare_parameter<std::string>("sampling_method"))),
+  sampler_(static_cast<uint64_t>(declare_parameter<int64_t>("random_seed")))
 {
+  sampler_.set_sample_num(sample_num_);
+  sampler_.set_azimuth_sectors(static_cast<size_t>(declare_parameter<int64_t>("azimuth_sectors")));
+  use_intra_process_ = this->get_node_options().use_intra_process_comms();
+
   {
     RCLCPP_DEBUG_STREAM(
       this->get_logger(),
@@ -42,6 +49,12 @@ RandomDownsampleFilter::RandomDownsampleFilter(const rclcpp::NodeOptions & optio
         << " - sample_num       : " << sample_num_);
   }
 
+  // initialize debug tool
+  {
+    debug_publisher_ =
+      std::make_unique<autoware_utils_debug::DebugPublisher>(this, this->get_name());
+  }
+
   // Set publisher
   {
     rclcpp::PublisherOptions pub_options;
@@ -56,7 +69,9 @@ RandomDownsampleFilter::RandomDownsampleFilter(const rclcpp::NodeOptions & optio
   // Set subscriber
   {
     sub_input_ = create_subscription<PointCloud2>(
-      "input", rclcpp::SensorDataQoS().keep_last(max_queue_size_),
+      "input",
+      rclcpp::SensorDataQoS().keep_last(
+        autoware::point_types::input_queue_depth(process_latest_only_, max_queue_size_)),
       std::bind(&RandomDownsampleFilter::input_callback, this, std::placeholders::_1));
     transform_listener_ = std::make_unique<autoware_utils_tf::TransformListener>(this);
   }
@@ -77,6 +92,7 @@ void RandomDownsampleFilter::input_callback(const PointCloud2ConstPtr cloud)
     "[input_callback] PointCloud with %d data points and frame %s on input topic "
     "received.",
     cloud->width * cloud->height, cloud->header.frame_id.c_str());
+  stage_latency_.enter(cloud->header.stamp, this->get_clock()->now().nanoseconds());
 
   // Check whether the user has given a different input TF frame
   tf_input_orig_frame_ = cloud->header.frame_id;
@@ -127,18 +143,53 @@ bool RandomDownsampleFilter::is_valid(const PointCloud2ConstPtr & cloud)
 
 void RandomDownsampleFilter::compute_publish(const PointCloud2ConstPtr & input)
 {
-  auto output = std::make_unique<PointCloud2>();
-  filter(input, *output);
+  std::unique_ptr<PointCloud2> output;
+  if (sampling_method_ == SamplingMethod::PCL) {
+    output = std::make_unique<PointCloud2>();
+    filter(input, *output);
+  } else {
+    filter(input, output_buffer_);
+    if (!needs_output_conversion(output_buffer_)) {
+      publish_pipeline_latency();
+      if (use_intra_process_) {
+        // hand the buffer over to the subscribers in the same process, a const reference would be
+        // copied for them
+        pub_output_->publish(std::make_unique<PointCloud2>(std::move(output_buffer_)));
+      } else {
+        // the buffer keeps its capacity, so a steady stream of clouds does not allocate
+        pub_output_->publish(output_buffer_);
+      }
+      published_time_publisher_->publish_if_subscribed(pub_output_, input->header.stamp);
+      return;
+    }
+    output = std::make_unique<PointCloud2>(output_buffer_);
+  }
   if (!convert_output_costly(output)) return;
 
   // Copy timestamp to keep it
   output->header.stamp = input->header.stamp;
 
   // Publish a boost shared ptr
+  publish_pipeline_latency();
   pub_output_->publish(std::move(output));
   published_time_publisher_->publish_if_subscribed(pub_output_, input->header.stamp);
 }
 
+void RandomDownsampleFilter::publish_pipeline_latency()
+{
+  stage_latency_.exit();
+  debug_publisher_->publish<autoware_internal_debug_msgs::msg::Float64Stamped>(
+    "debug/pipeline_latency_ms", stage_latency_.end_to_end_latency_ms());
+}
+
+bool RandomDownsampleFilter::needs_output_conversion(const PointCloud2 & output) const
+{
+  if (!tf_output_frame_.empty()) {
+    return output.header.frame_id != tf_output_frame_;
+  }
+  return output.header.frame_id != tf_input_orig_frame_;
+}
+
 bool RandomDownsampleFilter::convert_output_costly(std::unique_ptr<PointCloud2> & output)
 {
   // In terms of performance, we should avoid using pcl_ros library function,
@@ -195,6 +246,15 @@ bool RandomDownsampleFilter::convert_output_costly(std::unique_ptr<PointCloud2>
 void RandomDownsampleFilter::filter(const PointCloud2ConstPtr & input, PointCloud2 & output)
 {
   std::scoped_lock lock(mutex_);
+  if (sampling_method_ == SamplingMethod::Reservoir) {
+    sampler_.sample_reservoir(*input, output);
+    return;
+  }
+  if (sampling_method_ == SamplingMethod::AzimuthStratified) {
+    sampler_.sample_azimuth_stratified(*input, output);
+    return;
+  }
+
   pcl::PointCloud<pcl::PointXYZ>::Ptr pcl_input(new pcl::PointCloud<pcl::PointXYZ>);
   pcl::PointCloud<pcl::PointXYZ>::Ptr pcl_output(new pcl::PointCloud<pcl::PointXYZ>);
   pcl::fromROSMsg(*input, *pcl_input);
@@ -15,6 +15,9 @@
 #ifndef RANDOM_DOWNSAMPLE_FILTER__RANDOM_DOWNSAMPLE_FILTER_NODE_HPP_
 #define RANDOM_DOWNSAMPLE_FILTER__RANDOM_DOWNSAMPLE_FILTER_NODE_HPP_
 
+#include "random_point_sampler.hpp"
+
+#include <autoware/point_types/pipeline_latency.hpp>
 #include <autoware_utils_debug/debug_publisher.hpp>
 #include <autoware_utils_debug/published_time_publisher.hpp>
 #include <autoware_utils_system/stop_watch.hpp>
@@ -69,6 +72,7 @@ private:
   std::unique_ptr<autoware_utils_system::StopWatch<std::chrono::milliseconds>> stop_watch_ptr_;
   std::unique_ptr<autoware_utils_debug::DebugPublisher> debug_publisher_;
   std::unique_ptr<autoware_utils_debug::PublishedTimePublisher> published_time_publisher_;
+  autoware::point_types::StageLatency stage_latency_;
 
   /** \brief The transform listener. */
   std::unique_ptr<autoware_utils_tf::TransformListener> transform_listener_{nullptr};
@@ -81,10 +85,30 @@ private:
 
   bool convert_output_costly(std::unique_ptr<PointCloud2> & output);
 
+  /** \brief Publish the sensor to output latency of the current cloud. */
+  void publish_pipeline_latency();
+
+  /** \brief Return whether convert_output_costly() would transform the output. */
+  bool needs_output_conversion(const PointCloud2 & output) const;
+
   size_t sample_num_;
 
   /** \brief The maximum queue size (default: 3). */
   size_t max_queue_size_ = 3;
+
+  /** \brief Keep only the newest input cloud while a callback is running. */
+  bool process_latest_only_ = true;
+
+  SamplingMethod sampling_method_;
+
+  /** \brief Sampler of the direct PointCloud2 path. Its random engine persists across clouds. */
+  RandomPointSampler sampler_;
+
+  /** \brief Output buffer reused across callbacks when no output conversion is needed. */
+  PointCloud2 output_buffer_;
+
+  /** \brief Publish the output buffer without copy to the nodes of the same container. */
+  bool use_intra_process_ = false;
 };
 }  // namespace autoware::downsample_filters
 
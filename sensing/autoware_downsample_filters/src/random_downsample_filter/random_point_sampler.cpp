@@ -0,0 +1,203 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "random_point_sampler.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+namespace autoware::downsample_filters
+{
+
+SamplingMethod sampling_method_from_string(const std::string & method)
+{
+  if (method == "pcl") return SamplingMethod::PCL;
+  if (method == "reservoir") return SamplingMethod::Reservoir;
+  if (method == "azimuth_stratified") return SamplingMethod::AzimuthStratified;
+  throw std::invalid_argument(
+    "Unknown sampling_method " + method + ", expected pcl, reservoir or azimuth_stratified");
+}
+
+RandomPointSampler::RandomPointSampler(uint64_t seed) : engine_(seed)
+{
+}
+
+void RandomPointSampler::set_azimuth_sectors(size_t azimuth_sectors)
+{
+  if (azimuth_sectors == 0) {
+    throw std::invalid_argument("azimuth_sectors must be positive");
+  }
+  azimuth_sectors_ = azimuth_sectors;
+}
+
+double RandomPointSampler::uniform_open_closed()
+{
+  // (0, 1] so that the logarithm is finite
+  return 1.0 - uniform_(engine_);
+}
+
+void RandomPointSampler::append_reservoir(size_t n, size_t k)
+{
+  const size_t begin = selected_.size();
+  if (k >= n) {
+    for (size_t i = 0; i < n; ++i) {
+      selected_.push_back(static_cast<uint32_t>(i));
+    }
+    return;
+  }
+  if (k == 0) {
+    return;
+  }
+
+  for (size_t i = 0; i < k; ++i) {
+    selected_.push_back(static_cast<uint32_t>(i));
+  }
+
+  // algorithm L draws O(k * (1 + log(n / k))) random numbers instead of one per point
+  const double inverse_k = 1.0 / static_cast<double>(k);
+  double w = std::exp(std::log(uniform_open_closed()) * inverse_k);
+  size_t i = k - 1;
+  while (true) {
+    const double skip = std::floor(std::log(uniform_open_closed()) / std::log(1.0 - w));
+    if (!(skip < static_cast<double>(n - 1 - i))) {
+      break;
+    }
+    i += static_cast<size_t>(skip) + 1;
+    std::uniform_int_distribution<size_t> slot(0, k - 1);
+    selected_[begin + slot(engine_)] = static_cast<uint32_t>(i);
+    w *= std::exp(std::log(uniform_open_closed()) * inverse_k);
+  }
+}
+
+void RandomPointSampler::sample_reservoir(const PointCloud2 & input, PointCloud2 & output)
+{
+  const size_t num_points = input.point_step == 0 ? 0 : input.data.size() / input.point_step;
+  selected_.clear();
+  append_reservoir(num_points, sample_num_);
+  std::sort(selected_.begin(), selected_.end());
+  copy_selected_points(input, output);
+}
+
+void RandomPointSampler::sample_azimuth_stratified(const PointCloud2 & input, PointCloud2 & output)
+{
+  int x_offset = -1;
+  int y_offset = -1;
+  int z_offset = -1;
+  for (const auto & field : input.fields) {
+    if (field.datatype != sensor_msgs::msg::PointField::FLOAT32) continue;
+    if (field.name == "x") x_offset = static_cast<int>(field.offset);
+    if (field.name == "y") y_offset = static_cast<int>(field.offset);
+    if (field.name == "z") z_offset = static_cast<int>(field.offset);
+  }
+  if (x_offset < 0 || y_offset < 0 || z_offset < 0) {
+    throw std::invalid_argument("azimuth_stratified sampling requires float x, y and z fields");
+  }
+
+  const size_t num_points = input.point_step == 0 ? 0 : input.data.size() / input.point_step;
+  const size_t num_sectors = azimuth_sectors_;
+  const double sectors_per_radian = static_cast<double>(num_sectors) / (2.0 * M_PI);
+  const uint32_t invalid_sector = static_cast<uint32_t>(num_sectors);
+
+  // count the finite points of each sector
+  sector_of_point_.resize(num_points);
+  sector_offsets_.assign(num_sectors + 1, 0);
+  for (size_t i = 0; i < num_points; ++i) {
+    const uint8_t * point = &input.data[i * input.point_step];
+    float x, y, z;
+    std::memcpy(&x, point + x_offset, sizeof(float));
+    std::memcpy(&y, point + y_offset, sizeof(float));
+    std::memcpy(&z, point + z_offset, sizeof(float));
+    if (!std::isfinite(x) || !std::isfinite(y) || !std::isfinite(z)) {
+      sector_of_point_[i] = invalid_sector;
+      continue;
+    }
+    const double azimuth = std::atan2(static_cast<double>(y), static_cast<double>(x)) + M_PI;
+    const auto sector = std::min(
+      static_cast<uint32_t>(azimuth * sectors_per_radian), static_cast<uint32_t>(num_sectors - 1));
+    sector_of_point_[i] = sector;
+    ++sector_offsets_[sector + 1];
+  }
+  std::partial_sum(sector_offsets_.begin(), sector_offsets_.end(), sector_offsets_.begin());
+  const size_t num_finite_points = sector_offsets_[num_sectors];
+
+  // counting sort of the point indices by sector
+  points_by_sector_.resize(num_finite_points);
+  sector_quotas_.assign(sector_offsets_.begin(), sector_offsets_.end() - 1);
+  for (size_t i = 0; i < num_points; ++i) {
+    const uint32_t sector = sector_of_point_[i];
+    if (sector != invalid_sector) {
+      points_by_sector_[sector_quotas_[sector]++] = static_cast<uint32_t>(i);
+    }
+  }
+
+  // equal shares, with the leftover of small sectors handed to the remaining ones. The first
+  // sector of each round is random so that the rounding does not favor a direction.
+  sector_quotas_.assign(num_sectors, 0);
+  size_t remaining = std::min(sample_num_, num_finite_points);
+  std::uniform_int_distribution<size_t> first_sector(0, num_sectors - 1);
+  while (remaining > 0) {
+    size_t active_sectors = 0;
+    for (size_t s = 0; s < num_sectors; ++s) {
+      active_sectors += sector_quotas_[s] < sector_offsets_[s + 1] - sector_offsets_[s];
+    }
+    const size_t share = std::max<size_t>(1, remaining / active_sectors);
+    const size_t start = first_sector(engine_);
+    for (size_t n = 0; n < num_sectors && remaining > 0; ++n) {
+      const size_t s = (start + n) % num_sectors;
+      const size_t count = sector_offsets_[s + 1] - sector_offsets_[s];
+      const size_t add = std::min({share, count - sector_quotas_[s], remaining});
+      sector_quotas_[s] += static_cast<uint32_t>(add);
+      remaining -= add;
+    }
+  }
+
+  // reservoir sampling inside each sector, mapped back to point indices
+  selected_.clear();
+  for (size_t s = 0; s < num_sectors; ++s) {
+    const size_t begin = selected_.size();
+    const size_t count = sector_offsets_[s + 1] - sector_offsets_[s];
+    append_reservoir(count, sector_quotas_[s]);
+    for (size_t i = begin; i < selected_.size(); ++i) {
+      selected_[i] = points_by_sector_[sector_offsets_[s] + selected_[i]];
+    }
+  }
+  std::sort(selected_.begin(), selected_.end());
+  copy_selected_points(input, output);
+}
+
+void RandomPointSampler::copy_selected_points(const PointCloud2 & input, PointCloud2 & output)
+{
+  const size_t point_step = input.point_step;
+  output.data.resize(selected_.size() * point_step);
+  for (size_t i = 0; i < selected_.size(); ++i) {
+    std::memcpy(
+      &output.data[i * point_step], &input.data[static_cast<size_t>(selected_[i]) * point_step],
+      point_step);
+  }
+
+  output.header = input.header;
+  output.fields = input.fields;
+  output.is_bigendian = input.is_bigendian;
+  output.point_step = input.point_step;
+  output.height = 1;
+  output.width = static_cast<uint32_t>(selected_.size());
+  output.row_step = static_cast<uint32_t>(output.data.size());
+  output.is_dense = input.is_dense;
+}
+
+}  // namespace autoware::downsample_filters
@@ -0,0 +1,85 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RANDOM_DOWNSAMPLE_FILTER__RANDOM_POINT_SAMPLER_HPP_
+#define RANDOM_DOWNSAMPLE_FILTER__RANDOM_POINT_SAMPLER_HPP_
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace autoware::downsample_filters
+{
+
+enum class SamplingMethod { PCL, Reservoir, AzimuthStratified };
+
+/** \brief Parse "pcl", "reservoir" or "azimuth_stratified". Throws std::invalid_argument for any
+ * other value. */
+SamplingMethod sampling_method_from_string(const std::string & method);
+
+/** \brief Sample points of a PointCloud2 without converting it to a PCL cloud.
+ *
+ * The random engine and the index buffers are members, so the sequence continues across clouds
+ * and a cloud that is not larger than the previous ones does not allocate. The sampled points are
+ * copied with all their fields in their input order. */
+class RandomPointSampler
+{
+  using PointCloud2 = sensor_msgs::msg::PointCloud2;
+
+public:
+  explicit RandomPointSampler(uint64_t seed = std::mt19937_64::default_seed);
+
+  void set_sample_num(size_t sample_num) { sample_num_ = sample_num; }
+
+  /** \brief Number of azimuth sectors of the stratified sampling. */
+  void set_azimuth_sectors(size_t azimuth_sectors);
+
+  /** \brief Sample sample_num points uniformly with reservoir sampling. All points are kept when
+   * the cloud is not larger than sample_num. */
+  void sample_reservoir(const PointCloud2 & input, PointCloud2 & output);
+
+  /** \brief Split the finite points into azimuth sectors around the origin of the input frame
+   * and give every sector the same share of sample_num. The share of the sectors with fewer
+   * points is handed to the others, so the output has min(sample_num, finite points) points.
+   * Sparse directions, typically far from the sensor, are not starved by dense ones. */
+  void sample_azimuth_stratified(const PointCloud2 & input, PointCloud2 & output);
+
+private:
+  /** \brief Append k distinct values of [0, n) to selected_ (Li's algorithm L). */
+  void append_reservoir(size_t n, size_t k);
+
+  void copy_selected_points(const PointCloud2 & input, PointCloud2 & output);
+
+  double uniform_open_closed();
+
+  std::mt19937_64 engine_;
+  std::uniform_real_distribution<double> uniform_{0.0, 1.0};
+  size_t sample_num_{0};
+  size_t azimuth_sectors_{16};
+
+  /** \brief Storage reused across calls */
+  std::vector<uint32_t> selected_;
+  std::vector<uint32_t> sector_of_point_;
+  std::vector<uint32_t> sector_offsets_;
+  std::vector<uint32_t> sector_quotas_;
+  std::vector<uint32_t> points_by_sector_;
+};
+
+}  // namespace autoware::downsample_filters
+
+#endif  // RANDOM_DOWNSAMPLE_FILTER__RANDOM_POINT_SAMPLER_HPP_
@@ -14,8 +14,13 @@
 
 #include "faster_voxel_grid_downsample_filter.hpp"
 
+#include "memory.hpp"
+
+#include <algorithm>
 #include <cfloat>
+#include <limits>
 #include <unordered_map>
+#include <vector>
 
 namespace autoware::downsample_filters
 {
@@ -28,6 +33,12 @@ FasterVoxelGridDownsampleFilter::FasterVoxelGridDownsampleFilter()
   intensity_index_ = 0;
   intensity_offset_ = 0;
   offset_initialized_ = false;
+  simd_enabled_ = true;
+  simd_layout_compatible_ = false;
+  instruction_set_ = simd::InstructionSet::Scalar;
+  centroid_accumulator_ = CentroidAccumulator::UnorderedMap;
+  num_threads_ = 1;
+  min_points_for_parallel_ = 0;
 }
 
 void FasterVoxelGridDownsampleFilter::set_voxel_size(
@@ -59,9 +70,45 @@ void FasterVoxelGridDownsampleFilter::set_field_offsets(
   } else {
     intensity_offset_ = -1;
   }
+
+  layout_.point_step = input->point_step;
+  layout_.x_offset = x_offset_;
+  layout_.y_offset = y_offset_;
+  layout_.z_offset = z_offset_;
+  layout_.intensity_offset = intensity_offset_;
+  simd_layout_compatible_ = (utils::is_data_layout_compatible_with_point_xyzircaedt(*input) ||
+                             utils::is_data_layout_compatible_with_point_xyzirc(*input)) &&
+                            simd::is_layout_supported(layout_);
+  select_instruction_set();
+
   offset_initialized_ = true;
 }
 
+void FasterVoxelGridDownsampleFilter::set_simd_enabled(bool enabled)
+{
+  simd_enabled_ = enabled;
+  select_instruction_set();
+}
+
+void FasterVoxelGridDownsampleFilter::set_centroid_accumulator(CentroidAccumulator accumulator)
+{
+  centroid_accumulator_ = accumulator;
+}
+
+void FasterVoxelGridDownsampleFilter::set_parallel_config(
+  int num_threads, size_t min_points_for_parallel)
+{
+  num_threads_ = std::max(num_threads, 1);
+  min_points_for_parallel_ = min_points_for_parallel;
+  partial_centroids_.resize(num_threads_);
+}
+
+void FasterVoxelGridDownsampleFilter::select_instruction_set()
+{
+  instruction_set_ = simd_enabled_ && simd_layout_compatible_ ? simd::detect_instruction_set()
+                                                              : simd::InstructionSet::Scalar;
+}
+
 void FasterVoxelGridDownsampleFilter::filter(
   const PointCloud2ConstPtr & input, PointCloud2 & output, const TransformInfo & transform_info,
   const rclcpp::Logger & logger)
@@ -82,13 +129,13 @@ void FasterVoxelGridDownsampleFilter::filter(
     return;
   }
 
-  // Storage for mapping voxel coordinates to centroids
-  auto voxel_centroid_map = calc_centroids_each_voxel(input, max_voxel, min_voxel);
+  // Gather the points of each voxel
+  const auto & centroids = calc_centroids_each_voxel(input, max_voxel, min_voxel);
 
   // Initialize the output
-  output.row_step = voxel_centroid_map.size() * input->point_step;
+  output.row_step = centroids.size() * input->point_step;
   output.data.resize(output.row_step);
-  output.width = voxel_centroid_map.size();
+  output.width = centroids.size();
   output.fields = input->fields;
   output.is_dense = true;  // we filter out invalid points
   output.height = input->height;
@@ -97,22 +144,7 @@ void FasterVoxelGridDownsampleFilter::filter(
   output.header = input->header;
 
   // Copy the centroids to the output
-  copy_centroids_to_output(voxel_centroid_map, output, transform_info);
-}
-
-Eigen::Vector4f FasterVoxelGridDownsampleFilter::get_point_from_global_offset(
-  const PointCloud2ConstPtr & input, size_t global_offset) const
-{
-  float intensity = 0.0;
-  if (intensity_index_ >= 0) {
-    intensity = static_cast<float>(
-      *reinterpret_cast<const uint8_t *>(&input->data[global_offset + intensity_offset_]));
-  }
-  Eigen::Vector4f point(
-    *reinterpret_cast<const float *>(&input->data[global_offset + x_offset_]),
-    *reinterpret_cast<const float *>(&input->data[global_offset + y_offset_]),
-    *reinterpret_cast<const float *>(&input->data[global_offset + z_offset_]), intensity);
-  return point;
+  copy_centroids_to_output(centroids, output, transform_info);
 }
 
 bool FasterVoxelGridDownsampleFilter::get_min_max_voxel(
@@ -122,14 +154,9 @@ bool FasterVoxelGridDownsampleFilter::get_min_max_voxel(
   Eigen::Vector3f min_point, max_point;
   min_point.setConstant(FLT_MAX);
   max_point.setConstant(-FLT_MAX);
-  for (size_t global_offset = 0; global_offset + input->point_step <= input->data.size();
-       global_offset += input->point_step) {
-    Eigen::Vector4f point = get_point_from_global_offset(input, global_offset);
-    if (std::isfinite(point[0]) && std::isfinite(point[1]) && std::isfinite(point[2])) {
-      min_point = min_point.cwiseMin(point.head<3>());
-      max_point = max_point.cwiseMax(point.head<3>());
-    }
-  }
+  simd::update_min_max(
+    input->data.data(), input->data.size() / input->point_step, layout_, instruction_set_,
+    min_point, max_point);
 
   // Check that the voxel size is not too small, given the size of the data
   if (
@@ -151,46 +178,154 @@ bool FasterVoxelGridDownsampleFilter::get_min_max_voxel(
   return true;
 }
 
-std::unordered_map<uint32_t, FasterVoxelGridDownsampleFilter::Centroid>
-FasterVoxelGridDownsampleFilter::calc_centroids_each_voxel(
+template <typename AddPoint>
+void FasterVoxelGridDownsampleFilter::for_each_valid_point(
+  const PointCloud2ConstPtr & input, const simd::VoxelIndexer & indexer, size_t point_begin,
+  size_t point_end, AddPoint && add_point) const
+{
+  // Extract the fields and voxel indices block by block, then accumulate them
+  simd::PointBlock block;
+  for (size_t block_begin = point_begin; block_begin < point_end;
+       block_begin += simd::block_size) {
+    simd::extract_block(
+      input->data.data() + block_begin * input->point_step, point_end - block_begin, layout_,
+      indexer, instruction_set_, block);
+    for (size_t i = 0; i < block.size; ++i) {
+      if (block.valid[i]) {
+        add_point(block.voxel_id[i], block.x[i], block.y[i], block.z[i], block.intensity[i]);
+      }
+    }
+  }
+}
+
+const std::vector<Centroid> & FasterVoxelGridDownsampleFilter::calc_centroids_each_voxel(
   const PointCloud2ConstPtr & input, const Eigen::Vector3i & max_voxel,
   const Eigen::Vector3i & min_voxel)
 {
-  std::unordered_map<uint32_t, Centroid> voxel_centroid_map;
   // Compute the number of divisions needed along all axis
   Eigen::Vector3i div_b = max_voxel - min_voxel + Eigen::Vector3i::Ones();
   // Set up the division multiplier
   Eigen::Vector3i div_b_mul(1, div_b[0], div_b[0] * div_b[1]);
 
-  for (size_t global_offset = 0; global_offset + input->point_step <= input->data.size();
-       global_offset += input->point_step) {
-    Eigen::Vector4f point = get_point_from_global_offset(input, global_offset);
-    if (std::isfinite(point[0]) && std::isfinite(point[1]), std::isfinite(point[2])) {
-      // Calculate the voxel index to which the point belongs
-      int ijk0 = static_cast<int>(std::floor(point[0] * inverse_voxel_size_[0]) - min_voxel[0]);
-      int ijk1 = static_cast<int>(std::floor(point[1] * inverse_voxel_size_[1]) - min_voxel[1]);
-      int ijk2 = static_cast<int>(std::floor(point[2] * inverse_voxel_size_[2]) - min_voxel[2]);
-      uint32_t voxel_id = ijk0 * div_b_mul[0] + ijk1 * div_b_mul[1] + ijk2 * div_b_mul[2];
-
-      // Add the point to the corresponding centroid
-      if (voxel_centroid_map.find(voxel_id) == voxel_centroid_map.end()) {
-        voxel_centroid_map[voxel_id] = Centroid(point[0], point[1], point[2], point[3]);
-      } else {
-        voxel_centroid_map[voxel_id].add_point(point[0], point[1], point[2], point[3]);
+  const simd::VoxelIndexer indexer{inverse_voxel_size_, min_voxel, div_b_mul};
+  const size_t num_points = input->data.size() / input->point_step;
+
+  if (num_threads_ > 1 && num_points >= min_points_for_parallel_) {
+    calc_centroids_parallel(input, indexer);
+    return centroids_;
+  }
+
+  switch (centroid_accumulator_) {
+    case CentroidAccumulator::RadixSort: {
+      radix_sort_reducer_.clear();
+      radix_sort_reducer_.reserve(num_points);
+      for_each_valid_point(
+        input, indexer, 0, num_points,
+        [this](uint32_t voxel_id, float x, float y, float z, float intensity) {
+          radix_sort_reducer_.add_point(voxel_id, x, y, z, intensity);
+        });
+      radix_sort_reducer_.reduce(centroids_);
+      return centroids_;
+    }
+    case CentroidAccumulator::OpenAddressing: {
+      voxel_table_.clear();
+      for_each_valid_point(
+        input, indexer, 0, num_points,
+        [this](uint32_t voxel_id, float x, float y, float z, float intensity) {
+          voxel_table_.add_point(voxel_id, x, y, z, intensity);
+        });
+      return voxel_table_.centroids();
+    }
+    default: {
+      voxel_centroid_map_.clear();
+      for_each_valid_point(
+        input, indexer, 0, num_points,
+        [this](uint32_t voxel_id, float x, float y, float z, float intensity) {
+          // Add the point to the corresponding centroid
+          auto it = voxel_centroid_map_.find(voxel_id);
+          if (it == voxel_centroid_map_.end()) {
+            voxel_centroid_map_.emplace(voxel_id, Centroid(x, y, z, intensity));
+          } else {
+            it->second.add_point(x, y, z, intensity);
+          }
+        });
+      centroids_.clear();
+      centroids_.reserve(voxel_centroid_map_.size());
+      for (const auto & pair : voxel_centroid_map_) {
+        centroids_.push_back(pair.second);
       }
+      return centroids_;
     }
   }
+}
+
+void FasterVoxelGridDownsampleFilter::calc_centroids_parallel(
+  const PointCloud2ConstPtr & input, const simd::VoxelIndexer & indexer)
+{
+  const size_t num_points = input->data.size() / input->point_step;
+  const size_t num_chunks = partial_centroids_.size();
+  const size_t chunk_size = (num_points + num_chunks - 1) / num_chunks;
 
-  return voxel_centroid_map;
+  // Each thread sorts and reduces its own contiguous chunk of the input
+#pragma omp parallel for num_threads(num_threads_) schedule(static, 1)
+  for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+    auto & partial = partial_centroids_[chunk];
+    const size_t point_begin = std::min(chunk * chunk_size, num_points);
+    const size_t point_end = std::min(point_begin + chunk_size, num_points);
+    partial.reducer.clear();
+    partial.reducer.reserve(point_end - point_begin);
+    for_each_valid_point(
+      input, indexer, point_begin, point_end,
+      [&partial](uint32_t voxel_id, float x, float y, float z, float intensity) {
+        partial.reducer.add_point(voxel_id, x, y, z, intensity);
+      });
+    partial.reducer.reduce(partial.centroids, &partial.voxel_ids);
+  }
+
+  // k-way merge of the sorted partial results. Partials of the same voxel are always merged in
+  // chunk order, which keeps the sums independent of the thread scheduling.
+  centroids_.clear();
+  std::vector<size_t> heads(num_chunks, 0);
+  while (true) {
+    uint32_t min_voxel_id = std::numeric_limits<uint32_t>::max();
+    bool found = false;
+    for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+      const auto & partial = partial_centroids_[chunk];
+      if (heads[chunk] < partial.voxel_ids.size()) {
+        min_voxel_id = std::min(min_voxel_id, partial.voxel_ids[heads[chunk]]);
+        found = true;
+      }
+    }
+    if (!found) {
+      break;
+    }
+
+    bool is_first_partial = true;
+    for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+      const auto & partial = partial_centroids_[chunk];
+      if (
+        heads[chunk] >= partial.voxel_ids.size() ||
+        partial.voxel_ids[heads[chunk]] != min_voxel_id) {
+        continue;
+      }
+      if (is_first_partial) {
+        centroids_.push_back(partial.centroids[heads[chunk]]);
+        is_first_partial = false;
+      } else {
+        centroids_.back().merge(partial.centroids[heads[chunk]]);
+      }
+      ++heads[chunk];
+    }
+  }
 }
 
 void FasterVoxelGridDownsampleFilter::copy_centroids_to_output(
-  const std::unordered_map<uint32_t, Centroid> & voxel_centroid_map, PointCloud2 & output,
+  const std::vector<Centroid> & centroids, PointCloud2 & output,
   const TransformInfo & transform_info) const
 {
   size_t output_data_size = 0;
-  for (const auto & pair : voxel_centroid_map) {
-    Eigen::Vector4f centroid = pair.second.calc_centroid();
+  for (const auto & voxel_centroid : centroids) {
+    Eigen::Vector4f centroid = voxel_centroid.calc_centroid();
     if (transform_info.need_transform) {
       centroid = transform_info.eigen_transform * centroid;
     }
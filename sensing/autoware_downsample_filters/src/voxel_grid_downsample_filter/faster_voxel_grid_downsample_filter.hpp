@@ -16,6 +16,8 @@
 #define VOXEL_GRID_DOWNSAMPLE_FILTER__FASTER_VOXEL_GRID_DOWNSAMPLE_FILTER_HPP_
 
 #include "transform_info.hpp"
+#include "voxel_centroid_accumulator.hpp"
+#include "voxel_grid_simd.hpp"
 
 #include <pcl/filters/voxel_grid.h>
 #include <pcl_conversions/pcl_conversions.h>
@@ -40,40 +42,23 @@ public:
     const PointCloud2ConstPtr & input, PointCloud2 & output, const TransformInfo & transform_info,
     const rclcpp::Logger & logger);
 
-private:
-  struct Centroid
-  {
-    float x;
-    float y;
-    float z;
-    float intensity;
-    uint32_t point_count_;
-
-    Centroid() : x(0), y(0), z(0), intensity(0), point_count_(1) {}
-    Centroid(float _x, float _y, float _z, float _intensity)
-    : x(_x), y(_y), z(_z), intensity(_intensity)
-    {
-      this->point_count_ = 1;
-    }
-
-    void add_point(float _x, float _y, float _z, float _intensity)
-    {
-      this->x += _x;
-      this->y += _y;
-      this->z += _z;
-      this->intensity += _intensity;
-      this->point_count_++;
-    }
-
-    Eigen::Vector4f calc_centroid() const
-    {
-      Eigen::Vector4f centroid(
-        (this->x / this->point_count_), (this->y / this->point_count_),
-        (this->z / this->point_count_), (this->intensity / this->point_count_));
-      return centroid;
-    }
-  };
+  /** \brief Enable or disable the vectorized field extraction. When enabled, the kernel for the
+   * best instruction set of the running CPU is used as long as the input layout allows it. */
+  void set_simd_enabled(bool enabled);
+  simd::InstructionSet get_instruction_set() const { return instruction_set_; }
+
+  /** \brief Select the data structure used to gather the points of each voxel. The buffers of
+   * the radix sort and open addressing accumulators are reused by the following calls of
+   * filter(). */
+  void set_centroid_accumulator(CentroidAccumulator accumulator);
+
+  /** \brief Split clouds with at least min_points_for_parallel points into num_threads chunks
+   * whose partial centroids are merged afterwards. The output is sorted by voxel index, so it is
+   * identical for the same input and thread count. num_threads <= 1 disables the parallel path.
+   */
+  void set_parallel_config(int num_threads, size_t min_points_for_parallel);
 
+private:
   Eigen::Vector3f inverse_voxel_size_;
   int x_offset_;
   int y_offset_;
@@ -81,19 +66,53 @@ private:
   int intensity_index_;
   int intensity_offset_;
   bool offset_initialized_;
+  bool simd_enabled_;
+  bool simd_layout_compatible_;
+  simd::PointLayout layout_;
+  simd::InstructionSet instruction_set_;
+  CentroidAccumulator centroid_accumulator_;
+  int num_threads_;
+  size_t min_points_for_parallel_;
+
+  /** \brief Storage reused across calls of filter() */
+  std::unordered_map<uint32_t, Centroid> voxel_centroid_map_;
+  OpenAddressingVoxelTable voxel_table_;
+  RadixSortVoxelReducer radix_sort_reducer_;
+  std::vector<Centroid> centroids_;  // output of all accumulators except open_addressing
+
+  /** \brief Per-thread storage of the parallel path */
+  struct PartialCentroids
+  {
+    RadixSortVoxelReducer reducer;
+    std::vector<Centroid> centroids;
+    std::vector<uint32_t> voxel_ids;
+  };
+  std::vector<PartialCentroids> partial_centroids_;
+
+  void select_instruction_set();
+
+  /** \brief Call add_point(voxel_id, x, y, z, intensity) for every finite point in
+   * [point_begin, point_end). */
+  template <typename AddPoint>
+  void for_each_valid_point(
+    const PointCloud2ConstPtr & input, const simd::VoxelIndexer & indexer, size_t point_begin,
+    size_t point_end, AddPoint && add_point) const;
 
-  Eigen::Vector4f get_point_from_global_offset(
-    const PointCloud2ConstPtr & input, size_t global_offset) const;
+  /** \brief Gather the centroids of each chunk in parallel and merge them into centroids_ */
+  void calc_centroids_parallel(
+    const PointCloud2ConstPtr & input, const simd::VoxelIndexer & indexer);
 
   bool get_min_max_voxel(
     const PointCloud2ConstPtr & input, Eigen::Vector3i & min_voxel, Eigen::Vector3i & max_voxel);
 
-  std::unordered_map<uint32_t, Centroid> calc_centroids_each_voxel(
+  /** \brief Return one centroid per occupied voxel. The reference stays valid until the next
+   * call. */
+  const std::vector<Centroid> & calc_centroids_each_voxel(
     const PointCloud2ConstPtr & input, const Eigen::Vector3i & max_voxel,
     const Eigen::Vector3i & min_voxel);
 
   void copy_centroids_to_output(
-    const std::unordered_map<uint32_t, Centroid> & voxel_centroid_map, PointCloud2 & output,
+    const std::vector<Centroid> & centroids, PointCloud2 & output,
     const TransformInfo & transform_info) const;
 };
 
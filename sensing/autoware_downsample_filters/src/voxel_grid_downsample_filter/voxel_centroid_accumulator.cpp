@@ -0,0 +1,171 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "voxel_centroid_accumulator.hpp"
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace autoware::downsample_filters
+{
+namespace
+{
+constexpr size_t initial_table_capacity = 1U << 12;
+
+// Fibonacci hashing spreads the consecutive voxel ids of a dense grid over the whole table
+inline size_t hash_voxel_id(const uint32_t voxel_id, const size_t mask)
+{
+  return (static_cast<size_t>(voxel_id) * 0x9E3779B97F4A7C15ULL >> 32) & mask;
+}
+}  // namespace
+
+CentroidAccumulator centroid_accumulator_from_string(const std::string & name)
+{
+  if (name == "unordered_map") {
+    return CentroidAccumulator::UnorderedMap;
+  }
+  if (name == "radix_sort") {
+    return CentroidAccumulator::RadixSort;
+  }
+  if (name == "open_addressing") {
+    return CentroidAccumulator::OpenAddressing;
+  }
+  throw std::invalid_argument("Unknown centroid accumulator: " + name);
+}
+
+OpenAddressingVoxelTable::OpenAddressingVoxelTable() : slots_(initial_table_capacity)
+{
+}
+
+void OpenAddressingVoxelTable::clear()
+{
+  centroids_.clear();
+  voxel_ids_.clear();
+  if (++generation_ == 0) {
+    // The counter wrapped around, so stale slots could look valid again
+    std::fill(slots_.begin(), slots_.end(), Slot{});
+    generation_ = 1;
+  }
+}
+
+void OpenAddressingVoxelTable::add_point(
+  const uint32_t voxel_id, const float x, const float y, const float z, const float intensity)
+{
+  const size_t mask = slots_.size() - 1;
+  for (size_t index = hash_voxel_id(voxel_id, mask);; index = (index + 1) & mask) {
+    Slot & slot = slots_[index];
+    if (slot.generation != generation_) {
+      slot.voxel_id = voxel_id;
+      slot.generation = generation_;
+      slot.centroid_index = static_cast<uint32_t>(centroids_.size());
+      centroids_.emplace_back(x, y, z, intensity);
+      voxel_ids_.push_back(voxel_id);
+      break;
+    }
+    if (slot.voxel_id == voxel_id) {
+      centroids_[slot.centroid_index].add_point(x, y, z, intensity);
+      return;
+    }
+  }
+
+  // Keep the load factor under 0.5 so that probe sequences stay short
+  if (centroids_.size() * 2 > slots_.size()) {
+    grow();
+  }
+}
+
+void OpenAddressingVoxelTable::insert_slot(const uint32_t voxel_id, const uint32_t centroid_index)
+{
+  const size_t mask = slots_.size() - 1;
+  size_t index = hash_voxel_id(voxel_id, mask);
+  while (slots_[index].generation == generation_) {
+    index = (index + 1) & mask;
+  }
+  slots_[index] = Slot{voxel_id, generation_, centroid_index};
+}
+
+void OpenAddressingVoxelTable::grow()
+{
+  slots_.assign(slots_.size() * 2, Slot{});
+  generation_ = 1;
+  for (size_t i = 0; i < voxel_ids_.size(); ++i) {
+    insert_slot(voxel_ids_[i], static_cast<uint32_t>(i));
+  }
+}
+
+void RadixSortVoxelReducer::reduce(
+  std::vector<Centroid> & centroids, std::vector<uint32_t> * voxel_ids)
+{
+  centroids.clear();
+  if (voxel_ids) {
+    voxel_ids->clear();
+  }
+  if (entries_.empty()) {
+    return;
+  }
+
+  // Build the histograms of all four 8-bit digits in a single pass
+  constexpr size_t num_digits = sizeof(uint32_t);
+  constexpr size_t num_buckets = 256;
+  std::array<std::array<size_t, num_buckets>, num_digits> histograms{};
+  for (const auto & entry : entries_) {
+    for (size_t digit = 0; digit < num_digits; ++digit) {
+      ++histograms[digit][(entry.voxel_id >> (8 * digit)) & 0xFF];
+    }
+  }
+
+  sort_buffer_.resize(entries_.size());
+  for (size_t digit = 0; digit < num_digits; ++digit) {
+    auto & histogram = histograms[digit];
+    // All keys share this digit, typically the upper bytes of small grids
+    if (std::find(histogram.begin(), histogram.end(), entries_.size()) != histogram.end()) {
+      continue;
+    }
+    size_t offset = 0;
+    for (auto & count : histogram) {
+      const size_t bucket_size = count;
+      count = offset;
+      offset += bucket_size;
+    }
+    for (const auto & entry : entries_) {
+      sort_buffer_[histogram[(entry.voxel_id >> (8 * digit)) & 0xFF]++] = entry;
+    }
+    entries_.swap(sort_buffer_);
+  }
+
+  // Reduce each run of equal voxel ids
+  uint32_t current_voxel_id = entries_.front().voxel_id;
+  centroids.emplace_back(
+    entries_.front().x, entries_.front().y, entries_.front().z, entries_.front().intensity);
+  for (size_t i = 1; i < entries_.size(); ++i) {
+    const auto & entry = entries_[i];
+    if (entry.voxel_id == current_voxel_id) {
+      centroids.back().add_point(entry.x, entry.y, entry.z, entry.intensity);
+    } else {
+      if (voxel_ids) {
+        voxel_ids->push_back(current_voxel_id);
+      }
+      current_voxel_id = entry.voxel_id;
+      centroids.emplace_back(entry.x, entry.y, entry.z, entry.intensity);
+    }
+  }
+  if (voxel_ids) {
+    voxel_ids->push_back(current_voxel_id);
+  }
+}
+
+}  // namespace autoware::downsample_filters
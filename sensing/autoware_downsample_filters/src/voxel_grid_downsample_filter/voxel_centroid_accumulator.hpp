@@ -0,0 +1,150 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef VOXEL_GRID_DOWNSAMPLE_FILTER__VOXEL_CENTROID_ACCUMULATOR_HPP_
+#define VOXEL_GRID_DOWNSAMPLE_FILTER__VOXEL_CENTROID_ACCUMULATOR_HPP_
+
+#include <Eigen/Core>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace autoware::downsample_filters
+{
+
+struct Centroid
+{
+  float x;
+  float y;
+  float z;
+  float intensity;
+  uint32_t point_count_;
+
+  Centroid() : x(0), y(0), z(0), intensity(0), point_count_(1) {}
+  Centroid(float _x, float _y, float _z, float _intensity)
+  : x(_x), y(_y), z(_z), intensity(_intensity)
+  {
+    this->point_count_ = 1;
+  }
+
+  void add_point(float _x, float _y, float _z, float _intensity)
+  {
+    this->x += _x;
+    this->y += _y;
+    this->z += _z;
+    this->intensity += _intensity;
+    this->point_count_++;
+  }
+
+  /** \brief Merge the points gathered in another partial centroid of the same voxel */
+  void merge(const Centroid & other)
+  {
+    this->x += other.x;
+    this->y += other.y;
+    this->z += other.z;
+    this->intensity += other.intensity;
+    this->point_count_ += other.point_count_;
+  }
+
+  Eigen::Vector4f calc_centroid() const
+  {
+    Eigen::Vector4f centroid(
+      (this->x / this->point_count_), (this->y / this->point_count_),
+      (this->z / this->point_count_), (this->intensity / this->point_count_));
+    return centroid;
+  }
+};
+
+/** \brief Data structure used to gather the points of each voxel. */
+enum class CentroidAccumulator {
+  UnorderedMap,   ///< std::unordered_map rebuilt for every cloud
+  RadixSort,      ///< radix-sort (voxel id, point) pairs and reduce the runs
+  OpenAddressing  ///< flat linear-probing table persisted across clouds
+};
+
+/** \brief Parse "unordered_map", "radix_sort" or "open_addressing".
+ * \throws std::invalid_argument for any other string */
+CentroidAccumulator centroid_accumulator_from_string(const std::string & name);
+
+/** \brief Flat open-addressing voxel table. The slot array survives between clouds and is
+ * invalidated in O(1) by bumping a generation counter, so steady-state frames do not allocate.
+ * Centroids are stored in the order the voxels are first seen. */
+class OpenAddressingVoxelTable
+{
+public:
+  OpenAddressingVoxelTable();
+
+  /** \brief Forget all voxels while keeping the allocated storage. */
+  void clear();
+
+  void add_point(uint32_t voxel_id, float x, float y, float z, float intensity);
+
+  const std::vector<Centroid> & centroids() const { return centroids_; }
+
+private:
+  struct Slot
+  {
+    uint32_t voxel_id{0};
+    uint32_t generation{0};
+    uint32_t centroid_index{0};
+  };
+
+  std::vector<Slot> slots_;
+  std::vector<Centroid> centroids_;
+  std::vector<uint32_t> voxel_ids_;
+  uint32_t generation_{1};
+
+  void insert_slot(uint32_t voxel_id, uint32_t centroid_index);
+  void grow();
+};
+
+/** \brief Sort-based accumulator. Points are appended with their voxel id, sorted with a stable
+ * LSD radix sort and each run of equal ids is reduced to one centroid, in ascending voxel id
+ * order. The buffers are reused between clouds. */
+class RadixSortVoxelReducer
+{
+public:
+  /** \brief Forget all points while keeping the allocated storage. */
+  void clear() { entries_.clear(); }
+
+  void reserve(size_t num_points) { entries_.reserve(num_points); }
+
+  void add_point(uint32_t voxel_id, float x, float y, float z, float intensity)
+  {
+    entries_.push_back(Entry{voxel_id, x, y, z, intensity});
+  }
+
+  /** \brief Sort the accumulated points and write one centroid per voxel into centroids. If
+   * voxel_ids is given, it receives the voxel id of each centroid. */
+  void reduce(std::vector<Centroid> & centroids, std::vector<uint32_t> * voxel_ids = nullptr);
+
+private:
+  struct Entry
+  {
+    uint32_t voxel_id;
+    float x;
+    float y;
+    float z;
+    float intensity;
+  };
+
+  std::vector<Entry> entries_;
+  std::vector<Entry> sort_buffer_;
+};
+
+}  // namespace autoware::downsample_filters
+
+#endif  // VOXEL_GRID_DOWNSAMPLE_FILTER__VOXEL_CENTROID_ACCUMULATOR_HPP_
@@ -40,8 +40,25 @@ VoxelGridDownsampleFilter::VoxelGridDownsampleFilter(const rclcpp::NodeOptions &
   voxel_size_z_(declare_parameter<float>("voxel_size_z")),
   tf_input_frame_(declare_parameter<std::string>("input_frame")),
   tf_output_frame_(declare_parameter<std::string>("output_frame")),
-  max_queue_size_(static_cast<std::size_t>(declare_parameter<int64_t>("max_queue_size")))
+  max_queue_size_(static_cast<std::size_t>(declare_parameter<int64_t>("max_queue_size"))),
+  process_latest_only_(declare_parameter<bool>("process_latest_only"))
 {
+  faster_voxel_filter_.set_voxel_size(voxel_size_x_, voxel_size_y_, voxel_size_z_);
+  faster_voxel_filter_.set_centroid_accumulator(
+    centroid_accumulator_from_string(declare_parameter<std::string>("centroid_accumulator")));
+  faster_voxel_filter_.set_parallel_config(
+    static_cast<int>(declare_parameter<int64_t>("num_threads")),
+    static_cast<size_t>(declare_parameter<int64_t>("parallel_point_threshold")));
+
+  // initialize debug tool
+  {
+    using autoware_utils_debug::DebugPublisher;
+    using autoware_utils_system::StopWatch;
+    stop_watch_ptr_ = std::make_unique<StopWatch<std::chrono::milliseconds>>();
+    debug_publisher_ = std::make_unique<DebugPublisher>(this, this->get_name());
+    stop_watch_ptr_->tic("processing_time");
+  }
+
   // Set publishers
   {
     rclcpp::PublisherOptions pub_options;
@@ -56,7 +73,9 @@ VoxelGridDownsampleFilter::VoxelGridDownsampleFilter(const rclcpp::NodeOptions &
   // Set subscribers
   {
     sub_input_ = create_subscription<PointCloud2>(
-      "input", rclcpp::SensorDataQoS().keep_last(max_queue_size_),
+      "input",
+      rclcpp::SensorDataQoS().keep_last(
+        autoware::point_types::input_queue_depth(process_latest_only_, max_queue_size_)),
       std::bind(&VoxelGridDownsampleFilter::input_callback, this, std::placeholders::_1));
     transform_listener_ = std::make_unique<autoware_utils_tf::TransformListener>(this);
   }
@@ -76,6 +95,7 @@ void VoxelGridDownsampleFilter::input_callback(const PointCloud2ConstPtr cloud)
     "[input_callback] PointCloud with %d data points and frame %s on input topic "
     "received.",
     cloud->width * cloud->height, cloud->header.frame_id.c_str());
+  stage_latency_.enter(cloud->header.stamp, this->get_clock()->now().nanoseconds());
 
   tf_input_orig_frame_ = cloud->header.frame_id;
 
@@ -86,11 +106,17 @@ void VoxelGridDownsampleFilter::input_callback(const PointCloud2ConstPtr cloud)
 
   auto output = std::make_unique<PointCloud2>();
 
+  stop_watch_ptr_->toc("processing_time", true);
   filter(cloud, *output, transform_info);
+  debug_publisher_->publish<autoware_internal_debug_msgs::msg::Float64Stamped>(
+    "debug/processing_time_ms", stop_watch_ptr_->toc("processing_time", true));
 
   if (!convert_output_costly(output)) return;
 
   output->header.stamp = cloud->header.stamp;
+  stage_latency_.exit();
+  debug_publisher_->publish<autoware_internal_debug_msgs::msg::Float64Stamped>(
+    "debug/pipeline_latency_ms", stage_latency_.end_to_end_latency_ms());
   pub_output_->publish(std::move(output));
   published_time_publisher_->publish_if_subscribed(pub_output_, cloud->header.stamp);
 }
@@ -213,10 +239,8 @@ void VoxelGridDownsampleFilter::filter(
   const PointCloud2ConstPtr & input, PointCloud2 & output, const TransformInfo & transform_info)
 {
   std::scoped_lock lock(mutex_);
-  FasterVoxelGridDownsampleFilter faster_voxel_filter;
-  faster_voxel_filter.set_voxel_size(voxel_size_x_, voxel_size_y_, voxel_size_z_);
-  faster_voxel_filter.set_field_offsets(input, this->get_logger());
-  faster_voxel_filter.filter(input, output, transform_info, this->get_logger());
+  faster_voxel_filter_.set_field_offsets(input, this->get_logger());
+  faster_voxel_filter_.filter(input, output, transform_info, this->get_logger());
 }
 }  // namespace autoware::downsample_filters
 
@@ -15,6 +15,7 @@
 #ifndef VOXEL_GRID_DOWNSAMPLE_FILTER__VOXEL_GRID_DOWNSAMPLE_FILTER_NODE_HPP_  // NOLINT
 #define VOXEL_GRID_DOWNSAMPLE_FILTER__VOXEL_GRID_DOWNSAMPLE_FILTER_NODE_HPP_  // NOLINT
 
+#include "faster_voxel_grid_downsample_filter.hpp"
 #include "transform_info.hpp"
 
 #include <boost/thread/mutex.hpp>
@@ -29,6 +30,7 @@
 #include <pcl/search/pcl_search.h>
 
 // Include tier4 autoware utils
+#include <autoware/point_types/pipeline_latency.hpp>
 #include <autoware_utils_debug/debug_publisher.hpp>
 #include <autoware_utils_debug/published_time_publisher.hpp>
 #include <autoware_utils_system/stop_watch.hpp>
@@ -59,6 +61,7 @@ private:
   std::unique_ptr<autoware_utils_system::StopWatch<std::chrono::milliseconds>> stop_watch_ptr_;
   std::unique_ptr<autoware_utils_debug::DebugPublisher> debug_publisher_;
   std::unique_ptr<autoware_utils_debug::PublishedTimePublisher> published_time_publisher_;
+  autoware::point_types::StageLatency stage_latency_;
 
   /** \brief PointCloud2 data callback. */
   void input_callback(const PointCloud2ConstPtr cloud);
@@ -79,6 +82,8 @@ private:
   float voxel_size_y_;
   /** \brief voxel size z */
   float voxel_size_z_;
+  /** \brief The voxel grid filter, kept across callbacks to reuse its buffers */
+  FasterVoxelGridDownsampleFilter faster_voxel_filter_;
   /** \brief The input TF frame the data should be transformed into,
    * if input.header.frame_id is different. */
   std::string tf_input_frame_;
@@ -91,6 +96,8 @@ private:
   std::mutex mutex_;
   /** \brief The maximum queue size (default: 3). */
   size_t max_queue_size_ = 3;
+  /** \brief Keep only the newest input cloud while a callback is running. */
+  bool process_latest_only_ = true;
 
   /** \brief check if point cloud is valid */
   /** \param cloud point cloud */
@@ -0,0 +1,430 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "voxel_grid_simd.hpp"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include <string>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define AUTOWARE_DOWNSAMPLE_FILTERS_HAS_AVX2_KERNEL
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#define AUTOWARE_DOWNSAMPLE_FILTERS_HAS_NEON_KERNEL
+#endif
+
+namespace autoware::downsample_filters::simd
+{
+namespace
+{
+inline float load_float(const uint8_t * ptr)
+{
+  float value;
+  std::memcpy(&value, ptr, sizeof(float));
+  return value;
+}
+
+inline int to_voxel_index(const float value, const float inverse_voxel_size, const int min_voxel)
+{
+  return static_cast<int>(std::floor(value * inverse_voxel_size)) - min_voxel;
+}
+
+void update_min_max_scalar(
+  const uint8_t * data, size_t begin, size_t num_points, const PointLayout & layout,
+  Eigen::Vector3f & min_point, Eigen::Vector3f & max_point)
+{
+  for (size_t i = begin; i < num_points; ++i) {
+    const uint8_t * point = data + i * layout.point_step;
+    const Eigen::Vector3f p(
+      load_float(point + layout.x_offset), load_float(point + layout.y_offset),
+      load_float(point + layout.z_offset));
+    if (std::isfinite(p[0]) && std::isfinite(p[1]) && std::isfinite(p[2])) {
+      min_point = min_point.cwiseMin(p);
+      max_point = max_point.cwiseMax(p);
+    }
+  }
+}
+
+void extract_block_scalar(
+  const uint8_t * data, size_t begin, size_t num_points, const PointLayout & layout,
+  const VoxelIndexer & indexer, PointBlock & block)
+{
+  for (size_t i = begin; i < num_points; ++i) {
+    const uint8_t * point = data + i * layout.point_step;
+    const float x = load_float(point + layout.x_offset);
+    const float y = load_float(point + layout.y_offset);
+    const float z = load_float(point + layout.z_offset);
+    block.x[i] = x;
+    block.y[i] = y;
+    block.z[i] = z;
+    block.intensity[i] =
+      layout.intensity_offset >= 0 ? static_cast<float>(point[layout.intensity_offset]) : 0.0f;
+    block.valid[i] = std::isfinite(x) && std::isfinite(y) && std::isfinite(z);
+    if (!block.valid[i]) {
+      continue;
+    }
+    const int ijk0 = to_voxel_index(x, indexer.inverse_voxel_size[0], indexer.min_voxel[0]);
+    const int ijk1 = to_voxel_index(y, indexer.inverse_voxel_size[1], indexer.min_voxel[1]);
+    const int ijk2 = to_voxel_index(z, indexer.inverse_voxel_size[2], indexer.min_voxel[2]);
+    block.voxel_id[i] = ijk0 * indexer.div_b_mul[0] + ijk1 * indexer.div_b_mul[1] +
+                        ijk2 * indexer.div_b_mul[2];
+  }
+}
+
+#ifdef AUTOWARE_DOWNSAMPLE_FILTERS_HAS_AVX2_KERNEL
+constexpr size_t avx2_width = 8;
+
+__attribute__((target("avx2"))) inline __m256i avx2_lane_offsets(const size_t point_step)
+{
+  return _mm256_mullo_epi32(
+    _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(static_cast<int>(point_step)));
+}
+
+__attribute__((target("avx2"))) inline __m256 avx2_gather(
+  const uint8_t * base, const int offset, const __m256i lane_offsets)
+{
+  return _mm256_i32gather_ps(reinterpret_cast<const float *>(base + offset), lane_offsets, 1);
+}
+
+// x - x is 0 only for finite values, both NaN and inf become NaN
+__attribute__((target("avx2"))) inline __m256 avx2_is_finite(const __m256 value)
+{
+  return _mm256_cmp_ps(_mm256_sub_ps(value, value), _mm256_setzero_ps(), _CMP_EQ_OQ);
+}
+
+__attribute__((target("avx2"))) inline float avx2_reduce(
+  const __m256 value, const bool use_max)
+{
+  alignas(32) std::array<float, avx2_width> lanes;
+  _mm256_store_ps(lanes.data(), value);
+  return use_max ? *std::max_element(lanes.begin(), lanes.end())
+                 : *std::min_element(lanes.begin(), lanes.end());
+}
+
+__attribute__((target("avx2"))) void update_min_max_avx2(
+  const uint8_t * data, size_t num_points, const PointLayout & layout,
+  Eigen::Vector3f & min_point, Eigen::Vector3f & max_point)
+{
+  const __m256i lane_offsets = avx2_lane_offsets(layout.point_step);
+  const __m256 positive_max = _mm256_set1_ps(FLT_MAX);
+  const __m256 negative_max = _mm256_set1_ps(-FLT_MAX);
+  __m256 min_x = positive_max, min_y = positive_max, min_z = positive_max;
+  __m256 max_x = negative_max, max_y = negative_max, max_z = negative_max;
+
+  size_t i = 0;
+  for (; i + avx2_width <= num_points; i += avx2_width) {
+    const uint8_t * base = data + i * layout.point_step;
+    const __m256 x = avx2_gather(base, layout.x_offset, lane_offsets);
+    const __m256 y = avx2_gather(base, layout.y_offset, lane_offsets);
+    const __m256 z = avx2_gather(base, layout.z_offset, lane_offsets);
+    const __m256 valid =
+      _mm256_and_ps(_mm256_and_ps(avx2_is_finite(x), avx2_is_finite(y)), avx2_is_finite(z));
+    min_x = _mm256_min_ps(min_x, _mm256_blendv_ps(positive_max, x, valid));
+    min_y = _mm256_min_ps(min_y, _mm256_blendv_ps(positive_max, y, valid));
+    min_z = _mm256_min_ps(min_z, _mm256_blendv_ps(positive_max, z, valid));
+    max_x = _mm256_max_ps(max_x, _mm256_blendv_ps(negative_max, x, valid));
+    max_y = _mm256_max_ps(max_y, _mm256_blendv_ps(negative_max, y, valid));
+    max_z = _mm256_max_ps(max_z, _mm256_blendv_ps(negative_max, z, valid));
+  }
+
+  min_point = min_point.cwiseMin(Eigen::Vector3f(
+    avx2_reduce(min_x, false), avx2_reduce(min_y, false), avx2_reduce(min_z, false)));
+  max_point = max_point.cwiseMax(Eigen::Vector3f(
+    avx2_reduce(max_x, true), avx2_reduce(max_y, true), avx2_reduce(max_z, true)));
+
+  update_min_max_scalar(data, i, num_points, layout, min_point, max_point);
+}
+
+__attribute__((target("avx2"))) inline __m256i avx2_voxel_index(
+  const __m256 value, const __m256 inverse_voxel_size, const __m256i min_voxel)
+{
+  return _mm256_sub_epi32(
+    _mm256_cvttps_epi32(_mm256_floor_ps(_mm256_mul_ps(value, inverse_voxel_size))), min_voxel);
+}
+
+__attribute__((target("avx2"))) void extract_block_avx2(
+  const uint8_t * data, size_t num_points, const PointLayout & layout,
+  const VoxelIndexer & indexer, PointBlock & block)
+{
+  const __m256i lane_offsets = avx2_lane_offsets(layout.point_step);
+  const __m256 inverse_x = _mm256_set1_ps(indexer.inverse_voxel_size[0]);
+  const __m256 inverse_y = _mm256_set1_ps(indexer.inverse_voxel_size[1]);
+  const __m256 inverse_z = _mm256_set1_ps(indexer.inverse_voxel_size[2]);
+  const __m256i min_voxel_x = _mm256_set1_epi32(indexer.min_voxel[0]);
+  const __m256i min_voxel_y = _mm256_set1_epi32(indexer.min_voxel[1]);
+  const __m256i min_voxel_z = _mm256_set1_epi32(indexer.min_voxel[2]);
+  const __m256i mul_x = _mm256_set1_epi32(indexer.div_b_mul[0]);
+  const __m256i mul_y = _mm256_set1_epi32(indexer.div_b_mul[1]);
+  const __m256i mul_z = _mm256_set1_epi32(indexer.div_b_mul[2]);
+  const __m256i intensity_mask = _mm256_set1_epi32(0xFF);
+  const bool has_intensity = layout.intensity_offset >= 0;
+
+  size_t i = 0;
+  for (; i + avx2_width <= num_points; i += avx2_width) {
+    const uint8_t * base = data + i * layout.point_step;
+    const __m256 x = avx2_gather(base, layout.x_offset, lane_offsets);
+    const __m256 y = avx2_gather(base, layout.y_offset, lane_offsets);
+    const __m256 z = avx2_gather(base, layout.z_offset, lane_offsets);
+    __m256 intensity = _mm256_setzero_ps();
+    if (has_intensity) {
+      const __m256i raw = _mm256_i32gather_epi32(
+        reinterpret_cast<const int *>(base + layout.intensity_offset), lane_offsets, 1);
+      intensity = _mm256_cvtepi32_ps(_mm256_and_si256(raw, intensity_mask));
+    }
+    _mm256_store_ps(block.x.data() + i, x);
+    _mm256_store_ps(block.y.data() + i, y);
+    _mm256_store_ps(block.z.data() + i, z);
+    _mm256_store_ps(block.intensity.data() + i, intensity);
+
+    const __m256i ijk0 = avx2_voxel_index(x, inverse_x, min_voxel_x);
+    const __m256i ijk1 = avx2_voxel_index(y, inverse_y, min_voxel_y);
+    const __m256i ijk2 = avx2_voxel_index(z, inverse_z, min_voxel_z);
+    const __m256i voxel_id = _mm256_add_epi32(
+      _mm256_add_epi32(_mm256_mullo_epi32(ijk0, mul_x), _mm256_mullo_epi32(ijk1, mul_y)),
+      _mm256_mullo_epi32(ijk2, mul_z));
+    _mm256_store_si256(reinterpret_cast<__m256i *>(block.voxel_id.data() + i), voxel_id);
+
+    const int valid_bits = _mm256_movemask_ps(
+      _mm256_and_ps(_mm256_and_ps(avx2_is_finite(x), avx2_is_finite(y)), avx2_is_finite(z)));
+    for (size_t lane = 0; lane < avx2_width; ++lane) {
+      block.valid[i + lane] = (valid_bits >> lane) & 1;
+    }
+  }
+
+  extract_block_scalar(data, i, num_points, layout, indexer, block);
+}
+#endif  // AUTOWARE_DOWNSAMPLE_FILTERS_HAS_AVX2_KERNEL
+
+#ifdef AUTOWARE_DOWNSAMPLE_FILTERS_HAS_NEON_KERNEL
+constexpr size_t neon_width = 4;
+
+struct NeonLanes
+{
+  float32x4_t x;
+  float32x4_t y;
+  float32x4_t z;
+  uint32x4_t raw_intensity;
+};
+
+// PointXYZIRC is 16 bytes with x/y/z at the head and intensity in the low byte of the 4th word,
+// so four points can be de-interleaved with a single structured load.
+inline bool is_packed_xyzi_layout(const PointLayout & layout)
+{
+  return layout.point_step == 4 * sizeof(float) && layout.x_offset == 0 && layout.y_offset == 4 &&
+         layout.z_offset == 8 && (layout.intensity_offset == 12 || layout.intensity_offset < 0);
+}
+
+inline NeonLanes neon_load(const uint8_t * base, const PointLayout & layout, const bool packed)
+{
+  NeonLanes lanes;
+  if (packed) {
+    const float32x4x4_t points = vld4q_f32(reinterpret_cast<const float *>(base));
+    lanes.x = points.val[0];
+    lanes.y = points.val[1];
+    lanes.z = points.val[2];
+    lanes.raw_intensity = vreinterpretq_u32_f32(points.val[3]);
+    return lanes;
+  }
+  alignas(16) std::array<float, neon_width> x;
+  alignas(16) std::array<float, neon_width> y;
+  alignas(16) std::array<float, neon_width> z;
+  alignas(16) std::array<uint32_t, neon_width> intensity{};
+  for (size_t lane = 0; lane < neon_width; ++lane) {
+    const uint8_t * point = base + lane * layout.point_step;
+    x[lane] = load_float(point + layout.x_offset);
+    y[lane] = load_float(point + layout.y_offset);
+    z[lane] = load_float(point + layout.z_offset);
+    if (layout.intensity_offset >= 0) {
+      intensity[lane] = point[layout.intensity_offset];
+    }
+  }
+  lanes.x = vld1q_f32(x.data());
+  lanes.y = vld1q_f32(y.data());
+  lanes.z = vld1q_f32(z.data());
+  lanes.raw_intensity = vld1q_u32(intensity.data());
+  return lanes;
+}
+
+inline uint32x4_t neon_is_finite(const float32x4_t value)
+{
+  return vceqq_f32(vsubq_f32(value, value), vdupq_n_f32(0.0f));
+}
+
+inline uint32x4_t neon_is_valid(const NeonLanes & lanes)
+{
+  return vandq_u32(
+    vandq_u32(neon_is_finite(lanes.x), neon_is_finite(lanes.y)), neon_is_finite(lanes.z));
+}
+
+void update_min_max_neon(
+  const uint8_t * data, size_t num_points, const PointLayout & layout,
+  Eigen::Vector3f & min_point, Eigen::Vector3f & max_point)
+{
+  const bool packed = is_packed_xyzi_layout(layout);
+  const float32x4_t positive_max = vdupq_n_f32(FLT_MAX);
+  const float32x4_t negative_max = vdupq_n_f32(-FLT_MAX);
+  float32x4_t min_x = positive_max, min_y = positive_max, min_z = positive_max;
+  float32x4_t max_x = negative_max, max_y = negative_max, max_z = negative_max;
+
+  size_t i = 0;
+  for (; i + neon_width <= num_points; i += neon_width) {
+    const NeonLanes lanes = neon_load(data + i * layout.point_step, layout, packed);
+    const uint32x4_t valid = neon_is_valid(lanes);
+    min_x = vminq_f32(min_x, vbslq_f32(valid, lanes.x, positive_max));
+    min_y = vminq_f32(min_y, vbslq_f32(valid, lanes.y, positive_max));
+    min_z = vminq_f32(min_z, vbslq_f32(valid, lanes.z, positive_max));
+    max_x = vmaxq_f32(max_x, vbslq_f32(valid, lanes.x, negative_max));
+    max_y = vmaxq_f32(max_y, vbslq_f32(valid, lanes.y, negative_max));
+    max_z = vmaxq_f32(max_z, vbslq_f32(valid, lanes.z, negative_max));
+  }
+
+  min_point = min_point.cwiseMin(
+    Eigen::Vector3f(vminvq_f32(min_x), vminvq_f32(min_y), vminvq_f32(min_z)));
+  max_point = max_point.cwiseMax(
+    Eigen::Vector3f(vmaxvq_f32(max_x), vmaxvq_f32(max_y), vmaxvq_f32(max_z)));
+
+  update_min_max_scalar(data, i, num_points, layout, min_point, max_point);
+}
+
+inline int32x4_t neon_voxel_index(
+  const float32x4_t value, const float32x4_t inverse_voxel_size, const int32x4_t min_voxel)
+{
+  return vsubq_s32(vcvtq_s32_f32(vrndmq_f32(vmulq_f32(value, inverse_voxel_size))), min_voxel);
+}
+
+void extract_block_neon(
+  const uint8_t * data, size_t num_points, const PointLayout & layout,
+  const VoxelIndexer & indexer, PointBlock & block)
+{
+  const bool packed = is_packed_xyzi_layout(layout);
+  const float32x4_t inverse_x = vdupq_n_f32(indexer.inverse_voxel_size[0]);
+  const float32x4_t inverse_y = vdupq_n_f32(indexer.inverse_voxel_size[1]);
+  const float32x4_t inverse_z = vdupq_n_f32(indexer.inverse_voxel_size[2]);
+  const int32x4_t min_voxel_x = vdupq_n_s32(indexer.min_voxel[0]);
+  const int32x4_t min_voxel_y = vdupq_n_s32(indexer.min_voxel[1]);
+  const int32x4_t min_voxel_z = vdupq_n_s32(indexer.min_voxel[2]);
+  const int32x4_t mul_x = vdupq_n_s32(indexer.div_b_mul[0]);
+  const int32x4_t mul_y = vdupq_n_s32(indexer.div_b_mul[1]);
+  const int32x4_t mul_z = vdupq_n_s32(indexer.div_b_mul[2]);
+  const uint32x4_t intensity_mask =
+    vdupq_n_u32(layout.intensity_offset >= 0 ? 0xFFU : 0x00U);
+
+  size_t i = 0;
+  for (; i + neon_width <= num_points; i += neon_width) {
+    const NeonLanes lanes = neon_load(data + i * layout.point_step, layout, packed);
+    vst1q_f32(block.x.data() + i, lanes.x);
+    vst1q_f32(block.y.data() + i, lanes.y);
+    vst1q_f32(block.z.data() + i, lanes.z);
+    vst1q_f32(
+      block.intensity.data() + i, vcvtq_f32_u32(vandq_u32(lanes.raw_intensity, intensity_mask)));
+
+    const int32x4_t ijk0 = neon_voxel_index(lanes.x, inverse_x, min_voxel_x);
+    const int32x4_t ijk1 = neon_voxel_index(lanes.y, inverse_y, min_voxel_y);
+    const int32x4_t ijk2 = neon_voxel_index(lanes.z, inverse_z, min_voxel_z);
+    const int32x4_t voxel_id =
+      vmlaq_s32(vmlaq_s32(vmulq_s32(ijk0, mul_x), ijk1, mul_y), ijk2, mul_z);
+    vst1q_u32(block.voxel_id.data() + i, vreinterpretq_u32_s32(voxel_id));
+
+    alignas(16) std::array<uint32_t, neon_width> valid;
+    vst1q_u32(valid.data(), neon_is_valid(lanes));
+    for (size_t lane = 0; lane < neon_width; ++lane) {
+      block.valid[i + lane] = valid[lane] != 0;
+    }
+  }
+
+  extract_block_scalar(data, i, num_points, layout, indexer, block);
+}
+#endif  // AUTOWARE_DOWNSAMPLE_FILTERS_HAS_NEON_KERNEL
+}  // namespace
+
+InstructionSet detect_instruction_set()
+{
+#if defined(AUTOWARE_DOWNSAMPLE_FILTERS_HAS_AVX2_KERNEL)
+  static const InstructionSet detected =
+    __builtin_cpu_supports("avx2") ? InstructionSet::AVX2 : InstructionSet::Scalar;
+  return detected;
+#elif defined(AUTOWARE_DOWNSAMPLE_FILTERS_HAS_NEON_KERNEL)
+  return InstructionSet::NEON;
+#else
+  return InstructionSet::Scalar;
+#endif
+}
+
+std::string to_string(const InstructionSet instruction_set)
+{
+  switch (instruction_set) {
+    case InstructionSet::AVX2:
+      return "avx2";
+    case InstructionSet::NEON:
+      return "neon";
+    default:
+      return "scalar";
+  }
+}
+
+bool is_layout_supported(const PointLayout & layout)
+{
+  const auto fits = [&layout](const int offset) {
+    return offset >= 0 && static_cast<size_t>(offset) + sizeof(float) <= layout.point_step;
+  };
+  return fits(layout.x_offset) && fits(layout.y_offset) && fits(layout.z_offset) &&
+         (layout.intensity_offset < 0 || fits(layout.intensity_offset));
+}
+
+void update_min_max(
+  const uint8_t * data, size_t num_points, const PointLayout & layout,
+  InstructionSet instruction_set, Eigen::Vector3f & min_point, Eigen::Vector3f & max_point)
+{
+#ifdef AUTOWARE_DOWNSAMPLE_FILTERS_HAS_AVX2_KERNEL
+  if (instruction_set == InstructionSet::AVX2) {
+    update_min_max_avx2(data, num_points, layout, min_point, max_point);
+    return;
+  }
+#endif
+#ifdef AUTOWARE_DOWNSAMPLE_FILTERS_HAS_NEON_KERNEL
+  if (instruction_set == InstructionSet::NEON) {
+    update_min_max_neon(data, num_points, layout, min_point, max_point);
+    return;
+  }
+#endif
+  (void)instruction_set;
+  update_min_max_scalar(data, 0, num_points, layout, min_point, max_point);
+}
+
+void extract_block(
+  const uint8_t * data, size_t num_points, const PointLayout & layout,
+  const VoxelIndexer & indexer, InstructionSet instruction_set, PointBlock & block)
+{
+  block.size = std::min(num_points, block_size);
+#ifdef AUTOWARE_DOWNSAMPLE_FILTERS_HAS_AVX2_KERNEL
+  if (instruction_set == InstructionSet::AVX2) {
+    extract_block_avx2(data, block.size, layout, indexer, block);
+    return;
+  }
+#endif
+#ifdef AUTOWARE_DOWNSAMPLE_FILTERS_HAS_NEON_KERNEL
+  if (instruction_set == InstructionSet::NEON) {
+    extract_block_neon(data, block.size, layout, indexer, block);
+    return;
+  }
+#endif
+  (void)instruction_set;
+  extract_block_scalar(data, 0, block.size, layout, indexer, block);
+}
+
+}  // namespace autoware::downsample_filters::simd
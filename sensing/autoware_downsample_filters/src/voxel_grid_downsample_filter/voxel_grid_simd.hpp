@@ -0,0 +1,87 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef VOXEL_GRID_DOWNSAMPLE_FILTER__VOXEL_GRID_SIMD_HPP_
+#define VOXEL_GRID_DOWNSAMPLE_FILTER__VOXEL_GRID_SIMD_HPP_
+
+#include <Eigen/Core>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace autoware::downsample_filters::simd
+{
+
+enum class InstructionSet { Scalar, AVX2, NEON };
+
+/** \brief Return the best instruction set supported by the running CPU. */
+InstructionSet detect_instruction_set();
+
+std::string to_string(InstructionSet instruction_set);
+
+/** \brief Byte layout of the fields read by the kernels. intensity is read as UINT8, and
+ * intensity_offset < 0 means that the cloud has no intensity field. */
+struct PointLayout
+{
+  size_t point_step{0};
+  int x_offset{0};
+  int y_offset{0};
+  int z_offset{0};
+  int intensity_offset{-1};
+};
+
+/** \brief Return whether the vectorized kernels can read the given layout. The kernels load
+ * 4 bytes at every field offset, so each field must be followed by at least 4 bytes of the same
+ * point. */
+bool is_layout_supported(const PointLayout & layout);
+
+/** \brief Parameters for mapping a point to its flattened voxel index. */
+struct VoxelIndexer
+{
+  Eigen::Vector3f inverse_voxel_size;
+  Eigen::Vector3i min_voxel;
+  Eigen::Vector3i div_b_mul;
+};
+
+/** \brief Number of points extracted by a single call of extract_block(). */
+constexpr size_t block_size = 256;
+
+/** \brief Structure-of-arrays output of extract_block(). valid[i] is 0 when any of x/y/z of the
+ * i-th point is not finite, in which case voxel_id[i] is undefined. */
+struct PointBlock
+{
+  alignas(32) std::array<float, block_size> x;
+  alignas(32) std::array<float, block_size> y;
+  alignas(32) std::array<float, block_size> z;
+  alignas(32) std::array<float, block_size> intensity;
+  alignas(32) std::array<uint32_t, block_size> voxel_id;
+  alignas(32) std::array<uint8_t, block_size> valid;
+  size_t size{0};
+};
+
+/** \brief Update min_point/max_point with the finite points in data[0, num_points). */
+void update_min_max(
+  const uint8_t * data, size_t num_points, const PointLayout & layout,
+  InstructionSet instruction_set, Eigen::Vector3f & min_point, Eigen::Vector3f & max_point);
+
+/** \brief Extract x/y/z/intensity and the voxel index of at most block_size points. */
+void extract_block(
+  const uint8_t * data, size_t num_points, const PointLayout & layout,
+  const VoxelIndexer & indexer, InstructionSet instruction_set, PointBlock & block);
+
+}  // namespace autoware::downsample_filters::simd
+
+#endif  // VOXEL_GRID_DOWNSAMPLE_FILTER__VOXEL_GRID_SIMD_HPP_
@@ -0,0 +1,237 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Time per frame, allocations per frame and points per second of the downsample filters.
+// The synthetic frames emulate a 128 beam lidar at 50k, 150k and 300k points. A recorded
+// PointXYZIRC frame is benchmarked as well when AUTOWARE_POINTCLOUD_BENCHMARK_PCD is set.
+
+#include "../src/fused_preprocessing_filter/crop_box_voxel_grid_filter.hpp"
+#include "../src/random_downsample_filter/random_point_sampler.hpp"
+#include "../src/voxel_grid_downsample_filter/faster_voxel_grid_downsample_filter.hpp"
+
+#include <autoware/point_types/types.hpp>
+#include <rclcpp/rclcpp.hpp>
+
+#include <pcl/io/pcd_io.h>
+#include <pcl_conversions/pcl_conversions.h>
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <new>
+#include <random>
+#include <string>
+
+namespace
+{
+std::atomic<std::size_t> allocation_count{0};
+}  // namespace
+
+// count the heap allocations of the whole binary, the counter is read around the measured loop
+void * operator new(std::size_t size)
+{
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  if (void * ptr = std::malloc(size == 0 ? 1 : size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void * ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void * ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+namespace
+{
+using autoware::downsample_filters::CentroidAccumulator;
+using autoware::downsample_filters::CropBoxVoxelGridFilter;
+using autoware::downsample_filters::FasterVoxelGridDownsampleFilter;
+using autoware::downsample_filters::RandomPointSampler;
+using autoware::downsample_filters::TransformInfo;
+using autoware::point_types::PointXYZIRC;
+using sensor_msgs::msg::PointCloud2;
+
+constexpr std::size_t num_rings = 128;
+constexpr int64_t recorded_frame = 0;
+
+// Emulate a spinning lidar with num_rings beams: a ground plane and a few walls and objects
+PointCloud2::ConstSharedPtr generate_lidar_cloud(const std::size_t num_points)
+{
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<float> range_dist(1.0f, 120.0f);
+  std::uniform_real_distribution<float> noise_dist(-0.02f, 0.02f);
+
+  const std::size_t num_azimuths = num_points / num_rings;
+  pcl::PointCloud<PointXYZIRC> cloud;
+  cloud.reserve(num_azimuths * num_rings);
+  for (std::size_t azimuth_index = 0; azimuth_index < num_azimuths; ++azimuth_index) {
+    const float azimuth = 2.0f * M_PI * azimuth_index / num_azimuths;
+    for (std::size_t ring = 0; ring < num_rings; ++ring) {
+      const float elevation = -0.4f + 0.6f * ring / num_rings;
+      // the downward beams hit the ground 2 m below the sensor, the others a random obstacle
+      const float range =
+        elevation < -0.05f ? -2.0f / std::sin(elevation) + noise_dist(engine) : range_dist(engine);
+      PointXYZIRC point;
+      point.x = range * std::cos(elevation) * std::cos(azimuth);
+      point.y = range * std::cos(elevation) * std::sin(azimuth);
+      point.z = range * std::sin(elevation);
+      point.intensity = static_cast<std::uint8_t>((azimuth_index + ring) % 256);
+      point.channel = static_cast<std::uint16_t>(ring);
+      cloud.push_back(point);
+    }
+  }
+
+  auto msg = std::make_shared<PointCloud2>();
+  pcl::toROSMsg(cloud, *msg);
+  msg->header.frame_id = "base_link";
+  return msg;
+}
+
+PointCloud2::ConstSharedPtr load_recorded_cloud()
+{
+  const char * pcd_path = std::getenv("AUTOWARE_POINTCLOUD_BENCHMARK_PCD");
+  if (pcd_path == nullptr) {
+    return nullptr;
+  }
+  pcl::PointCloud<PointXYZIRC> cloud;
+  if (pcl::io::loadPCDFile(std::string(pcd_path), cloud) != 0) {
+    return nullptr;
+  }
+  auto msg = std::make_shared<PointCloud2>();
+  pcl::toROSMsg(cloud, *msg);
+  msg->header.frame_id = "base_link";
+  return msg;
+}
+
+// the frames are generated once and shared by all benchmarks of the same size
+const PointCloud2::ConstSharedPtr & get_input(const int64_t num_points)
+{
+  static std::map<int64_t, PointCloud2::ConstSharedPtr> inputs;
+  auto & input = inputs[num_points];
+  if (!input) {
+    input = num_points == recorded_frame ? load_recorded_cloud()
+                                         : generate_lidar_cloud(static_cast<size_t>(num_points));
+  }
+  return input;
+}
+
+// run one frame per iteration and report the allocations per frame and the points per second
+template <typename ProcessFrame>
+void run_frames(
+  benchmark::State & state, const PointCloud2 & input, ProcessFrame && process_frame)
+{
+  // warm up the reusable buffers so that the steady state is measured
+  process_frame();
+
+  const std::size_t allocations_before = allocation_count.load(std::memory_order_relaxed);
+  for (auto _ : state) {
+    process_frame();
+  }
+  const std::size_t allocations = allocation_count.load(std::memory_order_relaxed) -
+                                  allocations_before;
+
+  state.SetItemsProcessed(state.iterations() * input.width * input.height);
+  state.counters["allocations"] =
+    benchmark::Counter(static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+}
+
+void voxel_grid(
+  benchmark::State & state, const int64_t num_points, const bool simd_enabled,
+  const CentroidAccumulator accumulator, const int num_threads)
+{
+  const auto & input = get_input(num_points);
+  const auto logger = rclcpp::get_logger("benchmark_downsample_filters");
+  FasterVoxelGridDownsampleFilter filter;
+  filter.set_voxel_size(0.3f, 0.3f, 0.1f);
+  filter.set_field_offsets(input, logger);
+  filter.set_simd_enabled(simd_enabled);
+  filter.set_centroid_accumulator(accumulator);
+  filter.set_parallel_config(num_threads, 0);
+  PointCloud2 output;
+  run_frames(state, *input, [&]() { filter.filter(input, output, TransformInfo(), logger); });
+}
+
+void random_sampler(
+  benchmark::State & state, const int64_t num_points, const bool azimuth_stratified)
+{
+  const auto & input = get_input(num_points);
+  RandomPointSampler sampler;
+  sampler.set_sample_num(input->width * input->height / 4);
+  PointCloud2 output;
+  run_frames(state, *input, [&]() {
+    if (azimuth_stratified) {
+      sampler.sample_azimuth_stratified(*input, output);
+    } else {
+      sampler.sample_reservoir(*input, output);
+    }
+  });
+}
+
+void crop_box_voxel_grid(benchmark::State & state, const int64_t num_points)
+{
+  const auto & input = get_input(num_points);
+  const auto logger = rclcpp::get_logger("benchmark_downsample_filters");
+  CropBoxVoxelGridFilter filter;
+  filter.set_voxel_size(0.3f, 0.3f, 0.1f);
+  CropBoxVoxelGridFilter::CropBox crop_box;
+  crop_box.min_point = Eigen::Vector3f(-50.0f, -50.0f, -3.0f);
+  crop_box.max_point = Eigen::Vector3f(50.0f, 50.0f, 3.0f);
+  filter.set_crop_box(crop_box);
+  PointCloud2 output;
+  run_frames(state, *input, [&]() {
+    filter.filter(*input, output, TransformInfo(), TransformInfo(), logger);
+  });
+}
+
+void register_benchmarks(const int64_t num_points)
+{
+  const std::string suffix =
+    num_points == recorded_frame ? "/recorded" : "/" + std::to_string(num_points);
+  const auto add = [&](const std::string & name, auto && function, auto &&... args) {
+    benchmark::RegisterBenchmark((name + suffix).c_str(), function, num_points, args...)
+      ->Unit(benchmark::kMillisecond);
+  };
+
+  add("voxel_grid/scalar", voxel_grid, false, CentroidAccumulator::UnorderedMap, 1);
+  add("voxel_grid/simd", voxel_grid, true, CentroidAccumulator::UnorderedMap, 1);
+  add("voxel_grid/simd_radix_sort", voxel_grid, true, CentroidAccumulator::RadixSort, 1);
+  add("voxel_grid/simd_open_addressing", voxel_grid, true, CentroidAccumulator::OpenAddressing, 1);
+  add("voxel_grid/simd_radix_sort_4_threads", voxel_grid, true, CentroidAccumulator::RadixSort, 4);
+  add("random_sampler/reservoir", random_sampler, false);
+  add("random_sampler/azimuth_stratified", random_sampler, true);
+  add("crop_box_voxel_grid", crop_box_voxel_grid);
+}
+
+const bool benchmarks_registered = []() {
+  for (const int64_t num_points : {50000, 150000, 300000}) {
+    register_benchmarks(num_points);
+  }
+  if (get_input(recorded_frame)) {
+    register_benchmarks(recorded_frame);
+  }
+  return true;
+}();
+
+}  // namespace
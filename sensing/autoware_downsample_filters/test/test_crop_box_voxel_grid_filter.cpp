@@ -0,0 +1,126 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../src/fused_preprocessing_filter/crop_box_voxel_grid_filter.hpp"
+
+#include <autoware/point_types/types.hpp>
+
+#include <pcl_conversions/pcl_conversions.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+using autoware::downsample_filters::CropBoxVoxelGridFilter;
+using autoware::downsample_filters::TransformInfo;
+using autoware::point_types::PointXYZIRC;
+using sensor_msgs::msg::PointCloud2;
+
+PointXYZIRC make_point(float x, float y, float z, std::uint8_t intensity)
+{
+  PointXYZIRC point;
+  point.x = x;
+  point.y = y;
+  point.z = z;
+  point.intensity = intensity;
+  return point;
+}
+
+std::vector<PointXYZIRC> run_filter(
+  const pcl::PointCloud<PointXYZIRC> & input_cloud, const bool negative,
+  const TransformInfo & preprocess_transform = TransformInfo(),
+  const TransformInfo & postprocess_transform = TransformInfo())
+{
+  PointCloud2 input;
+  pcl::toROSMsg(input_cloud, input);
+
+  CropBoxVoxelGridFilter filter;
+  filter.set_voxel_size(1.0f, 1.0f, 1.0f);
+  CropBoxVoxelGridFilter::CropBox crop_box;
+  crop_box.min_point = Eigen::Vector3f(-5.0f, -5.0f, -5.0f);
+  crop_box.max_point = Eigen::Vector3f(5.0f, 5.0f, 5.0f);
+  crop_box.negative = negative;
+  filter.set_crop_box(crop_box);
+
+  PointCloud2 output;
+  EXPECT_TRUE(filter.filter(
+    input, output, preprocess_transform, postprocess_transform,
+    rclcpp::get_logger("test_crop_box_voxel_grid_filter")));
+
+  pcl::PointCloud<PointXYZIRC> output_cloud;
+  pcl::fromROSMsg(output, output_cloud);
+  std::vector<PointXYZIRC> points(output_cloud.begin(), output_cloud.end());
+  std::sort(points.begin(), points.end(), [](const auto & a, const auto & b) {
+    return std::tie(a.x, a.y, a.z) < std::tie(b.x, b.y, b.z);
+  });
+  return points;
+}
+
+pcl::PointCloud<PointXYZIRC> make_input_cloud()
+{
+  pcl::PointCloud<PointXYZIRC> cloud;
+  // two points sharing a voxel inside the box
+  cloud.push_back(make_point(0.2f, 0.2f, 0.2f, 10));
+  cloud.push_back(make_point(0.6f, 0.6f, 0.6f, 30));
+  // another voxel inside the box
+  cloud.push_back(make_point(3.5f, -2.5f, 1.5f, 50));
+  // outside of the box
+  cloud.push_back(make_point(8.5f, 0.5f, 0.5f, 70));
+  cloud.push_back(make_point(-20.5f, 0.5f, 0.5f, 90));
+  // invalid point
+  cloud.push_back(make_point(std::numeric_limits<float>::quiet_NaN(), 0.0f, 0.0f, 0));
+  return cloud;
+}
+}  // namespace
+
+TEST(CropBoxVoxelGridFilterTest, KeepsCentroidsInsideBox)
+{
+  const auto points = run_filter(make_input_cloud(), false);
+
+  ASSERT_EQ(points.size(), 2U);
+  EXPECT_EQ(points.at(0), make_point(0.4f, 0.4f, 0.4f, 20));
+  EXPECT_EQ(points.at(1), make_point(3.5f, -2.5f, 1.5f, 50));
+}
+
+TEST(CropBoxVoxelGridFilterTest, KeepsCentroidsOutsideBoxWhenNegative)
+{
+  const auto points = run_filter(make_input_cloud(), true);
+
+  ASSERT_EQ(points.size(), 2U);
+  EXPECT_EQ(points.at(0), make_point(-20.5f, 0.5f, 0.5f, 90));
+  EXPECT_EQ(points.at(1), make_point(8.5f, 0.5f, 0.5f, 70));
+}
+
+TEST(CropBoxVoxelGridFilterTest, AppliesPreprocessAndPostprocessTransforms)
+{
+  // Move the points by +2 m along x before cropping, and back by -2 m after voxelization
+  TransformInfo preprocess_transform;
+  preprocess_transform.eigen_transform(0, 3) = 2.0f;
+  preprocess_transform.need_transform = true;
+  TransformInfo postprocess_transform;
+  postprocess_transform.eigen_transform(0, 3) = -2.0f;
+  postprocess_transform.need_transform = true;
+
+  const auto points =
+    run_filter(make_input_cloud(), false, preprocess_transform, postprocess_transform);
+
+  // (3.5, -2.5, 1.5) is moved to x = 5.5, which is outside of the box
+  ASSERT_EQ(points.size(), 1U);
+  EXPECT_EQ(points.at(0), make_point(0.4f, 0.4f, 0.4f, 20));
+}
@@ -0,0 +1,178 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../src/voxel_grid_downsample_filter/faster_voxel_grid_downsample_filter.hpp"
+
+#include <autoware/point_types/types.hpp>
+#include <rclcpp/rclcpp.hpp>
+
+#include <pcl_conversions/pcl_conversions.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <random>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+using autoware::downsample_filters::CentroidAccumulator;
+using autoware::downsample_filters::FasterVoxelGridDownsampleFilter;
+using autoware::downsample_filters::TransformInfo;
+using autoware::point_types::PointXYZIRC;
+using sensor_msgs::msg::PointCloud2;
+
+// Emulate a spinning lidar with `num_rings` beams and `num_azimuths` firings per revolution
+PointCloud2::ConstSharedPtr generate_lidar_cloud(
+  const size_t num_rings, const size_t num_azimuths, const bool with_invalid_points)
+{
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<float> range_dist(1.0f, 120.0f);
+
+  pcl::PointCloud<PointXYZIRC> cloud;
+  for (size_t azimuth_index = 0; azimuth_index < num_azimuths; ++azimuth_index) {
+    const float azimuth = 2.0f * M_PI * azimuth_index / num_azimuths;
+    for (size_t ring = 0; ring < num_rings; ++ring) {
+      const float elevation = -0.4f + 0.6f * ring / num_rings;
+      const float range = range_dist(engine);
+      PointXYZIRC point;
+      point.x = range * std::cos(elevation) * std::cos(azimuth);
+      point.y = range * std::cos(elevation) * std::sin(azimuth);
+      point.z = range * std::sin(elevation);
+      point.intensity = static_cast<std::uint8_t>((azimuth_index + ring) % 256);
+      point.channel = static_cast<std::uint16_t>(ring);
+      if (with_invalid_points && (azimuth_index * num_rings + ring) % 37 == 0) {
+        point.x = std::numeric_limits<float>::quiet_NaN();
+      }
+      cloud.push_back(point);
+    }
+  }
+
+  auto msg = std::make_shared<PointCloud2>();
+  pcl::toROSMsg(cloud, *msg);
+  msg->header.frame_id = "base_link";
+  return msg;
+}
+
+PointCloud2 run_filter(
+  const PointCloud2::ConstSharedPtr & input, const bool simd_enabled,
+  const CentroidAccumulator accumulator = CentroidAccumulator::UnorderedMap,
+  const int num_threads = 1)
+{
+  const auto logger = rclcpp::get_logger("test_faster_voxel_grid_downsample_filter");
+  FasterVoxelGridDownsampleFilter filter;
+  filter.set_voxel_size(0.3f, 0.3f, 0.1f);
+  filter.set_field_offsets(input, logger);
+  filter.set_simd_enabled(simd_enabled);
+  filter.set_centroid_accumulator(accumulator);
+  filter.set_parallel_config(num_threads, 0);
+  PointCloud2 output;
+  filter.filter(input, output, TransformInfo(), logger);
+  return output;
+}
+
+std::vector<PointXYZIRC> to_sorted_points(const PointCloud2 & msg)
+{
+  pcl::PointCloud<PointXYZIRC> cloud;
+  pcl::fromROSMsg(msg, cloud);
+  std::vector<PointXYZIRC> points(cloud.begin(), cloud.end());
+  std::sort(points.begin(), points.end(), [](const auto & a, const auto & b) {
+    return std::tie(a.x, a.y, a.z) < std::tie(b.x, b.y, b.z);
+  });
+  return points;
+}
+}  // namespace
+
+TEST(FasterVoxelGridDownsampleFilterTest, SimdMatchesScalar)
+{
+  const auto input = generate_lidar_cloud(32, 500, true);
+
+  const auto scalar_output = run_filter(input, false);
+  const auto simd_output = run_filter(input, true);
+
+  ASSERT_GT(scalar_output.width, 0U);
+  ASSERT_EQ(scalar_output.width, simd_output.width);
+  EXPECT_EQ(scalar_output.data, simd_output.data);
+}
+
+TEST(FasterVoxelGridDownsampleFilterTest, AccumulatorsProduceSameCentroids)
+{
+  const auto input = generate_lidar_cloud(32, 500, true);
+
+  const auto expected =
+    to_sorted_points(run_filter(input, true, CentroidAccumulator::UnorderedMap));
+  ASSERT_FALSE(expected.empty());
+  for (const auto accumulator :
+       {CentroidAccumulator::RadixSort, CentroidAccumulator::OpenAddressing}) {
+    const auto actual = to_sorted_points(run_filter(input, true, accumulator));
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+      EXPECT_EQ(expected[i], actual[i]);
+    }
+  }
+}
+
+TEST(FasterVoxelGridDownsampleFilterTest, OpenAddressingTableIsReusedAcrossClouds)
+{
+  const auto logger = rclcpp::get_logger("test_faster_voxel_grid_downsample_filter");
+  const auto large_input = generate_lidar_cloud(32, 500, false);
+  const auto small_input = generate_lidar_cloud(4, 10, false);
+
+  FasterVoxelGridDownsampleFilter filter;
+  filter.set_voxel_size(0.3f, 0.3f, 0.1f);
+  filter.set_centroid_accumulator(CentroidAccumulator::OpenAddressing);
+  filter.set_field_offsets(large_input, logger);
+
+  // Voxels of a previous cloud must not leak into the next one
+  PointCloud2 output;
+  filter.filter(large_input, output, TransformInfo(), logger);
+  filter.filter(small_input, output, TransformInfo(), logger);
+  EXPECT_EQ(
+    to_sorted_points(output).size(), to_sorted_points(run_filter(small_input, true)).size());
+}
+
+TEST(FasterVoxelGridDownsampleFilterTest, ParallelOutputIsDeterministic)
+{
+  const auto input = generate_lidar_cloud(32, 500, true);
+
+  const auto first_output = run_filter(input, true, CentroidAccumulator::UnorderedMap, 4);
+  const auto second_output = run_filter(input, true, CentroidAccumulator::UnorderedMap, 4);
+  EXPECT_EQ(first_output.data, second_output.data);
+
+  // The partial sums are added in a different order, so only the centroids are compared
+  const auto expected = to_sorted_points(run_filter(input, true));
+  const auto actual = to_sorted_points(first_output);
+  ASSERT_EQ(expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_NEAR(expected[i].x, actual[i].x, 1e-3);
+    EXPECT_NEAR(expected[i].y, actual[i].y, 1e-3);
+    EXPECT_NEAR(expected[i].z, actual[i].z, 1e-3);
+  }
+}
+
+TEST(FasterVoxelGridDownsampleFilterTest, InvalidPointsAreDropped)
+{
+  const auto input = generate_lidar_cloud(4, 10, true);
+  const auto output = run_filter(input, true);
+
+  pcl::PointCloud<PointXYZIRC> cloud;
+  pcl::fromROSMsg(output, cloud);
+  for (const auto & point : cloud) {
+    EXPECT_TRUE(std::isfinite(point.x) && std::isfinite(point.y) && std::isfinite(point.z));
+  }
+}
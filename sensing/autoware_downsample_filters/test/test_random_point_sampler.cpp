@@ -0,0 +1,161 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../src/random_downsample_filter/random_point_sampler.hpp"
+
+#include <autoware/point_types/types.hpp>
+
+#include <pcl_conversions/pcl_conversions.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+namespace
+{
+using autoware::downsample_filters::RandomPointSampler;
+using autoware::point_types::PointXYZIRC;
+using sensor_msgs::msg::PointCloud2;
+
+PointXYZIRC make_point(float x, float y, float z, std::uint8_t intensity)
+{
+  PointXYZIRC point;
+  point.x = x;
+  point.y = y;
+  point.z = z;
+  point.intensity = intensity;
+  return point;
+}
+
+/** \brief A dense ring of points in front of the sensor and a sparse one behind it. The index of
+ * each point is encoded in its z coordinate. */
+PointCloud2 make_unbalanced_cloud(size_t num_front, size_t num_back)
+{
+  pcl::PointCloud<PointXYZIRC> cloud;
+  for (size_t i = 0; i < num_front; ++i) {
+    const float angle = -0.5f + static_cast<float>(i) / static_cast<float>(num_front);
+    const auto index = static_cast<float>(cloud.size());
+    cloud.push_back(make_point(5.0f * std::cos(angle), 5.0f * std::sin(angle), index, 1));
+  }
+  for (size_t i = 0; i < num_back; ++i) {
+    const float angle = 2.64f + static_cast<float>(i) / static_cast<float>(num_back);
+    const auto index = static_cast<float>(cloud.size());
+    cloud.push_back(make_point(50.0f * std::cos(angle), 50.0f * std::sin(angle), index, 2));
+  }
+  PointCloud2 msg;
+  pcl::toROSMsg(cloud, msg);
+  return msg;
+}
+
+std::vector<PointXYZIRC> to_points(const PointCloud2 & msg)
+{
+  pcl::PointCloud<PointXYZIRC> cloud;
+  pcl::fromROSMsg(msg, cloud);
+  return std::vector<PointXYZIRC>(cloud.begin(), cloud.end());
+}
+
+void expect_distinct_and_ordered(const std::vector<PointXYZIRC> & points)
+{
+  for (size_t i = 1; i < points.size(); ++i) {
+    EXPECT_LT(points[i - 1].z, points[i].z);
+  }
+}
+}  // namespace
+
+TEST(RandomPointSamplerTest, ReservoirSamplesDistinctPointsInInputOrder)
+{
+  const auto input = make_unbalanced_cloud(1000, 10);
+  RandomPointSampler sampler(42);
+  sampler.set_sample_num(100);
+
+  PointCloud2 output;
+  sampler.sample_reservoir(input, output);
+
+  EXPECT_EQ(output.width, 100U);
+  EXPECT_EQ(output.point_step, input.point_step);
+  EXPECT_EQ(output.fields.size(), input.fields.size());
+  expect_distinct_and_ordered(to_points(output));
+}
+
+TEST(RandomPointSamplerTest, ReservoirKeepsSmallClouds)
+{
+  const auto input = make_unbalanced_cloud(20, 5);
+  RandomPointSampler sampler;
+  sampler.set_sample_num(100);
+
+  PointCloud2 output;
+  sampler.sample_reservoir(input, output);
+
+  EXPECT_EQ(output.data, input.data);
+}
+
+TEST(RandomPointSamplerTest, ReservoirIsDeterministicForSameSeed)
+{
+  const auto input = make_unbalanced_cloud(1000, 10);
+  RandomPointSampler sampler_a(7);
+  RandomPointSampler sampler_b(7);
+  sampler_a.set_sample_num(50);
+  sampler_b.set_sample_num(50);
+
+  PointCloud2 output_a;
+  PointCloud2 output_b;
+  for (int i = 0; i < 3; ++i) {
+    sampler_a.sample_reservoir(input, output_a);
+    sampler_b.sample_reservoir(input, output_b);
+    EXPECT_EQ(output_a.data, output_b.data);
+  }
+}
+
+TEST(RandomPointSamplerTest, AzimuthStratifiedDoesNotStarveSparseSectors)
+{
+  const auto input = make_unbalanced_cloud(10000, 40);
+  RandomPointSampler sampler(1);
+  sampler.set_sample_num(200);
+  sampler.set_azimuth_sectors(8);
+
+  PointCloud2 output;
+  sampler.sample_azimuth_stratified(input, output);
+
+  const auto points = to_points(output);
+  ASSERT_EQ(points.size(), 200U);
+  expect_distinct_and_ordered(points);
+  // the sparse ring spans two sectors, so it receives a quarter of the budget, which is more than
+  // it has. Uniform sampling would keep about one of its points.
+  size_t num_back = 0;
+  for (const auto & point : points) {
+    num_back += point.intensity == 2;
+  }
+  EXPECT_EQ(num_back, 40U);
+}
+
+TEST(RandomPointSamplerTest, AzimuthStratifiedDropsInvalidPoints)
+{
+  pcl::PointCloud<PointXYZIRC> cloud;
+  cloud.push_back(make_point(1.0f, 0.0f, 0.0f, 0));
+  cloud.push_back(make_point(std::nanf(""), 0.0f, 1.0f, 0));
+  cloud.push_back(make_point(-1.0f, 0.0f, 2.0f, 0));
+  PointCloud2 input;
+  pcl::toROSMsg(cloud, input);
+
+  RandomPointSampler sampler;
+  sampler.set_sample_num(10);
+  PointCloud2 output;
+  sampler.sample_azimuth_stratified(input, output);
+
+  const auto points = to_points(output);
+  ASSERT_EQ(points.size(), 2U);
+  EXPECT_FLOAT_EQ(points[0].z, 0.0f);
+  EXPECT_FLOAT_EQ(points[1].z, 2.0f);
+}
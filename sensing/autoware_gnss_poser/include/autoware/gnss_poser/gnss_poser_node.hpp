@@ -14,6 +14,7 @@
 #ifndef AUTOWARE__GNSS_POSER__GNSS_POSER_NODE_HPP_
 #define AUTOWARE__GNSS_POSER__GNSS_POSER_NODE_HPP_
 
+#include <autoware/geography_utils/projection.hpp>
 #include <rclcpp/rclcpp.hpp>
 #include <tf2/transform_datatypes.hpp>
 
@@ -30,6 +31,8 @@
 #include <tf2_ros/transform_broadcaster.h>
 #include <tf2_ros/transform_listener.h>
 
+#include <memory>
+#include <optional>
 #include <string>
 
 namespace autoware::gnss_poser
@@ -81,6 +84,9 @@ private:
   rclcpp::Publisher<autoware_internal_debug_msgs::msg::BoolStamped>::SharedPtr fixed_pub_;
 
   autoware_map_msgs::msg::MapProjectorInfo projector_info_;
+  std::unique_ptr<autoware::geography_utils::Projector> projector_;
+  std::optional<tf2::Transform> tf_gnss_antenna2base_link_;
+  std::string tf_gnss_antenna2base_link_frame_;
   const std::string base_frame_;
   const std::string gnss_base_frame_;
   const std::string map_frame_;
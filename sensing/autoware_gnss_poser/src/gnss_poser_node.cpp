@@ -15,7 +15,6 @@
 #include "autoware/gnss_poser/gnss_poser_node.hpp"
 
 #include <autoware/geography_utils/height.hpp>
-#include <autoware/geography_utils/projection.hpp>
 
 #include <autoware_sensing_msgs/msg/gnss_ins_orientation_stamped.hpp>
 
@@ -74,6 +73,12 @@ void GNSSPoser::callback_map_projector_info(
 {
   projector_info_ = *msg;
   received_map_projector_info_ = true;
+
+  // created once, the fixes are projected with it; the local type has no projector
+  projector_.reset();
+  if (projector_info_.projector_type != autoware_map_msgs::msg::MapProjectorInfo::LOCAL) {
+    projector_ = std::make_unique<autoware::geography_utils::Projector>(projector_info_);
+  }
 }
 
 void GNSSPoser::callback_nav_sat_fix(
@@ -116,8 +121,7 @@ void GNSSPoser::callback_nav_sat_fix(
   gps_point.latitude = nav_sat_fix_msg_ptr->latitude;
   gps_point.longitude = nav_sat_fix_msg_ptr->longitude;
   gps_point.altitude = nav_sat_fix_msg_ptr->altitude;
-  geometry_msgs::msg::Point position =
-    autoware::geography_utils::project_forward(gps_point, projector_info_);
+  geometry_msgs::msg::Point position = projector_->forward(gps_point);
   position.z = autoware::geography_utils::convert_height(
     position.z, gps_point.latitude, gps_point.longitude,
     autoware_map_msgs::msg::MapProjectorInfo::WGS84, projector_info_.vertical_datum);
@@ -158,17 +162,27 @@ void GNSSPoser::callback_nav_sat_fix(
   tf2::fromMsg(gnss_antenna_pose, tf_map2gnss_antenna);
 
   // get TF from gnss_antenna to base_link
-  auto tf_gnss_antenna2base_link_msg_ptr = std::make_shared<geometry_msgs::msg::TransformStamped>();
-
-  const std::string gnss_frame = nav_sat_fix_msg_ptr->header.frame_id;
-  get_static_transform(
-    gnss_frame, base_frame_, tf_gnss_antenna2base_link_msg_ptr, nav_sat_fix_msg_ptr->header.stamp);
+  // the antenna is fixed on the vehicle, so the TF is looked up again only when the frame of the
+  // fix changes or the previous lookup failed
+  const std::string & gnss_frame = nav_sat_fix_msg_ptr->header.frame_id;
   tf2::Transform tf_gnss_antenna2base_link{};
-  tf2::fromMsg(tf_gnss_antenna2base_link_msg_ptr->transform, tf_gnss_antenna2base_link);
+  if (tf_gnss_antenna2base_link_ && gnss_frame == tf_gnss_antenna2base_link_frame_) {
+    tf_gnss_antenna2base_link = *tf_gnss_antenna2base_link_;
+  } else {
+    auto tf_gnss_antenna2base_link_msg_ptr =
+      std::make_shared<geometry_msgs::msg::TransformStamped>();
+    const bool is_found = get_static_transform(
+      gnss_frame, base_frame_, tf_gnss_antenna2base_link_msg_ptr,
+      nav_sat_fix_msg_ptr->header.stamp);
+    tf2::fromMsg(tf_gnss_antenna2base_link_msg_ptr->transform, tf_gnss_antenna2base_link);
+    if (is_found) {
+      tf_gnss_antenna2base_link_ = tf_gnss_antenna2base_link;
+      tf_gnss_antenna2base_link_frame_ = gnss_frame;
+    }
+  }
 
   // transform pose from gnss_antenna(in map frame) to base_link(in map frame)
-  tf2::Transform tf_map2base_link{};
-  tf_map2base_link = tf_map2gnss_antenna * tf_gnss_antenna2base_link;
+  const tf2::Transform tf_map2base_link = tf_map2gnss_antenna * tf_gnss_antenna2base_link;
 
   geometry_msgs::msg::PoseStamped gnss_base_pose_msg{};
   gnss_base_pose_msg.header.stamp = nav_sat_fix_msg_ptr->header.stamp;
@@ -228,7 +242,7 @@ bool GNSSPoser::can_get_covariance(const sensor_msgs::msg::NavSatFix & nav_sat_f
 geometry_msgs::msg::Point GNSSPoser::get_median_position(
   const boost::circular_buffer<geometry_msgs::msg::Point> & position_buffer)
 {
-  auto get_median = [](std::vector<double> array) {
+  auto get_median = [](std::vector<double> & array) {
     std::sort(std::begin(array), std::end(array));
     const size_t median_index = array.size() / 2;
     double median = (array.size() % 2)
@@ -240,6 +254,9 @@ geometry_msgs::msg::Point GNSSPoser::get_median_position(
   std::vector<double> array_x;
   std::vector<double> array_y;
   std::vector<double> array_z;
+  array_x.reserve(position_buffer.size());
+  array_y.reserve(position_buffer.size());
+  array_z.reserve(position_buffer.size());
   for (const auto & position : position_buffer) {
     array_x.push_back(position.x);
     array_y.push_back(position.y);
@@ -256,22 +273,16 @@ geometry_msgs::msg::Point GNSSPoser::get_median_position(
 geometry_msgs::msg::Point GNSSPoser::get_average_position(
   const boost::circular_buffer<geometry_msgs::msg::Point> & position_buffer)
 {
-  std::vector<double> array_x;
-  std::vector<double> array_y;
-  std::vector<double> array_z;
+  geometry_msgs::msg::Point average_point;
   for (const auto & position : position_buffer) {
-    array_x.push_back(position.x);
-    array_y.push_back(position.y);
-    array_z.push_back(position.z);
+    average_point.x += position.x;
+    average_point.y += position.y;
+    average_point.z += position.z;
   }
-
-  geometry_msgs::msg::Point average_point;
-  average_point.x =
-    std::reduce(array_x.begin(), array_x.end()) / static_cast<double>(array_x.size());
-  average_point.y =
-    std::reduce(array_y.begin(), array_y.end()) / static_cast<double>(array_y.size());
-  average_point.z =
-    std::reduce(array_z.begin(), array_z.end()) / static_cast<double>(array_z.size());
+  const auto size = static_cast<double>(position_buffer.size());
+  average_point.x /= size;
+  average_point.y /= size;
+  average_point.z /= size;
   return average_point;
 }
 
@@ -0,0 +1,361 @@
+#!/usr/bin/env python3
+
+# Copyright 2025 TIER IV, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Replays the sensor topics of a rosbag through Autoware Core on the simulated clock, and reports
+# the latencies published by its nodes, the end-to-end latency from the sensor to the control
+# command and the CPU usage of its processes.
+
+import bisect
+import os
+import sys
+import threading
+import time
+
+from autoware_control_msgs.msg import Control
+from autoware_localization_msgs.srv import InitializeLocalization
+from autoware_planning_msgs.msg import Trajectory
+from autoware_planning_msgs.srv import SetLaneletRoute
+from diagnostic_msgs.msg import DiagnosticArray
+from geometry_msgs.msg import PoseWithCovarianceStamped
+from nav_msgs.msg import Odometry
+import rclpy
+from rclpy.executors import SingleThreadedExecutor
+from rclpy.node import Node
+from rclpy.qos import DurabilityPolicy
+from rclpy.qos import QoSProfile
+from rclpy.serialization import deserialize_message
+from rclpy.time import Time
+import rosbag2_py
+from rosgraph_msgs.msg import Clock
+from rosidl_runtime_py.utilities import get_message
+import yaml
+
+# the topics of the processing times and the latencies published by the nodes
+LATENCY_TOPIC_SUFFIXES = ("/processing_time_ms", "/exe_time_ms", "/pipeline_latency_ms")
+LATENCY_TOPIC_TYPES = (
+    "autoware_internal_debug_msgs/msg/Float64Stamped",
+    "autoware_internal_debug_msgs/msg/Float32Stamped",
+)
+
+
+def compute_statistics(values):
+    """Return the count, the mean, the nearest rank percentiles and the max of the values."""
+    if not values:
+        return None
+    values = sorted(values)
+
+    def percentile(p):
+        return values[max(0, min(len(values) - 1, int(round(p / 100.0 * len(values))) - 1))]
+
+    return {
+        "count": len(values),
+        "mean": sum(values) / len(values),
+        "p50": percentile(50),
+        "p90": percentile(90),
+        "p99": percentile(99),
+        "max": values[-1],
+    }
+
+
+def read_process_cpu_times():
+    """Return the CPU time [s] of the ROS processes by their node name, or container name."""
+    tick = os.sysconf("SC_CLK_TCK")
+    cpu_times = {}
+    for pid in filter(str.isdigit, os.listdir("/proc")):
+        try:
+            with open(f"/proc/{pid}/cmdline", "rb") as f:
+                args = f.read().decode(errors="replace").split("\0")
+            with open(f"/proc/{pid}/stat") as f:
+                # the fields after the command name, which may contain spaces
+                fields = f.read().rsplit(")", 1)[1].split()
+        except OSError:
+            continue
+        names = [arg[len("__node:=") :] for arg in args if arg.startswith("__node:=")]
+        namespaces = [arg[len("__ns:=") :] for arg in args if arg.startswith("__ns:=")]
+        if not names:
+            continue
+        name = (namespaces[0].rstrip("/") if namespaces else "") + "/" + names[0]
+        # utime and stime, the 14th and 15th fields of the stat
+        cpu_times[name] = cpu_times.get(name, 0.0) + (int(fields[11]) + int(fields[12])) / tick
+    return cpu_times
+
+
+def find_regressions(report, baseline, tolerance):
+    """Return the descriptions of the p99 latencies and CPU usages above the baseline."""
+    regressions = []
+
+    def compare(name, value, base_value):
+        if base_value > 0.0 and value > base_value * (1.0 + tolerance):
+            regressions.append(f"{name}: {value:.3f} > {base_value:.3f} * (1 + {tolerance})")
+
+    for group in ("end_to_end_ms", "latency_ms"):
+        for name, statistics in report.get(group, {}).items():
+            base_statistics = baseline.get(group, {}).get(name)
+            if statistics and base_statistics:
+                compare(f"{group}/{name}/p99", statistics["p99"], base_statistics["p99"])
+    for name, usage in report.get("cpu_percent", {}).items():
+        if name in baseline.get("cpu_percent", {}):
+            compare(f"cpu_percent/{name}", usage, baseline["cpu_percent"][name])
+    return regressions
+
+
+class ReplayBenchmark(Node):
+    def __init__(self):
+        super().__init__("replay_benchmark")
+        self.bag_path = self.declare_parameter("bag_path", "").value
+        self.rate = self.declare_parameter("rate", 1.0).value
+        self.replayed_topics = self.declare_parameter("replayed_topics", [""]).value
+        self.initial_pose_topic = self.declare_parameter("initial_pose_topic", "").value
+        self.route_topic = self.declare_parameter("route_topic", "").value
+        self.sensor_topic = self.declare_parameter("sensor_topic", "").value
+        trajectory_topic = self.declare_parameter("trajectory_topic", "").value
+        control_topic = self.declare_parameter("control_topic", "").value
+        self.wait_nodes = set(self.declare_parameter("wait_nodes", [""]).value) - {""}
+        self.startup_timeout = self.declare_parameter("startup_timeout", 60.0).value
+        self.initialize_offset = self.declare_parameter("initialize_offset", 1.0).value
+        self.route_offset = self.declare_parameter("route_offset", 3.0).value
+        self.warmup = self.declare_parameter("warmup", 5.0).value
+        self.drain = self.declare_parameter("drain", 2.0).value
+        self.output_path = self.declare_parameter("output_path", "replay_benchmark.yaml").value
+        self.baseline_path = self.declare_parameter("baseline_path", "").value
+        self.tolerance = self.declare_parameter("tolerance", 0.1).value
+
+        # the measurements, on the monotonic wall clock
+        self.is_measuring = False
+        self.sensor_times = []
+        self.trajectory_times = []
+        self.control_times = []
+        self.latencies = {}
+        self.ready_nodes = set()
+
+        self.pub_clock = self.create_publisher(Clock, "/clock", 10)
+        self.client_initialize = self.create_client(
+            InitializeLocalization, "/localization/initialize"
+        )
+        self.client_set_route = self.create_client(SetLaneletRoute, "/planning/set_lanelet_route")
+        self.create_subscription(
+            DiagnosticArray,
+            "/startup_timeline",
+            self.on_startup_timeline,
+            QoSProfile(depth=64, durability=DurabilityPolicy.TRANSIENT_LOCAL),
+        )
+        self.create_subscription(
+            Trajectory, trajectory_topic, lambda _: self.record(self.trajectory_times), 10
+        )
+        self.create_subscription(
+            Control, control_topic, lambda _: self.record(self.control_times), 10
+        )
+        # the nodes publish their latency topics as they start, so they are discovered periodically
+        self.create_timer(1.0, self.subscribe_latency_topics)
+
+    def record(self, times):
+        if self.is_measuring:
+            times.append(time.monotonic())
+
+    def on_startup_timeline(self, msg):
+        self.ready_nodes.update(status.name for status in msg.status)
+
+    def subscribe_latency_topics(self):
+        for name, types in self.get_topic_names_and_types():
+            if name in self.latencies or not name.endswith(LATENCY_TOPIC_SUFFIXES):
+                continue
+            if types[0] not in LATENCY_TOPIC_TYPES:
+                continue
+            values = self.latencies[name] = []
+            self.create_subscription(
+                get_message(types[0]),
+                name,
+                lambda msg, values=values: values.append(msg.data) if self.is_measuring else None,
+                10,
+            )
+
+    def wait_for_startup(self):
+        deadline = time.monotonic() + self.startup_timeout
+        while not self.wait_nodes <= self.ready_nodes:
+            if time.monotonic() > deadline:
+                self.get_logger().warn(
+                    f"start without {sorted(self.wait_nodes - self.ready_nodes)}, "
+                    "whose startup timeline was not published"
+                )
+                return
+            time.sleep(0.1)
+
+    def read_first_message(self, topic):
+        reader = open_bag(self.bag_path)
+        types = {topic.name: topic.type for topic in reader.get_all_topics_and_types()}
+        if topic not in types:
+            return None
+        reader.set_filter(rosbag2_py.StorageFilter(topics=[topic]))
+        if not reader.has_next():
+            return None
+        _, data, _ = reader.read_next()
+        return deserialize_message(data, get_message(types[topic]))
+
+    def request_initialization(self):
+        msg = self.read_first_message(self.initial_pose_topic)
+        if msg is None:
+            self.get_logger().warn(f"no initial pose on {self.initial_pose_topic} in the bag")
+            return
+        if isinstance(msg, Odometry):
+            pose = PoseWithCovarianceStamped(header=msg.header, pose=msg.pose)
+        else:
+            pose = msg
+        self.client_initialize.call_async(InitializeLocalization.Request(pose=[pose]))
+
+    def request_route(self):
+        msg = self.read_first_message(self.route_topic)
+        if msg is None:
+            self.get_logger().warn(f"no route on {self.route_topic} in the bag")
+            return
+        request = SetLaneletRoute.Request(
+            header=msg.header,
+            goal_pose=msg.goal_pose,
+            segments=msg.segments,
+            allow_modification=msg.allow_modification,
+        )
+        self.client_set_route.call_async(request)
+
+    def replay(self):
+        reader = open_bag(self.bag_path)
+        types = {topic.name: topic.type for topic in reader.get_all_topics_and_types()}
+        topics = [topic for topic in self.replayed_topics if topic in types]
+        for topic in set(self.replayed_topics) - set(topics) - {""}:
+            self.get_logger().warn(f"{topic} is not in the bag")
+        reader.set_filter(rosbag2_py.StorageFilter(topics=topics))
+        publishers = {
+            topic: self.create_publisher(get_message(types[topic]), topic, 10) for topic in topics
+        }
+
+        start_time = None
+        wall_start_time = time.monotonic()
+        # the actions at their offset from the start of the bag, in bag time
+        events = [
+            (self.initialize_offset, self.request_initialization),
+            (self.route_offset, self.request_route),
+            (self.warmup, lambda: setattr(self, "is_measuring", True)),
+        ]
+        events.sort(key=lambda event: event[0])
+        while reader.has_next():
+            topic, data, stamp = reader.read_next()
+            if start_time is None:
+                start_time = stamp
+            elapsed = (stamp - start_time) * 1e-9
+            if self.rate > 0.0:
+                time.sleep(max(0.0, wall_start_time + elapsed / self.rate - time.monotonic()))
+            while events and events[0][0] <= elapsed:
+                events.pop(0)[1]()
+            self.pub_clock.publish(Clock(clock=Time(nanoseconds=stamp).to_msg()))
+            # the serialized message is published as is
+            publishers[topic].publish(data)
+            if topic == self.sensor_topic:
+                self.record(self.sensor_times)
+        return time.monotonic() - wall_start_time
+
+    def create_report(self, duration, cpu_percent):
+        # the first trajectory and the first control command published after each sensor frame
+        sensor_to_trajectory = []
+        sensor_to_control = []
+        for sensor_time in self.sensor_times:
+            i = bisect.bisect_right(self.trajectory_times, sensor_time)
+            if i == len(self.trajectory_times):
+                break
+            trajectory_time = self.trajectory_times[i]
+            sensor_to_trajectory.append((trajectory_time - sensor_time) * 1e3)
+            j = bisect.bisect_right(self.control_times, trajectory_time)
+            if j < len(self.control_times):
+                sensor_to_control.append((self.control_times[j] - sensor_time) * 1e3)
+        return {
+            "bag_path": self.bag_path,
+            "rate": self.rate,
+            "duration_s": duration,
+            "end_to_end_ms": {
+                "sensor_to_trajectory": compute_statistics(sensor_to_trajectory),
+                "sensor_to_control": compute_statistics(sensor_to_control),
+            },
+            "latency_ms": {
+                name: compute_statistics(values)
+                for name, values in sorted(self.latencies.items())
+                if values
+            },
+            "cpu_percent": cpu_percent,
+        }
+
+    def run(self):
+        self.wait_for_startup()
+        cpu_times = read_process_cpu_times()
+        duration = self.replay()
+        time.sleep(self.drain)
+        self.is_measuring = False
+        duration += self.drain
+        cpu_percent = {
+            name: 100.0 * (cpu_time - cpu_times[name]) / duration
+            for name, cpu_time in sorted(read_process_cpu_times().items())
+            if name in cpu_times and name != self.get_fully_qualified_name()
+        }
+        report = self.create_report(duration, cpu_percent)
+        with open(self.output_path, "w") as f:
+            yaml.safe_dump(report, f, sort_keys=False)
+        self.get_logger().info(f"report written to {self.output_path}")
+        self.log_report(report)
+
+        if not self.baseline_path:
+            return True
+        with open(self.baseline_path) as f:
+            baseline = yaml.safe_load(f)
+        regressions = find_regressions(report, baseline, self.tolerance)
+        for regression in regressions:
+            self.get_logger().error(f"regression of {regression}")
+        return not regressions
+
+    def log_report(self, report):
+        for group in ("end_to_end_ms", "latency_ms"):
+            for name, statistics in report[group].items():
+                if statistics:
+                    self.get_logger().info(
+                        "{}: p50 {p50:.2f} p90 {p90:.2f} p99 {p99:.2f} max {max:.2f} [ms] "
+                        "({count} samples)".format(name, **statistics)
+                    )
+        for name, usage in report["cpu_percent"].items():
+            self.get_logger().info(f"{name}: {usage:.1f} [%CPU]")
+
+
+def open_bag(bag_path):
+    reader = rosbag2_py.SequentialReader()
+    reader.open(
+        rosbag2_py.StorageOptions(uri=bag_path),
+        rosbag2_py.ConverterOptions(input_serialization_format="", output_serialization_format=""),
+    )
+    return reader
+
+
+def main():
+    rclpy.init(args=sys.argv)
+    node = ReplayBenchmark()
+    executor = SingleThreadedExecutor()
+    executor.add_node(node)
+    spin_thread = threading.Thread(target=executor.spin, daemon=True)
+    spin_thread.start()
+    try:
+        succeeded = node.run()
+    finally:
+        executor.shutdown()
+        node.destroy_node()
+        rclpy.try_shutdown()
+    sys.exit(0 if succeeded else 1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,329 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__PLANNING_TEST_MANAGER__AUTOWARE_PLANNING_PERFORMANCE_TEST_MANAGER_HPP_
+#define AUTOWARE__PLANNING_TEST_MANAGER__AUTOWARE_PLANNING_PERFORMANCE_TEST_MANAGER_HPP_
+
+#include <autoware_test_utils/allocation_counter.hpp>
+#include <autoware_test_utils/autoware_test_utils.hpp>
+#include <rclcpp/rclcpp.hpp>
+
+#include <time.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace autoware::planning_test_manager
+{
+/// @brief performance of a node driven by PlanningPerformanceTestManager, per cycle with output
+struct PerformanceReport
+{
+  std::string node_name;
+  size_t cycle_num{0};
+  size_t output_num{0};
+  double latency_p50_ms{0.0};
+  double latency_p99_ms{0.0};
+  double latency_max_ms{0.0};
+  double cpu_time_ms{0.0};
+  double allocation_num{0.0};
+  double allocated_kbytes{0.0};
+  // p50 latency of the last quarter of the cycles over that of the first quarter, which grows when
+  // the inputs queue up faster than the node processes them
+  double latency_growth{1.0};
+};
+
+/// @brief bounds of the performance of a node driven with stress inputs
+struct StressLimits
+{
+  double max_latency_p99_ms{100.0};
+  double min_output_ratio{1.0};  // ratio of the cycles with an output
+  double max_latency_growth{1.5};
+};
+
+/**
+ * @brief Drives a planning node at a fixed rate and measures the processing of each cycle.
+ * @details The inputs given by publishCyclicInput() are published with a new stamp at every cycle,
+ * then the executor of the target node is spun until the output is received. The wall time, the
+ * CPU time and the allocations of these spins are the cost of the callbacks of the target node in
+ * the cycle, since the test node is spun by another executor. The executable has to link
+ * autoware_test_utils_allocation_counter, and only the allocations of the thread of the executor
+ * are counted.
+ */
+class PlanningPerformanceTestManager
+{
+public:
+  explicit PlanningPerformanceTestManager(const double rate = 10.0) : rate_(rate)
+  {
+    test_node_ = std::make_shared<rclcpp::Node>("planning_performance_test_node");
+  }
+
+  /// @brief publish an input once, e.g. the map or the route
+  template <typename InputT>
+  void publishInput(
+    const rclcpp::Node::SharedPtr target_node, const std::string & topic_name,
+    const InputT & input, const int repeat_count = 3) const
+  {
+    autoware::test_utils::publishToTargetNode(
+      test_node_, target_node, topic_name, {}, input, repeat_count);
+  }
+
+  /**
+   * @brief publish an input at each cycle, or at its own rate if it is positive, with the stamp of
+   * the publication if it has a header
+   * @details the inputs at their own rate are also published between the cycles, e.g. a point
+   * cloud at 20 Hz for a planner at 10 Hz
+   */
+  template <typename InputT>
+  void publishCyclicInput(
+    const std::string & topic_name, const InputT & input, const double rate = 0.0)
+  {
+    typename rclcpp::Publisher<InputT>::SharedPtr publisher;
+    autoware::test_utils::createPublisherWithQoS(test_node_, topic_name, publisher);
+    CyclicInput cyclic_input;
+    cyclic_input.publish = [publisher, input](const rclcpp::Time & now) mutable {
+      if constexpr (has_header<InputT>::value) {
+        input.header.stamp = now;
+      }
+      publisher->publish(input);
+    };
+    if (rate > 0.0) {
+      cyclic_input.period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(1.0 / rate));
+    }
+    cyclic_inputs_.push_back(std::move(cyclic_input));
+  }
+
+  template <typename OutputT>
+  void subscribeOutput(const std::string & topic_name)
+  {
+    output_subs_.push_back(test_node_->create_subscription<OutputT>(
+      topic_name, rclcpp::QoS{1},
+      [this](const typename OutputT::ConstSharedPtr) { ++received_output_num_; }));
+  }
+
+  /**
+   * @brief drive the target node for cycle_num cycles after warm_up_cycle_num cycles which are
+   * not measured
+   */
+  PerformanceReport run(
+    const rclcpp::Node::SharedPtr target_node, const size_t cycle_num,
+    const size_t warm_up_cycle_num = 10)
+  {
+    rclcpp::executors::SingleThreadedExecutor target_executor;
+    rclcpp::executors::SingleThreadedExecutor test_executor;
+    target_executor.add_node(target_node);
+    test_executor.add_node(test_node_);
+
+    PerformanceReport report;
+    report.node_name = target_node->get_fully_qualified_name();
+    report.cycle_num = cycle_num;
+
+    std::vector<double> latencies_ms;
+    double cpu_time_ms = 0.0;
+    autoware::test_utils::AllocationStats allocation_stats;
+    const auto period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+      std::chrono::duration<double>(1.0 / rate_));
+    auto cycle_start_time = std::chrono::steady_clock::now();
+    for (auto & input : cyclic_inputs_) {
+      input.next_publish_time = cycle_start_time;
+    }
+    for (size_t i = 0; i < warm_up_cycle_num + cycle_num; ++i) {
+      for (auto & input : cyclic_inputs_) {
+        if (input.period == std::chrono::steady_clock::duration::zero()) {
+          input.publish(test_node_->now());
+        }
+      }
+      publish_due_inputs();
+
+      // the target node is spun until its output is received or the cycle ends
+      const auto output_num = received_output_num_;
+      double latency_ms = 0.0;
+      double cycle_cpu_time_ms = 0.0;
+      autoware::test_utils::AllocationStats cycle_allocation_stats;
+      while (received_output_num_ == output_num &&
+             std::chrono::steady_clock::now() < cycle_start_time + period) {
+        const auto cpu_time_start = get_thread_cpu_time_ms();
+        const auto start_time = std::chrono::steady_clock::now();
+        const auto stats =
+          autoware::test_utils::count_allocations([&]() { target_executor.spin_some(); });
+        latency_ms += std::chrono::duration<double, std::milli>(
+                        std::chrono::steady_clock::now() - start_time)
+                        .count();
+        cycle_cpu_time_ms += get_thread_cpu_time_ms() - cpu_time_start;
+        cycle_allocation_stats.allocation_count += stats.allocation_count;
+        cycle_allocation_stats.allocated_bytes += stats.allocated_bytes;
+
+        test_executor.spin_some();
+        if (received_output_num_ == output_num) {
+          rclcpp::sleep_for(std::chrono::milliseconds(1));
+        }
+        publish_due_inputs();
+      }
+
+      if (i >= warm_up_cycle_num && received_output_num_ != output_num) {
+        latencies_ms.push_back(latency_ms);
+        cpu_time_ms += cycle_cpu_time_ms;
+        allocation_stats.allocation_count += cycle_allocation_stats.allocation_count;
+        allocation_stats.allocated_bytes += cycle_allocation_stats.allocated_bytes;
+      }
+
+      // the inputs published until the next cycle wait in the queues of the target node
+      cycle_start_time += period;
+      while (true) {
+        auto wake_up_time = cycle_start_time;
+        for (const auto & input : cyclic_inputs_) {
+          if (input.period != std::chrono::steady_clock::duration::zero()) {
+            wake_up_time = std::min(wake_up_time, input.next_publish_time);
+          }
+        }
+        std::this_thread::sleep_until(wake_up_time);
+        if (wake_up_time == cycle_start_time) {
+          break;
+        }
+        publish_due_inputs();
+      }
+    }
+
+    report.output_num = latencies_ms.size();
+    if (latencies_ms.empty()) {
+      return report;
+    }
+    const auto output_num = static_cast<double>(latencies_ms.size());
+    if (latencies_ms.size() >= 4) {
+      const auto quarter_num = static_cast<std::ptrdiff_t>(latencies_ms.size() / 4);
+      std::vector<double> first_quarter(latencies_ms.begin(), latencies_ms.begin() + quarter_num);
+      std::vector<double> last_quarter(latencies_ms.end() - quarter_num, latencies_ms.end());
+      std::sort(first_quarter.begin(), first_quarter.end());
+      std::sort(last_quarter.begin(), last_quarter.end());
+      const auto first_p50_ms = get_percentile(first_quarter, 0.5);
+      if (first_p50_ms > 0.0) {
+        report.latency_growth = get_percentile(last_quarter, 0.5) / first_p50_ms;
+      }
+    }
+    std::sort(latencies_ms.begin(), latencies_ms.end());
+    report.latency_p50_ms = get_percentile(latencies_ms, 0.5);
+    report.latency_p99_ms = get_percentile(latencies_ms, 0.99);
+    report.latency_max_ms = latencies_ms.back();
+    report.cpu_time_ms = cpu_time_ms / output_num;
+    report.allocation_num = static_cast<double>(allocation_stats.allocation_count) / output_num;
+    report.allocated_kbytes =
+      static_cast<double>(allocation_stats.allocated_bytes) / 1024.0 / output_num;
+    return report;
+  }
+
+  static void printReport(const PerformanceReport & report)
+  {
+    std::printf(
+      "%s: %zu/%zu cycles with output, latency p50 %.3f ms, p99 %.3f ms, max %.3f ms, "
+      "CPU time %.3f ms, %.1f allocations of %.1f kB, latency growth %.2f\n",
+      report.node_name.c_str(), report.output_num, report.cycle_num, report.latency_p50_ms,
+      report.latency_p99_ms, report.latency_max_ms, report.cpu_time_ms, report.allocation_num,
+      report.allocated_kbytes, report.latency_growth);
+  }
+
+  /// @brief the descriptions of the limits exceeded by the report, empty if it is within them
+  static std::vector<std::string> checkStressLimits(
+    const PerformanceReport & report, const StressLimits & limits)
+  {
+    std::vector<std::string> violations;
+    const auto output_ratio = report.cycle_num == 0 ? 0.0
+                                                    : static_cast<double>(report.output_num) /
+                                                        static_cast<double>(report.cycle_num);
+    if (output_ratio < limits.min_output_ratio) {
+      violations.push_back(
+        "output in " + std::to_string(report.output_num) + " of " +
+        std::to_string(report.cycle_num) + " cycles");
+    }
+    if (report.latency_p99_ms > limits.max_latency_p99_ms) {
+      violations.push_back(
+        "p99 latency of " + std::to_string(report.latency_p99_ms) + " ms above " +
+        std::to_string(limits.max_latency_p99_ms) + " ms");
+    }
+    if (report.latency_growth > limits.max_latency_growth) {
+      violations.push_back(
+        "latency growth of " + std::to_string(report.latency_growth) + " above " +
+        std::to_string(limits.max_latency_growth) + ", the inputs queue up");
+    }
+    return violations;
+  }
+
+  rclcpp::Node::SharedPtr getTestNode() const { return test_node_; }
+
+private:
+  template <typename T, typename = void>
+  struct has_header : std::false_type
+  {
+  };
+  template <typename T>
+  struct has_header<T, std::void_t<decltype(std::declval<T>().header.stamp)>> : std::true_type
+  {
+  };
+
+  struct CyclicInput
+  {
+    std::function<void(const rclcpp::Time &)> publish;
+    // zero for the inputs published at each cycle
+    std::chrono::steady_clock::duration period{std::chrono::steady_clock::duration::zero()};
+    std::chrono::steady_clock::time_point next_publish_time;
+  };
+
+  // publish the inputs at their own rate whose time has come, without catching up the missed ones
+  void publish_due_inputs()
+  {
+    const auto now = std::chrono::steady_clock::now();
+    for (auto & input : cyclic_inputs_) {
+      if (
+        input.period == std::chrono::steady_clock::duration::zero() ||
+        now < input.next_publish_time) {
+        continue;
+      }
+      input.publish(test_node_->now());
+      input.next_publish_time = std::max(input.next_publish_time + input.period, now);
+    }
+  }
+
+  static double get_thread_cpu_time_ms()
+  {
+    timespec time{};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+    return static_cast<double>(time.tv_sec) * 1e3 + static_cast<double>(time.tv_nsec) * 1e-6;
+  }
+
+  // nearest rank of the sorted values
+  static double get_percentile(const std::vector<double> & sorted_values, const double ratio)
+  {
+    const auto rank =
+      static_cast<size_t>(std::ceil(ratio * static_cast<double>(sorted_values.size())));
+    return sorted_values.at(std::clamp<size_t>(rank, 1, sorted_values.size()) - 1);
+  }
+
+  double rate_;
+  rclcpp::Node::SharedPtr test_node_;
+  std::vector<CyclicInput> cyclic_inputs_;
+  std::vector<rclcpp::SubscriptionBase::SharedPtr> output_subs_;
+  size_t received_output_num_{0};
+};
+}  // namespace autoware::planning_test_manager
+
+#endif  // AUTOWARE__PLANNING_TEST_MANAGER__AUTOWARE_PLANNING_PERFORMANCE_TEST_MANAGER_HPP_
@@ -0,0 +1,190 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__PYPLOT__RECORDER_HPP_
+#define AUTOWARE__PYPLOT__RECORDER_HPP_
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace autoware::pyplot
+{
+inline namespace recorder
+{
+/**
+ * @brief argument of a recorded command, converted to a python object only when rendered
+ */
+class Value
+{
+public:
+  using Variant = std::variant<bool, int64_t, double, std::string, std::vector<double>>;
+
+  Value(const bool value) : value_(value) {}  // NOLINT(runtime/explicit)
+
+  template <
+    typename T, std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>, int> = 0>
+  Value(const T value) : value_(static_cast<int64_t>(value))  // NOLINT(runtime/explicit)
+  {
+  }
+
+  template <typename T, std::enable_if_t<std::is_floating_point_v<T>, int> = 0>
+  Value(const T value) : value_(static_cast<double>(value))  // NOLINT(runtime/explicit)
+  {
+  }
+
+  Value(const char * value) : value_(std::string{value}) {}  // NOLINT(runtime/explicit)
+
+  Value(std::string value) : value_(std::move(value)) {}  // NOLINT(runtime/explicit)
+
+  Value(std::vector<double> value) : value_(std::move(value)) {}  // NOLINT(runtime/explicit)
+
+  template <
+    typename T,
+    std::enable_if_t<std::is_arithmetic_v<T> && !std::is_same_v<T, double>, int> = 0>
+  Value(const std::vector<T> & value)  // NOLINT(runtime/explicit)
+  : value_(std::vector<double>(value.begin(), value.end()))
+  {
+  }
+
+  const Variant & get() const { return value_; }
+
+private:
+  Variant value_;
+};
+
+using RecordedArgs = std::vector<Value>;
+using RecordedKwargs = std::vector<std::pair<std::string, Value>>;
+
+/**
+ * @brief a call of a function of matplotlib.pyplot, or of a method of an axes created by a
+ * recorded subplots()
+ */
+struct Command
+{
+  std::optional<size_t> axes;  //!< @brief index of the axes, or nullopt for matplotlib.pyplot
+  std::string function;
+  RecordedArgs args;
+  RecordedKwargs kwargs;
+};
+
+/**
+ * @brief handle of an axes created by Recorder::subplots()
+ */
+struct AxesHandle
+{
+  size_t index;
+};
+
+/**
+ * @brief Records the plot commands as C++ values without touching python, so that the plots of
+ * hot code are rendered later by render() or a RenderWorker without distorting its timing.
+ * @details The recorder is not thread safe, each thread records to its own recorder.
+ */
+class Recorder
+{
+public:
+  /// @brief record a function of matplotlib.pyplot, e.g. call("savefig", {"plot.png"})
+  void call(const std::string & function, RecordedArgs args = {}, RecordedKwargs kwargs = {});
+
+  /// @brief record a method of an axes, e.g. call(axes, "set_aspect", {"equal"})
+  void call(
+    const AxesHandle & axes, const std::string & function, RecordedArgs args = {},
+    RecordedKwargs kwargs = {});
+
+  /// @brief record plt.subplots(rows, cols), the handles of its axes are in row-major order
+  std::vector<AxesHandle> subplots(
+    const size_t rows = 1, const size_t cols = 1, RecordedKwargs kwargs = {});
+
+  void plot(
+    const std::vector<double> & x, const std::vector<double> & y, RecordedKwargs kwargs = {});
+
+  void plot(
+    const AxesHandle & axes, const std::vector<double> & x, const std::vector<double> & y,
+    RecordedKwargs kwargs = {});
+
+  void scatter(
+    const std::vector<double> & x, const std::vector<double> & y, RecordedKwargs kwargs = {});
+
+  void scatter(
+    const AxesHandle & axes, const std::vector<double> & x, const std::vector<double> & y,
+    RecordedKwargs kwargs = {});
+
+  /// @brief record plt.savefig(path) followed by plt.close(), so that the next commands draw on a
+  /// new figure
+  void savefig(const std::string & path, RecordedKwargs kwargs = {});
+
+  const std::vector<Command> & commands() const { return commands_; }
+
+  /// @brief move the recorded commands out, the handles of the axes are invalidated
+  std::vector<Command> take();
+
+private:
+  std::vector<Command> commands_;
+  size_t axes_num_{0};
+};
+
+/**
+ * @brief Renders the recorded commands with matplotlib.pyplot.
+ * @details The python interpreter must be initialized and the GIL held by the calling thread.
+ * @throw pybind11::error_already_set if a command fails in python.
+ */
+void render(const std::vector<Command> & commands);
+
+/**
+ * @brief Renders the recordings on its own thread, which owns the python interpreter of the
+ * process and uses the non-interactive Agg backend.
+ * @details No other python interpreter can be alive in the process. The failed recordings are
+ * reported on stderr.
+ */
+class RenderWorker
+{
+public:
+  RenderWorker();
+
+  /// @brief render the pending recordings and stop the thread
+  ~RenderWorker();
+
+  RenderWorker(const RenderWorker &) = delete;
+  RenderWorker & operator=(const RenderWorker &) = delete;
+
+  /// @brief queue a recording, which is rendered in the order of submission
+  void submit(std::vector<Command> commands);
+
+  /// @brief block until the submitted recordings are rendered
+  void wait();
+
+private:
+  void run();
+
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::deque<std::vector<Command>> queue_;
+  bool is_rendering_{false};
+  bool is_stopped_{false};
+  std::thread thread_;
+};
+}  // namespace recorder
+}  // namespace autoware::pyplot
+
+#endif  // AUTOWARE__PYPLOT__RECORDER_HPP_
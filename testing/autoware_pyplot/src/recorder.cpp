@@ -0,0 +1,85 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <autoware/pyplot/recorder.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace autoware::pyplot
+{
+inline namespace recorder
+{
+void Recorder::call(const std::string & function, RecordedArgs args, RecordedKwargs kwargs)
+{
+  commands_.push_back(Command{std::nullopt, function, std::move(args), std::move(kwargs)});
+}
+
+void Recorder::call(
+  const AxesHandle & axes, const std::string & function, RecordedArgs args, RecordedKwargs kwargs)
+{
+  commands_.push_back(Command{axes.index, function, std::move(args), std::move(kwargs)});
+}
+
+std::vector<AxesHandle> Recorder::subplots(
+  const size_t rows, const size_t cols, RecordedKwargs kwargs)
+{
+  call("subplots", {rows, cols}, std::move(kwargs));
+  std::vector<AxesHandle> axes;
+  for (size_t i = 0; i < rows * cols; ++i) {
+    axes.push_back(AxesHandle{axes_num_++});
+  }
+  return axes;
+}
+
+void Recorder::plot(
+  const std::vector<double> & x, const std::vector<double> & y, RecordedKwargs kwargs)
+{
+  call("plot", {x, y}, std::move(kwargs));
+}
+
+void Recorder::plot(
+  const AxesHandle & axes, const std::vector<double> & x, const std::vector<double> & y,
+  RecordedKwargs kwargs)
+{
+  call(axes, "plot", {x, y}, std::move(kwargs));
+}
+
+void Recorder::scatter(
+  const std::vector<double> & x, const std::vector<double> & y, RecordedKwargs kwargs)
+{
+  call("scatter", {x, y}, std::move(kwargs));
+}
+
+void Recorder::scatter(
+  const AxesHandle & axes, const std::vector<double> & x, const std::vector<double> & y,
+  RecordedKwargs kwargs)
+{
+  call(axes, "scatter", {x, y}, std::move(kwargs));
+}
+
+void Recorder::savefig(const std::string & path, RecordedKwargs kwargs)
+{
+  call("savefig", {path}, std::move(kwargs));
+  call("close");
+}
+
+std::vector<Command> Recorder::take()
+{
+  axes_num_ = 0;
+  return std::exchange(commands_, {});
+}
+}  // namespace recorder
+}  // namespace autoware::pyplot
@@ -0,0 +1,155 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <autoware/pyplot/recorder.hpp>
+#include <pybind11/embed.h>
+#include <pybind11/pybind11.h>
+
+#include <exception>
+#include <iostream>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace autoware::pyplot
+{
+inline namespace recorder
+{
+namespace
+{
+pybind11::object to_python(const Value & value)
+{
+  return std::visit(
+    [](const auto & v) -> pybind11::object {
+      using T = std::decay_t<decltype(v)>;
+      if constexpr (std::is_same_v<T, std::vector<double>>) {
+        pybind11::list list(v.size());
+        for (size_t i = 0; i < v.size(); ++i) {
+          list[i] = pybind11::float_(v[i]);
+        }
+        return std::move(list);
+      } else {
+        return pybind11::cast(v);
+      }
+    },
+    value.get());
+}
+}  // namespace
+
+void render(const std::vector<Command> & commands)
+{
+  const auto plt = pybind11::module::import("matplotlib.pyplot");
+  // the axes of the recorded subplots, in the order of their handles
+  std::vector<pybind11::object> axes;
+  for (const auto & command : commands) {
+    pybind11::tuple args(command.args.size());
+    for (size_t i = 0; i < command.args.size(); ++i) {
+      args[i] = to_python(command.args[i]);
+    }
+    pybind11::dict kwargs;
+    for (const auto & [key, value] : command.kwargs) {
+      kwargs[pybind11::str(key)] = to_python(value);
+    }
+
+    if (command.axes) {
+      axes.at(*command.axes).attr(command.function.c_str())(*args, **kwargs);
+      continue;
+    }
+    const auto result = plt.attr(command.function.c_str())(*args, **kwargs);
+    if (command.function == "subplots") {
+      // the axes are a single object for 1x1 subplots, or an array otherwise
+      const pybind11::object subplot_axes =
+        pybind11::reinterpret_borrow<pybind11::tuple>(result)[1];
+      if (pybind11::hasattr(subplot_axes, "flatten")) {
+        for (const auto & ax : subplot_axes.attr("flatten")()) {
+          axes.push_back(pybind11::reinterpret_borrow<pybind11::object>(ax));
+        }
+      } else {
+        axes.push_back(subplot_axes);
+      }
+    }
+  }
+}
+
+RenderWorker::RenderWorker() : thread_([this] { run(); })
+{
+}
+
+RenderWorker::~RenderWorker()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    is_stopped_ = true;
+  }
+  condition_.notify_all();
+  thread_.join();
+}
+
+void RenderWorker::submit(std::vector<Command> commands)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    queue_.push_back(std::move(commands));
+  }
+  condition_.notify_all();
+}
+
+void RenderWorker::wait()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  condition_.wait(lock, [this] { return queue_.empty() && !is_rendering_; });
+}
+
+void RenderWorker::run()
+{
+  pybind11::scoped_interpreter guard{};
+  bool is_loaded = true;
+  try {
+    pybind11::module::import("matplotlib").attr("use")("Agg");
+  } catch (const std::exception & e) {
+    // the recordings are still consumed, so that wait() and the destructor do not block
+    std::cerr << "[autoware_pyplot] failed to load matplotlib: " << e.what() << std::endl;
+    is_loaded = false;
+  }
+  while (true) {
+    std::vector<Command> commands;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      condition_.wait(lock, [this] { return !queue_.empty() || is_stopped_; });
+      if (queue_.empty()) {
+        return;
+      }
+      commands = std::move(queue_.front());
+      queue_.pop_front();
+      is_rendering_ = true;
+    }
+    try {
+      if (is_loaded) {
+        render(commands);
+      }
+    } catch (const std::exception & e) {
+      std::cerr << "[autoware_pyplot] failed to render a recording: " << e.what() << std::endl;
+      // the next recordings do not draw on the figures left open by the failed one
+      pybind11::module::import("matplotlib.pyplot").attr("close")("all");
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      is_rendering_ = false;
+    }
+    condition_.notify_all();
+  }
+}
+}  // namespace recorder
+}  // namespace autoware::pyplot
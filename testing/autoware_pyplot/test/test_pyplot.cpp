@@ -14,6 +14,7 @@
 
 #include <autoware/pyplot/patches.hpp>
 #include <autoware/pyplot/pyplot.hpp>
+#include <autoware/pyplot/recorder.hpp>
 
 #include <gtest/gtest.h>
 #include <pybind11/embed.h>
@@ -61,4 +62,13 @@ TEST(PyPlot, single_plot)
     ax2.set_aspect(Args("equal"));
     plt.savefig(Args("test_double_plot.svg"));
   }
+  {
+    autoware::pyplot::Recorder recorder;
+    const auto axes = recorder.subplots(1, 2);
+    recorder.plot(axes[0], {1, 3, 2, 4}, {1, 2, 3, 4}, {{"color", "blue"}});
+    recorder.scatter(axes[1], {0.0, 0.5}, {0.5, 0.0});
+    recorder.call(axes[1], "set_aspect", {"equal"});
+    recorder.savefig("test_recorded_plot.png");
+    autoware::pyplot::render(recorder.take());
+  }
 }
@@ -0,0 +1,68 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <autoware/pyplot/recorder.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <variant>
+#include <vector>
+
+using autoware::pyplot::Recorder;
+
+TEST(Recorder, RecordValues)
+{
+  Recorder recorder;
+  recorder.call(
+    "plot", {std::vector<int>{1, 3, 2}},
+    {{"color", "blue"}, {"linewidth", 1.0}, {"zorder", 2}, {"visible", true}});
+
+  ASSERT_EQ(recorder.commands().size(), 1U);
+  const auto & command = recorder.commands().front();
+  EXPECT_FALSE(command.axes.has_value());
+  EXPECT_EQ(command.function, "plot");
+  ASSERT_EQ(command.args.size(), 1U);
+  EXPECT_EQ(
+    std::get<std::vector<double>>(command.args.front().get()), (std::vector<double>{1, 3, 2}));
+  ASSERT_EQ(command.kwargs.size(), 4U);
+  EXPECT_EQ(std::get<std::string>(command.kwargs[0].second.get()), "blue");
+  EXPECT_DOUBLE_EQ(std::get<double>(command.kwargs[1].second.get()), 1.0);
+  EXPECT_EQ(std::get<int64_t>(command.kwargs[2].second.get()), 2);
+  EXPECT_TRUE(std::get<bool>(command.kwargs[3].second.get()));
+}
+
+TEST(Recorder, RecordSubplots)
+{
+  Recorder recorder;
+  const auto axes = recorder.subplots(1, 2);
+  ASSERT_EQ(axes.size(), 2U);
+  recorder.plot(axes[1], {0.0, 1.0}, {1.0, 0.0});
+  recorder.call(axes[0], "set_aspect", {"equal"});
+  recorder.savefig("test_recorder.png");
+
+  const auto & commands = recorder.commands();
+  ASSERT_EQ(commands.size(), 5U);
+  EXPECT_EQ(commands[0].function, "subplots");
+  EXPECT_EQ(commands[1].axes, 1U);
+  EXPECT_EQ(commands[1].function, "plot");
+  EXPECT_EQ(commands[2].axes, 0U);
+  EXPECT_EQ(commands[3].function, "savefig");
+  EXPECT_EQ(commands[4].function, "close");
+
+  // the handles restart from the first axes of the next recording
+  EXPECT_EQ(recorder.take().size(), 5U);
+  EXPECT_TRUE(recorder.commands().empty());
+  EXPECT_EQ(recorder.subplots().front().index, 0U);
+}
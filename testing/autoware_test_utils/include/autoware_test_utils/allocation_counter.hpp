@@ -0,0 +1,66 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_TEST_UTILS__ALLOCATION_COUNTER_HPP_
+#define AUTOWARE_TEST_UTILS__ALLOCATION_COUNTER_HPP_
+
+#include <cstddef>
+#include <utility>
+
+namespace autoware::test_utils
+{
+struct AllocationStats
+{
+  size_t allocation_count{0};
+  size_t allocated_bytes{0};
+  size_t deallocation_count{0};
+};
+
+/**
+ * @brief Counts the allocations through the global operator new on the current thread while it is
+ * alive.
+ * @details The library autoware_test_utils_allocation_counter replaces the global operator new and
+ * delete of the program it is linked into, they only forward to malloc and free when no counter is
+ * alive. The counters can be nested, the inner ones do not hide the allocations from the outer
+ * ones. The allocations of the other threads, e.g. of the middleware, are not counted.
+ */
+class AllocationCounter
+{
+public:
+  AllocationCounter();
+  ~AllocationCounter();
+  AllocationCounter(const AllocationCounter &) = delete;
+  AllocationCounter & operator=(const AllocationCounter &) = delete;
+
+  /// @brief allocations since the construction
+  AllocationStats stats() const;
+
+  /// @brief whether the global operator new is replaced, false when the library is not linked
+  static bool is_hooked();
+
+private:
+  AllocationStats start_stats_;
+};
+
+/// @brief allocations of the current thread during the call of f, e.g. of executor.spin_some()
+template <class F>
+AllocationStats count_allocations(F && f)
+{
+  const AllocationCounter counter;
+  std::forward<F>(f)();
+  return counter.stats();
+}
+}  // namespace autoware::test_utils
+
+#endif  // AUTOWARE_TEST_UTILS__ALLOCATION_COUNTER_HPP_
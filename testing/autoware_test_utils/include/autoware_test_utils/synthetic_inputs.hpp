@@ -0,0 +1,58 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_TEST_UTILS__SYNTHETIC_INPUTS_HPP_
+#define AUTOWARE_TEST_UTILS__SYNTHETIC_INPUTS_HPP_
+
+#include <autoware_perception_msgs/msg/predicted_objects.hpp>
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+#include <cstddef>
+#include <string>
+
+namespace autoware::test_utils
+{
+/**
+ * @brief Synthesizes the objects of dense traffic.
+ *
+ * The cars are spread evenly over the lanes along the x axis, from x = 0 to length, on lanes of
+ * 3.5 m centered on y = 0. Each car drives along the x axis at 10 m/s and has one predicted path
+ * of path_point_num points every 0.5 s.
+ *
+ * @param object_num The number of objects.
+ * @param length The length of the road [m].
+ * @param lane_num The number of lanes.
+ * @param path_point_num The number of points of the predicted path of each object.
+ * @return The objects, in the map frame.
+ */
+autoware_perception_msgs::msg::PredictedObjects make_dense_objects(
+  const size_t object_num, const double length = 500.0, const size_t lane_num = 3,
+  const size_t path_point_num = 20);
+
+/**
+ * @brief Synthesizes a point cloud of x, y and z float32 fields.
+ *
+ * The points are drawn uniformly in [-range, range] x [-range, range] x [0, 3] with a fixed seed,
+ * so that the cloud is the same in every run.
+ *
+ * @param point_num The number of points.
+ * @param range The half size of the cloud along the x and y axes [m].
+ * @param frame_id The frame of the cloud.
+ * @return The point cloud.
+ */
+sensor_msgs::msg::PointCloud2 make_pointcloud(
+  const size_t point_num, const double range = 100.0, const std::string & frame_id = "base_link");
+}  // namespace autoware::test_utils
+
+#endif  // AUTOWARE_TEST_UTILS__SYNTHETIC_INPUTS_HPP_
@@ -0,0 +1,77 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_TEST_UTILS__SYNTHETIC_LANELET_MAP_HPP_
+#define AUTOWARE_TEST_UTILS__SYNTHETIC_LANELET_MAP_HPP_
+
+#include <lanelet2_core/LaneletMap.h>
+
+#include <cstddef>
+#include <string>
+
+namespace autoware::test_utils
+{
+struct SyntheticLaneletMapParameters
+{
+  double lane_width{3.5};      // [m]
+  double point_interval{5.0};  // [m] interval of the points of the lane bounds
+  double speed_limit{50.0};    // [km/h]
+};
+
+/**
+ * @brief Synthesizes the lanelet map of a grid city.
+ *
+ * The block_num x block_num blocks are surrounded by two-way streets of one lane per direction,
+ * and each intersection has a lanelet for every straight, left and right turn between its
+ * streets, so that the size of the map and of the routing graph grows with block_num^2.
+ *
+ * @param block_num The number of blocks along the x and y axes.
+ * @param block_length The distance between two intersections [m].
+ * @param params The lane parameters.
+ * @return The synthesized map, whose origin is the south west intersection.
+ */
+lanelet::LaneletMapPtr make_grid_city_lanelet_map(
+  const size_t block_num, const double block_length = 100.0,
+  const SyntheticLaneletMapParameters & params = SyntheticLaneletMapParameters{});
+
+/**
+ * @brief Synthesizes the lanelet map of a straight one-way highway along the x axis.
+ *
+ * The highway is split into segment_num segments of lane_num lanes, the lane change is allowed
+ * between its lanes, and the lane 0 is the rightmost one, on y in [0, lane_width].
+ *
+ * @param segment_num The number of segments.
+ * @param lane_num The number of the lanes.
+ * @param segment_length The length of a segment [m].
+ * @param params The lane parameters.
+ * @return The synthesized map.
+ */
+lanelet::LaneletMapPtr make_highway_lanelet_map(
+  const size_t segment_num, const size_t lane_num, const double segment_length = 100.0,
+  const SyntheticLaneletMapParameters & params = SyntheticLaneletMapParameters{});
+
+/**
+ * @brief Writes a synthesized map as an OSM file which is loaded like the map files of Autoware.
+ *
+ * The coordinates of the points are written in their local_x and local_y tags, which both the
+ * MGRS and the local projector of the lanelet2 map loader use.
+ *
+ * @param map The map to write.
+ * @param path The path of the OSM file.
+ * @throw std::runtime_error if the map cannot be written.
+ */
+void write_lanelet_map(const lanelet::LaneletMap & map, const std::string & path);
+}  // namespace autoware::test_utils
+
+#endif  // AUTOWARE_TEST_UTILS__SYNTHETIC_LANELET_MAP_HPP_
@@ -0,0 +1,169 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_test_utils/allocation_counter.hpp"
+
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+// NOTE: plain thread local PODs, so that their access never allocates
+thread_local size_t active_counter_num = 0;
+thread_local autoware::test_utils::AllocationStats thread_stats{};
+
+void * allocate(const size_t size, const size_t alignment)
+{
+  const size_t request_size = size == 0 ? 1 : size;
+  while (true) {
+    void * ptr = nullptr;
+    if (alignment <= alignof(std::max_align_t)) {
+      ptr = std::malloc(request_size);
+    } else if (posix_memalign(&ptr, alignment, request_size) != 0) {
+      ptr = nullptr;
+    }
+    if (ptr) {
+      if (active_counter_num > 0) {
+        ++thread_stats.allocation_count;
+        thread_stats.allocated_bytes += size;
+      }
+      return ptr;
+    }
+    const auto handler = std::get_new_handler();
+    if (!handler) {
+      throw std::bad_alloc();
+    }
+    handler();
+  }
+}
+
+void deallocate(void * ptr) noexcept
+{
+  if (!ptr) {
+    return;
+  }
+  if (active_counter_num > 0) {
+    ++thread_stats.deallocation_count;
+  }
+  std::free(ptr);
+}
+}  // namespace
+
+namespace autoware::test_utils
+{
+AllocationCounter::AllocationCounter() : start_stats_(thread_stats)
+{
+  ++active_counter_num;
+}
+
+AllocationCounter::~AllocationCounter()
+{
+  --active_counter_num;
+}
+
+AllocationStats AllocationCounter::stats() const
+{
+  AllocationStats stats;
+  stats.allocation_count = thread_stats.allocation_count - start_stats_.allocation_count;
+  stats.allocated_bytes = thread_stats.allocated_bytes - start_stats_.allocated_bytes;
+  stats.deallocation_count = thread_stats.deallocation_count - start_stats_.deallocation_count;
+  return stats;
+}
+
+bool AllocationCounter::is_hooked()
+{
+  const AllocationCounter counter;
+  delete new char;  // NOLINT
+  return counter.stats().allocation_count == 1;
+}
+}  // namespace autoware::test_utils
+
+// replacements of the global allocation functions
+void * operator new(size_t size)
+{
+  return allocate(size, alignof(std::max_align_t));
+}
+
+void * operator new[](size_t size)
+{
+  return allocate(size, alignof(std::max_align_t));
+}
+
+void * operator new(size_t size, const std::nothrow_t &) noexcept
+{
+  try {
+    return allocate(size, alignof(std::max_align_t));
+  } catch (const std::bad_alloc &) {
+    return nullptr;
+  }
+}
+
+void * operator new[](size_t size, const std::nothrow_t &) noexcept
+{
+  try {
+    return allocate(size, alignof(std::max_align_t));
+  } catch (const std::bad_alloc &) {
+    return nullptr;
+  }
+}
+
+void * operator new(size_t size, std::align_val_t alignment)
+{
+  return allocate(size, static_cast<size_t>(alignment));
+}
+
+void * operator new[](size_t size, std::align_val_t alignment)
+{
+  return allocate(size, static_cast<size_t>(alignment));
+}
+
+void operator delete(void * ptr) noexcept
+{
+  deallocate(ptr);
+}
+
+void operator delete[](void * ptr) noexcept
+{
+  deallocate(ptr);
+}
+
+void operator delete(void * ptr, size_t) noexcept
+{
+  deallocate(ptr);
+}
+
+void operator delete[](void * ptr, size_t) noexcept
+{
+  deallocate(ptr);
+}
+
+void operator delete(void * ptr, std::align_val_t) noexcept
+{
+  deallocate(ptr);
+}
+
+void operator delete[](void * ptr, std::align_val_t) noexcept
+{
+  deallocate(ptr);
+}
+
+void operator delete(void * ptr, size_t, std::align_val_t) noexcept
+{
+  deallocate(ptr);
+}
+
+void operator delete[](void * ptr, size_t, std::align_val_t) noexcept
+{
+  deallocate(ptr);
+}
@@ -0,0 +1,101 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_test_utils/synthetic_inputs.hpp"
+
+#include "autoware_test_utils/autoware_test_utils.hpp"
+
+#include <rclcpp/duration.hpp>
+#include <sensor_msgs/point_cloud2_iterator.hpp>
+
+#include <autoware_perception_msgs/msg/object_classification.hpp>
+#include <autoware_perception_msgs/msg/shape.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+
+namespace autoware::test_utils
+{
+autoware_perception_msgs::msg::PredictedObjects make_dense_objects(
+  const size_t object_num, const double length, const size_t lane_num, const size_t path_point_num)
+{
+  constexpr double lane_width = 3.5;
+  constexpr double velocity = 10.0;
+  constexpr double time_step = 0.5;
+
+  autoware_perception_msgs::msg::PredictedObjects objects;
+  objects.header.frame_id = "map";
+  const auto lanes = std::max<size_t>(lane_num, 1);
+  const auto objects_per_lane = std::max<size_t>((object_num + lanes - 1) / lanes, 1);
+  const double interval = length / static_cast<double>(objects_per_lane);
+  for (size_t i = 0; i < object_num; ++i) {
+    const double x = interval * static_cast<double>(i / lanes);
+    const double y =
+      (static_cast<double>(i % lanes) - static_cast<double>(lanes - 1) / 2.0) * lane_width;
+
+    autoware_perception_msgs::msg::PredictedObject object;
+    // the index as the unique id
+    for (size_t j = 0; j < sizeof(size_t); ++j) {
+      object.object_id.uuid.at(j) = static_cast<uint8_t>((i >> (8 * j)) & 0xff);
+    }
+    object.existence_probability = 1.0;
+    autoware_perception_msgs::msg::ObjectClassification classification;
+    classification.label = autoware_perception_msgs::msg::ObjectClassification::CAR;
+    classification.probability = 1.0;
+    object.classification.push_back(classification);
+    object.kinematics.initial_pose_with_covariance.pose = createPose(x, y, 0.0, 0.0, 0.0, 0.0);
+    object.kinematics.initial_twist_with_covariance.twist.linear.x = velocity;
+    object.shape.type = autoware_perception_msgs::msg::Shape::BOUNDING_BOX;
+    object.shape.dimensions.x = 4.5;
+    object.shape.dimensions.y = 1.8;
+    object.shape.dimensions.z = 1.5;
+
+    autoware_perception_msgs::msg::PredictedPath path;
+    path.confidence = 1.0;
+    path.time_step = rclcpp::Duration::from_seconds(time_step);
+    for (size_t j = 0; j < path_point_num; ++j) {
+      path.path.push_back(
+        createPose(x + velocity * time_step * static_cast<double>(j), y, 0.0, 0.0, 0.0, 0.0));
+    }
+    object.kinematics.predicted_paths.push_back(path);
+    objects.objects.push_back(object);
+  }
+  return objects;
+}
+
+sensor_msgs::msg::PointCloud2 make_pointcloud(
+  const size_t point_num, const double range, const std::string & frame_id)
+{
+  sensor_msgs::msg::PointCloud2 pointcloud;
+  pointcloud.header.frame_id = frame_id;
+  sensor_msgs::PointCloud2Modifier modifier(pointcloud);
+  modifier.setPointCloud2FieldsByString(1, "xyz");
+  modifier.resize(point_num);
+
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<float> xy(static_cast<float>(-range), static_cast<float>(range));
+  std::uniform_real_distribution<float> z(0.0f, 3.0f);
+  sensor_msgs::PointCloud2Iterator<float> iter_x(pointcloud, "x");
+  sensor_msgs::PointCloud2Iterator<float> iter_y(pointcloud, "y");
+  sensor_msgs::PointCloud2Iterator<float> iter_z(pointcloud, "z");
+  for (; iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_z) {
+    *iter_x = xy(engine);
+    *iter_y = xy(engine);
+    *iter_z = z(engine);
+  }
+  return pointcloud;
+}
+}  // namespace autoware::test_utils
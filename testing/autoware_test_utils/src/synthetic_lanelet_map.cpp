@@ -0,0 +1,200 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_test_utils/synthetic_lanelet_map.hpp"
+
+#include <lanelet2_core/primitives/Lanelet.h>
+#include <lanelet2_core/utility/Utilities.h>
+#include <lanelet2_io/Io.h>
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace autoware::test_utils
+{
+namespace
+{
+// directions of the lanes of the grid city, counterclockwise so that the difference of two
+// directions gives the turn between them
+enum Direction { EAST = 0, NORTH = 1, WEST = 2, SOUTH = 3 };
+
+lanelet::Point3d make_point(const double x, const double y)
+{
+  lanelet::Point3d point(lanelet::utils::getId(), x, y, 0.0);
+  point.setAttribute("local_x", x);
+  point.setAttribute("local_y", y);
+  return point;
+}
+
+// line string from front to back with points at most point_interval apart
+lanelet::LineString3d make_line(
+  const lanelet::Point3d & front, const lanelet::Point3d & back, const double point_interval,
+  const std::string & type, const std::string & subtype)
+{
+  const double length = std::hypot(back.x() - front.x(), back.y() - front.y());
+  const auto segment_num =
+    std::max<size_t>(1, static_cast<size_t>(std::ceil(length / point_interval)));
+  lanelet::Points3d points{front};
+  for (size_t i = 1; i < segment_num; ++i) {
+    const double ratio = static_cast<double>(i) / static_cast<double>(segment_num);
+    points.push_back(make_point(
+      front.x() + ratio * (back.x() - front.x()), front.y() + ratio * (back.y() - front.y())));
+  }
+  points.push_back(back);
+  return lanelet::LineString3d(
+    lanelet::utils::getId(), points, lanelet::AttributeMap{{"type", type}, {"subtype", subtype}});
+}
+
+lanelet::Lanelet make_road_lanelet(
+  const lanelet::LineString3d & left_bound, const lanelet::LineString3d & right_bound,
+  const SyntheticLaneletMapParameters & params)
+{
+  return lanelet::Lanelet(
+    lanelet::utils::getId(), left_bound, right_bound,
+    lanelet::AttributeMap{
+      {"type", "lanelet"},
+      {"subtype", "road"},
+      {"location", "urban"},
+      {"one_way", "yes"},
+      {"speed_limit", std::to_string(params.speed_limit)}});
+}
+}  // namespace
+
+lanelet::LaneletMapPtr make_grid_city_lanelet_map(
+  const size_t block_num, const double block_length, const SyntheticLaneletMapParameters & params)
+{
+  const double w = params.lane_width;
+  // half size of the intersections, so that the bounds of the turns do not degenerate
+  const double margin = 2.0 * w;
+
+  lanelet::Lanelets lanelets;
+  // lanes entering and leaving each intersection, by their direction
+  std::map<std::pair<size_t, size_t>, std::vector<std::pair<Direction, lanelet::Lanelet>>>
+    incoming_lanes;
+  std::map<std::pair<size_t, size_t>, std::vector<std::pair<Direction, lanelet::Lanelet>>>
+    outgoing_lanes;
+  // street from the intersection "from" to "to" along the center line from (x0, y0) to (x1, y1),
+  // whose right side is in the direction (right_x, right_y)
+  const auto add_street = [&](
+                            const std::pair<size_t, size_t> & from,
+                            const std::pair<size_t, size_t> & to, const Direction direction,
+                            const double x0, const double y0, const double x1, const double y1,
+                            const double right_x, const double right_y) {
+    const auto make_bound = [&](const double offset) {
+      return make_line(
+        make_point(x0 + offset * right_x, y0 + offset * right_y),
+        make_point(x1 + offset * right_x, y1 + offset * right_y), params.point_interval,
+        "line_thin", "solid");
+    };
+    const auto center = make_bound(0.0);
+    const auto right = make_bound(w);
+    const auto left = make_bound(-w);
+    // the lane from "from" to "to" is on the right of the center line, the opposite one on its left
+    const auto forward_lane = make_road_lanelet(center, right, params);
+    const auto backward_lane = make_road_lanelet(center.invert(), left.invert(), params);
+    const auto backward_direction = static_cast<Direction>((direction + 2) % 4);
+    lanelets.push_back(forward_lane);
+    lanelets.push_back(backward_lane);
+    outgoing_lanes[from].emplace_back(direction, forward_lane);
+    incoming_lanes[to].emplace_back(direction, forward_lane);
+    outgoing_lanes[to].emplace_back(backward_direction, backward_lane);
+    incoming_lanes[from].emplace_back(backward_direction, backward_lane);
+  };
+
+  for (size_t i = 0; i <= block_num; ++i) {
+    for (size_t j = 0; j <= block_num; ++j) {
+      const double x = static_cast<double>(i) * block_length;
+      const double y = static_cast<double>(j) * block_length;
+      if (i < block_num) {
+        add_street(
+          {i, j}, {i + 1, j}, EAST, x + margin, y, x + block_length - margin, y, 0.0, -1.0);
+      }
+      if (j < block_num) {
+        add_street(
+          {i, j}, {i, j + 1}, NORTH, x, y + margin, x, y + block_length - margin, 1.0, 0.0);
+      }
+    }
+  }
+
+  // connect every incoming lane of an intersection to its outgoing lanes except for the U-turns
+  for (const auto & [intersection, in_lanes] : incoming_lanes) {
+    for (const auto & [in_direction, in_lane] : in_lanes) {
+      for (const auto & [out_direction, out_lane] : outgoing_lanes[intersection]) {
+        const auto turn = (out_direction - in_direction + 4) % 4;
+        if (turn == 2) {
+          continue;
+        }
+        const auto left = make_line(
+          in_lane.leftBound().back(), out_lane.leftBound().front(), params.point_interval,
+          "virtual", "");
+        const auto right = make_line(
+          in_lane.rightBound().back(), out_lane.rightBound().front(), params.point_interval,
+          "virtual", "");
+        auto lanelet = make_road_lanelet(left, right, params);
+        lanelet.setAttribute(
+          "turn_direction", turn == 0 ? "straight" : (turn == 1 ? "left" : "right"));
+        lanelets.push_back(lanelet);
+      }
+    }
+  }
+  return lanelet::utils::createMap(lanelets);
+}
+
+lanelet::LaneletMapPtr make_highway_lanelet_map(
+  const size_t segment_num, const size_t lane_num, const double segment_length,
+  const SyntheticLaneletMapParameters & params)
+{
+  const auto make_boundary_points = [&](const double x) {
+    lanelet::Points3d points;
+    for (size_t j = 0; j <= lane_num; ++j) {
+      points.push_back(make_point(x, static_cast<double>(j) * params.lane_width));
+    }
+    return points;
+  };
+
+  lanelet::Lanelets lanelets;
+  auto front_points = make_boundary_points(0.0);
+  for (size_t s = 0; s < segment_num; ++s) {
+    const auto back_points = make_boundary_points(static_cast<double>(s + 1) * segment_length);
+    std::vector<lanelet::LineString3d> boundaries;
+    for (size_t j = 0; j <= lane_num; ++j) {
+      const bool is_outer = j == 0 || j == lane_num;
+      boundaries.push_back(make_line(
+        front_points.at(j), back_points.at(j), params.point_interval, "line_thin",
+        is_outer ? "solid" : "dashed"));
+    }
+    // the lanes share their boundaries with their neighbors, which allows the lane changes
+    for (size_t i = 0; i < lane_num; ++i) {
+      lanelets.push_back(make_road_lanelet(boundaries.at(i + 1), boundaries.at(i), params));
+    }
+    front_points = back_points;
+  }
+  return lanelet::utils::createMap(lanelets);
+}
+
+void write_lanelet_map(const lanelet::LaneletMap & map, const std::string & path)
+{
+  lanelet::ErrorMessages errors{};
+  lanelet::write(path, map, lanelet::Origin({0.0, 0.0}), &errors);
+  if (!errors.empty()) {
+    throw std::runtime_error(
+      "failed to write the lanelet map to " + path + ": " + errors.front());
+  }
+}
+}  // namespace autoware::test_utils
@@ -0,0 +1,59 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_test_utils/allocation_counter.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace autoware::test_utils
+{
+TEST(AllocationCounter, CountAllocations)
+{
+  ASSERT_TRUE(AllocationCounter::is_hooked());
+
+  // a buffer reserved beforehand does not allocate in the steady state
+  std::vector<double> buffer;
+  buffer.reserve(100);
+  const auto steady_stats = count_allocations([&]() {
+    buffer.clear();
+    for (int i = 0; i < 100; ++i) {
+      buffer.push_back(i);
+    }
+  });
+  EXPECT_EQ(steady_stats.allocation_count, 0U);
+  EXPECT_EQ(steady_stats.allocated_bytes, 0U);
+
+  const AllocationCounter outer;
+  const auto stats = count_allocations([]() {
+    const std::vector<double> values(10);
+    const auto value = std::make_unique<int>(1);
+  });
+  EXPECT_EQ(stats.allocation_count, 2U);
+  EXPECT_EQ(stats.allocated_bytes, 10 * sizeof(double) + sizeof(int));
+  EXPECT_EQ(stats.deallocation_count, 2U);
+
+  // the allocations of the other threads are not counted, only the creation of the thread is
+  const auto count_before_thread = outer.stats().allocation_count;
+  std::thread([]() {
+    for (int i = 0; i < 100; ++i) {
+      const auto value = std::make_unique<int>(i);
+    }
+  }).join();
+  EXPECT_LT(outer.stats().allocation_count - count_before_thread, 10U);
+}
+}  // namespace autoware::test_utils
@@ -0,0 +1,51 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_test_utils/synthetic_inputs.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <set>
+
+namespace autoware::test_utils
+{
+TEST(SyntheticInputs, DenseObjects)
+{
+  const auto objects = make_dense_objects(100, 500.0, 3, 20);
+  ASSERT_EQ(objects.objects.size(), 100U);
+
+  std::set<decltype(objects.objects.front().object_id.uuid)> ids;
+  for (const auto & object : objects.objects) {
+    ids.insert(object.object_id.uuid);
+    const auto & position = object.kinematics.initial_pose_with_covariance.pose.position;
+    EXPECT_GE(position.x, 0.0);
+    EXPECT_LT(position.x, 500.0);
+    EXPECT_LE(std::abs(position.y), 3.5);
+    ASSERT_EQ(object.kinematics.predicted_paths.size(), 1U);
+    EXPECT_EQ(object.kinematics.predicted_paths.front().path.size(), 20U);
+  }
+  EXPECT_EQ(ids.size(), 100U);
+}
+
+TEST(SyntheticInputs, PointCloud)
+{
+  const auto pointcloud = make_pointcloud(1000, 50.0);
+  EXPECT_EQ(pointcloud.width * pointcloud.height, 1000U);
+  EXPECT_EQ(pointcloud.fields.size(), 3U);
+  EXPECT_EQ(pointcloud.header.frame_id, "base_link");
+  // the same seed gives the same cloud
+  EXPECT_EQ(pointcloud.data, make_pointcloud(1000, 50.0).data);
+}
+}  // namespace autoware::test_utils